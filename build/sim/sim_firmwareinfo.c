@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ *
+ * @file       ['/root/repo/build/sim/sim_firmwareinfo.c']
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2011.
+ * @brief      Firmware version info file autogenerated using template
+ *             ['/root/repo/make/templates/firmwareinfotemplate.c']
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stdint.h>
+
+/**
+ * We have 100 bytes for the whole description.
+ *
+ *
+ * Structure is:
+ *   4 bytes: header: "TlFw".
+ *   4 bytes: GIT commit tag (short version of SHA1).
+ *   4 bytes: Unix timestamp of compile time.
+ *   2 bytes: target platform. Should follow same rule as BOARD_TYPE and BOARD_REVISION in board define files.
+ *  26 bytes: commit tag if it is there, otherwise branch name. '-dirty' may be added if needed. Zero-padded.
+ *  20 bytes: SHA1 sum of the firmware.
+ *  20 bytes: SHA1 sum of the uavo definitions.
+ *  8 bytes: GIT commit tag of ancestor common with next
+ *  16 bytes: free for now.
+ *
+ */
+
+struct __attribute__((packed)) fw_version_info {
+	uint8_t magic[4];
+	uint32_t commit_hash_prefix;
+	uint32_t timestamp;
+	uint8_t board_type;
+	uint8_t board_revision;
+	uint8_t commit_tag_name[26];
+	uint8_t sha1sum[20];
+	uint8_t uavosha1[20];
+	uint64_t next_ancestor_hash;
+	uint8_t reserved[12];
+};
+
+#ifndef SIM_POSIX
+#define FW_VERS_SECTION __attribute__((__section__(".fw_version_blob")))
+#else
+#define FW_VERS_SECTION
+#endif
+
+const struct fw_version_info fw_version_blob __attribute__((used)) FW_VERS_SECTION = {
+	.magic = { 'T','l','F','w' },
+	.commit_hash_prefix = 0x4aeaeda8,
+	.timestamp = 1792390393,
+	.board_type = 0x7F,
+	.board_revision = 0x02,
+	.commit_tag_name = "master",
+	.sha1sum = { 0 },
+	.uavosha1 = { 0x35,0x8e,0x89,0x55,0x3c,0x43,0xf9,0xf6,0xda,0x16,0x1c,0xea,0x7c,0xd5,0xfb,0xb4,0x27,0x85,0x9b,0x71 },
+	.next_ancestor_hash = 0x0,
+}; 
+
+/**
+ * @}
+ */
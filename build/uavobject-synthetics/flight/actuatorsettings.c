@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       actuatorsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ActuatorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: actuatorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "actuatorsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const ActuatorSettingsData defaultData = {
+	.LowPowerStabilizationMaxPowerAdd = 0.07,
+	.LowPowerStabilizationMaxTime = 0,
+	.MotorInputOutputCurveFit = 0.9,
+	.TimerUpdateFreq = { 50, 50, 50, 50, 50, 50 },
+	.ChannelMax = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.ChannelNeutral = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.ChannelMin = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.MotorsSpinWhileArmed = 0,
+	.DirectMixing = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ACTUATORSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ACTUATORSETTINGS_OBJID,
+			ACTUATORSETTINGS_ISSINGLEINST, ACTUATORSETTINGS_ISSETTINGS, ACTUATORSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ActuatorSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ActuatorSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ActuatorSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ActuatorSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ActuatorSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ActuatorSettingsLowPowerStabilizationMaxPowerAddSet( float *NewLowPowerStabilizationMaxPowerAdd )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxPowerAdd, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxPowerAdd), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxPowerAddGet( float *NewLowPowerStabilizationMaxPowerAdd )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxPowerAdd, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxPowerAdd), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxTimeSet( float *NewLowPowerStabilizationMaxTime )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxTime, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxTime), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxTimeGet( float *NewLowPowerStabilizationMaxTime )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxTime, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxTime), sizeof(float));
+}
+void ActuatorSettingsMotorInputOutputCurveFitSet( float *NewMotorInputOutputCurveFit )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewMotorInputOutputCurveFit, offsetof( ActuatorSettingsData, MotorInputOutputCurveFit), sizeof(float));
+}
+void ActuatorSettingsMotorInputOutputCurveFitGet( float *NewMotorInputOutputCurveFit )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewMotorInputOutputCurveFit, offsetof( ActuatorSettingsData, MotorInputOutputCurveFit), sizeof(float));
+}
+void ActuatorSettingsTimerUpdateFreqSet( uint16_t *NewTimerUpdateFreq )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewTimerUpdateFreq, offsetof( ActuatorSettingsData, TimerUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsTimerUpdateFreqGet( uint16_t *NewTimerUpdateFreq )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewTimerUpdateFreq, offsetof( ActuatorSettingsData, TimerUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMaxSet( uint16_t *NewChannelMax )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelMax, offsetof( ActuatorSettingsData, ChannelMax), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMaxGet( uint16_t *NewChannelMax )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelMax, offsetof( ActuatorSettingsData, ChannelMax), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelNeutralSet( uint16_t *NewChannelNeutral )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelNeutral, offsetof( ActuatorSettingsData, ChannelNeutral), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelNeutralGet( uint16_t *NewChannelNeutral )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelNeutral, offsetof( ActuatorSettingsData, ChannelNeutral), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMinSet( uint16_t *NewChannelMin )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelMin, offsetof( ActuatorSettingsData, ChannelMin), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMinGet( uint16_t *NewChannelMin )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelMin, offsetof( ActuatorSettingsData, ChannelMin), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsMotorsSpinWhileArmedSet( uint8_t *NewMotorsSpinWhileArmed )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewMotorsSpinWhileArmed, offsetof( ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(uint8_t));
+}
+void ActuatorSettingsMotorsSpinWhileArmedGet( uint8_t *NewMotorsSpinWhileArmed )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewMotorsSpinWhileArmed, offsetof( ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(uint8_t));
+}
+void ActuatorSettingsDirectMixingSet( uint8_t *NewDirectMixing )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewDirectMixing, offsetof( ActuatorSettingsData, DirectMixing), sizeof(uint8_t));
+}
+void ActuatorSettingsDirectMixingGet( uint8_t *NewDirectMixing )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewDirectMixing, offsetof( ActuatorSettingsData, DirectMixing), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
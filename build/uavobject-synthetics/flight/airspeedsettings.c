@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       airspeedsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AirspeedSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: airspeedsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "airspeedsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const AirspeedSettingsData defaultData = {
+	.Scale = 1,
+	.ZeroPoint = 0,
+	.GPSSamplePeriod_ms = 100,
+	.AirspeedSensorType = 3,
+	.AnalogPin = 9,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AirspeedSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(AIRSPEEDSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(AIRSPEEDSETTINGS_OBJID,
+			AIRSPEEDSETTINGS_ISSINGLEINST, AIRSPEEDSETTINGS_ISSETTINGS, AIRSPEEDSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AirspeedSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AirspeedSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AirspeedSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AirspeedSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AirspeedSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AirspeedSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AirspeedSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AirspeedSettingsScaleSet( float *NewScale )
+{
+	UAVObjSetDataField(AirspeedSettingsHandle(), (void*)NewScale, offsetof( AirspeedSettingsData, Scale), sizeof(float));
+}
+void AirspeedSettingsScaleGet( float *NewScale )
+{
+	UAVObjGetDataField(AirspeedSettingsHandle(), (void*)NewScale, offsetof( AirspeedSettingsData, Scale), sizeof(float));
+}
+void AirspeedSettingsZeroPointSet( uint16_t *NewZeroPoint )
+{
+	UAVObjSetDataField(AirspeedSettingsHandle(), (void*)NewZeroPoint, offsetof( AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+void AirspeedSettingsZeroPointGet( uint16_t *NewZeroPoint )
+{
+	UAVObjGetDataField(AirspeedSettingsHandle(), (void*)NewZeroPoint, offsetof( AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+void AirspeedSettingsGPSSamplePeriod_msSet( uint8_t *NewGPSSamplePeriod_ms )
+{
+	UAVObjSetDataField(AirspeedSettingsHandle(), (void*)NewGPSSamplePeriod_ms, offsetof( AirspeedSettingsData, GPSSamplePeriod_ms), sizeof(uint8_t));
+}
+void AirspeedSettingsGPSSamplePeriod_msGet( uint8_t *NewGPSSamplePeriod_ms )
+{
+	UAVObjGetDataField(AirspeedSettingsHandle(), (void*)NewGPSSamplePeriod_ms, offsetof( AirspeedSettingsData, GPSSamplePeriod_ms), sizeof(uint8_t));
+}
+void AirspeedSettingsAirspeedSensorTypeSet( uint8_t *NewAirspeedSensorType )
+{
+	UAVObjSetDataField(AirspeedSettingsHandle(), (void*)NewAirspeedSensorType, offsetof( AirspeedSettingsData, AirspeedSensorType), sizeof(uint8_t));
+}
+void AirspeedSettingsAirspeedSensorTypeGet( uint8_t *NewAirspeedSensorType )
+{
+	UAVObjGetDataField(AirspeedSettingsHandle(), (void*)NewAirspeedSensorType, offsetof( AirspeedSettingsData, AirspeedSensorType), sizeof(uint8_t));
+}
+void AirspeedSettingsAnalogPinSet( uint8_t *NewAnalogPin )
+{
+	UAVObjSetDataField(AirspeedSettingsHandle(), (void*)NewAnalogPin, offsetof( AirspeedSettingsData, AnalogPin), sizeof(uint8_t));
+}
+void AirspeedSettingsAnalogPinGet( uint8_t *NewAnalogPin )
+{
+	UAVObjGetDataField(AirspeedSettingsHandle(), (void*)NewAnalogPin, offsetof( AirspeedSettingsData, AnalogPin), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       altitudeholddesired.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AltitudeHoldDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudeholddesired.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "altitudeholddesired.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 1000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AltitudeHoldDesiredInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ALTITUDEHOLDDESIRED_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ALTITUDEHOLDDESIRED_OBJID,
+			ALTITUDEHOLDDESIRED_ISSINGLEINST, ALTITUDEHOLDDESIRED_ISSETTINGS, ALTITUDEHOLDDESIRED_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AltitudeHoldDesiredSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AltitudeHoldDesiredData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AltitudeHoldDesiredSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AltitudeHoldDesiredSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AltitudeHoldDesiredSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AltitudeHoldDesiredSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AltitudeHoldDesiredHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AltitudeHoldDesiredAltitudeSet( float *NewAltitude )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewAltitude, offsetof( AltitudeHoldDesiredData, Altitude), sizeof(float));
+}
+void AltitudeHoldDesiredAltitudeGet( float *NewAltitude )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewAltitude, offsetof( AltitudeHoldDesiredData, Altitude), sizeof(float));
+}
+void AltitudeHoldDesiredClimbRateSet( float *NewClimbRate )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewClimbRate, offsetof( AltitudeHoldDesiredData, ClimbRate), sizeof(float));
+}
+void AltitudeHoldDesiredClimbRateGet( float *NewClimbRate )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewClimbRate, offsetof( AltitudeHoldDesiredData, ClimbRate), sizeof(float));
+}
+void AltitudeHoldDesiredRollSet( float *NewRoll )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewRoll, offsetof( AltitudeHoldDesiredData, Roll), sizeof(float));
+}
+void AltitudeHoldDesiredRollGet( float *NewRoll )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewRoll, offsetof( AltitudeHoldDesiredData, Roll), sizeof(float));
+}
+void AltitudeHoldDesiredPitchSet( float *NewPitch )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewPitch, offsetof( AltitudeHoldDesiredData, Pitch), sizeof(float));
+}
+void AltitudeHoldDesiredPitchGet( float *NewPitch )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewPitch, offsetof( AltitudeHoldDesiredData, Pitch), sizeof(float));
+}
+void AltitudeHoldDesiredYawSet( float *NewYaw )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewYaw, offsetof( AltitudeHoldDesiredData, Yaw), sizeof(float));
+}
+void AltitudeHoldDesiredYawGet( float *NewYaw )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewYaw, offsetof( AltitudeHoldDesiredData, Yaw), sizeof(float));
+}
+void AltitudeHoldDesiredLandSet( uint8_t *NewLand )
+{
+	UAVObjSetDataField(AltitudeHoldDesiredHandle(), (void*)NewLand, offsetof( AltitudeHoldDesiredData, Land), sizeof(uint8_t));
+}
+void AltitudeHoldDesiredLandGet( uint8_t *NewLand )
+{
+	UAVObjGetDataField(AltitudeHoldDesiredHandle(), (void*)NewLand, offsetof( AltitudeHoldDesiredData, Land), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup AltitudeHoldDesired AltitudeHoldDesired
+ * @brief Holds the desired altitude (from manual control) as well as the desired attitude to pass through
+ *
+ *
+ * @file       altitudeholddesired.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the AltitudeHoldDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudeholddesired.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ALTITUDEHOLDDESIRED_H
+#define ALTITUDEHOLDDESIRED_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ALTITUDEHOLDDESIRED_OBJID 0xE7B9C87A
+#define ALTITUDEHOLDDESIRED_ISSINGLEINST 1
+#define ALTITUDEHOLDDESIRED_ISSETTINGS 0
+#define ALTITUDEHOLDDESIRED_NUMBYTES 21
+
+// Generic interface functions
+int32_t AltitudeHoldDesiredInitialize();
+UAVObjHandle AltitudeHoldDesiredHandle();
+void AltitudeHoldDesiredSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Altitude;
+    float ClimbRate;
+    float Roll;
+    float Pitch;
+    float Yaw;
+    uint8_t Land;
+
+} __attribute__((packed)) __attribute__((aligned(4))) AltitudeHoldDesiredData;
+
+// Typesafe Object access functions
+/**
+ * @function AltitudeHoldDesiredGet(dataOut)
+ * @brief Populate a AltitudeHoldDesiredData object
+ * @param[out] dataOut 
+ */
+static inline int32_t AltitudeHoldDesiredGet(AltitudeHoldDesiredData *dataOut) { return UAVObjGetData(AltitudeHoldDesiredHandle(), dataOut); }
+
+static inline int32_t AltitudeHoldDesiredSet(const AltitudeHoldDesiredData *dataIn) { return UAVObjSetData(AltitudeHoldDesiredHandle(), dataIn); }
+
+static inline int32_t AltitudeHoldDesiredInstGet(uint16_t instId, AltitudeHoldDesiredData *dataOut) { return UAVObjGetInstanceData(AltitudeHoldDesiredHandle(), instId, dataOut); }
+
+static inline int32_t AltitudeHoldDesiredInstSet(uint16_t instId, const AltitudeHoldDesiredData *dataIn) { return UAVObjSetInstanceData(AltitudeHoldDesiredHandle(), instId, dataIn); }
+
+static inline int32_t AltitudeHoldDesiredConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(AltitudeHoldDesiredHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldDesiredConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(AltitudeHoldDesiredHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldDesiredConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(AltitudeHoldDesiredHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldDesiredConnectCopy(volatile AltitudeHoldDesiredData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	AltitudeHoldDesiredGet((void *) dataOut);
+
+	return UAVObjConnectCallback(AltitudeHoldDesiredHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t AltitudeHoldDesiredCreateInstance() { return UAVObjCreateInstance(AltitudeHoldDesiredHandle(), &AltitudeHoldDesiredSetDefaults); }
+
+static inline void AltitudeHoldDesiredUpdated() { UAVObjUpdated(AltitudeHoldDesiredHandle()); }
+
+static inline void AltitudeHoldDesiredInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(AltitudeHoldDesiredHandle(), instId); }
+
+static inline int32_t AltitudeHoldDesiredGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(AltitudeHoldDesiredHandle(), dataOut); }
+
+static inline int32_t AltitudeHoldDesiredSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(AltitudeHoldDesiredHandle(), dataIn); }
+
+static inline int8_t AltitudeHoldDesiredReadOnly() { return UAVObjReadOnly(AltitudeHoldDesiredHandle()); }
+
+static inline uint16_t AltitudeHoldDesiredGetNumInstances(){ return UAVObjGetNumInstances(AltitudeHoldDesiredHandle()); }
+
+static inline uint32_t AltitudeHoldDesiredGetNumBytes(){ return UAVObjGetNumBytes(AltitudeHoldDesiredHandle()); }
+
+// Field information
+// Field Altitude information
+// Field ClimbRate information
+// Field Roll information
+// Field Pitch information
+// Field Yaw information
+// Field Land information
+/* Enumeration options for field Land */
+typedef enum { ALTITUDEHOLDDESIRED_LAND_FALSE=0, ALTITUDEHOLDDESIRED_LAND_TRUE=1 }  __attribute__((packed)) AltitudeHoldDesiredLandOptions;
+#define ALTITUDEHOLDDESIRED_LAND_GLOBAL_MAXOPTVAL 1
+#define ALTITUDEHOLDDESIRED_LAND_MAXOPTVAL 1
+static inline bool AltitudeHoldDesiredLandIsValid( uint8_t CurrentLand ) { return CurrentLand <= ALTITUDEHOLDDESIRED_LAND_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void AltitudeHoldDesiredAltitudeSet( float *NewAltitude );
+extern void AltitudeHoldDesiredAltitudeGet( float *NewAltitude );
+extern void AltitudeHoldDesiredClimbRateSet( float *NewClimbRate );
+extern void AltitudeHoldDesiredClimbRateGet( float *NewClimbRate );
+extern void AltitudeHoldDesiredRollSet( float *NewRoll );
+extern void AltitudeHoldDesiredRollGet( float *NewRoll );
+extern void AltitudeHoldDesiredPitchSet( float *NewPitch );
+extern void AltitudeHoldDesiredPitchGet( float *NewPitch );
+extern void AltitudeHoldDesiredYawSet( float *NewYaw );
+extern void AltitudeHoldDesiredYawGet( float *NewYaw );
+extern void AltitudeHoldDesiredLandSet( uint8_t *NewLand );
+extern void AltitudeHoldDesiredLandGet( uint8_t *NewLand );
+
+
+#endif // ALTITUDEHOLDDESIRED_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup AnnunciatorSettings AnnunciatorSettings
+ * @brief Settings for alarm annunciation (LEDs, buzzer)
+ *
+ *
+ * @file       annunciatorsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the AnnunciatorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: annunciatorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ANNUNCIATORSETTINGS_H
+#define ANNUNCIATORSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <shareddefs.h>
+
+
+// Object constants
+#define ANNUNCIATORSETTINGS_OBJID 0x773B82F0
+#define ANNUNCIATORSETTINGS_ISSINGLEINST 1
+#define ANNUNCIATORSETTINGS_ISSETTINGS 1
+#define ANNUNCIATORSETTINGS_NUMBYTES 10
+
+// Generic interface functions
+int32_t AnnunciatorSettingsInitialize();
+UAVObjHandle AnnunciatorSettingsHandle();
+void AnnunciatorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t AnnunciateAnytime[5];
+    uint8_t AnnunciateAfterArming[5];
+
+} __attribute__((packed)) __attribute__((aligned(4))) AnnunciatorSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function AnnunciatorSettingsGet(dataOut)
+ * @brief Populate a AnnunciatorSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t AnnunciatorSettingsGet(AnnunciatorSettingsData *dataOut) { return UAVObjGetData(AnnunciatorSettingsHandle(), dataOut); }
+
+static inline int32_t AnnunciatorSettingsSet(const AnnunciatorSettingsData *dataIn) { return UAVObjSetData(AnnunciatorSettingsHandle(), dataIn); }
+
+static inline int32_t AnnunciatorSettingsInstGet(uint16_t instId, AnnunciatorSettingsData *dataOut) { return UAVObjGetInstanceData(AnnunciatorSettingsHandle(), instId, dataOut); }
+
+static inline int32_t AnnunciatorSettingsInstSet(uint16_t instId, const AnnunciatorSettingsData *dataIn) { return UAVObjSetInstanceData(AnnunciatorSettingsHandle(), instId, dataIn); }
+
+static inline int32_t AnnunciatorSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(AnnunciatorSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AnnunciatorSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(AnnunciatorSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AnnunciatorSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(AnnunciatorSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AnnunciatorSettingsConnectCopy(volatile AnnunciatorSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	AnnunciatorSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(AnnunciatorSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t AnnunciatorSettingsCreateInstance() { return UAVObjCreateInstance(AnnunciatorSettingsHandle(), &AnnunciatorSettingsSetDefaults); }
+
+static inline void AnnunciatorSettingsUpdated() { UAVObjUpdated(AnnunciatorSettingsHandle()); }
+
+static inline void AnnunciatorSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(AnnunciatorSettingsHandle(), instId); }
+
+static inline int32_t AnnunciatorSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(AnnunciatorSettingsHandle(), dataOut); }
+
+static inline int32_t AnnunciatorSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(AnnunciatorSettingsHandle(), dataIn); }
+
+static inline int8_t AnnunciatorSettingsReadOnly() { return UAVObjReadOnly(AnnunciatorSettingsHandle()); }
+
+static inline uint16_t AnnunciatorSettingsGetNumInstances(){ return UAVObjGetNumInstances(AnnunciatorSettingsHandle()); }
+
+static inline uint32_t AnnunciatorSettingsGetNumBytes(){ return UAVObjGetNumBytes(AnnunciatorSettingsHandle()); }
+
+// Field information
+// Field AnnunciateAnytime information
+/* Enumeration options for field AnnunciateAnytime */
+typedef enum { ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_UNINITIALISED=0, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_OK=1, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_WARNING=2, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_ERROR=3, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_CRITICAL=4, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_HAIRONFIRE=5, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_MANUALCONTROLONLY=6, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) AnnunciatorSettingsAnnunciateAnytimeOptions;
+#define ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_GLOBAL_MAXOPTVAL 6
+#define ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_MAXOPTVAL 6
+static inline bool AnnunciatorSettingsAnnunciateAnytimeIsValid( uint8_t CurrentAnnunciateAnytime ) { return CurrentAnnunciateAnytime <= ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_MAXOPTVAL; }
+typedef enum { ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_LED_HEARTBEAT=0, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_LED_ALARM=1, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_BUZZER=2, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_RGB_LEDS=3, ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_DAC=4 } __attribute__((packed)) AnnunciatorSettingsAnnunciateAnytimeElem;
+#define ANNUNCIATORSETTINGS_ANNUNCIATEANYTIME_NUMELEM 5
+// Field AnnunciateAfterArming information
+/* Enumeration options for field AnnunciateAfterArming */
+typedef enum { ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_UNINITIALISED=0, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_OK=1, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_WARNING=2, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_ERROR=3, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_CRITICAL=4, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_HAIRONFIRE=5, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_MANUALCONTROLONLY=6, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) AnnunciatorSettingsAnnunciateAfterArmingOptions;
+#define ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_GLOBAL_MAXOPTVAL 6
+#define ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_MAXOPTVAL 6
+static inline bool AnnunciatorSettingsAnnunciateAfterArmingIsValid( uint8_t CurrentAnnunciateAfterArming ) { return CurrentAnnunciateAfterArming <= ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_MAXOPTVAL; }
+typedef enum { ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_LED_HEARTBEAT=0, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_LED_ALARM=1, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_BUZZER=2, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_RGB_LEDS=3, ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_DAC=4 } __attribute__((packed)) AnnunciatorSettingsAnnunciateAfterArmingElem;
+#define ANNUNCIATORSETTINGS_ANNUNCIATEAFTERARMING_NUMELEM 5
+
+
+// set/Get functions
+extern void AnnunciatorSettingsAnnunciateAnytimeSet( uint8_t *NewAnnunciateAnytime );
+extern void AnnunciatorSettingsAnnunciateAnytimeGet( uint8_t *NewAnnunciateAnytime );
+extern void AnnunciatorSettingsAnnunciateAfterArmingSet( uint8_t *NewAnnunciateAfterArming );
+extern void AnnunciatorSettingsAnnunciateAfterArmingGet( uint8_t *NewAnnunciateAfterArming );
+
+
+#endif // ANNUNCIATORSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,188 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       attitudeactual.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AttitudeActual object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudeactual.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "attitudeactual.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 100,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 500,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeActualInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ATTITUDEACTUAL_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ATTITUDEACTUAL_OBJID,
+			ATTITUDEACTUAL_ISSINGLEINST, ATTITUDEACTUAL_ISSETTINGS, ATTITUDEACTUAL_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AttitudeActualSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AttitudeActualData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AttitudeActualSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeActualSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AttitudeActualSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AttitudeActualSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeActualHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AttitudeActualq1Set( float *Newq1 )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)Newq1, offsetof( AttitudeActualData, q1), sizeof(float));
+}
+void AttitudeActualq1Get( float *Newq1 )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)Newq1, offsetof( AttitudeActualData, q1), sizeof(float));
+}
+void AttitudeActualq2Set( float *Newq2 )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)Newq2, offsetof( AttitudeActualData, q2), sizeof(float));
+}
+void AttitudeActualq2Get( float *Newq2 )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)Newq2, offsetof( AttitudeActualData, q2), sizeof(float));
+}
+void AttitudeActualq3Set( float *Newq3 )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)Newq3, offsetof( AttitudeActualData, q3), sizeof(float));
+}
+void AttitudeActualq3Get( float *Newq3 )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)Newq3, offsetof( AttitudeActualData, q3), sizeof(float));
+}
+void AttitudeActualq4Set( float *Newq4 )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)Newq4, offsetof( AttitudeActualData, q4), sizeof(float));
+}
+void AttitudeActualq4Get( float *Newq4 )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)Newq4, offsetof( AttitudeActualData, q4), sizeof(float));
+}
+void AttitudeActualRollSet( float *NewRoll )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)NewRoll, offsetof( AttitudeActualData, Roll), sizeof(float));
+}
+void AttitudeActualRollGet( float *NewRoll )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)NewRoll, offsetof( AttitudeActualData, Roll), sizeof(float));
+}
+void AttitudeActualPitchSet( float *NewPitch )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)NewPitch, offsetof( AttitudeActualData, Pitch), sizeof(float));
+}
+void AttitudeActualPitchGet( float *NewPitch )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)NewPitch, offsetof( AttitudeActualData, Pitch), sizeof(float));
+}
+void AttitudeActualYawSet( float *NewYaw )
+{
+	UAVObjSetDataField(AttitudeActualHandle(), (void*)NewYaw, offsetof( AttitudeActualData, Yaw), sizeof(float));
+}
+void AttitudeActualYawGet( float *NewYaw )
+{
+	UAVObjGetDataField(AttitudeActualHandle(), (void*)NewYaw, offsetof( AttitudeActualData, Yaw), sizeof(float));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       attitudesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AttitudeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "attitudesettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const AttitudeSettingsData defaultData = {
+	.MgKp = 20,
+	.MgKi = 0.05,
+	.AccKp = 20,
+	.AccKi = 0.4,
+	.AccelTau = 0.1,
+	.VertPositionTau = 2,
+	.BoardRotation = { 0, 0, 0 },
+	.ZeroDuringArming = 1,
+	.BiasCorrectGyro = 1,
+	.FilterChoice = 0,
+	.RateDivider = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ATTITUDESETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ATTITUDESETTINGS_OBJID,
+			ATTITUDESETTINGS_ISSINGLEINST, ATTITUDESETTINGS_ISSETTINGS, ATTITUDESETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AttitudeSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AttitudeSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AttitudeSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AttitudeSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AttitudeSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AttitudeSettingsMgKpSet( float *NewMgKp )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewMgKp, offsetof( AttitudeSettingsData, MgKp), sizeof(float));
+}
+void AttitudeSettingsMgKpGet( float *NewMgKp )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewMgKp, offsetof( AttitudeSettingsData, MgKp), sizeof(float));
+}
+void AttitudeSettingsMgKiSet( float *NewMgKi )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewMgKi, offsetof( AttitudeSettingsData, MgKi), sizeof(float));
+}
+void AttitudeSettingsMgKiGet( float *NewMgKi )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewMgKi, offsetof( AttitudeSettingsData, MgKi), sizeof(float));
+}
+void AttitudeSettingsAccKpSet( float *NewAccKp )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccKp, offsetof( AttitudeSettingsData, AccKp), sizeof(float));
+}
+void AttitudeSettingsAccKpGet( float *NewAccKp )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccKp, offsetof( AttitudeSettingsData, AccKp), sizeof(float));
+}
+void AttitudeSettingsAccKiSet( float *NewAccKi )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccKi, offsetof( AttitudeSettingsData, AccKi), sizeof(float));
+}
+void AttitudeSettingsAccKiGet( float *NewAccKi )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccKi, offsetof( AttitudeSettingsData, AccKi), sizeof(float));
+}
+void AttitudeSettingsAccelTauSet( float *NewAccelTau )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccelTau, offsetof( AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsAccelTauGet( float *NewAccelTau )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccelTau, offsetof( AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsVertPositionTauSet( float *NewVertPositionTau )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewVertPositionTau, offsetof( AttitudeSettingsData, VertPositionTau), sizeof(float));
+}
+void AttitudeSettingsVertPositionTauGet( float *NewVertPositionTau )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewVertPositionTau, offsetof( AttitudeSettingsData, VertPositionTau), sizeof(float));
+}
+void AttitudeSettingsBoardRotationSet( int16_t *NewBoardRotation )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewBoardRotation, offsetof( AttitudeSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AttitudeSettingsBoardRotationGet( int16_t *NewBoardRotation )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewBoardRotation, offsetof( AttitudeSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AttitudeSettingsZeroDuringArmingSet( uint8_t *NewZeroDuringArming )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewZeroDuringArming, offsetof( AttitudeSettingsData, ZeroDuringArming), sizeof(uint8_t));
+}
+void AttitudeSettingsZeroDuringArmingGet( uint8_t *NewZeroDuringArming )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewZeroDuringArming, offsetof( AttitudeSettingsData, ZeroDuringArming), sizeof(uint8_t));
+}
+void AttitudeSettingsBiasCorrectGyroSet( uint8_t *NewBiasCorrectGyro )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewBiasCorrectGyro, offsetof( AttitudeSettingsData, BiasCorrectGyro), sizeof(uint8_t));
+}
+void AttitudeSettingsBiasCorrectGyroGet( uint8_t *NewBiasCorrectGyro )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewBiasCorrectGyro, offsetof( AttitudeSettingsData, BiasCorrectGyro), sizeof(uint8_t));
+}
+void AttitudeSettingsFilterChoiceSet( uint8_t *NewFilterChoice )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewFilterChoice, offsetof( AttitudeSettingsData, FilterChoice), sizeof(uint8_t));
+}
+void AttitudeSettingsFilterChoiceGet( uint8_t *NewFilterChoice )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewFilterChoice, offsetof( AttitudeSettingsData, FilterChoice), sizeof(uint8_t));
+}
+void AttitudeSettingsRateDividerSet( uint8_t *NewRateDivider )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewRateDivider, offsetof( AttitudeSettingsData, RateDivider), sizeof(uint8_t));
+}
+void AttitudeSettingsRateDividerGet( uint8_t *NewRateDivider )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewRateDivider, offsetof( AttitudeSettingsData, RateDivider), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
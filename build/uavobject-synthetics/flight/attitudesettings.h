@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup AttitudeSettings AttitudeSettings
+ * @brief Settings for the @ref Attitude module
+ *
+ *
+ * @file       attitudesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the AttitudeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ATTITUDESETTINGS_H
+#define ATTITUDESETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ATTITUDESETTINGS_OBJID 0x1550AD9C
+#define ATTITUDESETTINGS_ISSINGLEINST 1
+#define ATTITUDESETTINGS_ISSETTINGS 1
+#define ATTITUDESETTINGS_NUMBYTES 34
+
+// Generic interface functions
+int32_t AttitudeSettingsInitialize();
+UAVObjHandle AttitudeSettingsHandle();
+void AttitudeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float MgKp;
+    float MgKi;
+    float AccKp;
+    float AccKi;
+    float AccelTau;
+    float VertPositionTau;
+    int16_t BoardRotation[3];
+    uint8_t ZeroDuringArming;
+    uint8_t BiasCorrectGyro;
+    uint8_t FilterChoice;
+    uint8_t RateDivider;
+
+} __attribute__((packed)) __attribute__((aligned(4))) AttitudeSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function AttitudeSettingsGet(dataOut)
+ * @brief Populate a AttitudeSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t AttitudeSettingsGet(AttitudeSettingsData *dataOut) { return UAVObjGetData(AttitudeSettingsHandle(), dataOut); }
+
+static inline int32_t AttitudeSettingsSet(const AttitudeSettingsData *dataIn) { return UAVObjSetData(AttitudeSettingsHandle(), dataIn); }
+
+static inline int32_t AttitudeSettingsInstGet(uint16_t instId, AttitudeSettingsData *dataOut) { return UAVObjGetInstanceData(AttitudeSettingsHandle(), instId, dataOut); }
+
+static inline int32_t AttitudeSettingsInstSet(uint16_t instId, const AttitudeSettingsData *dataIn) { return UAVObjSetInstanceData(AttitudeSettingsHandle(), instId, dataIn); }
+
+static inline int32_t AttitudeSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(AttitudeSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AttitudeSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(AttitudeSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AttitudeSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(AttitudeSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AttitudeSettingsConnectCopy(volatile AttitudeSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	AttitudeSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(AttitudeSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t AttitudeSettingsCreateInstance() { return UAVObjCreateInstance(AttitudeSettingsHandle(), &AttitudeSettingsSetDefaults); }
+
+static inline void AttitudeSettingsUpdated() { UAVObjUpdated(AttitudeSettingsHandle()); }
+
+static inline void AttitudeSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(AttitudeSettingsHandle(), instId); }
+
+static inline int32_t AttitudeSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(AttitudeSettingsHandle(), dataOut); }
+
+static inline int32_t AttitudeSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(AttitudeSettingsHandle(), dataIn); }
+
+static inline int8_t AttitudeSettingsReadOnly() { return UAVObjReadOnly(AttitudeSettingsHandle()); }
+
+static inline uint16_t AttitudeSettingsGetNumInstances(){ return UAVObjGetNumInstances(AttitudeSettingsHandle()); }
+
+static inline uint32_t AttitudeSettingsGetNumBytes(){ return UAVObjGetNumBytes(AttitudeSettingsHandle()); }
+
+// Field information
+// Field MgKp information
+// Field MgKi information
+// Field AccKp information
+// Field AccKi information
+// Field AccelTau information
+// Field VertPositionTau information
+// Field BoardRotation information
+typedef enum { ATTITUDESETTINGS_BOARDROTATION_ROLL=0, ATTITUDESETTINGS_BOARDROTATION_PITCH=1, ATTITUDESETTINGS_BOARDROTATION_YAW=2 } __attribute__((packed)) AttitudeSettingsBoardRotationElem;
+#define ATTITUDESETTINGS_BOARDROTATION_NUMELEM 3
+// Field ZeroDuringArming information
+/* Enumeration options for field ZeroDuringArming */
+typedef enum { ATTITUDESETTINGS_ZERODURINGARMING_FALSE=0, ATTITUDESETTINGS_ZERODURINGARMING_TRUE=1 }  __attribute__((packed)) AttitudeSettingsZeroDuringArmingOptions;
+#define ATTITUDESETTINGS_ZERODURINGARMING_GLOBAL_MAXOPTVAL 1
+#define ATTITUDESETTINGS_ZERODURINGARMING_MAXOPTVAL 1
+static inline bool AttitudeSettingsZeroDuringArmingIsValid( uint8_t CurrentZeroDuringArming ) { return CurrentZeroDuringArming <= ATTITUDESETTINGS_ZERODURINGARMING_MAXOPTVAL; }
+// Field BiasCorrectGyro information
+/* Enumeration options for field BiasCorrectGyro */
+typedef enum { ATTITUDESETTINGS_BIASCORRECTGYRO_FALSE=0, ATTITUDESETTINGS_BIASCORRECTGYRO_TRUE=1 }  __attribute__((packed)) AttitudeSettingsBiasCorrectGyroOptions;
+#define ATTITUDESETTINGS_BIASCORRECTGYRO_GLOBAL_MAXOPTVAL 1
+#define ATTITUDESETTINGS_BIASCORRECTGYRO_MAXOPTVAL 1
+static inline bool AttitudeSettingsBiasCorrectGyroIsValid( uint8_t CurrentBiasCorrectGyro ) { return CurrentBiasCorrectGyro <= ATTITUDESETTINGS_BIASCORRECTGYRO_MAXOPTVAL; }
+// Field FilterChoice information
+/* Enumeration options for field FilterChoice */
+typedef enum { ATTITUDESETTINGS_FILTERCHOICE_CCC=0, ATTITUDESETTINGS_FILTERCHOICE_PREMERLANI=1, ATTITUDESETTINGS_FILTERCHOICE_PREMERLANI_GPS=2 }  __attribute__((packed)) AttitudeSettingsFilterChoiceOptions;
+#define ATTITUDESETTINGS_FILTERCHOICE_GLOBAL_MAXOPTVAL 2
+#define ATTITUDESETTINGS_FILTERCHOICE_MAXOPTVAL 2
+static inline bool AttitudeSettingsFilterChoiceIsValid( uint8_t CurrentFilterChoice ) { return CurrentFilterChoice <= ATTITUDESETTINGS_FILTERCHOICE_MAXOPTVAL; }
+// Field RateDivider information
+
+
+// set/Get functions
+extern void AttitudeSettingsMgKpSet( float *NewMgKp );
+extern void AttitudeSettingsMgKpGet( float *NewMgKp );
+extern void AttitudeSettingsMgKiSet( float *NewMgKi );
+extern void AttitudeSettingsMgKiGet( float *NewMgKi );
+extern void AttitudeSettingsAccKpSet( float *NewAccKp );
+extern void AttitudeSettingsAccKpGet( float *NewAccKp );
+extern void AttitudeSettingsAccKiSet( float *NewAccKi );
+extern void AttitudeSettingsAccKiGet( float *NewAccKi );
+extern void AttitudeSettingsAccelTauSet( float *NewAccelTau );
+extern void AttitudeSettingsAccelTauGet( float *NewAccelTau );
+extern void AttitudeSettingsVertPositionTauSet( float *NewVertPositionTau );
+extern void AttitudeSettingsVertPositionTauGet( float *NewVertPositionTau );
+extern void AttitudeSettingsBoardRotationSet( int16_t *NewBoardRotation );
+extern void AttitudeSettingsBoardRotationGet( int16_t *NewBoardRotation );
+extern void AttitudeSettingsZeroDuringArmingSet( uint8_t *NewZeroDuringArming );
+extern void AttitudeSettingsZeroDuringArmingGet( uint8_t *NewZeroDuringArming );
+extern void AttitudeSettingsBiasCorrectGyroSet( uint8_t *NewBiasCorrectGyro );
+extern void AttitudeSettingsBiasCorrectGyroGet( uint8_t *NewBiasCorrectGyro );
+extern void AttitudeSettingsFilterChoiceSet( uint8_t *NewFilterChoice );
+extern void AttitudeSettingsFilterChoiceGet( uint8_t *NewFilterChoice );
+extern void AttitudeSettingsRateDividerSet( uint8_t *NewRateDivider );
+extern void AttitudeSettingsRateDividerGet( uint8_t *NewRateDivider );
+
+
+#endif // ATTITUDESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
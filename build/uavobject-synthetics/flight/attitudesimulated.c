@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       attitudesimulated.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AttitudeSimulated object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudesimulated.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "attitudesimulated.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 100,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeSimulatedInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ATTITUDESIMULATED_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ATTITUDESIMULATED_OBJID,
+			ATTITUDESIMULATED_ISSINGLEINST, ATTITUDESIMULATED_ISSETTINGS, ATTITUDESIMULATED_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AttitudeSimulatedSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AttitudeSimulatedData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AttitudeSimulatedSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeSimulatedSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AttitudeSimulatedSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AttitudeSimulatedSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeSimulatedHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AttitudeSimulatedq1Set( float *Newq1 )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)Newq1, offsetof( AttitudeSimulatedData, q1), sizeof(float));
+}
+void AttitudeSimulatedq1Get( float *Newq1 )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)Newq1, offsetof( AttitudeSimulatedData, q1), sizeof(float));
+}
+void AttitudeSimulatedq2Set( float *Newq2 )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)Newq2, offsetof( AttitudeSimulatedData, q2), sizeof(float));
+}
+void AttitudeSimulatedq2Get( float *Newq2 )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)Newq2, offsetof( AttitudeSimulatedData, q2), sizeof(float));
+}
+void AttitudeSimulatedq3Set( float *Newq3 )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)Newq3, offsetof( AttitudeSimulatedData, q3), sizeof(float));
+}
+void AttitudeSimulatedq3Get( float *Newq3 )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)Newq3, offsetof( AttitudeSimulatedData, q3), sizeof(float));
+}
+void AttitudeSimulatedq4Set( float *Newq4 )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)Newq4, offsetof( AttitudeSimulatedData, q4), sizeof(float));
+}
+void AttitudeSimulatedq4Get( float *Newq4 )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)Newq4, offsetof( AttitudeSimulatedData, q4), sizeof(float));
+}
+void AttitudeSimulatedRollSet( float *NewRoll )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)NewRoll, offsetof( AttitudeSimulatedData, Roll), sizeof(float));
+}
+void AttitudeSimulatedRollGet( float *NewRoll )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)NewRoll, offsetof( AttitudeSimulatedData, Roll), sizeof(float));
+}
+void AttitudeSimulatedPitchSet( float *NewPitch )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)NewPitch, offsetof( AttitudeSimulatedData, Pitch), sizeof(float));
+}
+void AttitudeSimulatedPitchGet( float *NewPitch )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)NewPitch, offsetof( AttitudeSimulatedData, Pitch), sizeof(float));
+}
+void AttitudeSimulatedYawSet( float *NewYaw )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)NewYaw, offsetof( AttitudeSimulatedData, Yaw), sizeof(float));
+}
+void AttitudeSimulatedYawGet( float *NewYaw )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)NewYaw, offsetof( AttitudeSimulatedData, Yaw), sizeof(float));
+}
+void AttitudeSimulatedVelocitySet( float *NewVelocity )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)NewVelocity, offsetof( AttitudeSimulatedData, Velocity), 3*sizeof(float));
+}
+void AttitudeSimulatedVelocityGet( float *NewVelocity )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)NewVelocity, offsetof( AttitudeSimulatedData, Velocity), 3*sizeof(float));
+}
+void AttitudeSimulatedPositionSet( float *NewPosition )
+{
+	UAVObjSetDataField(AttitudeSimulatedHandle(), (void*)NewPosition, offsetof( AttitudeSimulatedData, Position), 3*sizeof(float));
+}
+void AttitudeSimulatedPositionGet( float *NewPosition )
+{
+	UAVObjGetDataField(AttitudeSimulatedHandle(), (void*)NewPosition, offsetof( AttitudeSimulatedData, Position), 3*sizeof(float));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
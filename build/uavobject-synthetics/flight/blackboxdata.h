@@ -0,0 +1,133 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup BlackboxData BlackboxData
+ * @brief A chunk of the full rate blackbox stream. Only written to the log, see flight/Libraries/inc/blackbox.h for the frame format.
+ *
+ *
+ * @file       blackboxdata.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the BlackboxData object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: blackboxdata.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef BLACKBOXDATA_H
+#define BLACKBOXDATA_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define BLACKBOXDATA_OBJID 0x39CA199C
+#define BLACKBOXDATA_ISSINGLEINST 1
+#define BLACKBOXDATA_ISSETTINGS 0
+#define BLACKBOXDATA_NUMBYTES 207
+
+// Generic interface functions
+int32_t BlackboxDataInitialize();
+UAVObjHandle BlackboxDataHandle();
+void BlackboxDataSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Dropped;
+    uint16_t Sequence;
+    uint8_t Length;
+    uint8_t Data[200];
+
+} __attribute__((packed)) __attribute__((aligned(4))) BlackboxDataData;
+
+// Typesafe Object access functions
+/**
+ * @function BlackboxDataGet(dataOut)
+ * @brief Populate a BlackboxDataData object
+ * @param[out] dataOut 
+ */
+static inline int32_t BlackboxDataGet(BlackboxDataData *dataOut) { return UAVObjGetData(BlackboxDataHandle(), dataOut); }
+
+static inline int32_t BlackboxDataSet(const BlackboxDataData *dataIn) { return UAVObjSetData(BlackboxDataHandle(), dataIn); }
+
+static inline int32_t BlackboxDataInstGet(uint16_t instId, BlackboxDataData *dataOut) { return UAVObjGetInstanceData(BlackboxDataHandle(), instId, dataOut); }
+
+static inline int32_t BlackboxDataInstSet(uint16_t instId, const BlackboxDataData *dataIn) { return UAVObjSetInstanceData(BlackboxDataHandle(), instId, dataIn); }
+
+static inline int32_t BlackboxDataConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(BlackboxDataHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t BlackboxDataConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(BlackboxDataHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t BlackboxDataConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(BlackboxDataHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t BlackboxDataConnectCopy(volatile BlackboxDataData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	BlackboxDataGet((void *) dataOut);
+
+	return UAVObjConnectCallback(BlackboxDataHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t BlackboxDataCreateInstance() { return UAVObjCreateInstance(BlackboxDataHandle(), &BlackboxDataSetDefaults); }
+
+static inline void BlackboxDataUpdated() { UAVObjUpdated(BlackboxDataHandle()); }
+
+static inline void BlackboxDataInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(BlackboxDataHandle(), instId); }
+
+static inline int32_t BlackboxDataGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(BlackboxDataHandle(), dataOut); }
+
+static inline int32_t BlackboxDataSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(BlackboxDataHandle(), dataIn); }
+
+static inline int8_t BlackboxDataReadOnly() { return UAVObjReadOnly(BlackboxDataHandle()); }
+
+static inline uint16_t BlackboxDataGetNumInstances(){ return UAVObjGetNumInstances(BlackboxDataHandle()); }
+
+static inline uint32_t BlackboxDataGetNumBytes(){ return UAVObjGetNumBytes(BlackboxDataHandle()); }
+
+// Field information
+// Field Dropped information
+// Field Sequence information
+// Field Length information
+// Field Data information
+#define BLACKBOXDATA_DATA_NUMELEM 200
+
+
+// set/Get functions
+extern void BlackboxDataDroppedSet( uint32_t *NewDropped );
+extern void BlackboxDataDroppedGet( uint32_t *NewDropped );
+extern void BlackboxDataSequenceSet( uint16_t *NewSequence );
+extern void BlackboxDataSequenceGet( uint16_t *NewSequence );
+extern void BlackboxDataLengthSet( uint8_t *NewLength );
+extern void BlackboxDataLengthGet( uint8_t *NewLength );
+extern void BlackboxDataDataSet( uint8_t *NewData );
+extern void BlackboxDataDataGet( uint8_t *NewData );
+
+
+#endif // BLACKBOXDATA_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,190 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       charonscreendisplaysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the CharOnScreenDisplaySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: charonscreendisplaysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "charonscreendisplaysettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const CharOnScreenDisplaySettingsData defaultData = {
+	.VideoStandard = 0,
+	.CustomText = { 100, 82, 111, 110, 105, 110, 0, 0, 0, 0 },
+	.Font = 0,
+	.PanelType = { 13, 17, 18, 3, 21, 10, 19, 16, 24, 12, 2, 20, 11, 14, 15, 4, 5, 6, 25, 0, 0, 0, 0, 0 },
+	.X = { 1, 8, 19, 3, 21, 24, 1, 8, 23, 1, 23, 1, 1, 9, 1, 8, 22, 22, 14, 0, 0, 0, 0, 0 },
+	.Y = { 1, 1, 1, 2, 3, 2, 6, 6, 6, 8, 8, 10, 13, 12, 14, 14, 12, 13, 6, 7, 0, 0, 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CharOnScreenDisplaySettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(CHARONSCREENDISPLAYSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(CHARONSCREENDISPLAYSETTINGS_OBJID,
+			CHARONSCREENDISPLAYSETTINGS_ISSINGLEINST, CHARONSCREENDISPLAYSETTINGS_ISSETTINGS, CHARONSCREENDISPLAYSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void CharOnScreenDisplaySettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	CharOnScreenDisplaySettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void CharOnScreenDisplaySettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CharOnScreenDisplaySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	CharOnScreenDisplaySettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		CharOnScreenDisplaySettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CharOnScreenDisplaySettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void CharOnScreenDisplaySettingsVideoStandardSet( uint8_t *NewVideoStandard )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewVideoStandard, offsetof( CharOnScreenDisplaySettingsData, VideoStandard), sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsVideoStandardGet( uint8_t *NewVideoStandard )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewVideoStandard, offsetof( CharOnScreenDisplaySettingsData, VideoStandard), sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsCustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( CharOnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsCustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( CharOnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsFontSet( uint8_t *NewFont )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewFont, offsetof( CharOnScreenDisplaySettingsData, Font), sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsFontGet( uint8_t *NewFont )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewFont, offsetof( CharOnScreenDisplaySettingsData, Font), sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsPanelTypeSet( uint8_t *NewPanelType )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewPanelType, offsetof( CharOnScreenDisplaySettingsData, PanelType), 24*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsPanelTypeGet( uint8_t *NewPanelType )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewPanelType, offsetof( CharOnScreenDisplaySettingsData, PanelType), 24*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsXSet( uint8_t *NewX )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewX, offsetof( CharOnScreenDisplaySettingsData, X), 24*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsXGet( uint8_t *NewX )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewX, offsetof( CharOnScreenDisplaySettingsData, X), 24*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsYSet( uint8_t *NewY )
+{
+	UAVObjSetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewY, offsetof( CharOnScreenDisplaySettingsData, Y), 24*sizeof(uint8_t));
+}
+void CharOnScreenDisplaySettingsYGet( uint8_t *NewY )
+{
+	UAVObjGetDataField(CharOnScreenDisplaySettingsHandle(), (void*)NewY, offsetof( CharOnScreenDisplaySettingsData, Y), 24*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
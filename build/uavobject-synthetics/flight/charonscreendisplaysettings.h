@@ -0,0 +1,159 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup CharOnScreenDisplaySettings CharOnScreenDisplaySettings
+ * @brief Character On Screen Display Settings
+ *
+ *
+ * @file       charonscreendisplaysettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the CharOnScreenDisplaySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: charonscreendisplaysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef CHARONSCREENDISPLAYSETTINGS_H
+#define CHARONSCREENDISPLAYSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define CHARONSCREENDISPLAYSETTINGS_OBJID 0xCA616496
+#define CHARONSCREENDISPLAYSETTINGS_ISSINGLEINST 1
+#define CHARONSCREENDISPLAYSETTINGS_ISSETTINGS 1
+#define CHARONSCREENDISPLAYSETTINGS_NUMBYTES 84
+
+// Generic interface functions
+int32_t CharOnScreenDisplaySettingsInitialize();
+UAVObjHandle CharOnScreenDisplaySettingsHandle();
+void CharOnScreenDisplaySettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t VideoStandard;
+    uint8_t CustomText[10];
+    uint8_t Font;
+    uint8_t PanelType[24];
+    uint8_t X[24];
+    uint8_t Y[24];
+
+} __attribute__((packed)) __attribute__((aligned(4))) CharOnScreenDisplaySettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function CharOnScreenDisplaySettingsGet(dataOut)
+ * @brief Populate a CharOnScreenDisplaySettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t CharOnScreenDisplaySettingsGet(CharOnScreenDisplaySettingsData *dataOut) { return UAVObjGetData(CharOnScreenDisplaySettingsHandle(), dataOut); }
+
+static inline int32_t CharOnScreenDisplaySettingsSet(const CharOnScreenDisplaySettingsData *dataIn) { return UAVObjSetData(CharOnScreenDisplaySettingsHandle(), dataIn); }
+
+static inline int32_t CharOnScreenDisplaySettingsInstGet(uint16_t instId, CharOnScreenDisplaySettingsData *dataOut) { return UAVObjGetInstanceData(CharOnScreenDisplaySettingsHandle(), instId, dataOut); }
+
+static inline int32_t CharOnScreenDisplaySettingsInstSet(uint16_t instId, const CharOnScreenDisplaySettingsData *dataIn) { return UAVObjSetInstanceData(CharOnScreenDisplaySettingsHandle(), instId, dataIn); }
+
+static inline int32_t CharOnScreenDisplaySettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(CharOnScreenDisplaySettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t CharOnScreenDisplaySettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(CharOnScreenDisplaySettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t CharOnScreenDisplaySettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(CharOnScreenDisplaySettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t CharOnScreenDisplaySettingsConnectCopy(volatile CharOnScreenDisplaySettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	CharOnScreenDisplaySettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(CharOnScreenDisplaySettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t CharOnScreenDisplaySettingsCreateInstance() { return UAVObjCreateInstance(CharOnScreenDisplaySettingsHandle(), &CharOnScreenDisplaySettingsSetDefaults); }
+
+static inline void CharOnScreenDisplaySettingsUpdated() { UAVObjUpdated(CharOnScreenDisplaySettingsHandle()); }
+
+static inline void CharOnScreenDisplaySettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(CharOnScreenDisplaySettingsHandle(), instId); }
+
+static inline int32_t CharOnScreenDisplaySettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(CharOnScreenDisplaySettingsHandle(), dataOut); }
+
+static inline int32_t CharOnScreenDisplaySettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(CharOnScreenDisplaySettingsHandle(), dataIn); }
+
+static inline int8_t CharOnScreenDisplaySettingsReadOnly() { return UAVObjReadOnly(CharOnScreenDisplaySettingsHandle()); }
+
+static inline uint16_t CharOnScreenDisplaySettingsGetNumInstances(){ return UAVObjGetNumInstances(CharOnScreenDisplaySettingsHandle()); }
+
+static inline uint32_t CharOnScreenDisplaySettingsGetNumBytes(){ return UAVObjGetNumBytes(CharOnScreenDisplaySettingsHandle()); }
+
+// Field information
+// Field VideoStandard information
+/* Enumeration options for field VideoStandard */
+typedef enum { CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_AUTODETECTPREFERPAL=0, CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_AUTODETECTPREFERNTSC=1, CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_FORCENTSC=2, CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_FORCEPAL=3 }  __attribute__((packed)) CharOnScreenDisplaySettingsVideoStandardOptions;
+#define CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_GLOBAL_MAXOPTVAL 3
+#define CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_MAXOPTVAL 3
+static inline bool CharOnScreenDisplaySettingsVideoStandardIsValid( uint8_t CurrentVideoStandard ) { return CurrentVideoStandard <= CHARONSCREENDISPLAYSETTINGS_VIDEOSTANDARD_MAXOPTVAL; }
+// Field CustomText information
+#define CHARONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM 10
+// Field Font information
+/* Enumeration options for field Font */
+typedef enum { CHARONSCREENDISPLAYSETTINGS_FONT_REGULAR=0, CHARONSCREENDISPLAYSETTINGS_FONT_THIN=1, CHARONSCREENDISPLAYSETTINGS_FONT_SMALL=2 }  __attribute__((packed)) CharOnScreenDisplaySettingsFontOptions;
+#define CHARONSCREENDISPLAYSETTINGS_FONT_GLOBAL_MAXOPTVAL 2
+#define CHARONSCREENDISPLAYSETTINGS_FONT_MAXOPTVAL 2
+static inline bool CharOnScreenDisplaySettingsFontIsValid( uint8_t CurrentFont ) { return CurrentFont <= CHARONSCREENDISPLAYSETTINGS_FONT_MAXOPTVAL; }
+// Field PanelType information
+/* Enumeration options for field PanelType */
+typedef enum { CHARONSCREENDISPLAYSETTINGS_PANELTYPE_DISABLED=0, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_AIRSPEED=1, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_ALTITUDE=2, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_ARMEDFLAG=3, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_BATTERYVOLT=4, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_BATTERYCURRENT=5, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_BATTERYCONSUMED=6, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_CALLSIGN=7, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_CLIMB=8, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_COMPASS=9, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_FLIGHTMODE=10, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_FLIGHTTIME=11, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_GROUNDSPEED=12, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_GPS=13, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_HOMEDISTANCE=14, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_HOMEDIRECTION=15, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_HORIZON=16, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_LATITUDE=17, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_LONGITUDE=18, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_PITCH=19, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_ROLL=20, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_RSSI=21, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_RSSIFLAG=22, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_TEMPERATURE=23, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_THROTTLE=24, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_CROSSHAIR=25, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_ALARMS=26, CHARONSCREENDISPLAYSETTINGS_PANELTYPE_HEADING=27 }  __attribute__((packed)) CharOnScreenDisplaySettingsPanelTypeOptions;
+#define CHARONSCREENDISPLAYSETTINGS_PANELTYPE_GLOBAL_MAXOPTVAL 27
+#define CHARONSCREENDISPLAYSETTINGS_PANELTYPE_MAXOPTVAL 27
+static inline bool CharOnScreenDisplaySettingsPanelTypeIsValid( uint8_t CurrentPanelType ) { return CurrentPanelType <= CHARONSCREENDISPLAYSETTINGS_PANELTYPE_MAXOPTVAL; }
+#define CHARONSCREENDISPLAYSETTINGS_PANELTYPE_NUMELEM 24
+// Field X information
+#define CHARONSCREENDISPLAYSETTINGS_X_NUMELEM 24
+// Field Y information
+#define CHARONSCREENDISPLAYSETTINGS_Y_NUMELEM 24
+
+
+// set/Get functions
+extern void CharOnScreenDisplaySettingsVideoStandardSet( uint8_t *NewVideoStandard );
+extern void CharOnScreenDisplaySettingsVideoStandardGet( uint8_t *NewVideoStandard );
+extern void CharOnScreenDisplaySettingsCustomTextSet( uint8_t *NewCustomText );
+extern void CharOnScreenDisplaySettingsCustomTextGet( uint8_t *NewCustomText );
+extern void CharOnScreenDisplaySettingsFontSet( uint8_t *NewFont );
+extern void CharOnScreenDisplaySettingsFontGet( uint8_t *NewFont );
+extern void CharOnScreenDisplaySettingsPanelTypeSet( uint8_t *NewPanelType );
+extern void CharOnScreenDisplaySettingsPanelTypeGet( uint8_t *NewPanelType );
+extern void CharOnScreenDisplaySettingsXSet( uint8_t *NewX );
+extern void CharOnScreenDisplaySettingsXGet( uint8_t *NewX );
+extern void CharOnScreenDisplaySettingsYSet( uint8_t *NewY );
+extern void CharOnScreenDisplaySettingsYGet( uint8_t *NewY );
+
+
+#endif // CHARONSCREENDISPLAYSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
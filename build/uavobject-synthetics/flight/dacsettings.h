@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup DACSettings DACSettings
+ * @brief Configuration of DAC usage
+ *
+ *
+ * @file       dacsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the DACSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: dacsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef DACSETTINGS_H
+#define DACSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define DACSETTINGS_OBJID 0xC2F39D32
+#define DACSETTINGS_ISSINGLEINST 1
+#define DACSETTINGS_ISSETTINGS 1
+#define DACSETTINGS_NUMBYTES 1
+
+// Generic interface functions
+int32_t DACSettingsInitialize();
+UAVObjHandle DACSettingsHandle();
+void DACSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t DACPrimaryUse;
+
+} __attribute__((packed)) __attribute__((aligned(4))) DACSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function DACSettingsGet(dataOut)
+ * @brief Populate a DACSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t DACSettingsGet(DACSettingsData *dataOut) { return UAVObjGetData(DACSettingsHandle(), dataOut); }
+
+static inline int32_t DACSettingsSet(const DACSettingsData *dataIn) { return UAVObjSetData(DACSettingsHandle(), dataIn); }
+
+static inline int32_t DACSettingsInstGet(uint16_t instId, DACSettingsData *dataOut) { return UAVObjGetInstanceData(DACSettingsHandle(), instId, dataOut); }
+
+static inline int32_t DACSettingsInstSet(uint16_t instId, const DACSettingsData *dataIn) { return UAVObjSetInstanceData(DACSettingsHandle(), instId, dataIn); }
+
+static inline int32_t DACSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(DACSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DACSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(DACSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DACSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(DACSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DACSettingsConnectCopy(volatile DACSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	DACSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(DACSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t DACSettingsCreateInstance() { return UAVObjCreateInstance(DACSettingsHandle(), &DACSettingsSetDefaults); }
+
+static inline void DACSettingsUpdated() { UAVObjUpdated(DACSettingsHandle()); }
+
+static inline void DACSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(DACSettingsHandle(), instId); }
+
+static inline int32_t DACSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(DACSettingsHandle(), dataOut); }
+
+static inline int32_t DACSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(DACSettingsHandle(), dataIn); }
+
+static inline int8_t DACSettingsReadOnly() { return UAVObjReadOnly(DACSettingsHandle()); }
+
+static inline uint16_t DACSettingsGetNumInstances(){ return UAVObjGetNumInstances(DACSettingsHandle()); }
+
+static inline uint32_t DACSettingsGetNumBytes(){ return UAVObjGetNumBytes(DACSettingsHandle()); }
+
+// Field information
+// Field DACPrimaryUse information
+/* Enumeration options for field DACPrimaryUse */
+typedef enum { DACSETTINGS_DACPRIMARYUSE_DISABLED=0, DACSETTINGS_DACPRIMARYUSE_FSK1200=1, DACSETTINGS_DACPRIMARYUSE_ANNUNCIATORS=2 }  __attribute__((packed)) DACSettingsDACPrimaryUseOptions;
+#define DACSETTINGS_DACPRIMARYUSE_GLOBAL_MAXOPTVAL 2
+#define DACSETTINGS_DACPRIMARYUSE_MAXOPTVAL 2
+static inline bool DACSettingsDACPrimaryUseIsValid( uint8_t CurrentDACPrimaryUse ) { return CurrentDACPrimaryUse <= DACSETTINGS_DACPRIMARYUSE_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void DACSettingsDACPrimaryUseSet( uint8_t *NewDACPrimaryUse );
+extern void DACSettingsDACPrimaryUseGet( uint8_t *NewDACPrimaryUse );
+
+
+#endif // DACSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,134 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup DynamicNotch DynamicNotch
+ * @brief Frequencies the dynamic gyro notches are tracking, 0 where a notch has nothing to track.
+ *
+ *
+ * @file       dynamicnotch.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the DynamicNotch object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: dynamicnotch.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef DYNAMICNOTCH_H
+#define DYNAMICNOTCH_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define DYNAMICNOTCH_OBJID 0x9FF98CC8
+#define DYNAMICNOTCH_ISSINGLEINST 1
+#define DYNAMICNOTCH_ISSETTINGS 0
+#define DYNAMICNOTCH_NUMBYTES 36
+
+// Generic interface functions
+int32_t DynamicNotchInitialize();
+UAVObjHandle DynamicNotchHandle();
+void DynamicNotchSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Frequency[3];
+    float Frequency2[3];
+    float PeakRatio[3];
+
+} __attribute__((packed)) __attribute__((aligned(4))) DynamicNotchData;
+
+// Typesafe Object access functions
+/**
+ * @function DynamicNotchGet(dataOut)
+ * @brief Populate a DynamicNotchData object
+ * @param[out] dataOut 
+ */
+static inline int32_t DynamicNotchGet(DynamicNotchData *dataOut) { return UAVObjGetData(DynamicNotchHandle(), dataOut); }
+
+static inline int32_t DynamicNotchSet(const DynamicNotchData *dataIn) { return UAVObjSetData(DynamicNotchHandle(), dataIn); }
+
+static inline int32_t DynamicNotchInstGet(uint16_t instId, DynamicNotchData *dataOut) { return UAVObjGetInstanceData(DynamicNotchHandle(), instId, dataOut); }
+
+static inline int32_t DynamicNotchInstSet(uint16_t instId, const DynamicNotchData *dataIn) { return UAVObjSetInstanceData(DynamicNotchHandle(), instId, dataIn); }
+
+static inline int32_t DynamicNotchConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(DynamicNotchHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DynamicNotchConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(DynamicNotchHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DynamicNotchConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(DynamicNotchHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t DynamicNotchConnectCopy(volatile DynamicNotchData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	DynamicNotchGet((void *) dataOut);
+
+	return UAVObjConnectCallback(DynamicNotchHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t DynamicNotchCreateInstance() { return UAVObjCreateInstance(DynamicNotchHandle(), &DynamicNotchSetDefaults); }
+
+static inline void DynamicNotchUpdated() { UAVObjUpdated(DynamicNotchHandle()); }
+
+static inline void DynamicNotchInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(DynamicNotchHandle(), instId); }
+
+static inline int32_t DynamicNotchGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(DynamicNotchHandle(), dataOut); }
+
+static inline int32_t DynamicNotchSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(DynamicNotchHandle(), dataIn); }
+
+static inline int8_t DynamicNotchReadOnly() { return UAVObjReadOnly(DynamicNotchHandle()); }
+
+static inline uint16_t DynamicNotchGetNumInstances(){ return UAVObjGetNumInstances(DynamicNotchHandle()); }
+
+static inline uint32_t DynamicNotchGetNumBytes(){ return UAVObjGetNumBytes(DynamicNotchHandle()); }
+
+// Field information
+// Field Frequency information
+typedef enum { DYNAMICNOTCH_FREQUENCY_X=0, DYNAMICNOTCH_FREQUENCY_Y=1, DYNAMICNOTCH_FREQUENCY_Z=2 } __attribute__((packed)) DynamicNotchFrequencyElem;
+#define DYNAMICNOTCH_FREQUENCY_NUMELEM 3
+// Field Frequency2 information
+typedef enum { DYNAMICNOTCH_FREQUENCY2_X=0, DYNAMICNOTCH_FREQUENCY2_Y=1, DYNAMICNOTCH_FREQUENCY2_Z=2 } __attribute__((packed)) DynamicNotchFrequency2Elem;
+#define DYNAMICNOTCH_FREQUENCY2_NUMELEM 3
+// Field PeakRatio information
+typedef enum { DYNAMICNOTCH_PEAKRATIO_X=0, DYNAMICNOTCH_PEAKRATIO_Y=1, DYNAMICNOTCH_PEAKRATIO_Z=2 } __attribute__((packed)) DynamicNotchPeakRatioElem;
+#define DYNAMICNOTCH_PEAKRATIO_NUMELEM 3
+
+
+// set/Get functions
+extern void DynamicNotchFrequencySet( float *NewFrequency );
+extern void DynamicNotchFrequencyGet( float *NewFrequency );
+extern void DynamicNotchFrequency2Set( float *NewFrequency2 );
+extern void DynamicNotchFrequency2Get( float *NewFrequency2 );
+extern void DynamicNotchPeakRatioSet( float *NewPeakRatio );
+extern void DynamicNotchPeakRatioGet( float *NewPeakRatio );
+
+
+#endif // DYNAMICNOTCH_H
+
+/**
+ * @}
+ * @}
+ */
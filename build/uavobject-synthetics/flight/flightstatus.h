@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup FlightStatus FlightStatus
+ * @brief Contains major flight status information for other modules.
+ *
+ *
+ * @file       flightstatus.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the FlightStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef FLIGHTSTATUS_H
+#define FLIGHTSTATUS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <shareddefs.h>
+
+
+// Object constants
+#define FLIGHTSTATUS_OBJID 0xF6AD5B1C
+#define FLIGHTSTATUS_ISSINGLEINST 1
+#define FLIGHTSTATUS_ISSETTINGS 0
+#define FLIGHTSTATUS_NUMBYTES 3
+
+// Generic interface functions
+int32_t FlightStatusInitialize();
+UAVObjHandle FlightStatusHandle();
+void FlightStatusSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t Armed;
+    uint8_t FlightMode;
+    uint8_t ControlSource;
+
+} __attribute__((packed)) __attribute__((aligned(4))) FlightStatusData;
+
+// Typesafe Object access functions
+/**
+ * @function FlightStatusGet(dataOut)
+ * @brief Populate a FlightStatusData object
+ * @param[out] dataOut 
+ */
+static inline int32_t FlightStatusGet(FlightStatusData *dataOut) { return UAVObjGetData(FlightStatusHandle(), dataOut); }
+
+static inline int32_t FlightStatusSet(const FlightStatusData *dataIn) { return UAVObjSetData(FlightStatusHandle(), dataIn); }
+
+static inline int32_t FlightStatusInstGet(uint16_t instId, FlightStatusData *dataOut) { return UAVObjGetInstanceData(FlightStatusHandle(), instId, dataOut); }
+
+static inline int32_t FlightStatusInstSet(uint16_t instId, const FlightStatusData *dataIn) { return UAVObjSetInstanceData(FlightStatusHandle(), instId, dataIn); }
+
+static inline int32_t FlightStatusConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(FlightStatusHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t FlightStatusConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(FlightStatusHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t FlightStatusConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(FlightStatusHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t FlightStatusConnectCopy(volatile FlightStatusData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	FlightStatusGet((void *) dataOut);
+
+	return UAVObjConnectCallback(FlightStatusHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t FlightStatusCreateInstance() { return UAVObjCreateInstance(FlightStatusHandle(), &FlightStatusSetDefaults); }
+
+static inline void FlightStatusUpdated() { UAVObjUpdated(FlightStatusHandle()); }
+
+static inline void FlightStatusInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(FlightStatusHandle(), instId); }
+
+static inline int32_t FlightStatusGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(FlightStatusHandle(), dataOut); }
+
+static inline int32_t FlightStatusSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(FlightStatusHandle(), dataIn); }
+
+static inline int8_t FlightStatusReadOnly() { return UAVObjReadOnly(FlightStatusHandle()); }
+
+static inline uint16_t FlightStatusGetNumInstances(){ return UAVObjGetNumInstances(FlightStatusHandle()); }
+
+static inline uint32_t FlightStatusGetNumBytes(){ return UAVObjGetNumBytes(FlightStatusHandle()); }
+
+// Field information
+// Field Armed information
+/* Enumeration options for field Armed */
+typedef enum { FLIGHTSTATUS_ARMED_DISARMED=0, FLIGHTSTATUS_ARMED_ARMING=1, FLIGHTSTATUS_ARMED_ARMED=2 }  __attribute__((packed)) FlightStatusArmedOptions;
+#define FLIGHTSTATUS_ARMED_GLOBAL_MAXOPTVAL 2
+#define FLIGHTSTATUS_ARMED_MAXOPTVAL 2
+static inline bool FlightStatusArmedIsValid( uint8_t CurrentArmed ) { return CurrentArmed <= FLIGHTSTATUS_ARMED_MAXOPTVAL; }
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { FLIGHTSTATUS_FLIGHTMODE_MANUAL=0, FLIGHTSTATUS_FLIGHTMODE_ACRO=1, FLIGHTSTATUS_FLIGHTMODE_LEVELING=2, FLIGHTSTATUS_FLIGHTMODE_HORIZON=3, FLIGHTSTATUS_FLIGHTMODE_AXISLOCK=4, FLIGHTSTATUS_FLIGHTMODE_VIRTUALBAR=5, FLIGHTSTATUS_FLIGHTMODE_STABILIZED1=6, FLIGHTSTATUS_FLIGHTMODE_STABILIZED2=7, FLIGHTSTATUS_FLIGHTMODE_STABILIZED3=8, FLIGHTSTATUS_FLIGHTMODE_AUTOTUNE=9, FLIGHTSTATUS_FLIGHTMODE_ALTITUDEHOLD=10, FLIGHTSTATUS_FLIGHTMODE_POSITIONHOLD=11, FLIGHTSTATUS_FLIGHTMODE_RETURNTOHOME=12, FLIGHTSTATUS_FLIGHTMODE_PATHPLANNER=13, FLIGHTSTATUS_FLIGHTMODE_TABLETCONTROL=14, FLIGHTSTATUS_FLIGHTMODE_ACROPLUS=15, FLIGHTSTATUS_FLIGHTMODE_ACRODYNE=16, FLIGHTSTATUS_FLIGHTMODE_FAILSAFE=17, FLIGHTSTATUS_FLIGHTMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) FlightStatusFlightModeOptions;
+#define FLIGHTSTATUS_FLIGHTMODE_GLOBAL_MAXOPTVAL 17
+#define FLIGHTSTATUS_FLIGHTMODE_MAXOPTVAL 17
+static inline bool FlightStatusFlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode <= FLIGHTSTATUS_FLIGHTMODE_MAXOPTVAL; }
+// Field ControlSource information
+/* Enumeration options for field ControlSource */
+typedef enum { FLIGHTSTATUS_CONTROLSOURCE_GEOFENCE=0, FLIGHTSTATUS_CONTROLSOURCE_FAILSAFE=1, FLIGHTSTATUS_CONTROLSOURCE_TRANSMITTER=2, FLIGHTSTATUS_CONTROLSOURCE_TABLET=3 }  __attribute__((packed)) FlightStatusControlSourceOptions;
+#define FLIGHTSTATUS_CONTROLSOURCE_GLOBAL_MAXOPTVAL 3
+#define FLIGHTSTATUS_CONTROLSOURCE_MAXOPTVAL 3
+static inline bool FlightStatusControlSourceIsValid( uint8_t CurrentControlSource ) { return CurrentControlSource <= FLIGHTSTATUS_CONTROLSOURCE_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void FlightStatusArmedSet( uint8_t *NewArmed );
+extern void FlightStatusArmedGet( uint8_t *NewArmed );
+extern void FlightStatusFlightModeSet( uint8_t *NewFlightMode );
+extern void FlightStatusFlightModeGet( uint8_t *NewFlightMode );
+extern void FlightStatusControlSourceSet( uint8_t *NewControlSource );
+extern void FlightStatusControlSourceGet( uint8_t *NewControlSource );
+
+
+#endif // FLIGHTSTATUS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,190 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       geofencezone.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the GeoFenceZone object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: geofencezone.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "geofencezone.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const GeoFenceZoneData defaultData = {
+	.North = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.East = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.Floor = 0,
+	.Ceiling = 120,
+	.Type = 0,
+	.Vertices = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GeoFenceZoneInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(GEOFENCEZONE_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(GEOFENCEZONE_OBJID,
+			GEOFENCEZONE_ISSINGLEINST, GEOFENCEZONE_ISSETTINGS, GEOFENCEZONE_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void GeoFenceZoneSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	GeoFenceZoneData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void GeoFenceZoneSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GeoFenceZoneSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	GeoFenceZoneSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		GeoFenceZoneSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GeoFenceZoneHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GeoFenceZoneNorthSet( float *NewNorth )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewNorth, offsetof( GeoFenceZoneData, North), 16*sizeof(float));
+}
+void GeoFenceZoneNorthGet( float *NewNorth )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewNorth, offsetof( GeoFenceZoneData, North), 16*sizeof(float));
+}
+void GeoFenceZoneEastSet( float *NewEast )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewEast, offsetof( GeoFenceZoneData, East), 16*sizeof(float));
+}
+void GeoFenceZoneEastGet( float *NewEast )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewEast, offsetof( GeoFenceZoneData, East), 16*sizeof(float));
+}
+void GeoFenceZoneFloorSet( float *NewFloor )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewFloor, offsetof( GeoFenceZoneData, Floor), sizeof(float));
+}
+void GeoFenceZoneFloorGet( float *NewFloor )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewFloor, offsetof( GeoFenceZoneData, Floor), sizeof(float));
+}
+void GeoFenceZoneCeilingSet( float *NewCeiling )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewCeiling, offsetof( GeoFenceZoneData, Ceiling), sizeof(float));
+}
+void GeoFenceZoneCeilingGet( float *NewCeiling )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewCeiling, offsetof( GeoFenceZoneData, Ceiling), sizeof(float));
+}
+void GeoFenceZoneTypeSet( uint8_t *NewType )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewType, offsetof( GeoFenceZoneData, Type), sizeof(uint8_t));
+}
+void GeoFenceZoneTypeGet( uint8_t *NewType )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewType, offsetof( GeoFenceZoneData, Type), sizeof(uint8_t));
+}
+void GeoFenceZoneVerticesSet( uint8_t *NewVertices )
+{
+	UAVObjSetDataField(GeoFenceZoneHandle(), (void*)NewVertices, offsetof( GeoFenceZoneData, Vertices), sizeof(uint8_t));
+}
+void GeoFenceZoneVerticesGet( uint8_t *NewVertices )
+{
+	UAVObjGetDataField(GeoFenceZoneHandle(), (void*)NewVertices, offsetof( GeoFenceZoneData, Vertices), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
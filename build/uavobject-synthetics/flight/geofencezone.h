@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup GeoFenceZone GeoFenceZone
+ * @brief A polygon zone to stay inside or keep out of, between a floor and a ceiling.  Used by the @ref GeoFence module
+ *
+ *
+ * @file       geofencezone.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the GeoFenceZone object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: geofencezone.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef GEOFENCEZONE_H
+#define GEOFENCEZONE_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define GEOFENCEZONE_OBJID 0x590B45B6
+#define GEOFENCEZONE_ISSINGLEINST 0
+#define GEOFENCEZONE_ISSETTINGS 0
+#define GEOFENCEZONE_NUMBYTES 138
+
+// Generic interface functions
+int32_t GeoFenceZoneInitialize();
+UAVObjHandle GeoFenceZoneHandle();
+void GeoFenceZoneSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float North[16];
+    float East[16];
+    float Floor;
+    float Ceiling;
+    uint8_t Type;
+    uint8_t Vertices;
+
+} __attribute__((packed)) __attribute__((aligned(4))) GeoFenceZoneData;
+
+// Typesafe Object access functions
+/**
+ * @function GeoFenceZoneGet(dataOut)
+ * @brief Populate a GeoFenceZoneData object
+ * @param[out] dataOut 
+ */
+static inline int32_t GeoFenceZoneGet(GeoFenceZoneData *dataOut) { return UAVObjGetData(GeoFenceZoneHandle(), dataOut); }
+
+static inline int32_t GeoFenceZoneSet(const GeoFenceZoneData *dataIn) { return UAVObjSetData(GeoFenceZoneHandle(), dataIn); }
+
+static inline int32_t GeoFenceZoneInstGet(uint16_t instId, GeoFenceZoneData *dataOut) { return UAVObjGetInstanceData(GeoFenceZoneHandle(), instId, dataOut); }
+
+static inline int32_t GeoFenceZoneInstSet(uint16_t instId, const GeoFenceZoneData *dataIn) { return UAVObjSetInstanceData(GeoFenceZoneHandle(), instId, dataIn); }
+
+static inline int32_t GeoFenceZoneConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(GeoFenceZoneHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GeoFenceZoneConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(GeoFenceZoneHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GeoFenceZoneConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(GeoFenceZoneHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GeoFenceZoneConnectCopy(volatile GeoFenceZoneData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	GeoFenceZoneGet((void *) dataOut);
+
+	return UAVObjConnectCallback(GeoFenceZoneHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t GeoFenceZoneCreateInstance() { return UAVObjCreateInstance(GeoFenceZoneHandle(), &GeoFenceZoneSetDefaults); }
+
+static inline void GeoFenceZoneUpdated() { UAVObjUpdated(GeoFenceZoneHandle()); }
+
+static inline void GeoFenceZoneInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(GeoFenceZoneHandle(), instId); }
+
+static inline int32_t GeoFenceZoneGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(GeoFenceZoneHandle(), dataOut); }
+
+static inline int32_t GeoFenceZoneSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(GeoFenceZoneHandle(), dataIn); }
+
+static inline int8_t GeoFenceZoneReadOnly() { return UAVObjReadOnly(GeoFenceZoneHandle()); }
+
+static inline uint16_t GeoFenceZoneGetNumInstances(){ return UAVObjGetNumInstances(GeoFenceZoneHandle()); }
+
+static inline uint32_t GeoFenceZoneGetNumBytes(){ return UAVObjGetNumBytes(GeoFenceZoneHandle()); }
+
+// Field information
+// Field North information
+#define GEOFENCEZONE_NORTH_NUMELEM 16
+// Field East information
+#define GEOFENCEZONE_EAST_NUMELEM 16
+// Field Floor information
+// Field Ceiling information
+// Field Type information
+/* Enumeration options for field Type */
+typedef enum { GEOFENCEZONE_TYPE_DISABLED=0, GEOFENCEZONE_TYPE_INCLUSION=1, GEOFENCEZONE_TYPE_EXCLUSION=2 }  __attribute__((packed)) GeoFenceZoneTypeOptions;
+#define GEOFENCEZONE_TYPE_GLOBAL_MAXOPTVAL 2
+#define GEOFENCEZONE_TYPE_MAXOPTVAL 2
+static inline bool GeoFenceZoneTypeIsValid( uint8_t CurrentType ) { return CurrentType <= GEOFENCEZONE_TYPE_MAXOPTVAL; }
+// Field Vertices information
+
+
+// set/Get functions
+extern void GeoFenceZoneNorthSet( float *NewNorth );
+extern void GeoFenceZoneNorthGet( float *NewNorth );
+extern void GeoFenceZoneEastSet( float *NewEast );
+extern void GeoFenceZoneEastGet( float *NewEast );
+extern void GeoFenceZoneFloorSet( float *NewFloor );
+extern void GeoFenceZoneFloorGet( float *NewFloor );
+extern void GeoFenceZoneCeilingSet( float *NewCeiling );
+extern void GeoFenceZoneCeilingGet( float *NewCeiling );
+extern void GeoFenceZoneTypeSet( uint8_t *NewType );
+extern void GeoFenceZoneTypeGet( uint8_t *NewType );
+extern void GeoFenceZoneVerticesSet( uint8_t *NewVertices );
+extern void GeoFenceZoneVerticesGet( uint8_t *NewVertices );
+
+
+#endif // GEOFENCEZONE_H
+
+/**
+ * @}
+ * @}
+ */
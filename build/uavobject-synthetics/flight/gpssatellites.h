@@ -0,0 +1,140 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup GPSSatellites GPSSatellites
+ * @brief Contains information about the GPS satellites in view from @ref GPSModule.
+ *
+ *
+ * @file       gpssatellites.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the GPSSatellites object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gpssatellites.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef GPSSATELLITES_H
+#define GPSSATELLITES_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define GPSSATELLITES_OBJID 0xAD7F4958
+#define GPSSATELLITES_ISSINGLEINST 1
+#define GPSSATELLITES_ISSETTINGS 0
+#define GPSSATELLITES_NUMBYTES 151
+
+// Generic interface functions
+int32_t GPSSatellitesInitialize();
+UAVObjHandle GPSSatellitesHandle();
+void GPSSatellitesSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    int16_t Azimuth[30];
+    uint8_t SatsInView;
+    uint8_t PRN[30];
+    int8_t Elevation[30];
+    int8_t SNR[30];
+
+} __attribute__((packed)) __attribute__((aligned(4))) GPSSatellitesData;
+
+// Typesafe Object access functions
+/**
+ * @function GPSSatellitesGet(dataOut)
+ * @brief Populate a GPSSatellitesData object
+ * @param[out] dataOut 
+ */
+static inline int32_t GPSSatellitesGet(GPSSatellitesData *dataOut) { return UAVObjGetData(GPSSatellitesHandle(), dataOut); }
+
+static inline int32_t GPSSatellitesSet(const GPSSatellitesData *dataIn) { return UAVObjSetData(GPSSatellitesHandle(), dataIn); }
+
+static inline int32_t GPSSatellitesInstGet(uint16_t instId, GPSSatellitesData *dataOut) { return UAVObjGetInstanceData(GPSSatellitesHandle(), instId, dataOut); }
+
+static inline int32_t GPSSatellitesInstSet(uint16_t instId, const GPSSatellitesData *dataIn) { return UAVObjSetInstanceData(GPSSatellitesHandle(), instId, dataIn); }
+
+static inline int32_t GPSSatellitesConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(GPSSatellitesHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GPSSatellitesConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(GPSSatellitesHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GPSSatellitesConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(GPSSatellitesHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GPSSatellitesConnectCopy(volatile GPSSatellitesData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	GPSSatellitesGet((void *) dataOut);
+
+	return UAVObjConnectCallback(GPSSatellitesHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t GPSSatellitesCreateInstance() { return UAVObjCreateInstance(GPSSatellitesHandle(), &GPSSatellitesSetDefaults); }
+
+static inline void GPSSatellitesUpdated() { UAVObjUpdated(GPSSatellitesHandle()); }
+
+static inline void GPSSatellitesInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(GPSSatellitesHandle(), instId); }
+
+static inline int32_t GPSSatellitesGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(GPSSatellitesHandle(), dataOut); }
+
+static inline int32_t GPSSatellitesSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(GPSSatellitesHandle(), dataIn); }
+
+static inline int8_t GPSSatellitesReadOnly() { return UAVObjReadOnly(GPSSatellitesHandle()); }
+
+static inline uint16_t GPSSatellitesGetNumInstances(){ return UAVObjGetNumInstances(GPSSatellitesHandle()); }
+
+static inline uint32_t GPSSatellitesGetNumBytes(){ return UAVObjGetNumBytes(GPSSatellitesHandle()); }
+
+// Field information
+// Field Azimuth information
+#define GPSSATELLITES_AZIMUTH_NUMELEM 30
+// Field SatsInView information
+// Field PRN information
+#define GPSSATELLITES_PRN_NUMELEM 30
+// Field Elevation information
+#define GPSSATELLITES_ELEVATION_NUMELEM 30
+// Field SNR information
+#define GPSSATELLITES_SNR_NUMELEM 30
+
+
+// set/Get functions
+extern void GPSSatellitesAzimuthSet( int16_t *NewAzimuth );
+extern void GPSSatellitesAzimuthGet( int16_t *NewAzimuth );
+extern void GPSSatellitesSatsInViewSet( uint8_t *NewSatsInView );
+extern void GPSSatellitesSatsInViewGet( uint8_t *NewSatsInView );
+extern void GPSSatellitesPRNSet( uint8_t *NewPRN );
+extern void GPSSatellitesPRNGet( uint8_t *NewPRN );
+extern void GPSSatellitesElevationSet( int8_t *NewElevation );
+extern void GPSSatellitesElevationGet( int8_t *NewElevation );
+extern void GPSSatellitesSNRSet( int8_t *NewSNR );
+extern void GPSSatellitesSNRGet( int8_t *NewSNR );
+
+
+#endif // GPSSATELLITES_H
+
+/**
+ * @}
+ * @}
+ */
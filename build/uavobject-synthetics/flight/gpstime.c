@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       gpstime.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the GPSTime object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gpstime.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "gpstime.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 10000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 30000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GPSTimeInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(GPSTIME_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(GPSTIME_OBJID,
+			GPSTIME_ISSINGLEINST, GPSTIME_ISSETTINGS, GPSTIME_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void GPSTimeSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	GPSTimeData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void GPSTimeSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GPSTimeSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	GPSTimeSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		GPSTimeSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GPSTimeHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GPSTimeYearSet( int16_t *NewYear )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewYear, offsetof( GPSTimeData, Year), sizeof(int16_t));
+}
+void GPSTimeYearGet( int16_t *NewYear )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewYear, offsetof( GPSTimeData, Year), sizeof(int16_t));
+}
+void GPSTimeMonthSet( int8_t *NewMonth )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewMonth, offsetof( GPSTimeData, Month), sizeof(int8_t));
+}
+void GPSTimeMonthGet( int8_t *NewMonth )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewMonth, offsetof( GPSTimeData, Month), sizeof(int8_t));
+}
+void GPSTimeDaySet( int8_t *NewDay )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewDay, offsetof( GPSTimeData, Day), sizeof(int8_t));
+}
+void GPSTimeDayGet( int8_t *NewDay )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewDay, offsetof( GPSTimeData, Day), sizeof(int8_t));
+}
+void GPSTimeHourSet( int8_t *NewHour )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewHour, offsetof( GPSTimeData, Hour), sizeof(int8_t));
+}
+void GPSTimeHourGet( int8_t *NewHour )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewHour, offsetof( GPSTimeData, Hour), sizeof(int8_t));
+}
+void GPSTimeMinuteSet( int8_t *NewMinute )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewMinute, offsetof( GPSTimeData, Minute), sizeof(int8_t));
+}
+void GPSTimeMinuteGet( int8_t *NewMinute )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewMinute, offsetof( GPSTimeData, Minute), sizeof(int8_t));
+}
+void GPSTimeSecondSet( int8_t *NewSecond )
+{
+	UAVObjSetDataField(GPSTimeHandle(), (void*)NewSecond, offsetof( GPSTimeData, Second), sizeof(int8_t));
+}
+void GPSTimeSecondGet( int8_t *NewSecond )
+{
+	UAVObjGetDataField(GPSTimeHandle(), (void*)NewSecond, offsetof( GPSTimeData, Second), sizeof(int8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hottsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HoTTSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hottsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hottsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HoTTSettingsData defaultData = {
+	.Limit = { 30, 100, -10, 10, -1, 1, 20, 500, 1500, 5, 30, 5, 30, 5, 30, 3.3, 40, 2000, 0, 100, 0, 100, 100, 100, 7000, 1000, 0 },
+	.Sensor = { 0, 0, 0, 0, 0 },
+	.Warning = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HoTTSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HOTTSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HOTTSETTINGS_OBJID,
+			HOTTSETTINGS_ISSINGLEINST, HOTTSETTINGS_ISSETTINGS, HOTTSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HoTTSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HoTTSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HoTTSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HoTTSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HoTTSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HoTTSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HoTTSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HoTTSettingsLimitSet( float *NewLimit )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewLimit, offsetof( HoTTSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTSettingsLimitGet( float *NewLimit )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewLimit, offsetof( HoTTSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTSettingsSensorSet( uint8_t *NewSensor )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewSensor, offsetof( HoTTSettingsData, Sensor), 5*sizeof(uint8_t));
+}
+void HoTTSettingsSensorGet( uint8_t *NewSensor )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewSensor, offsetof( HoTTSettingsData, Sensor), 5*sizeof(uint8_t));
+}
+void HoTTSettingsWarningSet( uint8_t *NewWarning )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewWarning, offsetof( HoTTSettingsData, Warning), 28*sizeof(uint8_t));
+}
+void HoTTSettingsWarningGet( uint8_t *NewWarning )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewWarning, offsetof( HoTTSettingsData, Warning), 28*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
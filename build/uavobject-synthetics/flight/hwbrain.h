@@ -0,0 +1,234 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwBrain HwBrain
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwbrain.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwBrain object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwbrain.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWBRAIN_H
+#define HWBRAIN_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWBRAIN_OBJID 0x2250995C
+#define HWBRAIN_ISSINGLEINST 1
+#define HWBRAIN_ISSETTINGS 1
+#define HWBRAIN_NUMBYTES 13
+
+// Generic interface functions
+int32_t HwBrainInitialize();
+UAVObjHandle HwBrainHandle();
+void HwBrainSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RxPort;
+    uint8_t MainPort;
+    uint8_t FlxPort;
+    uint8_t RxPortUsart;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroFullScale;
+    uint8_t AccelFullScale;
+    uint8_t MPU9250GyroLPF;
+    uint8_t MPU9250AccelLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwBrainData;
+
+// Typesafe Object access functions
+/**
+ * @function HwBrainGet(dataOut)
+ * @brief Populate a HwBrainData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwBrainGet(HwBrainData *dataOut) { return UAVObjGetData(HwBrainHandle(), dataOut); }
+
+static inline int32_t HwBrainSet(const HwBrainData *dataIn) { return UAVObjSetData(HwBrainHandle(), dataIn); }
+
+static inline int32_t HwBrainInstGet(uint16_t instId, HwBrainData *dataOut) { return UAVObjGetInstanceData(HwBrainHandle(), instId, dataOut); }
+
+static inline int32_t HwBrainInstSet(uint16_t instId, const HwBrainData *dataIn) { return UAVObjSetInstanceData(HwBrainHandle(), instId, dataIn); }
+
+static inline int32_t HwBrainConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwBrainHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwBrainHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwBrainHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCopy(volatile HwBrainData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwBrainGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwBrainHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwBrainCreateInstance() { return UAVObjCreateInstance(HwBrainHandle(), &HwBrainSetDefaults); }
+
+static inline void HwBrainUpdated() { UAVObjUpdated(HwBrainHandle()); }
+
+static inline void HwBrainInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwBrainHandle(), instId); }
+
+static inline int32_t HwBrainGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwBrainHandle(), dataOut); }
+
+static inline int32_t HwBrainSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwBrainHandle(), dataIn); }
+
+static inline int8_t HwBrainReadOnly() { return UAVObjReadOnly(HwBrainHandle()); }
+
+static inline uint16_t HwBrainGetNumInstances(){ return UAVObjGetNumInstances(HwBrainHandle()); }
+
+static inline uint32_t HwBrainGetNumBytes(){ return UAVObjGetNumBytes(HwBrainHandle()); }
+
+// Field information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWBRAIN_RXPORT_DISABLED=0, HWBRAIN_RXPORT_OUTPUTS=1, HWBRAIN_RXPORT_PPM=2, HWBRAIN_RXPORT_PPMFRSKY=3, HWBRAIN_RXPORT_PPMOUTPUTS=4, HWBRAIN_RXPORT_PPMPWM=5, HWBRAIN_RXPORT_PPMUART=6, HWBRAIN_RXPORT_PPMUARTOUTPUTS=7, HWBRAIN_RXPORT_PWM=8, HWBRAIN_RXPORT_UART=9, HWBRAIN_RXPORT_UARTOUTPUTS=10 }  __attribute__((packed)) HwBrainRxPortOptions;
+#define HWBRAIN_RXPORT_GLOBAL_MAXOPTVAL 10
+#define HWBRAIN_RXPORT_MAXOPTVAL 10
+static inline bool HwBrainRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort <= HWBRAIN_RXPORT_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWBRAIN_MAINPORT_DISABLED=0, HWBRAIN_MAINPORT_COMBRIDGE=9, HWBRAIN_MAINPORT_DEBUGCONSOLE=8, HWBRAIN_MAINPORT_DSM=3, HWBRAIN_MAINPORT_FRSKYSENSORHUB=16, HWBRAIN_MAINPORT_FRSKYSPORTTELEMETRY=17, HWBRAIN_MAINPORT_FRSKYSPORTNONINVERTED=18, HWBRAIN_MAINPORT_GPS=2, HWBRAIN_MAINPORT_SRXL=6, HWBRAIN_MAINPORT_HOTTSUMD=13, HWBRAIN_MAINPORT_HOTTSUMH=14, HWBRAIN_MAINPORT_HOTTTELEMETRY=15, HWBRAIN_MAINPORT_LIGHTTELEMETRYTX=19, HWBRAIN_MAINPORT_MAVLINKTX=10, HWBRAIN_MAINPORT_MAVLINKTX_GPS_RX=11, HWBRAIN_MAINPORT_SBUS=4, HWBRAIN_MAINPORT_SBUSNONINVERTED=5, HWBRAIN_MAINPORT_STORM32BGC=21, HWBRAIN_MAINPORT_TELEMETRY=1, HWBRAIN_MAINPORT_OPENLOG=20, HWBRAIN_MAINPORT_IBUS=7, HWBRAIN_MAINPORT_VTXCONFIGTBSSMARTAUDIO=22, HWBRAIN_MAINPORT_TBSCROSSFIRE=23, HWBRAIN_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainMainPortOptions;
+#define HWBRAIN_MAINPORT_GLOBAL_MAXOPTVAL 26
+#define HWBRAIN_MAINPORT_MAXOPTVAL 23
+static inline bool HwBrainMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort <= HWBRAIN_MAINPORT_MAXOPTVAL; }
+// Field FlxPort information
+/* Enumeration options for field FlxPort */
+typedef enum { HWBRAIN_FLXPORT_DISABLED=0, HWBRAIN_FLXPORT_COMBRIDGE=9, HWBRAIN_FLXPORT_DEBUGCONSOLE=8, HWBRAIN_FLXPORT_DSM=3, HWBRAIN_FLXPORT_FRSKYSENSORHUB=16, HWBRAIN_FLXPORT_FRSKYSPORTTELEMETRY=17, HWBRAIN_FLXPORT_FRSKYSPORTNONINVERTED=18, HWBRAIN_FLXPORT_GPS=2, HWBRAIN_FLXPORT_SRXL=6, HWBRAIN_FLXPORT_HOTTSUMD=13, HWBRAIN_FLXPORT_HOTTSUMH=14, HWBRAIN_FLXPORT_HOTTTELEMETRY=15, HWBRAIN_FLXPORT_I2C=24, HWBRAIN_FLXPORT_LIGHTTELEMETRYTX=19, HWBRAIN_FLXPORT_MAVLINKTX=10, HWBRAIN_FLXPORT_MAVLINKTX_GPS_RX=11, HWBRAIN_FLXPORT_SBUSNONINVERTED=5, HWBRAIN_FLXPORT_STORM32BGC=21, HWBRAIN_FLXPORT_TELEMETRY=1, HWBRAIN_FLXPORT_OPENLOG=20, HWBRAIN_FLXPORT_IBUS=7, HWBRAIN_FLXPORT_VTXCONFIGTBSSMARTAUDIO=22, HWBRAIN_FLXPORT_TBSCROSSFIRE=23, HWBRAIN_FLXPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainFlxPortOptions;
+#define HWBRAIN_FLXPORT_GLOBAL_MAXOPTVAL 26
+#define HWBRAIN_FLXPORT_MAXOPTVAL 24
+static inline bool HwBrainFlxPortIsValid( uint8_t CurrentFlxPort ) { return CurrentFlxPort <= HWBRAIN_FLXPORT_MAXOPTVAL; }
+// Field RxPortUsart information
+/* Enumeration options for field RxPortUsart */
+typedef enum { HWBRAIN_RXPORTUSART_DISABLED=0, HWBRAIN_RXPORTUSART_COMBRIDGE=9, HWBRAIN_RXPORTUSART_DEBUGCONSOLE=8, HWBRAIN_RXPORTUSART_DSM=3, HWBRAIN_RXPORTUSART_FRSKYSENSORHUB=16, HWBRAIN_RXPORTUSART_FRSKYSPORTTELEMETRY=17, HWBRAIN_RXPORTUSART_FRSKYSPORTNONINVERTED=18, HWBRAIN_RXPORTUSART_GPS=2, HWBRAIN_RXPORTUSART_SRXL=6, HWBRAIN_RXPORTUSART_HOTTSUMD=13, HWBRAIN_RXPORTUSART_HOTTSUMH=14, HWBRAIN_RXPORTUSART_HOTTTELEMETRY=15, HWBRAIN_RXPORTUSART_LIGHTTELEMETRYTX=19, HWBRAIN_RXPORTUSART_MAVLINKTX=10, HWBRAIN_RXPORTUSART_MAVLINKTX_GPS_RX=11, HWBRAIN_RXPORTUSART_SBUSNONINVERTED=5, HWBRAIN_RXPORTUSART_STORM32BGC=21, HWBRAIN_RXPORTUSART_TELEMETRY=1, HWBRAIN_RXPORTUSART_OPENLOG=20, HWBRAIN_RXPORTUSART_IBUS=7, HWBRAIN_RXPORTUSART_VTXCONFIGTBSSMARTAUDIO=22, HWBRAIN_RXPORTUSART_TBSCROSSFIRE=23, HWBRAIN_RXPORTUSART_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRxPortUsartOptions;
+#define HWBRAIN_RXPORTUSART_GLOBAL_MAXOPTVAL 26
+#define HWBRAIN_RXPORTUSART_MAXOPTVAL 23
+static inline bool HwBrainRxPortUsartIsValid( uint8_t CurrentRxPortUsart ) { return CurrentRxPortUsart <= HWBRAIN_RXPORTUSART_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWBRAIN_USB_HIDPORT_USBTELEMETRY=0, HWBRAIN_USB_HIDPORT_RCTRANSMITTER=1, HWBRAIN_USB_HIDPORT_DISABLED=2 }  __attribute__((packed)) HwBrainUSB_HIDPortOptions;
+#define HWBRAIN_USB_HIDPORT_GLOBAL_MAXOPTVAL 2
+#define HWBRAIN_USB_HIDPORT_MAXOPTVAL 2
+static inline bool HwBrainUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWBRAIN_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWBRAIN_USB_VCPPORT_USBTELEMETRY=0, HWBRAIN_USB_VCPPORT_COMBRIDGE=1, HWBRAIN_USB_VCPPORT_DEBUGCONSOLE=2, HWBRAIN_USB_VCPPORT_MSP=3, HWBRAIN_USB_VCPPORT_DISABLED=4, HWBRAIN_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainUSB_VCPPortOptions;
+#define HWBRAIN_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWBRAIN_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwBrainUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWBRAIN_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWBRAIN_DSMXMODE_AUTODETECT=0, HWBRAIN_DSMXMODE_FORCE10BIT=1, HWBRAIN_DSMXMODE_FORCE11BIT=2, HWBRAIN_DSMXMODE_BIND3PULSES=3, HWBRAIN_DSMXMODE_BIND4PULSES=4, HWBRAIN_DSMXMODE_BIND5PULSES=5, HWBRAIN_DSMXMODE_BIND6PULSES=6, HWBRAIN_DSMXMODE_BIND7PULSES=7, HWBRAIN_DSMXMODE_BIND8PULSES=8, HWBRAIN_DSMXMODE_BIND9PULSES=9, HWBRAIN_DSMXMODE_BIND10PULSES=10, HWBRAIN_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainDSMxModeOptions;
+#define HWBRAIN_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWBRAIN_DSMXMODE_MAXOPTVAL 10
+static inline bool HwBrainDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWBRAIN_DSMXMODE_MAXOPTVAL; }
+// Field GyroFullScale information
+/* Enumeration options for field GyroFullScale */
+typedef enum { HWBRAIN_GYROFULLSCALE_250=0, HWBRAIN_GYROFULLSCALE_500=1, HWBRAIN_GYROFULLSCALE_1000=2, HWBRAIN_GYROFULLSCALE_2000=3 }  __attribute__((packed)) HwBrainGyroFullScaleOptions;
+#define HWBRAIN_GYROFULLSCALE_GLOBAL_MAXOPTVAL 3
+#define HWBRAIN_GYROFULLSCALE_MAXOPTVAL 3
+static inline bool HwBrainGyroFullScaleIsValid( uint8_t CurrentGyroFullScale ) { return CurrentGyroFullScale <= HWBRAIN_GYROFULLSCALE_MAXOPTVAL; }
+// Field AccelFullScale information
+/* Enumeration options for field AccelFullScale */
+typedef enum { HWBRAIN_ACCELFULLSCALE_2G=0, HWBRAIN_ACCELFULLSCALE_4G=1, HWBRAIN_ACCELFULLSCALE_8G=2, HWBRAIN_ACCELFULLSCALE_16G=3 }  __attribute__((packed)) HwBrainAccelFullScaleOptions;
+#define HWBRAIN_ACCELFULLSCALE_GLOBAL_MAXOPTVAL 3
+#define HWBRAIN_ACCELFULLSCALE_MAXOPTVAL 3
+static inline bool HwBrainAccelFullScaleIsValid( uint8_t CurrentAccelFullScale ) { return CurrentAccelFullScale <= HWBRAIN_ACCELFULLSCALE_MAXOPTVAL; }
+// Field MPU9250GyroLPF information
+/* Enumeration options for field MPU9250GyroLPF */
+typedef enum { HWBRAIN_MPU9250GYROLPF_184=0, HWBRAIN_MPU9250GYROLPF_92=1, HWBRAIN_MPU9250GYROLPF_41=2, HWBRAIN_MPU9250GYROLPF_20=3, HWBRAIN_MPU9250GYROLPF_10=4, HWBRAIN_MPU9250GYROLPF_5=5 }  __attribute__((packed)) HwBrainMPU9250GyroLPFOptions;
+#define HWBRAIN_MPU9250GYROLPF_GLOBAL_MAXOPTVAL 5
+#define HWBRAIN_MPU9250GYROLPF_MAXOPTVAL 5
+static inline bool HwBrainMPU9250GyroLPFIsValid( uint8_t CurrentMPU9250GyroLPF ) { return CurrentMPU9250GyroLPF <= HWBRAIN_MPU9250GYROLPF_MAXOPTVAL; }
+// Field MPU9250AccelLPF information
+/* Enumeration options for field MPU9250AccelLPF */
+typedef enum { HWBRAIN_MPU9250ACCELLPF_460=0, HWBRAIN_MPU9250ACCELLPF_184=1, HWBRAIN_MPU9250ACCELLPF_92=2, HWBRAIN_MPU9250ACCELLPF_41=3, HWBRAIN_MPU9250ACCELLPF_20=4, HWBRAIN_MPU9250ACCELLPF_10=5, HWBRAIN_MPU9250ACCELLPF_5=6 }  __attribute__((packed)) HwBrainMPU9250AccelLPFOptions;
+#define HWBRAIN_MPU9250ACCELLPF_GLOBAL_MAXOPTVAL 6
+#define HWBRAIN_MPU9250ACCELLPF_MAXOPTVAL 6
+static inline bool HwBrainMPU9250AccelLPFIsValid( uint8_t CurrentMPU9250AccelLPF ) { return CurrentMPU9250AccelLPF <= HWBRAIN_MPU9250ACCELLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWBRAIN_MAGNETOMETER_NONE=0, HWBRAIN_MAGNETOMETER_INTERNAL=1, HWBRAIN_MAGNETOMETER_EXTERNALHMC5883=2, HWBRAIN_MAGNETOMETER_EXTERNALHMC5983=3, HWBRAIN_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainMagnetometerOptions;
+#define HWBRAIN_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWBRAIN_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwBrainMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWBRAIN_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWBRAIN_EXTMAGORIENTATION_TOP0DEGCW=0, HWBRAIN_EXTMAGORIENTATION_TOP90DEGCW=1, HWBRAIN_EXTMAGORIENTATION_TOP180DEGCW=2, HWBRAIN_EXTMAGORIENTATION_TOP270DEGCW=3, HWBRAIN_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWBRAIN_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWBRAIN_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWBRAIN_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWBRAIN_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainExtMagOrientationOptions;
+#define HWBRAIN_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWBRAIN_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwBrainExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWBRAIN_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwBrainRxPortSet( uint8_t *NewRxPort );
+extern void HwBrainRxPortGet( uint8_t *NewRxPort );
+extern void HwBrainMainPortSet( uint8_t *NewMainPort );
+extern void HwBrainMainPortGet( uint8_t *NewMainPort );
+extern void HwBrainFlxPortSet( uint8_t *NewFlxPort );
+extern void HwBrainFlxPortGet( uint8_t *NewFlxPort );
+extern void HwBrainRxPortUsartSet( uint8_t *NewRxPortUsart );
+extern void HwBrainRxPortUsartGet( uint8_t *NewRxPortUsart );
+extern void HwBrainUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwBrainDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwBrainGyroFullScaleSet( uint8_t *NewGyroFullScale );
+extern void HwBrainGyroFullScaleGet( uint8_t *NewGyroFullScale );
+extern void HwBrainAccelFullScaleSet( uint8_t *NewAccelFullScale );
+extern void HwBrainAccelFullScaleGet( uint8_t *NewAccelFullScale );
+extern void HwBrainMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF );
+extern void HwBrainMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF );
+extern void HwBrainMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF );
+extern void HwBrainMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF );
+extern void HwBrainMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwBrainMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwBrainExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwBrainExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWBRAIN_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,307 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwbrainre1.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwBrainRE1 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwbrainre1.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwbrainre1.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwBrainRE1Data defaultData = {
+	.IRIDILap = 0,
+	.IRIDTrackmate = 0,
+	.RxPort = 0,
+	.SerialPort = 0,
+	.MultiPortMode = 0,
+	.MultiPortSerial = 0,
+	.MultiPortSerial2 = 0,
+	.I2CExtBaro = 0,
+	.I2CExtMag = 0,
+	.ExtMagOrientation = 0,
+	.DSMxMode = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.IRProtocol = 0,
+	.BuzzerType = 0,
+	.HWRevision = 0,
+	.VideoSyncDetectorThreshold = 120,
+	.BMI160FOC = 0,
+	.FlashID = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwBrainRE1Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWBRAINRE1_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWBRAINRE1_OBJID,
+			HWBRAINRE1_ISSINGLEINST, HWBRAINRE1_ISSETTINGS, HWBRAINRE1_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwBrainRE1SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwBrainRE1Data data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwBrainRE1SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwBrainRE1SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwBrainRE1SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwBrainRE1SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwBrainRE1Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwBrainRE1IRIDILapSet( uint32_t *NewIRIDILap )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewIRIDILap, offsetof( HwBrainRE1Data, IRIDILap), sizeof(uint32_t));
+}
+void HwBrainRE1IRIDILapGet( uint32_t *NewIRIDILap )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewIRIDILap, offsetof( HwBrainRE1Data, IRIDILap), sizeof(uint32_t));
+}
+void HwBrainRE1IRIDTrackmateSet( uint16_t *NewIRIDTrackmate )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewIRIDTrackmate, offsetof( HwBrainRE1Data, IRIDTrackmate), sizeof(uint16_t));
+}
+void HwBrainRE1IRIDTrackmateGet( uint16_t *NewIRIDTrackmate )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewIRIDTrackmate, offsetof( HwBrainRE1Data, IRIDTrackmate), sizeof(uint16_t));
+}
+void HwBrainRE1RxPortSet( uint8_t *NewRxPort )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewRxPort, offsetof( HwBrainRE1Data, RxPort), sizeof(uint8_t));
+}
+void HwBrainRE1RxPortGet( uint8_t *NewRxPort )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewRxPort, offsetof( HwBrainRE1Data, RxPort), sizeof(uint8_t));
+}
+void HwBrainRE1SerialPortSet( uint8_t *NewSerialPort )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewSerialPort, offsetof( HwBrainRE1Data, SerialPort), sizeof(uint8_t));
+}
+void HwBrainRE1SerialPortGet( uint8_t *NewSerialPort )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewSerialPort, offsetof( HwBrainRE1Data, SerialPort), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortModeSet( uint8_t *NewMultiPortMode )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewMultiPortMode, offsetof( HwBrainRE1Data, MultiPortMode), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortModeGet( uint8_t *NewMultiPortMode )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewMultiPortMode, offsetof( HwBrainRE1Data, MultiPortMode), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortSerialSet( uint8_t *NewMultiPortSerial )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewMultiPortSerial, offsetof( HwBrainRE1Data, MultiPortSerial), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortSerialGet( uint8_t *NewMultiPortSerial )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewMultiPortSerial, offsetof( HwBrainRE1Data, MultiPortSerial), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortSerial2Set( uint8_t *NewMultiPortSerial2 )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewMultiPortSerial2, offsetof( HwBrainRE1Data, MultiPortSerial2), sizeof(uint8_t));
+}
+void HwBrainRE1MultiPortSerial2Get( uint8_t *NewMultiPortSerial2 )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewMultiPortSerial2, offsetof( HwBrainRE1Data, MultiPortSerial2), sizeof(uint8_t));
+}
+void HwBrainRE1I2CExtBaroSet( uint8_t *NewI2CExtBaro )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewI2CExtBaro, offsetof( HwBrainRE1Data, I2CExtBaro), sizeof(uint8_t));
+}
+void HwBrainRE1I2CExtBaroGet( uint8_t *NewI2CExtBaro )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewI2CExtBaro, offsetof( HwBrainRE1Data, I2CExtBaro), sizeof(uint8_t));
+}
+void HwBrainRE1I2CExtMagSet( uint8_t *NewI2CExtMag )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewI2CExtMag, offsetof( HwBrainRE1Data, I2CExtMag), sizeof(uint8_t));
+}
+void HwBrainRE1I2CExtMagGet( uint8_t *NewI2CExtMag )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewI2CExtMag, offsetof( HwBrainRE1Data, I2CExtMag), sizeof(uint8_t));
+}
+void HwBrainRE1ExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewExtMagOrientation, offsetof( HwBrainRE1Data, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwBrainRE1ExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewExtMagOrientation, offsetof( HwBrainRE1Data, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwBrainRE1DSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewDSMxMode, offsetof( HwBrainRE1Data, DSMxMode), sizeof(uint8_t));
+}
+void HwBrainRE1DSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewDSMxMode, offsetof( HwBrainRE1Data, DSMxMode), sizeof(uint8_t));
+}
+void HwBrainRE1USB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewUSB_HIDPort, offsetof( HwBrainRE1Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwBrainRE1USB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewUSB_HIDPort, offsetof( HwBrainRE1Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwBrainRE1USB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewUSB_VCPPort, offsetof( HwBrainRE1Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwBrainRE1USB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewUSB_VCPPort, offsetof( HwBrainRE1Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwBrainRE1IRProtocolSet( uint8_t *NewIRProtocol )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewIRProtocol, offsetof( HwBrainRE1Data, IRProtocol), sizeof(uint8_t));
+}
+void HwBrainRE1IRProtocolGet( uint8_t *NewIRProtocol )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewIRProtocol, offsetof( HwBrainRE1Data, IRProtocol), sizeof(uint8_t));
+}
+void HwBrainRE1BuzzerTypeSet( uint8_t *NewBuzzerType )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewBuzzerType, offsetof( HwBrainRE1Data, BuzzerType), sizeof(uint8_t));
+}
+void HwBrainRE1BuzzerTypeGet( uint8_t *NewBuzzerType )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewBuzzerType, offsetof( HwBrainRE1Data, BuzzerType), sizeof(uint8_t));
+}
+void HwBrainRE1HWRevisionSet( uint8_t *NewHWRevision )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewHWRevision, offsetof( HwBrainRE1Data, HWRevision), sizeof(uint8_t));
+}
+void HwBrainRE1HWRevisionGet( uint8_t *NewHWRevision )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewHWRevision, offsetof( HwBrainRE1Data, HWRevision), sizeof(uint8_t));
+}
+void HwBrainRE1VideoSyncDetectorThresholdSet( uint8_t *NewVideoSyncDetectorThreshold )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewVideoSyncDetectorThreshold, offsetof( HwBrainRE1Data, VideoSyncDetectorThreshold), sizeof(uint8_t));
+}
+void HwBrainRE1VideoSyncDetectorThresholdGet( uint8_t *NewVideoSyncDetectorThreshold )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewVideoSyncDetectorThreshold, offsetof( HwBrainRE1Data, VideoSyncDetectorThreshold), sizeof(uint8_t));
+}
+void HwBrainRE1BMI160FOCSet( uint8_t *NewBMI160FOC )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewBMI160FOC, offsetof( HwBrainRE1Data, BMI160FOC), sizeof(uint8_t));
+}
+void HwBrainRE1BMI160FOCGet( uint8_t *NewBMI160FOC )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewBMI160FOC, offsetof( HwBrainRE1Data, BMI160FOC), sizeof(uint8_t));
+}
+void HwBrainRE1FlashIDSet( uint8_t *NewFlashID )
+{
+	UAVObjSetDataField(HwBrainRE1Handle(), (void*)NewFlashID, offsetof( HwBrainRE1Data, FlashID), 16*sizeof(uint8_t));
+}
+void HwBrainRE1FlashIDGet( uint8_t *NewFlashID )
+{
+	UAVObjGetDataField(HwBrainRE1Handle(), (void*)NewFlashID, offsetof( HwBrainRE1Data, FlashID), 16*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,264 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwBrainRE1 HwBrainRE1
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwbrainre1.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwBrainRE1 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwbrainre1.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWBRAINRE1_H
+#define HWBRAINRE1_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWBRAINRE1_OBJID 0x8BD88CDA
+#define HWBRAINRE1_ISSINGLEINST 1
+#define HWBRAINRE1_ISSETTINGS 1
+#define HWBRAINRE1_NUMBYTES 38
+
+// Generic interface functions
+int32_t HwBrainRE1Initialize();
+UAVObjHandle HwBrainRE1Handle();
+void HwBrainRE1SetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t IRIDILap;
+    uint16_t IRIDTrackmate;
+    uint8_t RxPort;
+    uint8_t SerialPort;
+    uint8_t MultiPortMode;
+    uint8_t MultiPortSerial;
+    uint8_t MultiPortSerial2;
+    uint8_t I2CExtBaro;
+    uint8_t I2CExtMag;
+    uint8_t ExtMagOrientation;
+    uint8_t DSMxMode;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t IRProtocol;
+    uint8_t BuzzerType;
+    uint8_t HWRevision;
+    uint8_t VideoSyncDetectorThreshold;
+    uint8_t BMI160FOC;
+    uint8_t FlashID[16];
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwBrainRE1Data;
+
+// Typesafe Object access functions
+/**
+ * @function HwBrainRE1Get(dataOut)
+ * @brief Populate a HwBrainRE1Data object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwBrainRE1Get(HwBrainRE1Data *dataOut) { return UAVObjGetData(HwBrainRE1Handle(), dataOut); }
+
+static inline int32_t HwBrainRE1Set(const HwBrainRE1Data *dataIn) { return UAVObjSetData(HwBrainRE1Handle(), dataIn); }
+
+static inline int32_t HwBrainRE1InstGet(uint16_t instId, HwBrainRE1Data *dataOut) { return UAVObjGetInstanceData(HwBrainRE1Handle(), instId, dataOut); }
+
+static inline int32_t HwBrainRE1InstSet(uint16_t instId, const HwBrainRE1Data *dataIn) { return UAVObjSetInstanceData(HwBrainRE1Handle(), instId, dataIn); }
+
+static inline int32_t HwBrainRE1ConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwBrainRE1Handle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainRE1ConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwBrainRE1Handle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainRE1ConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwBrainRE1Handle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainRE1ConnectCopy(volatile HwBrainRE1Data *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwBrainRE1Get((void *) dataOut);
+
+	return UAVObjConnectCallback(HwBrainRE1Handle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwBrainRE1CreateInstance() { return UAVObjCreateInstance(HwBrainRE1Handle(), &HwBrainRE1SetDefaults); }
+
+static inline void HwBrainRE1Updated() { UAVObjUpdated(HwBrainRE1Handle()); }
+
+static inline void HwBrainRE1InstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwBrainRE1Handle(), instId); }
+
+static inline int32_t HwBrainRE1GetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwBrainRE1Handle(), dataOut); }
+
+static inline int32_t HwBrainRE1SetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwBrainRE1Handle(), dataIn); }
+
+static inline int8_t HwBrainRE1ReadOnly() { return UAVObjReadOnly(HwBrainRE1Handle()); }
+
+static inline uint16_t HwBrainRE1GetNumInstances(){ return UAVObjGetNumInstances(HwBrainRE1Handle()); }
+
+static inline uint32_t HwBrainRE1GetNumBytes(){ return UAVObjGetNumBytes(HwBrainRE1Handle()); }
+
+// Field information
+// Field IRIDILap information
+// Field IRIDTrackmate information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWBRAINRE1_RXPORT_DISABLED=0, HWBRAINRE1_RXPORT_PPM=25, HWBRAINRE1_RXPORT_SBUS=4, HWBRAINRE1_RXPORT_SBUSNONINVERTED=5, HWBRAINRE1_RXPORT_DSM=3, HWBRAINRE1_RXPORT_HOTTSUMD=13, HWBRAINRE1_RXPORT_HOTTSUMH=14, HWBRAINRE1_RXPORT_SRXL=6, HWBRAINRE1_RXPORT_IBUS=7, HWBRAINRE1_RXPORT_TBSCROSSFIRE=23, HWBRAINRE1_RXPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1RxPortOptions;
+#define HWBRAINRE1_RXPORT_GLOBAL_MAXOPTVAL 26
+#define HWBRAINRE1_RXPORT_MAXOPTVAL 25
+static inline bool HwBrainRE1RxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort <= HWBRAINRE1_RXPORT_MAXOPTVAL; }
+// Field SerialPort information
+/* Enumeration options for field SerialPort */
+typedef enum { HWBRAINRE1_SERIALPORT_DISABLED=0, HWBRAINRE1_SERIALPORT_TELEMETRY=1, HWBRAINRE1_SERIALPORT_GPS=2, HWBRAINRE1_SERIALPORT_DEBUGCONSOLE=8, HWBRAINRE1_SERIALPORT_COMBRIDGE=9, HWBRAINRE1_SERIALPORT_OPENLOG=20, HWBRAINRE1_SERIALPORT_MSP=12, HWBRAINRE1_SERIALPORT_STORM32BGC=21, HWBRAINRE1_SERIALPORT_HOTTTELEMETRY=15, HWBRAINRE1_SERIALPORT_LIGHTTELEMETRYTX=19, HWBRAINRE1_SERIALPORT_MAVLINKTX=10, HWBRAINRE1_SERIALPORT_MAVLINKTX_GPS_RX=11, HWBRAINRE1_SERIALPORT_VTXCONFIGTBSSMARTAUDIO=22, HWBRAINRE1_SERIALPORT_TBSCROSSFIRE=23, HWBRAINRE1_SERIALPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1SerialPortOptions;
+#define HWBRAINRE1_SERIALPORT_GLOBAL_MAXOPTVAL 26
+#define HWBRAINRE1_SERIALPORT_MAXOPTVAL 23
+static inline bool HwBrainRE1SerialPortIsValid( uint8_t CurrentSerialPort ) { return CurrentSerialPort <= HWBRAINRE1_SERIALPORT_MAXOPTVAL; }
+// Field MultiPortMode information
+/* Enumeration options for field MultiPortMode */
+typedef enum { HWBRAINRE1_MULTIPORTMODE_NORMAL=0, HWBRAINRE1_MULTIPORTMODE_DUALSERIAL4PWM=1 }  __attribute__((packed)) HwBrainRE1MultiPortModeOptions;
+#define HWBRAINRE1_MULTIPORTMODE_GLOBAL_MAXOPTVAL 1
+#define HWBRAINRE1_MULTIPORTMODE_MAXOPTVAL 1
+static inline bool HwBrainRE1MultiPortModeIsValid( uint8_t CurrentMultiPortMode ) { return CurrentMultiPortMode <= HWBRAINRE1_MULTIPORTMODE_MAXOPTVAL; }
+// Field MultiPortSerial information
+/* Enumeration options for field MultiPortSerial */
+typedef enum { HWBRAINRE1_MULTIPORTSERIAL_DISABLED=0, HWBRAINRE1_MULTIPORTSERIAL_PWM=26, HWBRAINRE1_MULTIPORTSERIAL_TELEMETRY=1, HWBRAINRE1_MULTIPORTSERIAL_GPS=2, HWBRAINRE1_MULTIPORTSERIAL_DEBUGCONSOLE=8, HWBRAINRE1_MULTIPORTSERIAL_COMBRIDGE=9, HWBRAINRE1_MULTIPORTSERIAL_OPENLOG=20, HWBRAINRE1_MULTIPORTSERIAL_MSP=12, HWBRAINRE1_MULTIPORTSERIAL_STORM32BGC=21, HWBRAINRE1_MULTIPORTSERIAL_HOTTTELEMETRY=15, HWBRAINRE1_MULTIPORTSERIAL_LIGHTTELEMETRYTX=19, HWBRAINRE1_MULTIPORTSERIAL_MAVLINKTX=10, HWBRAINRE1_MULTIPORTSERIAL_MAVLINKTX_GPS_RX=11, HWBRAINRE1_MULTIPORTSERIAL_FRSKYSENSORHUB=16, HWBRAINRE1_MULTIPORTSERIAL_FRSKYSPORTTELEMETRY=17, HWBRAINRE1_MULTIPORTSERIAL_TBSCROSSFIRE=23, HWBRAINRE1_MULTIPORTSERIAL_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1MultiPortSerialOptions;
+#define HWBRAINRE1_MULTIPORTSERIAL_GLOBAL_MAXOPTVAL 26
+#define HWBRAINRE1_MULTIPORTSERIAL_MAXOPTVAL 26
+static inline bool HwBrainRE1MultiPortSerialIsValid( uint8_t CurrentMultiPortSerial ) { return CurrentMultiPortSerial <= HWBRAINRE1_MULTIPORTSERIAL_MAXOPTVAL; }
+// Field MultiPortSerial2 information
+/* Enumeration options for field MultiPortSerial2 */
+typedef enum { HWBRAINRE1_MULTIPORTSERIAL2_DISABLED=0, HWBRAINRE1_MULTIPORTSERIAL2_TELEMETRY=1, HWBRAINRE1_MULTIPORTSERIAL2_GPS=2, HWBRAINRE1_MULTIPORTSERIAL2_DEBUGCONSOLE=8, HWBRAINRE1_MULTIPORTSERIAL2_COMBRIDGE=9, HWBRAINRE1_MULTIPORTSERIAL2_OPENLOG=20, HWBRAINRE1_MULTIPORTSERIAL2_MSP=12, HWBRAINRE1_MULTIPORTSERIAL2_STORM32BGC=21, HWBRAINRE1_MULTIPORTSERIAL2_HOTTTELEMETRY=15, HWBRAINRE1_MULTIPORTSERIAL2_LIGHTTELEMETRYTX=19, HWBRAINRE1_MULTIPORTSERIAL2_MAVLINKTX=10, HWBRAINRE1_MULTIPORTSERIAL2_MAVLINKTX_GPS_RX=11, HWBRAINRE1_MULTIPORTSERIAL2_VTXCONFIGTBSSMARTAUDIO=22, HWBRAINRE1_MULTIPORTSERIAL2_TBSCROSSFIRE=23, HWBRAINRE1_MULTIPORTSERIAL2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1MultiPortSerial2Options;
+#define HWBRAINRE1_MULTIPORTSERIAL2_GLOBAL_MAXOPTVAL 26
+#define HWBRAINRE1_MULTIPORTSERIAL2_MAXOPTVAL 23
+static inline bool HwBrainRE1MultiPortSerial2IsValid( uint8_t CurrentMultiPortSerial2 ) { return CurrentMultiPortSerial2 <= HWBRAINRE1_MULTIPORTSERIAL2_MAXOPTVAL; }
+// Field I2CExtBaro information
+/* Enumeration options for field I2CExtBaro */
+typedef enum { HWBRAINRE1_I2CEXTBARO_NONE=0, HWBRAINRE1_I2CEXTBARO_BMP280=1, HWBRAINRE1_I2CEXTBARO_MS5611=2, HWBRAINRE1_I2CEXTBARO_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1I2CExtBaroOptions;
+#define HWBRAINRE1_I2CEXTBARO_GLOBAL_MAXOPTVAL 2
+#define HWBRAINRE1_I2CEXTBARO_MAXOPTVAL 2
+static inline bool HwBrainRE1I2CExtBaroIsValid( uint8_t CurrentI2CExtBaro ) { return CurrentI2CExtBaro <= HWBRAINRE1_I2CEXTBARO_MAXOPTVAL; }
+// Field I2CExtMag information
+/* Enumeration options for field I2CExtMag */
+typedef enum { HWBRAINRE1_I2CEXTMAG_NONE=0, HWBRAINRE1_I2CEXTMAG_EXTERNALHMC5883=2, HWBRAINRE1_I2CEXTMAG_EXTERNALHMC5983=3, HWBRAINRE1_I2CEXTMAG_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1I2CExtMagOptions;
+#define HWBRAINRE1_I2CEXTMAG_GLOBAL_MAXOPTVAL 3
+#define HWBRAINRE1_I2CEXTMAG_MAXOPTVAL 3
+static inline bool HwBrainRE1I2CExtMagIsValid( uint8_t CurrentI2CExtMag ) { return CurrentI2CExtMag <= HWBRAINRE1_I2CEXTMAG_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWBRAINRE1_EXTMAGORIENTATION_TOP0DEGCW=0, HWBRAINRE1_EXTMAGORIENTATION_TOP90DEGCW=1, HWBRAINRE1_EXTMAGORIENTATION_TOP180DEGCW=2, HWBRAINRE1_EXTMAGORIENTATION_TOP270DEGCW=3, HWBRAINRE1_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWBRAINRE1_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWBRAINRE1_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWBRAINRE1_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWBRAINRE1_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1ExtMagOrientationOptions;
+#define HWBRAINRE1_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWBRAINRE1_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwBrainRE1ExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWBRAINRE1_EXTMAGORIENTATION_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWBRAINRE1_DSMXMODE_AUTODETECT=0, HWBRAINRE1_DSMXMODE_FORCE10BIT=1, HWBRAINRE1_DSMXMODE_FORCE11BIT=2, HWBRAINRE1_DSMXMODE_BIND3PULSES=3, HWBRAINRE1_DSMXMODE_BIND4PULSES=4, HWBRAINRE1_DSMXMODE_BIND5PULSES=5, HWBRAINRE1_DSMXMODE_BIND6PULSES=6, HWBRAINRE1_DSMXMODE_BIND7PULSES=7, HWBRAINRE1_DSMXMODE_BIND8PULSES=8, HWBRAINRE1_DSMXMODE_BIND9PULSES=9, HWBRAINRE1_DSMXMODE_BIND10PULSES=10, HWBRAINRE1_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1DSMxModeOptions;
+#define HWBRAINRE1_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWBRAINRE1_DSMXMODE_MAXOPTVAL 10
+static inline bool HwBrainRE1DSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWBRAINRE1_DSMXMODE_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWBRAINRE1_USB_HIDPORT_USBTELEMETRY=0, HWBRAINRE1_USB_HIDPORT_DISABLED=1, HWBRAINRE1_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1USB_HIDPortOptions;
+#define HWBRAINRE1_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWBRAINRE1_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwBrainRE1USB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWBRAINRE1_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWBRAINRE1_USB_VCPPORT_USBTELEMETRY=0, HWBRAINRE1_USB_VCPPORT_COMBRIDGE=1, HWBRAINRE1_USB_VCPPORT_DEBUGCONSOLE=2, HWBRAINRE1_USB_VCPPORT_MSP=3, HWBRAINRE1_USB_VCPPORT_DISABLED=4, HWBRAINRE1_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRE1USB_VCPPortOptions;
+#define HWBRAINRE1_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWBRAINRE1_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwBrainRE1USB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWBRAINRE1_USB_VCPPORT_MAXOPTVAL; }
+// Field IRProtocol information
+/* Enumeration options for field IRProtocol */
+typedef enum { HWBRAINRE1_IRPROTOCOL_DISABLED=0, HWBRAINRE1_IRPROTOCOL_ILAP=1, HWBRAINRE1_IRPROTOCOL_TRACKMATE=2 }  __attribute__((packed)) HwBrainRE1IRProtocolOptions;
+#define HWBRAINRE1_IRPROTOCOL_GLOBAL_MAXOPTVAL 2
+#define HWBRAINRE1_IRPROTOCOL_MAXOPTVAL 2
+static inline bool HwBrainRE1IRProtocolIsValid( uint8_t CurrentIRProtocol ) { return CurrentIRProtocol <= HWBRAINRE1_IRPROTOCOL_MAXOPTVAL; }
+// Field BuzzerType information
+/* Enumeration options for field BuzzerType */
+typedef enum { HWBRAINRE1_BUZZERTYPE_DISABLED=0, HWBRAINRE1_BUZZERTYPE_DC_BUZZER=1, HWBRAINRE1_BUZZERTYPE_4KHZ_BUZZER=2 }  __attribute__((packed)) HwBrainRE1BuzzerTypeOptions;
+#define HWBRAINRE1_BUZZERTYPE_GLOBAL_MAXOPTVAL 2
+#define HWBRAINRE1_BUZZERTYPE_MAXOPTVAL 2
+static inline bool HwBrainRE1BuzzerTypeIsValid( uint8_t CurrentBuzzerType ) { return CurrentBuzzerType <= HWBRAINRE1_BUZZERTYPE_MAXOPTVAL; }
+// Field HWRevision information
+// Field VideoSyncDetectorThreshold information
+// Field BMI160FOC information
+/* Enumeration options for field BMI160FOC */
+typedef enum { HWBRAINRE1_BMI160FOC_DISABLED=0, HWBRAINRE1_BMI160FOC_DO_FOC=1 }  __attribute__((packed)) HwBrainRE1BMI160FOCOptions;
+#define HWBRAINRE1_BMI160FOC_GLOBAL_MAXOPTVAL 1
+#define HWBRAINRE1_BMI160FOC_MAXOPTVAL 1
+static inline bool HwBrainRE1BMI160FOCIsValid( uint8_t CurrentBMI160FOC ) { return CurrentBMI160FOC <= HWBRAINRE1_BMI160FOC_MAXOPTVAL; }
+// Field FlashID information
+#define HWBRAINRE1_FLASHID_NUMELEM 16
+
+
+// set/Get functions
+extern void HwBrainRE1IRIDILapSet( uint32_t *NewIRIDILap );
+extern void HwBrainRE1IRIDILapGet( uint32_t *NewIRIDILap );
+extern void HwBrainRE1IRIDTrackmateSet( uint16_t *NewIRIDTrackmate );
+extern void HwBrainRE1IRIDTrackmateGet( uint16_t *NewIRIDTrackmate );
+extern void HwBrainRE1RxPortSet( uint8_t *NewRxPort );
+extern void HwBrainRE1RxPortGet( uint8_t *NewRxPort );
+extern void HwBrainRE1SerialPortSet( uint8_t *NewSerialPort );
+extern void HwBrainRE1SerialPortGet( uint8_t *NewSerialPort );
+extern void HwBrainRE1MultiPortModeSet( uint8_t *NewMultiPortMode );
+extern void HwBrainRE1MultiPortModeGet( uint8_t *NewMultiPortMode );
+extern void HwBrainRE1MultiPortSerialSet( uint8_t *NewMultiPortSerial );
+extern void HwBrainRE1MultiPortSerialGet( uint8_t *NewMultiPortSerial );
+extern void HwBrainRE1MultiPortSerial2Set( uint8_t *NewMultiPortSerial2 );
+extern void HwBrainRE1MultiPortSerial2Get( uint8_t *NewMultiPortSerial2 );
+extern void HwBrainRE1I2CExtBaroSet( uint8_t *NewI2CExtBaro );
+extern void HwBrainRE1I2CExtBaroGet( uint8_t *NewI2CExtBaro );
+extern void HwBrainRE1I2CExtMagSet( uint8_t *NewI2CExtMag );
+extern void HwBrainRE1I2CExtMagGet( uint8_t *NewI2CExtMag );
+extern void HwBrainRE1ExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwBrainRE1ExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+extern void HwBrainRE1DSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwBrainRE1DSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwBrainRE1USB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainRE1USB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainRE1USB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainRE1USB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainRE1IRProtocolSet( uint8_t *NewIRProtocol );
+extern void HwBrainRE1IRProtocolGet( uint8_t *NewIRProtocol );
+extern void HwBrainRE1BuzzerTypeSet( uint8_t *NewBuzzerType );
+extern void HwBrainRE1BuzzerTypeGet( uint8_t *NewBuzzerType );
+extern void HwBrainRE1HWRevisionSet( uint8_t *NewHWRevision );
+extern void HwBrainRE1HWRevisionGet( uint8_t *NewHWRevision );
+extern void HwBrainRE1VideoSyncDetectorThresholdSet( uint8_t *NewVideoSyncDetectorThreshold );
+extern void HwBrainRE1VideoSyncDetectorThresholdGet( uint8_t *NewVideoSyncDetectorThreshold );
+extern void HwBrainRE1BMI160FOCSet( uint8_t *NewBMI160FOC );
+extern void HwBrainRE1BMI160FOCGet( uint8_t *NewBMI160FOC );
+extern void HwBrainRE1FlashIDSet( uint8_t *NewFlashID );
+extern void HwBrainRE1FlashIDGet( uint8_t *NewFlashID );
+
+
+#endif // HWBRAINRE1_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwdtfc.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwDtfc object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwdtfc.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwdtfc.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwDtfcData defaultData = {
+	.RcvrPort = 25,
+	.Uart1 = 0,
+	.Uart2 = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.GyroRange = 3,
+	.AccelRange = 2,
+	.ICM20608G_GyroLPF = 0,
+	.ICM20608G_AccelLPF = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwDtfcInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWDTFC_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWDTFC_OBJID,
+			HWDTFC_ISSINGLEINST, HWDTFC_ISSETTINGS, HWDTFC_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwDtfcSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwDtfcData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwDtfcSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwDtfcSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwDtfcSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwDtfcSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwDtfcHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwDtfcRcvrPortSet( uint8_t *NewRcvrPort )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewRcvrPort, offsetof( HwDtfcData, RcvrPort), sizeof(uint8_t));
+}
+void HwDtfcRcvrPortGet( uint8_t *NewRcvrPort )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewRcvrPort, offsetof( HwDtfcData, RcvrPort), sizeof(uint8_t));
+}
+void HwDtfcUart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewUart1, offsetof( HwDtfcData, Uart1), sizeof(uint8_t));
+}
+void HwDtfcUart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewUart1, offsetof( HwDtfcData, Uart1), sizeof(uint8_t));
+}
+void HwDtfcUart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewUart2, offsetof( HwDtfcData, Uart2), sizeof(uint8_t));
+}
+void HwDtfcUart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewUart2, offsetof( HwDtfcData, Uart2), sizeof(uint8_t));
+}
+void HwDtfcUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewUSB_HIDPort, offsetof( HwDtfcData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwDtfcUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewUSB_HIDPort, offsetof( HwDtfcData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwDtfcUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewUSB_VCPPort, offsetof( HwDtfcData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwDtfcUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewUSB_VCPPort, offsetof( HwDtfcData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwDtfcDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewDSMxMode, offsetof( HwDtfcData, DSMxMode), sizeof(uint8_t));
+}
+void HwDtfcDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewDSMxMode, offsetof( HwDtfcData, DSMxMode), sizeof(uint8_t));
+}
+void HwDtfcGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewGyroRange, offsetof( HwDtfcData, GyroRange), sizeof(uint8_t));
+}
+void HwDtfcGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewGyroRange, offsetof( HwDtfcData, GyroRange), sizeof(uint8_t));
+}
+void HwDtfcAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewAccelRange, offsetof( HwDtfcData, AccelRange), sizeof(uint8_t));
+}
+void HwDtfcAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewAccelRange, offsetof( HwDtfcData, AccelRange), sizeof(uint8_t));
+}
+void HwDtfcICM20608G_GyroLPFSet( uint8_t *NewICM20608G_GyroLPF )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewICM20608G_GyroLPF, offsetof( HwDtfcData, ICM20608G_GyroLPF), sizeof(uint8_t));
+}
+void HwDtfcICM20608G_GyroLPFGet( uint8_t *NewICM20608G_GyroLPF )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewICM20608G_GyroLPF, offsetof( HwDtfcData, ICM20608G_GyroLPF), sizeof(uint8_t));
+}
+void HwDtfcICM20608G_AccelLPFSet( uint8_t *NewICM20608G_AccelLPF )
+{
+	UAVObjSetDataField(HwDtfcHandle(), (void*)NewICM20608G_AccelLPF, offsetof( HwDtfcData, ICM20608G_AccelLPF), sizeof(uint8_t));
+}
+void HwDtfcICM20608G_AccelLPFGet( uint8_t *NewICM20608G_AccelLPF )
+{
+	UAVObjGetDataField(HwDtfcHandle(), (void*)NewICM20608G_AccelLPF, offsetof( HwDtfcData, ICM20608G_AccelLPF), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
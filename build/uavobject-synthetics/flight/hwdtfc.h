@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwDtfc HwDtfc
+ * @brief Selection of optional hardware configurations
+ *
+ *
+ * @file       hwdtfc.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwDtfc object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwdtfc.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWDTFC_H
+#define HWDTFC_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWDTFC_OBJID 0xFEBC8B50
+#define HWDTFC_ISSINGLEINST 1
+#define HWDTFC_ISSETTINGS 1
+#define HWDTFC_NUMBYTES 10
+
+// Generic interface functions
+int32_t HwDtfcInitialize();
+UAVObjHandle HwDtfcHandle();
+void HwDtfcSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RcvrPort;
+    uint8_t Uart1;
+    uint8_t Uart2;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t ICM20608G_GyroLPF;
+    uint8_t ICM20608G_AccelLPF;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwDtfcData;
+
+// Typesafe Object access functions
+/**
+ * @function HwDtfcGet(dataOut)
+ * @brief Populate a HwDtfcData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwDtfcGet(HwDtfcData *dataOut) { return UAVObjGetData(HwDtfcHandle(), dataOut); }
+
+static inline int32_t HwDtfcSet(const HwDtfcData *dataIn) { return UAVObjSetData(HwDtfcHandle(), dataIn); }
+
+static inline int32_t HwDtfcInstGet(uint16_t instId, HwDtfcData *dataOut) { return UAVObjGetInstanceData(HwDtfcHandle(), instId, dataOut); }
+
+static inline int32_t HwDtfcInstSet(uint16_t instId, const HwDtfcData *dataIn) { return UAVObjSetInstanceData(HwDtfcHandle(), instId, dataIn); }
+
+static inline int32_t HwDtfcConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwDtfcHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwDtfcConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwDtfcHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwDtfcConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwDtfcHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwDtfcConnectCopy(volatile HwDtfcData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwDtfcGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwDtfcHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwDtfcCreateInstance() { return UAVObjCreateInstance(HwDtfcHandle(), &HwDtfcSetDefaults); }
+
+static inline void HwDtfcUpdated() { UAVObjUpdated(HwDtfcHandle()); }
+
+static inline void HwDtfcInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwDtfcHandle(), instId); }
+
+static inline int32_t HwDtfcGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwDtfcHandle(), dataOut); }
+
+static inline int32_t HwDtfcSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwDtfcHandle(), dataIn); }
+
+static inline int8_t HwDtfcReadOnly() { return UAVObjReadOnly(HwDtfcHandle()); }
+
+static inline uint16_t HwDtfcGetNumInstances(){ return UAVObjGetNumInstances(HwDtfcHandle()); }
+
+static inline uint32_t HwDtfcGetNumBytes(){ return UAVObjGetNumBytes(HwDtfcHandle()); }
+
+// Field information
+// Field RcvrPort information
+/* Enumeration options for field RcvrPort */
+typedef enum { HWDTFC_RCVRPORT_DISABLED=0, HWDTFC_RCVRPORT_PPM=25, HWDTFC_RCVRPORT_TELEMETRY=1, HWDTFC_RCVRPORT_DEBUGCONSOLE=8, HWDTFC_RCVRPORT_COMBRIDGE=9, HWDTFC_RCVRPORT_GPS=2, HWDTFC_RCVRPORT_SRXL=6, HWDTFC_RCVRPORT_SBUS=4, HWDTFC_RCVRPORT_SBUSNONINVERTED=5, HWDTFC_RCVRPORT_DSM=3, HWDTFC_RCVRPORT_MAVLINKTX=10, HWDTFC_RCVRPORT_MAVLINKTX_GPS_RX=11, HWDTFC_RCVRPORT_MSP=12, HWDTFC_RCVRPORT_HOTTTELEMETRY=15, HWDTFC_RCVRPORT_FRSKYSENSORHUB=16, HWDTFC_RCVRPORT_LIGHTTELEMETRYTX=19, HWDTFC_RCVRPORT_FRSKYSPORTTELEMETRY=17, HWDTFC_RCVRPORT_FRSKYSPORTNONINVERTED=18, HWDTFC_RCVRPORT_OPENLOG=20, HWDTFC_RCVRPORT_HOTTSUMD=13, HWDTFC_RCVRPORT_HOTTSUMH=14, HWDTFC_RCVRPORT_IBUS=7, HWDTFC_RCVRPORT_TBSCROSSFIRE=23, HWDTFC_RCVRPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcRcvrPortOptions;
+#define HWDTFC_RCVRPORT_GLOBAL_MAXOPTVAL 26
+#define HWDTFC_RCVRPORT_MAXOPTVAL 25
+static inline bool HwDtfcRcvrPortIsValid( uint8_t CurrentRcvrPort ) { return CurrentRcvrPort <= HWDTFC_RCVRPORT_MAXOPTVAL; }
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWDTFC_UART1_DISABLED=0, HWDTFC_UART1_TELEMETRY=1, HWDTFC_UART1_DEBUGCONSOLE=8, HWDTFC_UART1_COMBRIDGE=9, HWDTFC_UART1_GPS=2, HWDTFC_UART1_SRXL=6, HWDTFC_UART1_SBUS=4, HWDTFC_UART1_SBUSNONINVERTED=5, HWDTFC_UART1_DSM=3, HWDTFC_UART1_MAVLINKTX=10, HWDTFC_UART1_MAVLINKTX_GPS_RX=11, HWDTFC_UART1_MSP=12, HWDTFC_UART1_HOTTTELEMETRY=15, HWDTFC_UART1_FRSKYSENSORHUB=16, HWDTFC_UART1_LIGHTTELEMETRYTX=19, HWDTFC_UART1_FRSKYSPORTTELEMETRY=17, HWDTFC_UART1_FRSKYSPORTNONINVERTED=18, HWDTFC_UART1_OPENLOG=20, HWDTFC_UART1_HOTTSUMD=13, HWDTFC_UART1_HOTTSUMH=14, HWDTFC_UART1_IBUS=7, HWDTFC_UART1_TBSCROSSFIRE=23, HWDTFC_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcUart1Options;
+#define HWDTFC_UART1_GLOBAL_MAXOPTVAL 26
+#define HWDTFC_UART1_MAXOPTVAL 23
+static inline bool HwDtfcUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 <= HWDTFC_UART1_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWDTFC_UART2_DISABLED=0, HWDTFC_UART2_TELEMETRY=1, HWDTFC_UART2_DEBUGCONSOLE=8, HWDTFC_UART2_COMBRIDGE=9, HWDTFC_UART2_GPS=2, HWDTFC_UART2_SRXL=6, HWDTFC_UART2_SBUS=4, HWDTFC_UART2_SBUSNONINVERTED=5, HWDTFC_UART2_DSM=3, HWDTFC_UART2_MAVLINKTX=10, HWDTFC_UART2_MAVLINKTX_GPS_RX=11, HWDTFC_UART2_MSP=12, HWDTFC_UART2_HOTTTELEMETRY=15, HWDTFC_UART2_FRSKYSENSORHUB=16, HWDTFC_UART2_LIGHTTELEMETRYTX=19, HWDTFC_UART2_FRSKYSPORTTELEMETRY=17, HWDTFC_UART2_FRSKYSPORTNONINVERTED=18, HWDTFC_UART2_OPENLOG=20, HWDTFC_UART2_HOTTSUMD=13, HWDTFC_UART2_HOTTSUMH=14, HWDTFC_UART2_IBUS=7, HWDTFC_UART2_TBSCROSSFIRE=23, HWDTFC_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcUart2Options;
+#define HWDTFC_UART2_GLOBAL_MAXOPTVAL 26
+#define HWDTFC_UART2_MAXOPTVAL 23
+static inline bool HwDtfcUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 <= HWDTFC_UART2_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWDTFC_USB_HIDPORT_USBTELEMETRY=0, HWDTFC_USB_HIDPORT_DISABLED=1, HWDTFC_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcUSB_HIDPortOptions;
+#define HWDTFC_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWDTFC_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwDtfcUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWDTFC_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWDTFC_USB_VCPPORT_USBTELEMETRY=0, HWDTFC_USB_VCPPORT_COMBRIDGE=1, HWDTFC_USB_VCPPORT_DEBUGCONSOLE=2, HWDTFC_USB_VCPPORT_MSP=3, HWDTFC_USB_VCPPORT_DISABLED=4, HWDTFC_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcUSB_VCPPortOptions;
+#define HWDTFC_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWDTFC_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwDtfcUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWDTFC_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWDTFC_DSMXMODE_AUTODETECT=0, HWDTFC_DSMXMODE_FORCE10BIT=1, HWDTFC_DSMXMODE_FORCE11BIT=2, HWDTFC_DSMXMODE_BIND3PULSES=3, HWDTFC_DSMXMODE_BIND4PULSES=4, HWDTFC_DSMXMODE_BIND5PULSES=5, HWDTFC_DSMXMODE_BIND6PULSES=6, HWDTFC_DSMXMODE_BIND7PULSES=7, HWDTFC_DSMXMODE_BIND8PULSES=8, HWDTFC_DSMXMODE_BIND9PULSES=9, HWDTFC_DSMXMODE_BIND10PULSES=10, HWDTFC_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwDtfcDSMxModeOptions;
+#define HWDTFC_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWDTFC_DSMXMODE_MAXOPTVAL 10
+static inline bool HwDtfcDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWDTFC_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWDTFC_GYRORANGE_250=0, HWDTFC_GYRORANGE_500=1, HWDTFC_GYRORANGE_1000=2, HWDTFC_GYRORANGE_2000=3 }  __attribute__((packed)) HwDtfcGyroRangeOptions;
+#define HWDTFC_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWDTFC_GYRORANGE_MAXOPTVAL 3
+static inline bool HwDtfcGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWDTFC_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWDTFC_ACCELRANGE_2G=0, HWDTFC_ACCELRANGE_4G=1, HWDTFC_ACCELRANGE_8G=2, HWDTFC_ACCELRANGE_16G=3 }  __attribute__((packed)) HwDtfcAccelRangeOptions;
+#define HWDTFC_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWDTFC_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwDtfcAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWDTFC_ACCELRANGE_MAXOPTVAL; }
+// Field ICM20608G_GyroLPF information
+/* Enumeration options for field ICM20608G_GyroLPF */
+typedef enum { HWDTFC_ICM20608G_GYROLPF_176=0, HWDTFC_ICM20608G_GYROLPF_92=1, HWDTFC_ICM20608G_GYROLPF_41=2, HWDTFC_ICM20608G_GYROLPF_20=3, HWDTFC_ICM20608G_GYROLPF_10=4, HWDTFC_ICM20608G_GYROLPF_5=5 }  __attribute__((packed)) HwDtfcICM20608G_GyroLPFOptions;
+#define HWDTFC_ICM20608G_GYROLPF_GLOBAL_MAXOPTVAL 5
+#define HWDTFC_ICM20608G_GYROLPF_MAXOPTVAL 5
+static inline bool HwDtfcICM20608G_GyroLPFIsValid( uint8_t CurrentICM20608G_GyroLPF ) { return CurrentICM20608G_GyroLPF <= HWDTFC_ICM20608G_GYROLPF_MAXOPTVAL; }
+// Field ICM20608G_AccelLPF information
+/* Enumeration options for field ICM20608G_AccelLPF */
+typedef enum { HWDTFC_ICM20608G_ACCELLPF_218=0, HWDTFC_ICM20608G_ACCELLPF_99=1, HWDTFC_ICM20608G_ACCELLPF_45=2, HWDTFC_ICM20608G_ACCELLPF_21=3, HWDTFC_ICM20608G_ACCELLPF_10=4, HWDTFC_ICM20608G_ACCELLPF_5=5 }  __attribute__((packed)) HwDtfcICM20608G_AccelLPFOptions;
+#define HWDTFC_ICM20608G_ACCELLPF_GLOBAL_MAXOPTVAL 5
+#define HWDTFC_ICM20608G_ACCELLPF_MAXOPTVAL 5
+static inline bool HwDtfcICM20608G_AccelLPFIsValid( uint8_t CurrentICM20608G_AccelLPF ) { return CurrentICM20608G_AccelLPF <= HWDTFC_ICM20608G_ACCELLPF_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwDtfcRcvrPortSet( uint8_t *NewRcvrPort );
+extern void HwDtfcRcvrPortGet( uint8_t *NewRcvrPort );
+extern void HwDtfcUart1Set( uint8_t *NewUart1 );
+extern void HwDtfcUart1Get( uint8_t *NewUart1 );
+extern void HwDtfcUart2Set( uint8_t *NewUart2 );
+extern void HwDtfcUart2Get( uint8_t *NewUart2 );
+extern void HwDtfcUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwDtfcUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwDtfcUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwDtfcUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwDtfcDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwDtfcDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwDtfcGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwDtfcGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwDtfcAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwDtfcAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwDtfcICM20608G_GyroLPFSet( uint8_t *NewICM20608G_GyroLPF );
+extern void HwDtfcICM20608G_GyroLPFGet( uint8_t *NewICM20608G_GyroLPF );
+extern void HwDtfcICM20608G_AccelLPFSet( uint8_t *NewICM20608G_AccelLPF );
+extern void HwDtfcICM20608G_AccelLPFGet( uint8_t *NewICM20608G_AccelLPF );
+
+
+#endif // HWDTFC_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwLux HwLux
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwlux.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwLux object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwlux.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWLUX_H
+#define HWLUX_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWLUX_OBJID 0xA15CC8AC
+#define HWLUX_ISSINGLEINST 1
+#define HWLUX_ISSETTINGS 1
+#define HWLUX_NUMBYTES 10
+
+// Generic interface functions
+int32_t HwLuxInitialize();
+UAVObjHandle HwLuxHandle();
+void HwLuxSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RxPort;
+    uint8_t Uart2;
+    uint8_t Uart3;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU9250GyroLPF;
+    uint8_t MPU9250AccelLPF;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwLuxData;
+
+// Typesafe Object access functions
+/**
+ * @function HwLuxGet(dataOut)
+ * @brief Populate a HwLuxData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwLuxGet(HwLuxData *dataOut) { return UAVObjGetData(HwLuxHandle(), dataOut); }
+
+static inline int32_t HwLuxSet(const HwLuxData *dataIn) { return UAVObjSetData(HwLuxHandle(), dataIn); }
+
+static inline int32_t HwLuxInstGet(uint16_t instId, HwLuxData *dataOut) { return UAVObjGetInstanceData(HwLuxHandle(), instId, dataOut); }
+
+static inline int32_t HwLuxInstSet(uint16_t instId, const HwLuxData *dataIn) { return UAVObjSetInstanceData(HwLuxHandle(), instId, dataIn); }
+
+static inline int32_t HwLuxConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwLuxHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwLuxConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwLuxHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwLuxConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwLuxHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwLuxConnectCopy(volatile HwLuxData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwLuxGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwLuxHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwLuxCreateInstance() { return UAVObjCreateInstance(HwLuxHandle(), &HwLuxSetDefaults); }
+
+static inline void HwLuxUpdated() { UAVObjUpdated(HwLuxHandle()); }
+
+static inline void HwLuxInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwLuxHandle(), instId); }
+
+static inline int32_t HwLuxGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwLuxHandle(), dataOut); }
+
+static inline int32_t HwLuxSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwLuxHandle(), dataIn); }
+
+static inline int8_t HwLuxReadOnly() { return UAVObjReadOnly(HwLuxHandle()); }
+
+static inline uint16_t HwLuxGetNumInstances(){ return UAVObjGetNumInstances(HwLuxHandle()); }
+
+static inline uint32_t HwLuxGetNumBytes(){ return UAVObjGetNumBytes(HwLuxHandle()); }
+
+// Field information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWLUX_RXPORT_DISABLED=0, HWLUX_RXPORT_DSM=3, HWLUX_RXPORT_HOTTSUMD=13, HWLUX_RXPORT_HOTTSUMH=14, HWLUX_RXPORT_SBUS=4, HWLUX_RXPORT_SBUSNONINVERTED=5, HWLUX_RXPORT_SRXL=6, HWLUX_RXPORT_IBUS=7, HWLUX_RXPORT_COMBRIDGE=9, HWLUX_RXPORT_DEBUGCONSOLE=8, HWLUX_RXPORT_FRSKYSENSORHUB=16, HWLUX_RXPORT_FRSKYSPORTTELEMETRY=17, HWLUX_RXPORT_FRSKYSPORTNONINVERTED=18, HWLUX_RXPORT_GPS=2, HWLUX_RXPORT_HOTTTELEMETRY=15, HWLUX_RXPORT_I2C=24, HWLUX_RXPORT_LIGHTTELEMETRYTX=19, HWLUX_RXPORT_MAVLINKTX=10, HWLUX_RXPORT_MAVLINKTX_GPS_RX=11, HWLUX_RXPORT_MSP=12, HWLUX_RXPORT_OPENLOG=20, HWLUX_RXPORT_STORM32BGC=21, HWLUX_RXPORT_TELEMETRY=1, HWLUX_RXPORT_TBSCROSSFIRE=23, HWLUX_RXPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxRxPortOptions;
+#define HWLUX_RXPORT_GLOBAL_MAXOPTVAL 26
+#define HWLUX_RXPORT_MAXOPTVAL 24
+static inline bool HwLuxRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort <= HWLUX_RXPORT_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWLUX_UART2_DISABLED=0, HWLUX_UART2_COMBRIDGE=9, HWLUX_UART2_DEBUGCONSOLE=8, HWLUX_UART2_DSM=3, HWLUX_UART2_SRXL=6, HWLUX_UART2_FRSKYSENSORHUB=16, HWLUX_UART2_FRSKYSPORTTELEMETRY=17, HWLUX_UART2_FRSKYSPORTNONINVERTED=18, HWLUX_UART2_GPS=2, HWLUX_UART2_HOTTTELEMETRY=15, HWLUX_UART2_I2C=24, HWLUX_UART2_LIGHTTELEMETRYTX=19, HWLUX_UART2_MAVLINKTX=10, HWLUX_UART2_MAVLINKTX_GPS_RX=11, HWLUX_UART2_MSP=12, HWLUX_UART2_OPENLOG=20, HWLUX_UART2_SBUS=4, HWLUX_UART2_SBUSNONINVERTED=5, HWLUX_UART2_STORM32BGC=21, HWLUX_UART2_TELEMETRY=1, HWLUX_UART2_IBUS=7, HWLUX_UART2_HOTTSUMD=13, HWLUX_UART2_HOTTSUMH=14, HWLUX_UART2_TBSCROSSFIRE=23, HWLUX_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxUart2Options;
+#define HWLUX_UART2_GLOBAL_MAXOPTVAL 26
+#define HWLUX_UART2_MAXOPTVAL 24
+static inline bool HwLuxUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 <= HWLUX_UART2_MAXOPTVAL; }
+// Field Uart3 information
+/* Enumeration options for field Uart3 */
+typedef enum { HWLUX_UART3_DISABLED=0, HWLUX_UART3_COMBRIDGE=9, HWLUX_UART3_DEBUGCONSOLE=8, HWLUX_UART3_DSM=3, HWLUX_UART3_SRXL=6, HWLUX_UART3_FRSKYSENSORHUB=16, HWLUX_UART3_FRSKYSPORTTELEMETRY=17, HWLUX_UART3_FRSKYSPORTNONINVERTED=18, HWLUX_UART3_GPS=2, HWLUX_UART3_HOTTTELEMETRY=15, HWLUX_UART3_LIGHTTELEMETRYTX=19, HWLUX_UART3_MAVLINKTX=10, HWLUX_UART3_MAVLINKTX_GPS_RX=11, HWLUX_UART3_MSP=12, HWLUX_UART3_OPENLOG=20, HWLUX_UART3_SBUS=4, HWLUX_UART3_SBUSNONINVERTED=5, HWLUX_UART3_STORM32BGC=21, HWLUX_UART3_TELEMETRY=1, HWLUX_UART3_IBUS=7, HWLUX_UART3_HOTTSUMD=13, HWLUX_UART3_HOTTSUMH=14, HWLUX_UART3_TBSCROSSFIRE=23, HWLUX_UART3_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxUart3Options;
+#define HWLUX_UART3_GLOBAL_MAXOPTVAL 26
+#define HWLUX_UART3_MAXOPTVAL 23
+static inline bool HwLuxUart3IsValid( uint8_t CurrentUart3 ) { return CurrentUart3 <= HWLUX_UART3_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWLUX_USB_HIDPORT_USBTELEMETRY=0, HWLUX_USB_HIDPORT_DISABLED=1, HWLUX_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxUSB_HIDPortOptions;
+#define HWLUX_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWLUX_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwLuxUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWLUX_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWLUX_USB_VCPPORT_USBTELEMETRY=0, HWLUX_USB_VCPPORT_COMBRIDGE=1, HWLUX_USB_VCPPORT_DEBUGCONSOLE=2, HWLUX_USB_VCPPORT_MSP=3, HWLUX_USB_VCPPORT_DISABLED=4, HWLUX_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxUSB_VCPPortOptions;
+#define HWLUX_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWLUX_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwLuxUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWLUX_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWLUX_DSMXMODE_AUTODETECT=0, HWLUX_DSMXMODE_FORCE10BIT=1, HWLUX_DSMXMODE_FORCE11BIT=2, HWLUX_DSMXMODE_BIND3PULSES=3, HWLUX_DSMXMODE_BIND4PULSES=4, HWLUX_DSMXMODE_BIND5PULSES=5, HWLUX_DSMXMODE_BIND6PULSES=6, HWLUX_DSMXMODE_BIND7PULSES=7, HWLUX_DSMXMODE_BIND8PULSES=8, HWLUX_DSMXMODE_BIND9PULSES=9, HWLUX_DSMXMODE_BIND10PULSES=10, HWLUX_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwLuxDSMxModeOptions;
+#define HWLUX_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWLUX_DSMXMODE_MAXOPTVAL 10
+static inline bool HwLuxDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWLUX_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWLUX_GYRORANGE_250=0, HWLUX_GYRORANGE_500=1, HWLUX_GYRORANGE_1000=2, HWLUX_GYRORANGE_2000=3 }  __attribute__((packed)) HwLuxGyroRangeOptions;
+#define HWLUX_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWLUX_GYRORANGE_MAXOPTVAL 3
+static inline bool HwLuxGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWLUX_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWLUX_ACCELRANGE_2G=0, HWLUX_ACCELRANGE_4G=1, HWLUX_ACCELRANGE_8G=2, HWLUX_ACCELRANGE_16G=3 }  __attribute__((packed)) HwLuxAccelRangeOptions;
+#define HWLUX_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWLUX_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwLuxAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWLUX_ACCELRANGE_MAXOPTVAL; }
+// Field MPU9250GyroLPF information
+/* Enumeration options for field MPU9250GyroLPF */
+typedef enum { HWLUX_MPU9250GYROLPF_184=0, HWLUX_MPU9250GYROLPF_92=1, HWLUX_MPU9250GYROLPF_41=2, HWLUX_MPU9250GYROLPF_20=3, HWLUX_MPU9250GYROLPF_10=4, HWLUX_MPU9250GYROLPF_5=5 }  __attribute__((packed)) HwLuxMPU9250GyroLPFOptions;
+#define HWLUX_MPU9250GYROLPF_GLOBAL_MAXOPTVAL 5
+#define HWLUX_MPU9250GYROLPF_MAXOPTVAL 5
+static inline bool HwLuxMPU9250GyroLPFIsValid( uint8_t CurrentMPU9250GyroLPF ) { return CurrentMPU9250GyroLPF <= HWLUX_MPU9250GYROLPF_MAXOPTVAL; }
+// Field MPU9250AccelLPF information
+/* Enumeration options for field MPU9250AccelLPF */
+typedef enum { HWLUX_MPU9250ACCELLPF_460=0, HWLUX_MPU9250ACCELLPF_184=1, HWLUX_MPU9250ACCELLPF_92=2, HWLUX_MPU9250ACCELLPF_41=3, HWLUX_MPU9250ACCELLPF_20=4, HWLUX_MPU9250ACCELLPF_10=5, HWLUX_MPU9250ACCELLPF_5=6 }  __attribute__((packed)) HwLuxMPU9250AccelLPFOptions;
+#define HWLUX_MPU9250ACCELLPF_GLOBAL_MAXOPTVAL 6
+#define HWLUX_MPU9250ACCELLPF_MAXOPTVAL 6
+static inline bool HwLuxMPU9250AccelLPFIsValid( uint8_t CurrentMPU9250AccelLPF ) { return CurrentMPU9250AccelLPF <= HWLUX_MPU9250ACCELLPF_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwLuxRxPortSet( uint8_t *NewRxPort );
+extern void HwLuxRxPortGet( uint8_t *NewRxPort );
+extern void HwLuxUart2Set( uint8_t *NewUart2 );
+extern void HwLuxUart2Get( uint8_t *NewUart2 );
+extern void HwLuxUart3Set( uint8_t *NewUart3 );
+extern void HwLuxUart3Get( uint8_t *NewUart3 );
+extern void HwLuxUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwLuxUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwLuxUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwLuxUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwLuxDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwLuxDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwLuxGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwLuxGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwLuxAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwLuxAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwLuxMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF );
+extern void HwLuxMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF );
+extern void HwLuxMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF );
+extern void HwLuxMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF );
+
+
+#endif // HWLUX_H
+
+/**
+ * @}
+ * @}
+ */
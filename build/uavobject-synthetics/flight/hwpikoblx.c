@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwpikoblx.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwPikoBLX object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwpikoblx.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwpikoblx.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwPikoBLXData defaultData = {
+	.Uart1 = 0,
+	.Uart2 = 0,
+	.RxPort = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.GyroRange = 3,
+	.AccelRange = 2,
+	.GyroLPF = 0,
+	.AccelLPF = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwPikoBLXInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWPIKOBLX_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWPIKOBLX_OBJID,
+			HWPIKOBLX_ISSINGLEINST, HWPIKOBLX_ISSETTINGS, HWPIKOBLX_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwPikoBLXSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwPikoBLXData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwPikoBLXSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwPikoBLXSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwPikoBLXSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwPikoBLXSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwPikoBLXHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwPikoBLXUart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewUart1, offsetof( HwPikoBLXData, Uart1), sizeof(uint8_t));
+}
+void HwPikoBLXUart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewUart1, offsetof( HwPikoBLXData, Uart1), sizeof(uint8_t));
+}
+void HwPikoBLXUart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewUart2, offsetof( HwPikoBLXData, Uart2), sizeof(uint8_t));
+}
+void HwPikoBLXUart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewUart2, offsetof( HwPikoBLXData, Uart2), sizeof(uint8_t));
+}
+void HwPikoBLXRxPortSet( uint8_t *NewRxPort )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewRxPort, offsetof( HwPikoBLXData, RxPort), sizeof(uint8_t));
+}
+void HwPikoBLXRxPortGet( uint8_t *NewRxPort )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewRxPort, offsetof( HwPikoBLXData, RxPort), sizeof(uint8_t));
+}
+void HwPikoBLXUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewUSB_HIDPort, offsetof( HwPikoBLXData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwPikoBLXUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewUSB_HIDPort, offsetof( HwPikoBLXData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwPikoBLXUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewUSB_VCPPort, offsetof( HwPikoBLXData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwPikoBLXUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewUSB_VCPPort, offsetof( HwPikoBLXData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwPikoBLXDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewDSMxMode, offsetof( HwPikoBLXData, DSMxMode), sizeof(uint8_t));
+}
+void HwPikoBLXDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewDSMxMode, offsetof( HwPikoBLXData, DSMxMode), sizeof(uint8_t));
+}
+void HwPikoBLXGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewGyroRange, offsetof( HwPikoBLXData, GyroRange), sizeof(uint8_t));
+}
+void HwPikoBLXGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewGyroRange, offsetof( HwPikoBLXData, GyroRange), sizeof(uint8_t));
+}
+void HwPikoBLXAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewAccelRange, offsetof( HwPikoBLXData, AccelRange), sizeof(uint8_t));
+}
+void HwPikoBLXAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewAccelRange, offsetof( HwPikoBLXData, AccelRange), sizeof(uint8_t));
+}
+void HwPikoBLXGyroLPFSet( uint8_t *NewGyroLPF )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewGyroLPF, offsetof( HwPikoBLXData, GyroLPF), sizeof(uint8_t));
+}
+void HwPikoBLXGyroLPFGet( uint8_t *NewGyroLPF )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewGyroLPF, offsetof( HwPikoBLXData, GyroLPF), sizeof(uint8_t));
+}
+void HwPikoBLXAccelLPFSet( uint8_t *NewAccelLPF )
+{
+	UAVObjSetDataField(HwPikoBLXHandle(), (void*)NewAccelLPF, offsetof( HwPikoBLXData, AccelLPF), sizeof(uint8_t));
+}
+void HwPikoBLXAccelLPFGet( uint8_t *NewAccelLPF )
+{
+	UAVObjGetDataField(HwPikoBLXHandle(), (void*)NewAccelLPF, offsetof( HwPikoBLXData, AccelLPF), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwPikoBLX HwPikoBLX
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwpikoblx.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwPikoBLX object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwpikoblx.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWPIKOBLX_H
+#define HWPIKOBLX_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWPIKOBLX_OBJID 0xC780516
+#define HWPIKOBLX_ISSINGLEINST 1
+#define HWPIKOBLX_ISSETTINGS 1
+#define HWPIKOBLX_NUMBYTES 10
+
+// Generic interface functions
+int32_t HwPikoBLXInitialize();
+UAVObjHandle HwPikoBLXHandle();
+void HwPikoBLXSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t Uart1;
+    uint8_t Uart2;
+    uint8_t RxPort;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t GyroLPF;
+    uint8_t AccelLPF;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwPikoBLXData;
+
+// Typesafe Object access functions
+/**
+ * @function HwPikoBLXGet(dataOut)
+ * @brief Populate a HwPikoBLXData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwPikoBLXGet(HwPikoBLXData *dataOut) { return UAVObjGetData(HwPikoBLXHandle(), dataOut); }
+
+static inline int32_t HwPikoBLXSet(const HwPikoBLXData *dataIn) { return UAVObjSetData(HwPikoBLXHandle(), dataIn); }
+
+static inline int32_t HwPikoBLXInstGet(uint16_t instId, HwPikoBLXData *dataOut) { return UAVObjGetInstanceData(HwPikoBLXHandle(), instId, dataOut); }
+
+static inline int32_t HwPikoBLXInstSet(uint16_t instId, const HwPikoBLXData *dataIn) { return UAVObjSetInstanceData(HwPikoBLXHandle(), instId, dataIn); }
+
+static inline int32_t HwPikoBLXConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwPikoBLXHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPikoBLXConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwPikoBLXHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPikoBLXConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwPikoBLXHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPikoBLXConnectCopy(volatile HwPikoBLXData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwPikoBLXGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwPikoBLXHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwPikoBLXCreateInstance() { return UAVObjCreateInstance(HwPikoBLXHandle(), &HwPikoBLXSetDefaults); }
+
+static inline void HwPikoBLXUpdated() { UAVObjUpdated(HwPikoBLXHandle()); }
+
+static inline void HwPikoBLXInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwPikoBLXHandle(), instId); }
+
+static inline int32_t HwPikoBLXGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwPikoBLXHandle(), dataOut); }
+
+static inline int32_t HwPikoBLXSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwPikoBLXHandle(), dataIn); }
+
+static inline int8_t HwPikoBLXReadOnly() { return UAVObjReadOnly(HwPikoBLXHandle()); }
+
+static inline uint16_t HwPikoBLXGetNumInstances(){ return UAVObjGetNumInstances(HwPikoBLXHandle()); }
+
+static inline uint32_t HwPikoBLXGetNumBytes(){ return UAVObjGetNumBytes(HwPikoBLXHandle()); }
+
+// Field information
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWPIKOBLX_UART1_DISABLED=0, HWPIKOBLX_UART1_COMBRIDGE=9, HWPIKOBLX_UART1_DEBUGCONSOLE=8, HWPIKOBLX_UART1_DSM=3, HWPIKOBLX_UART1_FRSKYSENSORHUB=16, HWPIKOBLX_UART1_FRSKYSPORTTELEMETRY=17, HWPIKOBLX_UART1_FRSKYSPORTNONINVERTED=18, HWPIKOBLX_UART1_GPS=2, HWPIKOBLX_UART1_HOTTTELEMETRY=15, HWPIKOBLX_UART1_I2C=24, HWPIKOBLX_UART1_LIGHTTELEMETRYTX=19, HWPIKOBLX_UART1_SRXL=6, HWPIKOBLX_UART1_MAVLINKTX=10, HWPIKOBLX_UART1_MAVLINKTX_GPS_RX=11, HWPIKOBLX_UART1_MSP=12, HWPIKOBLX_UART1_SBUS=4, HWPIKOBLX_UART1_SBUSNONINVERTED=5, HWPIKOBLX_UART1_STORM32BGC=21, HWPIKOBLX_UART1_TELEMETRY=1, HWPIKOBLX_UART1_OPENLOG=20, HWPIKOBLX_UART1_HOTTSUMD=13, HWPIKOBLX_UART1_HOTTSUMH=14, HWPIKOBLX_UART1_IBUS=7, HWPIKOBLX_UART1_TBSCROSSFIRE=23, HWPIKOBLX_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXUart1Options;
+#define HWPIKOBLX_UART1_GLOBAL_MAXOPTVAL 26
+#define HWPIKOBLX_UART1_MAXOPTVAL 24
+static inline bool HwPikoBLXUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 <= HWPIKOBLX_UART1_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWPIKOBLX_UART2_DISABLED=0, HWPIKOBLX_UART2_COMBRIDGE=9, HWPIKOBLX_UART2_DEBUGCONSOLE=8, HWPIKOBLX_UART2_DSM=3, HWPIKOBLX_UART2_FRSKYSENSORHUB=16, HWPIKOBLX_UART2_FRSKYSPORTTELEMETRY=17, HWPIKOBLX_UART2_FRSKYSPORTNONINVERTED=18, HWPIKOBLX_UART2_GPS=2, HWPIKOBLX_UART2_HOTTTELEMETRY=15, HWPIKOBLX_UART2_LIGHTTELEMETRYTX=19, HWPIKOBLX_UART2_SRXL=6, HWPIKOBLX_UART2_MAVLINKTX=10, HWPIKOBLX_UART2_MAVLINKTX_GPS_RX=11, HWPIKOBLX_UART2_MSP=12, HWPIKOBLX_UART2_SBUS=4, HWPIKOBLX_UART2_SBUSNONINVERTED=5, HWPIKOBLX_UART2_STORM32BGC=21, HWPIKOBLX_UART2_TELEMETRY=1, HWPIKOBLX_UART2_OPENLOG=20, HWPIKOBLX_UART2_HOTTSUMD=13, HWPIKOBLX_UART2_HOTTSUMH=14, HWPIKOBLX_UART2_IBUS=7, HWPIKOBLX_UART2_TBSCROSSFIRE=23, HWPIKOBLX_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXUart2Options;
+#define HWPIKOBLX_UART2_GLOBAL_MAXOPTVAL 26
+#define HWPIKOBLX_UART2_MAXOPTVAL 23
+static inline bool HwPikoBLXUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 <= HWPIKOBLX_UART2_MAXOPTVAL; }
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWPIKOBLX_RXPORT_DISABLED=0, HWPIKOBLX_RXPORT_PPM=25, HWPIKOBLX_RXPORT_DSM=3, HWPIKOBLX_RXPORT_SRXL=6, HWPIKOBLX_RXPORT_SBUS=4, HWPIKOBLX_RXPORT_SBUSNONINVERTED=5, HWPIKOBLX_RXPORT_HOTTSUMD=13, HWPIKOBLX_RXPORT_HOTTSUMH=14, HWPIKOBLX_RXPORT_IBUS=7, HWPIKOBLX_RXPORT_TBSCROSSFIRE=23, HWPIKOBLX_RXPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXRxPortOptions;
+#define HWPIKOBLX_RXPORT_GLOBAL_MAXOPTVAL 26
+#define HWPIKOBLX_RXPORT_MAXOPTVAL 25
+static inline bool HwPikoBLXRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort <= HWPIKOBLX_RXPORT_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWPIKOBLX_USB_HIDPORT_USBTELEMETRY=0, HWPIKOBLX_USB_HIDPORT_DISABLED=1, HWPIKOBLX_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXUSB_HIDPortOptions;
+#define HWPIKOBLX_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWPIKOBLX_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwPikoBLXUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWPIKOBLX_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWPIKOBLX_USB_VCPPORT_USBTELEMETRY=0, HWPIKOBLX_USB_VCPPORT_COMBRIDGE=1, HWPIKOBLX_USB_VCPPORT_DEBUGCONSOLE=2, HWPIKOBLX_USB_VCPPORT_MSP=3, HWPIKOBLX_USB_VCPPORT_DISABLED=4, HWPIKOBLX_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXUSB_VCPPortOptions;
+#define HWPIKOBLX_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWPIKOBLX_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwPikoBLXUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWPIKOBLX_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWPIKOBLX_DSMXMODE_AUTODETECT=0, HWPIKOBLX_DSMXMODE_FORCE10BIT=1, HWPIKOBLX_DSMXMODE_FORCE11BIT=2, HWPIKOBLX_DSMXMODE_BIND3PULSES=3, HWPIKOBLX_DSMXMODE_BIND4PULSES=4, HWPIKOBLX_DSMXMODE_BIND5PULSES=5, HWPIKOBLX_DSMXMODE_BIND6PULSES=6, HWPIKOBLX_DSMXMODE_BIND7PULSES=7, HWPIKOBLX_DSMXMODE_BIND8PULSES=8, HWPIKOBLX_DSMXMODE_BIND9PULSES=9, HWPIKOBLX_DSMXMODE_BIND10PULSES=10, HWPIKOBLX_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPikoBLXDSMxModeOptions;
+#define HWPIKOBLX_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWPIKOBLX_DSMXMODE_MAXOPTVAL 10
+static inline bool HwPikoBLXDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWPIKOBLX_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWPIKOBLX_GYRORANGE_250=0, HWPIKOBLX_GYRORANGE_500=1, HWPIKOBLX_GYRORANGE_1000=2, HWPIKOBLX_GYRORANGE_2000=3 }  __attribute__((packed)) HwPikoBLXGyroRangeOptions;
+#define HWPIKOBLX_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWPIKOBLX_GYRORANGE_MAXOPTVAL 3
+static inline bool HwPikoBLXGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWPIKOBLX_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWPIKOBLX_ACCELRANGE_2G=0, HWPIKOBLX_ACCELRANGE_4G=1, HWPIKOBLX_ACCELRANGE_8G=2, HWPIKOBLX_ACCELRANGE_16G=3 }  __attribute__((packed)) HwPikoBLXAccelRangeOptions;
+#define HWPIKOBLX_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWPIKOBLX_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwPikoBLXAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWPIKOBLX_ACCELRANGE_MAXOPTVAL; }
+// Field GyroLPF information
+/* Enumeration options for field GyroLPF */
+typedef enum { HWPIKOBLX_GYROLPF_188=0, HWPIKOBLX_GYROLPF_98=1, HWPIKOBLX_GYROLPF_42=2, HWPIKOBLX_GYROLPF_20=3, HWPIKOBLX_GYROLPF_10=4, HWPIKOBLX_GYROLPF_5=5 }  __attribute__((packed)) HwPikoBLXGyroLPFOptions;
+#define HWPIKOBLX_GYROLPF_GLOBAL_MAXOPTVAL 5
+#define HWPIKOBLX_GYROLPF_MAXOPTVAL 5
+static inline bool HwPikoBLXGyroLPFIsValid( uint8_t CurrentGyroLPF ) { return CurrentGyroLPF <= HWPIKOBLX_GYROLPF_MAXOPTVAL; }
+// Field AccelLPF information
+/* Enumeration options for field AccelLPF */
+typedef enum { HWPIKOBLX_ACCELLPF_218=0, HWPIKOBLX_ACCELLPF_99=1, HWPIKOBLX_ACCELLPF_45=2, HWPIKOBLX_ACCELLPF_21=3, HWPIKOBLX_ACCELLPF_10=4, HWPIKOBLX_ACCELLPF_5=5 }  __attribute__((packed)) HwPikoBLXAccelLPFOptions;
+#define HWPIKOBLX_ACCELLPF_GLOBAL_MAXOPTVAL 5
+#define HWPIKOBLX_ACCELLPF_MAXOPTVAL 5
+static inline bool HwPikoBLXAccelLPFIsValid( uint8_t CurrentAccelLPF ) { return CurrentAccelLPF <= HWPIKOBLX_ACCELLPF_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwPikoBLXUart1Set( uint8_t *NewUart1 );
+extern void HwPikoBLXUart1Get( uint8_t *NewUart1 );
+extern void HwPikoBLXUart2Set( uint8_t *NewUart2 );
+extern void HwPikoBLXUart2Get( uint8_t *NewUart2 );
+extern void HwPikoBLXRxPortSet( uint8_t *NewRxPort );
+extern void HwPikoBLXRxPortGet( uint8_t *NewRxPort );
+extern void HwPikoBLXUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwPikoBLXUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwPikoBLXUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwPikoBLXUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwPikoBLXDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwPikoBLXDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwPikoBLXGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwPikoBLXGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwPikoBLXAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwPikoBLXAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwPikoBLXGyroLPFSet( uint8_t *NewGyroLPF );
+extern void HwPikoBLXGyroLPFGet( uint8_t *NewGyroLPF );
+extern void HwPikoBLXAccelLPFSet( uint8_t *NewAccelLPF );
+extern void HwPikoBLXAccelLPFGet( uint8_t *NewAccelLPF );
+
+
+#endif // HWPIKOBLX_H
+
+/**
+ * @}
+ * @}
+ */
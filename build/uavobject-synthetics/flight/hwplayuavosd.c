@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwplayuavosd.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwPlayUavOsd object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwplayuavosd.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwplayuavosd.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwPlayUavOsdData defaultData = {
+	.MainPort = 12,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwPlayUavOsdInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWPLAYUAVOSD_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWPLAYUAVOSD_OBJID,
+			HWPLAYUAVOSD_ISSINGLEINST, HWPLAYUAVOSD_ISSETTINGS, HWPLAYUAVOSD_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwPlayUavOsdSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwPlayUavOsdData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwPlayUavOsdSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwPlayUavOsdSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwPlayUavOsdSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwPlayUavOsdSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwPlayUavOsdHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwPlayUavOsdMainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwPlayUavOsdHandle(), (void*)NewMainPort, offsetof( HwPlayUavOsdData, MainPort), sizeof(uint8_t));
+}
+void HwPlayUavOsdMainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwPlayUavOsdHandle(), (void*)NewMainPort, offsetof( HwPlayUavOsdData, MainPort), sizeof(uint8_t));
+}
+void HwPlayUavOsdUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwPlayUavOsdHandle(), (void*)NewUSB_HIDPort, offsetof( HwPlayUavOsdData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwPlayUavOsdUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwPlayUavOsdHandle(), (void*)NewUSB_HIDPort, offsetof( HwPlayUavOsdData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwPlayUavOsdUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwPlayUavOsdHandle(), (void*)NewUSB_VCPPort, offsetof( HwPlayUavOsdData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwPlayUavOsdUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwPlayUavOsdHandle(), (void*)NewUSB_VCPPort, offsetof( HwPlayUavOsdData, USB_VCPPort), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwPlayUavOsd HwPlayUavOsd
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwplayuavosd.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwPlayUavOsd object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwplayuavosd.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWPLAYUAVOSD_H
+#define HWPLAYUAVOSD_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWPLAYUAVOSD_OBJID 0x113CFB60
+#define HWPLAYUAVOSD_ISSINGLEINST 1
+#define HWPLAYUAVOSD_ISSETTINGS 1
+#define HWPLAYUAVOSD_NUMBYTES 3
+
+// Generic interface functions
+int32_t HwPlayUavOsdInitialize();
+UAVObjHandle HwPlayUavOsdHandle();
+void HwPlayUavOsdSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t MainPort;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwPlayUavOsdData;
+
+// Typesafe Object access functions
+/**
+ * @function HwPlayUavOsdGet(dataOut)
+ * @brief Populate a HwPlayUavOsdData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwPlayUavOsdGet(HwPlayUavOsdData *dataOut) { return UAVObjGetData(HwPlayUavOsdHandle(), dataOut); }
+
+static inline int32_t HwPlayUavOsdSet(const HwPlayUavOsdData *dataIn) { return UAVObjSetData(HwPlayUavOsdHandle(), dataIn); }
+
+static inline int32_t HwPlayUavOsdInstGet(uint16_t instId, HwPlayUavOsdData *dataOut) { return UAVObjGetInstanceData(HwPlayUavOsdHandle(), instId, dataOut); }
+
+static inline int32_t HwPlayUavOsdInstSet(uint16_t instId, const HwPlayUavOsdData *dataIn) { return UAVObjSetInstanceData(HwPlayUavOsdHandle(), instId, dataIn); }
+
+static inline int32_t HwPlayUavOsdConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwPlayUavOsdHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPlayUavOsdConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwPlayUavOsdHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPlayUavOsdConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwPlayUavOsdHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwPlayUavOsdConnectCopy(volatile HwPlayUavOsdData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwPlayUavOsdGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwPlayUavOsdHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwPlayUavOsdCreateInstance() { return UAVObjCreateInstance(HwPlayUavOsdHandle(), &HwPlayUavOsdSetDefaults); }
+
+static inline void HwPlayUavOsdUpdated() { UAVObjUpdated(HwPlayUavOsdHandle()); }
+
+static inline void HwPlayUavOsdInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwPlayUavOsdHandle(), instId); }
+
+static inline int32_t HwPlayUavOsdGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwPlayUavOsdHandle(), dataOut); }
+
+static inline int32_t HwPlayUavOsdSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwPlayUavOsdHandle(), dataIn); }
+
+static inline int8_t HwPlayUavOsdReadOnly() { return UAVObjReadOnly(HwPlayUavOsdHandle()); }
+
+static inline uint16_t HwPlayUavOsdGetNumInstances(){ return UAVObjGetNumInstances(HwPlayUavOsdHandle()); }
+
+static inline uint32_t HwPlayUavOsdGetNumBytes(){ return UAVObjGetNumBytes(HwPlayUavOsdHandle()); }
+
+// Field information
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWPLAYUAVOSD_MAINPORT_DISABLED=0, HWPLAYUAVOSD_MAINPORT_COMBRIDGE=9, HWPLAYUAVOSD_MAINPORT_DEBUGCONSOLE=8, HWPLAYUAVOSD_MAINPORT_TELEMETRY=1, HWPLAYUAVOSD_MAINPORT_MSP=12, HWPLAYUAVOSD_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPlayUavOsdMainPortOptions;
+#define HWPLAYUAVOSD_MAINPORT_GLOBAL_MAXOPTVAL 26
+#define HWPLAYUAVOSD_MAINPORT_MAXOPTVAL 12
+static inline bool HwPlayUavOsdMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort <= HWPLAYUAVOSD_MAINPORT_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWPLAYUAVOSD_USB_HIDPORT_USBTELEMETRY=0, HWPLAYUAVOSD_USB_HIDPORT_RCTRANSMITTER=1, HWPLAYUAVOSD_USB_HIDPORT_DISABLED=2 }  __attribute__((packed)) HwPlayUavOsdUSB_HIDPortOptions;
+#define HWPLAYUAVOSD_USB_HIDPORT_GLOBAL_MAXOPTVAL 2
+#define HWPLAYUAVOSD_USB_HIDPORT_MAXOPTVAL 2
+static inline bool HwPlayUavOsdUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWPLAYUAVOSD_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWPLAYUAVOSD_USB_VCPPORT_USBTELEMETRY=0, HWPLAYUAVOSD_USB_VCPPORT_COMBRIDGE=1, HWPLAYUAVOSD_USB_VCPPORT_DEBUGCONSOLE=2, HWPLAYUAVOSD_USB_VCPPORT_DISABLED=4, HWPLAYUAVOSD_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwPlayUavOsdUSB_VCPPortOptions;
+#define HWPLAYUAVOSD_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWPLAYUAVOSD_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwPlayUavOsdUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWPLAYUAVOSD_USB_VCPPORT_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwPlayUavOsdMainPortSet( uint8_t *NewMainPort );
+extern void HwPlayUavOsdMainPortGet( uint8_t *NewMainPort );
+extern void HwPlayUavOsdUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwPlayUavOsdUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwPlayUavOsdUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwPlayUavOsdUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+
+
+#endif // HWPLAYUAVOSD_H
+
+/**
+ * @}
+ * @}
+ */
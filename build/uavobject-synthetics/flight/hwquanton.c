@@ -0,0 +1,280 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwquanton.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwQuanton object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwquanton.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwquanton.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwQuantonData defaultData = {
+	.InPort = 12,
+	.InPortSerial = 0,
+	.Uart1 = 0,
+	.Uart2 = 0,
+	.Uart3 = 0,
+	.Uart4 = 1,
+	.Uart5 = 2,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.GyroRange = 2,
+	.AccelRange = 2,
+	.MPU6000DLPF = 0,
+	.Magnetometer = 1,
+	.ExtMagOrientation = 0,
+	.ExtMagPort = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwQuantonInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWQUANTON_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWQUANTON_OBJID,
+			HWQUANTON_ISSINGLEINST, HWQUANTON_ISSETTINGS, HWQUANTON_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwQuantonSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwQuantonData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwQuantonSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwQuantonSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwQuantonSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwQuantonSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwQuantonHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwQuantonInPortSet( uint8_t *NewInPort )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewInPort, offsetof( HwQuantonData, InPort), sizeof(uint8_t));
+}
+void HwQuantonInPortGet( uint8_t *NewInPort )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewInPort, offsetof( HwQuantonData, InPort), sizeof(uint8_t));
+}
+void HwQuantonInPortSerialSet( uint8_t *NewInPortSerial )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewInPortSerial, offsetof( HwQuantonData, InPortSerial), sizeof(uint8_t));
+}
+void HwQuantonInPortSerialGet( uint8_t *NewInPortSerial )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewInPortSerial, offsetof( HwQuantonData, InPortSerial), sizeof(uint8_t));
+}
+void HwQuantonUart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUart1, offsetof( HwQuantonData, Uart1), sizeof(uint8_t));
+}
+void HwQuantonUart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUart1, offsetof( HwQuantonData, Uart1), sizeof(uint8_t));
+}
+void HwQuantonUart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUart2, offsetof( HwQuantonData, Uart2), sizeof(uint8_t));
+}
+void HwQuantonUart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUart2, offsetof( HwQuantonData, Uart2), sizeof(uint8_t));
+}
+void HwQuantonUart3Set( uint8_t *NewUart3 )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUart3, offsetof( HwQuantonData, Uart3), sizeof(uint8_t));
+}
+void HwQuantonUart3Get( uint8_t *NewUart3 )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUart3, offsetof( HwQuantonData, Uart3), sizeof(uint8_t));
+}
+void HwQuantonUart4Set( uint8_t *NewUart4 )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUart4, offsetof( HwQuantonData, Uart4), sizeof(uint8_t));
+}
+void HwQuantonUart4Get( uint8_t *NewUart4 )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUart4, offsetof( HwQuantonData, Uart4), sizeof(uint8_t));
+}
+void HwQuantonUart5Set( uint8_t *NewUart5 )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUart5, offsetof( HwQuantonData, Uart5), sizeof(uint8_t));
+}
+void HwQuantonUart5Get( uint8_t *NewUart5 )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUart5, offsetof( HwQuantonData, Uart5), sizeof(uint8_t));
+}
+void HwQuantonUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUSB_HIDPort, offsetof( HwQuantonData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwQuantonUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUSB_HIDPort, offsetof( HwQuantonData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwQuantonUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewUSB_VCPPort, offsetof( HwQuantonData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwQuantonUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewUSB_VCPPort, offsetof( HwQuantonData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwQuantonDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewDSMxMode, offsetof( HwQuantonData, DSMxMode), sizeof(uint8_t));
+}
+void HwQuantonDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewDSMxMode, offsetof( HwQuantonData, DSMxMode), sizeof(uint8_t));
+}
+void HwQuantonGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewGyroRange, offsetof( HwQuantonData, GyroRange), sizeof(uint8_t));
+}
+void HwQuantonGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewGyroRange, offsetof( HwQuantonData, GyroRange), sizeof(uint8_t));
+}
+void HwQuantonAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewAccelRange, offsetof( HwQuantonData, AccelRange), sizeof(uint8_t));
+}
+void HwQuantonAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewAccelRange, offsetof( HwQuantonData, AccelRange), sizeof(uint8_t));
+}
+void HwQuantonMPU6000DLPFSet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewMPU6000DLPF, offsetof( HwQuantonData, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwQuantonMPU6000DLPFGet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewMPU6000DLPF, offsetof( HwQuantonData, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwQuantonMagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewMagnetometer, offsetof( HwQuantonData, Magnetometer), sizeof(uint8_t));
+}
+void HwQuantonMagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewMagnetometer, offsetof( HwQuantonData, Magnetometer), sizeof(uint8_t));
+}
+void HwQuantonExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewExtMagOrientation, offsetof( HwQuantonData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwQuantonExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewExtMagOrientation, offsetof( HwQuantonData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwQuantonExtMagPortSet( uint8_t *NewExtMagPort )
+{
+	UAVObjSetDataField(HwQuantonHandle(), (void*)NewExtMagPort, offsetof( HwQuantonData, ExtMagPort), sizeof(uint8_t));
+}
+void HwQuantonExtMagPortGet( uint8_t *NewExtMagPort )
+{
+	UAVObjGetDataField(HwQuantonHandle(), (void*)NewExtMagPort, offsetof( HwQuantonData, ExtMagPort), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
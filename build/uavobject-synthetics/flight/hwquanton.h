@@ -0,0 +1,261 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwQuanton HwQuanton
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwquanton.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwQuanton object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwquanton.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWQUANTON_H
+#define HWQUANTON_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWQUANTON_OBJID 0xDA12F84E
+#define HWQUANTON_ISSINGLEINST 1
+#define HWQUANTON_ISSETTINGS 1
+#define HWQUANTON_NUMBYTES 16
+
+// Generic interface functions
+int32_t HwQuantonInitialize();
+UAVObjHandle HwQuantonHandle();
+void HwQuantonSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t InPort;
+    uint8_t InPortSerial;
+    uint8_t Uart1;
+    uint8_t Uart2;
+    uint8_t Uart3;
+    uint8_t Uart4;
+    uint8_t Uart5;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU6000DLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+    uint8_t ExtMagPort;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwQuantonData;
+
+// Typesafe Object access functions
+/**
+ * @function HwQuantonGet(dataOut)
+ * @brief Populate a HwQuantonData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwQuantonGet(HwQuantonData *dataOut) { return UAVObjGetData(HwQuantonHandle(), dataOut); }
+
+static inline int32_t HwQuantonSet(const HwQuantonData *dataIn) { return UAVObjSetData(HwQuantonHandle(), dataIn); }
+
+static inline int32_t HwQuantonInstGet(uint16_t instId, HwQuantonData *dataOut) { return UAVObjGetInstanceData(HwQuantonHandle(), instId, dataOut); }
+
+static inline int32_t HwQuantonInstSet(uint16_t instId, const HwQuantonData *dataIn) { return UAVObjSetInstanceData(HwQuantonHandle(), instId, dataIn); }
+
+static inline int32_t HwQuantonConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwQuantonHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwQuantonHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwQuantonHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCopy(volatile HwQuantonData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwQuantonGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwQuantonHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwQuantonCreateInstance() { return UAVObjCreateInstance(HwQuantonHandle(), &HwQuantonSetDefaults); }
+
+static inline void HwQuantonUpdated() { UAVObjUpdated(HwQuantonHandle()); }
+
+static inline void HwQuantonInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwQuantonHandle(), instId); }
+
+static inline int32_t HwQuantonGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwQuantonHandle(), dataOut); }
+
+static inline int32_t HwQuantonSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwQuantonHandle(), dataIn); }
+
+static inline int8_t HwQuantonReadOnly() { return UAVObjReadOnly(HwQuantonHandle()); }
+
+static inline uint16_t HwQuantonGetNumInstances(){ return UAVObjGetNumInstances(HwQuantonHandle()); }
+
+static inline uint32_t HwQuantonGetNumBytes(){ return UAVObjGetNumBytes(HwQuantonHandle()); }
+
+// Field information
+// Field InPort information
+/* Enumeration options for field InPort */
+typedef enum { HWQUANTON_INPORT_DISABLED=0, HWQUANTON_INPORT_OUTPUTS=1, HWQUANTON_INPORT_OUTPUTSADC=2, HWQUANTON_INPORT_WS2811SERIALPPMADC=3, HWQUANTON_INPORT_PPM=4, HWQUANTON_INPORT_PPMADC=5, HWQUANTON_INPORT_PPMOUTPUTS=6, HWQUANTON_INPORT_PPMOUTPUTSADC=7, HWQUANTON_INPORT_PPMSERIAL=8, HWQUANTON_INPORT_PPMSERIALADC=9, HWQUANTON_INPORT_PPMPWM=10, HWQUANTON_INPORT_PPMPWMADC=11, HWQUANTON_INPORT_PWM=12, HWQUANTON_INPORT_PWMADC=13, HWQUANTON_INPORT_SERIAL=14 }  __attribute__((packed)) HwQuantonInPortOptions;
+#define HWQUANTON_INPORT_GLOBAL_MAXOPTVAL 14
+#define HWQUANTON_INPORT_MAXOPTVAL 14
+static inline bool HwQuantonInPortIsValid( uint8_t CurrentInPort ) { return CurrentInPort <= HWQUANTON_INPORT_MAXOPTVAL; }
+// Field InPortSerial information
+/* Enumeration options for field InPortSerial */
+typedef enum { HWQUANTON_INPORTSERIAL_DISABLED=0, HWQUANTON_INPORTSERIAL_COMBRIDGE=9, HWQUANTON_INPORTSERIAL_DEBUGCONSOLE=8, HWQUANTON_INPORTSERIAL_DSM=3, HWQUANTON_INPORTSERIAL_FRSKYSENSORHUB=16, HWQUANTON_INPORTSERIAL_FRSKYSPORTTELEMETRY=17, HWQUANTON_INPORTSERIAL_FRSKYSPORTNONINVERTED=18, HWQUANTON_INPORTSERIAL_GPS=2, HWQUANTON_INPORTSERIAL_SRXL=6, HWQUANTON_INPORTSERIAL_HOTTSUMD=13, HWQUANTON_INPORTSERIAL_HOTTSUMH=14, HWQUANTON_INPORTSERIAL_HOTTTELEMETRY=15, HWQUANTON_INPORTSERIAL_LIGHTTELEMETRYTX=19, HWQUANTON_INPORTSERIAL_MAVLINKTX=10, HWQUANTON_INPORTSERIAL_MAVLINKTX_GPS_RX=11, HWQUANTON_INPORTSERIAL_MSP=12, HWQUANTON_INPORTSERIAL_OPENLOG=20, HWQUANTON_INPORTSERIAL_SBUSNONINVERTED=5, HWQUANTON_INPORTSERIAL_STORM32BGC=21, HWQUANTON_INPORTSERIAL_TELEMETRY=1, HWQUANTON_INPORTSERIAL_IBUS=7, HWQUANTON_INPORTSERIAL_TBSCROSSFIRE=23, HWQUANTON_INPORTSERIAL_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonInPortSerialOptions;
+#define HWQUANTON_INPORTSERIAL_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_INPORTSERIAL_MAXOPTVAL 23
+static inline bool HwQuantonInPortSerialIsValid( uint8_t CurrentInPortSerial ) { return CurrentInPortSerial <= HWQUANTON_INPORTSERIAL_MAXOPTVAL; }
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWQUANTON_UART1_DISABLED=0, HWQUANTON_UART1_COMBRIDGE=9, HWQUANTON_UART1_DEBUGCONSOLE=8, HWQUANTON_UART1_DSM=3, HWQUANTON_UART1_FRSKYSENSORHUB=16, HWQUANTON_UART1_FRSKYSPORTTELEMETRY=17, HWQUANTON_UART1_FRSKYSPORTNONINVERTED=18, HWQUANTON_UART1_GPS=2, HWQUANTON_UART1_SRXL=6, HWQUANTON_UART1_HOTTSUMD=13, HWQUANTON_UART1_HOTTSUMH=14, HWQUANTON_UART1_HOTTTELEMETRY=15, HWQUANTON_UART1_I2C=24, HWQUANTON_UART1_LIGHTTELEMETRYTX=19, HWQUANTON_UART1_MAVLINKTX=10, HWQUANTON_UART1_MAVLINKTX_GPS_RX=11, HWQUANTON_UART1_MSP=12, HWQUANTON_UART1_OPENLOG=20, HWQUANTON_UART1_SBUSNONINVERTED=5, HWQUANTON_UART1_STORM32BGC=21, HWQUANTON_UART1_TELEMETRY=1, HWQUANTON_UART1_IBUS=7, HWQUANTON_UART1_TBSCROSSFIRE=23, HWQUANTON_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart1Options;
+#define HWQUANTON_UART1_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_UART1_MAXOPTVAL 24
+static inline bool HwQuantonUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 <= HWQUANTON_UART1_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWQUANTON_UART2_DISABLED=0, HWQUANTON_UART2_COMBRIDGE=9, HWQUANTON_UART2_DEBUGCONSOLE=8, HWQUANTON_UART2_DSM=3, HWQUANTON_UART2_FRSKYSENSORHUB=16, HWQUANTON_UART2_FRSKYSPORTTELEMETRY=17, HWQUANTON_UART2_FRSKYSPORTNONINVERTED=18, HWQUANTON_UART2_GPS=2, HWQUANTON_UART2_SRXL=6, HWQUANTON_UART2_HOTTSUMD=13, HWQUANTON_UART2_HOTTSUMH=14, HWQUANTON_UART2_HOTTTELEMETRY=15, HWQUANTON_UART2_LIGHTTELEMETRYTX=19, HWQUANTON_UART2_MAVLINKTX=10, HWQUANTON_UART2_MAVLINKTX_GPS_RX=11, HWQUANTON_UART2_MSP=12, HWQUANTON_UART2_OPENLOG=20, HWQUANTON_UART2_SBUS=4, HWQUANTON_UART2_SBUSNONINVERTED=5, HWQUANTON_UART2_STORM32BGC=21, HWQUANTON_UART2_TELEMETRY=1, HWQUANTON_UART2_IBUS=7, HWQUANTON_UART2_TBSCROSSFIRE=23, HWQUANTON_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart2Options;
+#define HWQUANTON_UART2_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_UART2_MAXOPTVAL 23
+static inline bool HwQuantonUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 <= HWQUANTON_UART2_MAXOPTVAL; }
+// Field Uart3 information
+/* Enumeration options for field Uart3 */
+typedef enum { HWQUANTON_UART3_DISABLED=0, HWQUANTON_UART3_COMBRIDGE=9, HWQUANTON_UART3_DEBUGCONSOLE=8, HWQUANTON_UART3_DSM=3, HWQUANTON_UART3_FRSKYSENSORHUB=16, HWQUANTON_UART3_FRSKYSPORTTELEMETRY=17, HWQUANTON_UART3_FRSKYSPORTNONINVERTED=18, HWQUANTON_UART3_GPS=2, HWQUANTON_UART3_SRXL=6, HWQUANTON_UART3_HOTTSUMD=13, HWQUANTON_UART3_HOTTSUMH=14, HWQUANTON_UART3_HOTTTELEMETRY=15, HWQUANTON_UART3_I2C=24, HWQUANTON_UART3_LIGHTTELEMETRYTX=19, HWQUANTON_UART3_MAVLINKTX=10, HWQUANTON_UART3_MAVLINKTX_GPS_RX=11, HWQUANTON_UART3_MSP=12, HWQUANTON_UART3_OPENLOG=20, HWQUANTON_UART3_SBUSNONINVERTED=5, HWQUANTON_UART3_STORM32BGC=21, HWQUANTON_UART3_TELEMETRY=1, HWQUANTON_UART3_IBUS=7, HWQUANTON_UART3_TBSCROSSFIRE=23, HWQUANTON_UART3_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart3Options;
+#define HWQUANTON_UART3_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_UART3_MAXOPTVAL 24
+static inline bool HwQuantonUart3IsValid( uint8_t CurrentUart3 ) { return CurrentUart3 <= HWQUANTON_UART3_MAXOPTVAL; }
+// Field Uart4 information
+/* Enumeration options for field Uart4 */
+typedef enum { HWQUANTON_UART4_DISABLED=0, HWQUANTON_UART4_COMBRIDGE=9, HWQUANTON_UART4_DEBUGCONSOLE=8, HWQUANTON_UART4_DSM=3, HWQUANTON_UART4_FRSKYSENSORHUB=16, HWQUANTON_UART4_FRSKYSPORTTELEMETRY=17, HWQUANTON_UART4_FRSKYSPORTNONINVERTED=18, HWQUANTON_UART4_GPS=2, HWQUANTON_UART4_SRXL=6, HWQUANTON_UART4_HOTTSUMD=13, HWQUANTON_UART4_HOTTSUMH=14, HWQUANTON_UART4_HOTTTELEMETRY=15, HWQUANTON_UART4_LIGHTTELEMETRYTX=19, HWQUANTON_UART4_MAVLINKTX=10, HWQUANTON_UART4_MAVLINKTX_GPS_RX=11, HWQUANTON_UART4_MSP=12, HWQUANTON_UART4_OPENLOG=20, HWQUANTON_UART4_SBUSNONINVERTED=5, HWQUANTON_UART4_STORM32BGC=21, HWQUANTON_UART4_TELEMETRY=1, HWQUANTON_UART4_IBUS=7, HWQUANTON_UART4_TBSCROSSFIRE=23, HWQUANTON_UART4_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart4Options;
+#define HWQUANTON_UART4_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_UART4_MAXOPTVAL 23
+static inline bool HwQuantonUart4IsValid( uint8_t CurrentUart4 ) { return CurrentUart4 <= HWQUANTON_UART4_MAXOPTVAL; }
+// Field Uart5 information
+/* Enumeration options for field Uart5 */
+typedef enum { HWQUANTON_UART5_DISABLED=0, HWQUANTON_UART5_COMBRIDGE=9, HWQUANTON_UART5_DEBUGCONSOLE=8, HWQUANTON_UART5_DSM=3, HWQUANTON_UART5_FRSKYSENSORHUB=16, HWQUANTON_UART5_FRSKYSPORTTELEMETRY=17, HWQUANTON_UART5_FRSKYSPORTNONINVERTED=18, HWQUANTON_UART5_GPS=2, HWQUANTON_UART5_SRXL=6, HWQUANTON_UART5_HOTTSUMD=13, HWQUANTON_UART5_HOTTSUMH=14, HWQUANTON_UART5_HOTTTELEMETRY=15, HWQUANTON_UART5_LIGHTTELEMETRYTX=19, HWQUANTON_UART5_MAVLINKTX=10, HWQUANTON_UART5_MAVLINKTX_GPS_RX=11, HWQUANTON_UART5_MSP=12, HWQUANTON_UART5_OPENLOG=20, HWQUANTON_UART5_SBUSNONINVERTED=5, HWQUANTON_UART5_STORM32BGC=21, HWQUANTON_UART5_TELEMETRY=1, HWQUANTON_UART5_IBUS=7, HWQUANTON_UART5_TBSCROSSFIRE=23, HWQUANTON_UART5_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart5Options;
+#define HWQUANTON_UART5_GLOBAL_MAXOPTVAL 26
+#define HWQUANTON_UART5_MAXOPTVAL 23
+static inline bool HwQuantonUart5IsValid( uint8_t CurrentUart5 ) { return CurrentUart5 <= HWQUANTON_UART5_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWQUANTON_USB_HIDPORT_USBTELEMETRY=0, HWQUANTON_USB_HIDPORT_DISABLED=1, HWQUANTON_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUSB_HIDPortOptions;
+#define HWQUANTON_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWQUANTON_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwQuantonUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWQUANTON_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWQUANTON_USB_VCPPORT_USBTELEMETRY=0, HWQUANTON_USB_VCPPORT_COMBRIDGE=1, HWQUANTON_USB_VCPPORT_DEBUGCONSOLE=2, HWQUANTON_USB_VCPPORT_MSP=3, HWQUANTON_USB_VCPPORT_DISABLED=4, HWQUANTON_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUSB_VCPPortOptions;
+#define HWQUANTON_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWQUANTON_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwQuantonUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWQUANTON_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWQUANTON_DSMXMODE_AUTODETECT=0, HWQUANTON_DSMXMODE_FORCE10BIT=1, HWQUANTON_DSMXMODE_FORCE11BIT=2, HWQUANTON_DSMXMODE_BIND3PULSES=3, HWQUANTON_DSMXMODE_BIND4PULSES=4, HWQUANTON_DSMXMODE_BIND5PULSES=5, HWQUANTON_DSMXMODE_BIND6PULSES=6, HWQUANTON_DSMXMODE_BIND7PULSES=7, HWQUANTON_DSMXMODE_BIND8PULSES=8, HWQUANTON_DSMXMODE_BIND9PULSES=9, HWQUANTON_DSMXMODE_BIND10PULSES=10, HWQUANTON_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonDSMxModeOptions;
+#define HWQUANTON_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWQUANTON_DSMXMODE_MAXOPTVAL 10
+static inline bool HwQuantonDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWQUANTON_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWQUANTON_GYRORANGE_250=0, HWQUANTON_GYRORANGE_500=1, HWQUANTON_GYRORANGE_1000=2, HWQUANTON_GYRORANGE_2000=3 }  __attribute__((packed)) HwQuantonGyroRangeOptions;
+#define HWQUANTON_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWQUANTON_GYRORANGE_MAXOPTVAL 3
+static inline bool HwQuantonGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWQUANTON_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWQUANTON_ACCELRANGE_2G=0, HWQUANTON_ACCELRANGE_4G=1, HWQUANTON_ACCELRANGE_8G=2, HWQUANTON_ACCELRANGE_16G=3 }  __attribute__((packed)) HwQuantonAccelRangeOptions;
+#define HWQUANTON_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWQUANTON_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwQuantonAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWQUANTON_ACCELRANGE_MAXOPTVAL; }
+// Field MPU6000DLPF information
+/* Enumeration options for field MPU6000DLPF */
+typedef enum { HWQUANTON_MPU6000DLPF_188=0, HWQUANTON_MPU6000DLPF_98=1, HWQUANTON_MPU6000DLPF_42=2, HWQUANTON_MPU6000DLPF_20=3, HWQUANTON_MPU6000DLPF_10=4, HWQUANTON_MPU6000DLPF_5=5 }  __attribute__((packed)) HwQuantonMPU6000DLPFOptions;
+#define HWQUANTON_MPU6000DLPF_GLOBAL_MAXOPTVAL 5
+#define HWQUANTON_MPU6000DLPF_MAXOPTVAL 5
+static inline bool HwQuantonMPU6000DLPFIsValid( uint8_t CurrentMPU6000DLPF ) { return CurrentMPU6000DLPF <= HWQUANTON_MPU6000DLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWQUANTON_MAGNETOMETER_NONE=0, HWQUANTON_MAGNETOMETER_INTERNAL=1, HWQUANTON_MAGNETOMETER_EXTERNALHMC5883=2, HWQUANTON_MAGNETOMETER_EXTERNALHMC5983=3, HWQUANTON_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonMagnetometerOptions;
+#define HWQUANTON_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWQUANTON_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwQuantonMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWQUANTON_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWQUANTON_EXTMAGORIENTATION_TOP0DEGCW=0, HWQUANTON_EXTMAGORIENTATION_TOP90DEGCW=1, HWQUANTON_EXTMAGORIENTATION_TOP180DEGCW=2, HWQUANTON_EXTMAGORIENTATION_TOP270DEGCW=3, HWQUANTON_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWQUANTON_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWQUANTON_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWQUANTON_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWQUANTON_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonExtMagOrientationOptions;
+#define HWQUANTON_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWQUANTON_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwQuantonExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWQUANTON_EXTMAGORIENTATION_MAXOPTVAL; }
+// Field ExtMagPort information
+/* Enumeration options for field ExtMagPort */
+typedef enum { HWQUANTON_EXTMAGPORT_UART1=0, HWQUANTON_EXTMAGPORT_UART3=1 }  __attribute__((packed)) HwQuantonExtMagPortOptions;
+#define HWQUANTON_EXTMAGPORT_GLOBAL_MAXOPTVAL 1
+#define HWQUANTON_EXTMAGPORT_MAXOPTVAL 1
+static inline bool HwQuantonExtMagPortIsValid( uint8_t CurrentExtMagPort ) { return CurrentExtMagPort <= HWQUANTON_EXTMAGPORT_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwQuantonInPortSet( uint8_t *NewInPort );
+extern void HwQuantonInPortGet( uint8_t *NewInPort );
+extern void HwQuantonInPortSerialSet( uint8_t *NewInPortSerial );
+extern void HwQuantonInPortSerialGet( uint8_t *NewInPortSerial );
+extern void HwQuantonUart1Set( uint8_t *NewUart1 );
+extern void HwQuantonUart1Get( uint8_t *NewUart1 );
+extern void HwQuantonUart2Set( uint8_t *NewUart2 );
+extern void HwQuantonUart2Get( uint8_t *NewUart2 );
+extern void HwQuantonUart3Set( uint8_t *NewUart3 );
+extern void HwQuantonUart3Get( uint8_t *NewUart3 );
+extern void HwQuantonUart4Set( uint8_t *NewUart4 );
+extern void HwQuantonUart4Get( uint8_t *NewUart4 );
+extern void HwQuantonUart5Set( uint8_t *NewUart5 );
+extern void HwQuantonUart5Get( uint8_t *NewUart5 );
+extern void HwQuantonUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwQuantonUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwQuantonUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwQuantonUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwQuantonDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwQuantonDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwQuantonGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwQuantonGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwQuantonAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwQuantonAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwQuantonMPU6000DLPFSet( uint8_t *NewMPU6000DLPF );
+extern void HwQuantonMPU6000DLPFGet( uint8_t *NewMPU6000DLPF );
+extern void HwQuantonMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwQuantonMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwQuantonExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwQuantonExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+extern void HwQuantonExtMagPortSet( uint8_t *NewExtMagPort );
+extern void HwQuantonExtMagPortGet( uint8_t *NewExtMagPort );
+
+
+#endif // HWQUANTON_H
+
+/**
+ * @}
+ * @}
+ */
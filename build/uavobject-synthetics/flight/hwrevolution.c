@@ -0,0 +1,325 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwrevolution.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwRevolution object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwrevolution.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwrevolution.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwRevolutionData defaultData = {
+	.CoordID = 0,
+	.RxPort = 7,
+	.WS2811Pin = 0,
+	.MainPort = 0,
+	.FlexiPort = 0,
+	.RxPortUsart = 0,
+	.SPIPeripheral = 1,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.Radio = 0,
+	.MaxRfSpeed = 3,
+	.MaxRfPower = 0,
+	.RfBand = 0,
+	.MinChannel = 0,
+	.MaxChannel = 250,
+	.GyroRange = 2,
+	.AccelRange = 2,
+	.MPU6000DLPF = 0,
+	.Magnetometer = 1,
+	.ExtMagOrientation = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwRevolutionInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWREVOLUTION_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWREVOLUTION_OBJID,
+			HWREVOLUTION_ISSINGLEINST, HWREVOLUTION_ISSETTINGS, HWREVOLUTION_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwRevolutionSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwRevolutionData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwRevolutionSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwRevolutionSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwRevolutionSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwRevolutionSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwRevolutionHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwRevolutionCoordIDSet( uint32_t *NewCoordID )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewCoordID, offsetof( HwRevolutionData, CoordID), sizeof(uint32_t));
+}
+void HwRevolutionCoordIDGet( uint32_t *NewCoordID )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewCoordID, offsetof( HwRevolutionData, CoordID), sizeof(uint32_t));
+}
+void HwRevolutionRxPortSet( uint8_t *NewRxPort )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewRxPort, offsetof( HwRevolutionData, RxPort), sizeof(uint8_t));
+}
+void HwRevolutionRxPortGet( uint8_t *NewRxPort )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewRxPort, offsetof( HwRevolutionData, RxPort), sizeof(uint8_t));
+}
+void HwRevolutionWS2811PinSet( uint8_t *NewWS2811Pin )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewWS2811Pin, offsetof( HwRevolutionData, WS2811Pin), sizeof(uint8_t));
+}
+void HwRevolutionWS2811PinGet( uint8_t *NewWS2811Pin )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewWS2811Pin, offsetof( HwRevolutionData, WS2811Pin), sizeof(uint8_t));
+}
+void HwRevolutionMainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMainPort, offsetof( HwRevolutionData, MainPort), sizeof(uint8_t));
+}
+void HwRevolutionMainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMainPort, offsetof( HwRevolutionData, MainPort), sizeof(uint8_t));
+}
+void HwRevolutionFlexiPortSet( uint8_t *NewFlexiPort )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewFlexiPort, offsetof( HwRevolutionData, FlexiPort), sizeof(uint8_t));
+}
+void HwRevolutionFlexiPortGet( uint8_t *NewFlexiPort )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewFlexiPort, offsetof( HwRevolutionData, FlexiPort), sizeof(uint8_t));
+}
+void HwRevolutionRxPortUsartSet( uint8_t *NewRxPortUsart )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewRxPortUsart, offsetof( HwRevolutionData, RxPortUsart), sizeof(uint8_t));
+}
+void HwRevolutionRxPortUsartGet( uint8_t *NewRxPortUsart )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewRxPortUsart, offsetof( HwRevolutionData, RxPortUsart), sizeof(uint8_t));
+}
+void HwRevolutionSPIPeripheralSet( uint8_t *NewSPIPeripheral )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewSPIPeripheral, offsetof( HwRevolutionData, SPIPeripheral), sizeof(uint8_t));
+}
+void HwRevolutionSPIPeripheralGet( uint8_t *NewSPIPeripheral )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewSPIPeripheral, offsetof( HwRevolutionData, SPIPeripheral), sizeof(uint8_t));
+}
+void HwRevolutionUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewUSB_HIDPort, offsetof( HwRevolutionData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwRevolutionUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewUSB_HIDPort, offsetof( HwRevolutionData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwRevolutionUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewUSB_VCPPort, offsetof( HwRevolutionData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwRevolutionUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewUSB_VCPPort, offsetof( HwRevolutionData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwRevolutionDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewDSMxMode, offsetof( HwRevolutionData, DSMxMode), sizeof(uint8_t));
+}
+void HwRevolutionDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewDSMxMode, offsetof( HwRevolutionData, DSMxMode), sizeof(uint8_t));
+}
+void HwRevolutionRadioSet( uint8_t *NewRadio )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewRadio, offsetof( HwRevolutionData, Radio), sizeof(uint8_t));
+}
+void HwRevolutionRadioGet( uint8_t *NewRadio )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewRadio, offsetof( HwRevolutionData, Radio), sizeof(uint8_t));
+}
+void HwRevolutionMaxRfSpeedSet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMaxRfSpeed, offsetof( HwRevolutionData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwRevolutionMaxRfSpeedGet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMaxRfSpeed, offsetof( HwRevolutionData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwRevolutionMaxRfPowerSet( uint8_t *NewMaxRfPower )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMaxRfPower, offsetof( HwRevolutionData, MaxRfPower), sizeof(uint8_t));
+}
+void HwRevolutionMaxRfPowerGet( uint8_t *NewMaxRfPower )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMaxRfPower, offsetof( HwRevolutionData, MaxRfPower), sizeof(uint8_t));
+}
+void HwRevolutionRfBandSet( uint8_t *NewRfBand )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewRfBand, offsetof( HwRevolutionData, RfBand), sizeof(uint8_t));
+}
+void HwRevolutionRfBandGet( uint8_t *NewRfBand )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewRfBand, offsetof( HwRevolutionData, RfBand), sizeof(uint8_t));
+}
+void HwRevolutionMinChannelSet( uint8_t *NewMinChannel )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMinChannel, offsetof( HwRevolutionData, MinChannel), sizeof(uint8_t));
+}
+void HwRevolutionMinChannelGet( uint8_t *NewMinChannel )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMinChannel, offsetof( HwRevolutionData, MinChannel), sizeof(uint8_t));
+}
+void HwRevolutionMaxChannelSet( uint8_t *NewMaxChannel )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMaxChannel, offsetof( HwRevolutionData, MaxChannel), sizeof(uint8_t));
+}
+void HwRevolutionMaxChannelGet( uint8_t *NewMaxChannel )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMaxChannel, offsetof( HwRevolutionData, MaxChannel), sizeof(uint8_t));
+}
+void HwRevolutionGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewGyroRange, offsetof( HwRevolutionData, GyroRange), sizeof(uint8_t));
+}
+void HwRevolutionGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewGyroRange, offsetof( HwRevolutionData, GyroRange), sizeof(uint8_t));
+}
+void HwRevolutionAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewAccelRange, offsetof( HwRevolutionData, AccelRange), sizeof(uint8_t));
+}
+void HwRevolutionAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewAccelRange, offsetof( HwRevolutionData, AccelRange), sizeof(uint8_t));
+}
+void HwRevolutionMPU6000DLPFSet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMPU6000DLPF, offsetof( HwRevolutionData, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwRevolutionMPU6000DLPFGet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMPU6000DLPF, offsetof( HwRevolutionData, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwRevolutionMagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewMagnetometer, offsetof( HwRevolutionData, Magnetometer), sizeof(uint8_t));
+}
+void HwRevolutionMagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewMagnetometer, offsetof( HwRevolutionData, Magnetometer), sizeof(uint8_t));
+}
+void HwRevolutionExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwRevolutionHandle(), (void*)NewExtMagOrientation, offsetof( HwRevolutionData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwRevolutionExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwRevolutionHandle(), (void*)NewExtMagOrientation, offsetof( HwRevolutionData, ExtMagOrientation), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,291 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwRevolution HwRevolution
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwrevolution.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwRevolution object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwrevolution.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWREVOLUTION_H
+#define HWREVOLUTION_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWREVOLUTION_OBJID 0x5FBF0942
+#define HWREVOLUTION_ISSINGLEINST 1
+#define HWREVOLUTION_ISSETTINGS 1
+#define HWREVOLUTION_NUMBYTES 24
+
+// Generic interface functions
+int32_t HwRevolutionInitialize();
+UAVObjHandle HwRevolutionHandle();
+void HwRevolutionSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t CoordID;
+    uint8_t RxPort;
+    uint8_t WS2811Pin;
+    uint8_t MainPort;
+    uint8_t FlexiPort;
+    uint8_t RxPortUsart;
+    uint8_t SPIPeripheral;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t Radio;
+    uint8_t MaxRfSpeed;
+    uint8_t MaxRfPower;
+    uint8_t RfBand;
+    uint8_t MinChannel;
+    uint8_t MaxChannel;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU6000DLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwRevolutionData;
+
+// Typesafe Object access functions
+/**
+ * @function HwRevolutionGet(dataOut)
+ * @brief Populate a HwRevolutionData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwRevolutionGet(HwRevolutionData *dataOut) { return UAVObjGetData(HwRevolutionHandle(), dataOut); }
+
+static inline int32_t HwRevolutionSet(const HwRevolutionData *dataIn) { return UAVObjSetData(HwRevolutionHandle(), dataIn); }
+
+static inline int32_t HwRevolutionInstGet(uint16_t instId, HwRevolutionData *dataOut) { return UAVObjGetInstanceData(HwRevolutionHandle(), instId, dataOut); }
+
+static inline int32_t HwRevolutionInstSet(uint16_t instId, const HwRevolutionData *dataIn) { return UAVObjSetInstanceData(HwRevolutionHandle(), instId, dataIn); }
+
+static inline int32_t HwRevolutionConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwRevolutionHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwRevolutionHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwRevolutionHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCopy(volatile HwRevolutionData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwRevolutionGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwRevolutionHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwRevolutionCreateInstance() { return UAVObjCreateInstance(HwRevolutionHandle(), &HwRevolutionSetDefaults); }
+
+static inline void HwRevolutionUpdated() { UAVObjUpdated(HwRevolutionHandle()); }
+
+static inline void HwRevolutionInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwRevolutionHandle(), instId); }
+
+static inline int32_t HwRevolutionGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwRevolutionHandle(), dataOut); }
+
+static inline int32_t HwRevolutionSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwRevolutionHandle(), dataIn); }
+
+static inline int8_t HwRevolutionReadOnly() { return UAVObjReadOnly(HwRevolutionHandle()); }
+
+static inline uint16_t HwRevolutionGetNumInstances(){ return UAVObjGetNumInstances(HwRevolutionHandle()); }
+
+static inline uint32_t HwRevolutionGetNumBytes(){ return UAVObjGetNumBytes(HwRevolutionHandle()); }
+
+// Field information
+// Field CoordID information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWREVOLUTION_RXPORT_DISABLED=0, HWREVOLUTION_RXPORT_OUTPUTS=1, HWREVOLUTION_RXPORT_PPM=2, HWREVOLUTION_RXPORT_PPMFRSKY=3, HWREVOLUTION_RXPORT_PPMOUTPUTS=4, HWREVOLUTION_RXPORT_PPMPWM=5, HWREVOLUTION_RXPORT_PPMUART=6, HWREVOLUTION_RXPORT_PWM=7, HWREVOLUTION_RXPORT_UART=8 }  __attribute__((packed)) HwRevolutionRxPortOptions;
+#define HWREVOLUTION_RXPORT_GLOBAL_MAXOPTVAL 8
+#define HWREVOLUTION_RXPORT_MAXOPTVAL 8
+static inline bool HwRevolutionRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort <= HWREVOLUTION_RXPORT_MAXOPTVAL; }
+// Field WS2811Pin information
+/* Enumeration options for field WS2811Pin */
+typedef enum { HWREVOLUTION_WS2811PIN_DISABLED=0, HWREVOLUTION_WS2811PIN_PB12INPORTPIN3=1, HWREVOLUTION_WS2811PIN_PD2OMNIBUSF4LEDPORT=2, HWREVOLUTION_WS2811PIN_PA0SERVOOUT6=3 }  __attribute__((packed)) HwRevolutionWS2811PinOptions;
+#define HWREVOLUTION_WS2811PIN_GLOBAL_MAXOPTVAL 3
+#define HWREVOLUTION_WS2811PIN_MAXOPTVAL 3
+static inline bool HwRevolutionWS2811PinIsValid( uint8_t CurrentWS2811Pin ) { return CurrentWS2811Pin <= HWREVOLUTION_WS2811PIN_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWREVOLUTION_MAINPORT_DISABLED=0, HWREVOLUTION_MAINPORT_COMBRIDGE=9, HWREVOLUTION_MAINPORT_DEBUGCONSOLE=8, HWREVOLUTION_MAINPORT_DSM=3, HWREVOLUTION_MAINPORT_FRSKYSENSORHUB=16, HWREVOLUTION_MAINPORT_FRSKYSPORTTELEMETRY=17, HWREVOLUTION_MAINPORT_FRSKYSPORTNONINVERTED=18, HWREVOLUTION_MAINPORT_GPS=2, HWREVOLUTION_MAINPORT_SRXL=6, HWREVOLUTION_MAINPORT_HOTTSUMD=13, HWREVOLUTION_MAINPORT_HOTTSUMH=14, HWREVOLUTION_MAINPORT_HOTTTELEMETRY=15, HWREVOLUTION_MAINPORT_LIGHTTELEMETRYTX=19, HWREVOLUTION_MAINPORT_MAVLINKTX=10, HWREVOLUTION_MAINPORT_MAVLINKTX_GPS_RX=11, HWREVOLUTION_MAINPORT_MSP=12, HWREVOLUTION_MAINPORT_OPENLOG=20, HWREVOLUTION_MAINPORT_SBUS=4, HWREVOLUTION_MAINPORT_SBUSNONINVERTED=5, HWREVOLUTION_MAINPORT_STORM32BGC=21, HWREVOLUTION_MAINPORT_TELEMETRY=1, HWREVOLUTION_MAINPORT_IBUS=7, HWREVOLUTION_MAINPORT_TBSCROSSFIRE=23, HWREVOLUTION_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionMainPortOptions;
+#define HWREVOLUTION_MAINPORT_GLOBAL_MAXOPTVAL 26
+#define HWREVOLUTION_MAINPORT_MAXOPTVAL 23
+static inline bool HwRevolutionMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort <= HWREVOLUTION_MAINPORT_MAXOPTVAL; }
+// Field FlexiPort information
+/* Enumeration options for field FlexiPort */
+typedef enum { HWREVOLUTION_FLEXIPORT_DISABLED=0, HWREVOLUTION_FLEXIPORT_COMBRIDGE=9, HWREVOLUTION_FLEXIPORT_DEBUGCONSOLE=8, HWREVOLUTION_FLEXIPORT_DSM=3, HWREVOLUTION_FLEXIPORT_FRSKYSENSORHUB=16, HWREVOLUTION_FLEXIPORT_FRSKYSPORTTELEMETRY=17, HWREVOLUTION_FLEXIPORT_FRSKYSPORTNONINVERTED=18, HWREVOLUTION_FLEXIPORT_GPS=2, HWREVOLUTION_FLEXIPORT_SRXL=6, HWREVOLUTION_FLEXIPORT_HOTTSUMD=13, HWREVOLUTION_FLEXIPORT_HOTTSUMH=14, HWREVOLUTION_FLEXIPORT_HOTTTELEMETRY=15, HWREVOLUTION_FLEXIPORT_I2C=24, HWREVOLUTION_FLEXIPORT_LIGHTTELEMETRYTX=19, HWREVOLUTION_FLEXIPORT_MAVLINKTX=10, HWREVOLUTION_FLEXIPORT_MAVLINKTX_GPS_RX=11, HWREVOLUTION_FLEXIPORT_MSP=12, HWREVOLUTION_FLEXIPORT_OPENLOG=20, HWREVOLUTION_FLEXIPORT_SBUSNONINVERTED=5, HWREVOLUTION_FLEXIPORT_STORM32BGC=21, HWREVOLUTION_FLEXIPORT_TELEMETRY=1, HWREVOLUTION_FLEXIPORT_IBUS=7, HWREVOLUTION_FLEXIPORT_TBSCROSSFIRE=23, HWREVOLUTION_FLEXIPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionFlexiPortOptions;
+#define HWREVOLUTION_FLEXIPORT_GLOBAL_MAXOPTVAL 26
+#define HWREVOLUTION_FLEXIPORT_MAXOPTVAL 24
+static inline bool HwRevolutionFlexiPortIsValid( uint8_t CurrentFlexiPort ) { return CurrentFlexiPort <= HWREVOLUTION_FLEXIPORT_MAXOPTVAL; }
+// Field RxPortUsart information
+/* Enumeration options for field RxPortUsart */
+typedef enum { HWREVOLUTION_RXPORTUSART_DISABLED=0, HWREVOLUTION_RXPORTUSART_COMBRIDGE=9, HWREVOLUTION_RXPORTUSART_DEBUGCONSOLE=8, HWREVOLUTION_RXPORTUSART_DSM=3, HWREVOLUTION_RXPORTUSART_FRSKYSENSORHUB=16, HWREVOLUTION_RXPORTUSART_FRSKYSPORTTELEMETRY=17, HWREVOLUTION_RXPORTUSART_FRSKYSPORTNONINVERTED=18, HWREVOLUTION_RXPORTUSART_GPS=2, HWREVOLUTION_RXPORTUSART_SRXL=6, HWREVOLUTION_RXPORTUSART_HOTTSUMD=13, HWREVOLUTION_RXPORTUSART_HOTTSUMH=14, HWREVOLUTION_RXPORTUSART_HOTTTELEMETRY=15, HWREVOLUTION_RXPORTUSART_LIGHTTELEMETRYTX=19, HWREVOLUTION_RXPORTUSART_MAVLINKTX=10, HWREVOLUTION_RXPORTUSART_MAVLINKTX_GPS_RX=11, HWREVOLUTION_RXPORTUSART_MSP=12, HWREVOLUTION_RXPORTUSART_OPENLOG=20, HWREVOLUTION_RXPORTUSART_SBUSNONINVERTED=5, HWREVOLUTION_RXPORTUSART_TELEMETRY=1, HWREVOLUTION_RXPORTUSART_IBUS=7, HWREVOLUTION_RXPORTUSART_TBSCROSSFIRE=23, HWREVOLUTION_RXPORTUSART_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRxPortUsartOptions;
+#define HWREVOLUTION_RXPORTUSART_GLOBAL_MAXOPTVAL 26
+#define HWREVOLUTION_RXPORTUSART_MAXOPTVAL 23
+static inline bool HwRevolutionRxPortUsartIsValid( uint8_t CurrentRxPortUsart ) { return CurrentRxPortUsart <= HWREVOLUTION_RXPORTUSART_MAXOPTVAL; }
+// Field SPIPeripheral information
+/* Enumeration options for field SPIPeripheral */
+typedef enum { HWREVOLUTION_SPIPERIPHERAL_DISABLED=0, HWREVOLUTION_SPIPERIPHERAL_RADIO=1, HWREVOLUTION_SPIPERIPHERAL_MAX7456OSD=2 }  __attribute__((packed)) HwRevolutionSPIPeripheralOptions;
+#define HWREVOLUTION_SPIPERIPHERAL_GLOBAL_MAXOPTVAL 2
+#define HWREVOLUTION_SPIPERIPHERAL_MAXOPTVAL 2
+static inline bool HwRevolutionSPIPeripheralIsValid( uint8_t CurrentSPIPeripheral ) { return CurrentSPIPeripheral <= HWREVOLUTION_SPIPERIPHERAL_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWREVOLUTION_USB_HIDPORT_USBTELEMETRY=0, HWREVOLUTION_USB_HIDPORT_DISABLED=1, HWREVOLUTION_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionUSB_HIDPortOptions;
+#define HWREVOLUTION_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWREVOLUTION_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwRevolutionUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWREVOLUTION_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWREVOLUTION_USB_VCPPORT_USBTELEMETRY=0, HWREVOLUTION_USB_VCPPORT_COMBRIDGE=1, HWREVOLUTION_USB_VCPPORT_DEBUGCONSOLE=2, HWREVOLUTION_USB_VCPPORT_MSP=3, HWREVOLUTION_USB_VCPPORT_DISABLED=4, HWREVOLUTION_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionUSB_VCPPortOptions;
+#define HWREVOLUTION_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWREVOLUTION_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwRevolutionUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWREVOLUTION_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWREVOLUTION_DSMXMODE_AUTODETECT=0, HWREVOLUTION_DSMXMODE_FORCE10BIT=1, HWREVOLUTION_DSMXMODE_FORCE11BIT=2, HWREVOLUTION_DSMXMODE_BIND3PULSES=3, HWREVOLUTION_DSMXMODE_BIND4PULSES=4, HWREVOLUTION_DSMXMODE_BIND5PULSES=5, HWREVOLUTION_DSMXMODE_BIND6PULSES=6, HWREVOLUTION_DSMXMODE_BIND7PULSES=7, HWREVOLUTION_DSMXMODE_BIND8PULSES=8, HWREVOLUTION_DSMXMODE_BIND9PULSES=9, HWREVOLUTION_DSMXMODE_BIND10PULSES=10, HWREVOLUTION_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionDSMxModeOptions;
+#define HWREVOLUTION_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWREVOLUTION_DSMXMODE_MAXOPTVAL 10
+static inline bool HwRevolutionDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWREVOLUTION_DSMXMODE_MAXOPTVAL; }
+// Field Radio information
+/* Enumeration options for field Radio */
+typedef enum { HWREVOLUTION_RADIO_DISABLED=0, HWREVOLUTION_RADIO_TELEM=1, HWREVOLUTION_RADIO_TELEMPPM=2, HWREVOLUTION_RADIO_PPM=3, HWREVOLUTION_RADIO_OPENLRS=4, HWREVOLUTION_RADIO_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRadioOptions;
+#define HWREVOLUTION_RADIO_GLOBAL_MAXOPTVAL 4
+#define HWREVOLUTION_RADIO_MAXOPTVAL 4
+static inline bool HwRevolutionRadioIsValid( uint8_t CurrentRadio ) { return CurrentRadio <= HWREVOLUTION_RADIO_MAXOPTVAL; }
+// Field MaxRfSpeed information
+/* Enumeration options for field MaxRfSpeed */
+typedef enum { HWREVOLUTION_MAXRFSPEED_9600=0, HWREVOLUTION_MAXRFSPEED_19200=1, HWREVOLUTION_MAXRFSPEED_32000=2, HWREVOLUTION_MAXRFSPEED_64000=3, HWREVOLUTION_MAXRFSPEED_100000=4, HWREVOLUTION_MAXRFSPEED_192000=5, HWREVOLUTION_MAXRFSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionMaxRfSpeedOptions;
+#define HWREVOLUTION_MAXRFSPEED_GLOBAL_MAXOPTVAL 5
+#define HWREVOLUTION_MAXRFSPEED_MAXOPTVAL 5
+static inline bool HwRevolutionMaxRfSpeedIsValid( uint8_t CurrentMaxRfSpeed ) { return CurrentMaxRfSpeed <= HWREVOLUTION_MAXRFSPEED_MAXOPTVAL; }
+// Field MaxRfPower information
+/* Enumeration options for field MaxRfPower */
+typedef enum { HWREVOLUTION_MAXRFPOWER_0=0, HWREVOLUTION_MAXRFPOWER_125=1, HWREVOLUTION_MAXRFPOWER_16=2, HWREVOLUTION_MAXRFPOWER_316=3, HWREVOLUTION_MAXRFPOWER_63=4, HWREVOLUTION_MAXRFPOWER_126=5, HWREVOLUTION_MAXRFPOWER_25=6, HWREVOLUTION_MAXRFPOWER_50=7, HWREVOLUTION_MAXRFPOWER_100=8, HWREVOLUTION_MAXRFPOWER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionMaxRfPowerOptions;
+#define HWREVOLUTION_MAXRFPOWER_GLOBAL_MAXOPTVAL 8
+#define HWREVOLUTION_MAXRFPOWER_MAXOPTVAL 8
+static inline bool HwRevolutionMaxRfPowerIsValid( uint8_t CurrentMaxRfPower ) { return CurrentMaxRfPower <= HWREVOLUTION_MAXRFPOWER_MAXOPTVAL; }
+// Field RfBand information
+/* Enumeration options for field RfBand */
+typedef enum { HWREVOLUTION_RFBAND_BOARDDEFAULT=0, HWREVOLUTION_RFBAND_433=1, HWREVOLUTION_RFBAND_868=2, HWREVOLUTION_RFBAND_915=3, HWREVOLUTION_RFBAND_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRfBandOptions;
+#define HWREVOLUTION_RFBAND_GLOBAL_MAXOPTVAL 3
+#define HWREVOLUTION_RFBAND_MAXOPTVAL 3
+static inline bool HwRevolutionRfBandIsValid( uint8_t CurrentRfBand ) { return CurrentRfBand <= HWREVOLUTION_RFBAND_MAXOPTVAL; }
+// Field MinChannel information
+// Field MaxChannel information
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWREVOLUTION_GYRORANGE_250=0, HWREVOLUTION_GYRORANGE_500=1, HWREVOLUTION_GYRORANGE_1000=2, HWREVOLUTION_GYRORANGE_2000=3 }  __attribute__((packed)) HwRevolutionGyroRangeOptions;
+#define HWREVOLUTION_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWREVOLUTION_GYRORANGE_MAXOPTVAL 3
+static inline bool HwRevolutionGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWREVOLUTION_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWREVOLUTION_ACCELRANGE_2G=0, HWREVOLUTION_ACCELRANGE_4G=1, HWREVOLUTION_ACCELRANGE_8G=2, HWREVOLUTION_ACCELRANGE_16G=3 }  __attribute__((packed)) HwRevolutionAccelRangeOptions;
+#define HWREVOLUTION_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWREVOLUTION_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwRevolutionAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWREVOLUTION_ACCELRANGE_MAXOPTVAL; }
+// Field MPU6000DLPF information
+/* Enumeration options for field MPU6000DLPF */
+typedef enum { HWREVOLUTION_MPU6000DLPF_188=0, HWREVOLUTION_MPU6000DLPF_98=1, HWREVOLUTION_MPU6000DLPF_42=2, HWREVOLUTION_MPU6000DLPF_20=3, HWREVOLUTION_MPU6000DLPF_10=4, HWREVOLUTION_MPU6000DLPF_5=5 }  __attribute__((packed)) HwRevolutionMPU6000DLPFOptions;
+#define HWREVOLUTION_MPU6000DLPF_GLOBAL_MAXOPTVAL 5
+#define HWREVOLUTION_MPU6000DLPF_MAXOPTVAL 5
+static inline bool HwRevolutionMPU6000DLPFIsValid( uint8_t CurrentMPU6000DLPF ) { return CurrentMPU6000DLPF <= HWREVOLUTION_MPU6000DLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWREVOLUTION_MAGNETOMETER_NONE=0, HWREVOLUTION_MAGNETOMETER_INTERNAL=1, HWREVOLUTION_MAGNETOMETER_EXTERNALHMC5883=2, HWREVOLUTION_MAGNETOMETER_EXTERNALHMC5983=3, HWREVOLUTION_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionMagnetometerOptions;
+#define HWREVOLUTION_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWREVOLUTION_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwRevolutionMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWREVOLUTION_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWREVOLUTION_EXTMAGORIENTATION_TOP0DEGCW=0, HWREVOLUTION_EXTMAGORIENTATION_TOP90DEGCW=1, HWREVOLUTION_EXTMAGORIENTATION_TOP180DEGCW=2, HWREVOLUTION_EXTMAGORIENTATION_TOP270DEGCW=3, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWREVOLUTION_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionExtMagOrientationOptions;
+#define HWREVOLUTION_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWREVOLUTION_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwRevolutionExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWREVOLUTION_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwRevolutionCoordIDSet( uint32_t *NewCoordID );
+extern void HwRevolutionCoordIDGet( uint32_t *NewCoordID );
+extern void HwRevolutionRxPortSet( uint8_t *NewRxPort );
+extern void HwRevolutionRxPortGet( uint8_t *NewRxPort );
+extern void HwRevolutionWS2811PinSet( uint8_t *NewWS2811Pin );
+extern void HwRevolutionWS2811PinGet( uint8_t *NewWS2811Pin );
+extern void HwRevolutionMainPortSet( uint8_t *NewMainPort );
+extern void HwRevolutionMainPortGet( uint8_t *NewMainPort );
+extern void HwRevolutionFlexiPortSet( uint8_t *NewFlexiPort );
+extern void HwRevolutionFlexiPortGet( uint8_t *NewFlexiPort );
+extern void HwRevolutionRxPortUsartSet( uint8_t *NewRxPortUsart );
+extern void HwRevolutionRxPortUsartGet( uint8_t *NewRxPortUsart );
+extern void HwRevolutionSPIPeripheralSet( uint8_t *NewSPIPeripheral );
+extern void HwRevolutionSPIPeripheralGet( uint8_t *NewSPIPeripheral );
+extern void HwRevolutionUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwRevolutionUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwRevolutionUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwRevolutionUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwRevolutionDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwRevolutionDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwRevolutionRadioSet( uint8_t *NewRadio );
+extern void HwRevolutionRadioGet( uint8_t *NewRadio );
+extern void HwRevolutionMaxRfSpeedSet( uint8_t *NewMaxRfSpeed );
+extern void HwRevolutionMaxRfSpeedGet( uint8_t *NewMaxRfSpeed );
+extern void HwRevolutionMaxRfPowerSet( uint8_t *NewMaxRfPower );
+extern void HwRevolutionMaxRfPowerGet( uint8_t *NewMaxRfPower );
+extern void HwRevolutionRfBandSet( uint8_t *NewRfBand );
+extern void HwRevolutionRfBandGet( uint8_t *NewRfBand );
+extern void HwRevolutionMinChannelSet( uint8_t *NewMinChannel );
+extern void HwRevolutionMinChannelGet( uint8_t *NewMinChannel );
+extern void HwRevolutionMaxChannelSet( uint8_t *NewMaxChannel );
+extern void HwRevolutionMaxChannelGet( uint8_t *NewMaxChannel );
+extern void HwRevolutionGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwRevolutionGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwRevolutionAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwRevolutionAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwRevolutionMPU6000DLPFSet( uint8_t *NewMPU6000DLPF );
+extern void HwRevolutionMPU6000DLPFGet( uint8_t *NewMPU6000DLPF );
+extern void HwRevolutionMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwRevolutionMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwRevolutionExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwRevolutionExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWREVOLUTION_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwseppuku.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwSeppuku object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwseppuku.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwseppuku.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwSeppukuData defaultData = {
+	.RcvrPort = 0,
+	.Uart1 = 0,
+	.Uart6 = 0,
+	.Uart3 = 0,
+	.OutputConfiguration = 0,
+	.Uart4 = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.Magnetometer = 1,
+	.BMI160FOC = 0,
+	.ExtMagOrientation = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSeppukuInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWSEPPUKU_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWSEPPUKU_OBJID,
+			HWSEPPUKU_ISSINGLEINST, HWSEPPUKU_ISSETTINGS, HWSEPPUKU_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwSeppukuSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwSeppukuData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwSeppukuSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSeppukuSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwSeppukuSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwSeppukuSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSeppukuHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSeppukuRcvrPortSet( uint8_t *NewRcvrPort )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewRcvrPort, offsetof( HwSeppukuData, RcvrPort), sizeof(uint8_t));
+}
+void HwSeppukuRcvrPortGet( uint8_t *NewRcvrPort )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewRcvrPort, offsetof( HwSeppukuData, RcvrPort), sizeof(uint8_t));
+}
+void HwSeppukuUart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUart1, offsetof( HwSeppukuData, Uart1), sizeof(uint8_t));
+}
+void HwSeppukuUart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUart1, offsetof( HwSeppukuData, Uart1), sizeof(uint8_t));
+}
+void HwSeppukuUart6Set( uint8_t *NewUart6 )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUart6, offsetof( HwSeppukuData, Uart6), sizeof(uint8_t));
+}
+void HwSeppukuUart6Get( uint8_t *NewUart6 )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUart6, offsetof( HwSeppukuData, Uart6), sizeof(uint8_t));
+}
+void HwSeppukuUart3Set( uint8_t *NewUart3 )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUart3, offsetof( HwSeppukuData, Uart3), sizeof(uint8_t));
+}
+void HwSeppukuUart3Get( uint8_t *NewUart3 )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUart3, offsetof( HwSeppukuData, Uart3), sizeof(uint8_t));
+}
+void HwSeppukuOutputConfigurationSet( uint8_t *NewOutputConfiguration )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewOutputConfiguration, offsetof( HwSeppukuData, OutputConfiguration), sizeof(uint8_t));
+}
+void HwSeppukuOutputConfigurationGet( uint8_t *NewOutputConfiguration )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewOutputConfiguration, offsetof( HwSeppukuData, OutputConfiguration), sizeof(uint8_t));
+}
+void HwSeppukuUart4Set( uint8_t *NewUart4 )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUart4, offsetof( HwSeppukuData, Uart4), sizeof(uint8_t));
+}
+void HwSeppukuUart4Get( uint8_t *NewUart4 )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUart4, offsetof( HwSeppukuData, Uart4), sizeof(uint8_t));
+}
+void HwSeppukuUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUSB_HIDPort, offsetof( HwSeppukuData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSeppukuUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUSB_HIDPort, offsetof( HwSeppukuData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSeppukuUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewUSB_VCPPort, offsetof( HwSeppukuData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSeppukuUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewUSB_VCPPort, offsetof( HwSeppukuData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSeppukuDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewDSMxMode, offsetof( HwSeppukuData, DSMxMode), sizeof(uint8_t));
+}
+void HwSeppukuDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewDSMxMode, offsetof( HwSeppukuData, DSMxMode), sizeof(uint8_t));
+}
+void HwSeppukuMagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewMagnetometer, offsetof( HwSeppukuData, Magnetometer), sizeof(uint8_t));
+}
+void HwSeppukuMagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewMagnetometer, offsetof( HwSeppukuData, Magnetometer), sizeof(uint8_t));
+}
+void HwSeppukuBMI160FOCSet( uint8_t *NewBMI160FOC )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewBMI160FOC, offsetof( HwSeppukuData, BMI160FOC), sizeof(uint8_t));
+}
+void HwSeppukuBMI160FOCGet( uint8_t *NewBMI160FOC )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewBMI160FOC, offsetof( HwSeppukuData, BMI160FOC), sizeof(uint8_t));
+}
+void HwSeppukuExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwSeppukuHandle(), (void*)NewExtMagOrientation, offsetof( HwSeppukuData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwSeppukuExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwSeppukuHandle(), (void*)NewExtMagOrientation, offsetof( HwSeppukuData, ExtMagOrientation), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwSeppuku HwSeppuku
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwseppuku.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwSeppuku object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwseppuku.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWSEPPUKU_H
+#define HWSEPPUKU_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWSEPPUKU_OBJID 0x190CA298
+#define HWSEPPUKU_ISSINGLEINST 1
+#define HWSEPPUKU_ISSETTINGS 1
+#define HWSEPPUKU_NUMBYTES 12
+
+// Generic interface functions
+int32_t HwSeppukuInitialize();
+UAVObjHandle HwSeppukuHandle();
+void HwSeppukuSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RcvrPort;
+    uint8_t Uart1;
+    uint8_t Uart6;
+    uint8_t Uart3;
+    uint8_t OutputConfiguration;
+    uint8_t Uart4;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t Magnetometer;
+    uint8_t BMI160FOC;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwSeppukuData;
+
+// Typesafe Object access functions
+/**
+ * @function HwSeppukuGet(dataOut)
+ * @brief Populate a HwSeppukuData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwSeppukuGet(HwSeppukuData *dataOut) { return UAVObjGetData(HwSeppukuHandle(), dataOut); }
+
+static inline int32_t HwSeppukuSet(const HwSeppukuData *dataIn) { return UAVObjSetData(HwSeppukuHandle(), dataIn); }
+
+static inline int32_t HwSeppukuInstGet(uint16_t instId, HwSeppukuData *dataOut) { return UAVObjGetInstanceData(HwSeppukuHandle(), instId, dataOut); }
+
+static inline int32_t HwSeppukuInstSet(uint16_t instId, const HwSeppukuData *dataIn) { return UAVObjSetInstanceData(HwSeppukuHandle(), instId, dataIn); }
+
+static inline int32_t HwSeppukuConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwSeppukuHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSeppukuConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwSeppukuHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSeppukuConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwSeppukuHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSeppukuConnectCopy(volatile HwSeppukuData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwSeppukuGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwSeppukuHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwSeppukuCreateInstance() { return UAVObjCreateInstance(HwSeppukuHandle(), &HwSeppukuSetDefaults); }
+
+static inline void HwSeppukuUpdated() { UAVObjUpdated(HwSeppukuHandle()); }
+
+static inline void HwSeppukuInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwSeppukuHandle(), instId); }
+
+static inline int32_t HwSeppukuGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwSeppukuHandle(), dataOut); }
+
+static inline int32_t HwSeppukuSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwSeppukuHandle(), dataIn); }
+
+static inline int8_t HwSeppukuReadOnly() { return UAVObjReadOnly(HwSeppukuHandle()); }
+
+static inline uint16_t HwSeppukuGetNumInstances(){ return UAVObjGetNumInstances(HwSeppukuHandle()); }
+
+static inline uint32_t HwSeppukuGetNumBytes(){ return UAVObjGetNumBytes(HwSeppukuHandle()); }
+
+// Field information
+// Field RcvrPort information
+/* Enumeration options for field RcvrPort */
+typedef enum { HWSEPPUKU_RCVRPORT_DISABLED=0, HWSEPPUKU_RCVRPORT_DSM=3, HWSEPPUKU_RCVRPORT_SRXL=6, HWSEPPUKU_RCVRPORT_HOTTSUMD=13, HWSEPPUKU_RCVRPORT_HOTTSUMH=14, HWSEPPUKU_RCVRPORT_PPM=25, HWSEPPUKU_RCVRPORT_SBUS=4, HWSEPPUKU_RCVRPORT_SBUSNONINVERTED=5, HWSEPPUKU_RCVRPORT_IBUS=7, HWSEPPUKU_RCVRPORT_TBSCROSSFIRE=23, HWSEPPUKU_RCVRPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuRcvrPortOptions;
+#define HWSEPPUKU_RCVRPORT_GLOBAL_MAXOPTVAL 26
+#define HWSEPPUKU_RCVRPORT_MAXOPTVAL 25
+static inline bool HwSeppukuRcvrPortIsValid( uint8_t CurrentRcvrPort ) { return CurrentRcvrPort <= HWSEPPUKU_RCVRPORT_MAXOPTVAL; }
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWSEPPUKU_UART1_DISABLED=0, HWSEPPUKU_UART1_COMBRIDGE=9, HWSEPPUKU_UART1_DEBUGCONSOLE=8, HWSEPPUKU_UART1_DSM=3, HWSEPPUKU_UART1_FRSKYSENSORHUB=16, HWSEPPUKU_UART1_FRSKYSPORTTELEMETRY=17, HWSEPPUKU_UART1_FRSKYSPORTNONINVERTED=18, HWSEPPUKU_UART1_GPS=2, HWSEPPUKU_UART1_SRXL=6, HWSEPPUKU_UART1_HOTTSUMD=13, HWSEPPUKU_UART1_HOTTSUMH=14, HWSEPPUKU_UART1_HOTTTELEMETRY=15, HWSEPPUKU_UART1_LIGHTTELEMETRYTX=19, HWSEPPUKU_UART1_MAVLINKTX=10, HWSEPPUKU_UART1_MAVLINKTX_GPS_RX=11, HWSEPPUKU_UART1_MSP=12, HWSEPPUKU_UART1_OPENLOG=20, HWSEPPUKU_UART1_SBUSNONINVERTED=5, HWSEPPUKU_UART1_STORM32BGC=21, HWSEPPUKU_UART1_TELEMETRY=1, HWSEPPUKU_UART1_IBUS=7, HWSEPPUKU_UART1_VTXCONFIGTBSSMARTAUDIO=22, HWSEPPUKU_UART1_TBSCROSSFIRE=23, HWSEPPUKU_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUart1Options;
+#define HWSEPPUKU_UART1_GLOBAL_MAXOPTVAL 26
+#define HWSEPPUKU_UART1_MAXOPTVAL 23
+static inline bool HwSeppukuUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 <= HWSEPPUKU_UART1_MAXOPTVAL; }
+// Field Uart6 information
+/* Enumeration options for field Uart6 */
+typedef enum { HWSEPPUKU_UART6_DISABLED=0, HWSEPPUKU_UART6_COMBRIDGE=9, HWSEPPUKU_UART6_DEBUGCONSOLE=8, HWSEPPUKU_UART6_DSM=3, HWSEPPUKU_UART6_FRSKYSENSORHUB=16, HWSEPPUKU_UART6_FRSKYSPORTTELEMETRY=17, HWSEPPUKU_UART6_FRSKYSPORTNONINVERTED=18, HWSEPPUKU_UART6_GPS=2, HWSEPPUKU_UART6_SRXL=6, HWSEPPUKU_UART6_HOTTSUMD=13, HWSEPPUKU_UART6_HOTTSUMH=14, HWSEPPUKU_UART6_HOTTTELEMETRY=15, HWSEPPUKU_UART6_LIGHTTELEMETRYTX=19, HWSEPPUKU_UART6_MAVLINKTX=10, HWSEPPUKU_UART6_MAVLINKTX_GPS_RX=11, HWSEPPUKU_UART6_MSP=12, HWSEPPUKU_UART6_OPENLOG=20, HWSEPPUKU_UART6_SBUSNONINVERTED=5, HWSEPPUKU_UART6_STORM32BGC=21, HWSEPPUKU_UART6_TELEMETRY=1, HWSEPPUKU_UART6_IBUS=7, HWSEPPUKU_UART6_VTXCONFIGTBSSMARTAUDIO=22, HWSEPPUKU_UART6_TBSCROSSFIRE=23, HWSEPPUKU_UART6_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUart6Options;
+#define HWSEPPUKU_UART6_GLOBAL_MAXOPTVAL 26
+#define HWSEPPUKU_UART6_MAXOPTVAL 23
+static inline bool HwSeppukuUart6IsValid( uint8_t CurrentUart6 ) { return CurrentUart6 <= HWSEPPUKU_UART6_MAXOPTVAL; }
+// Field Uart3 information
+/* Enumeration options for field Uart3 */
+typedef enum { HWSEPPUKU_UART3_DISABLED=0, HWSEPPUKU_UART3_COMBRIDGE=9, HWSEPPUKU_UART3_DEBUGCONSOLE=8, HWSEPPUKU_UART3_DSM=3, HWSEPPUKU_UART3_FRSKYSENSORHUB=16, HWSEPPUKU_UART3_FRSKYSPORTTELEMETRY=17, HWSEPPUKU_UART3_FRSKYSPORTNONINVERTED=18, HWSEPPUKU_UART3_GPS=2, HWSEPPUKU_UART3_SRXL=6, HWSEPPUKU_UART3_HOTTSUMD=13, HWSEPPUKU_UART3_HOTTSUMH=14, HWSEPPUKU_UART3_HOTTTELEMETRY=15, HWSEPPUKU_UART3_I2C=24, HWSEPPUKU_UART3_LIGHTTELEMETRYTX=19, HWSEPPUKU_UART3_MAVLINKTX=10, HWSEPPUKU_UART3_MAVLINKTX_GPS_RX=11, HWSEPPUKU_UART3_MSP=12, HWSEPPUKU_UART3_OPENLOG=20, HWSEPPUKU_UART3_SBUSNONINVERTED=5, HWSEPPUKU_UART3_STORM32BGC=21, HWSEPPUKU_UART3_TELEMETRY=1, HWSEPPUKU_UART3_IBUS=7, HWSEPPUKU_UART3_VTXCONFIGTBSSMARTAUDIO=22, HWSEPPUKU_UART3_TBSCROSSFIRE=23, HWSEPPUKU_UART3_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUart3Options;
+#define HWSEPPUKU_UART3_GLOBAL_MAXOPTVAL 26
+#define HWSEPPUKU_UART3_MAXOPTVAL 24
+static inline bool HwSeppukuUart3IsValid( uint8_t CurrentUart3 ) { return CurrentUart3 <= HWSEPPUKU_UART3_MAXOPTVAL; }
+// Field OutputConfiguration information
+/* Enumeration options for field OutputConfiguration */
+typedef enum { HWSEPPUKU_OUTPUTCONFIGURATION_EIGHTCHANNELS=0, HWSEPPUKU_OUTPUTCONFIGURATION_SIXCHANNELSUART4=1 }  __attribute__((packed)) HwSeppukuOutputConfigurationOptions;
+#define HWSEPPUKU_OUTPUTCONFIGURATION_GLOBAL_MAXOPTVAL 1
+#define HWSEPPUKU_OUTPUTCONFIGURATION_MAXOPTVAL 1
+static inline bool HwSeppukuOutputConfigurationIsValid( uint8_t CurrentOutputConfiguration ) { return CurrentOutputConfiguration <= HWSEPPUKU_OUTPUTCONFIGURATION_MAXOPTVAL; }
+// Field Uart4 information
+/* Enumeration options for field Uart4 */
+typedef enum { HWSEPPUKU_UART4_DISABLED=0, HWSEPPUKU_UART4_COMBRIDGE=9, HWSEPPUKU_UART4_DEBUGCONSOLE=8, HWSEPPUKU_UART4_DSM=3, HWSEPPUKU_UART4_FRSKYSENSORHUB=16, HWSEPPUKU_UART4_FRSKYSPORTTELEMETRY=17, HWSEPPUKU_UART4_FRSKYSPORTNONINVERTED=18, HWSEPPUKU_UART4_GPS=2, HWSEPPUKU_UART4_SRXL=6, HWSEPPUKU_UART4_HOTTSUMD=13, HWSEPPUKU_UART4_HOTTSUMH=14, HWSEPPUKU_UART4_HOTTTELEMETRY=15, HWSEPPUKU_UART4_LIGHTTELEMETRYTX=19, HWSEPPUKU_UART4_MAVLINKTX=10, HWSEPPUKU_UART4_MAVLINKTX_GPS_RX=11, HWSEPPUKU_UART4_MSP=12, HWSEPPUKU_UART4_OPENLOG=20, HWSEPPUKU_UART4_SBUSNONINVERTED=5, HWSEPPUKU_UART4_STORM32BGC=21, HWSEPPUKU_UART4_TELEMETRY=1, HWSEPPUKU_UART4_IBUS=7, HWSEPPUKU_UART4_VTXCONFIGTBSSMARTAUDIO=22, HWSEPPUKU_UART4_TBSCROSSFIRE=23, HWSEPPUKU_UART4_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUart4Options;
+#define HWSEPPUKU_UART4_GLOBAL_MAXOPTVAL 26
+#define HWSEPPUKU_UART4_MAXOPTVAL 23
+static inline bool HwSeppukuUart4IsValid( uint8_t CurrentUart4 ) { return CurrentUart4 <= HWSEPPUKU_UART4_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWSEPPUKU_USB_HIDPORT_USBTELEMETRY=0, HWSEPPUKU_USB_HIDPORT_DISABLED=1, HWSEPPUKU_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUSB_HIDPortOptions;
+#define HWSEPPUKU_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWSEPPUKU_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwSeppukuUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWSEPPUKU_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWSEPPUKU_USB_VCPPORT_USBTELEMETRY=0, HWSEPPUKU_USB_VCPPORT_COMBRIDGE=1, HWSEPPUKU_USB_VCPPORT_DEBUGCONSOLE=2, HWSEPPUKU_USB_VCPPORT_MSP=3, HWSEPPUKU_USB_VCPPORT_DISABLED=4, HWSEPPUKU_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuUSB_VCPPortOptions;
+#define HWSEPPUKU_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWSEPPUKU_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwSeppukuUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWSEPPUKU_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWSEPPUKU_DSMXMODE_AUTODETECT=0, HWSEPPUKU_DSMXMODE_FORCE10BIT=1, HWSEPPUKU_DSMXMODE_FORCE11BIT=2, HWSEPPUKU_DSMXMODE_BIND3PULSES=3, HWSEPPUKU_DSMXMODE_BIND4PULSES=4, HWSEPPUKU_DSMXMODE_BIND5PULSES=5, HWSEPPUKU_DSMXMODE_BIND6PULSES=6, HWSEPPUKU_DSMXMODE_BIND7PULSES=7, HWSEPPUKU_DSMXMODE_BIND8PULSES=8, HWSEPPUKU_DSMXMODE_BIND9PULSES=9, HWSEPPUKU_DSMXMODE_BIND10PULSES=10, HWSEPPUKU_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuDSMxModeOptions;
+#define HWSEPPUKU_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWSEPPUKU_DSMXMODE_MAXOPTVAL 10
+static inline bool HwSeppukuDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWSEPPUKU_DSMXMODE_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWSEPPUKU_MAGNETOMETER_NONE=0, HWSEPPUKU_MAGNETOMETER_INTERNAL=1, HWSEPPUKU_MAGNETOMETER_EXTERNALHMC5883=2, HWSEPPUKU_MAGNETOMETER_EXTERNALHMC5983=3, HWSEPPUKU_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuMagnetometerOptions;
+#define HWSEPPUKU_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWSEPPUKU_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwSeppukuMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWSEPPUKU_MAGNETOMETER_MAXOPTVAL; }
+// Field BMI160FOC information
+/* Enumeration options for field BMI160FOC */
+typedef enum { HWSEPPUKU_BMI160FOC_DISABLED=0, HWSEPPUKU_BMI160FOC_DO_FOC=1 }  __attribute__((packed)) HwSeppukuBMI160FOCOptions;
+#define HWSEPPUKU_BMI160FOC_GLOBAL_MAXOPTVAL 1
+#define HWSEPPUKU_BMI160FOC_MAXOPTVAL 1
+static inline bool HwSeppukuBMI160FOCIsValid( uint8_t CurrentBMI160FOC ) { return CurrentBMI160FOC <= HWSEPPUKU_BMI160FOC_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWSEPPUKU_EXTMAGORIENTATION_TOP0DEGCW=0, HWSEPPUKU_EXTMAGORIENTATION_TOP90DEGCW=1, HWSEPPUKU_EXTMAGORIENTATION_TOP180DEGCW=2, HWSEPPUKU_EXTMAGORIENTATION_TOP270DEGCW=3, HWSEPPUKU_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWSEPPUKU_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWSEPPUKU_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWSEPPUKU_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWSEPPUKU_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSeppukuExtMagOrientationOptions;
+#define HWSEPPUKU_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWSEPPUKU_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwSeppukuExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWSEPPUKU_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwSeppukuRcvrPortSet( uint8_t *NewRcvrPort );
+extern void HwSeppukuRcvrPortGet( uint8_t *NewRcvrPort );
+extern void HwSeppukuUart1Set( uint8_t *NewUart1 );
+extern void HwSeppukuUart1Get( uint8_t *NewUart1 );
+extern void HwSeppukuUart6Set( uint8_t *NewUart6 );
+extern void HwSeppukuUart6Get( uint8_t *NewUart6 );
+extern void HwSeppukuUart3Set( uint8_t *NewUart3 );
+extern void HwSeppukuUart3Get( uint8_t *NewUart3 );
+extern void HwSeppukuOutputConfigurationSet( uint8_t *NewOutputConfiguration );
+extern void HwSeppukuOutputConfigurationGet( uint8_t *NewOutputConfiguration );
+extern void HwSeppukuUart4Set( uint8_t *NewUart4 );
+extern void HwSeppukuUart4Get( uint8_t *NewUart4 );
+extern void HwSeppukuUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwSeppukuUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwSeppukuUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwSeppukuUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwSeppukuDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwSeppukuDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwSeppukuMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwSeppukuMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwSeppukuBMI160FOCSet( uint8_t *NewBMI160FOC );
+extern void HwSeppukuBMI160FOCGet( uint8_t *NewBMI160FOC );
+extern void HwSeppukuExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwSeppukuExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWSEPPUKU_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwshared.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwShared object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwshared.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwshared.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwSharedData defaultData = {
+	.PortTypes = 0,
+	.SpeedBps = 7,
+	.ExtBaro = 0,
+	.Mag = 1,
+	.MagOrientation = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.RadioPort = 0,
+	.MaxRfSpeed = 3,
+	.MaxRfPower = 1,
+	.DSMxMode = 0,
+	.RfBand = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSharedInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWSHARED_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWSHARED_OBJID,
+			HWSHARED_ISSINGLEINST, HWSHARED_ISSETTINGS, HWSHARED_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwSharedSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwSharedData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwSharedSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSharedSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwSharedSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwSharedSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSharedHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSharedPortTypesSet( uint8_t *NewPortTypes )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewPortTypes, offsetof( HwSharedData, PortTypes), sizeof(uint8_t));
+}
+void HwSharedPortTypesGet( uint8_t *NewPortTypes )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewPortTypes, offsetof( HwSharedData, PortTypes), sizeof(uint8_t));
+}
+void HwSharedSpeedBpsSet( uint8_t *NewSpeedBps )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewSpeedBps, offsetof( HwSharedData, SpeedBps), sizeof(uint8_t));
+}
+void HwSharedSpeedBpsGet( uint8_t *NewSpeedBps )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewSpeedBps, offsetof( HwSharedData, SpeedBps), sizeof(uint8_t));
+}
+void HwSharedExtBaroSet( uint8_t *NewExtBaro )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewExtBaro, offsetof( HwSharedData, ExtBaro), sizeof(uint8_t));
+}
+void HwSharedExtBaroGet( uint8_t *NewExtBaro )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewExtBaro, offsetof( HwSharedData, ExtBaro), sizeof(uint8_t));
+}
+void HwSharedMagSet( uint8_t *NewMag )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewMag, offsetof( HwSharedData, Mag), sizeof(uint8_t));
+}
+void HwSharedMagGet( uint8_t *NewMag )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewMag, offsetof( HwSharedData, Mag), sizeof(uint8_t));
+}
+void HwSharedMagOrientationSet( uint8_t *NewMagOrientation )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewMagOrientation, offsetof( HwSharedData, MagOrientation), sizeof(uint8_t));
+}
+void HwSharedMagOrientationGet( uint8_t *NewMagOrientation )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewMagOrientation, offsetof( HwSharedData, MagOrientation), sizeof(uint8_t));
+}
+void HwSharedUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewUSB_HIDPort, offsetof( HwSharedData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSharedUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewUSB_HIDPort, offsetof( HwSharedData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSharedUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewUSB_VCPPort, offsetof( HwSharedData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSharedUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewUSB_VCPPort, offsetof( HwSharedData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSharedRadioPortSet( uint8_t *NewRadioPort )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewRadioPort, offsetof( HwSharedData, RadioPort), sizeof(uint8_t));
+}
+void HwSharedRadioPortGet( uint8_t *NewRadioPort )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewRadioPort, offsetof( HwSharedData, RadioPort), sizeof(uint8_t));
+}
+void HwSharedMaxRfSpeedSet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewMaxRfSpeed, offsetof( HwSharedData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwSharedMaxRfSpeedGet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewMaxRfSpeed, offsetof( HwSharedData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwSharedMaxRfPowerSet( uint8_t *NewMaxRfPower )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewMaxRfPower, offsetof( HwSharedData, MaxRfPower), sizeof(uint8_t));
+}
+void HwSharedMaxRfPowerGet( uint8_t *NewMaxRfPower )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewMaxRfPower, offsetof( HwSharedData, MaxRfPower), sizeof(uint8_t));
+}
+void HwSharedDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewDSMxMode, offsetof( HwSharedData, DSMxMode), sizeof(uint8_t));
+}
+void HwSharedDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewDSMxMode, offsetof( HwSharedData, DSMxMode), sizeof(uint8_t));
+}
+void HwSharedRfBandSet( uint8_t *NewRfBand )
+{
+	UAVObjSetDataField(HwSharedHandle(), (void*)NewRfBand, offsetof( HwSharedData, RfBand), sizeof(uint8_t));
+}
+void HwSharedRfBandGet( uint8_t *NewRfBand )
+{
+	UAVObjGetDataField(HwSharedHandle(), (void*)NewRfBand, offsetof( HwSharedData, RfBand), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
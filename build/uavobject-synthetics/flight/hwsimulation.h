@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwSimulation HwSimulation
+ * @brief Simulation status.
+ *
+ *
+ * @file       hwsimulation.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwSimulation object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsimulation.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWSIMULATION_H
+#define HWSIMULATION_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define HWSIMULATION_OBJID 0x3A877112
+#define HWSIMULATION_ISSINGLEINST 1
+#define HWSIMULATION_ISSETTINGS 0
+#define HWSIMULATION_NUMBYTES 2
+
+// Generic interface functions
+int32_t HwSimulationInitialize();
+UAVObjHandle HwSimulationHandle();
+void HwSimulationSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t LedState[2];
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwSimulationData;
+
+// Typesafe Object access functions
+/**
+ * @function HwSimulationGet(dataOut)
+ * @brief Populate a HwSimulationData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwSimulationGet(HwSimulationData *dataOut) { return UAVObjGetData(HwSimulationHandle(), dataOut); }
+
+static inline int32_t HwSimulationSet(const HwSimulationData *dataIn) { return UAVObjSetData(HwSimulationHandle(), dataIn); }
+
+static inline int32_t HwSimulationInstGet(uint16_t instId, HwSimulationData *dataOut) { return UAVObjGetInstanceData(HwSimulationHandle(), instId, dataOut); }
+
+static inline int32_t HwSimulationInstSet(uint16_t instId, const HwSimulationData *dataIn) { return UAVObjSetInstanceData(HwSimulationHandle(), instId, dataIn); }
+
+static inline int32_t HwSimulationConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwSimulationHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSimulationConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwSimulationHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSimulationConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwSimulationHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSimulationConnectCopy(volatile HwSimulationData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwSimulationGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwSimulationHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwSimulationCreateInstance() { return UAVObjCreateInstance(HwSimulationHandle(), &HwSimulationSetDefaults); }
+
+static inline void HwSimulationUpdated() { UAVObjUpdated(HwSimulationHandle()); }
+
+static inline void HwSimulationInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwSimulationHandle(), instId); }
+
+static inline int32_t HwSimulationGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwSimulationHandle(), dataOut); }
+
+static inline int32_t HwSimulationSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwSimulationHandle(), dataIn); }
+
+static inline int8_t HwSimulationReadOnly() { return UAVObjReadOnly(HwSimulationHandle()); }
+
+static inline uint16_t HwSimulationGetNumInstances(){ return UAVObjGetNumInstances(HwSimulationHandle()); }
+
+static inline uint32_t HwSimulationGetNumBytes(){ return UAVObjGetNumBytes(HwSimulationHandle()); }
+
+// Field information
+// Field LedState information
+/* Enumeration options for field LedState */
+typedef enum { HWSIMULATION_LEDSTATE_OFF=0, HWSIMULATION_LEDSTATE_ON=1 }  __attribute__((packed)) HwSimulationLedStateOptions;
+#define HWSIMULATION_LEDSTATE_GLOBAL_MAXOPTVAL 1
+#define HWSIMULATION_LEDSTATE_MAXOPTVAL 1
+static inline bool HwSimulationLedStateIsValid( uint8_t CurrentLedState ) { return CurrentLedState <= HWSIMULATION_LEDSTATE_MAXOPTVAL; }
+typedef enum { HWSIMULATION_LEDSTATE_HEARTBEAT=0, HWSIMULATION_LEDSTATE_ALARM=1 } __attribute__((packed)) HwSimulationLedStateElem;
+#define HWSIMULATION_LEDSTATE_NUMELEM 2
+
+
+// set/Get functions
+extern void HwSimulationLedStateSet( uint8_t *NewLedState );
+extern void HwSimulationLedStateGet( uint8_t *NewLedState );
+
+
+#endif // HWSIMULATION_H
+
+/**
+ * @}
+ * @}
+ */
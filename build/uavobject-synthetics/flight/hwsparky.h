@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwSparky HwSparky
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwsparky.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwSparky object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsparky.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWSPARKY_H
+#define HWSPARKY_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWSPARKY_OBJID 0x7CC83FA
+#define HWSPARKY_ISSINGLEINST 1
+#define HWSPARKY_ISSETTINGS 1
+#define HWSPARKY_NUMBYTES 12
+
+// Generic interface functions
+int32_t HwSparkyInitialize();
+UAVObjHandle HwSparkyHandle();
+void HwSparkySetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RcvrPort;
+    uint8_t FlexiPort;
+    uint8_t MainPort;
+    uint8_t OutPort;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU9150DLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwSparkyData;
+
+// Typesafe Object access functions
+/**
+ * @function HwSparkyGet(dataOut)
+ * @brief Populate a HwSparkyData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwSparkyGet(HwSparkyData *dataOut) { return UAVObjGetData(HwSparkyHandle(), dataOut); }
+
+static inline int32_t HwSparkySet(const HwSparkyData *dataIn) { return UAVObjSetData(HwSparkyHandle(), dataIn); }
+
+static inline int32_t HwSparkyInstGet(uint16_t instId, HwSparkyData *dataOut) { return UAVObjGetInstanceData(HwSparkyHandle(), instId, dataOut); }
+
+static inline int32_t HwSparkyInstSet(uint16_t instId, const HwSparkyData *dataIn) { return UAVObjSetInstanceData(HwSparkyHandle(), instId, dataIn); }
+
+static inline int32_t HwSparkyConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwSparkyHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSparkyConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwSparkyHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSparkyConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwSparkyHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSparkyConnectCopy(volatile HwSparkyData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwSparkyGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwSparkyHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwSparkyCreateInstance() { return UAVObjCreateInstance(HwSparkyHandle(), &HwSparkySetDefaults); }
+
+static inline void HwSparkyUpdated() { UAVObjUpdated(HwSparkyHandle()); }
+
+static inline void HwSparkyInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwSparkyHandle(), instId); }
+
+static inline int32_t HwSparkyGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwSparkyHandle(), dataOut); }
+
+static inline int32_t HwSparkySetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwSparkyHandle(), dataIn); }
+
+static inline int8_t HwSparkyReadOnly() { return UAVObjReadOnly(HwSparkyHandle()); }
+
+static inline uint16_t HwSparkyGetNumInstances(){ return UAVObjGetNumInstances(HwSparkyHandle()); }
+
+static inline uint32_t HwSparkyGetNumBytes(){ return UAVObjGetNumBytes(HwSparkyHandle()); }
+
+// Field information
+// Field RcvrPort information
+/* Enumeration options for field RcvrPort */
+typedef enum { HWSPARKY_RCVRPORT_DISABLED=0, HWSPARKY_RCVRPORT_DSM=3, HWSPARKY_RCVRPORT_SRXL=6, HWSPARKY_RCVRPORT_HOTTSUMD=13, HWSPARKY_RCVRPORT_HOTTSUMH=14, HWSPARKY_RCVRPORT_PPM=25, HWSPARKY_RCVRPORT_SBUS=4, HWSPARKY_RCVRPORT_SBUSNONINVERTED=5, HWSPARKY_RCVRPORT_IBUS=7, HWSPARKY_RCVRPORT_TBSCROSSFIRE=23, HWSPARKY_RCVRPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyRcvrPortOptions;
+#define HWSPARKY_RCVRPORT_GLOBAL_MAXOPTVAL 26
+#define HWSPARKY_RCVRPORT_MAXOPTVAL 25
+static inline bool HwSparkyRcvrPortIsValid( uint8_t CurrentRcvrPort ) { return CurrentRcvrPort <= HWSPARKY_RCVRPORT_MAXOPTVAL; }
+// Field FlexiPort information
+/* Enumeration options for field FlexiPort */
+typedef enum { HWSPARKY_FLEXIPORT_DISABLED=0, HWSPARKY_FLEXIPORT_COMBRIDGE=9, HWSPARKY_FLEXIPORT_DEBUGCONSOLE=8, HWSPARKY_FLEXIPORT_DSM=3, HWSPARKY_FLEXIPORT_FRSKYSENSORHUB=16, HWSPARKY_FLEXIPORT_FRSKYSPORTTELEMETRY=17, HWSPARKY_FLEXIPORT_FRSKYSPORTNONINVERTED=18, HWSPARKY_FLEXIPORT_GPS=2, HWSPARKY_FLEXIPORT_HOTTTELEMETRY=15, HWSPARKY_FLEXIPORT_I2C=24, HWSPARKY_FLEXIPORT_LIGHTTELEMETRYTX=19, HWSPARKY_FLEXIPORT_SRXL=6, HWSPARKY_FLEXIPORT_MAVLINKTX=10, HWSPARKY_FLEXIPORT_MAVLINKTX_GPS_RX=11, HWSPARKY_FLEXIPORT_MSP=12, HWSPARKY_FLEXIPORT_OPENLOG=20, HWSPARKY_FLEXIPORT_SBUS=4, HWSPARKY_FLEXIPORT_SBUSNONINVERTED=5, HWSPARKY_FLEXIPORT_STORM32BGC=21, HWSPARKY_FLEXIPORT_TELEMETRY=1, HWSPARKY_FLEXIPORT_IBUS=7, HWSPARKY_FLEXIPORT_TBSCROSSFIRE=23, HWSPARKY_FLEXIPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyFlexiPortOptions;
+#define HWSPARKY_FLEXIPORT_GLOBAL_MAXOPTVAL 26
+#define HWSPARKY_FLEXIPORT_MAXOPTVAL 24
+static inline bool HwSparkyFlexiPortIsValid( uint8_t CurrentFlexiPort ) { return CurrentFlexiPort <= HWSPARKY_FLEXIPORT_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWSPARKY_MAINPORT_DISABLED=0, HWSPARKY_MAINPORT_COMBRIDGE=9, HWSPARKY_MAINPORT_DEBUGCONSOLE=8, HWSPARKY_MAINPORT_DSM=3, HWSPARKY_MAINPORT_FRSKYSENSORHUB=16, HWSPARKY_MAINPORT_FRSKYSPORTTELEMETRY=17, HWSPARKY_MAINPORT_FRSKYSPORTNONINVERTED=18, HWSPARKY_MAINPORT_GPS=2, HWSPARKY_MAINPORT_HOTTTELEMETRY=15, HWSPARKY_MAINPORT_LIGHTTELEMETRYTX=19, HWSPARKY_MAINPORT_SRXL=6, HWSPARKY_MAINPORT_MAVLINKTX=10, HWSPARKY_MAINPORT_MAVLINKTX_GPS_RX=11, HWSPARKY_MAINPORT_MSP=12, HWSPARKY_MAINPORT_OPENLOG=20, HWSPARKY_MAINPORT_SBUSNONINVERTED=5, HWSPARKY_MAINPORT_STORM32BGC=21, HWSPARKY_MAINPORT_TELEMETRY=1, HWSPARKY_MAINPORT_IBUS=7, HWSPARKY_MAINPORT_TBSCROSSFIRE=23, HWSPARKY_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyMainPortOptions;
+#define HWSPARKY_MAINPORT_GLOBAL_MAXOPTVAL 26
+#define HWSPARKY_MAINPORT_MAXOPTVAL 23
+static inline bool HwSparkyMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort <= HWSPARKY_MAINPORT_MAXOPTVAL; }
+// Field OutPort information
+/* Enumeration options for field OutPort */
+typedef enum { HWSPARKY_OUTPORT_PWM10=0, HWSPARKY_OUTPORT_PWM9PWM_IN=1, HWSPARKY_OUTPORT_PWM82ADC=2, HWSPARKY_OUTPORT_PWM73ADC=3, HWSPARKY_OUTPORT_PWM72ADCPWM_IN=4 }  __attribute__((packed)) HwSparkyOutPortOptions;
+#define HWSPARKY_OUTPORT_GLOBAL_MAXOPTVAL 4
+#define HWSPARKY_OUTPORT_MAXOPTVAL 4
+static inline bool HwSparkyOutPortIsValid( uint8_t CurrentOutPort ) { return CurrentOutPort <= HWSPARKY_OUTPORT_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWSPARKY_USB_HIDPORT_USBTELEMETRY=0, HWSPARKY_USB_HIDPORT_DISABLED=1, HWSPARKY_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyUSB_HIDPortOptions;
+#define HWSPARKY_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWSPARKY_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwSparkyUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWSPARKY_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWSPARKY_USB_VCPPORT_USBTELEMETRY=0, HWSPARKY_USB_VCPPORT_COMBRIDGE=1, HWSPARKY_USB_VCPPORT_DEBUGCONSOLE=2, HWSPARKY_USB_VCPPORT_MSP=3, HWSPARKY_USB_VCPPORT_DISABLED=4, HWSPARKY_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyUSB_VCPPortOptions;
+#define HWSPARKY_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWSPARKY_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwSparkyUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWSPARKY_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWSPARKY_DSMXMODE_AUTODETECT=0, HWSPARKY_DSMXMODE_FORCE10BIT=1, HWSPARKY_DSMXMODE_FORCE11BIT=2, HWSPARKY_DSMXMODE_BIND3PULSES=3, HWSPARKY_DSMXMODE_BIND4PULSES=4, HWSPARKY_DSMXMODE_BIND5PULSES=5, HWSPARKY_DSMXMODE_BIND6PULSES=6, HWSPARKY_DSMXMODE_BIND7PULSES=7, HWSPARKY_DSMXMODE_BIND8PULSES=8, HWSPARKY_DSMXMODE_BIND9PULSES=9, HWSPARKY_DSMXMODE_BIND10PULSES=10, HWSPARKY_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyDSMxModeOptions;
+#define HWSPARKY_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWSPARKY_DSMXMODE_MAXOPTVAL 10
+static inline bool HwSparkyDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWSPARKY_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWSPARKY_GYRORANGE_250=0, HWSPARKY_GYRORANGE_500=1, HWSPARKY_GYRORANGE_1000=2, HWSPARKY_GYRORANGE_2000=3 }  __attribute__((packed)) HwSparkyGyroRangeOptions;
+#define HWSPARKY_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWSPARKY_GYRORANGE_MAXOPTVAL 3
+static inline bool HwSparkyGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWSPARKY_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWSPARKY_ACCELRANGE_2G=0, HWSPARKY_ACCELRANGE_4G=1, HWSPARKY_ACCELRANGE_8G=2, HWSPARKY_ACCELRANGE_16G=3 }  __attribute__((packed)) HwSparkyAccelRangeOptions;
+#define HWSPARKY_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWSPARKY_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwSparkyAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWSPARKY_ACCELRANGE_MAXOPTVAL; }
+// Field MPU9150DLPF information
+/* Enumeration options for field MPU9150DLPF */
+typedef enum { HWSPARKY_MPU9150DLPF_188=0, HWSPARKY_MPU9150DLPF_98=1, HWSPARKY_MPU9150DLPF_42=2, HWSPARKY_MPU9150DLPF_20=3, HWSPARKY_MPU9150DLPF_10=4, HWSPARKY_MPU9150DLPF_5=5 }  __attribute__((packed)) HwSparkyMPU9150DLPFOptions;
+#define HWSPARKY_MPU9150DLPF_GLOBAL_MAXOPTVAL 5
+#define HWSPARKY_MPU9150DLPF_MAXOPTVAL 5
+static inline bool HwSparkyMPU9150DLPFIsValid( uint8_t CurrentMPU9150DLPF ) { return CurrentMPU9150DLPF <= HWSPARKY_MPU9150DLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWSPARKY_MAGNETOMETER_NONE=0, HWSPARKY_MAGNETOMETER_INTERNAL=1, HWSPARKY_MAGNETOMETER_EXTERNALHMC5883=2, HWSPARKY_MAGNETOMETER_EXTERNALHMC5983=3, HWSPARKY_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyMagnetometerOptions;
+#define HWSPARKY_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWSPARKY_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwSparkyMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWSPARKY_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWSPARKY_EXTMAGORIENTATION_TOP0DEGCW=0, HWSPARKY_EXTMAGORIENTATION_TOP90DEGCW=1, HWSPARKY_EXTMAGORIENTATION_TOP180DEGCW=2, HWSPARKY_EXTMAGORIENTATION_TOP270DEGCW=3, HWSPARKY_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWSPARKY_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWSPARKY_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWSPARKY_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWSPARKY_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSparkyExtMagOrientationOptions;
+#define HWSPARKY_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWSPARKY_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwSparkyExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWSPARKY_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwSparkyRcvrPortSet( uint8_t *NewRcvrPort );
+extern void HwSparkyRcvrPortGet( uint8_t *NewRcvrPort );
+extern void HwSparkyFlexiPortSet( uint8_t *NewFlexiPort );
+extern void HwSparkyFlexiPortGet( uint8_t *NewFlexiPort );
+extern void HwSparkyMainPortSet( uint8_t *NewMainPort );
+extern void HwSparkyMainPortGet( uint8_t *NewMainPort );
+extern void HwSparkyOutPortSet( uint8_t *NewOutPort );
+extern void HwSparkyOutPortGet( uint8_t *NewOutPort );
+extern void HwSparkyUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwSparkyUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwSparkyUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwSparkyUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwSparkyDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwSparkyDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwSparkyGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwSparkyGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwSparkyAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwSparkyAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwSparkyMPU9150DLPFSet( uint8_t *NewMPU9150DLPF );
+extern void HwSparkyMPU9150DLPFGet( uint8_t *NewMPU9150DLPF );
+extern void HwSparkyMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwSparkyMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwSparkyExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwSparkyExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWSPARKY_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwsparky2.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwSparky2 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsparky2.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwsparky2.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwSparky2Data defaultData = {
+	.CoordID = 0,
+	.RcvrPort = 0,
+	.MainPort = 0,
+	.FlexiPort = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.Radio = 0,
+	.MaxRfSpeed = 3,
+	.MaxRfPower = 1,
+	.RfBand = 0,
+	.MinChannel = 0,
+	.MaxChannel = 250,
+	.GyroRange = 3,
+	.AccelRange = 2,
+	.MPU9250GyroLPF = 0,
+	.VTX_Ch = 0,
+	.Magnetometer = 1,
+	.ExtMagOrientation = 0,
+	.ExtMagPort = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSparky2Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWSPARKY2_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWSPARKY2_OBJID,
+			HWSPARKY2_ISSINGLEINST, HWSPARKY2_ISSETTINGS, HWSPARKY2_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwSparky2SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwSparky2Data data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwSparky2SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSparky2SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwSparky2SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwSparky2SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSparky2Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSparky2CoordIDSet( uint32_t *NewCoordID )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewCoordID, offsetof( HwSparky2Data, CoordID), sizeof(uint32_t));
+}
+void HwSparky2CoordIDGet( uint32_t *NewCoordID )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewCoordID, offsetof( HwSparky2Data, CoordID), sizeof(uint32_t));
+}
+void HwSparky2RcvrPortSet( uint8_t *NewRcvrPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewRcvrPort, offsetof( HwSparky2Data, RcvrPort), sizeof(uint8_t));
+}
+void HwSparky2RcvrPortGet( uint8_t *NewRcvrPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewRcvrPort, offsetof( HwSparky2Data, RcvrPort), sizeof(uint8_t));
+}
+void HwSparky2MainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMainPort, offsetof( HwSparky2Data, MainPort), sizeof(uint8_t));
+}
+void HwSparky2MainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMainPort, offsetof( HwSparky2Data, MainPort), sizeof(uint8_t));
+}
+void HwSparky2FlexiPortSet( uint8_t *NewFlexiPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewFlexiPort, offsetof( HwSparky2Data, FlexiPort), sizeof(uint8_t));
+}
+void HwSparky2FlexiPortGet( uint8_t *NewFlexiPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewFlexiPort, offsetof( HwSparky2Data, FlexiPort), sizeof(uint8_t));
+}
+void HwSparky2USB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewUSB_HIDPort, offsetof( HwSparky2Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSparky2USB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewUSB_HIDPort, offsetof( HwSparky2Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSparky2USB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewUSB_VCPPort, offsetof( HwSparky2Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSparky2USB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewUSB_VCPPort, offsetof( HwSparky2Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSparky2DSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewDSMxMode, offsetof( HwSparky2Data, DSMxMode), sizeof(uint8_t));
+}
+void HwSparky2DSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewDSMxMode, offsetof( HwSparky2Data, DSMxMode), sizeof(uint8_t));
+}
+void HwSparky2RadioSet( uint8_t *NewRadio )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewRadio, offsetof( HwSparky2Data, Radio), sizeof(uint8_t));
+}
+void HwSparky2RadioGet( uint8_t *NewRadio )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewRadio, offsetof( HwSparky2Data, Radio), sizeof(uint8_t));
+}
+void HwSparky2MaxRfSpeedSet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMaxRfSpeed, offsetof( HwSparky2Data, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwSparky2MaxRfSpeedGet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMaxRfSpeed, offsetof( HwSparky2Data, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwSparky2MaxRfPowerSet( uint8_t *NewMaxRfPower )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMaxRfPower, offsetof( HwSparky2Data, MaxRfPower), sizeof(uint8_t));
+}
+void HwSparky2MaxRfPowerGet( uint8_t *NewMaxRfPower )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMaxRfPower, offsetof( HwSparky2Data, MaxRfPower), sizeof(uint8_t));
+}
+void HwSparky2RfBandSet( uint8_t *NewRfBand )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewRfBand, offsetof( HwSparky2Data, RfBand), sizeof(uint8_t));
+}
+void HwSparky2RfBandGet( uint8_t *NewRfBand )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewRfBand, offsetof( HwSparky2Data, RfBand), sizeof(uint8_t));
+}
+void HwSparky2MinChannelSet( uint8_t *NewMinChannel )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMinChannel, offsetof( HwSparky2Data, MinChannel), sizeof(uint8_t));
+}
+void HwSparky2MinChannelGet( uint8_t *NewMinChannel )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMinChannel, offsetof( HwSparky2Data, MinChannel), sizeof(uint8_t));
+}
+void HwSparky2MaxChannelSet( uint8_t *NewMaxChannel )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMaxChannel, offsetof( HwSparky2Data, MaxChannel), sizeof(uint8_t));
+}
+void HwSparky2MaxChannelGet( uint8_t *NewMaxChannel )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMaxChannel, offsetof( HwSparky2Data, MaxChannel), sizeof(uint8_t));
+}
+void HwSparky2GyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewGyroRange, offsetof( HwSparky2Data, GyroRange), sizeof(uint8_t));
+}
+void HwSparky2GyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewGyroRange, offsetof( HwSparky2Data, GyroRange), sizeof(uint8_t));
+}
+void HwSparky2AccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewAccelRange, offsetof( HwSparky2Data, AccelRange), sizeof(uint8_t));
+}
+void HwSparky2AccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewAccelRange, offsetof( HwSparky2Data, AccelRange), sizeof(uint8_t));
+}
+void HwSparky2MPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMPU9250GyroLPF, offsetof( HwSparky2Data, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwSparky2MPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMPU9250GyroLPF, offsetof( HwSparky2Data, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwSparky2VTX_ChSet( uint8_t *NewVTX_Ch )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewVTX_Ch, offsetof( HwSparky2Data, VTX_Ch), sizeof(uint8_t));
+}
+void HwSparky2VTX_ChGet( uint8_t *NewVTX_Ch )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewVTX_Ch, offsetof( HwSparky2Data, VTX_Ch), sizeof(uint8_t));
+}
+void HwSparky2MagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewMagnetometer, offsetof( HwSparky2Data, Magnetometer), sizeof(uint8_t));
+}
+void HwSparky2MagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewMagnetometer, offsetof( HwSparky2Data, Magnetometer), sizeof(uint8_t));
+}
+void HwSparky2ExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewExtMagOrientation, offsetof( HwSparky2Data, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwSparky2ExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewExtMagOrientation, offsetof( HwSparky2Data, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwSparky2ExtMagPortSet( uint8_t *NewExtMagPort )
+{
+	UAVObjSetDataField(HwSparky2Handle(), (void*)NewExtMagPort, offsetof( HwSparky2Data, ExtMagPort), sizeof(uint8_t));
+}
+void HwSparky2ExtMagPortGet( uint8_t *NewExtMagPort )
+{
+	UAVObjGetDataField(HwSparky2Handle(), (void*)NewExtMagPort, offsetof( HwSparky2Data, ExtMagPort), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
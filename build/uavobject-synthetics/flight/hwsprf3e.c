@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwsprf3e.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwSprf3e object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsprf3e.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwsprf3e.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwSprf3eData defaultData = {
+	.Uart1 = 0,
+	.Uart2 = 0,
+	.Uart3 = 0,
+	.USB_HIDPort = 0,
+	.USB_VCPPort = 4,
+	.DSMxMode = 0,
+	.GyroRange = 3,
+	.AccelRange = 2,
+	.MPU9250GyroLPF = 0,
+	.MPU9250AccelLPF = 1,
+	.Magnetometer = 1,
+	.ExtMagOrientation = 0,
+	.Barometer = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSprf3eInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWSPRF3E_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWSPRF3E_OBJID,
+			HWSPRF3E_ISSINGLEINST, HWSPRF3E_ISSETTINGS, HWSPRF3E_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwSprf3eSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwSprf3eData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwSprf3eSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSprf3eSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwSprf3eSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwSprf3eSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSprf3eHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSprf3eUart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewUart1, offsetof( HwSprf3eData, Uart1), sizeof(uint8_t));
+}
+void HwSprf3eUart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewUart1, offsetof( HwSprf3eData, Uart1), sizeof(uint8_t));
+}
+void HwSprf3eUart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewUart2, offsetof( HwSprf3eData, Uart2), sizeof(uint8_t));
+}
+void HwSprf3eUart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewUart2, offsetof( HwSprf3eData, Uart2), sizeof(uint8_t));
+}
+void HwSprf3eUart3Set( uint8_t *NewUart3 )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewUart3, offsetof( HwSprf3eData, Uart3), sizeof(uint8_t));
+}
+void HwSprf3eUart3Get( uint8_t *NewUart3 )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewUart3, offsetof( HwSprf3eData, Uart3), sizeof(uint8_t));
+}
+void HwSprf3eUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewUSB_HIDPort, offsetof( HwSprf3eData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSprf3eUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewUSB_HIDPort, offsetof( HwSprf3eData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSprf3eUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewUSB_VCPPort, offsetof( HwSprf3eData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSprf3eUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewUSB_VCPPort, offsetof( HwSprf3eData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSprf3eDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewDSMxMode, offsetof( HwSprf3eData, DSMxMode), sizeof(uint8_t));
+}
+void HwSprf3eDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewDSMxMode, offsetof( HwSprf3eData, DSMxMode), sizeof(uint8_t));
+}
+void HwSprf3eGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewGyroRange, offsetof( HwSprf3eData, GyroRange), sizeof(uint8_t));
+}
+void HwSprf3eGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewGyroRange, offsetof( HwSprf3eData, GyroRange), sizeof(uint8_t));
+}
+void HwSprf3eAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewAccelRange, offsetof( HwSprf3eData, AccelRange), sizeof(uint8_t));
+}
+void HwSprf3eAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewAccelRange, offsetof( HwSprf3eData, AccelRange), sizeof(uint8_t));
+}
+void HwSprf3eMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewMPU9250GyroLPF, offsetof( HwSprf3eData, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwSprf3eMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewMPU9250GyroLPF, offsetof( HwSprf3eData, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwSprf3eMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewMPU9250AccelLPF, offsetof( HwSprf3eData, MPU9250AccelLPF), sizeof(uint8_t));
+}
+void HwSprf3eMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewMPU9250AccelLPF, offsetof( HwSprf3eData, MPU9250AccelLPF), sizeof(uint8_t));
+}
+void HwSprf3eMagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewMagnetometer, offsetof( HwSprf3eData, Magnetometer), sizeof(uint8_t));
+}
+void HwSprf3eMagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewMagnetometer, offsetof( HwSprf3eData, Magnetometer), sizeof(uint8_t));
+}
+void HwSprf3eExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewExtMagOrientation, offsetof( HwSprf3eData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwSprf3eExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewExtMagOrientation, offsetof( HwSprf3eData, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwSprf3eBarometerSet( uint8_t *NewBarometer )
+{
+	UAVObjSetDataField(HwSprf3eHandle(), (void*)NewBarometer, offsetof( HwSprf3eData, Barometer), sizeof(uint8_t));
+}
+void HwSprf3eBarometerGet( uint8_t *NewBarometer )
+{
+	UAVObjGetDataField(HwSprf3eHandle(), (void*)NewBarometer, offsetof( HwSprf3eData, Barometer), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
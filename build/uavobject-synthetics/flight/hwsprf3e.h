@@ -0,0 +1,234 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwSprf3e HwSprf3e
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwsprf3e.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwSprf3e object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsprf3e.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWSPRF3E_H
+#define HWSPRF3E_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWSPRF3E_OBJID 0xA726E0B2
+#define HWSPRF3E_ISSINGLEINST 1
+#define HWSPRF3E_ISSETTINGS 1
+#define HWSPRF3E_NUMBYTES 13
+
+// Generic interface functions
+int32_t HwSprf3eInitialize();
+UAVObjHandle HwSprf3eHandle();
+void HwSprf3eSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t Uart1;
+    uint8_t Uart2;
+    uint8_t Uart3;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU9250GyroLPF;
+    uint8_t MPU9250AccelLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+    uint8_t Barometer;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwSprf3eData;
+
+// Typesafe Object access functions
+/**
+ * @function HwSprf3eGet(dataOut)
+ * @brief Populate a HwSprf3eData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwSprf3eGet(HwSprf3eData *dataOut) { return UAVObjGetData(HwSprf3eHandle(), dataOut); }
+
+static inline int32_t HwSprf3eSet(const HwSprf3eData *dataIn) { return UAVObjSetData(HwSprf3eHandle(), dataIn); }
+
+static inline int32_t HwSprf3eInstGet(uint16_t instId, HwSprf3eData *dataOut) { return UAVObjGetInstanceData(HwSprf3eHandle(), instId, dataOut); }
+
+static inline int32_t HwSprf3eInstSet(uint16_t instId, const HwSprf3eData *dataIn) { return UAVObjSetInstanceData(HwSprf3eHandle(), instId, dataIn); }
+
+static inline int32_t HwSprf3eConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwSprf3eHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSprf3eConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwSprf3eHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSprf3eConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwSprf3eHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwSprf3eConnectCopy(volatile HwSprf3eData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwSprf3eGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwSprf3eHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwSprf3eCreateInstance() { return UAVObjCreateInstance(HwSprf3eHandle(), &HwSprf3eSetDefaults); }
+
+static inline void HwSprf3eUpdated() { UAVObjUpdated(HwSprf3eHandle()); }
+
+static inline void HwSprf3eInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwSprf3eHandle(), instId); }
+
+static inline int32_t HwSprf3eGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwSprf3eHandle(), dataOut); }
+
+static inline int32_t HwSprf3eSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwSprf3eHandle(), dataIn); }
+
+static inline int8_t HwSprf3eReadOnly() { return UAVObjReadOnly(HwSprf3eHandle()); }
+
+static inline uint16_t HwSprf3eGetNumInstances(){ return UAVObjGetNumInstances(HwSprf3eHandle()); }
+
+static inline uint32_t HwSprf3eGetNumBytes(){ return UAVObjGetNumBytes(HwSprf3eHandle()); }
+
+// Field information
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWSPRF3E_UART1_DISABLED=0, HWSPRF3E_UART1_DSM=3, HWSPRF3E_UART1_SRXL=6, HWSPRF3E_UART1_HOTTSUMD=13, HWSPRF3E_UART1_HOTTSUMH=14, HWSPRF3E_UART1_SBUS=4, HWSPRF3E_UART1_SBUSNONINVERTED=5, HWSPRF3E_UART1_IBUS=7, HWSPRF3E_UART1_COMBRIDGE=9, HWSPRF3E_UART1_DEBUGCONSOLE=8, HWSPRF3E_UART1_FRSKYSENSORHUB=16, HWSPRF3E_UART1_FRSKYSPORTTELEMETRY=17, HWSPRF3E_UART1_GPS=2, HWSPRF3E_UART1_HOTTTELEMETRY=15, HWSPRF3E_UART1_I2C=24, HWSPRF3E_UART1_LIGHTTELEMETRYTX=19, HWSPRF3E_UART1_MAVLINKTX=10, HWSPRF3E_UART1_MAVLINKTX_GPS_RX=11, HWSPRF3E_UART1_MSP=12, HWSPRF3E_UART1_OPENLOG=20, HWSPRF3E_UART1_STORM32BGC=21, HWSPRF3E_UART1_TELEMETRY=1, HWSPRF3E_UART1_TBSCROSSFIRE=23, HWSPRF3E_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eUart1Options;
+#define HWSPRF3E_UART1_GLOBAL_MAXOPTVAL 26
+#define HWSPRF3E_UART1_MAXOPTVAL 24
+static inline bool HwSprf3eUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 <= HWSPRF3E_UART1_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWSPRF3E_UART2_DISABLED=0, HWSPRF3E_UART2_DSM=3, HWSPRF3E_UART2_SRXL=6, HWSPRF3E_UART2_HOTTSUMD=13, HWSPRF3E_UART2_HOTTSUMH=14, HWSPRF3E_UART2_PPM=25, HWSPRF3E_UART2_SBUS=4, HWSPRF3E_UART2_SBUSNONINVERTED=5, HWSPRF3E_UART2_IBUS=7, HWSPRF3E_UART2_COMBRIDGE=9, HWSPRF3E_UART2_DEBUGCONSOLE=8, HWSPRF3E_UART2_FRSKYSENSORHUB=16, HWSPRF3E_UART2_FRSKYSPORTTELEMETRY=17, HWSPRF3E_UART2_GPS=2, HWSPRF3E_UART2_HOTTTELEMETRY=15, HWSPRF3E_UART2_I2C=24, HWSPRF3E_UART2_LIGHTTELEMETRYTX=19, HWSPRF3E_UART2_MAVLINKTX=10, HWSPRF3E_UART2_MAVLINKTX_GPS_RX=11, HWSPRF3E_UART2_MSP=12, HWSPRF3E_UART2_OPENLOG=20, HWSPRF3E_UART2_STORM32BGC=21, HWSPRF3E_UART2_TELEMETRY=1, HWSPRF3E_UART2_TBSCROSSFIRE=23, HWSPRF3E_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eUart2Options;
+#define HWSPRF3E_UART2_GLOBAL_MAXOPTVAL 26
+#define HWSPRF3E_UART2_MAXOPTVAL 25
+static inline bool HwSprf3eUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 <= HWSPRF3E_UART2_MAXOPTVAL; }
+// Field Uart3 information
+/* Enumeration options for field Uart3 */
+typedef enum { HWSPRF3E_UART3_DISABLED=0, HWSPRF3E_UART3_COMBRIDGE=9, HWSPRF3E_UART3_DEBUGCONSOLE=8, HWSPRF3E_UART3_DSM=3, HWSPRF3E_UART3_SRXL=6, HWSPRF3E_UART3_HOTTSUMD=13, HWSPRF3E_UART3_HOTTSUMH=14, HWSPRF3E_UART3_FRSKYSENSORHUB=16, HWSPRF3E_UART3_FRSKYSPORTTELEMETRY=17, HWSPRF3E_UART3_GPS=2, HWSPRF3E_UART3_HOTTTELEMETRY=15, HWSPRF3E_UART3_LIGHTTELEMETRYTX=19, HWSPRF3E_UART3_MAVLINKTX=10, HWSPRF3E_UART3_MAVLINKTX_GPS_RX=11, HWSPRF3E_UART3_MSP=12, HWSPRF3E_UART3_OPENLOG=20, HWSPRF3E_UART3_SBUS=4, HWSPRF3E_UART3_SBUSNONINVERTED=5, HWSPRF3E_UART3_STORM32BGC=21, HWSPRF3E_UART3_TELEMETRY=1, HWSPRF3E_UART3_IBUS=7, HWSPRF3E_UART3_TBSCROSSFIRE=23, HWSPRF3E_UART3_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eUart3Options;
+#define HWSPRF3E_UART3_GLOBAL_MAXOPTVAL 26
+#define HWSPRF3E_UART3_MAXOPTVAL 23
+static inline bool HwSprf3eUart3IsValid( uint8_t CurrentUart3 ) { return CurrentUart3 <= HWSPRF3E_UART3_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWSPRF3E_USB_HIDPORT_USBTELEMETRY=0, HWSPRF3E_USB_HIDPORT_DISABLED=1, HWSPRF3E_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eUSB_HIDPortOptions;
+#define HWSPRF3E_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+#define HWSPRF3E_USB_HIDPORT_MAXOPTVAL 1
+static inline bool HwSprf3eUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort <= HWSPRF3E_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWSPRF3E_USB_VCPPORT_USBTELEMETRY=0, HWSPRF3E_USB_VCPPORT_COMBRIDGE=1, HWSPRF3E_USB_VCPPORT_DEBUGCONSOLE=2, HWSPRF3E_USB_VCPPORT_MSP=3, HWSPRF3E_USB_VCPPORT_DISABLED=4, HWSPRF3E_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eUSB_VCPPortOptions;
+#define HWSPRF3E_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWSPRF3E_USB_VCPPORT_MAXOPTVAL 4
+static inline bool HwSprf3eUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort <= HWSPRF3E_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWSPRF3E_DSMXMODE_AUTODETECT=0, HWSPRF3E_DSMXMODE_FORCE10BIT=1, HWSPRF3E_DSMXMODE_FORCE11BIT=2, HWSPRF3E_DSMXMODE_BIND3PULSES=3, HWSPRF3E_DSMXMODE_BIND4PULSES=4, HWSPRF3E_DSMXMODE_BIND5PULSES=5, HWSPRF3E_DSMXMODE_BIND6PULSES=6, HWSPRF3E_DSMXMODE_BIND7PULSES=7, HWSPRF3E_DSMXMODE_BIND8PULSES=8, HWSPRF3E_DSMXMODE_BIND9PULSES=9, HWSPRF3E_DSMXMODE_BIND10PULSES=10, HWSPRF3E_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eDSMxModeOptions;
+#define HWSPRF3E_DSMXMODE_GLOBAL_MAXOPTVAL 10
+#define HWSPRF3E_DSMXMODE_MAXOPTVAL 10
+static inline bool HwSprf3eDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode <= HWSPRF3E_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWSPRF3E_GYRORANGE_250=0, HWSPRF3E_GYRORANGE_500=1, HWSPRF3E_GYRORANGE_1000=2, HWSPRF3E_GYRORANGE_2000=3 }  __attribute__((packed)) HwSprf3eGyroRangeOptions;
+#define HWSPRF3E_GYRORANGE_GLOBAL_MAXOPTVAL 3
+#define HWSPRF3E_GYRORANGE_MAXOPTVAL 3
+static inline bool HwSprf3eGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange <= HWSPRF3E_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWSPRF3E_ACCELRANGE_2G=0, HWSPRF3E_ACCELRANGE_4G=1, HWSPRF3E_ACCELRANGE_8G=2, HWSPRF3E_ACCELRANGE_16G=3 }  __attribute__((packed)) HwSprf3eAccelRangeOptions;
+#define HWSPRF3E_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+#define HWSPRF3E_ACCELRANGE_MAXOPTVAL 3
+static inline bool HwSprf3eAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange <= HWSPRF3E_ACCELRANGE_MAXOPTVAL; }
+// Field MPU9250GyroLPF information
+/* Enumeration options for field MPU9250GyroLPF */
+typedef enum { HWSPRF3E_MPU9250GYROLPF_184=0, HWSPRF3E_MPU9250GYROLPF_92=1, HWSPRF3E_MPU9250GYROLPF_41=2, HWSPRF3E_MPU9250GYROLPF_20=3, HWSPRF3E_MPU9250GYROLPF_10=4, HWSPRF3E_MPU9250GYROLPF_5=5 }  __attribute__((packed)) HwSprf3eMPU9250GyroLPFOptions;
+#define HWSPRF3E_MPU9250GYROLPF_GLOBAL_MAXOPTVAL 5
+#define HWSPRF3E_MPU9250GYROLPF_MAXOPTVAL 5
+static inline bool HwSprf3eMPU9250GyroLPFIsValid( uint8_t CurrentMPU9250GyroLPF ) { return CurrentMPU9250GyroLPF <= HWSPRF3E_MPU9250GYROLPF_MAXOPTVAL; }
+// Field MPU9250AccelLPF information
+/* Enumeration options for field MPU9250AccelLPF */
+typedef enum { HWSPRF3E_MPU9250ACCELLPF_460=0, HWSPRF3E_MPU9250ACCELLPF_184=1, HWSPRF3E_MPU9250ACCELLPF_92=2, HWSPRF3E_MPU9250ACCELLPF_41=3, HWSPRF3E_MPU9250ACCELLPF_20=4, HWSPRF3E_MPU9250ACCELLPF_10=5, HWSPRF3E_MPU9250ACCELLPF_5=6 }  __attribute__((packed)) HwSprf3eMPU9250AccelLPFOptions;
+#define HWSPRF3E_MPU9250ACCELLPF_GLOBAL_MAXOPTVAL 6
+#define HWSPRF3E_MPU9250ACCELLPF_MAXOPTVAL 6
+static inline bool HwSprf3eMPU9250AccelLPFIsValid( uint8_t CurrentMPU9250AccelLPF ) { return CurrentMPU9250AccelLPF <= HWSPRF3E_MPU9250ACCELLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWSPRF3E_MAGNETOMETER_NONE=0, HWSPRF3E_MAGNETOMETER_INTERNAL=1, HWSPRF3E_MAGNETOMETER_EXTERNALHMC5883=2, HWSPRF3E_MAGNETOMETER_EXTERNALHMC5983=3, HWSPRF3E_MAGNETOMETER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eMagnetometerOptions;
+#define HWSPRF3E_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+#define HWSPRF3E_MAGNETOMETER_MAXOPTVAL 3
+static inline bool HwSprf3eMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer <= HWSPRF3E_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWSPRF3E_EXTMAGORIENTATION_TOP0DEGCW=0, HWSPRF3E_EXTMAGORIENTATION_TOP90DEGCW=1, HWSPRF3E_EXTMAGORIENTATION_TOP180DEGCW=2, HWSPRF3E_EXTMAGORIENTATION_TOP270DEGCW=3, HWSPRF3E_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWSPRF3E_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWSPRF3E_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWSPRF3E_EXTMAGORIENTATION_BOTTOM270DEGCW=7, HWSPRF3E_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwSprf3eExtMagOrientationOptions;
+#define HWSPRF3E_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+#define HWSPRF3E_EXTMAGORIENTATION_MAXOPTVAL 7
+static inline bool HwSprf3eExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation <= HWSPRF3E_EXTMAGORIENTATION_MAXOPTVAL; }
+// Field Barometer information
+/* Enumeration options for field Barometer */
+typedef enum { HWSPRF3E_BAROMETER_DISABLED=0, HWSPRF3E_BAROMETER_BMP280=1 }  __attribute__((packed)) HwSprf3eBarometerOptions;
+#define HWSPRF3E_BAROMETER_GLOBAL_MAXOPTVAL 1
+#define HWSPRF3E_BAROMETER_MAXOPTVAL 1
+static inline bool HwSprf3eBarometerIsValid( uint8_t CurrentBarometer ) { return CurrentBarometer <= HWSPRF3E_BAROMETER_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwSprf3eUart1Set( uint8_t *NewUart1 );
+extern void HwSprf3eUart1Get( uint8_t *NewUart1 );
+extern void HwSprf3eUart2Set( uint8_t *NewUart2 );
+extern void HwSprf3eUart2Get( uint8_t *NewUart2 );
+extern void HwSprf3eUart3Set( uint8_t *NewUart3 );
+extern void HwSprf3eUart3Get( uint8_t *NewUart3 );
+extern void HwSprf3eUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwSprf3eUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwSprf3eUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwSprf3eUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwSprf3eDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwSprf3eDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwSprf3eGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwSprf3eGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwSprf3eAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwSprf3eAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwSprf3eMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF );
+extern void HwSprf3eMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF );
+extern void HwSprf3eMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF );
+extern void HwSprf3eMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF );
+extern void HwSprf3eMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwSprf3eMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwSprf3eExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwSprf3eExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+extern void HwSprf3eBarometerSet( uint8_t *NewBarometer );
+extern void HwSprf3eBarometerGet( uint8_t *NewBarometer );
+
+
+#endif // HWSPRF3E_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwtaulink.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwTauLink object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwtaulink.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwtaulink.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const HwTauLinkData defaultData = {
+	.CoordID = 0,
+	.Radio = 0,
+	.MainPort = 1,
+	.BTPort = 1,
+	.PPMPort = 3,
+	.VCPPort = 4,
+	.ComSpeed = 11,
+	.MaxRfSpeed = 3,
+	.MaxRfPower = 3,
+	.RfBand = 0,
+	.MinChannel = 0,
+	.MaxChannel = 250,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwTauLinkInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWTAULINK_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWTAULINK_OBJID,
+			HWTAULINK_ISSINGLEINST, HWTAULINK_ISSETTINGS, HWTAULINK_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwTauLinkSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwTauLinkData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwTauLinkSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwTauLinkSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwTauLinkSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwTauLinkSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwTauLinkHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwTauLinkCoordIDSet( uint32_t *NewCoordID )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewCoordID, offsetof( HwTauLinkData, CoordID), sizeof(uint32_t));
+}
+void HwTauLinkCoordIDGet( uint32_t *NewCoordID )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewCoordID, offsetof( HwTauLinkData, CoordID), sizeof(uint32_t));
+}
+void HwTauLinkRadioSet( uint8_t *NewRadio )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewRadio, offsetof( HwTauLinkData, Radio), sizeof(uint8_t));
+}
+void HwTauLinkRadioGet( uint8_t *NewRadio )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewRadio, offsetof( HwTauLinkData, Radio), sizeof(uint8_t));
+}
+void HwTauLinkMainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewMainPort, offsetof( HwTauLinkData, MainPort), sizeof(uint8_t));
+}
+void HwTauLinkMainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewMainPort, offsetof( HwTauLinkData, MainPort), sizeof(uint8_t));
+}
+void HwTauLinkBTPortSet( uint8_t *NewBTPort )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewBTPort, offsetof( HwTauLinkData, BTPort), sizeof(uint8_t));
+}
+void HwTauLinkBTPortGet( uint8_t *NewBTPort )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewBTPort, offsetof( HwTauLinkData, BTPort), sizeof(uint8_t));
+}
+void HwTauLinkPPMPortSet( uint8_t *NewPPMPort )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewPPMPort, offsetof( HwTauLinkData, PPMPort), sizeof(uint8_t));
+}
+void HwTauLinkPPMPortGet( uint8_t *NewPPMPort )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewPPMPort, offsetof( HwTauLinkData, PPMPort), sizeof(uint8_t));
+}
+void HwTauLinkVCPPortSet( uint8_t *NewVCPPort )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewVCPPort, offsetof( HwTauLinkData, VCPPort), sizeof(uint8_t));
+}
+void HwTauLinkVCPPortGet( uint8_t *NewVCPPort )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewVCPPort, offsetof( HwTauLinkData, VCPPort), sizeof(uint8_t));
+}
+void HwTauLinkComSpeedSet( uint8_t *NewComSpeed )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewComSpeed, offsetof( HwTauLinkData, ComSpeed), sizeof(uint8_t));
+}
+void HwTauLinkComSpeedGet( uint8_t *NewComSpeed )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewComSpeed, offsetof( HwTauLinkData, ComSpeed), sizeof(uint8_t));
+}
+void HwTauLinkMaxRfSpeedSet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewMaxRfSpeed, offsetof( HwTauLinkData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwTauLinkMaxRfSpeedGet( uint8_t *NewMaxRfSpeed )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewMaxRfSpeed, offsetof( HwTauLinkData, MaxRfSpeed), sizeof(uint8_t));
+}
+void HwTauLinkMaxRfPowerSet( uint8_t *NewMaxRfPower )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewMaxRfPower, offsetof( HwTauLinkData, MaxRfPower), sizeof(uint8_t));
+}
+void HwTauLinkMaxRfPowerGet( uint8_t *NewMaxRfPower )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewMaxRfPower, offsetof( HwTauLinkData, MaxRfPower), sizeof(uint8_t));
+}
+void HwTauLinkRfBandSet( uint8_t *NewRfBand )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewRfBand, offsetof( HwTauLinkData, RfBand), sizeof(uint8_t));
+}
+void HwTauLinkRfBandGet( uint8_t *NewRfBand )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewRfBand, offsetof( HwTauLinkData, RfBand), sizeof(uint8_t));
+}
+void HwTauLinkMinChannelSet( uint8_t *NewMinChannel )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewMinChannel, offsetof( HwTauLinkData, MinChannel), sizeof(uint8_t));
+}
+void HwTauLinkMinChannelGet( uint8_t *NewMinChannel )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewMinChannel, offsetof( HwTauLinkData, MinChannel), sizeof(uint8_t));
+}
+void HwTauLinkMaxChannelSet( uint8_t *NewMaxChannel )
+{
+	UAVObjSetDataField(HwTauLinkHandle(), (void*)NewMaxChannel, offsetof( HwTauLinkData, MaxChannel), sizeof(uint8_t));
+}
+void HwTauLinkMaxChannelGet( uint8_t *NewMaxChannel )
+{
+	UAVObjGetDataField(HwTauLinkHandle(), (void*)NewMaxChannel, offsetof( HwTauLinkData, MaxChannel), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,210 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwTauLink HwTauLink
+ * @brief TauLink configurations options.
+ *
+ *
+ * @file       hwtaulink.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwTauLink object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwtaulink.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HWTAULINK_H
+#define HWTAULINK_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWTAULINK_OBJID 0x426B556
+#define HWTAULINK_ISSINGLEINST 1
+#define HWTAULINK_ISSETTINGS 1
+#define HWTAULINK_NUMBYTES 15
+
+// Generic interface functions
+int32_t HwTauLinkInitialize();
+UAVObjHandle HwTauLinkHandle();
+void HwTauLinkSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t CoordID;
+    uint8_t Radio;
+    uint8_t MainPort;
+    uint8_t BTPort;
+    uint8_t PPMPort;
+    uint8_t VCPPort;
+    uint8_t ComSpeed;
+    uint8_t MaxRfSpeed;
+    uint8_t MaxRfPower;
+    uint8_t RfBand;
+    uint8_t MinChannel;
+    uint8_t MaxChannel;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwTauLinkData;
+
+// Typesafe Object access functions
+/**
+ * @function HwTauLinkGet(dataOut)
+ * @brief Populate a HwTauLinkData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwTauLinkGet(HwTauLinkData *dataOut) { return UAVObjGetData(HwTauLinkHandle(), dataOut); }
+
+static inline int32_t HwTauLinkSet(const HwTauLinkData *dataIn) { return UAVObjSetData(HwTauLinkHandle(), dataIn); }
+
+static inline int32_t HwTauLinkInstGet(uint16_t instId, HwTauLinkData *dataOut) { return UAVObjGetInstanceData(HwTauLinkHandle(), instId, dataOut); }
+
+static inline int32_t HwTauLinkInstSet(uint16_t instId, const HwTauLinkData *dataIn) { return UAVObjSetInstanceData(HwTauLinkHandle(), instId, dataIn); }
+
+static inline int32_t HwTauLinkConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwTauLinkHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwTauLinkConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwTauLinkHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwTauLinkConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwTauLinkHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwTauLinkConnectCopy(volatile HwTauLinkData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwTauLinkGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwTauLinkHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwTauLinkCreateInstance() { return UAVObjCreateInstance(HwTauLinkHandle(), &HwTauLinkSetDefaults); }
+
+static inline void HwTauLinkUpdated() { UAVObjUpdated(HwTauLinkHandle()); }
+
+static inline void HwTauLinkInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwTauLinkHandle(), instId); }
+
+static inline int32_t HwTauLinkGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwTauLinkHandle(), dataOut); }
+
+static inline int32_t HwTauLinkSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwTauLinkHandle(), dataIn); }
+
+static inline int8_t HwTauLinkReadOnly() { return UAVObjReadOnly(HwTauLinkHandle()); }
+
+static inline uint16_t HwTauLinkGetNumInstances(){ return UAVObjGetNumInstances(HwTauLinkHandle()); }
+
+static inline uint32_t HwTauLinkGetNumBytes(){ return UAVObjGetNumBytes(HwTauLinkHandle()); }
+
+// Field information
+// Field CoordID information
+// Field Radio information
+/* Enumeration options for field Radio */
+typedef enum { HWTAULINK_RADIO_DISABLED=0, HWTAULINK_RADIO_TELEM=1, HWTAULINK_RADIO_TELEMPPM=2, HWTAULINK_RADIO_PPM=3, HWTAULINK_RADIO_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkRadioOptions;
+#define HWTAULINK_RADIO_GLOBAL_MAXOPTVAL 4
+#define HWTAULINK_RADIO_MAXOPTVAL 3
+static inline bool HwTauLinkRadioIsValid( uint8_t CurrentRadio ) { return CurrentRadio <= HWTAULINK_RADIO_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWTAULINK_MAINPORT_DISABLED=0, HWTAULINK_MAINPORT_GPS=2, HWTAULINK_MAINPORT_TELEMETRY=1, HWTAULINK_MAINPORT_COMBRIDGE=9, HWTAULINK_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkMainPortOptions;
+#define HWTAULINK_MAINPORT_GLOBAL_MAXOPTVAL 26
+#define HWTAULINK_MAINPORT_MAXOPTVAL 9
+static inline bool HwTauLinkMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort <= HWTAULINK_MAINPORT_MAXOPTVAL; }
+// Field BTPort information
+/* Enumeration options for field BTPort */
+typedef enum { HWTAULINK_BTPORT_DISABLED=0, HWTAULINK_BTPORT_TELEMETRY=1, HWTAULINK_BTPORT_COMBRIDGE=2 }  __attribute__((packed)) HwTauLinkBTPortOptions;
+#define HWTAULINK_BTPORT_GLOBAL_MAXOPTVAL 2
+#define HWTAULINK_BTPORT_MAXOPTVAL 2
+static inline bool HwTauLinkBTPortIsValid( uint8_t CurrentBTPort ) { return CurrentBTPort <= HWTAULINK_BTPORT_MAXOPTVAL; }
+// Field PPMPort information
+/* Enumeration options for field PPMPort */
+typedef enum { HWTAULINK_PPMPORT_DISABLED=0, HWTAULINK_PPMPORT_PPM=1, HWTAULINK_PPMPORT_SPORT=2, HWTAULINK_PPMPORT_PPMSPORT=3 }  __attribute__((packed)) HwTauLinkPPMPortOptions;
+#define HWTAULINK_PPMPORT_GLOBAL_MAXOPTVAL 3
+#define HWTAULINK_PPMPORT_MAXOPTVAL 3
+static inline bool HwTauLinkPPMPortIsValid( uint8_t CurrentPPMPort ) { return CurrentPPMPort <= HWTAULINK_PPMPORT_MAXOPTVAL; }
+// Field VCPPort information
+/* Enumeration options for field VCPPort */
+typedef enum { HWTAULINK_VCPPORT_USBTELEMETRY=0, HWTAULINK_VCPPORT_COMBRIDGE=1, HWTAULINK_VCPPORT_DEBUGCONSOLE=2, HWTAULINK_VCPPORT_DISABLED=4, HWTAULINK_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkVCPPortOptions;
+#define HWTAULINK_VCPPORT_GLOBAL_MAXOPTVAL 4
+#define HWTAULINK_VCPPORT_MAXOPTVAL 4
+static inline bool HwTauLinkVCPPortIsValid( uint8_t CurrentVCPPort ) { return CurrentVCPPort <= HWTAULINK_VCPPORT_MAXOPTVAL; }
+// Field ComSpeed information
+/* Enumeration options for field ComSpeed */
+typedef enum { HWTAULINK_COMSPEED_1200=0, HWTAULINK_COMSPEED_2400=1, HWTAULINK_COMSPEED_4800=2, HWTAULINK_COMSPEED_9600=3, HWTAULINK_COMSPEED_19200=4, HWTAULINK_COMSPEED_38400=5, HWTAULINK_COMSPEED_57600=6, HWTAULINK_COMSPEED_115200=7, HWTAULINK_COMSPEED_230400=8, HWTAULINK_COMSPEED_INITHC06=10, HWTAULINK_COMSPEED_INITHM10=11, HWTAULINK_COMSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkComSpeedOptions;
+#define HWTAULINK_COMSPEED_GLOBAL_MAXOPTVAL 11
+#define HWTAULINK_COMSPEED_MAXOPTVAL 11
+static inline bool HwTauLinkComSpeedIsValid( uint8_t CurrentComSpeed ) { return CurrentComSpeed <= HWTAULINK_COMSPEED_MAXOPTVAL; }
+// Field MaxRfSpeed information
+/* Enumeration options for field MaxRfSpeed */
+typedef enum { HWTAULINK_MAXRFSPEED_9600=0, HWTAULINK_MAXRFSPEED_19200=1, HWTAULINK_MAXRFSPEED_32000=2, HWTAULINK_MAXRFSPEED_64000=3, HWTAULINK_MAXRFSPEED_100000=4, HWTAULINK_MAXRFSPEED_192000=5, HWTAULINK_MAXRFSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkMaxRfSpeedOptions;
+#define HWTAULINK_MAXRFSPEED_GLOBAL_MAXOPTVAL 5
+#define HWTAULINK_MAXRFSPEED_MAXOPTVAL 5
+static inline bool HwTauLinkMaxRfSpeedIsValid( uint8_t CurrentMaxRfSpeed ) { return CurrentMaxRfSpeed <= HWTAULINK_MAXRFSPEED_MAXOPTVAL; }
+// Field MaxRfPower information
+/* Enumeration options for field MaxRfPower */
+typedef enum { HWTAULINK_MAXRFPOWER_0=0, HWTAULINK_MAXRFPOWER_125=1, HWTAULINK_MAXRFPOWER_16=2, HWTAULINK_MAXRFPOWER_316=3, HWTAULINK_MAXRFPOWER_63=4, HWTAULINK_MAXRFPOWER_126=5, HWTAULINK_MAXRFPOWER_25=6, HWTAULINK_MAXRFPOWER_50=7, HWTAULINK_MAXRFPOWER_100=8, HWTAULINK_MAXRFPOWER_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkMaxRfPowerOptions;
+#define HWTAULINK_MAXRFPOWER_GLOBAL_MAXOPTVAL 8
+#define HWTAULINK_MAXRFPOWER_MAXOPTVAL 8
+static inline bool HwTauLinkMaxRfPowerIsValid( uint8_t CurrentMaxRfPower ) { return CurrentMaxRfPower <= HWTAULINK_MAXRFPOWER_MAXOPTVAL; }
+// Field RfBand information
+/* Enumeration options for field RfBand */
+typedef enum { HWTAULINK_RFBAND_BOARDDEFAULT=0, HWTAULINK_RFBAND_433=1, HWTAULINK_RFBAND_868=2, HWTAULINK_RFBAND_915=3, HWTAULINK_RFBAND_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwTauLinkRfBandOptions;
+#define HWTAULINK_RFBAND_GLOBAL_MAXOPTVAL 3
+#define HWTAULINK_RFBAND_MAXOPTVAL 3
+static inline bool HwTauLinkRfBandIsValid( uint8_t CurrentRfBand ) { return CurrentRfBand <= HWTAULINK_RFBAND_MAXOPTVAL; }
+// Field MinChannel information
+// Field MaxChannel information
+
+
+// set/Get functions
+extern void HwTauLinkCoordIDSet( uint32_t *NewCoordID );
+extern void HwTauLinkCoordIDGet( uint32_t *NewCoordID );
+extern void HwTauLinkRadioSet( uint8_t *NewRadio );
+extern void HwTauLinkRadioGet( uint8_t *NewRadio );
+extern void HwTauLinkMainPortSet( uint8_t *NewMainPort );
+extern void HwTauLinkMainPortGet( uint8_t *NewMainPort );
+extern void HwTauLinkBTPortSet( uint8_t *NewBTPort );
+extern void HwTauLinkBTPortGet( uint8_t *NewBTPort );
+extern void HwTauLinkPPMPortSet( uint8_t *NewPPMPort );
+extern void HwTauLinkPPMPortGet( uint8_t *NewPPMPort );
+extern void HwTauLinkVCPPortSet( uint8_t *NewVCPPort );
+extern void HwTauLinkVCPPortGet( uint8_t *NewVCPPort );
+extern void HwTauLinkComSpeedSet( uint8_t *NewComSpeed );
+extern void HwTauLinkComSpeedGet( uint8_t *NewComSpeed );
+extern void HwTauLinkMaxRfSpeedSet( uint8_t *NewMaxRfSpeed );
+extern void HwTauLinkMaxRfSpeedGet( uint8_t *NewMaxRfSpeed );
+extern void HwTauLinkMaxRfPowerSet( uint8_t *NewMaxRfPower );
+extern void HwTauLinkMaxRfPowerGet( uint8_t *NewMaxRfPower );
+extern void HwTauLinkRfBandSet( uint8_t *NewRfBand );
+extern void HwTauLinkRfBandGet( uint8_t *NewRfBand );
+extern void HwTauLinkMinChannelSet( uint8_t *NewMinChannel );
+extern void HwTauLinkMinChannelGet( uint8_t *NewMinChannel );
+extern void HwTauLinkMaxChannelSet( uint8_t *NewMaxChannel );
+extern void HwTauLinkMaxChannelGet( uint8_t *NewMaxChannel );
+
+
+#endif // HWTAULINK_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       loggingsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the LoggingSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: loggingsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "loggingsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const LoggingSettingsData defaultData = {
+	.LogBehavior = 1,
+	.InitiallyLog = 0,
+	.MaxLogRate = 3,
+	.Profile = 2,
+	.BlackboxDivider = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t LoggingSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(LOGGINGSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(LOGGINGSETTINGS_OBJID,
+			LOGGINGSETTINGS_ISSINGLEINST, LOGGINGSETTINGS_ISSETTINGS, LOGGINGSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void LoggingSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	LoggingSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void LoggingSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void LoggingSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	LoggingSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		LoggingSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle LoggingSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void LoggingSettingsLogBehaviorSet( uint8_t *NewLogBehavior )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewLogBehavior, offsetof( LoggingSettingsData, LogBehavior), sizeof(uint8_t));
+}
+void LoggingSettingsLogBehaviorGet( uint8_t *NewLogBehavior )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewLogBehavior, offsetof( LoggingSettingsData, LogBehavior), sizeof(uint8_t));
+}
+void LoggingSettingsInitiallyLogSet( uint8_t *NewInitiallyLog )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewInitiallyLog, offsetof( LoggingSettingsData, InitiallyLog), sizeof(uint8_t));
+}
+void LoggingSettingsInitiallyLogGet( uint8_t *NewInitiallyLog )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewInitiallyLog, offsetof( LoggingSettingsData, InitiallyLog), sizeof(uint8_t));
+}
+void LoggingSettingsMaxLogRateSet( uint8_t *NewMaxLogRate )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewMaxLogRate, offsetof( LoggingSettingsData, MaxLogRate), sizeof(uint8_t));
+}
+void LoggingSettingsMaxLogRateGet( uint8_t *NewMaxLogRate )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewMaxLogRate, offsetof( LoggingSettingsData, MaxLogRate), sizeof(uint8_t));
+}
+void LoggingSettingsProfileSet( uint8_t *NewProfile )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewProfile, offsetof( LoggingSettingsData, Profile), sizeof(uint8_t));
+}
+void LoggingSettingsProfileGet( uint8_t *NewProfile )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewProfile, offsetof( LoggingSettingsData, Profile), sizeof(uint8_t));
+}
+void LoggingSettingsBlackboxDividerSet( uint8_t *NewBlackboxDivider )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewBlackboxDivider, offsetof( LoggingSettingsData, BlackboxDivider), sizeof(uint8_t));
+}
+void LoggingSettingsBlackboxDividerGet( uint8_t *NewBlackboxDivider )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewBlackboxDivider, offsetof( LoggingSettingsData, BlackboxDivider), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
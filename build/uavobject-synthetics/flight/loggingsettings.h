@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup LoggingSettings LoggingSettings
+ * @brief Settings for the logging module
+ *
+ *
+ * @file       loggingsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the LoggingSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: loggingsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef LOGGINGSETTINGS_H
+#define LOGGINGSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define LOGGINGSETTINGS_OBJID 0xDB543752
+#define LOGGINGSETTINGS_ISSINGLEINST 1
+#define LOGGINGSETTINGS_ISSETTINGS 1
+#define LOGGINGSETTINGS_NUMBYTES 5
+
+// Generic interface functions
+int32_t LoggingSettingsInitialize();
+UAVObjHandle LoggingSettingsHandle();
+void LoggingSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t LogBehavior;
+    uint8_t InitiallyLog;
+    uint8_t MaxLogRate;
+    uint8_t Profile;
+    uint8_t BlackboxDivider;
+
+} __attribute__((packed)) __attribute__((aligned(4))) LoggingSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function LoggingSettingsGet(dataOut)
+ * @brief Populate a LoggingSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t LoggingSettingsGet(LoggingSettingsData *dataOut) { return UAVObjGetData(LoggingSettingsHandle(), dataOut); }
+
+static inline int32_t LoggingSettingsSet(const LoggingSettingsData *dataIn) { return UAVObjSetData(LoggingSettingsHandle(), dataIn); }
+
+static inline int32_t LoggingSettingsInstGet(uint16_t instId, LoggingSettingsData *dataOut) { return UAVObjGetInstanceData(LoggingSettingsHandle(), instId, dataOut); }
+
+static inline int32_t LoggingSettingsInstSet(uint16_t instId, const LoggingSettingsData *dataIn) { return UAVObjSetInstanceData(LoggingSettingsHandle(), instId, dataIn); }
+
+static inline int32_t LoggingSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(LoggingSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t LoggingSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(LoggingSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t LoggingSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(LoggingSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t LoggingSettingsConnectCopy(volatile LoggingSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	LoggingSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(LoggingSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t LoggingSettingsCreateInstance() { return UAVObjCreateInstance(LoggingSettingsHandle(), &LoggingSettingsSetDefaults); }
+
+static inline void LoggingSettingsUpdated() { UAVObjUpdated(LoggingSettingsHandle()); }
+
+static inline void LoggingSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(LoggingSettingsHandle(), instId); }
+
+static inline int32_t LoggingSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(LoggingSettingsHandle(), dataOut); }
+
+static inline int32_t LoggingSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(LoggingSettingsHandle(), dataIn); }
+
+static inline int8_t LoggingSettingsReadOnly() { return UAVObjReadOnly(LoggingSettingsHandle()); }
+
+static inline uint16_t LoggingSettingsGetNumInstances(){ return UAVObjGetNumInstances(LoggingSettingsHandle()); }
+
+static inline uint32_t LoggingSettingsGetNumBytes(){ return UAVObjGetNumBytes(LoggingSettingsHandle()); }
+
+// Field information
+// Field LogBehavior information
+/* Enumeration options for field LogBehavior */
+typedef enum { LOGGINGSETTINGS_LOGBEHAVIOR_LOGONSTART=0, LOGGINGSETTINGS_LOGBEHAVIOR_LOGONARM=1, LOGGINGSETTINGS_LOGBEHAVIOR_LOGOFF=2 }  __attribute__((packed)) LoggingSettingsLogBehaviorOptions;
+#define LOGGINGSETTINGS_LOGBEHAVIOR_GLOBAL_MAXOPTVAL 2
+#define LOGGINGSETTINGS_LOGBEHAVIOR_MAXOPTVAL 2
+static inline bool LoggingSettingsLogBehaviorIsValid( uint8_t CurrentLogBehavior ) { return CurrentLogBehavior <= LOGGINGSETTINGS_LOGBEHAVIOR_MAXOPTVAL; }
+// Field InitiallyLog information
+/* Enumeration options for field InitiallyLog */
+typedef enum { LOGGINGSETTINGS_INITIALLYLOG_ALLOBJECTS=0, LOGGINGSETTINGS_INITIALLYLOG_SETTINGSOBJECTS=1, LOGGINGSETTINGS_INITIALLYLOG_NONE=2 }  __attribute__((packed)) LoggingSettingsInitiallyLogOptions;
+#define LOGGINGSETTINGS_INITIALLYLOG_GLOBAL_MAXOPTVAL 2
+#define LOGGINGSETTINGS_INITIALLYLOG_MAXOPTVAL 2
+static inline bool LoggingSettingsInitiallyLogIsValid( uint8_t CurrentInitiallyLog ) { return CurrentInitiallyLog <= LOGGINGSETTINGS_INITIALLYLOG_MAXOPTVAL; }
+// Field MaxLogRate information
+/* Enumeration options for field MaxLogRate */
+typedef enum { LOGGINGSETTINGS_MAXLOGRATE_5=0, LOGGINGSETTINGS_MAXLOGRATE_10=1, LOGGINGSETTINGS_MAXLOGRATE_25=2, LOGGINGSETTINGS_MAXLOGRATE_50=3, LOGGINGSETTINGS_MAXLOGRATE_100=4, LOGGINGSETTINGS_MAXLOGRATE_166=5, LOGGINGSETTINGS_MAXLOGRATE_250=6, LOGGINGSETTINGS_MAXLOGRATE_333=7, LOGGINGSETTINGS_MAXLOGRATE_500=8, LOGGINGSETTINGS_MAXLOGRATE_1000=9 }  __attribute__((packed)) LoggingSettingsMaxLogRateOptions;
+#define LOGGINGSETTINGS_MAXLOGRATE_GLOBAL_MAXOPTVAL 9
+#define LOGGINGSETTINGS_MAXLOGRATE_MAXOPTVAL 9
+static inline bool LoggingSettingsMaxLogRateIsValid( uint8_t CurrentMaxLogRate ) { return CurrentMaxLogRate <= LOGGINGSETTINGS_MAXLOGRATE_MAXOPTVAL; }
+// Field Profile information
+/* Enumeration options for field Profile */
+typedef enum { LOGGINGSETTINGS_PROFILE_BASIC=0, LOGGINGSETTINGS_PROFILE_CUSTOM=1, LOGGINGSETTINGS_PROFILE_FULLBORE=2 }  __attribute__((packed)) LoggingSettingsProfileOptions;
+#define LOGGINGSETTINGS_PROFILE_GLOBAL_MAXOPTVAL 2
+#define LOGGINGSETTINGS_PROFILE_MAXOPTVAL 2
+static inline bool LoggingSettingsProfileIsValid( uint8_t CurrentProfile ) { return CurrentProfile <= LOGGINGSETTINGS_PROFILE_MAXOPTVAL; }
+// Field BlackboxDivider information
+
+
+// set/Get functions
+extern void LoggingSettingsLogBehaviorSet( uint8_t *NewLogBehavior );
+extern void LoggingSettingsLogBehaviorGet( uint8_t *NewLogBehavior );
+extern void LoggingSettingsInitiallyLogSet( uint8_t *NewInitiallyLog );
+extern void LoggingSettingsInitiallyLogGet( uint8_t *NewInitiallyLog );
+extern void LoggingSettingsMaxLogRateSet( uint8_t *NewMaxLogRate );
+extern void LoggingSettingsMaxLogRateGet( uint8_t *NewMaxLogRate );
+extern void LoggingSettingsProfileSet( uint8_t *NewProfile );
+extern void LoggingSettingsProfileGet( uint8_t *NewProfile );
+extern void LoggingSettingsBlackboxDividerSet( uint8_t *NewBlackboxDivider );
+extern void LoggingSettingsBlackboxDividerGet( uint8_t *NewBlackboxDivider );
+
+
+#endif // LOGGINGSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       manualcontrolcommand.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ManualControlCommand object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: manualcontrolcommand.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "manualcontrolcommand.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 166,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 1000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ManualControlCommandInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(MANUALCONTROLCOMMAND_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(MANUALCONTROLCOMMAND_OBJID,
+			MANUALCONTROLCOMMAND_ISSINGLEINST, MANUALCONTROLCOMMAND_ISSETTINGS, MANUALCONTROLCOMMAND_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ManualControlCommandSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ManualControlCommandData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ManualControlCommandSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ManualControlCommandSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ManualControlCommandSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ManualControlCommandSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ManualControlCommandHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ManualControlCommandThrottleSet( float *NewThrottle )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewThrottle, offsetof( ManualControlCommandData, Throttle), sizeof(float));
+}
+void ManualControlCommandThrottleGet( float *NewThrottle )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewThrottle, offsetof( ManualControlCommandData, Throttle), sizeof(float));
+}
+void ManualControlCommandRollSet( float *NewRoll )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewRoll, offsetof( ManualControlCommandData, Roll), sizeof(float));
+}
+void ManualControlCommandRollGet( float *NewRoll )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewRoll, offsetof( ManualControlCommandData, Roll), sizeof(float));
+}
+void ManualControlCommandPitchSet( float *NewPitch )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewPitch, offsetof( ManualControlCommandData, Pitch), sizeof(float));
+}
+void ManualControlCommandPitchGet( float *NewPitch )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewPitch, offsetof( ManualControlCommandData, Pitch), sizeof(float));
+}
+void ManualControlCommandYawSet( float *NewYaw )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewYaw, offsetof( ManualControlCommandData, Yaw), sizeof(float));
+}
+void ManualControlCommandYawGet( float *NewYaw )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewYaw, offsetof( ManualControlCommandData, Yaw), sizeof(float));
+}
+void ManualControlCommandAccessorySet( float *NewAccessory )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewAccessory, offsetof( ManualControlCommandData, Accessory), 3*sizeof(float));
+}
+void ManualControlCommandAccessoryGet( float *NewAccessory )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewAccessory, offsetof( ManualControlCommandData, Accessory), 3*sizeof(float));
+}
+void ManualControlCommandRawRssiSet( uint32_t *NewRawRssi )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewRawRssi, offsetof( ManualControlCommandData, RawRssi), sizeof(uint32_t));
+}
+void ManualControlCommandRawRssiGet( uint32_t *NewRawRssi )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewRawRssi, offsetof( ManualControlCommandData, RawRssi), sizeof(uint32_t));
+}
+void ManualControlCommandCollectiveSet( float *NewCollective )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewCollective, offsetof( ManualControlCommandData, Collective), sizeof(float));
+}
+void ManualControlCommandCollectiveGet( float *NewCollective )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewCollective, offsetof( ManualControlCommandData, Collective), sizeof(float));
+}
+void ManualControlCommandRssiSet( int16_t *NewRssi )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewRssi, offsetof( ManualControlCommandData, Rssi), sizeof(int16_t));
+}
+void ManualControlCommandRssiGet( int16_t *NewRssi )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewRssi, offsetof( ManualControlCommandData, Rssi), sizeof(int16_t));
+}
+void ManualControlCommandChannelSet( uint16_t *NewChannel )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewChannel, offsetof( ManualControlCommandData, Channel), 10*sizeof(uint16_t));
+}
+void ManualControlCommandChannelGet( uint16_t *NewChannel )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewChannel, offsetof( ManualControlCommandData, Channel), 10*sizeof(uint16_t));
+}
+void ManualControlCommandConnectedSet( uint8_t *NewConnected )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewConnected, offsetof( ManualControlCommandData, Connected), sizeof(uint8_t));
+}
+void ManualControlCommandConnectedGet( uint8_t *NewConnected )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewConnected, offsetof( ManualControlCommandData, Connected), sizeof(uint8_t));
+}
+void ManualControlCommandArmSwitchSet( uint8_t *NewArmSwitch )
+{
+	UAVObjSetDataField(ManualControlCommandHandle(), (void*)NewArmSwitch, offsetof( ManualControlCommandData, ArmSwitch), sizeof(uint8_t));
+}
+void ManualControlCommandArmSwitchGet( uint8_t *NewArmSwitch )
+{
+	UAVObjGetDataField(ManualControlCommandHandle(), (void*)NewArmSwitch, offsetof( ManualControlCommandData, ArmSwitch), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,287 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup MixerSettings MixerSettings
+ * @brief Settings for the @ref ActuatorModule that controls the channel assignments for the mixer based on AircraftType
+ *
+ *
+ * @file       mixersettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the MixerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: mixersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef MIXERSETTINGS_H
+#define MIXERSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define MIXERSETTINGS_OBJID 0xB10027D6
+#define MIXERSETTINGS_ISSINGLEINST 1
+#define MIXERSETTINGS_ISSETTINGS 1
+#define MIXERSETTINGS_NUMBYTES 211
+
+// Generic interface functions
+int32_t MixerSettingsInitialize();
+UAVObjHandle MixerSettingsHandle();
+void MixerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float ThrottleCurve1[5];
+    float ThrottleCurve2[5];
+    int16_t Mixer1Vector[8];
+    int16_t Mixer2Vector[8];
+    int16_t Mixer3Vector[8];
+    int16_t Mixer4Vector[8];
+    int16_t Mixer5Vector[8];
+    int16_t Mixer6Vector[8];
+    int16_t Mixer7Vector[8];
+    int16_t Mixer8Vector[8];
+    int16_t Mixer9Vector[8];
+    int16_t Mixer10Vector[8];
+    uint8_t Curve2Source;
+    uint8_t Mixer1Type;
+    uint8_t Mixer2Type;
+    uint8_t Mixer3Type;
+    uint8_t Mixer4Type;
+    uint8_t Mixer5Type;
+    uint8_t Mixer6Type;
+    uint8_t Mixer7Type;
+    uint8_t Mixer8Type;
+    uint8_t Mixer9Type;
+    uint8_t Mixer10Type;
+
+} __attribute__((packed)) __attribute__((aligned(4))) MixerSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function MixerSettingsGet(dataOut)
+ * @brief Populate a MixerSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t MixerSettingsGet(MixerSettingsData *dataOut) { return UAVObjGetData(MixerSettingsHandle(), dataOut); }
+
+static inline int32_t MixerSettingsSet(const MixerSettingsData *dataIn) { return UAVObjSetData(MixerSettingsHandle(), dataIn); }
+
+static inline int32_t MixerSettingsInstGet(uint16_t instId, MixerSettingsData *dataOut) { return UAVObjGetInstanceData(MixerSettingsHandle(), instId, dataOut); }
+
+static inline int32_t MixerSettingsInstSet(uint16_t instId, const MixerSettingsData *dataIn) { return UAVObjSetInstanceData(MixerSettingsHandle(), instId, dataIn); }
+
+static inline int32_t MixerSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(MixerSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MixerSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(MixerSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MixerSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(MixerSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MixerSettingsConnectCopy(volatile MixerSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	MixerSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(MixerSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t MixerSettingsCreateInstance() { return UAVObjCreateInstance(MixerSettingsHandle(), &MixerSettingsSetDefaults); }
+
+static inline void MixerSettingsUpdated() { UAVObjUpdated(MixerSettingsHandle()); }
+
+static inline void MixerSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(MixerSettingsHandle(), instId); }
+
+static inline int32_t MixerSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(MixerSettingsHandle(), dataOut); }
+
+static inline int32_t MixerSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(MixerSettingsHandle(), dataIn); }
+
+static inline int8_t MixerSettingsReadOnly() { return UAVObjReadOnly(MixerSettingsHandle()); }
+
+static inline uint16_t MixerSettingsGetNumInstances(){ return UAVObjGetNumInstances(MixerSettingsHandle()); }
+
+static inline uint32_t MixerSettingsGetNumBytes(){ return UAVObjGetNumBytes(MixerSettingsHandle()); }
+
+// Field information
+// Field ThrottleCurve1 information
+typedef enum { MIXERSETTINGS_THROTTLECURVE1_0=0, MIXERSETTINGS_THROTTLECURVE1_25=1, MIXERSETTINGS_THROTTLECURVE1_50=2, MIXERSETTINGS_THROTTLECURVE1_75=3, MIXERSETTINGS_THROTTLECURVE1_100=4 } __attribute__((packed)) MixerSettingsThrottleCurve1Elem;
+#define MIXERSETTINGS_THROTTLECURVE1_NUMELEM 5
+// Field ThrottleCurve2 information
+typedef enum { MIXERSETTINGS_THROTTLECURVE2_0=0, MIXERSETTINGS_THROTTLECURVE2_25=1, MIXERSETTINGS_THROTTLECURVE2_50=2, MIXERSETTINGS_THROTTLECURVE2_75=3, MIXERSETTINGS_THROTTLECURVE2_100=4 } __attribute__((packed)) MixerSettingsThrottleCurve2Elem;
+#define MIXERSETTINGS_THROTTLECURVE2_NUMELEM 5
+// Field Mixer1Vector information
+typedef enum { MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER1VECTOR_ROLL=2, MIXERSETTINGS_MIXER1VECTOR_PITCH=3, MIXERSETTINGS_MIXER1VECTOR_YAW=4, MIXERSETTINGS_MIXER1VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER1VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER1VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer1VectorElem;
+#define MIXERSETTINGS_MIXER1VECTOR_NUMELEM 8
+// Field Mixer2Vector information
+typedef enum { MIXERSETTINGS_MIXER2VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER2VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER2VECTOR_ROLL=2, MIXERSETTINGS_MIXER2VECTOR_PITCH=3, MIXERSETTINGS_MIXER2VECTOR_YAW=4, MIXERSETTINGS_MIXER2VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER2VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER2VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer2VectorElem;
+#define MIXERSETTINGS_MIXER2VECTOR_NUMELEM 8
+// Field Mixer3Vector information
+typedef enum { MIXERSETTINGS_MIXER3VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER3VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER3VECTOR_ROLL=2, MIXERSETTINGS_MIXER3VECTOR_PITCH=3, MIXERSETTINGS_MIXER3VECTOR_YAW=4, MIXERSETTINGS_MIXER3VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER3VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER3VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer3VectorElem;
+#define MIXERSETTINGS_MIXER3VECTOR_NUMELEM 8
+// Field Mixer4Vector information
+typedef enum { MIXERSETTINGS_MIXER4VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER4VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER4VECTOR_ROLL=2, MIXERSETTINGS_MIXER4VECTOR_PITCH=3, MIXERSETTINGS_MIXER4VECTOR_YAW=4, MIXERSETTINGS_MIXER4VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER4VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER4VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer4VectorElem;
+#define MIXERSETTINGS_MIXER4VECTOR_NUMELEM 8
+// Field Mixer5Vector information
+typedef enum { MIXERSETTINGS_MIXER5VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER5VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER5VECTOR_ROLL=2, MIXERSETTINGS_MIXER5VECTOR_PITCH=3, MIXERSETTINGS_MIXER5VECTOR_YAW=4, MIXERSETTINGS_MIXER5VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER5VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER5VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer5VectorElem;
+#define MIXERSETTINGS_MIXER5VECTOR_NUMELEM 8
+// Field Mixer6Vector information
+typedef enum { MIXERSETTINGS_MIXER6VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER6VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER6VECTOR_ROLL=2, MIXERSETTINGS_MIXER6VECTOR_PITCH=3, MIXERSETTINGS_MIXER6VECTOR_YAW=4, MIXERSETTINGS_MIXER6VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER6VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER6VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer6VectorElem;
+#define MIXERSETTINGS_MIXER6VECTOR_NUMELEM 8
+// Field Mixer7Vector information
+typedef enum { MIXERSETTINGS_MIXER7VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER7VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER7VECTOR_ROLL=2, MIXERSETTINGS_MIXER7VECTOR_PITCH=3, MIXERSETTINGS_MIXER7VECTOR_YAW=4, MIXERSETTINGS_MIXER7VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER7VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER7VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer7VectorElem;
+#define MIXERSETTINGS_MIXER7VECTOR_NUMELEM 8
+// Field Mixer8Vector information
+typedef enum { MIXERSETTINGS_MIXER8VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER8VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER8VECTOR_ROLL=2, MIXERSETTINGS_MIXER8VECTOR_PITCH=3, MIXERSETTINGS_MIXER8VECTOR_YAW=4, MIXERSETTINGS_MIXER8VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER8VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER8VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer8VectorElem;
+#define MIXERSETTINGS_MIXER8VECTOR_NUMELEM 8
+// Field Mixer9Vector information
+typedef enum { MIXERSETTINGS_MIXER9VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER9VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER9VECTOR_ROLL=2, MIXERSETTINGS_MIXER9VECTOR_PITCH=3, MIXERSETTINGS_MIXER9VECTOR_YAW=4, MIXERSETTINGS_MIXER9VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER9VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER9VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer9VectorElem;
+#define MIXERSETTINGS_MIXER9VECTOR_NUMELEM 8
+// Field Mixer10Vector information
+typedef enum { MIXERSETTINGS_MIXER10VECTOR_THROTTLECURVE1=0, MIXERSETTINGS_MIXER10VECTOR_THROTTLECURVE2=1, MIXERSETTINGS_MIXER10VECTOR_ROLL=2, MIXERSETTINGS_MIXER10VECTOR_PITCH=3, MIXERSETTINGS_MIXER10VECTOR_YAW=4, MIXERSETTINGS_MIXER10VECTOR_ACCESSORY0=5, MIXERSETTINGS_MIXER10VECTOR_ACCESSORY1=6, MIXERSETTINGS_MIXER10VECTOR_ACCESSORY2=7 } __attribute__((packed)) MixerSettingsMixer10VectorElem;
+#define MIXERSETTINGS_MIXER10VECTOR_NUMELEM 8
+// Field Curve2Source information
+/* Enumeration options for field Curve2Source */
+typedef enum { MIXERSETTINGS_CURVE2SOURCE_THROTTLE=0, MIXERSETTINGS_CURVE2SOURCE_ROLL=1, MIXERSETTINGS_CURVE2SOURCE_PITCH=2, MIXERSETTINGS_CURVE2SOURCE_YAW=3, MIXERSETTINGS_CURVE2SOURCE_COLLECTIVE=4, MIXERSETTINGS_CURVE2SOURCE_ACCESSORY0=5, MIXERSETTINGS_CURVE2SOURCE_ACCESSORY1=6, MIXERSETTINGS_CURVE2SOURCE_ACCESSORY2=7 }  __attribute__((packed)) MixerSettingsCurve2SourceOptions;
+#define MIXERSETTINGS_CURVE2SOURCE_GLOBAL_MAXOPTVAL 7
+#define MIXERSETTINGS_CURVE2SOURCE_MAXOPTVAL 7
+static inline bool MixerSettingsCurve2SourceIsValid( uint8_t CurrentCurve2Source ) { return CurrentCurve2Source <= MIXERSETTINGS_CURVE2SOURCE_MAXOPTVAL; }
+// Field Mixer1Type information
+/* Enumeration options for field Mixer1Type */
+typedef enum { MIXERSETTINGS_MIXER1TYPE_DISABLED=0, MIXERSETTINGS_MIXER1TYPE_MOTOR=1, MIXERSETTINGS_MIXER1TYPE_SERVO=2, MIXERSETTINGS_MIXER1TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER1TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER1TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer1TypeOptions;
+#define MIXERSETTINGS_MIXER1TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER1TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer1TypeIsValid( uint8_t CurrentMixer1Type ) { return CurrentMixer1Type <= MIXERSETTINGS_MIXER1TYPE_MAXOPTVAL; }
+// Field Mixer2Type information
+/* Enumeration options for field Mixer2Type */
+typedef enum { MIXERSETTINGS_MIXER2TYPE_DISABLED=0, MIXERSETTINGS_MIXER2TYPE_MOTOR=1, MIXERSETTINGS_MIXER2TYPE_SERVO=2, MIXERSETTINGS_MIXER2TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER2TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER2TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer2TypeOptions;
+#define MIXERSETTINGS_MIXER2TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER2TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer2TypeIsValid( uint8_t CurrentMixer2Type ) { return CurrentMixer2Type <= MIXERSETTINGS_MIXER2TYPE_MAXOPTVAL; }
+// Field Mixer3Type information
+/* Enumeration options for field Mixer3Type */
+typedef enum { MIXERSETTINGS_MIXER3TYPE_DISABLED=0, MIXERSETTINGS_MIXER3TYPE_MOTOR=1, MIXERSETTINGS_MIXER3TYPE_SERVO=2, MIXERSETTINGS_MIXER3TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER3TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER3TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer3TypeOptions;
+#define MIXERSETTINGS_MIXER3TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER3TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer3TypeIsValid( uint8_t CurrentMixer3Type ) { return CurrentMixer3Type <= MIXERSETTINGS_MIXER3TYPE_MAXOPTVAL; }
+// Field Mixer4Type information
+/* Enumeration options for field Mixer4Type */
+typedef enum { MIXERSETTINGS_MIXER4TYPE_DISABLED=0, MIXERSETTINGS_MIXER4TYPE_MOTOR=1, MIXERSETTINGS_MIXER4TYPE_SERVO=2, MIXERSETTINGS_MIXER4TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER4TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER4TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer4TypeOptions;
+#define MIXERSETTINGS_MIXER4TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER4TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer4TypeIsValid( uint8_t CurrentMixer4Type ) { return CurrentMixer4Type <= MIXERSETTINGS_MIXER4TYPE_MAXOPTVAL; }
+// Field Mixer5Type information
+/* Enumeration options for field Mixer5Type */
+typedef enum { MIXERSETTINGS_MIXER5TYPE_DISABLED=0, MIXERSETTINGS_MIXER5TYPE_MOTOR=1, MIXERSETTINGS_MIXER5TYPE_SERVO=2, MIXERSETTINGS_MIXER5TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER5TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER5TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer5TypeOptions;
+#define MIXERSETTINGS_MIXER5TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER5TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer5TypeIsValid( uint8_t CurrentMixer5Type ) { return CurrentMixer5Type <= MIXERSETTINGS_MIXER5TYPE_MAXOPTVAL; }
+// Field Mixer6Type information
+/* Enumeration options for field Mixer6Type */
+typedef enum { MIXERSETTINGS_MIXER6TYPE_DISABLED=0, MIXERSETTINGS_MIXER6TYPE_MOTOR=1, MIXERSETTINGS_MIXER6TYPE_SERVO=2, MIXERSETTINGS_MIXER6TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER6TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER6TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer6TypeOptions;
+#define MIXERSETTINGS_MIXER6TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER6TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer6TypeIsValid( uint8_t CurrentMixer6Type ) { return CurrentMixer6Type <= MIXERSETTINGS_MIXER6TYPE_MAXOPTVAL; }
+// Field Mixer7Type information
+/* Enumeration options for field Mixer7Type */
+typedef enum { MIXERSETTINGS_MIXER7TYPE_DISABLED=0, MIXERSETTINGS_MIXER7TYPE_MOTOR=1, MIXERSETTINGS_MIXER7TYPE_SERVO=2, MIXERSETTINGS_MIXER7TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER7TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER7TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer7TypeOptions;
+#define MIXERSETTINGS_MIXER7TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER7TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer7TypeIsValid( uint8_t CurrentMixer7Type ) { return CurrentMixer7Type <= MIXERSETTINGS_MIXER7TYPE_MAXOPTVAL; }
+// Field Mixer8Type information
+/* Enumeration options for field Mixer8Type */
+typedef enum { MIXERSETTINGS_MIXER8TYPE_DISABLED=0, MIXERSETTINGS_MIXER8TYPE_MOTOR=1, MIXERSETTINGS_MIXER8TYPE_SERVO=2, MIXERSETTINGS_MIXER8TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER8TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER8TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer8TypeOptions;
+#define MIXERSETTINGS_MIXER8TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER8TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer8TypeIsValid( uint8_t CurrentMixer8Type ) { return CurrentMixer8Type <= MIXERSETTINGS_MIXER8TYPE_MAXOPTVAL; }
+// Field Mixer9Type information
+/* Enumeration options for field Mixer9Type */
+typedef enum { MIXERSETTINGS_MIXER9TYPE_DISABLED=0, MIXERSETTINGS_MIXER9TYPE_MOTOR=1, MIXERSETTINGS_MIXER9TYPE_SERVO=2, MIXERSETTINGS_MIXER9TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER9TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER9TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer9TypeOptions;
+#define MIXERSETTINGS_MIXER9TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER9TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer9TypeIsValid( uint8_t CurrentMixer9Type ) { return CurrentMixer9Type <= MIXERSETTINGS_MIXER9TYPE_MAXOPTVAL; }
+// Field Mixer10Type information
+/* Enumeration options for field Mixer10Type */
+typedef enum { MIXERSETTINGS_MIXER10TYPE_DISABLED=0, MIXERSETTINGS_MIXER10TYPE_MOTOR=1, MIXERSETTINGS_MIXER10TYPE_SERVO=2, MIXERSETTINGS_MIXER10TYPE_CAMERAROLL=3, MIXERSETTINGS_MIXER10TYPE_CAMERAPITCH=4, MIXERSETTINGS_MIXER10TYPE_CAMERAYAW=5 }  __attribute__((packed)) MixerSettingsMixer10TypeOptions;
+#define MIXERSETTINGS_MIXER10TYPE_GLOBAL_MAXOPTVAL 5
+#define MIXERSETTINGS_MIXER10TYPE_MAXOPTVAL 5
+static inline bool MixerSettingsMixer10TypeIsValid( uint8_t CurrentMixer10Type ) { return CurrentMixer10Type <= MIXERSETTINGS_MIXER10TYPE_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void MixerSettingsThrottleCurve1Set( float *NewThrottleCurve1 );
+extern void MixerSettingsThrottleCurve1Get( float *NewThrottleCurve1 );
+extern void MixerSettingsThrottleCurve2Set( float *NewThrottleCurve2 );
+extern void MixerSettingsThrottleCurve2Get( float *NewThrottleCurve2 );
+extern void MixerSettingsMixer1VectorSet( int16_t *NewMixer1Vector );
+extern void MixerSettingsMixer1VectorGet( int16_t *NewMixer1Vector );
+extern void MixerSettingsMixer2VectorSet( int16_t *NewMixer2Vector );
+extern void MixerSettingsMixer2VectorGet( int16_t *NewMixer2Vector );
+extern void MixerSettingsMixer3VectorSet( int16_t *NewMixer3Vector );
+extern void MixerSettingsMixer3VectorGet( int16_t *NewMixer3Vector );
+extern void MixerSettingsMixer4VectorSet( int16_t *NewMixer4Vector );
+extern void MixerSettingsMixer4VectorGet( int16_t *NewMixer4Vector );
+extern void MixerSettingsMixer5VectorSet( int16_t *NewMixer5Vector );
+extern void MixerSettingsMixer5VectorGet( int16_t *NewMixer5Vector );
+extern void MixerSettingsMixer6VectorSet( int16_t *NewMixer6Vector );
+extern void MixerSettingsMixer6VectorGet( int16_t *NewMixer6Vector );
+extern void MixerSettingsMixer7VectorSet( int16_t *NewMixer7Vector );
+extern void MixerSettingsMixer7VectorGet( int16_t *NewMixer7Vector );
+extern void MixerSettingsMixer8VectorSet( int16_t *NewMixer8Vector );
+extern void MixerSettingsMixer8VectorGet( int16_t *NewMixer8Vector );
+extern void MixerSettingsMixer9VectorSet( int16_t *NewMixer9Vector );
+extern void MixerSettingsMixer9VectorGet( int16_t *NewMixer9Vector );
+extern void MixerSettingsMixer10VectorSet( int16_t *NewMixer10Vector );
+extern void MixerSettingsMixer10VectorGet( int16_t *NewMixer10Vector );
+extern void MixerSettingsCurve2SourceSet( uint8_t *NewCurve2Source );
+extern void MixerSettingsCurve2SourceGet( uint8_t *NewCurve2Source );
+extern void MixerSettingsMixer1TypeSet( uint8_t *NewMixer1Type );
+extern void MixerSettingsMixer1TypeGet( uint8_t *NewMixer1Type );
+extern void MixerSettingsMixer2TypeSet( uint8_t *NewMixer2Type );
+extern void MixerSettingsMixer2TypeGet( uint8_t *NewMixer2Type );
+extern void MixerSettingsMixer3TypeSet( uint8_t *NewMixer3Type );
+extern void MixerSettingsMixer3TypeGet( uint8_t *NewMixer3Type );
+extern void MixerSettingsMixer4TypeSet( uint8_t *NewMixer4Type );
+extern void MixerSettingsMixer4TypeGet( uint8_t *NewMixer4Type );
+extern void MixerSettingsMixer5TypeSet( uint8_t *NewMixer5Type );
+extern void MixerSettingsMixer5TypeGet( uint8_t *NewMixer5Type );
+extern void MixerSettingsMixer6TypeSet( uint8_t *NewMixer6Type );
+extern void MixerSettingsMixer6TypeGet( uint8_t *NewMixer6Type );
+extern void MixerSettingsMixer7TypeSet( uint8_t *NewMixer7Type );
+extern void MixerSettingsMixer7TypeGet( uint8_t *NewMixer7Type );
+extern void MixerSettingsMixer8TypeSet( uint8_t *NewMixer8Type );
+extern void MixerSettingsMixer8TypeGet( uint8_t *NewMixer8Type );
+extern void MixerSettingsMixer9TypeSet( uint8_t *NewMixer9Type );
+extern void MixerSettingsMixer9TypeGet( uint8_t *NewMixer9Type );
+extern void MixerSettingsMixer10TypeSet( uint8_t *NewMixer10Type );
+extern void MixerSettingsMixer10TypeGet( uint8_t *NewMixer10Type );
+
+
+#endif // MIXERSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,245 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ModuleSettings ModuleSettings
+ * @brief Optional module configuration.
+ *
+ *
+ * @file       modulesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ModuleSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: modulesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef MODULESETTINGS_H
+#define MODULESETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define MODULESETTINGS_OBJID 0xFECECBDC
+#define MODULESETTINGS_ISSINGLEINST 1
+#define MODULESETTINGS_ISSETTINGS 1
+#define MODULESETTINGS_NUMBYTES 27
+
+// Generic interface functions
+int32_t ModuleSettingsInitialize();
+UAVObjHandle ModuleSettingsHandle();
+void ModuleSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t AdminState[14];
+    uint8_t TelemetrySpeed;
+    uint8_t GPSSpeed;
+    uint8_t GPSDataProtocol;
+    uint8_t GPSAutoConfigure;
+    uint8_t GPSConstellation;
+    uint8_t GPSSBASConstellation;
+    uint8_t GPSDynamicsMode;
+    uint8_t ComUsbBridgeSpeed;
+    uint8_t MavlinkSpeed;
+    uint8_t MSPSpeed;
+    uint8_t LightTelemetrySpeed;
+    uint8_t FrskyAccelData;
+    uint8_t OpenLogSpeed;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ModuleSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function ModuleSettingsGet(dataOut)
+ * @brief Populate a ModuleSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ModuleSettingsGet(ModuleSettingsData *dataOut) { return UAVObjGetData(ModuleSettingsHandle(), dataOut); }
+
+static inline int32_t ModuleSettingsSet(const ModuleSettingsData *dataIn) { return UAVObjSetData(ModuleSettingsHandle(), dataIn); }
+
+static inline int32_t ModuleSettingsInstGet(uint16_t instId, ModuleSettingsData *dataOut) { return UAVObjGetInstanceData(ModuleSettingsHandle(), instId, dataOut); }
+
+static inline int32_t ModuleSettingsInstSet(uint16_t instId, const ModuleSettingsData *dataIn) { return UAVObjSetInstanceData(ModuleSettingsHandle(), instId, dataIn); }
+
+static inline int32_t ModuleSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ModuleSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ModuleSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ModuleSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCopy(volatile ModuleSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ModuleSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ModuleSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ModuleSettingsCreateInstance() { return UAVObjCreateInstance(ModuleSettingsHandle(), &ModuleSettingsSetDefaults); }
+
+static inline void ModuleSettingsUpdated() { UAVObjUpdated(ModuleSettingsHandle()); }
+
+static inline void ModuleSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ModuleSettingsHandle(), instId); }
+
+static inline int32_t ModuleSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ModuleSettingsHandle(), dataOut); }
+
+static inline int32_t ModuleSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ModuleSettingsHandle(), dataIn); }
+
+static inline int8_t ModuleSettingsReadOnly() { return UAVObjReadOnly(ModuleSettingsHandle()); }
+
+static inline uint16_t ModuleSettingsGetNumInstances(){ return UAVObjGetNumInstances(ModuleSettingsHandle()); }
+
+static inline uint32_t ModuleSettingsGetNumBytes(){ return UAVObjGetNumBytes(ModuleSettingsHandle()); }
+
+// Field information
+// Field AdminState information
+/* Enumeration options for field AdminState */
+typedef enum { MODULESETTINGS_ADMINSTATE_DISABLED=0, MODULESETTINGS_ADMINSTATE_ENABLED=1 }  __attribute__((packed)) ModuleSettingsAdminStateOptions;
+#define MODULESETTINGS_ADMINSTATE_GLOBAL_MAXOPTVAL 1
+#define MODULESETTINGS_ADMINSTATE_MAXOPTVAL 1
+static inline bool ModuleSettingsAdminStateIsValid( uint8_t CurrentAdminState ) { return CurrentAdminState <= MODULESETTINGS_ADMINSTATE_MAXOPTVAL; }
+typedef enum { MODULESETTINGS_ADMINSTATE_AIRSPEED=0, MODULESETTINGS_ADMINSTATE_ALTITUDEHOLD=1, MODULESETTINGS_ADMINSTATE_AUTOTUNE=2, MODULESETTINGS_ADMINSTATE_BATTERY=3, MODULESETTINGS_ADMINSTATE_CAMERASTAB=4, MODULESETTINGS_ADMINSTATE_FIXEDWINGPATHFOLLOWER=5, MODULESETTINGS_ADMINSTATE_FAULT=6, MODULESETTINGS_ADMINSTATE_PATHPLANNER=7, MODULESETTINGS_ADMINSTATE_TXPID=8, MODULESETTINGS_ADMINSTATE_VTOLPATHFOLLOWER=9, MODULESETTINGS_ADMINSTATE_VIBRATIONANALYSIS=10, MODULESETTINGS_ADMINSTATE_GEOFENCE=11, MODULESETTINGS_ADMINSTATE_LOGGING=12, MODULESETTINGS_ADMINSTATE_FLIGHTSTATS=13 } __attribute__((packed)) ModuleSettingsAdminStateElem;
+#define MODULESETTINGS_ADMINSTATE_NUMELEM 14
+// Field TelemetrySpeed information
+/* Enumeration options for field TelemetrySpeed */
+typedef enum { MODULESETTINGS_TELEMETRYSPEED_9600=3, MODULESETTINGS_TELEMETRYSPEED_19200=4, MODULESETTINGS_TELEMETRYSPEED_38400=5, MODULESETTINGS_TELEMETRYSPEED_57600=6, MODULESETTINGS_TELEMETRYSPEED_115200=7, MODULESETTINGS_TELEMETRYSPEED_230400=8, MODULESETTINGS_TELEMETRYSPEED_INITHC05=9, MODULESETTINGS_TELEMETRYSPEED_INITHC06=10, MODULESETTINGS_TELEMETRYSPEED_INITHM10=11, MODULESETTINGS_TELEMETRYSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsTelemetrySpeedOptions;
+#define MODULESETTINGS_TELEMETRYSPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_TELEMETRYSPEED_MAXOPTVAL 11
+static inline bool ModuleSettingsTelemetrySpeedIsValid( uint8_t CurrentTelemetrySpeed ) { return CurrentTelemetrySpeed <= MODULESETTINGS_TELEMETRYSPEED_MAXOPTVAL; }
+// Field GPSSpeed information
+/* Enumeration options for field GPSSpeed */
+typedef enum { MODULESETTINGS_GPSSPEED_2400=1, MODULESETTINGS_GPSSPEED_4800=2, MODULESETTINGS_GPSSPEED_9600=3, MODULESETTINGS_GPSSPEED_19200=4, MODULESETTINGS_GPSSPEED_38400=5, MODULESETTINGS_GPSSPEED_57600=6, MODULESETTINGS_GPSSPEED_115200=7, MODULESETTINGS_GPSSPEED_230400=8, MODULESETTINGS_GPSSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsGPSSpeedOptions;
+#define MODULESETTINGS_GPSSPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_GPSSPEED_MAXOPTVAL 8
+static inline bool ModuleSettingsGPSSpeedIsValid( uint8_t CurrentGPSSpeed ) { return CurrentGPSSpeed <= MODULESETTINGS_GPSSPEED_MAXOPTVAL; }
+// Field GPSDataProtocol information
+/* Enumeration options for field GPSDataProtocol */
+typedef enum { MODULESETTINGS_GPSDATAPROTOCOL_NMEA=0, MODULESETTINGS_GPSDATAPROTOCOL_UBX=1 }  __attribute__((packed)) ModuleSettingsGPSDataProtocolOptions;
+#define MODULESETTINGS_GPSDATAPROTOCOL_GLOBAL_MAXOPTVAL 1
+#define MODULESETTINGS_GPSDATAPROTOCOL_MAXOPTVAL 1
+static inline bool ModuleSettingsGPSDataProtocolIsValid( uint8_t CurrentGPSDataProtocol ) { return CurrentGPSDataProtocol <= MODULESETTINGS_GPSDATAPROTOCOL_MAXOPTVAL; }
+// Field GPSAutoConfigure information
+/* Enumeration options for field GPSAutoConfigure */
+typedef enum { MODULESETTINGS_GPSAUTOCONFIGURE_FALSE=0, MODULESETTINGS_GPSAUTOCONFIGURE_TRUE=1 }  __attribute__((packed)) ModuleSettingsGPSAutoConfigureOptions;
+#define MODULESETTINGS_GPSAUTOCONFIGURE_GLOBAL_MAXOPTVAL 1
+#define MODULESETTINGS_GPSAUTOCONFIGURE_MAXOPTVAL 1
+static inline bool ModuleSettingsGPSAutoConfigureIsValid( uint8_t CurrentGPSAutoConfigure ) { return CurrentGPSAutoConfigure <= MODULESETTINGS_GPSAUTOCONFIGURE_MAXOPTVAL; }
+// Field GPSConstellation information
+/* Enumeration options for field GPSConstellation */
+typedef enum { MODULESETTINGS_GPSCONSTELLATION_ALL=0, MODULESETTINGS_GPSCONSTELLATION_GPS=1, MODULESETTINGS_GPSCONSTELLATION_GLONASS=2 }  __attribute__((packed)) ModuleSettingsGPSConstellationOptions;
+#define MODULESETTINGS_GPSCONSTELLATION_GLOBAL_MAXOPTVAL 2
+#define MODULESETTINGS_GPSCONSTELLATION_MAXOPTVAL 2
+static inline bool ModuleSettingsGPSConstellationIsValid( uint8_t CurrentGPSConstellation ) { return CurrentGPSConstellation <= MODULESETTINGS_GPSCONSTELLATION_MAXOPTVAL; }
+// Field GPSSBASConstellation information
+/* Enumeration options for field GPSSBASConstellation */
+typedef enum { MODULESETTINGS_GPSSBASCONSTELLATION_ALL=0, MODULESETTINGS_GPSSBASCONSTELLATION_WAAS=1, MODULESETTINGS_GPSSBASCONSTELLATION_EGNOS=2, MODULESETTINGS_GPSSBASCONSTELLATION_MSAS=3, MODULESETTINGS_GPSSBASCONSTELLATION_GAGAN=4, MODULESETTINGS_GPSSBASCONSTELLATION_NONE=5 }  __attribute__((packed)) ModuleSettingsGPSSBASConstellationOptions;
+#define MODULESETTINGS_GPSSBASCONSTELLATION_GLOBAL_MAXOPTVAL 5
+#define MODULESETTINGS_GPSSBASCONSTELLATION_MAXOPTVAL 5
+static inline bool ModuleSettingsGPSSBASConstellationIsValid( uint8_t CurrentGPSSBASConstellation ) { return CurrentGPSSBASConstellation <= MODULESETTINGS_GPSSBASCONSTELLATION_MAXOPTVAL; }
+// Field GPSDynamicsMode information
+/* Enumeration options for field GPSDynamicsMode */
+typedef enum { MODULESETTINGS_GPSDYNAMICSMODE_PORTABLE=0, MODULESETTINGS_GPSDYNAMICSMODE_PEDESTRIAN=1, MODULESETTINGS_GPSDYNAMICSMODE_AUTOMOTIVE=2, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE1G=3, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE2G=4, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE4G=5 }  __attribute__((packed)) ModuleSettingsGPSDynamicsModeOptions;
+#define MODULESETTINGS_GPSDYNAMICSMODE_GLOBAL_MAXOPTVAL 5
+#define MODULESETTINGS_GPSDYNAMICSMODE_MAXOPTVAL 5
+static inline bool ModuleSettingsGPSDynamicsModeIsValid( uint8_t CurrentGPSDynamicsMode ) { return CurrentGPSDynamicsMode <= MODULESETTINGS_GPSDYNAMICSMODE_MAXOPTVAL; }
+// Field ComUsbBridgeSpeed information
+/* Enumeration options for field ComUsbBridgeSpeed */
+typedef enum { MODULESETTINGS_COMUSBBRIDGESPEED_1200=0, MODULESETTINGS_COMUSBBRIDGESPEED_2400=1, MODULESETTINGS_COMUSBBRIDGESPEED_4800=2, MODULESETTINGS_COMUSBBRIDGESPEED_9600=3, MODULESETTINGS_COMUSBBRIDGESPEED_19200=4, MODULESETTINGS_COMUSBBRIDGESPEED_38400=5, MODULESETTINGS_COMUSBBRIDGESPEED_57600=6, MODULESETTINGS_COMUSBBRIDGESPEED_115200=7, MODULESETTINGS_COMUSBBRIDGESPEED_230400=8, MODULESETTINGS_COMUSBBRIDGESPEED_INITHC05=9, MODULESETTINGS_COMUSBBRIDGESPEED_INITHC06=10, MODULESETTINGS_COMUSBBRIDGESPEED_INITHM10=11, MODULESETTINGS_COMUSBBRIDGESPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsComUsbBridgeSpeedOptions;
+#define MODULESETTINGS_COMUSBBRIDGESPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_COMUSBBRIDGESPEED_MAXOPTVAL 11
+static inline bool ModuleSettingsComUsbBridgeSpeedIsValid( uint8_t CurrentComUsbBridgeSpeed ) { return CurrentComUsbBridgeSpeed <= MODULESETTINGS_COMUSBBRIDGESPEED_MAXOPTVAL; }
+// Field MavlinkSpeed information
+/* Enumeration options for field MavlinkSpeed */
+typedef enum { MODULESETTINGS_MAVLINKSPEED_2400=1, MODULESETTINGS_MAVLINKSPEED_4800=2, MODULESETTINGS_MAVLINKSPEED_9600=3, MODULESETTINGS_MAVLINKSPEED_19200=4, MODULESETTINGS_MAVLINKSPEED_38400=5, MODULESETTINGS_MAVLINKSPEED_57600=6, MODULESETTINGS_MAVLINKSPEED_115200=7, MODULESETTINGS_MAVLINKSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsMavlinkSpeedOptions;
+#define MODULESETTINGS_MAVLINKSPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_MAVLINKSPEED_MAXOPTVAL 7
+static inline bool ModuleSettingsMavlinkSpeedIsValid( uint8_t CurrentMavlinkSpeed ) { return CurrentMavlinkSpeed <= MODULESETTINGS_MAVLINKSPEED_MAXOPTVAL; }
+// Field MSPSpeed information
+/* Enumeration options for field MSPSpeed */
+typedef enum { MODULESETTINGS_MSPSPEED_2400=1, MODULESETTINGS_MSPSPEED_4800=2, MODULESETTINGS_MSPSPEED_9600=3, MODULESETTINGS_MSPSPEED_19200=4, MODULESETTINGS_MSPSPEED_38400=5, MODULESETTINGS_MSPSPEED_57600=6, MODULESETTINGS_MSPSPEED_115200=7, MODULESETTINGS_MSPSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsMSPSpeedOptions;
+#define MODULESETTINGS_MSPSPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_MSPSPEED_MAXOPTVAL 7
+static inline bool ModuleSettingsMSPSpeedIsValid( uint8_t CurrentMSPSpeed ) { return CurrentMSPSpeed <= MODULESETTINGS_MSPSPEED_MAXOPTVAL; }
+// Field LightTelemetrySpeed information
+/* Enumeration options for field LightTelemetrySpeed */
+typedef enum { MODULESETTINGS_LIGHTTELEMETRYSPEED_1200=0, MODULESETTINGS_LIGHTTELEMETRYSPEED_2400=1, MODULESETTINGS_LIGHTTELEMETRYSPEED_4800=2, MODULESETTINGS_LIGHTTELEMETRYSPEED_9600=3, MODULESETTINGS_LIGHTTELEMETRYSPEED_19200=4, MODULESETTINGS_LIGHTTELEMETRYSPEED_38400=5, MODULESETTINGS_LIGHTTELEMETRYSPEED_57600=6, MODULESETTINGS_LIGHTTELEMETRYSPEED_115200=7, MODULESETTINGS_LIGHTTELEMETRYSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsLightTelemetrySpeedOptions;
+#define MODULESETTINGS_LIGHTTELEMETRYSPEED_GLOBAL_MAXOPTVAL 11
+#define MODULESETTINGS_LIGHTTELEMETRYSPEED_MAXOPTVAL 7
+static inline bool ModuleSettingsLightTelemetrySpeedIsValid( uint8_t CurrentLightTelemetrySpeed ) { return CurrentLightTelemetrySpeed <= MODULESETTINGS_LIGHTTELEMETRYSPEED_MAXOPTVAL; }
+// Field FrskyAccelData information
+/* Enumeration options for field FrskyAccelData */
+typedef enum { MODULESETTINGS_FRSKYACCELDATA_ACCELS=0, MODULESETTINGS_FRSKYACCELDATA_NEDACCELS=1, MODULESETTINGS_FRSKYACCELDATA_NEDVELOCITY=2, MODULESETTINGS_FRSKYACCELDATA_ATTITUDEANGLES=3 }  __attribute__((packed)) ModuleSettingsFrskyAccelDataOptions;
+#define MODULESETTINGS_FRSKYACCELDATA_GLOBAL_MAXOPTVAL 3
+#define MODULESETTINGS_FRSKYACCELDATA_MAXOPTVAL 3
+static inline bool ModuleSettingsFrskyAccelDataIsValid( uint8_t CurrentFrskyAccelData ) { return CurrentFrskyAccelData <= MODULESETTINGS_FRSKYACCELDATA_MAXOPTVAL; }
+// Field OpenLogSpeed information
+/* Enumeration options for field OpenLogSpeed */
+typedef enum { MODULESETTINGS_OPENLOGSPEED_115200=0, MODULESETTINGS_OPENLOGSPEED_250000=1, MODULESETTINGS_OPENLOGSPEED_1500000=2, MODULESETTINGS_OPENLOGSPEED_2000000=3, MODULESETTINGS_OPENLOGSPEED_2470000=4 }  __attribute__((packed)) ModuleSettingsOpenLogSpeedOptions;
+#define MODULESETTINGS_OPENLOGSPEED_GLOBAL_MAXOPTVAL 4
+#define MODULESETTINGS_OPENLOGSPEED_MAXOPTVAL 4
+static inline bool ModuleSettingsOpenLogSpeedIsValid( uint8_t CurrentOpenLogSpeed ) { return CurrentOpenLogSpeed <= MODULESETTINGS_OPENLOGSPEED_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void ModuleSettingsAdminStateSet( uint8_t *NewAdminState );
+extern void ModuleSettingsAdminStateGet( uint8_t *NewAdminState );
+extern void ModuleSettingsTelemetrySpeedSet( uint8_t *NewTelemetrySpeed );
+extern void ModuleSettingsTelemetrySpeedGet( uint8_t *NewTelemetrySpeed );
+extern void ModuleSettingsGPSSpeedSet( uint8_t *NewGPSSpeed );
+extern void ModuleSettingsGPSSpeedGet( uint8_t *NewGPSSpeed );
+extern void ModuleSettingsGPSDataProtocolSet( uint8_t *NewGPSDataProtocol );
+extern void ModuleSettingsGPSDataProtocolGet( uint8_t *NewGPSDataProtocol );
+extern void ModuleSettingsGPSAutoConfigureSet( uint8_t *NewGPSAutoConfigure );
+extern void ModuleSettingsGPSAutoConfigureGet( uint8_t *NewGPSAutoConfigure );
+extern void ModuleSettingsGPSConstellationSet( uint8_t *NewGPSConstellation );
+extern void ModuleSettingsGPSConstellationGet( uint8_t *NewGPSConstellation );
+extern void ModuleSettingsGPSSBASConstellationSet( uint8_t *NewGPSSBASConstellation );
+extern void ModuleSettingsGPSSBASConstellationGet( uint8_t *NewGPSSBASConstellation );
+extern void ModuleSettingsGPSDynamicsModeSet( uint8_t *NewGPSDynamicsMode );
+extern void ModuleSettingsGPSDynamicsModeGet( uint8_t *NewGPSDynamicsMode );
+extern void ModuleSettingsComUsbBridgeSpeedSet( uint8_t *NewComUsbBridgeSpeed );
+extern void ModuleSettingsComUsbBridgeSpeedGet( uint8_t *NewComUsbBridgeSpeed );
+extern void ModuleSettingsMavlinkSpeedSet( uint8_t *NewMavlinkSpeed );
+extern void ModuleSettingsMavlinkSpeedGet( uint8_t *NewMavlinkSpeed );
+extern void ModuleSettingsMSPSpeedSet( uint8_t *NewMSPSpeed );
+extern void ModuleSettingsMSPSpeedGet( uint8_t *NewMSPSpeed );
+extern void ModuleSettingsLightTelemetrySpeedSet( uint8_t *NewLightTelemetrySpeed );
+extern void ModuleSettingsLightTelemetrySpeedGet( uint8_t *NewLightTelemetrySpeed );
+extern void ModuleSettingsFrskyAccelDataSet( uint8_t *NewFrskyAccelData );
+extern void ModuleSettingsFrskyAccelDataGet( uint8_t *NewFrskyAccelData );
+extern void ModuleSettingsOpenLogSpeedSet( uint8_t *NewOpenLogSpeed );
+extern void ModuleSettingsOpenLogSpeedGet( uint8_t *NewOpenLogSpeed );
+
+
+#endif // MODULESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       nedposition.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the NEDPosition object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: nedposition.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "nedposition.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 1000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 1000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t NEDPositionInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(NEDPOSITION_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(NEDPOSITION_OBJID,
+			NEDPOSITION_ISSINGLEINST, NEDPOSITION_ISSETTINGS, NEDPOSITION_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void NEDPositionSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	NEDPositionData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void NEDPositionSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void NEDPositionSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	NEDPositionSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		NEDPositionSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle NEDPositionHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void NEDPositionNorthSet( float *NewNorth )
+{
+	UAVObjSetDataField(NEDPositionHandle(), (void*)NewNorth, offsetof( NEDPositionData, North), sizeof(float));
+}
+void NEDPositionNorthGet( float *NewNorth )
+{
+	UAVObjGetDataField(NEDPositionHandle(), (void*)NewNorth, offsetof( NEDPositionData, North), sizeof(float));
+}
+void NEDPositionEastSet( float *NewEast )
+{
+	UAVObjSetDataField(NEDPositionHandle(), (void*)NewEast, offsetof( NEDPositionData, East), sizeof(float));
+}
+void NEDPositionEastGet( float *NewEast )
+{
+	UAVObjGetDataField(NEDPositionHandle(), (void*)NewEast, offsetof( NEDPositionData, East), sizeof(float));
+}
+void NEDPositionDownSet( float *NewDown )
+{
+	UAVObjSetDataField(NEDPositionHandle(), (void*)NewDown, offsetof( NEDPositionData, Down), sizeof(float));
+}
+void NEDPositionDownGet( float *NewDown )
+{
+	UAVObjGetDataField(NEDPositionHandle(), (void*)NewDown, offsetof( NEDPositionData, Down), sizeof(float));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,1118 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup OnScreenDisplayPageSettings OnScreenDisplayPageSettings
+ * @brief On Screen Display Page Settings
+ *
+ *
+ * @file       onscreendisplaypagesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the OnScreenDisplayPageSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ONSCREENDISPLAYPAGESETTINGS_H
+#define ONSCREENDISPLAYPAGESETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ONSCREENDISPLAYPAGESETTINGS_OBJID 0x33405A90
+#define ONSCREENDISPLAYPAGESETTINGS_ISSINGLEINST 1
+#define ONSCREENDISPLAYPAGESETTINGS_ISSETTINGS 1
+#define ONSCREENDISPLAYPAGESETTINGS_NUMBYTES 198
+
+// Generic interface functions
+int32_t OnScreenDisplayPageSettingsInitialize();
+UAVObjHandle OnScreenDisplayPageSettingsHandle();
+void OnScreenDisplayPageSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    int16_t AlarmPosX;
+    int16_t AlarmPosY;
+    int16_t AltitudeScalePos;
+    int16_t AltitudeNumericPosX;
+    int16_t AltitudeNumericPosY;
+    int16_t ArmStatusPosX;
+    int16_t ArmStatusPosY;
+    int16_t BatteryVoltPosX;
+    int16_t BatteryVoltPosY;
+    int16_t BatteryCurrentPosX;
+    int16_t BatteryCurrentPosY;
+    int16_t BatteryConsumedPosX;
+    int16_t BatteryConsumedPosY;
+    int16_t BatteryChargeStatePosX;
+    int16_t BatteryChargeStatePosY;
+    int16_t ClimbRatePosX;
+    int16_t ClimbRatePosY;
+    int16_t CompassPos;
+    int16_t CpuPosX;
+    int16_t CpuPosY;
+    int16_t CustomTextPosX;
+    int16_t CustomTextPosY;
+    int16_t FlightModePosX;
+    int16_t FlightModePosY;
+    int16_t GForcePosX;
+    int16_t GForcePosY;
+    int16_t GpsStatusPosX;
+    int16_t GpsStatusPosY;
+    int16_t GpsLatPosX;
+    int16_t GpsLatPosY;
+    int16_t GpsLonPosX;
+    int16_t GpsLonPosY;
+    int16_t GpsMgrsPosX;
+    int16_t GpsMgrsPosY;
+    int16_t HomeDistancePosX;
+    int16_t HomeDistancePosY;
+    int16_t HomeArrowPosX;
+    int16_t HomeArrowPosY;
+    int16_t MapWidthMeters;
+    int16_t MapWidthPixels;
+    int16_t MapHeightMeters;
+    int16_t MapHeightPixels;
+    int16_t RssiPosX;
+    int16_t RssiPosY;
+    int16_t SpeedScalePos;
+    int16_t SpeedNumericPosX;
+    int16_t SpeedNumericPosY;
+    int16_t TimePosX;
+    int16_t TimePosY;
+    int16_t ThrottlePosX;
+    int16_t ThrottlePosY;
+    int16_t VTXFreqPosX;
+    int16_t VTXFreqPosY;
+    int16_t VTXPowerPosX;
+    int16_t VTXPowerPosY;
+    uint8_t Alarm;
+    uint8_t AlarmFont;
+    uint8_t AlarmAlign;
+    uint8_t AltitudeScale;
+    uint8_t AltitudeScaleAlign;
+    uint8_t AltitudeScaleSource;
+    uint8_t AltitudeNumeric;
+    uint8_t AltitudeNumericAlign;
+    uint8_t AltitudeNumericFont;
+    uint8_t AltitudeNumericSource;
+    uint8_t ArmStatus;
+    uint8_t ArmStatusFont;
+    uint8_t ArmStatusAlign;
+    uint8_t ArtificialHorizon;
+    uint8_t ArtificialHorizonMaxPitch;
+    uint8_t ArtificialHorizonPitchSteps;
+    uint8_t BatteryVolt;
+    uint8_t BatteryVoltFont;
+    uint8_t BatteryVoltAlign;
+    uint8_t BatteryCurrent;
+    uint8_t BatteryCurrentFont;
+    uint8_t BatteryCurrentAlign;
+    uint8_t BatteryConsumed;
+    uint8_t BatteryConsumedFont;
+    uint8_t BatteryConsumedAlign;
+    uint8_t BatteryChargeState;
+    uint8_t CenterMark;
+    uint8_t ClimbRate;
+    uint8_t ClimbRateFont;
+    uint8_t ClimbRateAlign;
+    uint8_t Compass;
+    uint8_t CompassHomeDir;
+    uint8_t Cpu;
+    uint8_t CpuFont;
+    uint8_t CpuAlign;
+    uint8_t CustomText;
+    uint8_t CustomTextFont;
+    uint8_t CustomTextAlign;
+    uint8_t FlightMode;
+    uint8_t FlightModeFont;
+    uint8_t FlightModeAlign;
+    uint8_t GForce;
+    uint8_t GForceFont;
+    uint8_t GForceAlign;
+    uint8_t GpsStatus;
+    uint8_t GpsStatusFont;
+    uint8_t GpsLat;
+    uint8_t GpsLatFont;
+    uint8_t GpsLatAlign;
+    uint8_t GpsLon;
+    uint8_t GpsLonFont;
+    uint8_t GpsLonAlign;
+    uint8_t GpsMgrs;
+    uint8_t GpsMgrsFont;
+    uint8_t GpsMgrsAlign;
+    uint8_t HomeDistance;
+    uint8_t HomeDistanceFont;
+    uint8_t HomeDistanceShowIcon;
+    uint8_t HomeArrow;
+    uint8_t Map;
+    uint8_t MapCenterMode;
+    uint8_t MapShowWp;
+    uint8_t MapShowUavHome;
+    uint8_t MapShowTablet;
+    uint8_t Rssi;
+    uint8_t RssiFont;
+    uint8_t RssiShowIcon;
+    uint8_t SpeedScale;
+    uint8_t SpeedScaleAlign;
+    uint8_t SpeedScaleSource;
+    uint8_t SpeedNumeric;
+    uint8_t SpeedNumericFont;
+    uint8_t SpeedNumericAlign;
+    uint8_t SpeedNumericSource;
+    uint8_t Time;
+    uint8_t TimeFont;
+    uint8_t TimeAlign;
+    uint8_t Throttle;
+    uint8_t ThrottleFont;
+    uint8_t ThrottleAlign;
+    uint8_t VTXFreq;
+    uint8_t VTXFreqFont;
+    uint8_t VTXFreqAlign;
+    uint8_t VTXFreqShowUnit;
+    uint8_t VTXPower;
+    uint8_t VTXPowerFont;
+    uint8_t VTXPowerAlign;
+    uint8_t VTXPowerShowUnit;
+
+} __attribute__((packed)) __attribute__((aligned(4))) OnScreenDisplayPageSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function OnScreenDisplayPageSettingsGet(dataOut)
+ * @brief Populate a OnScreenDisplayPageSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t OnScreenDisplayPageSettingsGet(OnScreenDisplayPageSettingsData *dataOut) { return UAVObjGetData(OnScreenDisplayPageSettingsHandle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettingsSet(const OnScreenDisplayPageSettingsData *dataIn) { return UAVObjSetData(OnScreenDisplayPageSettingsHandle(), dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettingsInstGet(uint16_t instId, OnScreenDisplayPageSettingsData *dataOut) { return UAVObjGetInstanceData(OnScreenDisplayPageSettingsHandle(), instId, dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettingsInstSet(uint16_t instId, const OnScreenDisplayPageSettingsData *dataIn) { return UAVObjSetInstanceData(OnScreenDisplayPageSettingsHandle(), instId, dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(OnScreenDisplayPageSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(OnScreenDisplayPageSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(OnScreenDisplayPageSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettingsConnectCopy(volatile OnScreenDisplayPageSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	OnScreenDisplayPageSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(OnScreenDisplayPageSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t OnScreenDisplayPageSettingsCreateInstance() { return UAVObjCreateInstance(OnScreenDisplayPageSettingsHandle(), &OnScreenDisplayPageSettingsSetDefaults); }
+
+static inline void OnScreenDisplayPageSettingsUpdated() { UAVObjUpdated(OnScreenDisplayPageSettingsHandle()); }
+
+static inline void OnScreenDisplayPageSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(OnScreenDisplayPageSettingsHandle(), instId); }
+
+static inline int32_t OnScreenDisplayPageSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(OnScreenDisplayPageSettingsHandle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(OnScreenDisplayPageSettingsHandle(), dataIn); }
+
+static inline int8_t OnScreenDisplayPageSettingsReadOnly() { return UAVObjReadOnly(OnScreenDisplayPageSettingsHandle()); }
+
+static inline uint16_t OnScreenDisplayPageSettingsGetNumInstances(){ return UAVObjGetNumInstances(OnScreenDisplayPageSettingsHandle()); }
+
+static inline uint32_t OnScreenDisplayPageSettingsGetNumBytes(){ return UAVObjGetNumBytes(OnScreenDisplayPageSettingsHandle()); }
+
+// Field information
+// Field AlarmPosX information
+// Field AlarmPosY information
+// Field AltitudeScalePos information
+// Field AltitudeNumericPosX information
+// Field AltitudeNumericPosY information
+// Field ArmStatusPosX information
+// Field ArmStatusPosY information
+// Field BatteryVoltPosX information
+// Field BatteryVoltPosY information
+// Field BatteryCurrentPosX information
+// Field BatteryCurrentPosY information
+// Field BatteryConsumedPosX information
+// Field BatteryConsumedPosY information
+// Field BatteryChargeStatePosX information
+// Field BatteryChargeStatePosY information
+// Field ClimbRatePosX information
+// Field ClimbRatePosY information
+// Field CompassPos information
+// Field CpuPosX information
+// Field CpuPosY information
+// Field CustomTextPosX information
+// Field CustomTextPosY information
+// Field FlightModePosX information
+// Field FlightModePosY information
+// Field GForcePosX information
+// Field GForcePosY information
+// Field GpsStatusPosX information
+// Field GpsStatusPosY information
+// Field GpsLatPosX information
+// Field GpsLatPosY information
+// Field GpsLonPosX information
+// Field GpsLonPosY information
+// Field GpsMgrsPosX information
+// Field GpsMgrsPosY information
+// Field HomeDistancePosX information
+// Field HomeDistancePosY information
+// Field HomeArrowPosX information
+// Field HomeArrowPosY information
+// Field MapWidthMeters information
+// Field MapWidthPixels information
+// Field MapHeightMeters information
+// Field MapHeightPixels information
+// Field RssiPosX information
+// Field RssiPosY information
+// Field SpeedScalePos information
+// Field SpeedNumericPosX information
+// Field SpeedNumericPosY information
+// Field TimePosX information
+// Field TimePosY information
+// Field ThrottlePosX information
+// Field ThrottlePosY information
+// Field VTXFreqPosX information
+// Field VTXFreqPosY information
+// Field VTXPowerPosX information
+// Field VTXPowerPosY information
+// Field Alarm information
+/* Enumeration options for field Alarm */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALARM_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_ALARM_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAlarmOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALARM_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALARM_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAlarmIsValid( uint8_t CurrentAlarm ) { return CurrentAlarm <= ONSCREENDISPLAYPAGESETTINGS_ALARM_MAXOPTVAL; }
+// Field AlarmFont information
+/* Enumeration options for field AlarmFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsAlarmFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsAlarmFontIsValid( uint8_t CurrentAlarmFont ) { return CurrentAlarmFont <= ONSCREENDISPLAYPAGESETTINGS_ALARMFONT_MAXOPTVAL; }
+// Field AlarmAlign information
+/* Enumeration options for field AlarmAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsAlarmAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsAlarmAlignIsValid( uint8_t CurrentAlarmAlign ) { return CurrentAlarmAlign <= ONSCREENDISPLAYPAGESETTINGS_ALARMALIGN_MAXOPTVAL; }
+// Field AltitudeScale information
+/* Enumeration options for field AltitudeScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeScaleIsValid( uint8_t CurrentAltitudeScale ) { return CurrentAltitudeScale <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALE_MAXOPTVAL; }
+// Field AltitudeScaleAlign information
+/* Enumeration options for field AltitudeScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeScaleAlignIsValid( uint8_t CurrentAltitudeScaleAlign ) { return CurrentAltitudeScaleAlign <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_MAXOPTVAL; }
+// Field AltitudeScaleSource information
+/* Enumeration options for field AltitudeScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeScaleSourceIsValid( uint8_t CurrentAltitudeScaleSource ) { return CurrentAltitudeScaleSource <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_MAXOPTVAL; }
+// Field AltitudeNumeric information
+/* Enumeration options for field AltitudeNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeNumericIsValid( uint8_t CurrentAltitudeNumeric ) { return CurrentAltitudeNumeric <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERIC_MAXOPTVAL; }
+// Field AltitudeNumericAlign information
+/* Enumeration options for field AltitudeNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeNumericAlignIsValid( uint8_t CurrentAltitudeNumericAlign ) { return CurrentAltitudeNumericAlign <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICALIGN_MAXOPTVAL; }
+// Field AltitudeNumericFont information
+/* Enumeration options for field AltitudeNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsAltitudeNumericFontIsValid( uint8_t CurrentAltitudeNumericFont ) { return CurrentAltitudeNumericFont <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICFONT_MAXOPTVAL; }
+// Field AltitudeNumericSource information
+/* Enumeration options for field AltitudeNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsAltitudeNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsAltitudeNumericSourceIsValid( uint8_t CurrentAltitudeNumericSource ) { return CurrentAltitudeNumericSource <= ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_MAXOPTVAL; }
+// Field ArmStatus information
+/* Enumeration options for field ArmStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ARMSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_ARMSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsArmStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsArmStatusIsValid( uint8_t CurrentArmStatus ) { return CurrentArmStatus <= ONSCREENDISPLAYPAGESETTINGS_ARMSTATUS_MAXOPTVAL; }
+// Field ArmStatusFont information
+/* Enumeration options for field ArmStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsArmStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsArmStatusFontIsValid( uint8_t CurrentArmStatusFont ) { return CurrentArmStatusFont <= ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSFONT_MAXOPTVAL; }
+// Field ArmStatusAlign information
+/* Enumeration options for field ArmStatusAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsArmStatusAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsArmStatusAlignIsValid( uint8_t CurrentArmStatusAlign ) { return CurrentArmStatusAlign <= ONSCREENDISPLAYPAGESETTINGS_ARMSTATUSALIGN_MAXOPTVAL; }
+// Field ArtificialHorizon information
+/* Enumeration options for field ArtificialHorizon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_ARTIFICIALHORIZON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_ARTIFICIALHORIZON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsArtificialHorizonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_ARTIFICIALHORIZON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_ARTIFICIALHORIZON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsArtificialHorizonIsValid( uint8_t CurrentArtificialHorizon ) { return CurrentArtificialHorizon <= ONSCREENDISPLAYPAGESETTINGS_ARTIFICIALHORIZON_MAXOPTVAL; }
+// Field ArtificialHorizonMaxPitch information
+// Field ArtificialHorizonPitchSteps information
+// Field BatteryVolt information
+/* Enumeration options for field BatteryVolt */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryVoltOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsBatteryVoltIsValid( uint8_t CurrentBatteryVolt ) { return CurrentBatteryVolt <= ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLT_MAXOPTVAL; }
+// Field BatteryVoltFont information
+/* Enumeration options for field BatteryVoltFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryVoltFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryVoltFontIsValid( uint8_t CurrentBatteryVoltFont ) { return CurrentBatteryVoltFont <= ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTFONT_MAXOPTVAL; }
+// Field BatteryVoltAlign information
+/* Enumeration options for field BatteryVoltAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryVoltAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryVoltAlignIsValid( uint8_t CurrentBatteryVoltAlign ) { return CurrentBatteryVoltAlign <= ONSCREENDISPLAYPAGESETTINGS_BATTERYVOLTALIGN_MAXOPTVAL; }
+// Field BatteryCurrent information
+/* Enumeration options for field BatteryCurrent */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryCurrentOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsBatteryCurrentIsValid( uint8_t CurrentBatteryCurrent ) { return CurrentBatteryCurrent <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENT_MAXOPTVAL; }
+// Field BatteryCurrentFont information
+/* Enumeration options for field BatteryCurrentFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryCurrentFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryCurrentFontIsValid( uint8_t CurrentBatteryCurrentFont ) { return CurrentBatteryCurrentFont <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTFONT_MAXOPTVAL; }
+// Field BatteryCurrentAlign information
+/* Enumeration options for field BatteryCurrentAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryCurrentAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryCurrentAlignIsValid( uint8_t CurrentBatteryCurrentAlign ) { return CurrentBatteryCurrentAlign <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCURRENTALIGN_MAXOPTVAL; }
+// Field BatteryConsumed information
+/* Enumeration options for field BatteryConsumed */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMED_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryConsumedOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMED_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMED_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsBatteryConsumedIsValid( uint8_t CurrentBatteryConsumed ) { return CurrentBatteryConsumed <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMED_MAXOPTVAL; }
+// Field BatteryConsumedFont information
+/* Enumeration options for field BatteryConsumedFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryConsumedFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryConsumedFontIsValid( uint8_t CurrentBatteryConsumedFont ) { return CurrentBatteryConsumedFont <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDFONT_MAXOPTVAL; }
+// Field BatteryConsumedAlign information
+/* Enumeration options for field BatteryConsumedAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryConsumedAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsBatteryConsumedAlignIsValid( uint8_t CurrentBatteryConsumedAlign ) { return CurrentBatteryConsumedAlign <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCONSUMEDALIGN_MAXOPTVAL; }
+// Field BatteryChargeState information
+/* Enumeration options for field BatteryChargeState */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_BATTERYCHARGESTATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_BATTERYCHARGESTATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsBatteryChargeStateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCHARGESTATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_BATTERYCHARGESTATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsBatteryChargeStateIsValid( uint8_t CurrentBatteryChargeState ) { return CurrentBatteryChargeState <= ONSCREENDISPLAYPAGESETTINGS_BATTERYCHARGESTATE_MAXOPTVAL; }
+// Field CenterMark information
+/* Enumeration options for field CenterMark */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_MIDDLE=1, ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_CAMERAPITCH=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsCenterMarkOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsCenterMarkIsValid( uint8_t CurrentCenterMark ) { return CurrentCenterMark <= ONSCREENDISPLAYPAGESETTINGS_CENTERMARK_MAXOPTVAL; }
+// Field ClimbRate information
+/* Enumeration options for field ClimbRate */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CLIMBRATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_CLIMBRATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsClimbRateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsClimbRateIsValid( uint8_t CurrentClimbRate ) { return CurrentClimbRate <= ONSCREENDISPLAYPAGESETTINGS_CLIMBRATE_MAXOPTVAL; }
+// Field ClimbRateFont information
+/* Enumeration options for field ClimbRateFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsClimbRateFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsClimbRateFontIsValid( uint8_t CurrentClimbRateFont ) { return CurrentClimbRateFont <= ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEFONT_MAXOPTVAL; }
+// Field ClimbRateAlign information
+/* Enumeration options for field ClimbRateAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsClimbRateAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsClimbRateAlignIsValid( uint8_t CurrentClimbRateAlign ) { return CurrentClimbRateAlign <= ONSCREENDISPLAYPAGESETTINGS_CLIMBRATEALIGN_MAXOPTVAL; }
+// Field Compass information
+/* Enumeration options for field Compass */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_COMPASS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_COMPASS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsCompassOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_COMPASS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_COMPASS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsCompassIsValid( uint8_t CurrentCompass ) { return CurrentCompass <= ONSCREENDISPLAYPAGESETTINGS_COMPASS_MAXOPTVAL; }
+// Field CompassHomeDir information
+/* Enumeration options for field CompassHomeDir */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_COMPASSHOMEDIR_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_COMPASSHOMEDIR_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsCompassHomeDirOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_COMPASSHOMEDIR_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_COMPASSHOMEDIR_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsCompassHomeDirIsValid( uint8_t CurrentCompassHomeDir ) { return CurrentCompassHomeDir <= ONSCREENDISPLAYPAGESETTINGS_COMPASSHOMEDIR_MAXOPTVAL; }
+// Field Cpu information
+/* Enumeration options for field Cpu */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CPU_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_CPU_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsCpuOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CPU_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_CPU_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsCpuIsValid( uint8_t CurrentCpu ) { return CurrentCpu <= ONSCREENDISPLAYPAGESETTINGS_CPU_MAXOPTVAL; }
+// Field CpuFont information
+/* Enumeration options for field CpuFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CPUFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_CPUFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_CPUFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsCpuFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CPUFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CPUFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsCpuFontIsValid( uint8_t CurrentCpuFont ) { return CurrentCpuFont <= ONSCREENDISPLAYPAGESETTINGS_CPUFONT_MAXOPTVAL; }
+// Field CpuAlign information
+/* Enumeration options for field CpuAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsCpuAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsCpuAlignIsValid( uint8_t CurrentCpuAlign ) { return CurrentCpuAlign <= ONSCREENDISPLAYPAGESETTINGS_CPUALIGN_MAXOPTVAL; }
+// Field CustomText information
+/* Enumeration options for field CustomText */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsCustomTextOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsCustomTextIsValid( uint8_t CurrentCustomText ) { return CurrentCustomText <= ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXT_MAXOPTVAL; }
+// Field CustomTextFont information
+/* Enumeration options for field CustomTextFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsCustomTextFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsCustomTextFontIsValid( uint8_t CurrentCustomTextFont ) { return CurrentCustomTextFont <= ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTFONT_MAXOPTVAL; }
+// Field CustomTextAlign information
+/* Enumeration options for field CustomTextAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsCustomTextAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsCustomTextAlignIsValid( uint8_t CurrentCustomTextAlign ) { return CurrentCustomTextAlign <= ONSCREENDISPLAYPAGESETTINGS_CUSTOMTEXTALIGN_MAXOPTVAL; }
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsFlightModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsFlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode <= ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODE_MAXOPTVAL; }
+// Field FlightModeFont information
+/* Enumeration options for field FlightModeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsFlightModeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsFlightModeFontIsValid( uint8_t CurrentFlightModeFont ) { return CurrentFlightModeFont <= ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEFONT_MAXOPTVAL; }
+// Field FlightModeAlign information
+/* Enumeration options for field FlightModeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsFlightModeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsFlightModeAlignIsValid( uint8_t CurrentFlightModeAlign ) { return CurrentFlightModeAlign <= ONSCREENDISPLAYPAGESETTINGS_FLIGHTMODEALIGN_MAXOPTVAL; }
+// Field GForce information
+/* Enumeration options for field GForce */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GFORCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_GFORCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsGForceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsGForceIsValid( uint8_t CurrentGForce ) { return CurrentGForce <= ONSCREENDISPLAYPAGESETTINGS_GFORCE_MAXOPTVAL; }
+// Field GForceFont information
+/* Enumeration options for field GForceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGForceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGForceFontIsValid( uint8_t CurrentGForceFont ) { return CurrentGForceFont <= ONSCREENDISPLAYPAGESETTINGS_GFORCEFONT_MAXOPTVAL; }
+// Field GForceAlign information
+/* Enumeration options for field GForceAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGForceAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGForceAlignIsValid( uint8_t CurrentGForceAlign ) { return CurrentGForceAlign <= ONSCREENDISPLAYPAGESETTINGS_GFORCEALIGN_MAXOPTVAL; }
+// Field GpsStatus information
+/* Enumeration options for field GpsStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_GPSSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_GPSSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsGpsStatusIsValid( uint8_t CurrentGpsStatus ) { return CurrentGpsStatus <= ONSCREENDISPLAYPAGESETTINGS_GPSSTATUS_MAXOPTVAL; }
+// Field GpsStatusFont information
+/* Enumeration options for field GpsStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsStatusFontIsValid( uint8_t CurrentGpsStatusFont ) { return CurrentGpsStatusFont <= ONSCREENDISPLAYPAGESETTINGS_GPSSTATUSFONT_MAXOPTVAL; }
+// Field GpsLat information
+/* Enumeration options for field GpsLat */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLAT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_GPSLAT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLatOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLAT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLAT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsGpsLatIsValid( uint8_t CurrentGpsLat ) { return CurrentGpsLat <= ONSCREENDISPLAYPAGESETTINGS_GPSLAT_MAXOPTVAL; }
+// Field GpsLatFont information
+/* Enumeration options for field GpsLatFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLatFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsLatFontIsValid( uint8_t CurrentGpsLatFont ) { return CurrentGpsLatFont <= ONSCREENDISPLAYPAGESETTINGS_GPSLATFONT_MAXOPTVAL; }
+// Field GpsLatAlign information
+/* Enumeration options for field GpsLatAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLatAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsLatAlignIsValid( uint8_t CurrentGpsLatAlign ) { return CurrentGpsLatAlign <= ONSCREENDISPLAYPAGESETTINGS_GPSLATALIGN_MAXOPTVAL; }
+// Field GpsLon information
+/* Enumeration options for field GpsLon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_GPSLON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsGpsLonIsValid( uint8_t CurrentGpsLon ) { return CurrentGpsLon <= ONSCREENDISPLAYPAGESETTINGS_GPSLON_MAXOPTVAL; }
+// Field GpsLonFont information
+/* Enumeration options for field GpsLonFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLonFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsLonFontIsValid( uint8_t CurrentGpsLonFont ) { return CurrentGpsLonFont <= ONSCREENDISPLAYPAGESETTINGS_GPSLONFONT_MAXOPTVAL; }
+// Field GpsLonAlign information
+/* Enumeration options for field GpsLonAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsLonAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsLonAlignIsValid( uint8_t CurrentGpsLonAlign ) { return CurrentGpsLonAlign <= ONSCREENDISPLAYPAGESETTINGS_GPSLONALIGN_MAXOPTVAL; }
+// Field GpsMgrs information
+/* Enumeration options for field GpsMgrs */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSMGRS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_GPSMGRS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsMgrsOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsGpsMgrsIsValid( uint8_t CurrentGpsMgrs ) { return CurrentGpsMgrs <= ONSCREENDISPLAYPAGESETTINGS_GPSMGRS_MAXOPTVAL; }
+// Field GpsMgrsFont information
+/* Enumeration options for field GpsMgrsFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsMgrsFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsMgrsFontIsValid( uint8_t CurrentGpsMgrsFont ) { return CurrentGpsMgrsFont <= ONSCREENDISPLAYPAGESETTINGS_GPSMGRSFONT_MAXOPTVAL; }
+// Field GpsMgrsAlign information
+/* Enumeration options for field GpsMgrsAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsGpsMgrsAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsGpsMgrsAlignIsValid( uint8_t CurrentGpsMgrsAlign ) { return CurrentGpsMgrsAlign <= ONSCREENDISPLAYPAGESETTINGS_GPSMGRSALIGN_MAXOPTVAL; }
+// Field HomeDistance information
+/* Enumeration options for field HomeDistance */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsHomeDistanceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsHomeDistanceIsValid( uint8_t CurrentHomeDistance ) { return CurrentHomeDistance <= ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCE_MAXOPTVAL; }
+// Field HomeDistanceFont information
+/* Enumeration options for field HomeDistanceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsHomeDistanceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsHomeDistanceFontIsValid( uint8_t CurrentHomeDistanceFont ) { return CurrentHomeDistanceFont <= ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCEFONT_MAXOPTVAL; }
+// Field HomeDistanceShowIcon information
+/* Enumeration options for field HomeDistanceShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCESHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCESHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsHomeDistanceShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCESHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCESHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsHomeDistanceShowIconIsValid( uint8_t CurrentHomeDistanceShowIcon ) { return CurrentHomeDistanceShowIcon <= ONSCREENDISPLAYPAGESETTINGS_HOMEDISTANCESHOWICON_MAXOPTVAL; }
+// Field HomeArrow information
+/* Enumeration options for field HomeArrow */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_HOMEARROW_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_HOMEARROW_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsHomeArrowOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEARROW_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_HOMEARROW_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsHomeArrowIsValid( uint8_t CurrentHomeArrow ) { return CurrentHomeArrow <= ONSCREENDISPLAYPAGESETTINGS_HOMEARROW_MAXOPTVAL; }
+// Field Map information
+/* Enumeration options for field Map */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_MAP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_MAP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsMapOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_MAP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_MAP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsMapIsValid( uint8_t CurrentMap ) { return CurrentMap <= ONSCREENDISPLAYPAGESETTINGS_MAP_MAXOPTVAL; }
+// Field MapCenterMode information
+/* Enumeration options for field MapCenterMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_UAV=0, ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_HOME=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsMapCenterModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsMapCenterModeIsValid( uint8_t CurrentMapCenterMode ) { return CurrentMapCenterMode <= ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_MAXOPTVAL; }
+// Field MapShowWp information
+/* Enumeration options for field MapShowWp */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_MAPSHOWWP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_MAPSHOWWP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsMapShowWpOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWWP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWWP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsMapShowWpIsValid( uint8_t CurrentMapShowWp ) { return CurrentMapShowWp <= ONSCREENDISPLAYPAGESETTINGS_MAPSHOWWP_MAXOPTVAL; }
+// Field MapShowUavHome information
+/* Enumeration options for field MapShowUavHome */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_MAPSHOWUAVHOME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_MAPSHOWUAVHOME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsMapShowUavHomeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWUAVHOME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWUAVHOME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsMapShowUavHomeIsValid( uint8_t CurrentMapShowUavHome ) { return CurrentMapShowUavHome <= ONSCREENDISPLAYPAGESETTINGS_MAPSHOWUAVHOME_MAXOPTVAL; }
+// Field MapShowTablet information
+/* Enumeration options for field MapShowTablet */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_MAPSHOWTABLET_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_MAPSHOWTABLET_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsMapShowTabletOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWTABLET_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_MAPSHOWTABLET_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsMapShowTabletIsValid( uint8_t CurrentMapShowTablet ) { return CurrentMapShowTablet <= ONSCREENDISPLAYPAGESETTINGS_MAPSHOWTABLET_MAXOPTVAL; }
+// Field Rssi information
+/* Enumeration options for field Rssi */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_RSSI_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_RSSI_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsRssiOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_RSSI_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_RSSI_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsRssiIsValid( uint8_t CurrentRssi ) { return CurrentRssi <= ONSCREENDISPLAYPAGESETTINGS_RSSI_MAXOPTVAL; }
+// Field RssiFont information
+/* Enumeration options for field RssiFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsRssiFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsRssiFontIsValid( uint8_t CurrentRssiFont ) { return CurrentRssiFont <= ONSCREENDISPLAYPAGESETTINGS_RSSIFONT_MAXOPTVAL; }
+// Field RssiShowIcon information
+/* Enumeration options for field RssiShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_RSSISHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_RSSISHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsRssiShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_RSSISHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_RSSISHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsRssiShowIconIsValid( uint8_t CurrentRssiShowIcon ) { return CurrentRssiShowIcon <= ONSCREENDISPLAYPAGESETTINGS_RSSISHOWICON_MAXOPTVAL; }
+// Field SpeedScale information
+/* Enumeration options for field SpeedScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsSpeedScaleIsValid( uint8_t CurrentSpeedScale ) { return CurrentSpeedScale <= ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALE_MAXOPTVAL; }
+// Field SpeedScaleAlign information
+/* Enumeration options for field SpeedScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsSpeedScaleAlignIsValid( uint8_t CurrentSpeedScaleAlign ) { return CurrentSpeedScaleAlign <= ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_MAXOPTVAL; }
+// Field SpeedScaleSource information
+/* Enumeration options for field SpeedScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsSpeedScaleSourceIsValid( uint8_t CurrentSpeedScaleSource ) { return CurrentSpeedScaleSource <= ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_MAXOPTVAL; }
+// Field SpeedNumeric information
+/* Enumeration options for field SpeedNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsSpeedNumericIsValid( uint8_t CurrentSpeedNumeric ) { return CurrentSpeedNumeric <= ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERIC_MAXOPTVAL; }
+// Field SpeedNumericFont information
+/* Enumeration options for field SpeedNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsSpeedNumericFontIsValid( uint8_t CurrentSpeedNumericFont ) { return CurrentSpeedNumericFont <= ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICFONT_MAXOPTVAL; }
+// Field SpeedNumericAlign information
+/* Enumeration options for field SpeedNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsSpeedNumericAlignIsValid( uint8_t CurrentSpeedNumericAlign ) { return CurrentSpeedNumericAlign <= ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICALIGN_MAXOPTVAL; }
+// Field SpeedNumericSource information
+/* Enumeration options for field SpeedNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsSpeedNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsSpeedNumericSourceIsValid( uint8_t CurrentSpeedNumericSource ) { return CurrentSpeedNumericSource <= ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_MAXOPTVAL; }
+// Field Time information
+/* Enumeration options for field Time */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_TIME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_TIME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsTimeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_TIME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_TIME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsTimeIsValid( uint8_t CurrentTime ) { return CurrentTime <= ONSCREENDISPLAYPAGESETTINGS_TIME_MAXOPTVAL; }
+// Field TimeFont information
+/* Enumeration options for field TimeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsTimeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsTimeFontIsValid( uint8_t CurrentTimeFont ) { return CurrentTimeFont <= ONSCREENDISPLAYPAGESETTINGS_TIMEFONT_MAXOPTVAL; }
+// Field TimeAlign information
+/* Enumeration options for field TimeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsTimeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsTimeAlignIsValid( uint8_t CurrentTimeAlign ) { return CurrentTimeAlign <= ONSCREENDISPLAYPAGESETTINGS_TIMEALIGN_MAXOPTVAL; }
+// Field Throttle information
+/* Enumeration options for field Throttle */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_THROTTLE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_THROTTLE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsThrottleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsThrottleIsValid( uint8_t CurrentThrottle ) { return CurrentThrottle <= ONSCREENDISPLAYPAGESETTINGS_THROTTLE_MAXOPTVAL; }
+// Field ThrottleFont information
+/* Enumeration options for field ThrottleFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsThrottleFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsThrottleFontIsValid( uint8_t CurrentThrottleFont ) { return CurrentThrottleFont <= ONSCREENDISPLAYPAGESETTINGS_THROTTLEFONT_MAXOPTVAL; }
+// Field ThrottleAlign information
+/* Enumeration options for field ThrottleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsThrottleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsThrottleAlignIsValid( uint8_t CurrentThrottleAlign ) { return CurrentThrottleAlign <= ONSCREENDISPLAYPAGESETTINGS_THROTTLEALIGN_MAXOPTVAL; }
+// Field VTXFreq information
+/* Enumeration options for field VTXFreq */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXFREQ_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_VTXFREQ_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXFreqOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQ_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQ_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsVTXFreqIsValid( uint8_t CurrentVTXFreq ) { return CurrentVTXFreq <= ONSCREENDISPLAYPAGESETTINGS_VTXFREQ_MAXOPTVAL; }
+// Field VTXFreqFont information
+/* Enumeration options for field VTXFreqFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXFreqFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsVTXFreqFontIsValid( uint8_t CurrentVTXFreqFont ) { return CurrentVTXFreqFont <= ONSCREENDISPLAYPAGESETTINGS_VTXFREQFONT_MAXOPTVAL; }
+// Field VTXFreqAlign information
+/* Enumeration options for field VTXFreqAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXFreqAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsVTXFreqAlignIsValid( uint8_t CurrentVTXFreqAlign ) { return CurrentVTXFreqAlign <= ONSCREENDISPLAYPAGESETTINGS_VTXFREQALIGN_MAXOPTVAL; }
+// Field VTXFreqShowUnit information
+/* Enumeration options for field VTXFreqShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXFREQSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_VTXFREQSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXFreqShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_VTXFREQSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsVTXFreqShowUnitIsValid( uint8_t CurrentVTXFreqShowUnit ) { return CurrentVTXFreqShowUnit <= ONSCREENDISPLAYPAGESETTINGS_VTXFREQSHOWUNIT_MAXOPTVAL; }
+// Field VTXPower information
+/* Enumeration options for field VTXPower */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXPOWER_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_VTXPOWER_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXPowerOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWER_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWER_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsVTXPowerIsValid( uint8_t CurrentVTXPower ) { return CurrentVTXPower <= ONSCREENDISPLAYPAGESETTINGS_VTXPOWER_MAXOPTVAL; }
+// Field VTXPowerFont information
+/* Enumeration options for field VTXPowerFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXPowerFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsVTXPowerFontIsValid( uint8_t CurrentVTXPowerFont ) { return CurrentVTXPowerFont <= ONSCREENDISPLAYPAGESETTINGS_VTXPOWERFONT_MAXOPTVAL; }
+// Field VTXPowerAlign information
+/* Enumeration options for field VTXPowerAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXPowerAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettingsVTXPowerAlignIsValid( uint8_t CurrentVTXPowerAlign ) { return CurrentVTXPowerAlign <= ONSCREENDISPLAYPAGESETTINGS_VTXPOWERALIGN_MAXOPTVAL; }
+// Field VTXPowerShowUnit information
+/* Enumeration options for field VTXPowerShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS_VTXPOWERSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS_VTXPOWERSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettingsVTXPowerShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS_VTXPOWERSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettingsVTXPowerShowUnitIsValid( uint8_t CurrentVTXPowerShowUnit ) { return CurrentVTXPowerShowUnit <= ONSCREENDISPLAYPAGESETTINGS_VTXPOWERSHOWUNIT_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void OnScreenDisplayPageSettingsAlarmPosXSet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettingsAlarmPosXGet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettingsAlarmPosYSet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettingsAlarmPosYGet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettingsAltitudeScalePosSet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettingsAltitudeScalePosGet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettingsAltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettingsAltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettingsAltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettingsAltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettingsArmStatusPosXSet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettingsArmStatusPosXGet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettingsArmStatusPosYSet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettingsArmStatusPosYGet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettingsBatteryVoltPosXSet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettingsBatteryVoltPosXGet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettingsBatteryVoltPosYSet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettingsBatteryVoltPosYGet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettingsBatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettingsBatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettingsBatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettingsBatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettingsBatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettingsBatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettingsBatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettingsBatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettingsBatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettingsBatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettingsBatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettingsBatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettingsClimbRatePosXSet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettingsClimbRatePosXGet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettingsClimbRatePosYSet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettingsClimbRatePosYGet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettingsCompassPosSet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettingsCompassPosGet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettingsCpuPosXSet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettingsCpuPosXGet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettingsCpuPosYSet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettingsCpuPosYGet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettingsCustomTextPosXSet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettingsCustomTextPosXGet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettingsCustomTextPosYSet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettingsCustomTextPosYGet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettingsFlightModePosXSet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettingsFlightModePosXGet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettingsFlightModePosYSet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettingsFlightModePosYGet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettingsGForcePosXSet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettingsGForcePosXGet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettingsGForcePosYSet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettingsGForcePosYGet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettingsGpsStatusPosXSet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettingsGpsStatusPosXGet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettingsGpsStatusPosYSet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettingsGpsStatusPosYGet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettingsGpsLatPosXSet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettingsGpsLatPosXGet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettingsGpsLatPosYSet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettingsGpsLatPosYGet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettingsGpsLonPosXSet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettingsGpsLonPosXGet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettingsGpsLonPosYSet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettingsGpsLonPosYGet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettingsGpsMgrsPosXSet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettingsGpsMgrsPosXGet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettingsGpsMgrsPosYSet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettingsGpsMgrsPosYGet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettingsHomeDistancePosXSet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettingsHomeDistancePosXGet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettingsHomeDistancePosYSet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettingsHomeDistancePosYGet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettingsHomeArrowPosXSet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettingsHomeArrowPosXGet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettingsHomeArrowPosYSet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettingsHomeArrowPosYGet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettingsMapWidthMetersSet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettingsMapWidthMetersGet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettingsMapWidthPixelsSet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettingsMapWidthPixelsGet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettingsMapHeightMetersSet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettingsMapHeightMetersGet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettingsMapHeightPixelsSet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettingsMapHeightPixelsGet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettingsRssiPosXSet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettingsRssiPosXGet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettingsRssiPosYSet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettingsRssiPosYGet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettingsSpeedScalePosSet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettingsSpeedScalePosGet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettingsSpeedNumericPosXSet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettingsSpeedNumericPosXGet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettingsSpeedNumericPosYSet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettingsSpeedNumericPosYGet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettingsTimePosXSet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettingsTimePosXGet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettingsTimePosYSet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettingsTimePosYGet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettingsThrottlePosXSet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettingsThrottlePosXGet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettingsThrottlePosYSet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettingsThrottlePosYGet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettingsVTXFreqPosXSet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettingsVTXFreqPosXGet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettingsVTXFreqPosYSet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettingsVTXFreqPosYGet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettingsVTXPowerPosXSet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettingsVTXPowerPosXGet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettingsVTXPowerPosYSet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettingsVTXPowerPosYGet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettingsAlarmSet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettingsAlarmGet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettingsAlarmFontSet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettingsAlarmFontGet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettingsAlarmAlignSet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettingsAlarmAlignGet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettingsAltitudeScaleSet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettingsAltitudeScaleGet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettingsAltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettingsAltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettingsAltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettingsAltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettingsAltitudeNumericSet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettingsAltitudeNumericGet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettingsAltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettingsAltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettingsAltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettingsAltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettingsAltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettingsAltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettingsArmStatusSet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettingsArmStatusGet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettingsArmStatusFontSet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettingsArmStatusFontGet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettingsArmStatusAlignSet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettingsArmStatusAlignGet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettingsArtificialHorizonSet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettingsArtificialHorizonGet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettingsArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettingsArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettingsArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettingsArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettingsBatteryVoltSet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettingsBatteryVoltGet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettingsBatteryVoltFontSet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettingsBatteryVoltFontGet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettingsBatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettingsBatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettingsBatteryCurrentSet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettingsBatteryCurrentGet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettingsBatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettingsBatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettingsBatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettingsBatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettingsBatteryConsumedSet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettingsBatteryConsumedGet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettingsBatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettingsBatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettingsBatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettingsBatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettingsBatteryChargeStateSet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettingsBatteryChargeStateGet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettingsCenterMarkSet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettingsCenterMarkGet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettingsClimbRateSet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettingsClimbRateGet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettingsClimbRateFontSet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettingsClimbRateFontGet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettingsClimbRateAlignSet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettingsClimbRateAlignGet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettingsCompassSet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettingsCompassGet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettingsCompassHomeDirSet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettingsCompassHomeDirGet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettingsCpuSet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettingsCpuGet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettingsCpuFontSet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettingsCpuFontGet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettingsCpuAlignSet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettingsCpuAlignGet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettingsCustomTextSet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettingsCustomTextGet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettingsCustomTextFontSet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettingsCustomTextFontGet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettingsCustomTextAlignSet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettingsCustomTextAlignGet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettingsFlightModeSet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettingsFlightModeGet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettingsFlightModeFontSet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettingsFlightModeFontGet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettingsFlightModeAlignSet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettingsFlightModeAlignGet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettingsGForceSet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettingsGForceGet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettingsGForceFontSet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettingsGForceFontGet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettingsGForceAlignSet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettingsGForceAlignGet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettingsGpsStatusSet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettingsGpsStatusGet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettingsGpsStatusFontSet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettingsGpsStatusFontGet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettingsGpsLatSet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettingsGpsLatGet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettingsGpsLatFontSet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettingsGpsLatFontGet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettingsGpsLatAlignSet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettingsGpsLatAlignGet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettingsGpsLonSet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettingsGpsLonGet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettingsGpsLonFontSet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettingsGpsLonFontGet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettingsGpsLonAlignSet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettingsGpsLonAlignGet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettingsGpsMgrsSet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettingsGpsMgrsGet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettingsGpsMgrsFontSet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettingsGpsMgrsFontGet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettingsGpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettingsGpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettingsHomeDistanceSet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettingsHomeDistanceGet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettingsHomeDistanceFontSet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettingsHomeDistanceFontGet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettingsHomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettingsHomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettingsHomeArrowSet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettingsHomeArrowGet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettingsMapSet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettingsMapGet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettingsMapCenterModeSet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettingsMapCenterModeGet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettingsMapShowWpSet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettingsMapShowWpGet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettingsMapShowUavHomeSet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettingsMapShowUavHomeGet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettingsMapShowTabletSet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettingsMapShowTabletGet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettingsRssiSet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettingsRssiGet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettingsRssiFontSet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettingsRssiFontGet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettingsRssiShowIconSet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettingsRssiShowIconGet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettingsSpeedScaleSet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettingsSpeedScaleGet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettingsSpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettingsSpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettingsSpeedScaleSourceSet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettingsSpeedScaleSourceGet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettingsSpeedNumericSet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettingsSpeedNumericGet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettingsSpeedNumericFontSet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettingsSpeedNumericFontGet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettingsSpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettingsSpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettingsSpeedNumericSourceSet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettingsSpeedNumericSourceGet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettingsTimeSet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettingsTimeGet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettingsTimeFontSet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettingsTimeFontGet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettingsTimeAlignSet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettingsTimeAlignGet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettingsThrottleSet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettingsThrottleGet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettingsThrottleFontSet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettingsThrottleFontGet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettingsThrottleAlignSet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettingsThrottleAlignGet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettingsVTXFreqSet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettingsVTXFreqGet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettingsVTXFreqFontSet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettingsVTXFreqFontGet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettingsVTXFreqAlignSet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettingsVTXFreqAlignGet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettingsVTXFreqShowUnitSet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettingsVTXFreqShowUnitGet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettingsVTXPowerSet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettingsVTXPowerGet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettingsVTXPowerFontSet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettingsVTXPowerFontGet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettingsVTXPowerAlignSet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettingsVTXPowerAlignGet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettingsVTXPowerShowUnitSet( uint8_t *NewVTXPowerShowUnit );
+extern void OnScreenDisplayPageSettingsVTXPowerShowUnitGet( uint8_t *NewVTXPowerShowUnit );
+
+
+#endif // ONSCREENDISPLAYPAGESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
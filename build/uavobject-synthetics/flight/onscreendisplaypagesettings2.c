@@ -0,0 +1,1423 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaypagesettings2.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplayPageSettings2 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings2.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaypagesettings2.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const OnScreenDisplayPageSettings2Data defaultData = {
+	.AlarmPosX = 0,
+	.AlarmPosY = 214,
+	.AltitudeScalePos = 350,
+	.AltitudeNumericPosX = 280,
+	.AltitudeNumericPosY = 200,
+	.ArmStatusPosX = 0,
+	.ArmStatusPosY = 24,
+	.BatteryVoltPosX = 350,
+	.BatteryVoltPosY = 4,
+	.BatteryCurrentPosX = 350,
+	.BatteryCurrentPosY = 14,
+	.BatteryConsumedPosX = 350,
+	.BatteryConsumedPosY = 24,
+	.BatteryChargeStatePosX = 325,
+	.BatteryChargeStatePosY = 38,
+	.ClimbRatePosX = 350,
+	.ClimbRatePosY = 200,
+	.CompassPos = 15,
+	.CpuPosX = 0,
+	.CpuPosY = 204,
+	.CustomTextPosX = 60,
+	.CustomTextPosY = 190,
+	.FlightModePosX = 0,
+	.FlightModePosY = 4,
+	.GForcePosX = 10,
+	.GForcePosY = 40,
+	.GpsStatusPosX = 0,
+	.GpsStatusPosY = 230,
+	.GpsLatPosX = 200,
+	.GpsLatPosY = 230,
+	.GpsLonPosX = 350,
+	.GpsLonPosY = 230,
+	.GpsMgrsPosX = 350,
+	.GpsMgrsPosY = 230,
+	.HomeDistancePosX = 180,
+	.HomeDistancePosY = 195,
+	.HomeArrowPosX = 240,
+	.HomeArrowPosY = 195,
+	.MapWidthMeters = 2000,
+	.MapWidthPixels = 180,
+	.MapHeightMeters = 2000,
+	.MapHeightPixels = 140,
+	.RssiPosX = 130,
+	.RssiPosY = 195,
+	.SpeedScalePos = 0,
+	.SpeedNumericPosX = 50,
+	.SpeedNumericPosY = 200,
+	.TimePosX = 350,
+	.TimePosY = 220,
+	.ThrottlePosX = 300,
+	.ThrottlePosY = 220,
+	.VTXFreqPosX = 220,
+	.VTXFreqPosY = 220,
+	.VTXPowerPosX = 280,
+	.VTXPowerPosY = 220,
+	.Alarm = 1,
+	.AlarmFont = 0,
+	.AlarmAlign = 0,
+	.AltitudeScale = 1,
+	.AltitudeScaleAlign = 1,
+	.AltitudeScaleSource = 0,
+	.AltitudeNumeric = 0,
+	.AltitudeNumericAlign = 0,
+	.AltitudeNumericFont = 0,
+	.AltitudeNumericSource = 0,
+	.ArmStatus = 1,
+	.ArmStatusFont = 0,
+	.ArmStatusAlign = 0,
+	.ArtificialHorizon = 1,
+	.ArtificialHorizonMaxPitch = 30,
+	.ArtificialHorizonPitchSteps = 2,
+	.BatteryVolt = 1,
+	.BatteryVoltFont = 0,
+	.BatteryVoltAlign = 2,
+	.BatteryCurrent = 1,
+	.BatteryCurrentFont = 0,
+	.BatteryCurrentAlign = 2,
+	.BatteryConsumed = 1,
+	.BatteryConsumedFont = 0,
+	.BatteryConsumedAlign = 2,
+	.BatteryChargeState = 1,
+	.CenterMark = 1,
+	.ClimbRate = 1,
+	.ClimbRateFont = 0,
+	.ClimbRateAlign = 2,
+	.Compass = 1,
+	.CompassHomeDir = 1,
+	.Cpu = 0,
+	.CpuFont = 0,
+	.CpuAlign = 0,
+	.CustomText = 0,
+	.CustomTextFont = 0,
+	.CustomTextAlign = 0,
+	.FlightMode = 1,
+	.FlightModeFont = 0,
+	.FlightModeAlign = 0,
+	.GForce = 1,
+	.GForceFont = 0,
+	.GForceAlign = 0,
+	.GpsStatus = 1,
+	.GpsStatusFont = 0,
+	.GpsLat = 1,
+	.GpsLatFont = 0,
+	.GpsLatAlign = 0,
+	.GpsLon = 1,
+	.GpsLonFont = 0,
+	.GpsLonAlign = 2,
+	.GpsMgrs = 0,
+	.GpsMgrsFont = 0,
+	.GpsMgrsAlign = 2,
+	.HomeDistance = 1,
+	.HomeDistanceFont = 0,
+	.HomeDistanceShowIcon = 1,
+	.HomeArrow = 1,
+	.Map = 0,
+	.MapCenterMode = 0,
+	.MapShowWp = 0,
+	.MapShowUavHome = 1,
+	.MapShowTablet = 0,
+	.Rssi = 1,
+	.RssiFont = 0,
+	.RssiShowIcon = 1,
+	.SpeedScale = 1,
+	.SpeedScaleAlign = 0,
+	.SpeedScaleSource = 0,
+	.SpeedNumeric = 1,
+	.SpeedNumericFont = 0,
+	.SpeedNumericAlign = 0,
+	.SpeedNumericSource = 0,
+	.Time = 1,
+	.TimeFont = 0,
+	.TimeAlign = 2,
+	.Throttle = 0,
+	.ThrottleFont = 0,
+	.ThrottleAlign = 2,
+	.VTXFreq = 1,
+	.VTXFreqFont = 0,
+	.VTXFreqAlign = 2,
+	.VTXFreqShowUnit = 1,
+	.VTXPower = 1,
+	.VTXPowerFont = 0,
+	.VTXPowerAlign = 2,
+	.VTXPowerShowUnit = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplayPageSettings2Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYPAGESETTINGS2_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYPAGESETTINGS2_OBJID,
+			ONSCREENDISPLAYPAGESETTINGS2_ISSINGLEINST, ONSCREENDISPLAYPAGESETTINGS2_ISSETTINGS, ONSCREENDISPLAYPAGESETTINGS2_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplayPageSettings2SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplayPageSettings2Data data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplayPageSettings2SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplayPageSettings2SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplayPageSettings2SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplayPageSettings2SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplayPageSettings2Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplayPageSettings2AlarmPosXSet( int16_t *NewAlarmPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings2Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AlarmPosXGet( int16_t *NewAlarmPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings2Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AlarmPosYSet( int16_t *NewAlarmPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings2Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AlarmPosYGet( int16_t *NewAlarmPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings2Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScalePosSet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScalePosGet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusPosXSet( int16_t *NewArmStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusPosXGet( int16_t *NewArmStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusPosYSet( int16_t *NewArmStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusPosYGet( int16_t *NewArmStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ClimbRatePosXSet( int16_t *NewClimbRatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings2Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ClimbRatePosXGet( int16_t *NewClimbRatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings2Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ClimbRatePosYSet( int16_t *NewClimbRatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings2Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ClimbRatePosYGet( int16_t *NewClimbRatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings2Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CompassPosSet( int16_t *NewCompassPos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings2Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CompassPosGet( int16_t *NewCompassPos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings2Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CpuPosXSet( int16_t *NewCpuPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings2Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CpuPosXGet( int16_t *NewCpuPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings2Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CpuPosYSet( int16_t *NewCpuPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings2Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CpuPosYGet( int16_t *NewCpuPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings2Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CustomTextPosXSet( int16_t *NewCustomTextPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings2Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CustomTextPosXGet( int16_t *NewCustomTextPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings2Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CustomTextPosYSet( int16_t *NewCustomTextPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings2Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2CustomTextPosYGet( int16_t *NewCustomTextPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings2Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2FlightModePosXSet( int16_t *NewFlightModePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings2Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2FlightModePosXGet( int16_t *NewFlightModePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings2Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2FlightModePosYSet( int16_t *NewFlightModePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings2Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2FlightModePosYGet( int16_t *NewFlightModePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings2Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GForcePosXSet( int16_t *NewGForcePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings2Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GForcePosXGet( int16_t *NewGForcePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings2Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GForcePosYSet( int16_t *NewGForcePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings2Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GForcePosYGet( int16_t *NewGForcePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings2Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusPosXSet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusPosXGet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusPosYSet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusPosYGet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLatPosXSet( int16_t *NewGpsLatPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLatPosXGet( int16_t *NewGpsLatPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLatPosYSet( int16_t *NewGpsLatPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLatPosYGet( int16_t *NewGpsLatPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLonPosXSet( int16_t *NewGpsLonPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLonPosXGet( int16_t *NewGpsLonPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLonPosYSet( int16_t *NewGpsLonPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsLonPosYGet( int16_t *NewGpsLonPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeDistancePosXSet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings2Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeDistancePosXGet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings2Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeDistancePosYSet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings2Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeDistancePosYGet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings2Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowPosXSet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings2Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowPosXGet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings2Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowPosYSet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings2Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowPosYGet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings2Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapWidthMetersSet( int16_t *NewMapWidthMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings2Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapWidthMetersGet( int16_t *NewMapWidthMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings2Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapWidthPixelsSet( int16_t *NewMapWidthPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings2Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapWidthPixelsGet( int16_t *NewMapWidthPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings2Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapHeightMetersSet( int16_t *NewMapHeightMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings2Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapHeightMetersGet( int16_t *NewMapHeightMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings2Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapHeightPixelsSet( int16_t *NewMapHeightPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings2Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2MapHeightPixelsGet( int16_t *NewMapHeightPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings2Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2RssiPosXSet( int16_t *NewRssiPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings2Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2RssiPosXGet( int16_t *NewRssiPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings2Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2RssiPosYSet( int16_t *NewRssiPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings2Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2RssiPosYGet( int16_t *NewRssiPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings2Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedScalePosSet( int16_t *NewSpeedScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings2Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedScalePosGet( int16_t *NewSpeedScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings2Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2TimePosXSet( int16_t *NewTimePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings2Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2TimePosXGet( int16_t *NewTimePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings2Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2TimePosYSet( int16_t *NewTimePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings2Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2TimePosYGet( int16_t *NewTimePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings2Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ThrottlePosXSet( int16_t *NewThrottlePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings2Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ThrottlePosXGet( int16_t *NewThrottlePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings2Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ThrottlePosYSet( int16_t *NewThrottlePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings2Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2ThrottlePosYGet( int16_t *NewThrottlePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings2Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqPosXSet( int16_t *NewVTXFreqPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqPosX, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqPosXGet( int16_t *NewVTXFreqPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqPosX, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqPosYSet( int16_t *NewVTXFreqPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqPosY, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqPosYGet( int16_t *NewVTXFreqPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqPosY, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerPosXSet( int16_t *NewVTXPowerPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerPosX, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerPosXGet( int16_t *NewVTXPowerPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerPosX, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerPosYSet( int16_t *NewVTXPowerPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerPosY, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerPosYGet( int16_t *NewVTXPowerPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerPosY, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings2AlarmSet( uint8_t *NewAlarm )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings2Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AlarmGet( uint8_t *NewAlarm )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings2Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AlarmFontSet( uint8_t *NewAlarmFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings2Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AlarmFontGet( uint8_t *NewAlarmFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings2Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AlarmAlignSet( uint8_t *NewAlarmAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings2Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AlarmAlignGet( uint8_t *NewAlarmAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings2Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleSet( uint8_t *NewAltitudeScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleGet( uint8_t *NewAltitudeScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings2Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericSet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericGet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings2Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusSet( uint8_t *NewArmStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings2Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusGet( uint8_t *NewArmStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings2Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusFontSet( uint8_t *NewArmStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusFontGet( uint8_t *NewArmStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusAlignSet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArmStatusAlignGet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings2Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonSet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonGet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings2Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltSet( uint8_t *NewBatteryVolt )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings2Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltGet( uint8_t *NewBatteryVolt )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings2Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltFontSet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltFontGet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentSet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentGet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedSet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedGet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings2Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStateSet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2BatteryChargeStateGet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings2Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CenterMarkSet( uint8_t *NewCenterMark )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings2Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CenterMarkGet( uint8_t *NewCenterMark )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings2Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateSet( uint8_t *NewClimbRate )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings2Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateGet( uint8_t *NewClimbRate )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings2Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateFontSet( uint8_t *NewClimbRateFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings2Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateFontGet( uint8_t *NewClimbRateFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings2Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateAlignSet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings2Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ClimbRateAlignGet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings2Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CompassSet( uint8_t *NewCompass )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings2Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CompassGet( uint8_t *NewCompass )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings2Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CompassHomeDirSet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings2Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CompassHomeDirGet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings2Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuSet( uint8_t *NewCpu )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings2Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuGet( uint8_t *NewCpu )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings2Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuFontSet( uint8_t *NewCpuFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings2Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuFontGet( uint8_t *NewCpuFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings2Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuAlignSet( uint8_t *NewCpuAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings2Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CpuAlignGet( uint8_t *NewCpuAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings2Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings2Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings2Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextFontSet( uint8_t *NewCustomTextFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings2Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextFontGet( uint8_t *NewCustomTextFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings2Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextAlignSet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings2Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2CustomTextAlignGet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings2Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeSet( uint8_t *NewFlightMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings2Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeGet( uint8_t *NewFlightMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings2Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeFontSet( uint8_t *NewFlightModeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings2Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeFontGet( uint8_t *NewFlightModeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings2Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeAlignSet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings2Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2FlightModeAlignGet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings2Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceSet( uint8_t *NewGForce )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings2Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceGet( uint8_t *NewGForce )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings2Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceFontSet( uint8_t *NewGForceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings2Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceFontGet( uint8_t *NewGForceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings2Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceAlignSet( uint8_t *NewGForceAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings2Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GForceAlignGet( uint8_t *NewGForceAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings2Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusSet( uint8_t *NewGpsStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings2Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusGet( uint8_t *NewGpsStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings2Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusFontSet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsStatusFontGet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings2Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatSet( uint8_t *NewGpsLat )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings2Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatGet( uint8_t *NewGpsLat )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings2Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatFontSet( uint8_t *NewGpsLatFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings2Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatFontGet( uint8_t *NewGpsLatFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings2Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatAlignSet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLatAlignGet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonSet( uint8_t *NewGpsLon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings2Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonGet( uint8_t *NewGpsLon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings2Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonFontSet( uint8_t *NewGpsLonFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings2Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonFontGet( uint8_t *NewGpsLonFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings2Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonAlignSet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsLonAlignGet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsSet( uint8_t *NewGpsMgrs )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsGet( uint8_t *NewGpsMgrs )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsFontSet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsFontGet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings2Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceSet( uint8_t *NewHomeDistance )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings2Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceGet( uint8_t *NewHomeDistance )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings2Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceFontSet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings2Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceFontGet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings2Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings2Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings2Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowSet( uint8_t *NewHomeArrow )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings2Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2HomeArrowGet( uint8_t *NewHomeArrow )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings2Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapSet( uint8_t *NewMap )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings2Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapGet( uint8_t *NewMap )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings2Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapCenterModeSet( uint8_t *NewMapCenterMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings2Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapCenterModeGet( uint8_t *NewMapCenterMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings2Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowWpSet( uint8_t *NewMapShowWp )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings2Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowWpGet( uint8_t *NewMapShowWp )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings2Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowUavHomeSet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings2Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowUavHomeGet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings2Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowTabletSet( uint8_t *NewMapShowTablet )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings2Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2MapShowTabletGet( uint8_t *NewMapShowTablet )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings2Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiSet( uint8_t *NewRssi )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings2Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiGet( uint8_t *NewRssi )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings2Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiFontSet( uint8_t *NewRssiFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings2Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiFontGet( uint8_t *NewRssiFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings2Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiShowIconSet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings2Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2RssiShowIconGet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings2Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleSet( uint8_t *NewSpeedScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings2Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleGet( uint8_t *NewSpeedScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings2Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings2Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings2Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings2Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings2Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericSet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericGet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericFontSet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericFontGet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings2Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeSet( uint8_t *NewTime )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings2Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeGet( uint8_t *NewTime )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings2Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeFontSet( uint8_t *NewTimeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings2Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeFontGet( uint8_t *NewTimeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings2Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeAlignSet( uint8_t *NewTimeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings2Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2TimeAlignGet( uint8_t *NewTimeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings2Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleSet( uint8_t *NewThrottle )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings2Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleGet( uint8_t *NewThrottle )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings2Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleFontSet( uint8_t *NewThrottleFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings2Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleFontGet( uint8_t *NewThrottleFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings2Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleAlignSet( uint8_t *NewThrottleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings2Data, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2ThrottleAlignGet( uint8_t *NewThrottleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings2Data, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqSet( uint8_t *NewVTXFreq )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreq, offsetof( OnScreenDisplayPageSettings2Data, VTXFreq), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqGet( uint8_t *NewVTXFreq )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreq, offsetof( OnScreenDisplayPageSettings2Data, VTXFreq), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqFontSet( uint8_t *NewVTXFreqFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqFont, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqFontGet( uint8_t *NewVTXFreqFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqFont, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqAlignSet( uint8_t *NewVTXFreqAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqAlign, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqAlignGet( uint8_t *NewVTXFreqAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqAlign, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqShowUnitSet( uint8_t *NewVTXFreqShowUnit )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqShowUnit, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXFreqShowUnitGet( uint8_t *NewVTXFreqShowUnit )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXFreqShowUnit, offsetof( OnScreenDisplayPageSettings2Data, VTXFreqShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerSet( uint8_t *NewVTXPower )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPower, offsetof( OnScreenDisplayPageSettings2Data, VTXPower), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerGet( uint8_t *NewVTXPower )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPower, offsetof( OnScreenDisplayPageSettings2Data, VTXPower), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerFontSet( uint8_t *NewVTXPowerFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerFont, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerFontGet( uint8_t *NewVTXPowerFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerFont, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerAlignSet( uint8_t *NewVTXPowerAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerAlign, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerAlignGet( uint8_t *NewVTXPowerAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerAlign, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerShowUnitSet( uint8_t *NewVTXPowerShowUnit )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerShowUnit, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings2VTXPowerShowUnitGet( uint8_t *NewVTXPowerShowUnit )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings2Handle(), (void*)NewVTXPowerShowUnit, offsetof( OnScreenDisplayPageSettings2Data, VTXPowerShowUnit), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,1118 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup OnScreenDisplayPageSettings2 OnScreenDisplayPageSettings2
+ * @brief On Screen Display Page Settings
+ *
+ *
+ * @file       onscreendisplaypagesettings2.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the OnScreenDisplayPageSettings2 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings2.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ONSCREENDISPLAYPAGESETTINGS2_H
+#define ONSCREENDISPLAYPAGESETTINGS2_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ONSCREENDISPLAYPAGESETTINGS2_OBJID 0xBACDDE7A
+#define ONSCREENDISPLAYPAGESETTINGS2_ISSINGLEINST 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ISSETTINGS 1
+#define ONSCREENDISPLAYPAGESETTINGS2_NUMBYTES 198
+
+// Generic interface functions
+int32_t OnScreenDisplayPageSettings2Initialize();
+UAVObjHandle OnScreenDisplayPageSettings2Handle();
+void OnScreenDisplayPageSettings2SetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    int16_t AlarmPosX;
+    int16_t AlarmPosY;
+    int16_t AltitudeScalePos;
+    int16_t AltitudeNumericPosX;
+    int16_t AltitudeNumericPosY;
+    int16_t ArmStatusPosX;
+    int16_t ArmStatusPosY;
+    int16_t BatteryVoltPosX;
+    int16_t BatteryVoltPosY;
+    int16_t BatteryCurrentPosX;
+    int16_t BatteryCurrentPosY;
+    int16_t BatteryConsumedPosX;
+    int16_t BatteryConsumedPosY;
+    int16_t BatteryChargeStatePosX;
+    int16_t BatteryChargeStatePosY;
+    int16_t ClimbRatePosX;
+    int16_t ClimbRatePosY;
+    int16_t CompassPos;
+    int16_t CpuPosX;
+    int16_t CpuPosY;
+    int16_t CustomTextPosX;
+    int16_t CustomTextPosY;
+    int16_t FlightModePosX;
+    int16_t FlightModePosY;
+    int16_t GForcePosX;
+    int16_t GForcePosY;
+    int16_t GpsStatusPosX;
+    int16_t GpsStatusPosY;
+    int16_t GpsLatPosX;
+    int16_t GpsLatPosY;
+    int16_t GpsLonPosX;
+    int16_t GpsLonPosY;
+    int16_t GpsMgrsPosX;
+    int16_t GpsMgrsPosY;
+    int16_t HomeDistancePosX;
+    int16_t HomeDistancePosY;
+    int16_t HomeArrowPosX;
+    int16_t HomeArrowPosY;
+    int16_t MapWidthMeters;
+    int16_t MapWidthPixels;
+    int16_t MapHeightMeters;
+    int16_t MapHeightPixels;
+    int16_t RssiPosX;
+    int16_t RssiPosY;
+    int16_t SpeedScalePos;
+    int16_t SpeedNumericPosX;
+    int16_t SpeedNumericPosY;
+    int16_t TimePosX;
+    int16_t TimePosY;
+    int16_t ThrottlePosX;
+    int16_t ThrottlePosY;
+    int16_t VTXFreqPosX;
+    int16_t VTXFreqPosY;
+    int16_t VTXPowerPosX;
+    int16_t VTXPowerPosY;
+    uint8_t Alarm;
+    uint8_t AlarmFont;
+    uint8_t AlarmAlign;
+    uint8_t AltitudeScale;
+    uint8_t AltitudeScaleAlign;
+    uint8_t AltitudeScaleSource;
+    uint8_t AltitudeNumeric;
+    uint8_t AltitudeNumericAlign;
+    uint8_t AltitudeNumericFont;
+    uint8_t AltitudeNumericSource;
+    uint8_t ArmStatus;
+    uint8_t ArmStatusFont;
+    uint8_t ArmStatusAlign;
+    uint8_t ArtificialHorizon;
+    uint8_t ArtificialHorizonMaxPitch;
+    uint8_t ArtificialHorizonPitchSteps;
+    uint8_t BatteryVolt;
+    uint8_t BatteryVoltFont;
+    uint8_t BatteryVoltAlign;
+    uint8_t BatteryCurrent;
+    uint8_t BatteryCurrentFont;
+    uint8_t BatteryCurrentAlign;
+    uint8_t BatteryConsumed;
+    uint8_t BatteryConsumedFont;
+    uint8_t BatteryConsumedAlign;
+    uint8_t BatteryChargeState;
+    uint8_t CenterMark;
+    uint8_t ClimbRate;
+    uint8_t ClimbRateFont;
+    uint8_t ClimbRateAlign;
+    uint8_t Compass;
+    uint8_t CompassHomeDir;
+    uint8_t Cpu;
+    uint8_t CpuFont;
+    uint8_t CpuAlign;
+    uint8_t CustomText;
+    uint8_t CustomTextFont;
+    uint8_t CustomTextAlign;
+    uint8_t FlightMode;
+    uint8_t FlightModeFont;
+    uint8_t FlightModeAlign;
+    uint8_t GForce;
+    uint8_t GForceFont;
+    uint8_t GForceAlign;
+    uint8_t GpsStatus;
+    uint8_t GpsStatusFont;
+    uint8_t GpsLat;
+    uint8_t GpsLatFont;
+    uint8_t GpsLatAlign;
+    uint8_t GpsLon;
+    uint8_t GpsLonFont;
+    uint8_t GpsLonAlign;
+    uint8_t GpsMgrs;
+    uint8_t GpsMgrsFont;
+    uint8_t GpsMgrsAlign;
+    uint8_t HomeDistance;
+    uint8_t HomeDistanceFont;
+    uint8_t HomeDistanceShowIcon;
+    uint8_t HomeArrow;
+    uint8_t Map;
+    uint8_t MapCenterMode;
+    uint8_t MapShowWp;
+    uint8_t MapShowUavHome;
+    uint8_t MapShowTablet;
+    uint8_t Rssi;
+    uint8_t RssiFont;
+    uint8_t RssiShowIcon;
+    uint8_t SpeedScale;
+    uint8_t SpeedScaleAlign;
+    uint8_t SpeedScaleSource;
+    uint8_t SpeedNumeric;
+    uint8_t SpeedNumericFont;
+    uint8_t SpeedNumericAlign;
+    uint8_t SpeedNumericSource;
+    uint8_t Time;
+    uint8_t TimeFont;
+    uint8_t TimeAlign;
+    uint8_t Throttle;
+    uint8_t ThrottleFont;
+    uint8_t ThrottleAlign;
+    uint8_t VTXFreq;
+    uint8_t VTXFreqFont;
+    uint8_t VTXFreqAlign;
+    uint8_t VTXFreqShowUnit;
+    uint8_t VTXPower;
+    uint8_t VTXPowerFont;
+    uint8_t VTXPowerAlign;
+    uint8_t VTXPowerShowUnit;
+
+} __attribute__((packed)) __attribute__((aligned(4))) OnScreenDisplayPageSettings2Data;
+
+// Typesafe Object access functions
+/**
+ * @function OnScreenDisplayPageSettings2Get(dataOut)
+ * @brief Populate a OnScreenDisplayPageSettings2Data object
+ * @param[out] dataOut 
+ */
+static inline int32_t OnScreenDisplayPageSettings2Get(OnScreenDisplayPageSettings2Data *dataOut) { return UAVObjGetData(OnScreenDisplayPageSettings2Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings2Set(const OnScreenDisplayPageSettings2Data *dataIn) { return UAVObjSetData(OnScreenDisplayPageSettings2Handle(), dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings2InstGet(uint16_t instId, OnScreenDisplayPageSettings2Data *dataOut) { return UAVObjGetInstanceData(OnScreenDisplayPageSettings2Handle(), instId, dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings2InstSet(uint16_t instId, const OnScreenDisplayPageSettings2Data *dataIn) { return UAVObjSetInstanceData(OnScreenDisplayPageSettings2Handle(), instId, dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings2ConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(OnScreenDisplayPageSettings2Handle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings2ConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(OnScreenDisplayPageSettings2Handle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings2ConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(OnScreenDisplayPageSettings2Handle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings2ConnectCopy(volatile OnScreenDisplayPageSettings2Data *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	OnScreenDisplayPageSettings2Get((void *) dataOut);
+
+	return UAVObjConnectCallback(OnScreenDisplayPageSettings2Handle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t OnScreenDisplayPageSettings2CreateInstance() { return UAVObjCreateInstance(OnScreenDisplayPageSettings2Handle(), &OnScreenDisplayPageSettings2SetDefaults); }
+
+static inline void OnScreenDisplayPageSettings2Updated() { UAVObjUpdated(OnScreenDisplayPageSettings2Handle()); }
+
+static inline void OnScreenDisplayPageSettings2InstUpdated(uint16_t instId) { UAVObjInstanceUpdated(OnScreenDisplayPageSettings2Handle(), instId); }
+
+static inline int32_t OnScreenDisplayPageSettings2GetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(OnScreenDisplayPageSettings2Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings2SetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(OnScreenDisplayPageSettings2Handle(), dataIn); }
+
+static inline int8_t OnScreenDisplayPageSettings2ReadOnly() { return UAVObjReadOnly(OnScreenDisplayPageSettings2Handle()); }
+
+static inline uint16_t OnScreenDisplayPageSettings2GetNumInstances(){ return UAVObjGetNumInstances(OnScreenDisplayPageSettings2Handle()); }
+
+static inline uint32_t OnScreenDisplayPageSettings2GetNumBytes(){ return UAVObjGetNumBytes(OnScreenDisplayPageSettings2Handle()); }
+
+// Field information
+// Field AlarmPosX information
+// Field AlarmPosY information
+// Field AltitudeScalePos information
+// Field AltitudeNumericPosX information
+// Field AltitudeNumericPosY information
+// Field ArmStatusPosX information
+// Field ArmStatusPosY information
+// Field BatteryVoltPosX information
+// Field BatteryVoltPosY information
+// Field BatteryCurrentPosX information
+// Field BatteryCurrentPosY information
+// Field BatteryConsumedPosX information
+// Field BatteryConsumedPosY information
+// Field BatteryChargeStatePosX information
+// Field BatteryChargeStatePosY information
+// Field ClimbRatePosX information
+// Field ClimbRatePosY information
+// Field CompassPos information
+// Field CpuPosX information
+// Field CpuPosY information
+// Field CustomTextPosX information
+// Field CustomTextPosY information
+// Field FlightModePosX information
+// Field FlightModePosY information
+// Field GForcePosX information
+// Field GForcePosY information
+// Field GpsStatusPosX information
+// Field GpsStatusPosY information
+// Field GpsLatPosX information
+// Field GpsLatPosY information
+// Field GpsLonPosX information
+// Field GpsLonPosY information
+// Field GpsMgrsPosX information
+// Field GpsMgrsPosY information
+// Field HomeDistancePosX information
+// Field HomeDistancePosY information
+// Field HomeArrowPosX information
+// Field HomeArrowPosY information
+// Field MapWidthMeters information
+// Field MapWidthPixels information
+// Field MapHeightMeters information
+// Field MapHeightPixels information
+// Field RssiPosX information
+// Field RssiPosY information
+// Field SpeedScalePos information
+// Field SpeedNumericPosX information
+// Field SpeedNumericPosY information
+// Field TimePosX information
+// Field TimePosY information
+// Field ThrottlePosX information
+// Field ThrottlePosY information
+// Field VTXFreqPosX information
+// Field VTXFreqPosY information
+// Field VTXPowerPosX information
+// Field VTXPowerPosY information
+// Field Alarm information
+/* Enumeration options for field Alarm */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALARM_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_ALARM_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AlarmOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARM_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARM_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AlarmIsValid( uint8_t CurrentAlarm ) { return CurrentAlarm <= ONSCREENDISPLAYPAGESETTINGS2_ALARM_MAXOPTVAL; }
+// Field AlarmFont information
+/* Enumeration options for field AlarmFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2AlarmFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2AlarmFontIsValid( uint8_t CurrentAlarmFont ) { return CurrentAlarmFont <= ONSCREENDISPLAYPAGESETTINGS2_ALARMFONT_MAXOPTVAL; }
+// Field AlarmAlign information
+/* Enumeration options for field AlarmAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2AlarmAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2AlarmAlignIsValid( uint8_t CurrentAlarmAlign ) { return CurrentAlarmAlign <= ONSCREENDISPLAYPAGESETTINGS2_ALARMALIGN_MAXOPTVAL; }
+// Field AltitudeScale information
+/* Enumeration options for field AltitudeScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeScaleIsValid( uint8_t CurrentAltitudeScale ) { return CurrentAltitudeScale <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALE_MAXOPTVAL; }
+// Field AltitudeScaleAlign information
+/* Enumeration options for field AltitudeScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeScaleAlignIsValid( uint8_t CurrentAltitudeScaleAlign ) { return CurrentAltitudeScaleAlign <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALEALIGN_MAXOPTVAL; }
+// Field AltitudeScaleSource information
+/* Enumeration options for field AltitudeScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALESOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALESOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALESOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALESOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeScaleSourceIsValid( uint8_t CurrentAltitudeScaleSource ) { return CurrentAltitudeScaleSource <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDESCALESOURCE_MAXOPTVAL; }
+// Field AltitudeNumeric information
+/* Enumeration options for field AltitudeNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeNumericIsValid( uint8_t CurrentAltitudeNumeric ) { return CurrentAltitudeNumeric <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERIC_MAXOPTVAL; }
+// Field AltitudeNumericAlign information
+/* Enumeration options for field AltitudeNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeNumericAlignIsValid( uint8_t CurrentAltitudeNumericAlign ) { return CurrentAltitudeNumericAlign <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICALIGN_MAXOPTVAL; }
+// Field AltitudeNumericFont information
+/* Enumeration options for field AltitudeNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2AltitudeNumericFontIsValid( uint8_t CurrentAltitudeNumericFont ) { return CurrentAltitudeNumericFont <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICFONT_MAXOPTVAL; }
+// Field AltitudeNumericSource information
+/* Enumeration options for field AltitudeNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICSOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICSOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2AltitudeNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICSOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICSOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2AltitudeNumericSourceIsValid( uint8_t CurrentAltitudeNumericSource ) { return CurrentAltitudeNumericSource <= ONSCREENDISPLAYPAGESETTINGS2_ALTITUDENUMERICSOURCE_MAXOPTVAL; }
+// Field ArmStatus information
+/* Enumeration options for field ArmStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2ArmStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2ArmStatusIsValid( uint8_t CurrentArmStatus ) { return CurrentArmStatus <= ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUS_MAXOPTVAL; }
+// Field ArmStatusFont information
+/* Enumeration options for field ArmStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ArmStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ArmStatusFontIsValid( uint8_t CurrentArmStatusFont ) { return CurrentArmStatusFont <= ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSFONT_MAXOPTVAL; }
+// Field ArmStatusAlign information
+/* Enumeration options for field ArmStatusAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ArmStatusAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ArmStatusAlignIsValid( uint8_t CurrentArmStatusAlign ) { return CurrentArmStatusAlign <= ONSCREENDISPLAYPAGESETTINGS2_ARMSTATUSALIGN_MAXOPTVAL; }
+// Field ArtificialHorizon information
+/* Enumeration options for field ArtificialHorizon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_ARTIFICIALHORIZON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_ARTIFICIALHORIZON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2ArtificialHorizonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_ARTIFICIALHORIZON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_ARTIFICIALHORIZON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2ArtificialHorizonIsValid( uint8_t CurrentArtificialHorizon ) { return CurrentArtificialHorizon <= ONSCREENDISPLAYPAGESETTINGS2_ARTIFICIALHORIZON_MAXOPTVAL; }
+// Field ArtificialHorizonMaxPitch information
+// Field ArtificialHorizonPitchSteps information
+// Field BatteryVolt information
+/* Enumeration options for field BatteryVolt */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryVoltOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2BatteryVoltIsValid( uint8_t CurrentBatteryVolt ) { return CurrentBatteryVolt <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLT_MAXOPTVAL; }
+// Field BatteryVoltFont information
+/* Enumeration options for field BatteryVoltFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryVoltFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryVoltFontIsValid( uint8_t CurrentBatteryVoltFont ) { return CurrentBatteryVoltFont <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTFONT_MAXOPTVAL; }
+// Field BatteryVoltAlign information
+/* Enumeration options for field BatteryVoltAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryVoltAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryVoltAlignIsValid( uint8_t CurrentBatteryVoltAlign ) { return CurrentBatteryVoltAlign <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYVOLTALIGN_MAXOPTVAL; }
+// Field BatteryCurrent information
+/* Enumeration options for field BatteryCurrent */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryCurrentOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2BatteryCurrentIsValid( uint8_t CurrentBatteryCurrent ) { return CurrentBatteryCurrent <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENT_MAXOPTVAL; }
+// Field BatteryCurrentFont information
+/* Enumeration options for field BatteryCurrentFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryCurrentFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryCurrentFontIsValid( uint8_t CurrentBatteryCurrentFont ) { return CurrentBatteryCurrentFont <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTFONT_MAXOPTVAL; }
+// Field BatteryCurrentAlign information
+/* Enumeration options for field BatteryCurrentAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryCurrentAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryCurrentAlignIsValid( uint8_t CurrentBatteryCurrentAlign ) { return CurrentBatteryCurrentAlign <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCURRENTALIGN_MAXOPTVAL; }
+// Field BatteryConsumed information
+/* Enumeration options for field BatteryConsumed */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMED_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryConsumedOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMED_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMED_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2BatteryConsumedIsValid( uint8_t CurrentBatteryConsumed ) { return CurrentBatteryConsumed <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMED_MAXOPTVAL; }
+// Field BatteryConsumedFont information
+/* Enumeration options for field BatteryConsumedFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryConsumedFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryConsumedFontIsValid( uint8_t CurrentBatteryConsumedFont ) { return CurrentBatteryConsumedFont <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDFONT_MAXOPTVAL; }
+// Field BatteryConsumedAlign information
+/* Enumeration options for field BatteryConsumedAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryConsumedAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2BatteryConsumedAlignIsValid( uint8_t CurrentBatteryConsumedAlign ) { return CurrentBatteryConsumedAlign <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCONSUMEDALIGN_MAXOPTVAL; }
+// Field BatteryChargeState information
+/* Enumeration options for field BatteryChargeState */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_BATTERYCHARGESTATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_BATTERYCHARGESTATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2BatteryChargeStateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCHARGESTATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_BATTERYCHARGESTATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2BatteryChargeStateIsValid( uint8_t CurrentBatteryChargeState ) { return CurrentBatteryChargeState <= ONSCREENDISPLAYPAGESETTINGS2_BATTERYCHARGESTATE_MAXOPTVAL; }
+// Field CenterMark information
+/* Enumeration options for field CenterMark */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_MIDDLE=1, ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_CAMERAPITCH=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2CenterMarkOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2CenterMarkIsValid( uint8_t CurrentCenterMark ) { return CurrentCenterMark <= ONSCREENDISPLAYPAGESETTINGS2_CENTERMARK_MAXOPTVAL; }
+// Field ClimbRate information
+/* Enumeration options for field ClimbRate */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2ClimbRateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2ClimbRateIsValid( uint8_t CurrentClimbRate ) { return CurrentClimbRate <= ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATE_MAXOPTVAL; }
+// Field ClimbRateFont information
+/* Enumeration options for field ClimbRateFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ClimbRateFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ClimbRateFontIsValid( uint8_t CurrentClimbRateFont ) { return CurrentClimbRateFont <= ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEFONT_MAXOPTVAL; }
+// Field ClimbRateAlign information
+/* Enumeration options for field ClimbRateAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ClimbRateAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ClimbRateAlignIsValid( uint8_t CurrentClimbRateAlign ) { return CurrentClimbRateAlign <= ONSCREENDISPLAYPAGESETTINGS2_CLIMBRATEALIGN_MAXOPTVAL; }
+// Field Compass information
+/* Enumeration options for field Compass */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_COMPASS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_COMPASS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2CompassOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_COMPASS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_COMPASS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2CompassIsValid( uint8_t CurrentCompass ) { return CurrentCompass <= ONSCREENDISPLAYPAGESETTINGS2_COMPASS_MAXOPTVAL; }
+// Field CompassHomeDir information
+/* Enumeration options for field CompassHomeDir */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_COMPASSHOMEDIR_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_COMPASSHOMEDIR_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2CompassHomeDirOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_COMPASSHOMEDIR_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_COMPASSHOMEDIR_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2CompassHomeDirIsValid( uint8_t CurrentCompassHomeDir ) { return CurrentCompassHomeDir <= ONSCREENDISPLAYPAGESETTINGS2_COMPASSHOMEDIR_MAXOPTVAL; }
+// Field Cpu information
+/* Enumeration options for field Cpu */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CPU_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_CPU_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2CpuOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CPU_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_CPU_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2CpuIsValid( uint8_t CurrentCpu ) { return CurrentCpu <= ONSCREENDISPLAYPAGESETTINGS2_CPU_MAXOPTVAL; }
+// Field CpuFont information
+/* Enumeration options for field CpuFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2CpuFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2CpuFontIsValid( uint8_t CurrentCpuFont ) { return CurrentCpuFont <= ONSCREENDISPLAYPAGESETTINGS2_CPUFONT_MAXOPTVAL; }
+// Field CpuAlign information
+/* Enumeration options for field CpuAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2CpuAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2CpuAlignIsValid( uint8_t CurrentCpuAlign ) { return CurrentCpuAlign <= ONSCREENDISPLAYPAGESETTINGS2_CPUALIGN_MAXOPTVAL; }
+// Field CustomText information
+/* Enumeration options for field CustomText */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2CustomTextOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2CustomTextIsValid( uint8_t CurrentCustomText ) { return CurrentCustomText <= ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXT_MAXOPTVAL; }
+// Field CustomTextFont information
+/* Enumeration options for field CustomTextFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2CustomTextFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2CustomTextFontIsValid( uint8_t CurrentCustomTextFont ) { return CurrentCustomTextFont <= ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTFONT_MAXOPTVAL; }
+// Field CustomTextAlign information
+/* Enumeration options for field CustomTextAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2CustomTextAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2CustomTextAlignIsValid( uint8_t CurrentCustomTextAlign ) { return CurrentCustomTextAlign <= ONSCREENDISPLAYPAGESETTINGS2_CUSTOMTEXTALIGN_MAXOPTVAL; }
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2FlightModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2FlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode <= ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODE_MAXOPTVAL; }
+// Field FlightModeFont information
+/* Enumeration options for field FlightModeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2FlightModeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2FlightModeFontIsValid( uint8_t CurrentFlightModeFont ) { return CurrentFlightModeFont <= ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEFONT_MAXOPTVAL; }
+// Field FlightModeAlign information
+/* Enumeration options for field FlightModeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2FlightModeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2FlightModeAlignIsValid( uint8_t CurrentFlightModeAlign ) { return CurrentFlightModeAlign <= ONSCREENDISPLAYPAGESETTINGS2_FLIGHTMODEALIGN_MAXOPTVAL; }
+// Field GForce information
+/* Enumeration options for field GForce */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GFORCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_GFORCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2GForceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2GForceIsValid( uint8_t CurrentGForce ) { return CurrentGForce <= ONSCREENDISPLAYPAGESETTINGS2_GFORCE_MAXOPTVAL; }
+// Field GForceFont information
+/* Enumeration options for field GForceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GForceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GForceFontIsValid( uint8_t CurrentGForceFont ) { return CurrentGForceFont <= ONSCREENDISPLAYPAGESETTINGS2_GFORCEFONT_MAXOPTVAL; }
+// Field GForceAlign information
+/* Enumeration options for field GForceAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GForceAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GForceAlignIsValid( uint8_t CurrentGForceAlign ) { return CurrentGForceAlign <= ONSCREENDISPLAYPAGESETTINGS2_GFORCEALIGN_MAXOPTVAL; }
+// Field GpsStatus information
+/* Enumeration options for field GpsStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2GpsStatusIsValid( uint8_t CurrentGpsStatus ) { return CurrentGpsStatus <= ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUS_MAXOPTVAL; }
+// Field GpsStatusFont information
+/* Enumeration options for field GpsStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsStatusFontIsValid( uint8_t CurrentGpsStatusFont ) { return CurrentGpsStatusFont <= ONSCREENDISPLAYPAGESETTINGS2_GPSSTATUSFONT_MAXOPTVAL; }
+// Field GpsLat information
+/* Enumeration options for field GpsLat */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLAT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLAT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLatOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLAT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLAT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2GpsLatIsValid( uint8_t CurrentGpsLat ) { return CurrentGpsLat <= ONSCREENDISPLAYPAGESETTINGS2_GPSLAT_MAXOPTVAL; }
+// Field GpsLatFont information
+/* Enumeration options for field GpsLatFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLatFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsLatFontIsValid( uint8_t CurrentGpsLatFont ) { return CurrentGpsLatFont <= ONSCREENDISPLAYPAGESETTINGS2_GPSLATFONT_MAXOPTVAL; }
+// Field GpsLatAlign information
+/* Enumeration options for field GpsLatAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLatAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsLatAlignIsValid( uint8_t CurrentGpsLatAlign ) { return CurrentGpsLatAlign <= ONSCREENDISPLAYPAGESETTINGS2_GPSLATALIGN_MAXOPTVAL; }
+// Field GpsLon information
+/* Enumeration options for field GpsLon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2GpsLonIsValid( uint8_t CurrentGpsLon ) { return CurrentGpsLon <= ONSCREENDISPLAYPAGESETTINGS2_GPSLON_MAXOPTVAL; }
+// Field GpsLonFont information
+/* Enumeration options for field GpsLonFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLonFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsLonFontIsValid( uint8_t CurrentGpsLonFont ) { return CurrentGpsLonFont <= ONSCREENDISPLAYPAGESETTINGS2_GPSLONFONT_MAXOPTVAL; }
+// Field GpsLonAlign information
+/* Enumeration options for field GpsLonAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsLonAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsLonAlignIsValid( uint8_t CurrentGpsLonAlign ) { return CurrentGpsLonAlign <= ONSCREENDISPLAYPAGESETTINGS2_GPSLONALIGN_MAXOPTVAL; }
+// Field GpsMgrs information
+/* Enumeration options for field GpsMgrs */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSMGRS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_GPSMGRS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsMgrsOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2GpsMgrsIsValid( uint8_t CurrentGpsMgrs ) { return CurrentGpsMgrs <= ONSCREENDISPLAYPAGESETTINGS2_GPSMGRS_MAXOPTVAL; }
+// Field GpsMgrsFont information
+/* Enumeration options for field GpsMgrsFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsMgrsFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsMgrsFontIsValid( uint8_t CurrentGpsMgrsFont ) { return CurrentGpsMgrsFont <= ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSFONT_MAXOPTVAL; }
+// Field GpsMgrsAlign information
+/* Enumeration options for field GpsMgrsAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2GpsMgrsAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2GpsMgrsAlignIsValid( uint8_t CurrentGpsMgrsAlign ) { return CurrentGpsMgrsAlign <= ONSCREENDISPLAYPAGESETTINGS2_GPSMGRSALIGN_MAXOPTVAL; }
+// Field HomeDistance information
+/* Enumeration options for field HomeDistance */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2HomeDistanceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2HomeDistanceIsValid( uint8_t CurrentHomeDistance ) { return CurrentHomeDistance <= ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCE_MAXOPTVAL; }
+// Field HomeDistanceFont information
+/* Enumeration options for field HomeDistanceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2HomeDistanceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2HomeDistanceFontIsValid( uint8_t CurrentHomeDistanceFont ) { return CurrentHomeDistanceFont <= ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCEFONT_MAXOPTVAL; }
+// Field HomeDistanceShowIcon information
+/* Enumeration options for field HomeDistanceShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCESHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCESHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2HomeDistanceShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCESHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCESHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2HomeDistanceShowIconIsValid( uint8_t CurrentHomeDistanceShowIcon ) { return CurrentHomeDistanceShowIcon <= ONSCREENDISPLAYPAGESETTINGS2_HOMEDISTANCESHOWICON_MAXOPTVAL; }
+// Field HomeArrow information
+/* Enumeration options for field HomeArrow */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_HOMEARROW_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_HOMEARROW_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2HomeArrowOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEARROW_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_HOMEARROW_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2HomeArrowIsValid( uint8_t CurrentHomeArrow ) { return CurrentHomeArrow <= ONSCREENDISPLAYPAGESETTINGS2_HOMEARROW_MAXOPTVAL; }
+// Field Map information
+/* Enumeration options for field Map */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_MAP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_MAP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2MapOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_MAP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_MAP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2MapIsValid( uint8_t CurrentMap ) { return CurrentMap <= ONSCREENDISPLAYPAGESETTINGS2_MAP_MAXOPTVAL; }
+// Field MapCenterMode information
+/* Enumeration options for field MapCenterMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_MAPCENTERMODE_UAV=0, ONSCREENDISPLAYPAGESETTINGS2_MAPCENTERMODE_HOME=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2MapCenterModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPCENTERMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPCENTERMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2MapCenterModeIsValid( uint8_t CurrentMapCenterMode ) { return CurrentMapCenterMode <= ONSCREENDISPLAYPAGESETTINGS2_MAPCENTERMODE_MAXOPTVAL; }
+// Field MapShowWp information
+/* Enumeration options for field MapShowWp */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWWP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWWP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2MapShowWpOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWWP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWWP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2MapShowWpIsValid( uint8_t CurrentMapShowWp ) { return CurrentMapShowWp <= ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWWP_MAXOPTVAL; }
+// Field MapShowUavHome information
+/* Enumeration options for field MapShowUavHome */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWUAVHOME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWUAVHOME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2MapShowUavHomeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWUAVHOME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWUAVHOME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2MapShowUavHomeIsValid( uint8_t CurrentMapShowUavHome ) { return CurrentMapShowUavHome <= ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWUAVHOME_MAXOPTVAL; }
+// Field MapShowTablet information
+/* Enumeration options for field MapShowTablet */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWTABLET_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWTABLET_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2MapShowTabletOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWTABLET_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWTABLET_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2MapShowTabletIsValid( uint8_t CurrentMapShowTablet ) { return CurrentMapShowTablet <= ONSCREENDISPLAYPAGESETTINGS2_MAPSHOWTABLET_MAXOPTVAL; }
+// Field Rssi information
+/* Enumeration options for field Rssi */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_RSSI_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_RSSI_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2RssiOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSI_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSI_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2RssiIsValid( uint8_t CurrentRssi ) { return CurrentRssi <= ONSCREENDISPLAYPAGESETTINGS2_RSSI_MAXOPTVAL; }
+// Field RssiFont information
+/* Enumeration options for field RssiFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2RssiFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2RssiFontIsValid( uint8_t CurrentRssiFont ) { return CurrentRssiFont <= ONSCREENDISPLAYPAGESETTINGS2_RSSIFONT_MAXOPTVAL; }
+// Field RssiShowIcon information
+/* Enumeration options for field RssiShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_RSSISHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_RSSISHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2RssiShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSISHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_RSSISHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2RssiShowIconIsValid( uint8_t CurrentRssiShowIcon ) { return CurrentRssiShowIcon <= ONSCREENDISPLAYPAGESETTINGS2_RSSISHOWICON_MAXOPTVAL; }
+// Field SpeedScale information
+/* Enumeration options for field SpeedScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2SpeedScaleIsValid( uint8_t CurrentSpeedScale ) { return CurrentSpeedScale <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALE_MAXOPTVAL; }
+// Field SpeedScaleAlign information
+/* Enumeration options for field SpeedScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2SpeedScaleAlignIsValid( uint8_t CurrentSpeedScaleAlign ) { return CurrentSpeedScaleAlign <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALEALIGN_MAXOPTVAL; }
+// Field SpeedScaleSource information
+/* Enumeration options for field SpeedScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2SpeedScaleSourceIsValid( uint8_t CurrentSpeedScaleSource ) { return CurrentSpeedScaleSource <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDSCALESOURCE_MAXOPTVAL; }
+// Field SpeedNumeric information
+/* Enumeration options for field SpeedNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2SpeedNumericIsValid( uint8_t CurrentSpeedNumeric ) { return CurrentSpeedNumeric <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERIC_MAXOPTVAL; }
+// Field SpeedNumericFont information
+/* Enumeration options for field SpeedNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2SpeedNumericFontIsValid( uint8_t CurrentSpeedNumericFont ) { return CurrentSpeedNumericFont <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICFONT_MAXOPTVAL; }
+// Field SpeedNumericAlign information
+/* Enumeration options for field SpeedNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2SpeedNumericAlignIsValid( uint8_t CurrentSpeedNumericAlign ) { return CurrentSpeedNumericAlign <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICALIGN_MAXOPTVAL; }
+// Field SpeedNumericSource information
+/* Enumeration options for field SpeedNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2SpeedNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2SpeedNumericSourceIsValid( uint8_t CurrentSpeedNumericSource ) { return CurrentSpeedNumericSource <= ONSCREENDISPLAYPAGESETTINGS2_SPEEDNUMERICSOURCE_MAXOPTVAL; }
+// Field Time information
+/* Enumeration options for field Time */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_TIME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_TIME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2TimeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_TIME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_TIME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2TimeIsValid( uint8_t CurrentTime ) { return CurrentTime <= ONSCREENDISPLAYPAGESETTINGS2_TIME_MAXOPTVAL; }
+// Field TimeFont information
+/* Enumeration options for field TimeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2TimeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2TimeFontIsValid( uint8_t CurrentTimeFont ) { return CurrentTimeFont <= ONSCREENDISPLAYPAGESETTINGS2_TIMEFONT_MAXOPTVAL; }
+// Field TimeAlign information
+/* Enumeration options for field TimeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2TimeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2TimeAlignIsValid( uint8_t CurrentTimeAlign ) { return CurrentTimeAlign <= ONSCREENDISPLAYPAGESETTINGS2_TIMEALIGN_MAXOPTVAL; }
+// Field Throttle information
+/* Enumeration options for field Throttle */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_THROTTLE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_THROTTLE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2ThrottleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2ThrottleIsValid( uint8_t CurrentThrottle ) { return CurrentThrottle <= ONSCREENDISPLAYPAGESETTINGS2_THROTTLE_MAXOPTVAL; }
+// Field ThrottleFont information
+/* Enumeration options for field ThrottleFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ThrottleFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ThrottleFontIsValid( uint8_t CurrentThrottleFont ) { return CurrentThrottleFont <= ONSCREENDISPLAYPAGESETTINGS2_THROTTLEFONT_MAXOPTVAL; }
+// Field ThrottleAlign information
+/* Enumeration options for field ThrottleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2ThrottleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2ThrottleAlignIsValid( uint8_t CurrentThrottleAlign ) { return CurrentThrottleAlign <= ONSCREENDISPLAYPAGESETTINGS2_THROTTLEALIGN_MAXOPTVAL; }
+// Field VTXFreq information
+/* Enumeration options for field VTXFreq */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXFREQ_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQ_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXFreqOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQ_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQ_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2VTXFreqIsValid( uint8_t CurrentVTXFreq ) { return CurrentVTXFreq <= ONSCREENDISPLAYPAGESETTINGS2_VTXFREQ_MAXOPTVAL; }
+// Field VTXFreqFont information
+/* Enumeration options for field VTXFreqFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXFreqFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2VTXFreqFontIsValid( uint8_t CurrentVTXFreqFont ) { return CurrentVTXFreqFont <= ONSCREENDISPLAYPAGESETTINGS2_VTXFREQFONT_MAXOPTVAL; }
+// Field VTXFreqAlign information
+/* Enumeration options for field VTXFreqAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXFreqAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2VTXFreqAlignIsValid( uint8_t CurrentVTXFreqAlign ) { return CurrentVTXFreqAlign <= ONSCREENDISPLAYPAGESETTINGS2_VTXFREQALIGN_MAXOPTVAL; }
+// Field VTXFreqShowUnit information
+/* Enumeration options for field VTXFreqShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXFREQSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_VTXFREQSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXFreqShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXFREQSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2VTXFreqShowUnitIsValid( uint8_t CurrentVTXFreqShowUnit ) { return CurrentVTXFreqShowUnit <= ONSCREENDISPLAYPAGESETTINGS2_VTXFREQSHOWUNIT_MAXOPTVAL; }
+// Field VTXPower information
+/* Enumeration options for field VTXPower */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXPOWER_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWER_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXPowerOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWER_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWER_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2VTXPowerIsValid( uint8_t CurrentVTXPower ) { return CurrentVTXPower <= ONSCREENDISPLAYPAGESETTINGS2_VTXPOWER_MAXOPTVAL; }
+// Field VTXPowerFont information
+/* Enumeration options for field VTXPowerFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXPowerFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2VTXPowerFontIsValid( uint8_t CurrentVTXPowerFont ) { return CurrentVTXPowerFont <= ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERFONT_MAXOPTVAL; }
+// Field VTXPowerAlign information
+/* Enumeration options for field VTXPowerAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXPowerAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings2VTXPowerAlignIsValid( uint8_t CurrentVTXPowerAlign ) { return CurrentVTXPowerAlign <= ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERALIGN_MAXOPTVAL; }
+// Field VTXPowerShowUnit information
+/* Enumeration options for field VTXPowerShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings2VTXPowerShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings2VTXPowerShowUnitIsValid( uint8_t CurrentVTXPowerShowUnit ) { return CurrentVTXPowerShowUnit <= ONSCREENDISPLAYPAGESETTINGS2_VTXPOWERSHOWUNIT_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void OnScreenDisplayPageSettings2AlarmPosXSet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings2AlarmPosXGet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings2AlarmPosYSet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings2AlarmPosYGet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings2AltitudeScalePosSet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings2AltitudeScalePosGet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings2AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings2AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings2AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings2AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings2ArmStatusPosXSet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings2ArmStatusPosXGet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings2ArmStatusPosYSet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings2ArmStatusPosYGet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings2BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings2BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings2BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings2BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings2BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings2BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings2BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings2BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings2BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings2BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings2BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings2BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings2BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings2BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings2BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings2BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings2ClimbRatePosXSet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings2ClimbRatePosXGet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings2ClimbRatePosYSet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings2ClimbRatePosYGet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings2CompassPosSet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings2CompassPosGet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings2CpuPosXSet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings2CpuPosXGet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings2CpuPosYSet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings2CpuPosYGet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings2CustomTextPosXSet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings2CustomTextPosXGet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings2CustomTextPosYSet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings2CustomTextPosYGet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings2FlightModePosXSet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings2FlightModePosXGet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings2FlightModePosYSet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings2FlightModePosYGet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings2GForcePosXSet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings2GForcePosXGet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings2GForcePosYSet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings2GForcePosYGet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings2GpsStatusPosXSet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings2GpsStatusPosXGet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings2GpsStatusPosYSet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings2GpsStatusPosYGet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings2GpsLatPosXSet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings2GpsLatPosXGet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings2GpsLatPosYSet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings2GpsLatPosYGet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings2GpsLonPosXSet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings2GpsLonPosXGet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings2GpsLonPosYSet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings2GpsLonPosYGet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings2GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings2GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings2GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings2GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings2HomeDistancePosXSet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings2HomeDistancePosXGet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings2HomeDistancePosYSet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings2HomeDistancePosYGet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings2HomeArrowPosXSet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings2HomeArrowPosXGet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings2HomeArrowPosYSet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings2HomeArrowPosYGet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings2MapWidthMetersSet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings2MapWidthMetersGet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings2MapWidthPixelsSet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings2MapWidthPixelsGet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings2MapHeightMetersSet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings2MapHeightMetersGet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings2MapHeightPixelsSet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings2MapHeightPixelsGet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings2RssiPosXSet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings2RssiPosXGet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings2RssiPosYSet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings2RssiPosYGet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings2SpeedScalePosSet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings2SpeedScalePosGet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings2SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings2SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings2SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings2SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings2TimePosXSet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings2TimePosXGet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings2TimePosYSet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings2TimePosYGet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings2ThrottlePosXSet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings2ThrottlePosXGet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings2ThrottlePosYSet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings2ThrottlePosYGet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings2VTXFreqPosXSet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettings2VTXFreqPosXGet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettings2VTXFreqPosYSet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettings2VTXFreqPosYGet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettings2VTXPowerPosXSet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettings2VTXPowerPosXGet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettings2VTXPowerPosYSet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettings2VTXPowerPosYGet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettings2AlarmSet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings2AlarmGet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings2AlarmFontSet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings2AlarmFontGet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings2AlarmAlignSet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings2AlarmAlignGet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings2AltitudeScaleSet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings2AltitudeScaleGet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings2AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings2AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings2AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings2AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings2AltitudeNumericSet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings2AltitudeNumericGet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings2AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings2AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings2AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings2AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings2AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings2AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings2ArmStatusSet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings2ArmStatusGet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings2ArmStatusFontSet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings2ArmStatusFontGet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings2ArmStatusAlignSet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings2ArmStatusAlignGet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonSet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonGet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings2ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings2BatteryVoltSet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings2BatteryVoltGet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings2BatteryVoltFontSet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings2BatteryVoltFontGet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings2BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings2BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings2BatteryCurrentSet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings2BatteryCurrentGet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings2BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings2BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings2BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings2BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings2BatteryConsumedSet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings2BatteryConsumedGet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings2BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings2BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings2BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings2BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings2BatteryChargeStateSet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings2BatteryChargeStateGet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings2CenterMarkSet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings2CenterMarkGet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings2ClimbRateSet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings2ClimbRateGet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings2ClimbRateFontSet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings2ClimbRateFontGet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings2ClimbRateAlignSet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings2ClimbRateAlignGet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings2CompassSet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings2CompassGet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings2CompassHomeDirSet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings2CompassHomeDirGet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings2CpuSet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings2CpuGet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings2CpuFontSet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings2CpuFontGet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings2CpuAlignSet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings2CpuAlignGet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings2CustomTextSet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings2CustomTextGet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings2CustomTextFontSet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings2CustomTextFontGet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings2CustomTextAlignSet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings2CustomTextAlignGet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings2FlightModeSet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings2FlightModeGet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings2FlightModeFontSet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings2FlightModeFontGet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings2FlightModeAlignSet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings2FlightModeAlignGet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings2GForceSet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings2GForceGet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings2GForceFontSet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings2GForceFontGet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings2GForceAlignSet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings2GForceAlignGet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings2GpsStatusSet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings2GpsStatusGet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings2GpsStatusFontSet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings2GpsStatusFontGet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings2GpsLatSet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings2GpsLatGet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings2GpsLatFontSet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings2GpsLatFontGet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings2GpsLatAlignSet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings2GpsLatAlignGet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings2GpsLonSet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings2GpsLonGet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings2GpsLonFontSet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings2GpsLonFontGet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings2GpsLonAlignSet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings2GpsLonAlignGet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings2GpsMgrsSet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings2GpsMgrsGet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings2GpsMgrsFontSet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings2GpsMgrsFontGet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings2GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings2GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings2HomeDistanceSet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings2HomeDistanceGet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings2HomeDistanceFontSet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings2HomeDistanceFontGet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings2HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings2HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings2HomeArrowSet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings2HomeArrowGet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings2MapSet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings2MapGet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings2MapCenterModeSet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings2MapCenterModeGet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings2MapShowWpSet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings2MapShowWpGet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings2MapShowUavHomeSet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings2MapShowUavHomeGet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings2MapShowTabletSet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings2MapShowTabletGet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings2RssiSet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings2RssiGet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings2RssiFontSet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings2RssiFontGet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings2RssiShowIconSet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings2RssiShowIconGet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings2SpeedScaleSet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings2SpeedScaleGet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings2SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings2SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings2SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings2SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings2SpeedNumericSet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings2SpeedNumericGet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings2SpeedNumericFontSet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings2SpeedNumericFontGet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings2SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings2SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings2SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings2SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings2TimeSet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings2TimeGet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings2TimeFontSet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings2TimeFontGet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings2TimeAlignSet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings2TimeAlignGet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings2ThrottleSet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings2ThrottleGet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings2ThrottleFontSet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings2ThrottleFontGet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings2ThrottleAlignSet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettings2ThrottleAlignGet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettings2VTXFreqSet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettings2VTXFreqGet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettings2VTXFreqFontSet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettings2VTXFreqFontGet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettings2VTXFreqAlignSet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettings2VTXFreqAlignGet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettings2VTXFreqShowUnitSet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettings2VTXFreqShowUnitGet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettings2VTXPowerSet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettings2VTXPowerGet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettings2VTXPowerFontSet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettings2VTXPowerFontGet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettings2VTXPowerAlignSet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettings2VTXPowerAlignGet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettings2VTXPowerShowUnitSet( uint8_t *NewVTXPowerShowUnit );
+extern void OnScreenDisplayPageSettings2VTXPowerShowUnitGet( uint8_t *NewVTXPowerShowUnit );
+
+
+#endif // ONSCREENDISPLAYPAGESETTINGS2_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,1423 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaypagesettings3.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplayPageSettings3 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings3.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaypagesettings3.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const OnScreenDisplayPageSettings3Data defaultData = {
+	.AlarmPosX = 0,
+	.AlarmPosY = 214,
+	.AltitudeScalePos = 350,
+	.AltitudeNumericPosX = 280,
+	.AltitudeNumericPosY = 200,
+	.ArmStatusPosX = 0,
+	.ArmStatusPosY = 24,
+	.BatteryVoltPosX = 350,
+	.BatteryVoltPosY = 4,
+	.BatteryCurrentPosX = 350,
+	.BatteryCurrentPosY = 14,
+	.BatteryConsumedPosX = 350,
+	.BatteryConsumedPosY = 24,
+	.BatteryChargeStatePosX = 325,
+	.BatteryChargeStatePosY = 38,
+	.ClimbRatePosX = 350,
+	.ClimbRatePosY = 200,
+	.CompassPos = 15,
+	.CpuPosX = 0,
+	.CpuPosY = 204,
+	.CustomTextPosX = 60,
+	.CustomTextPosY = 190,
+	.FlightModePosX = 0,
+	.FlightModePosY = 4,
+	.GForcePosX = 10,
+	.GForcePosY = 40,
+	.GpsStatusPosX = 0,
+	.GpsStatusPosY = 230,
+	.GpsLatPosX = 200,
+	.GpsLatPosY = 230,
+	.GpsLonPosX = 350,
+	.GpsLonPosY = 230,
+	.GpsMgrsPosX = 350,
+	.GpsMgrsPosY = 230,
+	.HomeDistancePosX = 180,
+	.HomeDistancePosY = 195,
+	.HomeArrowPosX = 240,
+	.HomeArrowPosY = 195,
+	.MapWidthMeters = 2000,
+	.MapWidthPixels = 180,
+	.MapHeightMeters = 2000,
+	.MapHeightPixels = 140,
+	.RssiPosX = 130,
+	.RssiPosY = 195,
+	.SpeedScalePos = 0,
+	.SpeedNumericPosX = 50,
+	.SpeedNumericPosY = 200,
+	.TimePosX = 350,
+	.TimePosY = 220,
+	.ThrottlePosX = 300,
+	.ThrottlePosY = 220,
+	.VTXFreqPosX = 220,
+	.VTXFreqPosY = 220,
+	.VTXPowerPosX = 280,
+	.VTXPowerPosY = 220,
+	.Alarm = 1,
+	.AlarmFont = 0,
+	.AlarmAlign = 0,
+	.AltitudeScale = 1,
+	.AltitudeScaleAlign = 1,
+	.AltitudeScaleSource = 0,
+	.AltitudeNumeric = 0,
+	.AltitudeNumericAlign = 0,
+	.AltitudeNumericFont = 0,
+	.AltitudeNumericSource = 0,
+	.ArmStatus = 1,
+	.ArmStatusFont = 0,
+	.ArmStatusAlign = 0,
+	.ArtificialHorizon = 1,
+	.ArtificialHorizonMaxPitch = 30,
+	.ArtificialHorizonPitchSteps = 2,
+	.BatteryVolt = 1,
+	.BatteryVoltFont = 0,
+	.BatteryVoltAlign = 2,
+	.BatteryCurrent = 1,
+	.BatteryCurrentFont = 0,
+	.BatteryCurrentAlign = 2,
+	.BatteryConsumed = 1,
+	.BatteryConsumedFont = 0,
+	.BatteryConsumedAlign = 2,
+	.BatteryChargeState = 1,
+	.CenterMark = 1,
+	.ClimbRate = 1,
+	.ClimbRateFont = 0,
+	.ClimbRateAlign = 2,
+	.Compass = 1,
+	.CompassHomeDir = 1,
+	.Cpu = 0,
+	.CpuFont = 0,
+	.CpuAlign = 0,
+	.CustomText = 0,
+	.CustomTextFont = 0,
+	.CustomTextAlign = 0,
+	.FlightMode = 1,
+	.FlightModeFont = 0,
+	.FlightModeAlign = 0,
+	.GForce = 1,
+	.GForceFont = 0,
+	.GForceAlign = 0,
+	.GpsStatus = 1,
+	.GpsStatusFont = 0,
+	.GpsLat = 1,
+	.GpsLatFont = 0,
+	.GpsLatAlign = 0,
+	.GpsLon = 1,
+	.GpsLonFont = 0,
+	.GpsLonAlign = 2,
+	.GpsMgrs = 0,
+	.GpsMgrsFont = 0,
+	.GpsMgrsAlign = 2,
+	.HomeDistance = 1,
+	.HomeDistanceFont = 0,
+	.HomeDistanceShowIcon = 1,
+	.HomeArrow = 1,
+	.Map = 0,
+	.MapCenterMode = 0,
+	.MapShowWp = 0,
+	.MapShowUavHome = 1,
+	.MapShowTablet = 0,
+	.Rssi = 1,
+	.RssiFont = 0,
+	.RssiShowIcon = 1,
+	.SpeedScale = 1,
+	.SpeedScaleAlign = 0,
+	.SpeedScaleSource = 0,
+	.SpeedNumeric = 1,
+	.SpeedNumericFont = 0,
+	.SpeedNumericAlign = 0,
+	.SpeedNumericSource = 0,
+	.Time = 1,
+	.TimeFont = 0,
+	.TimeAlign = 2,
+	.Throttle = 0,
+	.ThrottleFont = 0,
+	.ThrottleAlign = 2,
+	.VTXFreq = 1,
+	.VTXFreqFont = 0,
+	.VTXFreqAlign = 2,
+	.VTXFreqShowUnit = 1,
+	.VTXPower = 1,
+	.VTXPowerFont = 0,
+	.VTXPowerAlign = 2,
+	.VTXPowerShowUnit = 1,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplayPageSettings3Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYPAGESETTINGS3_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYPAGESETTINGS3_OBJID,
+			ONSCREENDISPLAYPAGESETTINGS3_ISSINGLEINST, ONSCREENDISPLAYPAGESETTINGS3_ISSETTINGS, ONSCREENDISPLAYPAGESETTINGS3_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplayPageSettings3SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplayPageSettings3Data data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplayPageSettings3SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplayPageSettings3SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplayPageSettings3SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplayPageSettings3SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplayPageSettings3Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplayPageSettings3AlarmPosXSet( int16_t *NewAlarmPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings3Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AlarmPosXGet( int16_t *NewAlarmPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings3Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AlarmPosYSet( int16_t *NewAlarmPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings3Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AlarmPosYGet( int16_t *NewAlarmPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings3Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScalePosSet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScalePosGet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusPosXSet( int16_t *NewArmStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusPosXGet( int16_t *NewArmStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusPosYSet( int16_t *NewArmStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusPosYGet( int16_t *NewArmStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ClimbRatePosXSet( int16_t *NewClimbRatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings3Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ClimbRatePosXGet( int16_t *NewClimbRatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings3Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ClimbRatePosYSet( int16_t *NewClimbRatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings3Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ClimbRatePosYGet( int16_t *NewClimbRatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings3Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CompassPosSet( int16_t *NewCompassPos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings3Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CompassPosGet( int16_t *NewCompassPos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings3Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CpuPosXSet( int16_t *NewCpuPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings3Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CpuPosXGet( int16_t *NewCpuPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings3Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CpuPosYSet( int16_t *NewCpuPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings3Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CpuPosYGet( int16_t *NewCpuPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings3Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CustomTextPosXSet( int16_t *NewCustomTextPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings3Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CustomTextPosXGet( int16_t *NewCustomTextPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings3Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CustomTextPosYSet( int16_t *NewCustomTextPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings3Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3CustomTextPosYGet( int16_t *NewCustomTextPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings3Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3FlightModePosXSet( int16_t *NewFlightModePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings3Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3FlightModePosXGet( int16_t *NewFlightModePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings3Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3FlightModePosYSet( int16_t *NewFlightModePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings3Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3FlightModePosYGet( int16_t *NewFlightModePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings3Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GForcePosXSet( int16_t *NewGForcePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings3Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GForcePosXGet( int16_t *NewGForcePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings3Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GForcePosYSet( int16_t *NewGForcePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings3Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GForcePosYGet( int16_t *NewGForcePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings3Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusPosXSet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusPosXGet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusPosYSet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusPosYGet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLatPosXSet( int16_t *NewGpsLatPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLatPosXGet( int16_t *NewGpsLatPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLatPosYSet( int16_t *NewGpsLatPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLatPosYGet( int16_t *NewGpsLatPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLonPosXSet( int16_t *NewGpsLonPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLonPosXGet( int16_t *NewGpsLonPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLonPosYSet( int16_t *NewGpsLonPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsLonPosYGet( int16_t *NewGpsLonPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeDistancePosXSet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings3Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeDistancePosXGet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings3Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeDistancePosYSet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings3Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeDistancePosYGet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings3Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowPosXSet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings3Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowPosXGet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings3Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowPosYSet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings3Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowPosYGet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings3Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapWidthMetersSet( int16_t *NewMapWidthMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings3Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapWidthMetersGet( int16_t *NewMapWidthMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings3Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapWidthPixelsSet( int16_t *NewMapWidthPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings3Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapWidthPixelsGet( int16_t *NewMapWidthPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings3Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapHeightMetersSet( int16_t *NewMapHeightMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings3Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapHeightMetersGet( int16_t *NewMapHeightMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings3Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapHeightPixelsSet( int16_t *NewMapHeightPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings3Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3MapHeightPixelsGet( int16_t *NewMapHeightPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings3Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3RssiPosXSet( int16_t *NewRssiPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings3Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3RssiPosXGet( int16_t *NewRssiPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings3Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3RssiPosYSet( int16_t *NewRssiPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings3Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3RssiPosYGet( int16_t *NewRssiPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings3Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedScalePosSet( int16_t *NewSpeedScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings3Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedScalePosGet( int16_t *NewSpeedScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings3Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3TimePosXSet( int16_t *NewTimePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings3Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3TimePosXGet( int16_t *NewTimePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings3Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3TimePosYSet( int16_t *NewTimePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings3Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3TimePosYGet( int16_t *NewTimePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings3Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ThrottlePosXSet( int16_t *NewThrottlePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings3Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ThrottlePosXGet( int16_t *NewThrottlePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings3Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ThrottlePosYSet( int16_t *NewThrottlePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings3Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3ThrottlePosYGet( int16_t *NewThrottlePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings3Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqPosXSet( int16_t *NewVTXFreqPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqPosX, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqPosXGet( int16_t *NewVTXFreqPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqPosX, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqPosYSet( int16_t *NewVTXFreqPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqPosY, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqPosYGet( int16_t *NewVTXFreqPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqPosY, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerPosXSet( int16_t *NewVTXPowerPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerPosX, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerPosXGet( int16_t *NewVTXPowerPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerPosX, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerPosYSet( int16_t *NewVTXPowerPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerPosY, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerPosYGet( int16_t *NewVTXPowerPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerPosY, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings3AlarmSet( uint8_t *NewAlarm )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings3Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AlarmGet( uint8_t *NewAlarm )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings3Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AlarmFontSet( uint8_t *NewAlarmFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings3Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AlarmFontGet( uint8_t *NewAlarmFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings3Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AlarmAlignSet( uint8_t *NewAlarmAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings3Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AlarmAlignGet( uint8_t *NewAlarmAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings3Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleSet( uint8_t *NewAltitudeScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleGet( uint8_t *NewAltitudeScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings3Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericSet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericGet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings3Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusSet( uint8_t *NewArmStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings3Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusGet( uint8_t *NewArmStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings3Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusFontSet( uint8_t *NewArmStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusFontGet( uint8_t *NewArmStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusAlignSet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArmStatusAlignGet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings3Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonSet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonGet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings3Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltSet( uint8_t *NewBatteryVolt )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings3Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltGet( uint8_t *NewBatteryVolt )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings3Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltFontSet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltFontGet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentSet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentGet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedSet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedGet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings3Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStateSet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3BatteryChargeStateGet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings3Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CenterMarkSet( uint8_t *NewCenterMark )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings3Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CenterMarkGet( uint8_t *NewCenterMark )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings3Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateSet( uint8_t *NewClimbRate )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings3Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateGet( uint8_t *NewClimbRate )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings3Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateFontSet( uint8_t *NewClimbRateFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings3Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateFontGet( uint8_t *NewClimbRateFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings3Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateAlignSet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings3Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ClimbRateAlignGet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings3Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CompassSet( uint8_t *NewCompass )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings3Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CompassGet( uint8_t *NewCompass )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings3Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CompassHomeDirSet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings3Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CompassHomeDirGet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings3Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuSet( uint8_t *NewCpu )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings3Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuGet( uint8_t *NewCpu )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings3Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuFontSet( uint8_t *NewCpuFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings3Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuFontGet( uint8_t *NewCpuFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings3Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuAlignSet( uint8_t *NewCpuAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings3Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CpuAlignGet( uint8_t *NewCpuAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings3Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings3Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings3Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextFontSet( uint8_t *NewCustomTextFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings3Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextFontGet( uint8_t *NewCustomTextFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings3Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextAlignSet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings3Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3CustomTextAlignGet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings3Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeSet( uint8_t *NewFlightMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings3Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeGet( uint8_t *NewFlightMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings3Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeFontSet( uint8_t *NewFlightModeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings3Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeFontGet( uint8_t *NewFlightModeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings3Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeAlignSet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings3Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3FlightModeAlignGet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings3Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceSet( uint8_t *NewGForce )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings3Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceGet( uint8_t *NewGForce )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings3Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceFontSet( uint8_t *NewGForceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings3Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceFontGet( uint8_t *NewGForceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings3Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceAlignSet( uint8_t *NewGForceAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings3Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GForceAlignGet( uint8_t *NewGForceAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings3Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusSet( uint8_t *NewGpsStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings3Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusGet( uint8_t *NewGpsStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings3Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusFontSet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsStatusFontGet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings3Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatSet( uint8_t *NewGpsLat )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings3Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatGet( uint8_t *NewGpsLat )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings3Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatFontSet( uint8_t *NewGpsLatFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings3Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatFontGet( uint8_t *NewGpsLatFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings3Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatAlignSet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLatAlignGet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonSet( uint8_t *NewGpsLon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings3Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonGet( uint8_t *NewGpsLon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings3Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonFontSet( uint8_t *NewGpsLonFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings3Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonFontGet( uint8_t *NewGpsLonFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings3Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonAlignSet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsLonAlignGet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsSet( uint8_t *NewGpsMgrs )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsGet( uint8_t *NewGpsMgrs )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsFontSet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsFontGet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings3Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceSet( uint8_t *NewHomeDistance )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings3Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceGet( uint8_t *NewHomeDistance )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings3Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceFontSet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings3Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceFontGet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings3Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings3Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings3Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowSet( uint8_t *NewHomeArrow )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings3Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3HomeArrowGet( uint8_t *NewHomeArrow )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings3Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapSet( uint8_t *NewMap )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings3Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapGet( uint8_t *NewMap )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings3Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapCenterModeSet( uint8_t *NewMapCenterMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings3Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapCenterModeGet( uint8_t *NewMapCenterMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings3Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowWpSet( uint8_t *NewMapShowWp )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings3Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowWpGet( uint8_t *NewMapShowWp )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings3Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowUavHomeSet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings3Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowUavHomeGet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings3Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowTabletSet( uint8_t *NewMapShowTablet )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings3Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3MapShowTabletGet( uint8_t *NewMapShowTablet )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings3Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiSet( uint8_t *NewRssi )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings3Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiGet( uint8_t *NewRssi )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings3Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiFontSet( uint8_t *NewRssiFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings3Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiFontGet( uint8_t *NewRssiFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings3Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiShowIconSet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings3Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3RssiShowIconGet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings3Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleSet( uint8_t *NewSpeedScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings3Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleGet( uint8_t *NewSpeedScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings3Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings3Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings3Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings3Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings3Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericSet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericGet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericFontSet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericFontGet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings3Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeSet( uint8_t *NewTime )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings3Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeGet( uint8_t *NewTime )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings3Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeFontSet( uint8_t *NewTimeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings3Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeFontGet( uint8_t *NewTimeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings3Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeAlignSet( uint8_t *NewTimeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings3Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3TimeAlignGet( uint8_t *NewTimeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings3Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleSet( uint8_t *NewThrottle )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings3Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleGet( uint8_t *NewThrottle )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings3Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleFontSet( uint8_t *NewThrottleFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings3Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleFontGet( uint8_t *NewThrottleFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings3Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleAlignSet( uint8_t *NewThrottleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings3Data, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3ThrottleAlignGet( uint8_t *NewThrottleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings3Data, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqSet( uint8_t *NewVTXFreq )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreq, offsetof( OnScreenDisplayPageSettings3Data, VTXFreq), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqGet( uint8_t *NewVTXFreq )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreq, offsetof( OnScreenDisplayPageSettings3Data, VTXFreq), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqFontSet( uint8_t *NewVTXFreqFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqFont, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqFontGet( uint8_t *NewVTXFreqFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqFont, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqAlignSet( uint8_t *NewVTXFreqAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqAlign, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqAlignGet( uint8_t *NewVTXFreqAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqAlign, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqShowUnitSet( uint8_t *NewVTXFreqShowUnit )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqShowUnit, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXFreqShowUnitGet( uint8_t *NewVTXFreqShowUnit )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXFreqShowUnit, offsetof( OnScreenDisplayPageSettings3Data, VTXFreqShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerSet( uint8_t *NewVTXPower )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPower, offsetof( OnScreenDisplayPageSettings3Data, VTXPower), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerGet( uint8_t *NewVTXPower )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPower, offsetof( OnScreenDisplayPageSettings3Data, VTXPower), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerFontSet( uint8_t *NewVTXPowerFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerFont, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerFontGet( uint8_t *NewVTXPowerFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerFont, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerAlignSet( uint8_t *NewVTXPowerAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerAlign, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerAlignGet( uint8_t *NewVTXPowerAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerAlign, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerShowUnitSet( uint8_t *NewVTXPowerShowUnit )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerShowUnit, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerShowUnit), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings3VTXPowerShowUnitGet( uint8_t *NewVTXPowerShowUnit )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings3Handle(), (void*)NewVTXPowerShowUnit, offsetof( OnScreenDisplayPageSettings3Data, VTXPowerShowUnit), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,1118 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup OnScreenDisplayPageSettings4 OnScreenDisplayPageSettings4
+ * @brief On Screen Display Page Settings
+ *
+ *
+ * @file       onscreendisplaypagesettings4.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the OnScreenDisplayPageSettings4 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings4.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ONSCREENDISPLAYPAGESETTINGS4_H
+#define ONSCREENDISPLAYPAGESETTINGS4_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ONSCREENDISPLAYPAGESETTINGS4_OBJID 0x5DC3366A
+#define ONSCREENDISPLAYPAGESETTINGS4_ISSINGLEINST 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ISSETTINGS 1
+#define ONSCREENDISPLAYPAGESETTINGS4_NUMBYTES 198
+
+// Generic interface functions
+int32_t OnScreenDisplayPageSettings4Initialize();
+UAVObjHandle OnScreenDisplayPageSettings4Handle();
+void OnScreenDisplayPageSettings4SetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    int16_t AlarmPosX;
+    int16_t AlarmPosY;
+    int16_t AltitudeScalePos;
+    int16_t AltitudeNumericPosX;
+    int16_t AltitudeNumericPosY;
+    int16_t ArmStatusPosX;
+    int16_t ArmStatusPosY;
+    int16_t BatteryVoltPosX;
+    int16_t BatteryVoltPosY;
+    int16_t BatteryCurrentPosX;
+    int16_t BatteryCurrentPosY;
+    int16_t BatteryConsumedPosX;
+    int16_t BatteryConsumedPosY;
+    int16_t BatteryChargeStatePosX;
+    int16_t BatteryChargeStatePosY;
+    int16_t ClimbRatePosX;
+    int16_t ClimbRatePosY;
+    int16_t CompassPos;
+    int16_t CpuPosX;
+    int16_t CpuPosY;
+    int16_t CustomTextPosX;
+    int16_t CustomTextPosY;
+    int16_t FlightModePosX;
+    int16_t FlightModePosY;
+    int16_t GForcePosX;
+    int16_t GForcePosY;
+    int16_t GpsStatusPosX;
+    int16_t GpsStatusPosY;
+    int16_t GpsLatPosX;
+    int16_t GpsLatPosY;
+    int16_t GpsLonPosX;
+    int16_t GpsLonPosY;
+    int16_t GpsMgrsPosX;
+    int16_t GpsMgrsPosY;
+    int16_t HomeDistancePosX;
+    int16_t HomeDistancePosY;
+    int16_t HomeArrowPosX;
+    int16_t HomeArrowPosY;
+    int16_t MapWidthMeters;
+    int16_t MapWidthPixels;
+    int16_t MapHeightMeters;
+    int16_t MapHeightPixels;
+    int16_t RssiPosX;
+    int16_t RssiPosY;
+    int16_t SpeedScalePos;
+    int16_t SpeedNumericPosX;
+    int16_t SpeedNumericPosY;
+    int16_t TimePosX;
+    int16_t TimePosY;
+    int16_t ThrottlePosX;
+    int16_t ThrottlePosY;
+    int16_t VTXFreqPosX;
+    int16_t VTXFreqPosY;
+    int16_t VTXPowerPosX;
+    int16_t VTXPowerPosY;
+    uint8_t Alarm;
+    uint8_t AlarmFont;
+    uint8_t AlarmAlign;
+    uint8_t AltitudeScale;
+    uint8_t AltitudeScaleAlign;
+    uint8_t AltitudeScaleSource;
+    uint8_t AltitudeNumeric;
+    uint8_t AltitudeNumericAlign;
+    uint8_t AltitudeNumericFont;
+    uint8_t AltitudeNumericSource;
+    uint8_t ArmStatus;
+    uint8_t ArmStatusFont;
+    uint8_t ArmStatusAlign;
+    uint8_t ArtificialHorizon;
+    uint8_t ArtificialHorizonMaxPitch;
+    uint8_t ArtificialHorizonPitchSteps;
+    uint8_t BatteryVolt;
+    uint8_t BatteryVoltFont;
+    uint8_t BatteryVoltAlign;
+    uint8_t BatteryCurrent;
+    uint8_t BatteryCurrentFont;
+    uint8_t BatteryCurrentAlign;
+    uint8_t BatteryConsumed;
+    uint8_t BatteryConsumedFont;
+    uint8_t BatteryConsumedAlign;
+    uint8_t BatteryChargeState;
+    uint8_t CenterMark;
+    uint8_t ClimbRate;
+    uint8_t ClimbRateFont;
+    uint8_t ClimbRateAlign;
+    uint8_t Compass;
+    uint8_t CompassHomeDir;
+    uint8_t Cpu;
+    uint8_t CpuFont;
+    uint8_t CpuAlign;
+    uint8_t CustomText;
+    uint8_t CustomTextFont;
+    uint8_t CustomTextAlign;
+    uint8_t FlightMode;
+    uint8_t FlightModeFont;
+    uint8_t FlightModeAlign;
+    uint8_t GForce;
+    uint8_t GForceFont;
+    uint8_t GForceAlign;
+    uint8_t GpsStatus;
+    uint8_t GpsStatusFont;
+    uint8_t GpsLat;
+    uint8_t GpsLatFont;
+    uint8_t GpsLatAlign;
+    uint8_t GpsLon;
+    uint8_t GpsLonFont;
+    uint8_t GpsLonAlign;
+    uint8_t GpsMgrs;
+    uint8_t GpsMgrsFont;
+    uint8_t GpsMgrsAlign;
+    uint8_t HomeDistance;
+    uint8_t HomeDistanceFont;
+    uint8_t HomeDistanceShowIcon;
+    uint8_t HomeArrow;
+    uint8_t Map;
+    uint8_t MapCenterMode;
+    uint8_t MapShowWp;
+    uint8_t MapShowUavHome;
+    uint8_t MapShowTablet;
+    uint8_t Rssi;
+    uint8_t RssiFont;
+    uint8_t RssiShowIcon;
+    uint8_t SpeedScale;
+    uint8_t SpeedScaleAlign;
+    uint8_t SpeedScaleSource;
+    uint8_t SpeedNumeric;
+    uint8_t SpeedNumericFont;
+    uint8_t SpeedNumericAlign;
+    uint8_t SpeedNumericSource;
+    uint8_t Time;
+    uint8_t TimeFont;
+    uint8_t TimeAlign;
+    uint8_t Throttle;
+    uint8_t ThrottleFont;
+    uint8_t ThrottleAlign;
+    uint8_t VTXFreq;
+    uint8_t VTXFreqFont;
+    uint8_t VTXFreqAlign;
+    uint8_t VTXFreqShowUnit;
+    uint8_t VTXPower;
+    uint8_t VTXPowerFont;
+    uint8_t VTXPowerAlign;
+    uint8_t VTXPowerShowUnit;
+
+} __attribute__((packed)) __attribute__((aligned(4))) OnScreenDisplayPageSettings4Data;
+
+// Typesafe Object access functions
+/**
+ * @function OnScreenDisplayPageSettings4Get(dataOut)
+ * @brief Populate a OnScreenDisplayPageSettings4Data object
+ * @param[out] dataOut 
+ */
+static inline int32_t OnScreenDisplayPageSettings4Get(OnScreenDisplayPageSettings4Data *dataOut) { return UAVObjGetData(OnScreenDisplayPageSettings4Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings4Set(const OnScreenDisplayPageSettings4Data *dataIn) { return UAVObjSetData(OnScreenDisplayPageSettings4Handle(), dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings4InstGet(uint16_t instId, OnScreenDisplayPageSettings4Data *dataOut) { return UAVObjGetInstanceData(OnScreenDisplayPageSettings4Handle(), instId, dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings4InstSet(uint16_t instId, const OnScreenDisplayPageSettings4Data *dataIn) { return UAVObjSetInstanceData(OnScreenDisplayPageSettings4Handle(), instId, dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings4ConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(OnScreenDisplayPageSettings4Handle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings4ConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(OnScreenDisplayPageSettings4Handle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings4ConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(OnScreenDisplayPageSettings4Handle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings4ConnectCopy(volatile OnScreenDisplayPageSettings4Data *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	OnScreenDisplayPageSettings4Get((void *) dataOut);
+
+	return UAVObjConnectCallback(OnScreenDisplayPageSettings4Handle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t OnScreenDisplayPageSettings4CreateInstance() { return UAVObjCreateInstance(OnScreenDisplayPageSettings4Handle(), &OnScreenDisplayPageSettings4SetDefaults); }
+
+static inline void OnScreenDisplayPageSettings4Updated() { UAVObjUpdated(OnScreenDisplayPageSettings4Handle()); }
+
+static inline void OnScreenDisplayPageSettings4InstUpdated(uint16_t instId) { UAVObjInstanceUpdated(OnScreenDisplayPageSettings4Handle(), instId); }
+
+static inline int32_t OnScreenDisplayPageSettings4GetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(OnScreenDisplayPageSettings4Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings4SetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(OnScreenDisplayPageSettings4Handle(), dataIn); }
+
+static inline int8_t OnScreenDisplayPageSettings4ReadOnly() { return UAVObjReadOnly(OnScreenDisplayPageSettings4Handle()); }
+
+static inline uint16_t OnScreenDisplayPageSettings4GetNumInstances(){ return UAVObjGetNumInstances(OnScreenDisplayPageSettings4Handle()); }
+
+static inline uint32_t OnScreenDisplayPageSettings4GetNumBytes(){ return UAVObjGetNumBytes(OnScreenDisplayPageSettings4Handle()); }
+
+// Field information
+// Field AlarmPosX information
+// Field AlarmPosY information
+// Field AltitudeScalePos information
+// Field AltitudeNumericPosX information
+// Field AltitudeNumericPosY information
+// Field ArmStatusPosX information
+// Field ArmStatusPosY information
+// Field BatteryVoltPosX information
+// Field BatteryVoltPosY information
+// Field BatteryCurrentPosX information
+// Field BatteryCurrentPosY information
+// Field BatteryConsumedPosX information
+// Field BatteryConsumedPosY information
+// Field BatteryChargeStatePosX information
+// Field BatteryChargeStatePosY information
+// Field ClimbRatePosX information
+// Field ClimbRatePosY information
+// Field CompassPos information
+// Field CpuPosX information
+// Field CpuPosY information
+// Field CustomTextPosX information
+// Field CustomTextPosY information
+// Field FlightModePosX information
+// Field FlightModePosY information
+// Field GForcePosX information
+// Field GForcePosY information
+// Field GpsStatusPosX information
+// Field GpsStatusPosY information
+// Field GpsLatPosX information
+// Field GpsLatPosY information
+// Field GpsLonPosX information
+// Field GpsLonPosY information
+// Field GpsMgrsPosX information
+// Field GpsMgrsPosY information
+// Field HomeDistancePosX information
+// Field HomeDistancePosY information
+// Field HomeArrowPosX information
+// Field HomeArrowPosY information
+// Field MapWidthMeters information
+// Field MapWidthPixels information
+// Field MapHeightMeters information
+// Field MapHeightPixels information
+// Field RssiPosX information
+// Field RssiPosY information
+// Field SpeedScalePos information
+// Field SpeedNumericPosX information
+// Field SpeedNumericPosY information
+// Field TimePosX information
+// Field TimePosY information
+// Field ThrottlePosX information
+// Field ThrottlePosY information
+// Field VTXFreqPosX information
+// Field VTXFreqPosY information
+// Field VTXPowerPosX information
+// Field VTXPowerPosY information
+// Field Alarm information
+/* Enumeration options for field Alarm */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALARM_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_ALARM_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AlarmOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARM_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARM_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AlarmIsValid( uint8_t CurrentAlarm ) { return CurrentAlarm <= ONSCREENDISPLAYPAGESETTINGS4_ALARM_MAXOPTVAL; }
+// Field AlarmFont information
+/* Enumeration options for field AlarmFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4AlarmFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4AlarmFontIsValid( uint8_t CurrentAlarmFont ) { return CurrentAlarmFont <= ONSCREENDISPLAYPAGESETTINGS4_ALARMFONT_MAXOPTVAL; }
+// Field AlarmAlign information
+/* Enumeration options for field AlarmAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4AlarmAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4AlarmAlignIsValid( uint8_t CurrentAlarmAlign ) { return CurrentAlarmAlign <= ONSCREENDISPLAYPAGESETTINGS4_ALARMALIGN_MAXOPTVAL; }
+// Field AltitudeScale information
+/* Enumeration options for field AltitudeScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeScaleIsValid( uint8_t CurrentAltitudeScale ) { return CurrentAltitudeScale <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALE_MAXOPTVAL; }
+// Field AltitudeScaleAlign information
+/* Enumeration options for field AltitudeScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeScaleAlignIsValid( uint8_t CurrentAltitudeScaleAlign ) { return CurrentAltitudeScaleAlign <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALEALIGN_MAXOPTVAL; }
+// Field AltitudeScaleSource information
+/* Enumeration options for field AltitudeScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALESOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALESOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALESOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALESOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeScaleSourceIsValid( uint8_t CurrentAltitudeScaleSource ) { return CurrentAltitudeScaleSource <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDESCALESOURCE_MAXOPTVAL; }
+// Field AltitudeNumeric information
+/* Enumeration options for field AltitudeNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeNumericIsValid( uint8_t CurrentAltitudeNumeric ) { return CurrentAltitudeNumeric <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERIC_MAXOPTVAL; }
+// Field AltitudeNumericAlign information
+/* Enumeration options for field AltitudeNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeNumericAlignIsValid( uint8_t CurrentAltitudeNumericAlign ) { return CurrentAltitudeNumericAlign <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICALIGN_MAXOPTVAL; }
+// Field AltitudeNumericFont information
+/* Enumeration options for field AltitudeNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4AltitudeNumericFontIsValid( uint8_t CurrentAltitudeNumericFont ) { return CurrentAltitudeNumericFont <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICFONT_MAXOPTVAL; }
+// Field AltitudeNumericSource information
+/* Enumeration options for field AltitudeNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICSOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICSOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4AltitudeNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICSOURCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICSOURCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4AltitudeNumericSourceIsValid( uint8_t CurrentAltitudeNumericSource ) { return CurrentAltitudeNumericSource <= ONSCREENDISPLAYPAGESETTINGS4_ALTITUDENUMERICSOURCE_MAXOPTVAL; }
+// Field ArmStatus information
+/* Enumeration options for field ArmStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4ArmStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4ArmStatusIsValid( uint8_t CurrentArmStatus ) { return CurrentArmStatus <= ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUS_MAXOPTVAL; }
+// Field ArmStatusFont information
+/* Enumeration options for field ArmStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ArmStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ArmStatusFontIsValid( uint8_t CurrentArmStatusFont ) { return CurrentArmStatusFont <= ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSFONT_MAXOPTVAL; }
+// Field ArmStatusAlign information
+/* Enumeration options for field ArmStatusAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ArmStatusAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ArmStatusAlignIsValid( uint8_t CurrentArmStatusAlign ) { return CurrentArmStatusAlign <= ONSCREENDISPLAYPAGESETTINGS4_ARMSTATUSALIGN_MAXOPTVAL; }
+// Field ArtificialHorizon information
+/* Enumeration options for field ArtificialHorizon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_ARTIFICIALHORIZON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_ARTIFICIALHORIZON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4ArtificialHorizonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_ARTIFICIALHORIZON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_ARTIFICIALHORIZON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4ArtificialHorizonIsValid( uint8_t CurrentArtificialHorizon ) { return CurrentArtificialHorizon <= ONSCREENDISPLAYPAGESETTINGS4_ARTIFICIALHORIZON_MAXOPTVAL; }
+// Field ArtificialHorizonMaxPitch information
+// Field ArtificialHorizonPitchSteps information
+// Field BatteryVolt information
+/* Enumeration options for field BatteryVolt */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryVoltOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4BatteryVoltIsValid( uint8_t CurrentBatteryVolt ) { return CurrentBatteryVolt <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLT_MAXOPTVAL; }
+// Field BatteryVoltFont information
+/* Enumeration options for field BatteryVoltFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryVoltFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryVoltFontIsValid( uint8_t CurrentBatteryVoltFont ) { return CurrentBatteryVoltFont <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTFONT_MAXOPTVAL; }
+// Field BatteryVoltAlign information
+/* Enumeration options for field BatteryVoltAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryVoltAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryVoltAlignIsValid( uint8_t CurrentBatteryVoltAlign ) { return CurrentBatteryVoltAlign <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYVOLTALIGN_MAXOPTVAL; }
+// Field BatteryCurrent information
+/* Enumeration options for field BatteryCurrent */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryCurrentOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4BatteryCurrentIsValid( uint8_t CurrentBatteryCurrent ) { return CurrentBatteryCurrent <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENT_MAXOPTVAL; }
+// Field BatteryCurrentFont information
+/* Enumeration options for field BatteryCurrentFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryCurrentFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryCurrentFontIsValid( uint8_t CurrentBatteryCurrentFont ) { return CurrentBatteryCurrentFont <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTFONT_MAXOPTVAL; }
+// Field BatteryCurrentAlign information
+/* Enumeration options for field BatteryCurrentAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryCurrentAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryCurrentAlignIsValid( uint8_t CurrentBatteryCurrentAlign ) { return CurrentBatteryCurrentAlign <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCURRENTALIGN_MAXOPTVAL; }
+// Field BatteryConsumed information
+/* Enumeration options for field BatteryConsumed */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMED_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryConsumedOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMED_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMED_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4BatteryConsumedIsValid( uint8_t CurrentBatteryConsumed ) { return CurrentBatteryConsumed <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMED_MAXOPTVAL; }
+// Field BatteryConsumedFont information
+/* Enumeration options for field BatteryConsumedFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryConsumedFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryConsumedFontIsValid( uint8_t CurrentBatteryConsumedFont ) { return CurrentBatteryConsumedFont <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDFONT_MAXOPTVAL; }
+// Field BatteryConsumedAlign information
+/* Enumeration options for field BatteryConsumedAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryConsumedAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4BatteryConsumedAlignIsValid( uint8_t CurrentBatteryConsumedAlign ) { return CurrentBatteryConsumedAlign <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCONSUMEDALIGN_MAXOPTVAL; }
+// Field BatteryChargeState information
+/* Enumeration options for field BatteryChargeState */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_BATTERYCHARGESTATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_BATTERYCHARGESTATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4BatteryChargeStateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCHARGESTATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_BATTERYCHARGESTATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4BatteryChargeStateIsValid( uint8_t CurrentBatteryChargeState ) { return CurrentBatteryChargeState <= ONSCREENDISPLAYPAGESETTINGS4_BATTERYCHARGESTATE_MAXOPTVAL; }
+// Field CenterMark information
+/* Enumeration options for field CenterMark */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_MIDDLE=1, ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_CAMERAPITCH=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4CenterMarkOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4CenterMarkIsValid( uint8_t CurrentCenterMark ) { return CurrentCenterMark <= ONSCREENDISPLAYPAGESETTINGS4_CENTERMARK_MAXOPTVAL; }
+// Field ClimbRate information
+/* Enumeration options for field ClimbRate */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4ClimbRateOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4ClimbRateIsValid( uint8_t CurrentClimbRate ) { return CurrentClimbRate <= ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATE_MAXOPTVAL; }
+// Field ClimbRateFont information
+/* Enumeration options for field ClimbRateFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ClimbRateFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ClimbRateFontIsValid( uint8_t CurrentClimbRateFont ) { return CurrentClimbRateFont <= ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEFONT_MAXOPTVAL; }
+// Field ClimbRateAlign information
+/* Enumeration options for field ClimbRateAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ClimbRateAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ClimbRateAlignIsValid( uint8_t CurrentClimbRateAlign ) { return CurrentClimbRateAlign <= ONSCREENDISPLAYPAGESETTINGS4_CLIMBRATEALIGN_MAXOPTVAL; }
+// Field Compass information
+/* Enumeration options for field Compass */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_COMPASS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_COMPASS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4CompassOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_COMPASS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_COMPASS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4CompassIsValid( uint8_t CurrentCompass ) { return CurrentCompass <= ONSCREENDISPLAYPAGESETTINGS4_COMPASS_MAXOPTVAL; }
+// Field CompassHomeDir information
+/* Enumeration options for field CompassHomeDir */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_COMPASSHOMEDIR_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_COMPASSHOMEDIR_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4CompassHomeDirOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_COMPASSHOMEDIR_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_COMPASSHOMEDIR_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4CompassHomeDirIsValid( uint8_t CurrentCompassHomeDir ) { return CurrentCompassHomeDir <= ONSCREENDISPLAYPAGESETTINGS4_COMPASSHOMEDIR_MAXOPTVAL; }
+// Field Cpu information
+/* Enumeration options for field Cpu */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CPU_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_CPU_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4CpuOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CPU_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_CPU_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4CpuIsValid( uint8_t CurrentCpu ) { return CurrentCpu <= ONSCREENDISPLAYPAGESETTINGS4_CPU_MAXOPTVAL; }
+// Field CpuFont information
+/* Enumeration options for field CpuFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4CpuFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4CpuFontIsValid( uint8_t CurrentCpuFont ) { return CurrentCpuFont <= ONSCREENDISPLAYPAGESETTINGS4_CPUFONT_MAXOPTVAL; }
+// Field CpuAlign information
+/* Enumeration options for field CpuAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4CpuAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4CpuAlignIsValid( uint8_t CurrentCpuAlign ) { return CurrentCpuAlign <= ONSCREENDISPLAYPAGESETTINGS4_CPUALIGN_MAXOPTVAL; }
+// Field CustomText information
+/* Enumeration options for field CustomText */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4CustomTextOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4CustomTextIsValid( uint8_t CurrentCustomText ) { return CurrentCustomText <= ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXT_MAXOPTVAL; }
+// Field CustomTextFont information
+/* Enumeration options for field CustomTextFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4CustomTextFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4CustomTextFontIsValid( uint8_t CurrentCustomTextFont ) { return CurrentCustomTextFont <= ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTFONT_MAXOPTVAL; }
+// Field CustomTextAlign information
+/* Enumeration options for field CustomTextAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4CustomTextAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4CustomTextAlignIsValid( uint8_t CurrentCustomTextAlign ) { return CurrentCustomTextAlign <= ONSCREENDISPLAYPAGESETTINGS4_CUSTOMTEXTALIGN_MAXOPTVAL; }
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4FlightModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4FlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode <= ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODE_MAXOPTVAL; }
+// Field FlightModeFont information
+/* Enumeration options for field FlightModeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4FlightModeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4FlightModeFontIsValid( uint8_t CurrentFlightModeFont ) { return CurrentFlightModeFont <= ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEFONT_MAXOPTVAL; }
+// Field FlightModeAlign information
+/* Enumeration options for field FlightModeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4FlightModeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4FlightModeAlignIsValid( uint8_t CurrentFlightModeAlign ) { return CurrentFlightModeAlign <= ONSCREENDISPLAYPAGESETTINGS4_FLIGHTMODEALIGN_MAXOPTVAL; }
+// Field GForce information
+/* Enumeration options for field GForce */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GFORCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_GFORCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4GForceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4GForceIsValid( uint8_t CurrentGForce ) { return CurrentGForce <= ONSCREENDISPLAYPAGESETTINGS4_GFORCE_MAXOPTVAL; }
+// Field GForceFont information
+/* Enumeration options for field GForceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GForceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GForceFontIsValid( uint8_t CurrentGForceFont ) { return CurrentGForceFont <= ONSCREENDISPLAYPAGESETTINGS4_GFORCEFONT_MAXOPTVAL; }
+// Field GForceAlign information
+/* Enumeration options for field GForceAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GForceAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GForceAlignIsValid( uint8_t CurrentGForceAlign ) { return CurrentGForceAlign <= ONSCREENDISPLAYPAGESETTINGS4_GFORCEALIGN_MAXOPTVAL; }
+// Field GpsStatus information
+/* Enumeration options for field GpsStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsStatusOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4GpsStatusIsValid( uint8_t CurrentGpsStatus ) { return CurrentGpsStatus <= ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUS_MAXOPTVAL; }
+// Field GpsStatusFont information
+/* Enumeration options for field GpsStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsStatusFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsStatusFontIsValid( uint8_t CurrentGpsStatusFont ) { return CurrentGpsStatusFont <= ONSCREENDISPLAYPAGESETTINGS4_GPSSTATUSFONT_MAXOPTVAL; }
+// Field GpsLat information
+/* Enumeration options for field GpsLat */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLAT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLAT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLatOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLAT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLAT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4GpsLatIsValid( uint8_t CurrentGpsLat ) { return CurrentGpsLat <= ONSCREENDISPLAYPAGESETTINGS4_GPSLAT_MAXOPTVAL; }
+// Field GpsLatFont information
+/* Enumeration options for field GpsLatFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLatFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsLatFontIsValid( uint8_t CurrentGpsLatFont ) { return CurrentGpsLatFont <= ONSCREENDISPLAYPAGESETTINGS4_GPSLATFONT_MAXOPTVAL; }
+// Field GpsLatAlign information
+/* Enumeration options for field GpsLatAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLatAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsLatAlignIsValid( uint8_t CurrentGpsLatAlign ) { return CurrentGpsLatAlign <= ONSCREENDISPLAYPAGESETTINGS4_GPSLATALIGN_MAXOPTVAL; }
+// Field GpsLon information
+/* Enumeration options for field GpsLon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLonOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4GpsLonIsValid( uint8_t CurrentGpsLon ) { return CurrentGpsLon <= ONSCREENDISPLAYPAGESETTINGS4_GPSLON_MAXOPTVAL; }
+// Field GpsLonFont information
+/* Enumeration options for field GpsLonFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLonFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsLonFontIsValid( uint8_t CurrentGpsLonFont ) { return CurrentGpsLonFont <= ONSCREENDISPLAYPAGESETTINGS4_GPSLONFONT_MAXOPTVAL; }
+// Field GpsLonAlign information
+/* Enumeration options for field GpsLonAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsLonAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsLonAlignIsValid( uint8_t CurrentGpsLonAlign ) { return CurrentGpsLonAlign <= ONSCREENDISPLAYPAGESETTINGS4_GPSLONALIGN_MAXOPTVAL; }
+// Field GpsMgrs information
+/* Enumeration options for field GpsMgrs */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSMGRS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_GPSMGRS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsMgrsOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRS_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4GpsMgrsIsValid( uint8_t CurrentGpsMgrs ) { return CurrentGpsMgrs <= ONSCREENDISPLAYPAGESETTINGS4_GPSMGRS_MAXOPTVAL; }
+// Field GpsMgrsFont information
+/* Enumeration options for field GpsMgrsFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsMgrsFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsMgrsFontIsValid( uint8_t CurrentGpsMgrsFont ) { return CurrentGpsMgrsFont <= ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSFONT_MAXOPTVAL; }
+// Field GpsMgrsAlign information
+/* Enumeration options for field GpsMgrsAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4GpsMgrsAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4GpsMgrsAlignIsValid( uint8_t CurrentGpsMgrsAlign ) { return CurrentGpsMgrsAlign <= ONSCREENDISPLAYPAGESETTINGS4_GPSMGRSALIGN_MAXOPTVAL; }
+// Field HomeDistance information
+/* Enumeration options for field HomeDistance */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4HomeDistanceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4HomeDistanceIsValid( uint8_t CurrentHomeDistance ) { return CurrentHomeDistance <= ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCE_MAXOPTVAL; }
+// Field HomeDistanceFont information
+/* Enumeration options for field HomeDistanceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4HomeDistanceFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4HomeDistanceFontIsValid( uint8_t CurrentHomeDistanceFont ) { return CurrentHomeDistanceFont <= ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCEFONT_MAXOPTVAL; }
+// Field HomeDistanceShowIcon information
+/* Enumeration options for field HomeDistanceShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCESHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCESHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4HomeDistanceShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCESHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCESHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4HomeDistanceShowIconIsValid( uint8_t CurrentHomeDistanceShowIcon ) { return CurrentHomeDistanceShowIcon <= ONSCREENDISPLAYPAGESETTINGS4_HOMEDISTANCESHOWICON_MAXOPTVAL; }
+// Field HomeArrow information
+/* Enumeration options for field HomeArrow */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_HOMEARROW_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_HOMEARROW_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4HomeArrowOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEARROW_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_HOMEARROW_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4HomeArrowIsValid( uint8_t CurrentHomeArrow ) { return CurrentHomeArrow <= ONSCREENDISPLAYPAGESETTINGS4_HOMEARROW_MAXOPTVAL; }
+// Field Map information
+/* Enumeration options for field Map */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_MAP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_MAP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4MapOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_MAP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_MAP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4MapIsValid( uint8_t CurrentMap ) { return CurrentMap <= ONSCREENDISPLAYPAGESETTINGS4_MAP_MAXOPTVAL; }
+// Field MapCenterMode information
+/* Enumeration options for field MapCenterMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_MAPCENTERMODE_UAV=0, ONSCREENDISPLAYPAGESETTINGS4_MAPCENTERMODE_HOME=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4MapCenterModeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPCENTERMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPCENTERMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4MapCenterModeIsValid( uint8_t CurrentMapCenterMode ) { return CurrentMapCenterMode <= ONSCREENDISPLAYPAGESETTINGS4_MAPCENTERMODE_MAXOPTVAL; }
+// Field MapShowWp information
+/* Enumeration options for field MapShowWp */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWWP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWWP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4MapShowWpOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWWP_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWWP_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4MapShowWpIsValid( uint8_t CurrentMapShowWp ) { return CurrentMapShowWp <= ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWWP_MAXOPTVAL; }
+// Field MapShowUavHome information
+/* Enumeration options for field MapShowUavHome */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWUAVHOME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWUAVHOME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4MapShowUavHomeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWUAVHOME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWUAVHOME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4MapShowUavHomeIsValid( uint8_t CurrentMapShowUavHome ) { return CurrentMapShowUavHome <= ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWUAVHOME_MAXOPTVAL; }
+// Field MapShowTablet information
+/* Enumeration options for field MapShowTablet */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWTABLET_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWTABLET_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4MapShowTabletOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWTABLET_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWTABLET_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4MapShowTabletIsValid( uint8_t CurrentMapShowTablet ) { return CurrentMapShowTablet <= ONSCREENDISPLAYPAGESETTINGS4_MAPSHOWTABLET_MAXOPTVAL; }
+// Field Rssi information
+/* Enumeration options for field Rssi */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_RSSI_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_RSSI_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4RssiOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSI_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSI_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4RssiIsValid( uint8_t CurrentRssi ) { return CurrentRssi <= ONSCREENDISPLAYPAGESETTINGS4_RSSI_MAXOPTVAL; }
+// Field RssiFont information
+/* Enumeration options for field RssiFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4RssiFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4RssiFontIsValid( uint8_t CurrentRssiFont ) { return CurrentRssiFont <= ONSCREENDISPLAYPAGESETTINGS4_RSSIFONT_MAXOPTVAL; }
+// Field RssiShowIcon information
+/* Enumeration options for field RssiShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_RSSISHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_RSSISHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4RssiShowIconOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSISHOWICON_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_RSSISHOWICON_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4RssiShowIconIsValid( uint8_t CurrentRssiShowIcon ) { return CurrentRssiShowIcon <= ONSCREENDISPLAYPAGESETTINGS4_RSSISHOWICON_MAXOPTVAL; }
+// Field SpeedScale information
+/* Enumeration options for field SpeedScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedScaleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4SpeedScaleIsValid( uint8_t CurrentSpeedScale ) { return CurrentSpeedScale <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALE_MAXOPTVAL; }
+// Field SpeedScaleAlign information
+/* Enumeration options for field SpeedScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedScaleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALEALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALEALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4SpeedScaleAlignIsValid( uint8_t CurrentSpeedScaleAlign ) { return CurrentSpeedScaleAlign <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALEALIGN_MAXOPTVAL; }
+// Field SpeedScaleSource information
+/* Enumeration options for field SpeedScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedScaleSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4SpeedScaleSourceIsValid( uint8_t CurrentSpeedScaleSource ) { return CurrentSpeedScaleSource <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDSCALESOURCE_MAXOPTVAL; }
+// Field SpeedNumeric information
+/* Enumeration options for field SpeedNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedNumericOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERIC_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERIC_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4SpeedNumericIsValid( uint8_t CurrentSpeedNumeric ) { return CurrentSpeedNumeric <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERIC_MAXOPTVAL; }
+// Field SpeedNumericFont information
+/* Enumeration options for field SpeedNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedNumericFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4SpeedNumericFontIsValid( uint8_t CurrentSpeedNumericFont ) { return CurrentSpeedNumericFont <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICFONT_MAXOPTVAL; }
+// Field SpeedNumericAlign information
+/* Enumeration options for field SpeedNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedNumericAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICALIGN_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICALIGN_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4SpeedNumericAlignIsValid( uint8_t CurrentSpeedNumericAlign ) { return CurrentSpeedNumericAlign <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICALIGN_MAXOPTVAL; }
+// Field SpeedNumericSource information
+/* Enumeration options for field SpeedNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4SpeedNumericSourceOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4SpeedNumericSourceIsValid( uint8_t CurrentSpeedNumericSource ) { return CurrentSpeedNumericSource <= ONSCREENDISPLAYPAGESETTINGS4_SPEEDNUMERICSOURCE_MAXOPTVAL; }
+// Field Time information
+/* Enumeration options for field Time */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_TIME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_TIME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4TimeOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_TIME_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_TIME_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4TimeIsValid( uint8_t CurrentTime ) { return CurrentTime <= ONSCREENDISPLAYPAGESETTINGS4_TIME_MAXOPTVAL; }
+// Field TimeFont information
+/* Enumeration options for field TimeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4TimeFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4TimeFontIsValid( uint8_t CurrentTimeFont ) { return CurrentTimeFont <= ONSCREENDISPLAYPAGESETTINGS4_TIMEFONT_MAXOPTVAL; }
+// Field TimeAlign information
+/* Enumeration options for field TimeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4TimeAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4TimeAlignIsValid( uint8_t CurrentTimeAlign ) { return CurrentTimeAlign <= ONSCREENDISPLAYPAGESETTINGS4_TIMEALIGN_MAXOPTVAL; }
+// Field Throttle information
+/* Enumeration options for field Throttle */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_THROTTLE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_THROTTLE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4ThrottleOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLE_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4ThrottleIsValid( uint8_t CurrentThrottle ) { return CurrentThrottle <= ONSCREENDISPLAYPAGESETTINGS4_THROTTLE_MAXOPTVAL; }
+// Field ThrottleFont information
+/* Enumeration options for field ThrottleFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ThrottleFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ThrottleFontIsValid( uint8_t CurrentThrottleFont ) { return CurrentThrottleFont <= ONSCREENDISPLAYPAGESETTINGS4_THROTTLEFONT_MAXOPTVAL; }
+// Field ThrottleAlign information
+/* Enumeration options for field ThrottleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4ThrottleAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4ThrottleAlignIsValid( uint8_t CurrentThrottleAlign ) { return CurrentThrottleAlign <= ONSCREENDISPLAYPAGESETTINGS4_THROTTLEALIGN_MAXOPTVAL; }
+// Field VTXFreq information
+/* Enumeration options for field VTXFreq */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXFREQ_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQ_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXFreqOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQ_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQ_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4VTXFreqIsValid( uint8_t CurrentVTXFreq ) { return CurrentVTXFreq <= ONSCREENDISPLAYPAGESETTINGS4_VTXFREQ_MAXOPTVAL; }
+// Field VTXFreqFont information
+/* Enumeration options for field VTXFreqFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXFreqFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4VTXFreqFontIsValid( uint8_t CurrentVTXFreqFont ) { return CurrentVTXFreqFont <= ONSCREENDISPLAYPAGESETTINGS4_VTXFREQFONT_MAXOPTVAL; }
+// Field VTXFreqAlign information
+/* Enumeration options for field VTXFreqAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXFreqAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4VTXFreqAlignIsValid( uint8_t CurrentVTXFreqAlign ) { return CurrentVTXFreqAlign <= ONSCREENDISPLAYPAGESETTINGS4_VTXFREQALIGN_MAXOPTVAL; }
+// Field VTXFreqShowUnit information
+/* Enumeration options for field VTXFreqShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXFREQSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_VTXFREQSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXFreqShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXFREQSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4VTXFreqShowUnitIsValid( uint8_t CurrentVTXFreqShowUnit ) { return CurrentVTXFreqShowUnit <= ONSCREENDISPLAYPAGESETTINGS4_VTXFREQSHOWUNIT_MAXOPTVAL; }
+// Field VTXPower information
+/* Enumeration options for field VTXPower */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXPOWER_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWER_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXPowerOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWER_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWER_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4VTXPowerIsValid( uint8_t CurrentVTXPower ) { return CurrentVTXPower <= ONSCREENDISPLAYPAGESETTINGS4_VTXPOWER_MAXOPTVAL; }
+// Field VTXPowerFont information
+/* Enumeration options for field VTXPowerFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXPowerFontOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4VTXPowerFontIsValid( uint8_t CurrentVTXPowerFont ) { return CurrentVTXPowerFont <= ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERFONT_MAXOPTVAL; }
+// Field VTXPowerAlign information
+/* Enumeration options for field VTXPowerAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXPowerAlignOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_MAXOPTVAL 2
+static inline bool OnScreenDisplayPageSettings4VTXPowerAlignIsValid( uint8_t CurrentVTXPowerAlign ) { return CurrentVTXPowerAlign <= ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERALIGN_MAXOPTVAL; }
+// Field VTXPowerShowUnit information
+/* Enumeration options for field VTXPowerShowUnit */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERSHOWUNIT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERSHOWUNIT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings4VTXPowerShowUnitOptions;
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERSHOWUNIT_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERSHOWUNIT_MAXOPTVAL 1
+static inline bool OnScreenDisplayPageSettings4VTXPowerShowUnitIsValid( uint8_t CurrentVTXPowerShowUnit ) { return CurrentVTXPowerShowUnit <= ONSCREENDISPLAYPAGESETTINGS4_VTXPOWERSHOWUNIT_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void OnScreenDisplayPageSettings4AlarmPosXSet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings4AlarmPosXGet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings4AlarmPosYSet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings4AlarmPosYGet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings4AltitudeScalePosSet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings4AltitudeScalePosGet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings4AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings4AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings4AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings4AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings4ArmStatusPosXSet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings4ArmStatusPosXGet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings4ArmStatusPosYSet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings4ArmStatusPosYGet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings4BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings4BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings4BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings4BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings4BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings4BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings4BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings4BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings4BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings4BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings4BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings4BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings4BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings4BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings4BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings4BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings4ClimbRatePosXSet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings4ClimbRatePosXGet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings4ClimbRatePosYSet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings4ClimbRatePosYGet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings4CompassPosSet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings4CompassPosGet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings4CpuPosXSet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings4CpuPosXGet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings4CpuPosYSet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings4CpuPosYGet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings4CustomTextPosXSet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings4CustomTextPosXGet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings4CustomTextPosYSet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings4CustomTextPosYGet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings4FlightModePosXSet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings4FlightModePosXGet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings4FlightModePosYSet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings4FlightModePosYGet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings4GForcePosXSet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings4GForcePosXGet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings4GForcePosYSet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings4GForcePosYGet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings4GpsStatusPosXSet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings4GpsStatusPosXGet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings4GpsStatusPosYSet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings4GpsStatusPosYGet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings4GpsLatPosXSet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings4GpsLatPosXGet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings4GpsLatPosYSet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings4GpsLatPosYGet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings4GpsLonPosXSet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings4GpsLonPosXGet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings4GpsLonPosYSet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings4GpsLonPosYGet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings4GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings4GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings4GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings4GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings4HomeDistancePosXSet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings4HomeDistancePosXGet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings4HomeDistancePosYSet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings4HomeDistancePosYGet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings4HomeArrowPosXSet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings4HomeArrowPosXGet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings4HomeArrowPosYSet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings4HomeArrowPosYGet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings4MapWidthMetersSet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings4MapWidthMetersGet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings4MapWidthPixelsSet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings4MapWidthPixelsGet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings4MapHeightMetersSet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings4MapHeightMetersGet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings4MapHeightPixelsSet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings4MapHeightPixelsGet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings4RssiPosXSet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings4RssiPosXGet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings4RssiPosYSet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings4RssiPosYGet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings4SpeedScalePosSet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings4SpeedScalePosGet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings4SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings4SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings4SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings4SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings4TimePosXSet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings4TimePosXGet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings4TimePosYSet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings4TimePosYGet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings4ThrottlePosXSet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings4ThrottlePosXGet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings4ThrottlePosYSet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings4ThrottlePosYGet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings4VTXFreqPosXSet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettings4VTXFreqPosXGet( int16_t *NewVTXFreqPosX );
+extern void OnScreenDisplayPageSettings4VTXFreqPosYSet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettings4VTXFreqPosYGet( int16_t *NewVTXFreqPosY );
+extern void OnScreenDisplayPageSettings4VTXPowerPosXSet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettings4VTXPowerPosXGet( int16_t *NewVTXPowerPosX );
+extern void OnScreenDisplayPageSettings4VTXPowerPosYSet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettings4VTXPowerPosYGet( int16_t *NewVTXPowerPosY );
+extern void OnScreenDisplayPageSettings4AlarmSet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings4AlarmGet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings4AlarmFontSet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings4AlarmFontGet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings4AlarmAlignSet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings4AlarmAlignGet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings4AltitudeScaleSet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings4AltitudeScaleGet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings4AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings4AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings4AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings4AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings4AltitudeNumericSet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings4AltitudeNumericGet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings4AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings4AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings4AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings4AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings4AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings4AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings4ArmStatusSet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings4ArmStatusGet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings4ArmStatusFontSet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings4ArmStatusFontGet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings4ArmStatusAlignSet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings4ArmStatusAlignGet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonSet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonGet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings4ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings4BatteryVoltSet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings4BatteryVoltGet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings4BatteryVoltFontSet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings4BatteryVoltFontGet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings4BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings4BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings4BatteryCurrentSet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings4BatteryCurrentGet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings4BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings4BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings4BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings4BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings4BatteryConsumedSet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings4BatteryConsumedGet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings4BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings4BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings4BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings4BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings4BatteryChargeStateSet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings4BatteryChargeStateGet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings4CenterMarkSet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings4CenterMarkGet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings4ClimbRateSet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings4ClimbRateGet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings4ClimbRateFontSet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings4ClimbRateFontGet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings4ClimbRateAlignSet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings4ClimbRateAlignGet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings4CompassSet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings4CompassGet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings4CompassHomeDirSet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings4CompassHomeDirGet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings4CpuSet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings4CpuGet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings4CpuFontSet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings4CpuFontGet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings4CpuAlignSet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings4CpuAlignGet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings4CustomTextSet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings4CustomTextGet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings4CustomTextFontSet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings4CustomTextFontGet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings4CustomTextAlignSet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings4CustomTextAlignGet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings4FlightModeSet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings4FlightModeGet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings4FlightModeFontSet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings4FlightModeFontGet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings4FlightModeAlignSet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings4FlightModeAlignGet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings4GForceSet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings4GForceGet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings4GForceFontSet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings4GForceFontGet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings4GForceAlignSet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings4GForceAlignGet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings4GpsStatusSet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings4GpsStatusGet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings4GpsStatusFontSet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings4GpsStatusFontGet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings4GpsLatSet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings4GpsLatGet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings4GpsLatFontSet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings4GpsLatFontGet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings4GpsLatAlignSet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings4GpsLatAlignGet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings4GpsLonSet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings4GpsLonGet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings4GpsLonFontSet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings4GpsLonFontGet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings4GpsLonAlignSet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings4GpsLonAlignGet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings4GpsMgrsSet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings4GpsMgrsGet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings4GpsMgrsFontSet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings4GpsMgrsFontGet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings4GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings4GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings4HomeDistanceSet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings4HomeDistanceGet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings4HomeDistanceFontSet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings4HomeDistanceFontGet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings4HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings4HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings4HomeArrowSet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings4HomeArrowGet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings4MapSet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings4MapGet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings4MapCenterModeSet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings4MapCenterModeGet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings4MapShowWpSet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings4MapShowWpGet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings4MapShowUavHomeSet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings4MapShowUavHomeGet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings4MapShowTabletSet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings4MapShowTabletGet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings4RssiSet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings4RssiGet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings4RssiFontSet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings4RssiFontGet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings4RssiShowIconSet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings4RssiShowIconGet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings4SpeedScaleSet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings4SpeedScaleGet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings4SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings4SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings4SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings4SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings4SpeedNumericSet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings4SpeedNumericGet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings4SpeedNumericFontSet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings4SpeedNumericFontGet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings4SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings4SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings4SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings4SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings4TimeSet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings4TimeGet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings4TimeFontSet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings4TimeFontGet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings4TimeAlignSet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings4TimeAlignGet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings4ThrottleSet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings4ThrottleGet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings4ThrottleFontSet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings4ThrottleFontGet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings4ThrottleAlignSet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettings4ThrottleAlignGet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettings4VTXFreqSet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettings4VTXFreqGet( uint8_t *NewVTXFreq );
+extern void OnScreenDisplayPageSettings4VTXFreqFontSet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettings4VTXFreqFontGet( uint8_t *NewVTXFreqFont );
+extern void OnScreenDisplayPageSettings4VTXFreqAlignSet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettings4VTXFreqAlignGet( uint8_t *NewVTXFreqAlign );
+extern void OnScreenDisplayPageSettings4VTXFreqShowUnitSet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettings4VTXFreqShowUnitGet( uint8_t *NewVTXFreqShowUnit );
+extern void OnScreenDisplayPageSettings4VTXPowerSet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettings4VTXPowerGet( uint8_t *NewVTXPower );
+extern void OnScreenDisplayPageSettings4VTXPowerFontSet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettings4VTXPowerFontGet( uint8_t *NewVTXPowerFont );
+extern void OnScreenDisplayPageSettings4VTXPowerAlignSet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettings4VTXPowerAlignGet( uint8_t *NewVTXPowerAlign );
+extern void OnScreenDisplayPageSettings4VTXPowerShowUnitSet( uint8_t *NewVTXPowerShowUnit );
+extern void OnScreenDisplayPageSettings4VTXPowerShowUnitGet( uint8_t *NewVTXPowerShowUnit );
+
+
+#endif // ONSCREENDISPLAYPAGESETTINGS4_H
+
+/**
+ * @}
+ * @}
+ */
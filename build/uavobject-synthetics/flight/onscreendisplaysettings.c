@@ -0,0 +1,307 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplaySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaysettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const OnScreenDisplaySettingsData defaultData = {
+	.OSDEnabled = 1,
+	.Units = 0,
+	.PALWhite = 110,
+	.PALBlack = 35,
+	.NTSCWhite = 110,
+	.NTSCBlack = 20,
+	.XOffset = 0,
+	.YOffset = 0,
+	.NumPages = 2,
+	.PageSwitch = 0,
+	.PageConfig = { 0, 0, 0, 0, 0, 0 },
+	.DisableMenuWhenArmed = 1,
+	.RssiWarnThreshold = 50,
+	.CustomText = { 100, 82, 111, 110, 105, 110, 0, 0, 0, 0 },
+	.StatsDisplayDuration = 2,
+	.PALXScale = 7,
+	.NTSCXScale = 8,
+	.ThreeDMode = 0,
+	.ThreeDRightEyeXShift = 30,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplaySettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYSETTINGS_OBJID,
+			ONSCREENDISPLAYSETTINGS_ISSINGLEINST, ONSCREENDISPLAYSETTINGS_ISSETTINGS, ONSCREENDISPLAYSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplaySettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplaySettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplaySettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplaySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplaySettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplaySettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplaySettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplaySettingsOSDEnabledSet( uint8_t *NewOSDEnabled )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewOSDEnabled, offsetof( OnScreenDisplaySettingsData, OSDEnabled), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsOSDEnabledGet( uint8_t *NewOSDEnabled )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewOSDEnabled, offsetof( OnScreenDisplaySettingsData, OSDEnabled), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsUnitsSet( uint8_t *NewUnits )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewUnits, offsetof( OnScreenDisplaySettingsData, Units), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsUnitsGet( uint8_t *NewUnits )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewUnits, offsetof( OnScreenDisplaySettingsData, Units), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALWhiteSet( uint8_t *NewPALWhite )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALWhite, offsetof( OnScreenDisplaySettingsData, PALWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALWhiteGet( uint8_t *NewPALWhite )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALWhite, offsetof( OnScreenDisplaySettingsData, PALWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALBlackSet( uint8_t *NewPALBlack )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALBlack, offsetof( OnScreenDisplaySettingsData, PALBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALBlackGet( uint8_t *NewPALBlack )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALBlack, offsetof( OnScreenDisplaySettingsData, PALBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCWhiteSet( uint8_t *NewNTSCWhite )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCWhite, offsetof( OnScreenDisplaySettingsData, NTSCWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCWhiteGet( uint8_t *NewNTSCWhite )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCWhite, offsetof( OnScreenDisplaySettingsData, NTSCWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCBlackSet( uint8_t *NewNTSCBlack )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCBlack, offsetof( OnScreenDisplaySettingsData, NTSCBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCBlackGet( uint8_t *NewNTSCBlack )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCBlack, offsetof( OnScreenDisplaySettingsData, NTSCBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsXOffsetSet( int8_t *NewXOffset )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewXOffset, offsetof( OnScreenDisplaySettingsData, XOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsXOffsetGet( int8_t *NewXOffset )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewXOffset, offsetof( OnScreenDisplaySettingsData, XOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsYOffsetSet( int8_t *NewYOffset )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewYOffset, offsetof( OnScreenDisplaySettingsData, YOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsYOffsetGet( int8_t *NewYOffset )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewYOffset, offsetof( OnScreenDisplaySettingsData, YOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsNumPagesSet( int8_t *NewNumPages )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNumPages, offsetof( OnScreenDisplaySettingsData, NumPages), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsNumPagesGet( int8_t *NewNumPages )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNumPages, offsetof( OnScreenDisplaySettingsData, NumPages), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsPageSwitchSet( uint8_t *NewPageSwitch )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageSwitch, offsetof( OnScreenDisplaySettingsData, PageSwitch), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageSwitchGet( uint8_t *NewPageSwitch )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageSwitch, offsetof( OnScreenDisplaySettingsData, PageSwitch), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageConfigSet( uint8_t *NewPageConfig )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageConfig, offsetof( OnScreenDisplaySettingsData, PageConfig), 6*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageConfigGet( uint8_t *NewPageConfig )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageConfig, offsetof( OnScreenDisplaySettingsData, PageConfig), 6*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsDisableMenuWhenArmedSet( uint8_t *NewDisableMenuWhenArmed )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewDisableMenuWhenArmed, offsetof( OnScreenDisplaySettingsData, DisableMenuWhenArmed), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsDisableMenuWhenArmedGet( uint8_t *NewDisableMenuWhenArmed )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewDisableMenuWhenArmed, offsetof( OnScreenDisplaySettingsData, DisableMenuWhenArmed), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsRssiWarnThresholdSet( uint8_t *NewRssiWarnThreshold )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewRssiWarnThreshold, offsetof( OnScreenDisplaySettingsData, RssiWarnThreshold), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsRssiWarnThresholdGet( uint8_t *NewRssiWarnThreshold )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewRssiWarnThreshold, offsetof( OnScreenDisplaySettingsData, RssiWarnThreshold), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsCustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsCustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsStatsDisplayDurationSet( uint8_t *NewStatsDisplayDuration )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewStatsDisplayDuration, offsetof( OnScreenDisplaySettingsData, StatsDisplayDuration), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsStatsDisplayDurationGet( uint8_t *NewStatsDisplayDuration )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewStatsDisplayDuration, offsetof( OnScreenDisplaySettingsData, StatsDisplayDuration), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALXScaleSet( uint8_t *NewPALXScale )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALXScale, offsetof( OnScreenDisplaySettingsData, PALXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALXScaleGet( uint8_t *NewPALXScale )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALXScale, offsetof( OnScreenDisplaySettingsData, PALXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCXScaleSet( uint8_t *NewNTSCXScale )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCXScale, offsetof( OnScreenDisplaySettingsData, NTSCXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCXScaleGet( uint8_t *NewNTSCXScale )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCXScale, offsetof( OnScreenDisplaySettingsData, NTSCXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDModeSet( uint8_t *NewThreeDMode )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDMode, offsetof( OnScreenDisplaySettingsData, ThreeDMode), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDModeGet( uint8_t *NewThreeDMode )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDMode, offsetof( OnScreenDisplaySettingsData, ThreeDMode), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDRightEyeXShiftSet( uint8_t *NewThreeDRightEyeXShift )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDRightEyeXShift, offsetof( OnScreenDisplaySettingsData, ThreeDRightEyeXShift), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDRightEyeXShiftGet( uint8_t *NewThreeDRightEyeXShift )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDRightEyeXShift, offsetof( OnScreenDisplaySettingsData, ThreeDRightEyeXShift), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,229 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup OnScreenDisplaySettings OnScreenDisplaySettings
+ * @brief On Screen Display Settings
+ *
+ *
+ * @file       onscreendisplaysettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the OnScreenDisplaySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ONSCREENDISPLAYSETTINGS_H
+#define ONSCREENDISPLAYSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ONSCREENDISPLAYSETTINGS_OBJID 0xF630B000
+#define ONSCREENDISPLAYSETTINGS_ISSINGLEINST 1
+#define ONSCREENDISPLAYSETTINGS_ISSETTINGS 1
+#define ONSCREENDISPLAYSETTINGS_NUMBYTES 33
+
+// Generic interface functions
+int32_t OnScreenDisplaySettingsInitialize();
+UAVObjHandle OnScreenDisplaySettingsHandle();
+void OnScreenDisplaySettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t OSDEnabled;
+    uint8_t Units;
+    uint8_t PALWhite;
+    uint8_t PALBlack;
+    uint8_t NTSCWhite;
+    uint8_t NTSCBlack;
+    int8_t XOffset;
+    int8_t YOffset;
+    int8_t NumPages;
+    uint8_t PageSwitch;
+    uint8_t PageConfig[6];
+    uint8_t DisableMenuWhenArmed;
+    uint8_t RssiWarnThreshold;
+    uint8_t CustomText[10];
+    uint8_t StatsDisplayDuration;
+    uint8_t PALXScale;
+    uint8_t NTSCXScale;
+    uint8_t ThreeDMode;
+    uint8_t ThreeDRightEyeXShift;
+
+} __attribute__((packed)) __attribute__((aligned(4))) OnScreenDisplaySettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function OnScreenDisplaySettingsGet(dataOut)
+ * @brief Populate a OnScreenDisplaySettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t OnScreenDisplaySettingsGet(OnScreenDisplaySettingsData *dataOut) { return UAVObjGetData(OnScreenDisplaySettingsHandle(), dataOut); }
+
+static inline int32_t OnScreenDisplaySettingsSet(const OnScreenDisplaySettingsData *dataIn) { return UAVObjSetData(OnScreenDisplaySettingsHandle(), dataIn); }
+
+static inline int32_t OnScreenDisplaySettingsInstGet(uint16_t instId, OnScreenDisplaySettingsData *dataOut) { return UAVObjGetInstanceData(OnScreenDisplaySettingsHandle(), instId, dataOut); }
+
+static inline int32_t OnScreenDisplaySettingsInstSet(uint16_t instId, const OnScreenDisplaySettingsData *dataIn) { return UAVObjSetInstanceData(OnScreenDisplaySettingsHandle(), instId, dataIn); }
+
+static inline int32_t OnScreenDisplaySettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(OnScreenDisplaySettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplaySettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(OnScreenDisplaySettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplaySettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(OnScreenDisplaySettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplaySettingsConnectCopy(volatile OnScreenDisplaySettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	OnScreenDisplaySettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(OnScreenDisplaySettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t OnScreenDisplaySettingsCreateInstance() { return UAVObjCreateInstance(OnScreenDisplaySettingsHandle(), &OnScreenDisplaySettingsSetDefaults); }
+
+static inline void OnScreenDisplaySettingsUpdated() { UAVObjUpdated(OnScreenDisplaySettingsHandle()); }
+
+static inline void OnScreenDisplaySettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(OnScreenDisplaySettingsHandle(), instId); }
+
+static inline int32_t OnScreenDisplaySettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(OnScreenDisplaySettingsHandle(), dataOut); }
+
+static inline int32_t OnScreenDisplaySettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(OnScreenDisplaySettingsHandle(), dataIn); }
+
+static inline int8_t OnScreenDisplaySettingsReadOnly() { return UAVObjReadOnly(OnScreenDisplaySettingsHandle()); }
+
+static inline uint16_t OnScreenDisplaySettingsGetNumInstances(){ return UAVObjGetNumInstances(OnScreenDisplaySettingsHandle()); }
+
+static inline uint32_t OnScreenDisplaySettingsGetNumBytes(){ return UAVObjGetNumBytes(OnScreenDisplaySettingsHandle()); }
+
+// Field information
+// Field OSDEnabled information
+/* Enumeration options for field OSDEnabled */
+typedef enum { ONSCREENDISPLAYSETTINGS_OSDENABLED_DISABLED=0, ONSCREENDISPLAYSETTINGS_OSDENABLED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplaySettingsOSDEnabledOptions;
+#define ONSCREENDISPLAYSETTINGS_OSDENABLED_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYSETTINGS_OSDENABLED_MAXOPTVAL 1
+static inline bool OnScreenDisplaySettingsOSDEnabledIsValid( uint8_t CurrentOSDEnabled ) { return CurrentOSDEnabled <= ONSCREENDISPLAYSETTINGS_OSDENABLED_MAXOPTVAL; }
+// Field Units information
+/* Enumeration options for field Units */
+typedef enum { ONSCREENDISPLAYSETTINGS_UNITS_METRIC=0, ONSCREENDISPLAYSETTINGS_UNITS_IMPERIAL=1 }  __attribute__((packed)) OnScreenDisplaySettingsUnitsOptions;
+#define ONSCREENDISPLAYSETTINGS_UNITS_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYSETTINGS_UNITS_MAXOPTVAL 1
+static inline bool OnScreenDisplaySettingsUnitsIsValid( uint8_t CurrentUnits ) { return CurrentUnits <= ONSCREENDISPLAYSETTINGS_UNITS_MAXOPTVAL; }
+// Field PALWhite information
+// Field PALBlack information
+// Field NTSCWhite information
+// Field NTSCBlack information
+// Field XOffset information
+// Field YOffset information
+// Field NumPages information
+// Field PageSwitch information
+/* Enumeration options for field PageSwitch */
+typedef enum { ONSCREENDISPLAYSETTINGS_PAGESWITCH_ACCESSORY0=0, ONSCREENDISPLAYSETTINGS_PAGESWITCH_ACCESSORY1=1, ONSCREENDISPLAYSETTINGS_PAGESWITCH_ACCESSORY2=2 }  __attribute__((packed)) OnScreenDisplaySettingsPageSwitchOptions;
+#define ONSCREENDISPLAYSETTINGS_PAGESWITCH_GLOBAL_MAXOPTVAL 2
+#define ONSCREENDISPLAYSETTINGS_PAGESWITCH_MAXOPTVAL 2
+static inline bool OnScreenDisplaySettingsPageSwitchIsValid( uint8_t CurrentPageSwitch ) { return CurrentPageSwitch <= ONSCREENDISPLAYSETTINGS_PAGESWITCH_MAXOPTVAL; }
+// Field PageConfig information
+/* Enumeration options for field PageConfig */
+typedef enum { ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM1=0, ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM2=1, ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM3=2, ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM4=3, ONSCREENDISPLAYSETTINGS_PAGECONFIG_MENU=4, ONSCREENDISPLAYSETTINGS_PAGECONFIG_STATISTICS=5, ONSCREENDISPLAYSETTINGS_PAGECONFIG_OFF=6 }  __attribute__((packed)) OnScreenDisplaySettingsPageConfigOptions;
+#define ONSCREENDISPLAYSETTINGS_PAGECONFIG_GLOBAL_MAXOPTVAL 6
+#define ONSCREENDISPLAYSETTINGS_PAGECONFIG_MAXOPTVAL 6
+static inline bool OnScreenDisplaySettingsPageConfigIsValid( uint8_t CurrentPageConfig ) { return CurrentPageConfig <= ONSCREENDISPLAYSETTINGS_PAGECONFIG_MAXOPTVAL; }
+#define ONSCREENDISPLAYSETTINGS_PAGECONFIG_NUMELEM 6
+// Field DisableMenuWhenArmed information
+/* Enumeration options for field DisableMenuWhenArmed */
+typedef enum { ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_DISABLED=0, ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplaySettingsDisableMenuWhenArmedOptions;
+#define ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_MAXOPTVAL 1
+static inline bool OnScreenDisplaySettingsDisableMenuWhenArmedIsValid( uint8_t CurrentDisableMenuWhenArmed ) { return CurrentDisableMenuWhenArmed <= ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_MAXOPTVAL; }
+// Field RssiWarnThreshold information
+// Field CustomText information
+#define ONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM 10
+// Field StatsDisplayDuration information
+/* Enumeration options for field StatsDisplayDuration */
+typedef enum { ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_OFF=0, ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_10S=1, ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_20S=2, ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_30S=3 }  __attribute__((packed)) OnScreenDisplaySettingsStatsDisplayDurationOptions;
+#define ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_GLOBAL_MAXOPTVAL 3
+#define ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_MAXOPTVAL 3
+static inline bool OnScreenDisplaySettingsStatsDisplayDurationIsValid( uint8_t CurrentStatsDisplayDuration ) { return CurrentStatsDisplayDuration <= ONSCREENDISPLAYSETTINGS_STATSDISPLAYDURATION_MAXOPTVAL; }
+// Field PALXScale information
+// Field NTSCXScale information
+// Field ThreeDMode information
+/* Enumeration options for field ThreeDMode */
+typedef enum { ONSCREENDISPLAYSETTINGS_THREEDMODE_DISABLED=0, ONSCREENDISPLAYSETTINGS_THREEDMODE_SBS3D=1 }  __attribute__((packed)) OnScreenDisplaySettingsThreeDModeOptions;
+#define ONSCREENDISPLAYSETTINGS_THREEDMODE_GLOBAL_MAXOPTVAL 1
+#define ONSCREENDISPLAYSETTINGS_THREEDMODE_MAXOPTVAL 1
+static inline bool OnScreenDisplaySettingsThreeDModeIsValid( uint8_t CurrentThreeDMode ) { return CurrentThreeDMode <= ONSCREENDISPLAYSETTINGS_THREEDMODE_MAXOPTVAL; }
+// Field ThreeDRightEyeXShift information
+
+
+// set/Get functions
+extern void OnScreenDisplaySettingsOSDEnabledSet( uint8_t *NewOSDEnabled );
+extern void OnScreenDisplaySettingsOSDEnabledGet( uint8_t *NewOSDEnabled );
+extern void OnScreenDisplaySettingsUnitsSet( uint8_t *NewUnits );
+extern void OnScreenDisplaySettingsUnitsGet( uint8_t *NewUnits );
+extern void OnScreenDisplaySettingsPALWhiteSet( uint8_t *NewPALWhite );
+extern void OnScreenDisplaySettingsPALWhiteGet( uint8_t *NewPALWhite );
+extern void OnScreenDisplaySettingsPALBlackSet( uint8_t *NewPALBlack );
+extern void OnScreenDisplaySettingsPALBlackGet( uint8_t *NewPALBlack );
+extern void OnScreenDisplaySettingsNTSCWhiteSet( uint8_t *NewNTSCWhite );
+extern void OnScreenDisplaySettingsNTSCWhiteGet( uint8_t *NewNTSCWhite );
+extern void OnScreenDisplaySettingsNTSCBlackSet( uint8_t *NewNTSCBlack );
+extern void OnScreenDisplaySettingsNTSCBlackGet( uint8_t *NewNTSCBlack );
+extern void OnScreenDisplaySettingsXOffsetSet( int8_t *NewXOffset );
+extern void OnScreenDisplaySettingsXOffsetGet( int8_t *NewXOffset );
+extern void OnScreenDisplaySettingsYOffsetSet( int8_t *NewYOffset );
+extern void OnScreenDisplaySettingsYOffsetGet( int8_t *NewYOffset );
+extern void OnScreenDisplaySettingsNumPagesSet( int8_t *NewNumPages );
+extern void OnScreenDisplaySettingsNumPagesGet( int8_t *NewNumPages );
+extern void OnScreenDisplaySettingsPageSwitchSet( uint8_t *NewPageSwitch );
+extern void OnScreenDisplaySettingsPageSwitchGet( uint8_t *NewPageSwitch );
+extern void OnScreenDisplaySettingsPageConfigSet( uint8_t *NewPageConfig );
+extern void OnScreenDisplaySettingsPageConfigGet( uint8_t *NewPageConfig );
+extern void OnScreenDisplaySettingsDisableMenuWhenArmedSet( uint8_t *NewDisableMenuWhenArmed );
+extern void OnScreenDisplaySettingsDisableMenuWhenArmedGet( uint8_t *NewDisableMenuWhenArmed );
+extern void OnScreenDisplaySettingsRssiWarnThresholdSet( uint8_t *NewRssiWarnThreshold );
+extern void OnScreenDisplaySettingsRssiWarnThresholdGet( uint8_t *NewRssiWarnThreshold );
+extern void OnScreenDisplaySettingsCustomTextSet( uint8_t *NewCustomText );
+extern void OnScreenDisplaySettingsCustomTextGet( uint8_t *NewCustomText );
+extern void OnScreenDisplaySettingsStatsDisplayDurationSet( uint8_t *NewStatsDisplayDuration );
+extern void OnScreenDisplaySettingsStatsDisplayDurationGet( uint8_t *NewStatsDisplayDuration );
+extern void OnScreenDisplaySettingsPALXScaleSet( uint8_t *NewPALXScale );
+extern void OnScreenDisplaySettingsPALXScaleGet( uint8_t *NewPALXScale );
+extern void OnScreenDisplaySettingsNTSCXScaleSet( uint8_t *NewNTSCXScale );
+extern void OnScreenDisplaySettingsNTSCXScaleGet( uint8_t *NewNTSCXScale );
+extern void OnScreenDisplaySettingsThreeDModeSet( uint8_t *NewThreeDMode );
+extern void OnScreenDisplaySettingsThreeDModeGet( uint8_t *NewThreeDMode );
+extern void OnScreenDisplaySettingsThreeDRightEyeXShiftSet( uint8_t *NewThreeDRightEyeXShift );
+extern void OnScreenDisplaySettingsThreeDRightEyeXShiftGet( uint8_t *NewThreeDRightEyeXShift );
+
+
+#endif // ONSCREENDISPLAYSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       openlrsstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OpenLRSStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: openlrsstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "openlrsstatus.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 500,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OpenLRSStatusInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(OPENLRSSTATUS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(OPENLRSSTATUS_OBJID,
+			OPENLRSSTATUS_ISSINGLEINST, OPENLRSSTATUS_ISSETTINGS, OPENLRSSTATUS_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OpenLRSStatusSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OpenLRSStatusData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OpenLRSStatusSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OpenLRSStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OpenLRSStatusSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OpenLRSStatusSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OpenLRSStatusHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OpenLRSStatusLinkQualitySet( uint16_t *NewLinkQuality )
+{
+	UAVObjSetDataField(OpenLRSStatusHandle(), (void*)NewLinkQuality, offsetof( OpenLRSStatusData, LinkQuality), sizeof(uint16_t));
+}
+void OpenLRSStatusLinkQualityGet( uint16_t *NewLinkQuality )
+{
+	UAVObjGetDataField(OpenLRSStatusHandle(), (void*)NewLinkQuality, offsetof( OpenLRSStatusData, LinkQuality), sizeof(uint16_t));
+}
+void OpenLRSStatusLastRSSISet( uint8_t *NewLastRSSI )
+{
+	UAVObjSetDataField(OpenLRSStatusHandle(), (void*)NewLastRSSI, offsetof( OpenLRSStatusData, LastRSSI), sizeof(uint8_t));
+}
+void OpenLRSStatusLastRSSIGet( uint8_t *NewLastRSSI )
+{
+	UAVObjGetDataField(OpenLRSStatusHandle(), (void*)NewLastRSSI, offsetof( OpenLRSStatusData, LastRSSI), sizeof(uint8_t));
+}
+void OpenLRSStatusFailsafeActiveSet( uint8_t *NewFailsafeActive )
+{
+	UAVObjSetDataField(OpenLRSStatusHandle(), (void*)NewFailsafeActive, offsetof( OpenLRSStatusData, FailsafeActive), sizeof(uint8_t));
+}
+void OpenLRSStatusFailsafeActiveGet( uint8_t *NewFailsafeActive )
+{
+	UAVObjGetDataField(OpenLRSStatusHandle(), (void*)NewFailsafeActive, offsetof( OpenLRSStatusData, FailsafeActive), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
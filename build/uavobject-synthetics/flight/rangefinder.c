@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       rangefinder.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the Rangefinder object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: rangefinder.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "rangefinder.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 1000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 100,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t RangefinderInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(RANGEFINDER_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(RANGEFINDER_OBJID,
+			RANGEFINDER_ISSINGLEINST, RANGEFINDER_ISSETTINGS, RANGEFINDER_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void RangefinderSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	RangefinderData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void RangefinderSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void RangefinderSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	RangefinderSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		RangefinderSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle RangefinderHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void RangefinderRangeSet( float *NewRange )
+{
+	UAVObjSetDataField(RangefinderHandle(), (void*)NewRange, offsetof( RangefinderData, Range), sizeof(float));
+}
+void RangefinderRangeGet( float *NewRange )
+{
+	UAVObjGetDataField(RangefinderHandle(), (void*)NewRange, offsetof( RangefinderData, Range), sizeof(float));
+}
+void RangefinderVelocitySet( float *NewVelocity )
+{
+	UAVObjSetDataField(RangefinderHandle(), (void*)NewVelocity, offsetof( RangefinderData, Velocity), sizeof(float));
+}
+void RangefinderVelocityGet( float *NewVelocity )
+{
+	UAVObjGetDataField(RangefinderHandle(), (void*)NewVelocity, offsetof( RangefinderData, Velocity), sizeof(float));
+}
+void RangefinderRangingStatusSet( uint8_t *NewRangingStatus )
+{
+	UAVObjSetDataField(RangefinderHandle(), (void*)NewRangingStatus, offsetof( RangefinderData, RangingStatus), sizeof(uint8_t));
+}
+void RangefinderRangingStatusGet( uint8_t *NewRangingStatus )
+{
+	UAVObjGetDataField(RangefinderHandle(), (void*)NewRangingStatus, offsetof( RangefinderData, RangingStatus), sizeof(uint8_t));
+}
+void RangefinderVelocityStatusSet( uint8_t *NewVelocityStatus )
+{
+	UAVObjSetDataField(RangefinderHandle(), (void*)NewVelocityStatus, offsetof( RangefinderData, VelocityStatus), sizeof(uint8_t));
+}
+void RangefinderVelocityStatusGet( uint8_t *NewVelocityStatus )
+{
+	UAVObjGetDataField(RangefinderHandle(), (void*)NewVelocityStatus, offsetof( RangefinderData, VelocityStatus), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
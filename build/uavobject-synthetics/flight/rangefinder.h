@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup Rangefinder Rangefinder
+ * @brief The raw data from the rangefinder sensor.
+ *
+ *
+ * @file       rangefinder.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the Rangefinder object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: rangefinder.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef RANGEFINDER_H
+#define RANGEFINDER_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define RANGEFINDER_OBJID 0xA6470ACC
+#define RANGEFINDER_ISSINGLEINST 1
+#define RANGEFINDER_ISSETTINGS 0
+#define RANGEFINDER_NUMBYTES 10
+
+// Generic interface functions
+int32_t RangefinderInitialize();
+UAVObjHandle RangefinderHandle();
+void RangefinderSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Range;
+    float Velocity;
+    uint8_t RangingStatus;
+    uint8_t VelocityStatus;
+
+} __attribute__((packed)) __attribute__((aligned(4))) RangefinderData;
+
+// Typesafe Object access functions
+/**
+ * @function RangefinderGet(dataOut)
+ * @brief Populate a RangefinderData object
+ * @param[out] dataOut 
+ */
+static inline int32_t RangefinderGet(RangefinderData *dataOut) { return UAVObjGetData(RangefinderHandle(), dataOut); }
+
+static inline int32_t RangefinderSet(const RangefinderData *dataIn) { return UAVObjSetData(RangefinderHandle(), dataIn); }
+
+static inline int32_t RangefinderInstGet(uint16_t instId, RangefinderData *dataOut) { return UAVObjGetInstanceData(RangefinderHandle(), instId, dataOut); }
+
+static inline int32_t RangefinderInstSet(uint16_t instId, const RangefinderData *dataIn) { return UAVObjSetInstanceData(RangefinderHandle(), instId, dataIn); }
+
+static inline int32_t RangefinderConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(RangefinderHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RangefinderConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(RangefinderHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RangefinderConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(RangefinderHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RangefinderConnectCopy(volatile RangefinderData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	RangefinderGet((void *) dataOut);
+
+	return UAVObjConnectCallback(RangefinderHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t RangefinderCreateInstance() { return UAVObjCreateInstance(RangefinderHandle(), &RangefinderSetDefaults); }
+
+static inline void RangefinderUpdated() { UAVObjUpdated(RangefinderHandle()); }
+
+static inline void RangefinderInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(RangefinderHandle(), instId); }
+
+static inline int32_t RangefinderGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(RangefinderHandle(), dataOut); }
+
+static inline int32_t RangefinderSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(RangefinderHandle(), dataIn); }
+
+static inline int8_t RangefinderReadOnly() { return UAVObjReadOnly(RangefinderHandle()); }
+
+static inline uint16_t RangefinderGetNumInstances(){ return UAVObjGetNumInstances(RangefinderHandle()); }
+
+static inline uint32_t RangefinderGetNumBytes(){ return UAVObjGetNumBytes(RangefinderHandle()); }
+
+// Field information
+// Field Range information
+// Field Velocity information
+// Field RangingStatus information
+/* Enumeration options for field RangingStatus */
+typedef enum { RANGEFINDER_RANGINGSTATUS_OUTOFRANGE=0, RANGEFINDER_RANGINGSTATUS_INRANGE=1 }  __attribute__((packed)) RangefinderRangingStatusOptions;
+#define RANGEFINDER_RANGINGSTATUS_GLOBAL_MAXOPTVAL 1
+#define RANGEFINDER_RANGINGSTATUS_MAXOPTVAL 1
+static inline bool RangefinderRangingStatusIsValid( uint8_t CurrentRangingStatus ) { return CurrentRangingStatus <= RANGEFINDER_RANGINGSTATUS_MAXOPTVAL; }
+// Field VelocityStatus information
+/* Enumeration options for field VelocityStatus */
+typedef enum { RANGEFINDER_VELOCITYSTATUS_INVALID=0, RANGEFINDER_VELOCITYSTATUS_VALID=1 }  __attribute__((packed)) RangefinderVelocityStatusOptions;
+#define RANGEFINDER_VELOCITYSTATUS_GLOBAL_MAXOPTVAL 1
+#define RANGEFINDER_VELOCITYSTATUS_MAXOPTVAL 1
+static inline bool RangefinderVelocityStatusIsValid( uint8_t CurrentVelocityStatus ) { return CurrentVelocityStatus <= RANGEFINDER_VELOCITYSTATUS_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void RangefinderRangeSet( float *NewRange );
+extern void RangefinderRangeGet( float *NewRange );
+extern void RangefinderVelocitySet( float *NewVelocity );
+extern void RangefinderVelocityGet( float *NewVelocity );
+extern void RangefinderRangingStatusSet( uint8_t *NewRangingStatus );
+extern void RangefinderRangingStatusGet( uint8_t *NewRangingStatus );
+extern void RangefinderVelocityStatusSet( uint8_t *NewVelocityStatus );
+extern void RangefinderVelocityStatusGet( uint8_t *NewVelocityStatus );
+
+
+#endif // RANGEFINDER_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       rgbledsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the RGBLEDSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: rgbledsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "rgbledsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const RGBLEDSettingsData defaultData = {
+	.NumLeds = 0,
+	.AnnunciateRangeBegin = 0,
+	.AnnunciateRangeEnd = 255,
+	.RangeBegin = 0,
+	.RangeEnd = 255,
+	.RangeBaseColor = { 255, 0, 0 },
+	.RangeEndColor = { 0, 0, 255 },
+	.RangeColorBlendSource = 1,
+	.RangeColorBlendUnarmedSource = 6,
+	.RangeColorBlendType = 2,
+	.RangeColorBlendMode = 0,
+	.DefaultColor = { 255, 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t RGBLEDSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(RGBLEDSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(RGBLEDSETTINGS_OBJID,
+			RGBLEDSETTINGS_ISSINGLEINST, RGBLEDSETTINGS_ISSETTINGS, RGBLEDSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void RGBLEDSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	RGBLEDSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void RGBLEDSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void RGBLEDSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	RGBLEDSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		RGBLEDSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle RGBLEDSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void RGBLEDSettingsNumLedsSet( uint8_t *NewNumLeds )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewNumLeds, offsetof( RGBLEDSettingsData, NumLeds), sizeof(uint8_t));
+}
+void RGBLEDSettingsNumLedsGet( uint8_t *NewNumLeds )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewNumLeds, offsetof( RGBLEDSettingsData, NumLeds), sizeof(uint8_t));
+}
+void RGBLEDSettingsAnnunciateRangeBeginSet( uint8_t *NewAnnunciateRangeBegin )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewAnnunciateRangeBegin, offsetof( RGBLEDSettingsData, AnnunciateRangeBegin), sizeof(uint8_t));
+}
+void RGBLEDSettingsAnnunciateRangeBeginGet( uint8_t *NewAnnunciateRangeBegin )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewAnnunciateRangeBegin, offsetof( RGBLEDSettingsData, AnnunciateRangeBegin), sizeof(uint8_t));
+}
+void RGBLEDSettingsAnnunciateRangeEndSet( uint8_t *NewAnnunciateRangeEnd )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewAnnunciateRangeEnd, offsetof( RGBLEDSettingsData, AnnunciateRangeEnd), sizeof(uint8_t));
+}
+void RGBLEDSettingsAnnunciateRangeEndGet( uint8_t *NewAnnunciateRangeEnd )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewAnnunciateRangeEnd, offsetof( RGBLEDSettingsData, AnnunciateRangeEnd), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeBeginSet( uint8_t *NewRangeBegin )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeBegin, offsetof( RGBLEDSettingsData, RangeBegin), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeBeginGet( uint8_t *NewRangeBegin )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeBegin, offsetof( RGBLEDSettingsData, RangeBegin), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeEndSet( uint8_t *NewRangeEnd )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeEnd, offsetof( RGBLEDSettingsData, RangeEnd), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeEndGet( uint8_t *NewRangeEnd )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeEnd, offsetof( RGBLEDSettingsData, RangeEnd), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeBaseColorSet( uint8_t *NewRangeBaseColor )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeBaseColor, offsetof( RGBLEDSettingsData, RangeBaseColor), 3*sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeBaseColorGet( uint8_t *NewRangeBaseColor )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeBaseColor, offsetof( RGBLEDSettingsData, RangeBaseColor), 3*sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeEndColorSet( uint8_t *NewRangeEndColor )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeEndColor, offsetof( RGBLEDSettingsData, RangeEndColor), 3*sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeEndColorGet( uint8_t *NewRangeEndColor )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeEndColor, offsetof( RGBLEDSettingsData, RangeEndColor), 3*sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendSourceSet( uint8_t *NewRangeColorBlendSource )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendSource, offsetof( RGBLEDSettingsData, RangeColorBlendSource), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendSourceGet( uint8_t *NewRangeColorBlendSource )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendSource, offsetof( RGBLEDSettingsData, RangeColorBlendSource), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendUnarmedSourceSet( uint8_t *NewRangeColorBlendUnarmedSource )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendUnarmedSource, offsetof( RGBLEDSettingsData, RangeColorBlendUnarmedSource), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendUnarmedSourceGet( uint8_t *NewRangeColorBlendUnarmedSource )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendUnarmedSource, offsetof( RGBLEDSettingsData, RangeColorBlendUnarmedSource), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendTypeSet( uint8_t *NewRangeColorBlendType )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendType, offsetof( RGBLEDSettingsData, RangeColorBlendType), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendTypeGet( uint8_t *NewRangeColorBlendType )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendType, offsetof( RGBLEDSettingsData, RangeColorBlendType), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendModeSet( uint8_t *NewRangeColorBlendMode )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendMode, offsetof( RGBLEDSettingsData, RangeColorBlendMode), sizeof(uint8_t));
+}
+void RGBLEDSettingsRangeColorBlendModeGet( uint8_t *NewRangeColorBlendMode )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewRangeColorBlendMode, offsetof( RGBLEDSettingsData, RangeColorBlendMode), sizeof(uint8_t));
+}
+void RGBLEDSettingsDefaultColorSet( uint8_t *NewDefaultColor )
+{
+	UAVObjSetDataField(RGBLEDSettingsHandle(), (void*)NewDefaultColor, offsetof( RGBLEDSettingsData, DefaultColor), 3*sizeof(uint8_t));
+}
+void RGBLEDSettingsDefaultColorGet( uint8_t *NewDefaultColor )
+{
+	UAVObjGetDataField(RGBLEDSettingsHandle(), (void*)NewDefaultColor, offsetof( RGBLEDSettingsData, DefaultColor), 3*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup RGBLEDSettings RGBLEDSettings
+ * @brief Settings for RGB LEDs
+ *
+ *
+ * @file       rgbledsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the RGBLEDSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: rgbledsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef RGBLEDSETTINGS_H
+#define RGBLEDSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define RGBLEDSETTINGS_OBJID 0xBE0F3B50
+#define RGBLEDSETTINGS_ISSINGLEINST 1
+#define RGBLEDSETTINGS_ISSETTINGS 1
+#define RGBLEDSETTINGS_NUMBYTES 18
+
+// Generic interface functions
+int32_t RGBLEDSettingsInitialize();
+UAVObjHandle RGBLEDSettingsHandle();
+void RGBLEDSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t NumLeds;
+    uint8_t AnnunciateRangeBegin;
+    uint8_t AnnunciateRangeEnd;
+    uint8_t RangeBegin;
+    uint8_t RangeEnd;
+    uint8_t RangeBaseColor[3];
+    uint8_t RangeEndColor[3];
+    uint8_t RangeColorBlendSource;
+    uint8_t RangeColorBlendUnarmedSource;
+    uint8_t RangeColorBlendType;
+    uint8_t RangeColorBlendMode;
+    uint8_t DefaultColor[3];
+
+} __attribute__((packed)) __attribute__((aligned(4))) RGBLEDSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function RGBLEDSettingsGet(dataOut)
+ * @brief Populate a RGBLEDSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t RGBLEDSettingsGet(RGBLEDSettingsData *dataOut) { return UAVObjGetData(RGBLEDSettingsHandle(), dataOut); }
+
+static inline int32_t RGBLEDSettingsSet(const RGBLEDSettingsData *dataIn) { return UAVObjSetData(RGBLEDSettingsHandle(), dataIn); }
+
+static inline int32_t RGBLEDSettingsInstGet(uint16_t instId, RGBLEDSettingsData *dataOut) { return UAVObjGetInstanceData(RGBLEDSettingsHandle(), instId, dataOut); }
+
+static inline int32_t RGBLEDSettingsInstSet(uint16_t instId, const RGBLEDSettingsData *dataIn) { return UAVObjSetInstanceData(RGBLEDSettingsHandle(), instId, dataIn); }
+
+static inline int32_t RGBLEDSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(RGBLEDSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RGBLEDSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(RGBLEDSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RGBLEDSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(RGBLEDSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t RGBLEDSettingsConnectCopy(volatile RGBLEDSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	RGBLEDSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(RGBLEDSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t RGBLEDSettingsCreateInstance() { return UAVObjCreateInstance(RGBLEDSettingsHandle(), &RGBLEDSettingsSetDefaults); }
+
+static inline void RGBLEDSettingsUpdated() { UAVObjUpdated(RGBLEDSettingsHandle()); }
+
+static inline void RGBLEDSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(RGBLEDSettingsHandle(), instId); }
+
+static inline int32_t RGBLEDSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(RGBLEDSettingsHandle(), dataOut); }
+
+static inline int32_t RGBLEDSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(RGBLEDSettingsHandle(), dataIn); }
+
+static inline int8_t RGBLEDSettingsReadOnly() { return UAVObjReadOnly(RGBLEDSettingsHandle()); }
+
+static inline uint16_t RGBLEDSettingsGetNumInstances(){ return UAVObjGetNumInstances(RGBLEDSettingsHandle()); }
+
+static inline uint32_t RGBLEDSettingsGetNumBytes(){ return UAVObjGetNumBytes(RGBLEDSettingsHandle()); }
+
+// Field information
+// Field NumLeds information
+// Field AnnunciateRangeBegin information
+// Field AnnunciateRangeEnd information
+// Field RangeBegin information
+// Field RangeEnd information
+// Field RangeBaseColor information
+#define RGBLEDSETTINGS_RANGEBASECOLOR_NUMELEM 3
+// Field RangeEndColor information
+#define RGBLEDSETTINGS_RANGEENDCOLOR_NUMELEM 3
+// Field RangeColorBlendSource information
+/* Enumeration options for field RangeColorBlendSource */
+typedef enum { RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_ALWAYSUSEBASECOLOR=0, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_THROTTLE=1, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_ACCESSORY0=2, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_ACCESSORY1=3, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_ACCESSORY2=4, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_TIMEHALFSECONDPERIOD=5, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_TIMESECONDPERIOD=6, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_TIME2SECONDPERIOD=7, RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_TIME4SECONDPERIOD=8 }  __attribute__((packed)) RGBLEDSettingsRangeColorBlendSourceOptions;
+#define RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_GLOBAL_MAXOPTVAL 8
+#define RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_MAXOPTVAL 8
+static inline bool RGBLEDSettingsRangeColorBlendSourceIsValid( uint8_t CurrentRangeColorBlendSource ) { return CurrentRangeColorBlendSource <= RGBLEDSETTINGS_RANGECOLORBLENDSOURCE_MAXOPTVAL; }
+// Field RangeColorBlendUnarmedSource information
+/* Enumeration options for field RangeColorBlendUnarmedSource */
+typedef enum { RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_ALWAYSUSEBASECOLOR=0, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_THROTTLE=1, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_ACCESSORY0=2, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_ACCESSORY1=3, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_ACCESSORY2=4, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_TIMEHALFSECONDPERIOD=5, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_TIMESECONDPERIOD=6, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_TIME2SECONDPERIOD=7, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_TIME4SECONDPERIOD=8, RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) RGBLEDSettingsRangeColorBlendUnarmedSourceOptions;
+#define RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_GLOBAL_MAXOPTVAL 8
+#define RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_MAXOPTVAL 8
+static inline bool RGBLEDSettingsRangeColorBlendUnarmedSourceIsValid( uint8_t CurrentRangeColorBlendUnarmedSource ) { return CurrentRangeColorBlendUnarmedSource <= RGBLEDSETTINGS_RANGECOLORBLENDUNARMEDSOURCE_MAXOPTVAL; }
+// Field RangeColorBlendType information
+/* Enumeration options for field RangeColorBlendType */
+typedef enum { RGBLEDSETTINGS_RANGECOLORBLENDTYPE_LINEARRGBFADE=0, RGBLEDSETTINGS_RANGECOLORBLENDTYPE_LINEARINHSV=1, RGBLEDSETTINGS_RANGECOLORBLENDTYPE_LINEARINHSVBACKWARDSHUE=2 }  __attribute__((packed)) RGBLEDSettingsRangeColorBlendTypeOptions;
+#define RGBLEDSETTINGS_RANGECOLORBLENDTYPE_GLOBAL_MAXOPTVAL 2
+#define RGBLEDSETTINGS_RANGECOLORBLENDTYPE_MAXOPTVAL 2
+static inline bool RGBLEDSettingsRangeColorBlendTypeIsValid( uint8_t CurrentRangeColorBlendType ) { return CurrentRangeColorBlendType <= RGBLEDSETTINGS_RANGECOLORBLENDTYPE_MAXOPTVAL; }
+// Field RangeColorBlendMode information
+/* Enumeration options for field RangeColorBlendMode */
+typedef enum { RGBLEDSETTINGS_RANGECOLORBLENDMODE_SAWTOOTH=0, RGBLEDSETTINGS_RANGECOLORBLENDMODE_TRIANGLE=1, RGBLEDSETTINGS_RANGECOLORBLENDMODE_SINE=2, RGBLEDSETTINGS_RANGECOLORBLENDMODE_SQUARE=3 }  __attribute__((packed)) RGBLEDSettingsRangeColorBlendModeOptions;
+#define RGBLEDSETTINGS_RANGECOLORBLENDMODE_GLOBAL_MAXOPTVAL 3
+#define RGBLEDSETTINGS_RANGECOLORBLENDMODE_MAXOPTVAL 3
+static inline bool RGBLEDSettingsRangeColorBlendModeIsValid( uint8_t CurrentRangeColorBlendMode ) { return CurrentRangeColorBlendMode <= RGBLEDSETTINGS_RANGECOLORBLENDMODE_MAXOPTVAL; }
+// Field DefaultColor information
+#define RGBLEDSETTINGS_DEFAULTCOLOR_NUMELEM 3
+
+
+// set/Get functions
+extern void RGBLEDSettingsNumLedsSet( uint8_t *NewNumLeds );
+extern void RGBLEDSettingsNumLedsGet( uint8_t *NewNumLeds );
+extern void RGBLEDSettingsAnnunciateRangeBeginSet( uint8_t *NewAnnunciateRangeBegin );
+extern void RGBLEDSettingsAnnunciateRangeBeginGet( uint8_t *NewAnnunciateRangeBegin );
+extern void RGBLEDSettingsAnnunciateRangeEndSet( uint8_t *NewAnnunciateRangeEnd );
+extern void RGBLEDSettingsAnnunciateRangeEndGet( uint8_t *NewAnnunciateRangeEnd );
+extern void RGBLEDSettingsRangeBeginSet( uint8_t *NewRangeBegin );
+extern void RGBLEDSettingsRangeBeginGet( uint8_t *NewRangeBegin );
+extern void RGBLEDSettingsRangeEndSet( uint8_t *NewRangeEnd );
+extern void RGBLEDSettingsRangeEndGet( uint8_t *NewRangeEnd );
+extern void RGBLEDSettingsRangeBaseColorSet( uint8_t *NewRangeBaseColor );
+extern void RGBLEDSettingsRangeBaseColorGet( uint8_t *NewRangeBaseColor );
+extern void RGBLEDSettingsRangeEndColorSet( uint8_t *NewRangeEndColor );
+extern void RGBLEDSettingsRangeEndColorGet( uint8_t *NewRangeEndColor );
+extern void RGBLEDSettingsRangeColorBlendSourceSet( uint8_t *NewRangeColorBlendSource );
+extern void RGBLEDSettingsRangeColorBlendSourceGet( uint8_t *NewRangeColorBlendSource );
+extern void RGBLEDSettingsRangeColorBlendUnarmedSourceSet( uint8_t *NewRangeColorBlendUnarmedSource );
+extern void RGBLEDSettingsRangeColorBlendUnarmedSourceGet( uint8_t *NewRangeColorBlendUnarmedSource );
+extern void RGBLEDSettingsRangeColorBlendTypeSet( uint8_t *NewRangeColorBlendType );
+extern void RGBLEDSettingsRangeColorBlendTypeGet( uint8_t *NewRangeColorBlendType );
+extern void RGBLEDSettingsRangeColorBlendModeSet( uint8_t *NewRangeColorBlendMode );
+extern void RGBLEDSettingsRangeColorBlendModeGet( uint8_t *NewRangeColorBlendMode );
+extern void RGBLEDSettingsDefaultColorSet( uint8_t *NewDefaultColor );
+extern void RGBLEDSettingsDefaultColorGet( uint8_t *NewDefaultColor );
+
+
+#endif // RGBLEDSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       schedulerstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SchedulerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: schedulerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "schedulerstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 1000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SchedulerStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SCHEDULERSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SCHEDULERSTATS_OBJID,
+			SCHEDULERSTATS_ISSINGLEINST, SCHEDULERSTATS_ISSETTINGS, SCHEDULERSTATS_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SchedulerStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SchedulerStatsData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SchedulerStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SchedulerStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SchedulerStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SchedulerStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SchedulerStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SchedulerStatsRunsSet( uint32_t *NewRuns )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewRuns, offsetof( SchedulerStatsData, Runs), 2*sizeof(uint32_t));
+}
+void SchedulerStatsRunsGet( uint32_t *NewRuns )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewRuns, offsetof( SchedulerStatsData, Runs), 2*sizeof(uint32_t));
+}
+void SchedulerStatsOverrunsSet( uint32_t *NewOverruns )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewOverruns, offsetof( SchedulerStatsData, Overruns), 2*sizeof(uint32_t));
+}
+void SchedulerStatsOverrunsGet( uint32_t *NewOverruns )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewOverruns, offsetof( SchedulerStatsData, Overruns), 2*sizeof(uint32_t));
+}
+void SchedulerStatsRunTimeSet( uint16_t *NewRunTime )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewRunTime, offsetof( SchedulerStatsData, RunTime), 2*sizeof(uint16_t));
+}
+void SchedulerStatsRunTimeGet( uint16_t *NewRunTime )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewRunTime, offsetof( SchedulerStatsData, RunTime), 2*sizeof(uint16_t));
+}
+void SchedulerStatsMaxRunTimeSet( uint16_t *NewMaxRunTime )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewMaxRunTime, offsetof( SchedulerStatsData, MaxRunTime), 2*sizeof(uint16_t));
+}
+void SchedulerStatsMaxRunTimeGet( uint16_t *NewMaxRunTime )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewMaxRunTime, offsetof( SchedulerStatsData, MaxRunTime), 2*sizeof(uint16_t));
+}
+void SchedulerStatsMaxLatencySet( uint16_t *NewMaxLatency )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewMaxLatency, offsetof( SchedulerStatsData, MaxLatency), 2*sizeof(uint16_t));
+}
+void SchedulerStatsMaxLatencyGet( uint16_t *NewMaxLatency )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewMaxLatency, offsetof( SchedulerStatsData, MaxLatency), 2*sizeof(uint16_t));
+}
+void SchedulerStatsGyroPeriodSet( uint16_t *NewGyroPeriod )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewGyroPeriod, offsetof( SchedulerStatsData, GyroPeriod), sizeof(uint16_t));
+}
+void SchedulerStatsGyroPeriodGet( uint16_t *NewGyroPeriod )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewGyroPeriod, offsetof( SchedulerStatsData, GyroPeriod), sizeof(uint16_t));
+}
+void SchedulerStatsMaxGyroJitterSet( uint16_t *NewMaxGyroJitter )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewMaxGyroJitter, offsetof( SchedulerStatsData, MaxGyroJitter), sizeof(uint16_t));
+}
+void SchedulerStatsMaxGyroJitterGet( uint16_t *NewMaxGyroJitter )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewMaxGyroJitter, offsetof( SchedulerStatsData, MaxGyroJitter), sizeof(uint16_t));
+}
+void SchedulerStatsDividerSet( uint8_t *NewDivider )
+{
+	UAVObjSetDataField(SchedulerStatsHandle(), (void*)NewDivider, offsetof( SchedulerStatsData, Divider), 2*sizeof(uint8_t));
+}
+void SchedulerStatsDividerGet( uint8_t *NewDivider )
+{
+	UAVObjGetDataField(SchedulerStatsHandle(), (void*)NewDivider, offsetof( SchedulerStatsData, Divider), 2*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
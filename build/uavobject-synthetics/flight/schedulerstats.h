@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup SchedulerStats SchedulerStats
+ * @brief Timing of the stages the gyro samples drive. Maximums are over the time since the last update.
+ *
+ *
+ * @file       schedulerstats.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the SchedulerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: schedulerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SCHEDULERSTATS_H
+#define SCHEDULERSTATS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define SCHEDULERSTATS_OBJID 0xD5598496
+#define SCHEDULERSTATS_ISSINGLEINST 1
+#define SCHEDULERSTATS_ISSETTINGS 0
+#define SCHEDULERSTATS_NUMBYTES 34
+
+// Generic interface functions
+int32_t SchedulerStatsInitialize();
+UAVObjHandle SchedulerStatsHandle();
+void SchedulerStatsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Runs[2];
+    uint32_t Overruns[2];
+    uint16_t RunTime[2];
+    uint16_t MaxRunTime[2];
+    uint16_t MaxLatency[2];
+    uint16_t GyroPeriod;
+    uint16_t MaxGyroJitter;
+    uint8_t Divider[2];
+
+} __attribute__((packed)) __attribute__((aligned(4))) SchedulerStatsData;
+
+// Typesafe Object access functions
+/**
+ * @function SchedulerStatsGet(dataOut)
+ * @brief Populate a SchedulerStatsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t SchedulerStatsGet(SchedulerStatsData *dataOut) { return UAVObjGetData(SchedulerStatsHandle(), dataOut); }
+
+static inline int32_t SchedulerStatsSet(const SchedulerStatsData *dataIn) { return UAVObjSetData(SchedulerStatsHandle(), dataIn); }
+
+static inline int32_t SchedulerStatsInstGet(uint16_t instId, SchedulerStatsData *dataOut) { return UAVObjGetInstanceData(SchedulerStatsHandle(), instId, dataOut); }
+
+static inline int32_t SchedulerStatsInstSet(uint16_t instId, const SchedulerStatsData *dataIn) { return UAVObjSetInstanceData(SchedulerStatsHandle(), instId, dataIn); }
+
+static inline int32_t SchedulerStatsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(SchedulerStatsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SchedulerStatsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(SchedulerStatsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SchedulerStatsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(SchedulerStatsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SchedulerStatsConnectCopy(volatile SchedulerStatsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	SchedulerStatsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(SchedulerStatsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t SchedulerStatsCreateInstance() { return UAVObjCreateInstance(SchedulerStatsHandle(), &SchedulerStatsSetDefaults); }
+
+static inline void SchedulerStatsUpdated() { UAVObjUpdated(SchedulerStatsHandle()); }
+
+static inline void SchedulerStatsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(SchedulerStatsHandle(), instId); }
+
+static inline int32_t SchedulerStatsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(SchedulerStatsHandle(), dataOut); }
+
+static inline int32_t SchedulerStatsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(SchedulerStatsHandle(), dataIn); }
+
+static inline int8_t SchedulerStatsReadOnly() { return UAVObjReadOnly(SchedulerStatsHandle()); }
+
+static inline uint16_t SchedulerStatsGetNumInstances(){ return UAVObjGetNumInstances(SchedulerStatsHandle()); }
+
+static inline uint32_t SchedulerStatsGetNumBytes(){ return UAVObjGetNumBytes(SchedulerStatsHandle()); }
+
+// Field information
+// Field Runs information
+typedef enum { SCHEDULERSTATS_RUNS_STABILIZATION=0, SCHEDULERSTATS_RUNS_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsRunsElem;
+#define SCHEDULERSTATS_RUNS_NUMELEM 2
+// Field Overruns information
+typedef enum { SCHEDULERSTATS_OVERRUNS_STABILIZATION=0, SCHEDULERSTATS_OVERRUNS_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsOverrunsElem;
+#define SCHEDULERSTATS_OVERRUNS_NUMELEM 2
+// Field RunTime information
+typedef enum { SCHEDULERSTATS_RUNTIME_STABILIZATION=0, SCHEDULERSTATS_RUNTIME_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsRunTimeElem;
+#define SCHEDULERSTATS_RUNTIME_NUMELEM 2
+// Field MaxRunTime information
+typedef enum { SCHEDULERSTATS_MAXRUNTIME_STABILIZATION=0, SCHEDULERSTATS_MAXRUNTIME_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsMaxRunTimeElem;
+#define SCHEDULERSTATS_MAXRUNTIME_NUMELEM 2
+// Field MaxLatency information
+typedef enum { SCHEDULERSTATS_MAXLATENCY_STABILIZATION=0, SCHEDULERSTATS_MAXLATENCY_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsMaxLatencyElem;
+#define SCHEDULERSTATS_MAXLATENCY_NUMELEM 2
+// Field GyroPeriod information
+// Field MaxGyroJitter information
+// Field Divider information
+typedef enum { SCHEDULERSTATS_DIVIDER_STABILIZATION=0, SCHEDULERSTATS_DIVIDER_ATTITUDE=1 } __attribute__((packed)) SchedulerStatsDividerElem;
+#define SCHEDULERSTATS_DIVIDER_NUMELEM 2
+
+
+// set/Get functions
+extern void SchedulerStatsRunsSet( uint32_t *NewRuns );
+extern void SchedulerStatsRunsGet( uint32_t *NewRuns );
+extern void SchedulerStatsOverrunsSet( uint32_t *NewOverruns );
+extern void SchedulerStatsOverrunsGet( uint32_t *NewOverruns );
+extern void SchedulerStatsRunTimeSet( uint16_t *NewRunTime );
+extern void SchedulerStatsRunTimeGet( uint16_t *NewRunTime );
+extern void SchedulerStatsMaxRunTimeSet( uint16_t *NewMaxRunTime );
+extern void SchedulerStatsMaxRunTimeGet( uint16_t *NewMaxRunTime );
+extern void SchedulerStatsMaxLatencySet( uint16_t *NewMaxLatency );
+extern void SchedulerStatsMaxLatencyGet( uint16_t *NewMaxLatency );
+extern void SchedulerStatsGyroPeriodSet( uint16_t *NewGyroPeriod );
+extern void SchedulerStatsGyroPeriodGet( uint16_t *NewGyroPeriod );
+extern void SchedulerStatsMaxGyroJitterSet( uint16_t *NewMaxGyroJitter );
+extern void SchedulerStatsMaxGyroJitterGet( uint16_t *NewMaxGyroJitter );
+extern void SchedulerStatsDividerSet( uint8_t *NewDivider );
+extern void SchedulerStatsDividerGet( uint8_t *NewDivider );
+
+
+#endif // SCHEDULERSTATS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,271 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       sensorsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SensorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: sensorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "sensorsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const SensorSettingsData defaultData = {
+	.AccelBias = { 0, 0, 0 },
+	.AccelScale = { 1, 1, 1 },
+	.GyroScale = { 1, 1, 1 },
+	.XGyroTempCoeff = { 0, 0, 0, 0 },
+	.YGyroTempCoeff = { 0, 0, 0, 0 },
+	.ZGyroTempCoeff = { 0, 0, 0, 0 },
+	.MagBias = { 0, 0, 0 },
+	.MagScale = { 1, 1, 1 },
+	.ZAccelOffset = 0,
+	.LowpassCutoff = 55,
+	.DynamicNotchQ = 3,
+	.DynamicNotchRange = { 80, 500 },
+	.TolerateMissingSensors = 0,
+	.LowpassOrder = 1,
+	.DynamicNotchCount = 0,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SensorSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SENSORSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SENSORSETTINGS_OBJID,
+			SENSORSETTINGS_ISSINGLEINST, SENSORSETTINGS_ISSETTINGS, SENSORSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SensorSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SensorSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SensorSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SensorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SensorSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SensorSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SensorSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SensorSettingsAccelBiasSet( float *NewAccelBias )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewAccelBias, offsetof( SensorSettingsData, AccelBias), 3*sizeof(float));
+}
+void SensorSettingsAccelBiasGet( float *NewAccelBias )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewAccelBias, offsetof( SensorSettingsData, AccelBias), 3*sizeof(float));
+}
+void SensorSettingsAccelScaleSet( float *NewAccelScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewAccelScale, offsetof( SensorSettingsData, AccelScale), 3*sizeof(float));
+}
+void SensorSettingsAccelScaleGet( float *NewAccelScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewAccelScale, offsetof( SensorSettingsData, AccelScale), 3*sizeof(float));
+}
+void SensorSettingsGyroScaleSet( float *NewGyroScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewGyroScale, offsetof( SensorSettingsData, GyroScale), 3*sizeof(float));
+}
+void SensorSettingsGyroScaleGet( float *NewGyroScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewGyroScale, offsetof( SensorSettingsData, GyroScale), 3*sizeof(float));
+}
+void SensorSettingsXGyroTempCoeffSet( float *NewXGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewXGyroTempCoeff, offsetof( SensorSettingsData, XGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsXGyroTempCoeffGet( float *NewXGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewXGyroTempCoeff, offsetof( SensorSettingsData, XGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsYGyroTempCoeffSet( float *NewYGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewYGyroTempCoeff, offsetof( SensorSettingsData, YGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsYGyroTempCoeffGet( float *NewYGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewYGyroTempCoeff, offsetof( SensorSettingsData, YGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsZGyroTempCoeffSet( float *NewZGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewZGyroTempCoeff, offsetof( SensorSettingsData, ZGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsZGyroTempCoeffGet( float *NewZGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewZGyroTempCoeff, offsetof( SensorSettingsData, ZGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsMagBiasSet( float *NewMagBias )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewMagBias, offsetof( SensorSettingsData, MagBias), 3*sizeof(float));
+}
+void SensorSettingsMagBiasGet( float *NewMagBias )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewMagBias, offsetof( SensorSettingsData, MagBias), 3*sizeof(float));
+}
+void SensorSettingsMagScaleSet( float *NewMagScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewMagScale, offsetof( SensorSettingsData, MagScale), 3*sizeof(float));
+}
+void SensorSettingsMagScaleGet( float *NewMagScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewMagScale, offsetof( SensorSettingsData, MagScale), 3*sizeof(float));
+}
+void SensorSettingsZAccelOffsetSet( float *NewZAccelOffset )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewZAccelOffset, offsetof( SensorSettingsData, ZAccelOffset), sizeof(float));
+}
+void SensorSettingsZAccelOffsetGet( float *NewZAccelOffset )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewZAccelOffset, offsetof( SensorSettingsData, ZAccelOffset), sizeof(float));
+}
+void SensorSettingsLowpassCutoffSet( float *NewLowpassCutoff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewLowpassCutoff, offsetof( SensorSettingsData, LowpassCutoff), sizeof(float));
+}
+void SensorSettingsLowpassCutoffGet( float *NewLowpassCutoff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewLowpassCutoff, offsetof( SensorSettingsData, LowpassCutoff), sizeof(float));
+}
+void SensorSettingsDynamicNotchQSet( float *NewDynamicNotchQ )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchQ, offsetof( SensorSettingsData, DynamicNotchQ), sizeof(float));
+}
+void SensorSettingsDynamicNotchQGet( float *NewDynamicNotchQ )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchQ, offsetof( SensorSettingsData, DynamicNotchQ), sizeof(float));
+}
+void SensorSettingsDynamicNotchRangeSet( uint16_t *NewDynamicNotchRange )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchRange, offsetof( SensorSettingsData, DynamicNotchRange), 2*sizeof(uint16_t));
+}
+void SensorSettingsDynamicNotchRangeGet( uint16_t *NewDynamicNotchRange )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchRange, offsetof( SensorSettingsData, DynamicNotchRange), 2*sizeof(uint16_t));
+}
+void SensorSettingsTolerateMissingSensorsSet( uint8_t *NewTolerateMissingSensors )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewTolerateMissingSensors, offsetof( SensorSettingsData, TolerateMissingSensors), sizeof(uint8_t));
+}
+void SensorSettingsTolerateMissingSensorsGet( uint8_t *NewTolerateMissingSensors )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewTolerateMissingSensors, offsetof( SensorSettingsData, TolerateMissingSensors), sizeof(uint8_t));
+}
+void SensorSettingsLowpassOrderSet( uint8_t *NewLowpassOrder )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewLowpassOrder, offsetof( SensorSettingsData, LowpassOrder), sizeof(uint8_t));
+}
+void SensorSettingsLowpassOrderGet( uint8_t *NewLowpassOrder )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewLowpassOrder, offsetof( SensorSettingsData, LowpassOrder), sizeof(uint8_t));
+}
+void SensorSettingsDynamicNotchCountSet( uint8_t *NewDynamicNotchCount )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchCount, offsetof( SensorSettingsData, DynamicNotchCount), sizeof(uint8_t));
+}
+void SensorSettingsDynamicNotchCountGet( uint8_t *NewDynamicNotchCount )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewDynamicNotchCount, offsetof( SensorSettingsData, DynamicNotchCount), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
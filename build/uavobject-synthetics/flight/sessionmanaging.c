@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       sessionmanaging.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SessionManaging object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: sessionmanaging.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "sessionmanaging.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SessionManagingInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SESSIONMANAGING_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SESSIONMANAGING_OBJID,
+			SESSIONMANAGING_ISSINGLEINST, SESSIONMANAGING_ISSETTINGS, SESSIONMANAGING_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SessionManagingSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SessionManagingData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SessionManagingSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SessionManagingSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SessionManagingSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SessionManagingSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SessionManagingHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SessionManagingObjectIDSet( uint32_t *NewObjectID )
+{
+	UAVObjSetDataField(SessionManagingHandle(), (void*)NewObjectID, offsetof( SessionManagingData, ObjectID), sizeof(uint32_t));
+}
+void SessionManagingObjectIDGet( uint32_t *NewObjectID )
+{
+	UAVObjGetDataField(SessionManagingHandle(), (void*)NewObjectID, offsetof( SessionManagingData, ObjectID), sizeof(uint32_t));
+}
+void SessionManagingSessionIDSet( uint16_t *NewSessionID )
+{
+	UAVObjSetDataField(SessionManagingHandle(), (void*)NewSessionID, offsetof( SessionManagingData, SessionID), sizeof(uint16_t));
+}
+void SessionManagingSessionIDGet( uint16_t *NewSessionID )
+{
+	UAVObjGetDataField(SessionManagingHandle(), (void*)NewSessionID, offsetof( SessionManagingData, SessionID), sizeof(uint16_t));
+}
+void SessionManagingObjectInstancesSet( uint8_t *NewObjectInstances )
+{
+	UAVObjSetDataField(SessionManagingHandle(), (void*)NewObjectInstances, offsetof( SessionManagingData, ObjectInstances), sizeof(uint8_t));
+}
+void SessionManagingObjectInstancesGet( uint8_t *NewObjectInstances )
+{
+	UAVObjGetDataField(SessionManagingHandle(), (void*)NewObjectInstances, offsetof( SessionManagingData, ObjectInstances), sizeof(uint8_t));
+}
+void SessionManagingNumberOfObjectsSet( uint8_t *NewNumberOfObjects )
+{
+	UAVObjSetDataField(SessionManagingHandle(), (void*)NewNumberOfObjects, offsetof( SessionManagingData, NumberOfObjects), sizeof(uint8_t));
+}
+void SessionManagingNumberOfObjectsGet( uint8_t *NewNumberOfObjects )
+{
+	UAVObjGetDataField(SessionManagingHandle(), (void*)NewNumberOfObjects, offsetof( SessionManagingData, NumberOfObjects), sizeof(uint8_t));
+}
+void SessionManagingObjectOfInterestIndexSet( uint8_t *NewObjectOfInterestIndex )
+{
+	UAVObjSetDataField(SessionManagingHandle(), (void*)NewObjectOfInterestIndex, offsetof( SessionManagingData, ObjectOfInterestIndex), sizeof(uint8_t));
+}
+void SessionManagingObjectOfInterestIndexGet( uint8_t *NewObjectOfInterestIndex )
+{
+	UAVObjGetDataField(SessionManagingHandle(), (void*)NewObjectOfInterestIndex, offsetof( SessionManagingData, ObjectOfInterestIndex), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       shareddefs.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SharedDefs object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: shareddefs.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "shareddefs.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SharedDefsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SHAREDDEFS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SHAREDDEFS_OBJID,
+			SHAREDDEFS_ISSINGLEINST, SHAREDDEFS_ISSETTINGS, SHAREDDEFS_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SharedDefsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SharedDefsData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SharedDefsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SharedDefsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SharedDefsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SharedDefsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SharedDefsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SharedDefsFlightModeSet( uint8_t *NewFlightMode )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewFlightMode, offsetof( SharedDefsData, FlightMode), sizeof(uint8_t));
+}
+void SharedDefsFlightModeGet( uint8_t *NewFlightMode )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewFlightMode, offsetof( SharedDefsData, FlightMode), sizeof(uint8_t));
+}
+void SharedDefsStabilizationModeSet( uint8_t *NewStabilizationMode )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewStabilizationMode, offsetof( SharedDefsData, StabilizationMode), sizeof(uint8_t));
+}
+void SharedDefsStabilizationModeGet( uint8_t *NewStabilizationMode )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewStabilizationMode, offsetof( SharedDefsData, StabilizationMode), sizeof(uint8_t));
+}
+void SharedDefsReprojectionModeSet( uint8_t *NewReprojectionMode )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewReprojectionMode, offsetof( SharedDefsData, ReprojectionMode), sizeof(uint8_t));
+}
+void SharedDefsReprojectionModeGet( uint8_t *NewReprojectionMode )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewReprojectionMode, offsetof( SharedDefsData, ReprojectionMode), sizeof(uint8_t));
+}
+void SharedDefsOrientationUnitSet( uint8_t *NewOrientationUnit )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewOrientationUnit, offsetof( SharedDefsData, OrientationUnit), sizeof(uint8_t));
+}
+void SharedDefsOrientationUnitGet( uint8_t *NewOrientationUnit )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewOrientationUnit, offsetof( SharedDefsData, OrientationUnit), sizeof(uint8_t));
+}
+void SharedDefsPositionUnitSet( uint8_t *NewPositionUnit )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewPositionUnit, offsetof( SharedDefsData, PositionUnit), sizeof(uint8_t));
+}
+void SharedDefsPositionUnitGet( uint8_t *NewPositionUnit )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewPositionUnit, offsetof( SharedDefsData, PositionUnit), sizeof(uint8_t));
+}
+void SharedDefsAlarmLevelsSet( uint8_t *NewAlarmLevels )
+{
+	UAVObjSetDataField(SharedDefsHandle(), (void*)NewAlarmLevels, offsetof( SharedDefsData, AlarmLevels), sizeof(uint8_t));
+}
+void SharedDefsAlarmLevelsGet( uint8_t *NewAlarmLevels )
+{
+	UAVObjGetDataField(SharedDefsHandle(), (void*)NewAlarmLevels, offsetof( SharedDefsData, AlarmLevels), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
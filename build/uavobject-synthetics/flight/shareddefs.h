@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup SharedDefs SharedDefs
+ * @brief Templates for common enums.
+ *
+ *
+ * @file       shareddefs.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the SharedDefs object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: shareddefs.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SHAREDDEFS_H
+#define SHAREDDEFS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define SHAREDDEFS_OBJID 0xE4745B72
+#define SHAREDDEFS_ISSINGLEINST 1
+#define SHAREDDEFS_ISSETTINGS 0
+#define SHAREDDEFS_NUMBYTES 6
+
+// Generic interface functions
+int32_t SharedDefsInitialize();
+UAVObjHandle SharedDefsHandle();
+void SharedDefsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t FlightMode;
+    uint8_t StabilizationMode;
+    uint8_t ReprojectionMode;
+    uint8_t OrientationUnit;
+    uint8_t PositionUnit;
+    uint8_t AlarmLevels;
+
+} __attribute__((packed)) __attribute__((aligned(4))) SharedDefsData;
+
+// Typesafe Object access functions
+/**
+ * @function SharedDefsGet(dataOut)
+ * @brief Populate a SharedDefsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t SharedDefsGet(SharedDefsData *dataOut) { return UAVObjGetData(SharedDefsHandle(), dataOut); }
+
+static inline int32_t SharedDefsSet(const SharedDefsData *dataIn) { return UAVObjSetData(SharedDefsHandle(), dataIn); }
+
+static inline int32_t SharedDefsInstGet(uint16_t instId, SharedDefsData *dataOut) { return UAVObjGetInstanceData(SharedDefsHandle(), instId, dataOut); }
+
+static inline int32_t SharedDefsInstSet(uint16_t instId, const SharedDefsData *dataIn) { return UAVObjSetInstanceData(SharedDefsHandle(), instId, dataIn); }
+
+static inline int32_t SharedDefsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(SharedDefsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SharedDefsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(SharedDefsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SharedDefsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(SharedDefsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SharedDefsConnectCopy(volatile SharedDefsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	SharedDefsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(SharedDefsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t SharedDefsCreateInstance() { return UAVObjCreateInstance(SharedDefsHandle(), &SharedDefsSetDefaults); }
+
+static inline void SharedDefsUpdated() { UAVObjUpdated(SharedDefsHandle()); }
+
+static inline void SharedDefsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(SharedDefsHandle(), instId); }
+
+static inline int32_t SharedDefsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(SharedDefsHandle(), dataOut); }
+
+static inline int32_t SharedDefsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(SharedDefsHandle(), dataIn); }
+
+static inline int8_t SharedDefsReadOnly() { return UAVObjReadOnly(SharedDefsHandle()); }
+
+static inline uint16_t SharedDefsGetNumInstances(){ return UAVObjGetNumInstances(SharedDefsHandle()); }
+
+static inline uint32_t SharedDefsGetNumBytes(){ return UAVObjGetNumBytes(SharedDefsHandle()); }
+
+// Field information
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { SHAREDDEFS_FLIGHTMODE_MANUAL=0, SHAREDDEFS_FLIGHTMODE_ACRO=1, SHAREDDEFS_FLIGHTMODE_LEVELING=2, SHAREDDEFS_FLIGHTMODE_HORIZON=3, SHAREDDEFS_FLIGHTMODE_AXISLOCK=4, SHAREDDEFS_FLIGHTMODE_VIRTUALBAR=5, SHAREDDEFS_FLIGHTMODE_STABILIZED1=6, SHAREDDEFS_FLIGHTMODE_STABILIZED2=7, SHAREDDEFS_FLIGHTMODE_STABILIZED3=8, SHAREDDEFS_FLIGHTMODE_AUTOTUNE=9, SHAREDDEFS_FLIGHTMODE_ALTITUDEHOLD=10, SHAREDDEFS_FLIGHTMODE_POSITIONHOLD=11, SHAREDDEFS_FLIGHTMODE_RETURNTOHOME=12, SHAREDDEFS_FLIGHTMODE_PATHPLANNER=13, SHAREDDEFS_FLIGHTMODE_TABLETCONTROL=14, SHAREDDEFS_FLIGHTMODE_ACROPLUS=15, SHAREDDEFS_FLIGHTMODE_ACRODYNE=16, SHAREDDEFS_FLIGHTMODE_FAILSAFE=17 }  __attribute__((packed)) SharedDefsFlightModeOptions;
+#define SHAREDDEFS_FLIGHTMODE_GLOBAL_MAXOPTVAL 17
+#define SHAREDDEFS_FLIGHTMODE_MAXOPTVAL 17
+static inline bool SharedDefsFlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode <= SHAREDDEFS_FLIGHTMODE_MAXOPTVAL; }
+// Field StabilizationMode information
+/* Enumeration options for field StabilizationMode */
+typedef enum { SHAREDDEFS_STABILIZATIONMODE_MANUAL=0, SHAREDDEFS_STABILIZATIONMODE_RATE=1, SHAREDDEFS_STABILIZATIONMODE_ATTITUDE=2, SHAREDDEFS_STABILIZATIONMODE_AXISLOCK=3, SHAREDDEFS_STABILIZATIONMODE_WEAKLEVELING=4, SHAREDDEFS_STABILIZATIONMODE_VIRTUALBAR=5, SHAREDDEFS_STABILIZATIONMODE_HORIZON=6, SHAREDDEFS_STABILIZATIONMODE_SYSTEMIDENT=7, SHAREDDEFS_STABILIZATIONMODE_SYSTEMIDENTRATE=8, SHAREDDEFS_STABILIZATIONMODE_POI=9, SHAREDDEFS_STABILIZATIONMODE_COORDINATEDFLIGHT=10, SHAREDDEFS_STABILIZATIONMODE_ACROPLUS=11, SHAREDDEFS_STABILIZATIONMODE_ACRODYNE=12, SHAREDDEFS_STABILIZATIONMODE_DISABLED=13, SHAREDDEFS_STABILIZATIONMODE_FAILSAFE=14 }  __attribute__((packed)) SharedDefsStabilizationModeOptions;
+#define SHAREDDEFS_STABILIZATIONMODE_GLOBAL_MAXOPTVAL 14
+#define SHAREDDEFS_STABILIZATIONMODE_MAXOPTVAL 14
+static inline bool SharedDefsStabilizationModeIsValid( uint8_t CurrentStabilizationMode ) { return CurrentStabilizationMode <= SHAREDDEFS_STABILIZATIONMODE_MAXOPTVAL; }
+// Field ReprojectionMode information
+/* Enumeration options for field ReprojectionMode */
+typedef enum { SHAREDDEFS_REPROJECTIONMODE_NONE=0, SHAREDDEFS_REPROJECTIONMODE_CAMERAANGLE=1, SHAREDDEFS_REPROJECTIONMODE_HEADFREE=2 }  __attribute__((packed)) SharedDefsReprojectionModeOptions;
+#define SHAREDDEFS_REPROJECTIONMODE_GLOBAL_MAXOPTVAL 2
+#define SHAREDDEFS_REPROJECTIONMODE_MAXOPTVAL 2
+static inline bool SharedDefsReprojectionModeIsValid( uint8_t CurrentReprojectionMode ) { return CurrentReprojectionMode <= SHAREDDEFS_REPROJECTIONMODE_MAXOPTVAL; }
+// Field OrientationUnit information
+/* Enumeration options for field OrientationUnit */
+typedef enum { SHAREDDEFS_ORIENTATIONUNIT_EFFORT=0, SHAREDDEFS_ORIENTATIONUNIT_MODESPECIFIC=1, SHAREDDEFS_ORIENTATIONUNIT_DEGREES=2, SHAREDDEFS_ORIENTATIONUNIT_DEGREESPERSEC=3, SHAREDDEFS_ORIENTATIONUNIT_DEGREESPERSEC2=4 }  __attribute__((packed)) SharedDefsOrientationUnitOptions;
+#define SHAREDDEFS_ORIENTATIONUNIT_GLOBAL_MAXOPTVAL 4
+#define SHAREDDEFS_ORIENTATIONUNIT_MAXOPTVAL 4
+static inline bool SharedDefsOrientationUnitIsValid( uint8_t CurrentOrientationUnit ) { return CurrentOrientationUnit <= SHAREDDEFS_ORIENTATIONUNIT_MAXOPTVAL; }
+// Field PositionUnit information
+/* Enumeration options for field PositionUnit */
+typedef enum { SHAREDDEFS_POSITIONUNIT_EFFORT=0, SHAREDDEFS_POSITIONUNIT_MODESPECIFIC=1, SHAREDDEFS_POSITIONUNIT_METERS=2, SHAREDDEFS_POSITIONUNIT_METERSPERSEC=3, SHAREDDEFS_POSITIONUNIT_METERSPERSEC2=4 }  __attribute__((packed)) SharedDefsPositionUnitOptions;
+#define SHAREDDEFS_POSITIONUNIT_GLOBAL_MAXOPTVAL 4
+#define SHAREDDEFS_POSITIONUNIT_MAXOPTVAL 4
+static inline bool SharedDefsPositionUnitIsValid( uint8_t CurrentPositionUnit ) { return CurrentPositionUnit <= SHAREDDEFS_POSITIONUNIT_MAXOPTVAL; }
+// Field AlarmLevels information
+/* Enumeration options for field AlarmLevels */
+typedef enum { SHAREDDEFS_ALARMLEVELS_UNINITIALISED=0, SHAREDDEFS_ALARMLEVELS_OK=1, SHAREDDEFS_ALARMLEVELS_WARNING=2, SHAREDDEFS_ALARMLEVELS_ERROR=3, SHAREDDEFS_ALARMLEVELS_CRITICAL=4, SHAREDDEFS_ALARMLEVELS_HAIRONFIRE=5, SHAREDDEFS_ALARMLEVELS_MANUALCONTROLONLY=6 }  __attribute__((packed)) SharedDefsAlarmLevelsOptions;
+#define SHAREDDEFS_ALARMLEVELS_GLOBAL_MAXOPTVAL 6
+#define SHAREDDEFS_ALARMLEVELS_MAXOPTVAL 6
+static inline bool SharedDefsAlarmLevelsIsValid( uint8_t CurrentAlarmLevels ) { return CurrentAlarmLevels <= SHAREDDEFS_ALARMLEVELS_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void SharedDefsFlightModeSet( uint8_t *NewFlightMode );
+extern void SharedDefsFlightModeGet( uint8_t *NewFlightMode );
+extern void SharedDefsStabilizationModeSet( uint8_t *NewStabilizationMode );
+extern void SharedDefsStabilizationModeGet( uint8_t *NewStabilizationMode );
+extern void SharedDefsReprojectionModeSet( uint8_t *NewReprojectionMode );
+extern void SharedDefsReprojectionModeGet( uint8_t *NewReprojectionMode );
+extern void SharedDefsOrientationUnitSet( uint8_t *NewOrientationUnit );
+extern void SharedDefsOrientationUnitGet( uint8_t *NewOrientationUnit );
+extern void SharedDefsPositionUnitSet( uint8_t *NewPositionUnit );
+extern void SharedDefsPositionUnitGet( uint8_t *NewPositionUnit );
+extern void SharedDefsAlarmLevelsSet( uint8_t *NewAlarmLevels );
+extern void SharedDefsAlarmLevelsGet( uint8_t *NewAlarmLevels );
+
+
+#endif // SHAREDDEFS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,451 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       stabilizationsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the StabilizationSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: stabilizationsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "stabilizationsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const StabilizationSettingsData defaultData = {
+	.ManualRate = { 250, 250, 225 },
+	.AcroDynamicRate = { 0, 0, 0 },
+	.AcroDynamicTau = 0.225,
+	.AutotuneActuationEffort = { 0.065, 0.065, 0.09 },
+	.MaximumRate = { 350, 350, 350 },
+	.PoiMaximumRate = { 30, 30, 30 },
+	.RollRatePID = { 0.002, 0.0015, 0, 0.3 },
+	.PitchRatePID = { 0.002, 0.0015, 0, 0.3 },
+	.YawRatePID = { 0.0035, 0.0035, 0, 0.3 },
+	.RollPI = { 2.5, 0, 50 },
+	.PitchPI = { 2.5, 0, 50 },
+	.YawPI = { 2.5, 0, 50 },
+	.DerivativeGamma = 0.6,
+	.WeakLevelingKp = 0.33,
+	.CoordinatedFlightYawPI = { 0, 0.1, 0.5 },
+	.AcroInsanityFactor = 40,
+	.AcroZeroIntegralGyro = 150,
+	.AcroZeroIntegralStick = 20,
+	.CameraTilt = 0,
+	.MaxLevelAngle = { 55, 55, 35 },
+	.RollMax = 55,
+	.PitchMax = 55,
+	.YawMax = 35,
+	.AcroDynamicTransition = { 70, 70, 70 },
+	.RateExpo = { 35, 35, 30 },
+	.RateExponent = { 30, 30, 30 },
+	.HorizonExpo = { 30, 30, 30 },
+	.DerivativeCutoff = 20,
+	.MaxAxisLock = 15,
+	.MaxAxisLockRate = 2,
+	.MaxWeakLevelingRate = 45,
+	.LowThrottleZeroIntegral = 1,
+	.DeadbandWidth = { 0, 0, 0 },
+	.DeadbandSlope = { 60, 60, 50 },
+	.RCControlSmoothing = { 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t StabilizationSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(STABILIZATIONSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(STABILIZATIONSETTINGS_OBJID,
+			STABILIZATIONSETTINGS_ISSINGLEINST, STABILIZATIONSETTINGS_ISSETTINGS, STABILIZATIONSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void StabilizationSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	StabilizationSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void StabilizationSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void StabilizationSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	StabilizationSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		StabilizationSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle StabilizationSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void StabilizationSettingsManualRateSet( float *NewManualRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewManualRate, offsetof( StabilizationSettingsData, ManualRate), 3*sizeof(float));
+}
+void StabilizationSettingsManualRateGet( float *NewManualRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewManualRate, offsetof( StabilizationSettingsData, ManualRate), 3*sizeof(float));
+}
+void StabilizationSettingsAcroDynamicRateSet( float *NewAcroDynamicRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicRate, offsetof( StabilizationSettingsData, AcroDynamicRate), 3*sizeof(float));
+}
+void StabilizationSettingsAcroDynamicRateGet( float *NewAcroDynamicRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicRate, offsetof( StabilizationSettingsData, AcroDynamicRate), 3*sizeof(float));
+}
+void StabilizationSettingsAcroDynamicTauSet( float *NewAcroDynamicTau )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicTau, offsetof( StabilizationSettingsData, AcroDynamicTau), sizeof(float));
+}
+void StabilizationSettingsAcroDynamicTauGet( float *NewAcroDynamicTau )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicTau, offsetof( StabilizationSettingsData, AcroDynamicTau), sizeof(float));
+}
+void StabilizationSettingsAutotuneActuationEffortSet( float *NewAutotuneActuationEffort )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAutotuneActuationEffort, offsetof( StabilizationSettingsData, AutotuneActuationEffort), 3*sizeof(float));
+}
+void StabilizationSettingsAutotuneActuationEffortGet( float *NewAutotuneActuationEffort )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAutotuneActuationEffort, offsetof( StabilizationSettingsData, AutotuneActuationEffort), 3*sizeof(float));
+}
+void StabilizationSettingsMaximumRateSet( float *NewMaximumRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewMaximumRate, offsetof( StabilizationSettingsData, MaximumRate), 3*sizeof(float));
+}
+void StabilizationSettingsMaximumRateGet( float *NewMaximumRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewMaximumRate, offsetof( StabilizationSettingsData, MaximumRate), 3*sizeof(float));
+}
+void StabilizationSettingsPoiMaximumRateSet( float *NewPoiMaximumRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewPoiMaximumRate, offsetof( StabilizationSettingsData, PoiMaximumRate), 3*sizeof(float));
+}
+void StabilizationSettingsPoiMaximumRateGet( float *NewPoiMaximumRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewPoiMaximumRate, offsetof( StabilizationSettingsData, PoiMaximumRate), 3*sizeof(float));
+}
+void StabilizationSettingsRollRatePIDSet( float *NewRollRatePID )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRollRatePID, offsetof( StabilizationSettingsData, RollRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsRollRatePIDGet( float *NewRollRatePID )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRollRatePID, offsetof( StabilizationSettingsData, RollRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsPitchRatePIDSet( float *NewPitchRatePID )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewPitchRatePID, offsetof( StabilizationSettingsData, PitchRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsPitchRatePIDGet( float *NewPitchRatePID )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewPitchRatePID, offsetof( StabilizationSettingsData, PitchRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsYawRatePIDSet( float *NewYawRatePID )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewYawRatePID, offsetof( StabilizationSettingsData, YawRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsYawRatePIDGet( float *NewYawRatePID )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewYawRatePID, offsetof( StabilizationSettingsData, YawRatePID), 4*sizeof(float));
+}
+void StabilizationSettingsRollPISet( float *NewRollPI )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRollPI, offsetof( StabilizationSettingsData, RollPI), 3*sizeof(float));
+}
+void StabilizationSettingsRollPIGet( float *NewRollPI )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRollPI, offsetof( StabilizationSettingsData, RollPI), 3*sizeof(float));
+}
+void StabilizationSettingsPitchPISet( float *NewPitchPI )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewPitchPI, offsetof( StabilizationSettingsData, PitchPI), 3*sizeof(float));
+}
+void StabilizationSettingsPitchPIGet( float *NewPitchPI )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewPitchPI, offsetof( StabilizationSettingsData, PitchPI), 3*sizeof(float));
+}
+void StabilizationSettingsYawPISet( float *NewYawPI )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewYawPI, offsetof( StabilizationSettingsData, YawPI), 3*sizeof(float));
+}
+void StabilizationSettingsYawPIGet( float *NewYawPI )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewYawPI, offsetof( StabilizationSettingsData, YawPI), 3*sizeof(float));
+}
+void StabilizationSettingsDerivativeGammaSet( float *NewDerivativeGamma )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewDerivativeGamma, offsetof( StabilizationSettingsData, DerivativeGamma), sizeof(float));
+}
+void StabilizationSettingsDerivativeGammaGet( float *NewDerivativeGamma )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewDerivativeGamma, offsetof( StabilizationSettingsData, DerivativeGamma), sizeof(float));
+}
+void StabilizationSettingsWeakLevelingKpSet( float *NewWeakLevelingKp )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewWeakLevelingKp, offsetof( StabilizationSettingsData, WeakLevelingKp), sizeof(float));
+}
+void StabilizationSettingsWeakLevelingKpGet( float *NewWeakLevelingKp )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewWeakLevelingKp, offsetof( StabilizationSettingsData, WeakLevelingKp), sizeof(float));
+}
+void StabilizationSettingsCoordinatedFlightYawPISet( float *NewCoordinatedFlightYawPI )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewCoordinatedFlightYawPI, offsetof( StabilizationSettingsData, CoordinatedFlightYawPI), 3*sizeof(float));
+}
+void StabilizationSettingsCoordinatedFlightYawPIGet( float *NewCoordinatedFlightYawPI )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewCoordinatedFlightYawPI, offsetof( StabilizationSettingsData, CoordinatedFlightYawPI), 3*sizeof(float));
+}
+void StabilizationSettingsAcroInsanityFactorSet( float *NewAcroInsanityFactor )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroInsanityFactor, offsetof( StabilizationSettingsData, AcroInsanityFactor), sizeof(float));
+}
+void StabilizationSettingsAcroInsanityFactorGet( float *NewAcroInsanityFactor )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroInsanityFactor, offsetof( StabilizationSettingsData, AcroInsanityFactor), sizeof(float));
+}
+void StabilizationSettingsAcroZeroIntegralGyroSet( float *NewAcroZeroIntegralGyro )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroZeroIntegralGyro, offsetof( StabilizationSettingsData, AcroZeroIntegralGyro), sizeof(float));
+}
+void StabilizationSettingsAcroZeroIntegralGyroGet( float *NewAcroZeroIntegralGyro )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroZeroIntegralGyro, offsetof( StabilizationSettingsData, AcroZeroIntegralGyro), sizeof(float));
+}
+void StabilizationSettingsAcroZeroIntegralStickSet( float *NewAcroZeroIntegralStick )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroZeroIntegralStick, offsetof( StabilizationSettingsData, AcroZeroIntegralStick), sizeof(float));
+}
+void StabilizationSettingsAcroZeroIntegralStickGet( float *NewAcroZeroIntegralStick )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroZeroIntegralStick, offsetof( StabilizationSettingsData, AcroZeroIntegralStick), sizeof(float));
+}
+void StabilizationSettingsCameraTiltSet( float *NewCameraTilt )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewCameraTilt, offsetof( StabilizationSettingsData, CameraTilt), sizeof(float));
+}
+void StabilizationSettingsCameraTiltGet( float *NewCameraTilt )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewCameraTilt, offsetof( StabilizationSettingsData, CameraTilt), sizeof(float));
+}
+void StabilizationSettingsMaxLevelAngleSet( uint8_t *NewMaxLevelAngle )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewMaxLevelAngle, offsetof( StabilizationSettingsData, MaxLevelAngle), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsMaxLevelAngleGet( uint8_t *NewMaxLevelAngle )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewMaxLevelAngle, offsetof( StabilizationSettingsData, MaxLevelAngle), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRollMaxSet( uint8_t *NewRollMax )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRollMax, offsetof( StabilizationSettingsData, RollMax), sizeof(uint8_t));
+}
+void StabilizationSettingsRollMaxGet( uint8_t *NewRollMax )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRollMax, offsetof( StabilizationSettingsData, RollMax), sizeof(uint8_t));
+}
+void StabilizationSettingsPitchMaxSet( uint8_t *NewPitchMax )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewPitchMax, offsetof( StabilizationSettingsData, PitchMax), sizeof(uint8_t));
+}
+void StabilizationSettingsPitchMaxGet( uint8_t *NewPitchMax )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewPitchMax, offsetof( StabilizationSettingsData, PitchMax), sizeof(uint8_t));
+}
+void StabilizationSettingsYawMaxSet( uint8_t *NewYawMax )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewYawMax, offsetof( StabilizationSettingsData, YawMax), sizeof(uint8_t));
+}
+void StabilizationSettingsYawMaxGet( uint8_t *NewYawMax )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewYawMax, offsetof( StabilizationSettingsData, YawMax), sizeof(uint8_t));
+}
+void StabilizationSettingsAcroDynamicTransitionSet( uint8_t *NewAcroDynamicTransition )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicTransition, offsetof( StabilizationSettingsData, AcroDynamicTransition), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsAcroDynamicTransitionGet( uint8_t *NewAcroDynamicTransition )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewAcroDynamicTransition, offsetof( StabilizationSettingsData, AcroDynamicTransition), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRateExpoSet( uint8_t *NewRateExpo )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRateExpo, offsetof( StabilizationSettingsData, RateExpo), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRateExpoGet( uint8_t *NewRateExpo )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRateExpo, offsetof( StabilizationSettingsData, RateExpo), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRateExponentSet( uint8_t *NewRateExponent )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRateExponent, offsetof( StabilizationSettingsData, RateExponent), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRateExponentGet( uint8_t *NewRateExponent )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRateExponent, offsetof( StabilizationSettingsData, RateExponent), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsHorizonExpoSet( uint8_t *NewHorizonExpo )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewHorizonExpo, offsetof( StabilizationSettingsData, HorizonExpo), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsHorizonExpoGet( uint8_t *NewHorizonExpo )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewHorizonExpo, offsetof( StabilizationSettingsData, HorizonExpo), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsDerivativeCutoffSet( uint8_t *NewDerivativeCutoff )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewDerivativeCutoff, offsetof( StabilizationSettingsData, DerivativeCutoff), sizeof(uint8_t));
+}
+void StabilizationSettingsDerivativeCutoffGet( uint8_t *NewDerivativeCutoff )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewDerivativeCutoff, offsetof( StabilizationSettingsData, DerivativeCutoff), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxAxisLockSet( uint8_t *NewMaxAxisLock )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewMaxAxisLock, offsetof( StabilizationSettingsData, MaxAxisLock), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxAxisLockGet( uint8_t *NewMaxAxisLock )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewMaxAxisLock, offsetof( StabilizationSettingsData, MaxAxisLock), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxAxisLockRateSet( uint8_t *NewMaxAxisLockRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewMaxAxisLockRate, offsetof( StabilizationSettingsData, MaxAxisLockRate), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxAxisLockRateGet( uint8_t *NewMaxAxisLockRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewMaxAxisLockRate, offsetof( StabilizationSettingsData, MaxAxisLockRate), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxWeakLevelingRateSet( uint8_t *NewMaxWeakLevelingRate )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewMaxWeakLevelingRate, offsetof( StabilizationSettingsData, MaxWeakLevelingRate), sizeof(uint8_t));
+}
+void StabilizationSettingsMaxWeakLevelingRateGet( uint8_t *NewMaxWeakLevelingRate )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewMaxWeakLevelingRate, offsetof( StabilizationSettingsData, MaxWeakLevelingRate), sizeof(uint8_t));
+}
+void StabilizationSettingsLowThrottleZeroIntegralSet( uint8_t *NewLowThrottleZeroIntegral )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewLowThrottleZeroIntegral, offsetof( StabilizationSettingsData, LowThrottleZeroIntegral), sizeof(uint8_t));
+}
+void StabilizationSettingsLowThrottleZeroIntegralGet( uint8_t *NewLowThrottleZeroIntegral )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewLowThrottleZeroIntegral, offsetof( StabilizationSettingsData, LowThrottleZeroIntegral), sizeof(uint8_t));
+}
+void StabilizationSettingsDeadbandWidthSet( uint8_t *NewDeadbandWidth )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewDeadbandWidth, offsetof( StabilizationSettingsData, DeadbandWidth), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsDeadbandWidthGet( uint8_t *NewDeadbandWidth )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewDeadbandWidth, offsetof( StabilizationSettingsData, DeadbandWidth), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsDeadbandSlopeSet( uint8_t *NewDeadbandSlope )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewDeadbandSlope, offsetof( StabilizationSettingsData, DeadbandSlope), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsDeadbandSlopeGet( uint8_t *NewDeadbandSlope )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewDeadbandSlope, offsetof( StabilizationSettingsData, DeadbandSlope), 3*sizeof(uint8_t));
+}
+void StabilizationSettingsRCControlSmoothingSet( uint8_t *NewRCControlSmoothing )
+{
+	UAVObjSetDataField(StabilizationSettingsHandle(), (void*)NewRCControlSmoothing, offsetof( StabilizationSettingsData, RCControlSmoothing), 2*sizeof(uint8_t));
+}
+void StabilizationSettingsRCControlSmoothingGet( uint8_t *NewRCControlSmoothing )
+{
+	UAVObjGetDataField(StabilizationSettingsHandle(), (void*)NewRCControlSmoothing, offsetof( StabilizationSettingsData, RCControlSmoothing), 2*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
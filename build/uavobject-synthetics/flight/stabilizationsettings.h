@@ -0,0 +1,306 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup StabilizationSettings StabilizationSettings
+ * @brief PID settings used by the Stabilization module to combine the @ref AttitudeActual and @ref AttitudeDesired to compute @ref ActuatorDesired
+ *
+ *
+ * @file       stabilizationsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the StabilizationSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: stabilizationsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef STABILIZATIONSETTINGS_H
+#define STABILIZATIONSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define STABILIZATIONSETTINGS_OBJID 0x71CD7A94
+#define STABILIZATIONSETTINGS_ISSINGLEINST 1
+#define STABILIZATIONSETTINGS_ISSETTINGS 1
+#define STABILIZATIONSETTINGS_NUMBYTES 215
+
+// Generic interface functions
+int32_t StabilizationSettingsInitialize();
+UAVObjHandle StabilizationSettingsHandle();
+void StabilizationSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float ManualRate[3];
+    float AcroDynamicRate[3];
+    float AcroDynamicTau;
+    float AutotuneActuationEffort[3];
+    float MaximumRate[3];
+    float PoiMaximumRate[3];
+    float RollRatePID[4];
+    float PitchRatePID[4];
+    float YawRatePID[4];
+    float RollPI[3];
+    float PitchPI[3];
+    float YawPI[3];
+    float DerivativeGamma;
+    float WeakLevelingKp;
+    float CoordinatedFlightYawPI[3];
+    float AcroInsanityFactor;
+    float AcroZeroIntegralGyro;
+    float AcroZeroIntegralStick;
+    float CameraTilt;
+    uint8_t MaxLevelAngle[3];
+    uint8_t RollMax;
+    uint8_t PitchMax;
+    uint8_t YawMax;
+    uint8_t AcroDynamicTransition[3];
+    uint8_t RateExpo[3];
+    uint8_t RateExponent[3];
+    uint8_t HorizonExpo[3];
+    uint8_t DerivativeCutoff;
+    uint8_t MaxAxisLock;
+    uint8_t MaxAxisLockRate;
+    uint8_t MaxWeakLevelingRate;
+    uint8_t LowThrottleZeroIntegral;
+    uint8_t DeadbandWidth[3];
+    uint8_t DeadbandSlope[3];
+    uint8_t RCControlSmoothing[2];
+
+} __attribute__((packed)) __attribute__((aligned(4))) StabilizationSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function StabilizationSettingsGet(dataOut)
+ * @brief Populate a StabilizationSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t StabilizationSettingsGet(StabilizationSettingsData *dataOut) { return UAVObjGetData(StabilizationSettingsHandle(), dataOut); }
+
+static inline int32_t StabilizationSettingsSet(const StabilizationSettingsData *dataIn) { return UAVObjSetData(StabilizationSettingsHandle(), dataIn); }
+
+static inline int32_t StabilizationSettingsInstGet(uint16_t instId, StabilizationSettingsData *dataOut) { return UAVObjGetInstanceData(StabilizationSettingsHandle(), instId, dataOut); }
+
+static inline int32_t StabilizationSettingsInstSet(uint16_t instId, const StabilizationSettingsData *dataIn) { return UAVObjSetInstanceData(StabilizationSettingsHandle(), instId, dataIn); }
+
+static inline int32_t StabilizationSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(StabilizationSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(StabilizationSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(StabilizationSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCopy(volatile StabilizationSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	StabilizationSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(StabilizationSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t StabilizationSettingsCreateInstance() { return UAVObjCreateInstance(StabilizationSettingsHandle(), &StabilizationSettingsSetDefaults); }
+
+static inline void StabilizationSettingsUpdated() { UAVObjUpdated(StabilizationSettingsHandle()); }
+
+static inline void StabilizationSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(StabilizationSettingsHandle(), instId); }
+
+static inline int32_t StabilizationSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(StabilizationSettingsHandle(), dataOut); }
+
+static inline int32_t StabilizationSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(StabilizationSettingsHandle(), dataIn); }
+
+static inline int8_t StabilizationSettingsReadOnly() { return UAVObjReadOnly(StabilizationSettingsHandle()); }
+
+static inline uint16_t StabilizationSettingsGetNumInstances(){ return UAVObjGetNumInstances(StabilizationSettingsHandle()); }
+
+static inline uint32_t StabilizationSettingsGetNumBytes(){ return UAVObjGetNumBytes(StabilizationSettingsHandle()); }
+
+// Field information
+// Field ManualRate information
+typedef enum { STABILIZATIONSETTINGS_MANUALRATE_ROLL=0, STABILIZATIONSETTINGS_MANUALRATE_PITCH=1, STABILIZATIONSETTINGS_MANUALRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsManualRateElem;
+#define STABILIZATIONSETTINGS_MANUALRATE_NUMELEM 3
+// Field AcroDynamicRate information
+typedef enum { STABILIZATIONSETTINGS_ACRODYNAMICRATE_ROLL=0, STABILIZATIONSETTINGS_ACRODYNAMICRATE_PITCH=1, STABILIZATIONSETTINGS_ACRODYNAMICRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsAcroDynamicRateElem;
+#define STABILIZATIONSETTINGS_ACRODYNAMICRATE_NUMELEM 3
+// Field AcroDynamicTau information
+// Field AutotuneActuationEffort information
+typedef enum { STABILIZATIONSETTINGS_AUTOTUNEACTUATIONEFFORT_ROLL=0, STABILIZATIONSETTINGS_AUTOTUNEACTUATIONEFFORT_PITCH=1, STABILIZATIONSETTINGS_AUTOTUNEACTUATIONEFFORT_YAW=2 } __attribute__((packed)) StabilizationSettingsAutotuneActuationEffortElem;
+#define STABILIZATIONSETTINGS_AUTOTUNEACTUATIONEFFORT_NUMELEM 3
+// Field MaximumRate information
+typedef enum { STABILIZATIONSETTINGS_MAXIMUMRATE_ROLL=0, STABILIZATIONSETTINGS_MAXIMUMRATE_PITCH=1, STABILIZATIONSETTINGS_MAXIMUMRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsMaximumRateElem;
+#define STABILIZATIONSETTINGS_MAXIMUMRATE_NUMELEM 3
+// Field PoiMaximumRate information
+typedef enum { STABILIZATIONSETTINGS_POIMAXIMUMRATE_ROLL=0, STABILIZATIONSETTINGS_POIMAXIMUMRATE_PITCH=1, STABILIZATIONSETTINGS_POIMAXIMUMRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsPoiMaximumRateElem;
+#define STABILIZATIONSETTINGS_POIMAXIMUMRATE_NUMELEM 3
+// Field RollRatePID information
+typedef enum { STABILIZATIONSETTINGS_ROLLRATEPID_KP=0, STABILIZATIONSETTINGS_ROLLRATEPID_KI=1, STABILIZATIONSETTINGS_ROLLRATEPID_KD=2, STABILIZATIONSETTINGS_ROLLRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsRollRatePIDElem;
+#define STABILIZATIONSETTINGS_ROLLRATEPID_NUMELEM 4
+// Field PitchRatePID information
+typedef enum { STABILIZATIONSETTINGS_PITCHRATEPID_KP=0, STABILIZATIONSETTINGS_PITCHRATEPID_KI=1, STABILIZATIONSETTINGS_PITCHRATEPID_KD=2, STABILIZATIONSETTINGS_PITCHRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsPitchRatePIDElem;
+#define STABILIZATIONSETTINGS_PITCHRATEPID_NUMELEM 4
+// Field YawRatePID information
+typedef enum { STABILIZATIONSETTINGS_YAWRATEPID_KP=0, STABILIZATIONSETTINGS_YAWRATEPID_KI=1, STABILIZATIONSETTINGS_YAWRATEPID_KD=2, STABILIZATIONSETTINGS_YAWRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsYawRatePIDElem;
+#define STABILIZATIONSETTINGS_YAWRATEPID_NUMELEM 4
+// Field RollPI information
+typedef enum { STABILIZATIONSETTINGS_ROLLPI_KP=0, STABILIZATIONSETTINGS_ROLLPI_KI=1, STABILIZATIONSETTINGS_ROLLPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsRollPIElem;
+#define STABILIZATIONSETTINGS_ROLLPI_NUMELEM 3
+// Field PitchPI information
+typedef enum { STABILIZATIONSETTINGS_PITCHPI_KP=0, STABILIZATIONSETTINGS_PITCHPI_KI=1, STABILIZATIONSETTINGS_PITCHPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsPitchPIElem;
+#define STABILIZATIONSETTINGS_PITCHPI_NUMELEM 3
+// Field YawPI information
+typedef enum { STABILIZATIONSETTINGS_YAWPI_KP=0, STABILIZATIONSETTINGS_YAWPI_KI=1, STABILIZATIONSETTINGS_YAWPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsYawPIElem;
+#define STABILIZATIONSETTINGS_YAWPI_NUMELEM 3
+// Field DerivativeGamma information
+// Field WeakLevelingKp information
+// Field CoordinatedFlightYawPI information
+typedef enum { STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_KP=0, STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_KI=1, STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsCoordinatedFlightYawPIElem;
+#define STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_NUMELEM 3
+// Field AcroInsanityFactor information
+// Field AcroZeroIntegralGyro information
+// Field AcroZeroIntegralStick information
+// Field CameraTilt information
+// Field MaxLevelAngle information
+typedef enum { STABILIZATIONSETTINGS_MAXLEVELANGLE_ROLL=0, STABILIZATIONSETTINGS_MAXLEVELANGLE_PITCH=1, STABILIZATIONSETTINGS_MAXLEVELANGLE_YAW=2 } __attribute__((packed)) StabilizationSettingsMaxLevelAngleElem;
+#define STABILIZATIONSETTINGS_MAXLEVELANGLE_NUMELEM 3
+// Field RollMax information
+// Field PitchMax information
+// Field YawMax information
+// Field AcroDynamicTransition information
+typedef enum { STABILIZATIONSETTINGS_ACRODYNAMICTRANSITION_ROLL=0, STABILIZATIONSETTINGS_ACRODYNAMICTRANSITION_PITCH=1, STABILIZATIONSETTINGS_ACRODYNAMICTRANSITION_YAW=2 } __attribute__((packed)) StabilizationSettingsAcroDynamicTransitionElem;
+#define STABILIZATIONSETTINGS_ACRODYNAMICTRANSITION_NUMELEM 3
+// Field RateExpo information
+typedef enum { STABILIZATIONSETTINGS_RATEEXPO_ROLL=0, STABILIZATIONSETTINGS_RATEEXPO_PITCH=1, STABILIZATIONSETTINGS_RATEEXPO_YAW=2 } __attribute__((packed)) StabilizationSettingsRateExpoElem;
+#define STABILIZATIONSETTINGS_RATEEXPO_NUMELEM 3
+// Field RateExponent information
+typedef enum { STABILIZATIONSETTINGS_RATEEXPONENT_ROLL=0, STABILIZATIONSETTINGS_RATEEXPONENT_PITCH=1, STABILIZATIONSETTINGS_RATEEXPONENT_YAW=2 } __attribute__((packed)) StabilizationSettingsRateExponentElem;
+#define STABILIZATIONSETTINGS_RATEEXPONENT_NUMELEM 3
+// Field HorizonExpo information
+typedef enum { STABILIZATIONSETTINGS_HORIZONEXPO_ROLL=0, STABILIZATIONSETTINGS_HORIZONEXPO_PITCH=1, STABILIZATIONSETTINGS_HORIZONEXPO_YAW=2 } __attribute__((packed)) StabilizationSettingsHorizonExpoElem;
+#define STABILIZATIONSETTINGS_HORIZONEXPO_NUMELEM 3
+// Field DerivativeCutoff information
+// Field MaxAxisLock information
+// Field MaxAxisLockRate information
+// Field MaxWeakLevelingRate information
+// Field LowThrottleZeroIntegral information
+/* Enumeration options for field LowThrottleZeroIntegral */
+typedef enum { STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_FALSE=0, STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_TRUE=1 }  __attribute__((packed)) StabilizationSettingsLowThrottleZeroIntegralOptions;
+#define STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_GLOBAL_MAXOPTVAL 1
+#define STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_MAXOPTVAL 1
+static inline bool StabilizationSettingsLowThrottleZeroIntegralIsValid( uint8_t CurrentLowThrottleZeroIntegral ) { return CurrentLowThrottleZeroIntegral <= STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_MAXOPTVAL; }
+// Field DeadbandWidth information
+typedef enum { STABILIZATIONSETTINGS_DEADBANDWIDTH_ROLL=0, STABILIZATIONSETTINGS_DEADBANDWIDTH_PITCH=1, STABILIZATIONSETTINGS_DEADBANDWIDTH_YAW=2 } __attribute__((packed)) StabilizationSettingsDeadbandWidthElem;
+#define STABILIZATIONSETTINGS_DEADBANDWIDTH_NUMELEM 3
+// Field DeadbandSlope information
+typedef enum { STABILIZATIONSETTINGS_DEADBANDSLOPE_ROLL=0, STABILIZATIONSETTINGS_DEADBANDSLOPE_PITCH=1, STABILIZATIONSETTINGS_DEADBANDSLOPE_YAW=2 } __attribute__((packed)) StabilizationSettingsDeadbandSlopeElem;
+#define STABILIZATIONSETTINGS_DEADBANDSLOPE_NUMELEM 3
+// Field RCControlSmoothing information
+/* Enumeration options for field RCControlSmoothing */
+typedef enum { STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_NONE=0, STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_NORMAL=1, STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_EXTENDED=2 }  __attribute__((packed)) StabilizationSettingsRCControlSmoothingOptions;
+#define STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_GLOBAL_MAXOPTVAL 2
+#define STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_MAXOPTVAL 2
+static inline bool StabilizationSettingsRCControlSmoothingIsValid( uint8_t CurrentRCControlSmoothing ) { return CurrentRCControlSmoothing <= STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_MAXOPTVAL; }
+typedef enum { STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_AXES=0, STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_THRUST=1 } __attribute__((packed)) StabilizationSettingsRCControlSmoothingElem;
+#define STABILIZATIONSETTINGS_RCCONTROLSMOOTHING_NUMELEM 2
+
+
+// set/Get functions
+extern void StabilizationSettingsManualRateSet( float *NewManualRate );
+extern void StabilizationSettingsManualRateGet( float *NewManualRate );
+extern void StabilizationSettingsAcroDynamicRateSet( float *NewAcroDynamicRate );
+extern void StabilizationSettingsAcroDynamicRateGet( float *NewAcroDynamicRate );
+extern void StabilizationSettingsAcroDynamicTauSet( float *NewAcroDynamicTau );
+extern void StabilizationSettingsAcroDynamicTauGet( float *NewAcroDynamicTau );
+extern void StabilizationSettingsAutotuneActuationEffortSet( float *NewAutotuneActuationEffort );
+extern void StabilizationSettingsAutotuneActuationEffortGet( float *NewAutotuneActuationEffort );
+extern void StabilizationSettingsMaximumRateSet( float *NewMaximumRate );
+extern void StabilizationSettingsMaximumRateGet( float *NewMaximumRate );
+extern void StabilizationSettingsPoiMaximumRateSet( float *NewPoiMaximumRate );
+extern void StabilizationSettingsPoiMaximumRateGet( float *NewPoiMaximumRate );
+extern void StabilizationSettingsRollRatePIDSet( float *NewRollRatePID );
+extern void StabilizationSettingsRollRatePIDGet( float *NewRollRatePID );
+extern void StabilizationSettingsPitchRatePIDSet( float *NewPitchRatePID );
+extern void StabilizationSettingsPitchRatePIDGet( float *NewPitchRatePID );
+extern void StabilizationSettingsYawRatePIDSet( float *NewYawRatePID );
+extern void StabilizationSettingsYawRatePIDGet( float *NewYawRatePID );
+extern void StabilizationSettingsRollPISet( float *NewRollPI );
+extern void StabilizationSettingsRollPIGet( float *NewRollPI );
+extern void StabilizationSettingsPitchPISet( float *NewPitchPI );
+extern void StabilizationSettingsPitchPIGet( float *NewPitchPI );
+extern void StabilizationSettingsYawPISet( float *NewYawPI );
+extern void StabilizationSettingsYawPIGet( float *NewYawPI );
+extern void StabilizationSettingsDerivativeGammaSet( float *NewDerivativeGamma );
+extern void StabilizationSettingsDerivativeGammaGet( float *NewDerivativeGamma );
+extern void StabilizationSettingsWeakLevelingKpSet( float *NewWeakLevelingKp );
+extern void StabilizationSettingsWeakLevelingKpGet( float *NewWeakLevelingKp );
+extern void StabilizationSettingsCoordinatedFlightYawPISet( float *NewCoordinatedFlightYawPI );
+extern void StabilizationSettingsCoordinatedFlightYawPIGet( float *NewCoordinatedFlightYawPI );
+extern void StabilizationSettingsAcroInsanityFactorSet( float *NewAcroInsanityFactor );
+extern void StabilizationSettingsAcroInsanityFactorGet( float *NewAcroInsanityFactor );
+extern void StabilizationSettingsAcroZeroIntegralGyroSet( float *NewAcroZeroIntegralGyro );
+extern void StabilizationSettingsAcroZeroIntegralGyroGet( float *NewAcroZeroIntegralGyro );
+extern void StabilizationSettingsAcroZeroIntegralStickSet( float *NewAcroZeroIntegralStick );
+extern void StabilizationSettingsAcroZeroIntegralStickGet( float *NewAcroZeroIntegralStick );
+extern void StabilizationSettingsCameraTiltSet( float *NewCameraTilt );
+extern void StabilizationSettingsCameraTiltGet( float *NewCameraTilt );
+extern void StabilizationSettingsMaxLevelAngleSet( uint8_t *NewMaxLevelAngle );
+extern void StabilizationSettingsMaxLevelAngleGet( uint8_t *NewMaxLevelAngle );
+extern void StabilizationSettingsRollMaxSet( uint8_t *NewRollMax );
+extern void StabilizationSettingsRollMaxGet( uint8_t *NewRollMax );
+extern void StabilizationSettingsPitchMaxSet( uint8_t *NewPitchMax );
+extern void StabilizationSettingsPitchMaxGet( uint8_t *NewPitchMax );
+extern void StabilizationSettingsYawMaxSet( uint8_t *NewYawMax );
+extern void StabilizationSettingsYawMaxGet( uint8_t *NewYawMax );
+extern void StabilizationSettingsAcroDynamicTransitionSet( uint8_t *NewAcroDynamicTransition );
+extern void StabilizationSettingsAcroDynamicTransitionGet( uint8_t *NewAcroDynamicTransition );
+extern void StabilizationSettingsRateExpoSet( uint8_t *NewRateExpo );
+extern void StabilizationSettingsRateExpoGet( uint8_t *NewRateExpo );
+extern void StabilizationSettingsRateExponentSet( uint8_t *NewRateExponent );
+extern void StabilizationSettingsRateExponentGet( uint8_t *NewRateExponent );
+extern void StabilizationSettingsHorizonExpoSet( uint8_t *NewHorizonExpo );
+extern void StabilizationSettingsHorizonExpoGet( uint8_t *NewHorizonExpo );
+extern void StabilizationSettingsDerivativeCutoffSet( uint8_t *NewDerivativeCutoff );
+extern void StabilizationSettingsDerivativeCutoffGet( uint8_t *NewDerivativeCutoff );
+extern void StabilizationSettingsMaxAxisLockSet( uint8_t *NewMaxAxisLock );
+extern void StabilizationSettingsMaxAxisLockGet( uint8_t *NewMaxAxisLock );
+extern void StabilizationSettingsMaxAxisLockRateSet( uint8_t *NewMaxAxisLockRate );
+extern void StabilizationSettingsMaxAxisLockRateGet( uint8_t *NewMaxAxisLockRate );
+extern void StabilizationSettingsMaxWeakLevelingRateSet( uint8_t *NewMaxWeakLevelingRate );
+extern void StabilizationSettingsMaxWeakLevelingRateGet( uint8_t *NewMaxWeakLevelingRate );
+extern void StabilizationSettingsLowThrottleZeroIntegralSet( uint8_t *NewLowThrottleZeroIntegral );
+extern void StabilizationSettingsLowThrottleZeroIntegralGet( uint8_t *NewLowThrottleZeroIntegral );
+extern void StabilizationSettingsDeadbandWidthSet( uint8_t *NewDeadbandWidth );
+extern void StabilizationSettingsDeadbandWidthGet( uint8_t *NewDeadbandWidth );
+extern void StabilizationSettingsDeadbandSlopeSet( uint8_t *NewDeadbandSlope );
+extern void StabilizationSettingsDeadbandSlopeGet( uint8_t *NewDeadbandSlope );
+extern void StabilizationSettingsRCControlSmoothingSet( uint8_t *NewRCControlSmoothing );
+extern void StabilizationSettingsRCControlSmoothingGet( uint8_t *NewRCControlSmoothing );
+
+
+#endif // STABILIZATIONSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup SubTrim SubTrim
+ * @brief The trim angle required for the UAV to fly straight and level.
+ *
+ *
+ * @file       subtrim.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the SubTrim object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: subtrim.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SUBTRIM_H
+#define SUBTRIM_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define SUBTRIM_OBJID 0x966ABE9A
+#define SUBTRIM_ISSINGLEINST 1
+#define SUBTRIM_ISSETTINGS 0
+#define SUBTRIM_NUMBYTES 8
+
+// Generic interface functions
+int32_t SubTrimInitialize();
+UAVObjHandle SubTrimHandle();
+void SubTrimSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Roll;
+    float Pitch;
+
+} __attribute__((packed)) __attribute__((aligned(4))) SubTrimData;
+
+// Typesafe Object access functions
+/**
+ * @function SubTrimGet(dataOut)
+ * @brief Populate a SubTrimData object
+ * @param[out] dataOut 
+ */
+static inline int32_t SubTrimGet(SubTrimData *dataOut) { return UAVObjGetData(SubTrimHandle(), dataOut); }
+
+static inline int32_t SubTrimSet(const SubTrimData *dataIn) { return UAVObjSetData(SubTrimHandle(), dataIn); }
+
+static inline int32_t SubTrimInstGet(uint16_t instId, SubTrimData *dataOut) { return UAVObjGetInstanceData(SubTrimHandle(), instId, dataOut); }
+
+static inline int32_t SubTrimInstSet(uint16_t instId, const SubTrimData *dataIn) { return UAVObjSetInstanceData(SubTrimHandle(), instId, dataIn); }
+
+static inline int32_t SubTrimConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(SubTrimHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(SubTrimHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(SubTrimHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimConnectCopy(volatile SubTrimData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	SubTrimGet((void *) dataOut);
+
+	return UAVObjConnectCallback(SubTrimHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t SubTrimCreateInstance() { return UAVObjCreateInstance(SubTrimHandle(), &SubTrimSetDefaults); }
+
+static inline void SubTrimUpdated() { UAVObjUpdated(SubTrimHandle()); }
+
+static inline void SubTrimInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(SubTrimHandle(), instId); }
+
+static inline int32_t SubTrimGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(SubTrimHandle(), dataOut); }
+
+static inline int32_t SubTrimSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(SubTrimHandle(), dataIn); }
+
+static inline int8_t SubTrimReadOnly() { return UAVObjReadOnly(SubTrimHandle()); }
+
+static inline uint16_t SubTrimGetNumInstances(){ return UAVObjGetNumInstances(SubTrimHandle()); }
+
+static inline uint32_t SubTrimGetNumBytes(){ return UAVObjGetNumBytes(SubTrimHandle()); }
+
+// Field information
+// Field Roll information
+// Field Pitch information
+
+
+// set/Get functions
+extern void SubTrimRollSet( float *NewRoll );
+extern void SubTrimRollGet( float *NewRoll );
+extern void SubTrimPitchSet( float *NewPitch );
+extern void SubTrimPitchGet( float *NewPitch );
+
+
+#endif // SUBTRIM_H
+
+/**
+ * @}
+ * @}
+ */
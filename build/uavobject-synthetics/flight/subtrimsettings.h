@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup SubTrimSettings SubTrimSettings
+ * @brief The trim angle required for the UAV to fly straight and level.
+ *
+ *
+ * @file       subtrimsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the SubTrimSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: subtrimsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SUBTRIMSETTINGS_H
+#define SUBTRIMSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define SUBTRIMSETTINGS_OBJID 0x2DD579BE
+#define SUBTRIMSETTINGS_ISSINGLEINST 1
+#define SUBTRIMSETTINGS_ISSETTINGS 1
+#define SUBTRIMSETTINGS_NUMBYTES 8
+
+// Generic interface functions
+int32_t SubTrimSettingsInitialize();
+UAVObjHandle SubTrimSettingsHandle();
+void SubTrimSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Roll;
+    float Pitch;
+
+} __attribute__((packed)) __attribute__((aligned(4))) SubTrimSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function SubTrimSettingsGet(dataOut)
+ * @brief Populate a SubTrimSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t SubTrimSettingsGet(SubTrimSettingsData *dataOut) { return UAVObjGetData(SubTrimSettingsHandle(), dataOut); }
+
+static inline int32_t SubTrimSettingsSet(const SubTrimSettingsData *dataIn) { return UAVObjSetData(SubTrimSettingsHandle(), dataIn); }
+
+static inline int32_t SubTrimSettingsInstGet(uint16_t instId, SubTrimSettingsData *dataOut) { return UAVObjGetInstanceData(SubTrimSettingsHandle(), instId, dataOut); }
+
+static inline int32_t SubTrimSettingsInstSet(uint16_t instId, const SubTrimSettingsData *dataIn) { return UAVObjSetInstanceData(SubTrimSettingsHandle(), instId, dataIn); }
+
+static inline int32_t SubTrimSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(SubTrimSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(SubTrimSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(SubTrimSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t SubTrimSettingsConnectCopy(volatile SubTrimSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	SubTrimSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(SubTrimSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t SubTrimSettingsCreateInstance() { return UAVObjCreateInstance(SubTrimSettingsHandle(), &SubTrimSettingsSetDefaults); }
+
+static inline void SubTrimSettingsUpdated() { UAVObjUpdated(SubTrimSettingsHandle()); }
+
+static inline void SubTrimSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(SubTrimSettingsHandle(), instId); }
+
+static inline int32_t SubTrimSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(SubTrimSettingsHandle(), dataOut); }
+
+static inline int32_t SubTrimSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(SubTrimSettingsHandle(), dataIn); }
+
+static inline int8_t SubTrimSettingsReadOnly() { return UAVObjReadOnly(SubTrimSettingsHandle()); }
+
+static inline uint16_t SubTrimSettingsGetNumInstances(){ return UAVObjGetNumInstances(SubTrimSettingsHandle()); }
+
+static inline uint32_t SubTrimSettingsGetNumBytes(){ return UAVObjGetNumBytes(SubTrimSettingsHandle()); }
+
+// Field information
+// Field Roll information
+// Field Pitch information
+
+
+// set/Get functions
+extern void SubTrimSettingsRollSet( float *NewRoll );
+extern void SubTrimSettingsRollGet( float *NewRoll );
+extern void SubTrimSettingsPitchSet( float *NewPitch );
+extern void SubTrimSettingsPitchGet( float *NewPitch );
+
+
+#endif // SUBTRIMSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
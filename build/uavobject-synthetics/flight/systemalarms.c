@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       systemalarms.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SystemAlarms object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemalarms.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "systemalarms.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const SystemAlarmsData defaultData = {
+	.Alarm = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	.ConfigError = 10,
+	.ManualControl = 6,
+	.StateEstimation = 9,
+	.RebootCause = 7,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 450,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 1000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemAlarmsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SYSTEMALARMS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SYSTEMALARMS_OBJID,
+			SYSTEMALARMS_ISSINGLEINST, SYSTEMALARMS_ISSETTINGS, SYSTEMALARMS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SystemAlarmsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SystemAlarmsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SystemAlarmsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemAlarmsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SystemAlarmsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SystemAlarmsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemAlarmsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SystemAlarmsAlarmSet( uint8_t *NewAlarm )
+{
+	UAVObjSetDataField(SystemAlarmsHandle(), (void*)NewAlarm, offsetof( SystemAlarmsData, Alarm), 24*sizeof(uint8_t));
+}
+void SystemAlarmsAlarmGet( uint8_t *NewAlarm )
+{
+	UAVObjGetDataField(SystemAlarmsHandle(), (void*)NewAlarm, offsetof( SystemAlarmsData, Alarm), 24*sizeof(uint8_t));
+}
+void SystemAlarmsConfigErrorSet( uint8_t *NewConfigError )
+{
+	UAVObjSetDataField(SystemAlarmsHandle(), (void*)NewConfigError, offsetof( SystemAlarmsData, ConfigError), sizeof(uint8_t));
+}
+void SystemAlarmsConfigErrorGet( uint8_t *NewConfigError )
+{
+	UAVObjGetDataField(SystemAlarmsHandle(), (void*)NewConfigError, offsetof( SystemAlarmsData, ConfigError), sizeof(uint8_t));
+}
+void SystemAlarmsManualControlSet( uint8_t *NewManualControl )
+{
+	UAVObjSetDataField(SystemAlarmsHandle(), (void*)NewManualControl, offsetof( SystemAlarmsData, ManualControl), sizeof(uint8_t));
+}
+void SystemAlarmsManualControlGet( uint8_t *NewManualControl )
+{
+	UAVObjGetDataField(SystemAlarmsHandle(), (void*)NewManualControl, offsetof( SystemAlarmsData, ManualControl), sizeof(uint8_t));
+}
+void SystemAlarmsStateEstimationSet( uint8_t *NewStateEstimation )
+{
+	UAVObjSetDataField(SystemAlarmsHandle(), (void*)NewStateEstimation, offsetof( SystemAlarmsData, StateEstimation), sizeof(uint8_t));
+}
+void SystemAlarmsStateEstimationGet( uint8_t *NewStateEstimation )
+{
+	UAVObjGetDataField(SystemAlarmsHandle(), (void*)NewStateEstimation, offsetof( SystemAlarmsData, StateEstimation), sizeof(uint8_t));
+}
+void SystemAlarmsRebootCauseSet( uint8_t *NewRebootCause )
+{
+	UAVObjSetDataField(SystemAlarmsHandle(), (void*)NewRebootCause, offsetof( SystemAlarmsData, RebootCause), sizeof(uint8_t));
+}
+void SystemAlarmsRebootCauseGet( uint8_t *NewRebootCause )
+{
+	UAVObjGetDataField(SystemAlarmsHandle(), (void*)NewRebootCause, offsetof( SystemAlarmsData, RebootCause), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       systemident.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SystemIdent object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemident.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "systemident.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 1000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemIdentInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SYSTEMIDENT_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SYSTEMIDENT_OBJID,
+			SYSTEMIDENT_ISSINGLEINST, SYSTEMIDENT_ISSETTINGS, SYSTEMIDENT_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SystemIdentSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SystemIdentData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SystemIdentSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemIdentSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SystemIdentSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SystemIdentSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemIdentHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SystemIdentTauSet( float *NewTau )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewTau, offsetof( SystemIdentData, Tau), sizeof(float));
+}
+void SystemIdentTauGet( float *NewTau )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewTau, offsetof( SystemIdentData, Tau), sizeof(float));
+}
+void SystemIdentBetaSet( float *NewBeta )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewBeta, offsetof( SystemIdentData, Beta), 3*sizeof(float));
+}
+void SystemIdentBetaGet( float *NewBeta )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewBeta, offsetof( SystemIdentData, Beta), 3*sizeof(float));
+}
+void SystemIdentBiasSet( float *NewBias )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewBias, offsetof( SystemIdentData, Bias), 3*sizeof(float));
+}
+void SystemIdentBiasGet( float *NewBias )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewBias, offsetof( SystemIdentData, Bias), 3*sizeof(float));
+}
+void SystemIdentNoiseSet( float *NewNoise )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewNoise, offsetof( SystemIdentData, Noise), 3*sizeof(float));
+}
+void SystemIdentNoiseGet( float *NewNoise )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewNoise, offsetof( SystemIdentData, Noise), 3*sizeof(float));
+}
+void SystemIdentNumAfPredictsSet( uint32_t *NewNumAfPredicts )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewNumAfPredicts, offsetof( SystemIdentData, NumAfPredicts), sizeof(uint32_t));
+}
+void SystemIdentNumAfPredictsGet( uint32_t *NewNumAfPredicts )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewNumAfPredicts, offsetof( SystemIdentData, NumAfPredicts), sizeof(uint32_t));
+}
+void SystemIdentNumSpilledPtsSet( uint32_t *NewNumSpilledPts )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewNumSpilledPts, offsetof( SystemIdentData, NumSpilledPts), sizeof(uint32_t));
+}
+void SystemIdentNumSpilledPtsGet( uint32_t *NewNumSpilledPts )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewNumSpilledPts, offsetof( SystemIdentData, NumSpilledPts), sizeof(uint32_t));
+}
+void SystemIdentHoverThrottleSet( float *NewHoverThrottle )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewHoverThrottle, offsetof( SystemIdentData, HoverThrottle), sizeof(float));
+}
+void SystemIdentHoverThrottleGet( float *NewHoverThrottle )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewHoverThrottle, offsetof( SystemIdentData, HoverThrottle), sizeof(float));
+}
+void SystemIdentNewTuneSet( uint8_t *NewNewTune )
+{
+	UAVObjSetDataField(SystemIdentHandle(), (void*)NewNewTune, offsetof( SystemIdentData, NewTune), sizeof(uint8_t));
+}
+void SystemIdentNewTuneGet( uint8_t *NewNewTune )
+{
+	UAVObjGetDataField(SystemIdentHandle(), (void*)NewNewTune, offsetof( SystemIdentData, NewTune), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
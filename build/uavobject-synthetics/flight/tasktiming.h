@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup TaskTiming TaskTiming
+ * @brief Scheduling of each task, only measured on the simulator
+ *
+ *
+ * @file       tasktiming.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the TaskTiming object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: tasktiming.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TASKTIMING_H
+#define TASKTIMING_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define TASKTIMING_OBJID 0x3E8C0A60
+#define TASKTIMING_ISSINGLEINST 1
+#define TASKTIMING_ISSETTINGS 0
+#define TASKTIMING_NUMBYTES 164
+
+// Generic interface functions
+int32_t TaskTimingInitialize();
+UAVObjHandle TaskTimingHandle();
+void TaskTimingSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint16_t WakeLatency[41];
+    uint16_t ContextSwitches[41];
+
+} __attribute__((packed)) __attribute__((aligned(4))) TaskTimingData;
+
+// Typesafe Object access functions
+/**
+ * @function TaskTimingGet(dataOut)
+ * @brief Populate a TaskTimingData object
+ * @param[out] dataOut 
+ */
+static inline int32_t TaskTimingGet(TaskTimingData *dataOut) { return UAVObjGetData(TaskTimingHandle(), dataOut); }
+
+static inline int32_t TaskTimingSet(const TaskTimingData *dataIn) { return UAVObjSetData(TaskTimingHandle(), dataIn); }
+
+static inline int32_t TaskTimingInstGet(uint16_t instId, TaskTimingData *dataOut) { return UAVObjGetInstanceData(TaskTimingHandle(), instId, dataOut); }
+
+static inline int32_t TaskTimingInstSet(uint16_t instId, const TaskTimingData *dataIn) { return UAVObjSetInstanceData(TaskTimingHandle(), instId, dataIn); }
+
+static inline int32_t TaskTimingConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(TaskTimingHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TaskTimingConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(TaskTimingHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TaskTimingConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(TaskTimingHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TaskTimingConnectCopy(volatile TaskTimingData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	TaskTimingGet((void *) dataOut);
+
+	return UAVObjConnectCallback(TaskTimingHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t TaskTimingCreateInstance() { return UAVObjCreateInstance(TaskTimingHandle(), &TaskTimingSetDefaults); }
+
+static inline void TaskTimingUpdated() { UAVObjUpdated(TaskTimingHandle()); }
+
+static inline void TaskTimingInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(TaskTimingHandle(), instId); }
+
+static inline int32_t TaskTimingGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(TaskTimingHandle(), dataOut); }
+
+static inline int32_t TaskTimingSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(TaskTimingHandle(), dataIn); }
+
+static inline int8_t TaskTimingReadOnly() { return UAVObjReadOnly(TaskTimingHandle()); }
+
+static inline uint16_t TaskTimingGetNumInstances(){ return UAVObjGetNumInstances(TaskTimingHandle()); }
+
+static inline uint32_t TaskTimingGetNumBytes(){ return UAVObjGetNumBytes(TaskTimingHandle()); }
+
+// Field information
+// Field WakeLatency information
+typedef enum { TASKTIMING_WAKELATENCY_SYSTEM=0, TASKTIMING_WAKELATENCY_ACTUATOR=1, TASKTIMING_WAKELATENCY_ATTITUDE=2, TASKTIMING_WAKELATENCY_SENSORS=3, TASKTIMING_WAKELATENCY_TELEMETRYTX=4, TASKTIMING_WAKELATENCY_TELEMETRYTXPRI=5, TASKTIMING_WAKELATENCY_TELEMETRYRX=6, TASKTIMING_WAKELATENCY_GPS=7, TASKTIMING_WAKELATENCY_MANUALCONTROL=8, TASKTIMING_WAKELATENCY_ALTITUDE=9, TASKTIMING_WAKELATENCY_AIRSPEED=10, TASKTIMING_WAKELATENCY_STABILIZATION=11, TASKTIMING_WAKELATENCY_ALTITUDEHOLD=12, TASKTIMING_WAKELATENCY_PATHPLANNER=13, TASKTIMING_WAKELATENCY_PATHFOLLOWER=14, TASKTIMING_WAKELATENCY_FLIGHTPLAN=15, TASKTIMING_WAKELATENCY_COM2USBBRIDGE=16, TASKTIMING_WAKELATENCY_USB2COMBRIDGE=17, TASKTIMING_WAKELATENCY_MODEMRX=18, TASKTIMING_WAKELATENCY_MODEMTX=19, TASKTIMING_WAKELATENCY_MODEMSTAT=20, TASKTIMING_WAKELATENCY_AUTOTUNE=21, TASKTIMING_WAKELATENCY_EVENTDISPATCHER=22, TASKTIMING_WAKELATENCY_GENERICI2CSENSOR=23, TASKTIMING_WAKELATENCY_UAVOMAVLINKBRIDGE=24, TASKTIMING_WAKELATENCY_UAVOMSPBRIDGE=25, TASKTIMING_WAKELATENCY_UAVOLIGHTTELEMETRYBRIDGE=26, TASKTIMING_WAKELATENCY_UAVORELAY=27, TASKTIMING_WAKELATENCY_VIBRATIONANALYSIS=28, TASKTIMING_WAKELATENCY_BATTERY=29, TASKTIMING_WAKELATENCY_UAVOHOTTBRIDGE=30, TASKTIMING_WAKELATENCY_UAVOFRSKYSENSORHUBBRIDGE=31, TASKTIMING_WAKELATENCY_ONSCREENDISPLAY=32, TASKTIMING_WAKELATENCY_LOGGING=33, TASKTIMING_WAKELATENCY_UAVOFRSKYSPORTBRIDGE=34, TASKTIMING_WAKELATENCY_FLIGHTSTATS=35, TASKTIMING_WAKELATENCY_STORM32BGC=36, TASKTIMING_WAKELATENCY_IMU=37, TASKTIMING_WAKELATENCY_VTXCONFIG=38, TASKTIMING_WAKELATENCY_MSPUAVOBRIDGE=39, TASKTIMING_WAKELATENCY_UAVOCROSSFIRETELEMETRY=40 } __attribute__((packed)) TaskTimingWakeLatencyElem;
+#define TASKTIMING_WAKELATENCY_NUMELEM 41
+// Field ContextSwitches information
+typedef enum { TASKTIMING_CONTEXTSWITCHES_SYSTEM=0, TASKTIMING_CONTEXTSWITCHES_ACTUATOR=1, TASKTIMING_CONTEXTSWITCHES_ATTITUDE=2, TASKTIMING_CONTEXTSWITCHES_SENSORS=3, TASKTIMING_CONTEXTSWITCHES_TELEMETRYTX=4, TASKTIMING_CONTEXTSWITCHES_TELEMETRYTXPRI=5, TASKTIMING_CONTEXTSWITCHES_TELEMETRYRX=6, TASKTIMING_CONTEXTSWITCHES_GPS=7, TASKTIMING_CONTEXTSWITCHES_MANUALCONTROL=8, TASKTIMING_CONTEXTSWITCHES_ALTITUDE=9, TASKTIMING_CONTEXTSWITCHES_AIRSPEED=10, TASKTIMING_CONTEXTSWITCHES_STABILIZATION=11, TASKTIMING_CONTEXTSWITCHES_ALTITUDEHOLD=12, TASKTIMING_CONTEXTSWITCHES_PATHPLANNER=13, TASKTIMING_CONTEXTSWITCHES_PATHFOLLOWER=14, TASKTIMING_CONTEXTSWITCHES_FLIGHTPLAN=15, TASKTIMING_CONTEXTSWITCHES_COM2USBBRIDGE=16, TASKTIMING_CONTEXTSWITCHES_USB2COMBRIDGE=17, TASKTIMING_CONTEXTSWITCHES_MODEMRX=18, TASKTIMING_CONTEXTSWITCHES_MODEMTX=19, TASKTIMING_CONTEXTSWITCHES_MODEMSTAT=20, TASKTIMING_CONTEXTSWITCHES_AUTOTUNE=21, TASKTIMING_CONTEXTSWITCHES_EVENTDISPATCHER=22, TASKTIMING_CONTEXTSWITCHES_GENERICI2CSENSOR=23, TASKTIMING_CONTEXTSWITCHES_UAVOMAVLINKBRIDGE=24, TASKTIMING_CONTEXTSWITCHES_UAVOMSPBRIDGE=25, TASKTIMING_CONTEXTSWITCHES_UAVOLIGHTTELEMETRYBRIDGE=26, TASKTIMING_CONTEXTSWITCHES_UAVORELAY=27, TASKTIMING_CONTEXTSWITCHES_VIBRATIONANALYSIS=28, TASKTIMING_CONTEXTSWITCHES_BATTERY=29, TASKTIMING_CONTEXTSWITCHES_UAVOHOTTBRIDGE=30, TASKTIMING_CONTEXTSWITCHES_UAVOFRSKYSENSORHUBBRIDGE=31, TASKTIMING_CONTEXTSWITCHES_ONSCREENDISPLAY=32, TASKTIMING_CONTEXTSWITCHES_LOGGING=33, TASKTIMING_CONTEXTSWITCHES_UAVOFRSKYSPORTBRIDGE=34, TASKTIMING_CONTEXTSWITCHES_FLIGHTSTATS=35, TASKTIMING_CONTEXTSWITCHES_STORM32BGC=36, TASKTIMING_CONTEXTSWITCHES_IMU=37, TASKTIMING_CONTEXTSWITCHES_VTXCONFIG=38, TASKTIMING_CONTEXTSWITCHES_MSPUAVOBRIDGE=39, TASKTIMING_CONTEXTSWITCHES_UAVOCROSSFIRETELEMETRY=40 } __attribute__((packed)) TaskTimingContextSwitchesElem;
+#define TASKTIMING_CONTEXTSWITCHES_NUMELEM 41
+
+
+// set/Get functions
+extern void TaskTimingWakeLatencySet( uint16_t *NewWakeLatency );
+extern void TaskTimingWakeLatencyGet( uint16_t *NewWakeLatency );
+extern void TaskTimingContextSwitchesSet( uint16_t *NewContextSwitches );
+extern void TaskTimingContextSwitchesGet( uint16_t *NewContextSwitches );
+
+
+#endif // TASKTIMING_H
+
+/**
+ * @}
+ * @}
+ */
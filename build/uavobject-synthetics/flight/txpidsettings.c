@@ -0,0 +1,190 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       txpidsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the TxPIDSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: txpidsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "txpidsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const TxPIDSettingsData defaultData = {
+	.ThrottleRange = { 0.2, 0.8 },
+	.MinPID = { 0, 0, 0 },
+	.MaxPID = { 0, 0, 0 },
+	.UpdateMode = 1,
+	.Inputs = { 0, 1, 2 },
+	.PIDs = { 0, 0, 0 },
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t TxPIDSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(TXPIDSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(TXPIDSETTINGS_OBJID,
+			TXPIDSETTINGS_ISSINGLEINST, TXPIDSETTINGS_ISSETTINGS, TXPIDSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void TxPIDSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	TxPIDSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void TxPIDSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void TxPIDSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	TxPIDSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		TxPIDSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle TxPIDSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void TxPIDSettingsThrottleRangeSet( float *NewThrottleRange )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewThrottleRange, offsetof( TxPIDSettingsData, ThrottleRange), 2*sizeof(float));
+}
+void TxPIDSettingsThrottleRangeGet( float *NewThrottleRange )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewThrottleRange, offsetof( TxPIDSettingsData, ThrottleRange), 2*sizeof(float));
+}
+void TxPIDSettingsMinPIDSet( float *NewMinPID )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewMinPID, offsetof( TxPIDSettingsData, MinPID), 3*sizeof(float));
+}
+void TxPIDSettingsMinPIDGet( float *NewMinPID )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewMinPID, offsetof( TxPIDSettingsData, MinPID), 3*sizeof(float));
+}
+void TxPIDSettingsMaxPIDSet( float *NewMaxPID )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewMaxPID, offsetof( TxPIDSettingsData, MaxPID), 3*sizeof(float));
+}
+void TxPIDSettingsMaxPIDGet( float *NewMaxPID )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewMaxPID, offsetof( TxPIDSettingsData, MaxPID), 3*sizeof(float));
+}
+void TxPIDSettingsUpdateModeSet( uint8_t *NewUpdateMode )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewUpdateMode, offsetof( TxPIDSettingsData, UpdateMode), sizeof(uint8_t));
+}
+void TxPIDSettingsUpdateModeGet( uint8_t *NewUpdateMode )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewUpdateMode, offsetof( TxPIDSettingsData, UpdateMode), sizeof(uint8_t));
+}
+void TxPIDSettingsInputsSet( uint8_t *NewInputs )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewInputs, offsetof( TxPIDSettingsData, Inputs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsInputsGet( uint8_t *NewInputs )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewInputs, offsetof( TxPIDSettingsData, Inputs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsPIDsSet( uint8_t *NewPIDs )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewPIDs, offsetof( TxPIDSettingsData, PIDs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsPIDsGet( uint8_t *NewPIDs )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewPIDs, offsetof( TxPIDSettingsData, PIDs), 3*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,305 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjectHandling UAVObject handling code
+ * @{
+ *
+ * @file       uavobjectsinit.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2013
+ * @brief      Initialize all objects.
+ *             Automatically generated by the UAVObjectGenerator.
+ *   
+ * @note       This is an automatically generated file.
+ *             DO NOT modify manually.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "openpilot.h"
+#include "acceldesired.h"
+#include "accels.h"
+#include "actuatorcommand.h"
+#include "actuatordesired.h"
+#include "actuatorsettings.h"
+#include "airspeedactual.h"
+#include "airspeedsettings.h"
+#include "altitudeholddesired.h"
+#include "altitudeholdsettings.h"
+#include "altitudeholdstate.h"
+#include "annunciatorsettings.h"
+#include "attitudeactual.h"
+#include "attitudesettings.h"
+#include "attitudesimulated.h"
+#include "baroairspeed.h"
+#include "baroaltitude.h"
+#include "blackboxdata.h"
+#include "cameradesired.h"
+#include "camerastabsettings.h"
+#include "charonscreendisplaysettings.h"
+#include "dacsettings.h"
+#include "dynamicnotch.h"
+#include "faultsettings.h"
+#include "firmwareiapobj.h"
+#include "fixedwingairspeeds.h"
+#include "fixedwingpathfollowersettings.h"
+#include "fixedwingpathfollowerstatus.h"
+#include "flightbatterysettings.h"
+#include "flightbatterystate.h"
+#include "flightstats.h"
+#include "flightstatssettings.h"
+#include "flightstatus.h"
+#include "flighttelemetrystats.h"
+#include "gcsreceiver.h"
+#include "gcstelemetrystats.h"
+#include "gpsposition.h"
+#include "gpssatellites.h"
+#include "gpstime.h"
+#include "gpsvelocity.h"
+#include "geofencesettings.h"
+#include "geofencezone.h"
+#include "groundtruth.h"
+#include "gyros.h"
+#include "gyrosbias.h"
+#include "hottsettings.h"
+#include "homelocation.h"
+#include "hwaq32.h"
+#include "hwbrain.h"
+#include "hwbrainre1.h"
+#include "hwdtfc.h"
+#include "hwlux.h"
+#include "hwpikoblx.h"
+#include "hwplayuavosd.h"
+#include "hwquanton.h"
+#include "hwrevolution.h"
+#include "hwseppuku.h"
+#include "hwshared.h"
+#include "hwsimulation.h"
+#include "hwsparky.h"
+#include "hwsparky2.h"
+#include "hwsprf3e.h"
+#include "hwtaulink.h"
+#include "inssettings.h"
+#include "insstate.h"
+#include "loggingsettings.h"
+#include "loggingstats.h"
+#include "loitercommand.h"
+#include "magbias.h"
+#include "magnetometer.h"
+#include "manualcontrolcommand.h"
+#include "manualcontrolsettings.h"
+#include "mixersettings.h"
+#include "modulesettings.h"
+#include "nedposition.h"
+#include "nedaccel.h"
+#include "objectpersistence.h"
+#include "onscreendisplaypagesettings.h"
+#include "onscreendisplaypagesettings2.h"
+#include "onscreendisplaypagesettings3.h"
+#include "onscreendisplaypagesettings4.h"
+#include "onscreendisplaysettings.h"
+#include "openlrs.h"
+#include "openlrsstatus.h"
+#include "opticalflow.h"
+#include "opticalflowsettings.h"
+#include "pathdesired.h"
+#include "pathplannersettings.h"
+#include "pathstatus.h"
+#include "poilocation.h"
+#include "positionactual.h"
+#include "rfm22breceiver.h"
+#include "rfm22bstatus.h"
+#include "rgbledsettings.h"
+#include "radiocombridgestats.h"
+#include "rangefinder.h"
+#include "ratedesired.h"
+#include "receiveractivity.h"
+#include "schedulerstats.h"
+#include "sensorsettings.h"
+#include "sessionmanaging.h"
+#include "shareddefs.h"
+#include "stabilizationdesired.h"
+#include "stabilizationsettings.h"
+#include "stateestimation.h"
+#include "subtrim.h"
+#include "subtrimsettings.h"
+#include "systemalarms.h"
+#include "systemident.h"
+#include "systemsettings.h"
+#include "systemstats.h"
+#include "tabletinfo.h"
+#include "taskinfo.h"
+#include "tasktiming.h"
+#include "txpidsettings.h"
+#include "ubloxinfo.h"
+#include "vtxinfo.h"
+#include "vtxsettings.h"
+#include "vbarsettings.h"
+#include "velocityactual.h"
+#include "velocitydesired.h"
+#include "vibrationanalysisoutput.h"
+#include "vibrationanalysissettings.h"
+#include "vtolpathfollowersettings.h"
+#include "vtolpathfollowerstatus.h"
+#include "watchdogstatus.h"
+#include "waypoint.h"
+#include "waypointactive.h"
+#include "windvelocityactual.h"
+
+
+/**
+ * Function used to initialize the first instance of each object.
+ * This file is automatically updated by the UAVObjectGenerator.
+ */
+void UAVObjectsInitializeAll()
+{
+    AccelDesiredInitialize();
+    AccelsInitialize();
+    ActuatorCommandInitialize();
+    ActuatorDesiredInitialize();
+    ActuatorSettingsInitialize();
+    AirspeedActualInitialize();
+    AirspeedSettingsInitialize();
+    AltitudeHoldDesiredInitialize();
+    AltitudeHoldSettingsInitialize();
+    AltitudeHoldStateInitialize();
+    AnnunciatorSettingsInitialize();
+    AttitudeActualInitialize();
+    AttitudeSettingsInitialize();
+    AttitudeSimulatedInitialize();
+    BaroAirspeedInitialize();
+    BaroAltitudeInitialize();
+    BlackboxDataInitialize();
+    CameraDesiredInitialize();
+    CameraStabSettingsInitialize();
+    CharOnScreenDisplaySettingsInitialize();
+    DACSettingsInitialize();
+    DynamicNotchInitialize();
+    FaultSettingsInitialize();
+    FirmwareIAPObjInitialize();
+    FixedWingAirspeedsInitialize();
+    FixedWingPathFollowerSettingsInitialize();
+    FixedWingPathFollowerStatusInitialize();
+    FlightBatterySettingsInitialize();
+    FlightBatteryStateInitialize();
+    FlightStatsInitialize();
+    FlightStatsSettingsInitialize();
+    FlightStatusInitialize();
+    FlightTelemetryStatsInitialize();
+    GCSReceiverInitialize();
+    GCSTelemetryStatsInitialize();
+    GPSPositionInitialize();
+    GPSSatellitesInitialize();
+    GPSTimeInitialize();
+    GPSVelocityInitialize();
+    GeoFenceSettingsInitialize();
+    GeoFenceZoneInitialize();
+    GroundTruthInitialize();
+    GyrosInitialize();
+    GyrosBiasInitialize();
+    HoTTSettingsInitialize();
+    HomeLocationInitialize();
+    HwAQ32Initialize();
+    HwBrainInitialize();
+    HwBrainRE1Initialize();
+    HwDtfcInitialize();
+    HwLuxInitialize();
+    HwPikoBLXInitialize();
+    HwPlayUavOsdInitialize();
+    HwQuantonInitialize();
+    HwRevolutionInitialize();
+    HwSeppukuInitialize();
+    HwSharedInitialize();
+    HwSimulationInitialize();
+    HwSparkyInitialize();
+    HwSparky2Initialize();
+    HwSprf3eInitialize();
+    HwTauLinkInitialize();
+    INSSettingsInitialize();
+    INSStateInitialize();
+    LoggingSettingsInitialize();
+    LoggingStatsInitialize();
+    LoiterCommandInitialize();
+    MagBiasInitialize();
+    MagnetometerInitialize();
+    ManualControlCommandInitialize();
+    ManualControlSettingsInitialize();
+    MixerSettingsInitialize();
+    ModuleSettingsInitialize();
+    NEDPositionInitialize();
+    NedAccelInitialize();
+    ObjectPersistenceInitialize();
+    OnScreenDisplayPageSettingsInitialize();
+    OnScreenDisplayPageSettings2Initialize();
+    OnScreenDisplayPageSettings3Initialize();
+    OnScreenDisplayPageSettings4Initialize();
+    OnScreenDisplaySettingsInitialize();
+    OpenLRSInitialize();
+    OpenLRSStatusInitialize();
+    OpticalFlowInitialize();
+    OpticalFlowSettingsInitialize();
+    PathDesiredInitialize();
+    PathPlannerSettingsInitialize();
+    PathStatusInitialize();
+    PoiLocationInitialize();
+    PositionActualInitialize();
+    RFM22BReceiverInitialize();
+    RFM22BStatusInitialize();
+    RGBLEDSettingsInitialize();
+    RadioComBridgeStatsInitialize();
+    RangefinderInitialize();
+    RateDesiredInitialize();
+    ReceiverActivityInitialize();
+    SchedulerStatsInitialize();
+    SensorSettingsInitialize();
+    SessionManagingInitialize();
+    SharedDefsInitialize();
+    StabilizationDesiredInitialize();
+    StabilizationSettingsInitialize();
+    StateEstimationInitialize();
+    SubTrimInitialize();
+    SubTrimSettingsInitialize();
+    SystemAlarmsInitialize();
+    SystemIdentInitialize();
+    SystemSettingsInitialize();
+    SystemStatsInitialize();
+    TabletInfoInitialize();
+    TaskInfoInitialize();
+    TaskTimingInitialize();
+    TxPIDSettingsInitialize();
+    UBloxInfoInitialize();
+    VTXInfoInitialize();
+    VTXSettingsInitialize();
+    VbarSettingsInitialize();
+    VelocityActualInitialize();
+    VelocityDesiredInitialize();
+    VibrationAnalysisOutputInitialize();
+    VibrationAnalysisSettingsInitialize();
+    VtolPathFollowerSettingsInitialize();
+    VtolPathFollowerStatusInitialize();
+    WatchdogStatusInitialize();
+    WaypointInitialize();
+    WaypointActiveInitialize();
+    WindVelocityActualInitialize();
+
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,6 @@
+#ifndef UAVVER_H
+#define UAVVER_H
+
+#define UAVOHASH 0x0000000000001234
+
+#endif
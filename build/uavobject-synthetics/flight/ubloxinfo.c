@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       ubloxinfo.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the UBloxInfo object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: ubloxinfo.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "ubloxinfo.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 10000,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 1000,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t UBloxInfoInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(UBLOXINFO_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(UBLOXINFO_OBJID,
+			UBLOXINFO_ISSINGLEINST, UBLOXINFO_ISSETTINGS, UBLOXINFO_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void UBloxInfoSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	UBloxInfoData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void UBloxInfoSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void UBloxInfoSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	UBloxInfoSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		UBloxInfoSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle UBloxInfoHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void UBloxInfoswVersionSet( uint32_t *NewswVersion )
+{
+	UAVObjSetDataField(UBloxInfoHandle(), (void*)NewswVersion, offsetof( UBloxInfoData, swVersion), sizeof(uint32_t));
+}
+void UBloxInfoswVersionGet( uint32_t *NewswVersion )
+{
+	UAVObjGetDataField(UBloxInfoHandle(), (void*)NewswVersion, offsetof( UBloxInfoData, swVersion), sizeof(uint32_t));
+}
+void UBloxInfoParseErrorsSet( uint32_t *NewParseErrors )
+{
+	UAVObjSetDataField(UBloxInfoHandle(), (void*)NewParseErrors, offsetof( UBloxInfoData, ParseErrors), sizeof(uint32_t));
+}
+void UBloxInfoParseErrorsGet( uint32_t *NewParseErrors )
+{
+	UAVObjGetDataField(UBloxInfoHandle(), (void*)NewParseErrors, offsetof( UBloxInfoData, ParseErrors), sizeof(uint32_t));
+}
+void UBloxInfohwVersionSet( uint16_t *NewhwVersion )
+{
+	UAVObjSetDataField(UBloxInfoHandle(), (void*)NewhwVersion, offsetof( UBloxInfoData, hwVersion), sizeof(uint16_t));
+}
+void UBloxInfohwVersionGet( uint16_t *NewhwVersion )
+{
+	UAVObjGetDataField(UBloxInfoHandle(), (void*)NewhwVersion, offsetof( UBloxInfoData, hwVersion), sizeof(uint16_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
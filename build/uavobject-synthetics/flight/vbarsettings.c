@@ -0,0 +1,208 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       vbarsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the VbarSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vbarsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "vbarsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default field values, copied in on registration and by SetDefaults
+static const VbarSettingsData defaultData = {
+	.VbarSensitivity = { 0.5, 0.5, 0.5 },
+	.VbarRollPID = { 0.005, 0.002, 0 },
+	.VbarPitchPID = { 0.005, 0.002, 0 },
+	.VbarYawPID = { 0.005, 0.002, 0 },
+	.VbarTau = 0.5,
+	.VbarGyroSuppress = 30,
+	.VbarPiroComp = 0,
+	.VbarMaxAngle = 10,
+};
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VbarSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(VBARSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(VBARSETTINGS_OBJID,
+			VBARSETTINGS_ISSINGLEINST, VBARSETTINGS_ISSETTINGS, VBARSETTINGS_NUMBYTES,
+			&defaultData, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void VbarSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	VbarSettingsData data = defaultData;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void VbarSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VbarSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	VbarSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		VbarSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VbarSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VbarSettingsVbarSensitivitySet( float *NewVbarSensitivity )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarSensitivity, offsetof( VbarSettingsData, VbarSensitivity), 3*sizeof(float));
+}
+void VbarSettingsVbarSensitivityGet( float *NewVbarSensitivity )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarSensitivity, offsetof( VbarSettingsData, VbarSensitivity), 3*sizeof(float));
+}
+void VbarSettingsVbarRollPIDSet( float *NewVbarRollPID )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarRollPID, offsetof( VbarSettingsData, VbarRollPID), 3*sizeof(float));
+}
+void VbarSettingsVbarRollPIDGet( float *NewVbarRollPID )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarRollPID, offsetof( VbarSettingsData, VbarRollPID), 3*sizeof(float));
+}
+void VbarSettingsVbarPitchPIDSet( float *NewVbarPitchPID )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarPitchPID, offsetof( VbarSettingsData, VbarPitchPID), 3*sizeof(float));
+}
+void VbarSettingsVbarPitchPIDGet( float *NewVbarPitchPID )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarPitchPID, offsetof( VbarSettingsData, VbarPitchPID), 3*sizeof(float));
+}
+void VbarSettingsVbarYawPIDSet( float *NewVbarYawPID )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarYawPID, offsetof( VbarSettingsData, VbarYawPID), 3*sizeof(float));
+}
+void VbarSettingsVbarYawPIDGet( float *NewVbarYawPID )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarYawPID, offsetof( VbarSettingsData, VbarYawPID), 3*sizeof(float));
+}
+void VbarSettingsVbarTauSet( float *NewVbarTau )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarTau, offsetof( VbarSettingsData, VbarTau), sizeof(float));
+}
+void VbarSettingsVbarTauGet( float *NewVbarTau )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarTau, offsetof( VbarSettingsData, VbarTau), sizeof(float));
+}
+void VbarSettingsVbarGyroSuppressSet( int8_t *NewVbarGyroSuppress )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarGyroSuppress, offsetof( VbarSettingsData, VbarGyroSuppress), sizeof(int8_t));
+}
+void VbarSettingsVbarGyroSuppressGet( int8_t *NewVbarGyroSuppress )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarGyroSuppress, offsetof( VbarSettingsData, VbarGyroSuppress), sizeof(int8_t));
+}
+void VbarSettingsVbarPiroCompSet( uint8_t *NewVbarPiroComp )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarPiroComp, offsetof( VbarSettingsData, VbarPiroComp), sizeof(uint8_t));
+}
+void VbarSettingsVbarPiroCompGet( uint8_t *NewVbarPiroComp )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarPiroComp, offsetof( VbarSettingsData, VbarPiroComp), sizeof(uint8_t));
+}
+void VbarSettingsVbarMaxAngleSet( uint8_t *NewVbarMaxAngle )
+{
+	UAVObjSetDataField(VbarSettingsHandle(), (void*)NewVbarMaxAngle, offsetof( VbarSettingsData, VbarMaxAngle), sizeof(uint8_t));
+}
+void VbarSettingsVbarMaxAngleGet( uint8_t *NewVbarMaxAngle )
+{
+	UAVObjGetDataField(VbarSettingsHandle(), (void*)NewVbarMaxAngle, offsetof( VbarSettingsData, VbarMaxAngle), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
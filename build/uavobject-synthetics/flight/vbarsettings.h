@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup VbarSettings VbarSettings
+ * @brief Settings for the virtualbar flight mode
+ *
+ *
+ * @file       vbarsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the VbarSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vbarsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef VBARSETTINGS_H
+#define VBARSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define VBARSETTINGS_OBJID 0x3B75868
+#define VBARSETTINGS_ISSINGLEINST 1
+#define VBARSETTINGS_ISSETTINGS 1
+#define VBARSETTINGS_NUMBYTES 55
+
+// Generic interface functions
+int32_t VbarSettingsInitialize();
+UAVObjHandle VbarSettingsHandle();
+void VbarSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float VbarSensitivity[3];
+    float VbarRollPID[3];
+    float VbarPitchPID[3];
+    float VbarYawPID[3];
+    float VbarTau;
+    int8_t VbarGyroSuppress;
+    uint8_t VbarPiroComp;
+    uint8_t VbarMaxAngle;
+
+} __attribute__((packed)) __attribute__((aligned(4))) VbarSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function VbarSettingsGet(dataOut)
+ * @brief Populate a VbarSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t VbarSettingsGet(VbarSettingsData *dataOut) { return UAVObjGetData(VbarSettingsHandle(), dataOut); }
+
+static inline int32_t VbarSettingsSet(const VbarSettingsData *dataIn) { return UAVObjSetData(VbarSettingsHandle(), dataIn); }
+
+static inline int32_t VbarSettingsInstGet(uint16_t instId, VbarSettingsData *dataOut) { return UAVObjGetInstanceData(VbarSettingsHandle(), instId, dataOut); }
+
+static inline int32_t VbarSettingsInstSet(uint16_t instId, const VbarSettingsData *dataIn) { return UAVObjSetInstanceData(VbarSettingsHandle(), instId, dataIn); }
+
+static inline int32_t VbarSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(VbarSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VbarSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(VbarSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VbarSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(VbarSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VbarSettingsConnectCopy(volatile VbarSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	VbarSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(VbarSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t VbarSettingsCreateInstance() { return UAVObjCreateInstance(VbarSettingsHandle(), &VbarSettingsSetDefaults); }
+
+static inline void VbarSettingsUpdated() { UAVObjUpdated(VbarSettingsHandle()); }
+
+static inline void VbarSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(VbarSettingsHandle(), instId); }
+
+static inline int32_t VbarSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(VbarSettingsHandle(), dataOut); }
+
+static inline int32_t VbarSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(VbarSettingsHandle(), dataIn); }
+
+static inline int8_t VbarSettingsReadOnly() { return UAVObjReadOnly(VbarSettingsHandle()); }
+
+static inline uint16_t VbarSettingsGetNumInstances(){ return UAVObjGetNumInstances(VbarSettingsHandle()); }
+
+static inline uint32_t VbarSettingsGetNumBytes(){ return UAVObjGetNumBytes(VbarSettingsHandle()); }
+
+// Field information
+// Field VbarSensitivity information
+typedef enum { VBARSETTINGS_VBARSENSITIVITY_ROLL=0, VBARSETTINGS_VBARSENSITIVITY_PITCH=1, VBARSETTINGS_VBARSENSITIVITY_YAW=2 } __attribute__((packed)) VbarSettingsVbarSensitivityElem;
+#define VBARSETTINGS_VBARSENSITIVITY_NUMELEM 3
+// Field VbarRollPID information
+typedef enum { VBARSETTINGS_VBARROLLPID_KP=0, VBARSETTINGS_VBARROLLPID_KI=1, VBARSETTINGS_VBARROLLPID_KD=2 } __attribute__((packed)) VbarSettingsVbarRollPIDElem;
+#define VBARSETTINGS_VBARROLLPID_NUMELEM 3
+// Field VbarPitchPID information
+typedef enum { VBARSETTINGS_VBARPITCHPID_KP=0, VBARSETTINGS_VBARPITCHPID_KI=1, VBARSETTINGS_VBARPITCHPID_KD=2 } __attribute__((packed)) VbarSettingsVbarPitchPIDElem;
+#define VBARSETTINGS_VBARPITCHPID_NUMELEM 3
+// Field VbarYawPID information
+typedef enum { VBARSETTINGS_VBARYAWPID_KP=0, VBARSETTINGS_VBARYAWPID_KI=1, VBARSETTINGS_VBARYAWPID_KD=2 } __attribute__((packed)) VbarSettingsVbarYawPIDElem;
+#define VBARSETTINGS_VBARYAWPID_NUMELEM 3
+// Field VbarTau information
+// Field VbarGyroSuppress information
+// Field VbarPiroComp information
+/* Enumeration options for field VbarPiroComp */
+typedef enum { VBARSETTINGS_VBARPIROCOMP_FALSE=0, VBARSETTINGS_VBARPIROCOMP_TRUE=1 }  __attribute__((packed)) VbarSettingsVbarPiroCompOptions;
+#define VBARSETTINGS_VBARPIROCOMP_GLOBAL_MAXOPTVAL 1
+#define VBARSETTINGS_VBARPIROCOMP_MAXOPTVAL 1
+static inline bool VbarSettingsVbarPiroCompIsValid( uint8_t CurrentVbarPiroComp ) { return CurrentVbarPiroComp <= VBARSETTINGS_VBARPIROCOMP_MAXOPTVAL; }
+// Field VbarMaxAngle information
+
+
+// set/Get functions
+extern void VbarSettingsVbarSensitivitySet( float *NewVbarSensitivity );
+extern void VbarSettingsVbarSensitivityGet( float *NewVbarSensitivity );
+extern void VbarSettingsVbarRollPIDSet( float *NewVbarRollPID );
+extern void VbarSettingsVbarRollPIDGet( float *NewVbarRollPID );
+extern void VbarSettingsVbarPitchPIDSet( float *NewVbarPitchPID );
+extern void VbarSettingsVbarPitchPIDGet( float *NewVbarPitchPID );
+extern void VbarSettingsVbarYawPIDSet( float *NewVbarYawPID );
+extern void VbarSettingsVbarYawPIDGet( float *NewVbarYawPID );
+extern void VbarSettingsVbarTauSet( float *NewVbarTau );
+extern void VbarSettingsVbarTauGet( float *NewVbarTau );
+extern void VbarSettingsVbarGyroSuppressSet( int8_t *NewVbarGyroSuppress );
+extern void VbarSettingsVbarGyroSuppressGet( int8_t *NewVbarGyroSuppress );
+extern void VbarSettingsVbarPiroCompSet( uint8_t *NewVbarPiroComp );
+extern void VbarSettingsVbarPiroCompGet( uint8_t *NewVbarPiroComp );
+extern void VbarSettingsVbarMaxAngleSet( uint8_t *NewVbarMaxAngle );
+extern void VbarSettingsVbarMaxAngleGet( uint8_t *NewVbarMaxAngle );
+
+
+#endif // VBARSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       vibrationanalysisoutput.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the VibrationAnalysisOutput object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vibrationanalysisoutput.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "vibrationanalysisoutput.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VibrationAnalysisOutputInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(VIBRATIONANALYSISOUTPUT_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(VIBRATIONANALYSISOUTPUT_OBJID,
+			VIBRATIONANALYSISOUTPUT_ISSINGLEINST, VIBRATIONANALYSISOUTPUT_ISSETTINGS, VIBRATIONANALYSISOUTPUT_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void VibrationAnalysisOutputSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	VibrationAnalysisOutputData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void VibrationAnalysisOutputSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VibrationAnalysisOutputSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	VibrationAnalysisOutputSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		VibrationAnalysisOutputSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VibrationAnalysisOutputHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VibrationAnalysisOutputscaleSet( float *Newscale )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newscale, offsetof( VibrationAnalysisOutputData, scale), sizeof(float));
+}
+void VibrationAnalysisOutputscaleGet( float *Newscale )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newscale, offsetof( VibrationAnalysisOutputData, scale), sizeof(float));
+}
+void VibrationAnalysisOutputxSet( int16_t *Newx )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newx, offsetof( VibrationAnalysisOutputData, x), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputxGet( int16_t *Newx )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newx, offsetof( VibrationAnalysisOutputData, x), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputySet( int16_t *Newy )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newy, offsetof( VibrationAnalysisOutputData, y), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputyGet( int16_t *Newy )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newy, offsetof( VibrationAnalysisOutputData, y), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputzSet( int16_t *Newz )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newz, offsetof( VibrationAnalysisOutputData, z), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputzGet( int16_t *Newz )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newz, offsetof( VibrationAnalysisOutputData, z), 16*sizeof(int16_t));
+}
+void VibrationAnalysisOutputsamplesSet( int16_t *Newsamples )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newsamples, offsetof( VibrationAnalysisOutputData, samples), sizeof(int16_t));
+}
+void VibrationAnalysisOutputsamplesGet( int16_t *Newsamples )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newsamples, offsetof( VibrationAnalysisOutputData, samples), sizeof(int16_t));
+}
+void VibrationAnalysisOutputindexSet( int16_t *Newindex )
+{
+	UAVObjSetDataField(VibrationAnalysisOutputHandle(), (void*)Newindex, offsetof( VibrationAnalysisOutputData, index), sizeof(int16_t));
+}
+void VibrationAnalysisOutputindexGet( int16_t *Newindex )
+{
+	UAVObjGetDataField(VibrationAnalysisOutputHandle(), (void*)Newindex, offsetof( VibrationAnalysisOutputData, index), sizeof(int16_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup VibrationAnalysisOutput VibrationAnalysisOutput
+ * @brief Output from @VibrationTest module.
+ *
+ *
+ * @file       vibrationanalysisoutput.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the VibrationAnalysisOutput object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vibrationanalysisoutput.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef VIBRATIONANALYSISOUTPUT_H
+#define VIBRATIONANALYSISOUTPUT_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define VIBRATIONANALYSISOUTPUT_OBJID 0xBF2FE198
+#define VIBRATIONANALYSISOUTPUT_ISSINGLEINST 0
+#define VIBRATIONANALYSISOUTPUT_ISSETTINGS 0
+#define VIBRATIONANALYSISOUTPUT_NUMBYTES 104
+
+// Generic interface functions
+int32_t VibrationAnalysisOutputInitialize();
+UAVObjHandle VibrationAnalysisOutputHandle();
+void VibrationAnalysisOutputSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float scale;
+    int16_t x[16];
+    int16_t y[16];
+    int16_t z[16];
+    int16_t samples;
+    int16_t index;
+
+} __attribute__((packed)) __attribute__((aligned(4))) VibrationAnalysisOutputData;
+
+// Typesafe Object access functions
+/**
+ * @function VibrationAnalysisOutputGet(dataOut)
+ * @brief Populate a VibrationAnalysisOutputData object
+ * @param[out] dataOut 
+ */
+static inline int32_t VibrationAnalysisOutputGet(VibrationAnalysisOutputData *dataOut) { return UAVObjGetData(VibrationAnalysisOutputHandle(), dataOut); }
+
+static inline int32_t VibrationAnalysisOutputSet(const VibrationAnalysisOutputData *dataIn) { return UAVObjSetData(VibrationAnalysisOutputHandle(), dataIn); }
+
+static inline int32_t VibrationAnalysisOutputInstGet(uint16_t instId, VibrationAnalysisOutputData *dataOut) { return UAVObjGetInstanceData(VibrationAnalysisOutputHandle(), instId, dataOut); }
+
+static inline int32_t VibrationAnalysisOutputInstSet(uint16_t instId, const VibrationAnalysisOutputData *dataIn) { return UAVObjSetInstanceData(VibrationAnalysisOutputHandle(), instId, dataIn); }
+
+static inline int32_t VibrationAnalysisOutputConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(VibrationAnalysisOutputHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VibrationAnalysisOutputConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(VibrationAnalysisOutputHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VibrationAnalysisOutputConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(VibrationAnalysisOutputHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VibrationAnalysisOutputConnectCopy(volatile VibrationAnalysisOutputData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	VibrationAnalysisOutputGet((void *) dataOut);
+
+	return UAVObjConnectCallback(VibrationAnalysisOutputHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t VibrationAnalysisOutputCreateInstance() { return UAVObjCreateInstance(VibrationAnalysisOutputHandle(), &VibrationAnalysisOutputSetDefaults); }
+
+static inline void VibrationAnalysisOutputUpdated() { UAVObjUpdated(VibrationAnalysisOutputHandle()); }
+
+static inline void VibrationAnalysisOutputInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(VibrationAnalysisOutputHandle(), instId); }
+
+static inline int32_t VibrationAnalysisOutputGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(VibrationAnalysisOutputHandle(), dataOut); }
+
+static inline int32_t VibrationAnalysisOutputSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(VibrationAnalysisOutputHandle(), dataIn); }
+
+static inline int8_t VibrationAnalysisOutputReadOnly() { return UAVObjReadOnly(VibrationAnalysisOutputHandle()); }
+
+static inline uint16_t VibrationAnalysisOutputGetNumInstances(){ return UAVObjGetNumInstances(VibrationAnalysisOutputHandle()); }
+
+static inline uint32_t VibrationAnalysisOutputGetNumBytes(){ return UAVObjGetNumBytes(VibrationAnalysisOutputHandle()); }
+
+// Field information
+// Field scale information
+// Field x information
+#define VIBRATIONANALYSISOUTPUT_X_NUMELEM 16
+// Field y information
+#define VIBRATIONANALYSISOUTPUT_Y_NUMELEM 16
+// Field z information
+#define VIBRATIONANALYSISOUTPUT_Z_NUMELEM 16
+// Field samples information
+// Field index information
+
+
+// set/Get functions
+extern void VibrationAnalysisOutputscaleSet( float *Newscale );
+extern void VibrationAnalysisOutputscaleGet( float *Newscale );
+extern void VibrationAnalysisOutputxSet( int16_t *Newx );
+extern void VibrationAnalysisOutputxGet( int16_t *Newx );
+extern void VibrationAnalysisOutputySet( int16_t *Newy );
+extern void VibrationAnalysisOutputyGet( int16_t *Newy );
+extern void VibrationAnalysisOutputzSet( int16_t *Newz );
+extern void VibrationAnalysisOutputzGet( int16_t *Newz );
+extern void VibrationAnalysisOutputsamplesSet( int16_t *Newsamples );
+extern void VibrationAnalysisOutputsamplesGet( int16_t *Newsamples );
+extern void VibrationAnalysisOutputindexSet( int16_t *Newindex );
+extern void VibrationAnalysisOutputindexGet( int16_t *Newindex );
+
+
+#endif // VIBRATIONANALYSISOUTPUT_H
+
+/**
+ * @}
+ * @}
+ */
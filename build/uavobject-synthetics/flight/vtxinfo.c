@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       vtxinfo.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the VTXInfo object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtxinfo.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "vtxinfo.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VTXInfoInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(VTXINFO_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(VTXINFO_OBJID,
+			VTXINFO_ISSINGLEINST, VTXINFO_ISSETTINGS, VTXINFO_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void VTXInfoSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	VTXInfoData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void VTXInfoSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VTXInfoSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	VTXInfoSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		VTXInfoSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VTXInfoHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VTXInfoFrequencySet( uint16_t *NewFrequency )
+{
+	UAVObjSetDataField(VTXInfoHandle(), (void*)NewFrequency, offsetof( VTXInfoData, Frequency), sizeof(uint16_t));
+}
+void VTXInfoFrequencyGet( uint16_t *NewFrequency )
+{
+	UAVObjGetDataField(VTXInfoHandle(), (void*)NewFrequency, offsetof( VTXInfoData, Frequency), sizeof(uint16_t));
+}
+void VTXInfoPowerSet( uint16_t *NewPower )
+{
+	UAVObjSetDataField(VTXInfoHandle(), (void*)NewPower, offsetof( VTXInfoData, Power), sizeof(uint16_t));
+}
+void VTXInfoPowerGet( uint16_t *NewPower )
+{
+	UAVObjGetDataField(VTXInfoHandle(), (void*)NewPower, offsetof( VTXInfoData, Power), sizeof(uint16_t));
+}
+void VTXInfoModelSet( uint8_t *NewModel )
+{
+	UAVObjSetDataField(VTXInfoHandle(), (void*)NewModel, offsetof( VTXInfoData, Model), sizeof(uint8_t));
+}
+void VTXInfoModelGet( uint8_t *NewModel )
+{
+	UAVObjGetDataField(VTXInfoHandle(), (void*)NewModel, offsetof( VTXInfoData, Model), sizeof(uint8_t));
+}
+void VTXInfoStateSet( uint8_t *NewState )
+{
+	UAVObjSetDataField(VTXInfoHandle(), (void*)NewState, offsetof( VTXInfoData, State), sizeof(uint8_t));
+}
+void VTXInfoStateGet( uint8_t *NewState )
+{
+	UAVObjGetDataField(VTXInfoHandle(), (void*)NewState, offsetof( VTXInfoData, State), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
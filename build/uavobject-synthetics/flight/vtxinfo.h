@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup VTXInfo VTXInfo
+ * @brief Video transmitter information.
+ *
+ *
+ * @file       vtxinfo.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the VTXInfo object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtxinfo.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef VTXINFO_H
+#define VTXINFO_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define VTXINFO_OBJID 0x96E06FDA
+#define VTXINFO_ISSINGLEINST 1
+#define VTXINFO_ISSETTINGS 0
+#define VTXINFO_NUMBYTES 6
+
+// Generic interface functions
+int32_t VTXInfoInitialize();
+UAVObjHandle VTXInfoHandle();
+void VTXInfoSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint16_t Frequency;
+    uint16_t Power;
+    uint8_t Model;
+    uint8_t State;
+
+} __attribute__((packed)) __attribute__((aligned(4))) VTXInfoData;
+
+// Typesafe Object access functions
+/**
+ * @function VTXInfoGet(dataOut)
+ * @brief Populate a VTXInfoData object
+ * @param[out] dataOut 
+ */
+static inline int32_t VTXInfoGet(VTXInfoData *dataOut) { return UAVObjGetData(VTXInfoHandle(), dataOut); }
+
+static inline int32_t VTXInfoSet(const VTXInfoData *dataIn) { return UAVObjSetData(VTXInfoHandle(), dataIn); }
+
+static inline int32_t VTXInfoInstGet(uint16_t instId, VTXInfoData *dataOut) { return UAVObjGetInstanceData(VTXInfoHandle(), instId, dataOut); }
+
+static inline int32_t VTXInfoInstSet(uint16_t instId, const VTXInfoData *dataIn) { return UAVObjSetInstanceData(VTXInfoHandle(), instId, dataIn); }
+
+static inline int32_t VTXInfoConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(VTXInfoHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXInfoConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(VTXInfoHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXInfoConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(VTXInfoHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXInfoConnectCopy(volatile VTXInfoData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	VTXInfoGet((void *) dataOut);
+
+	return UAVObjConnectCallback(VTXInfoHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t VTXInfoCreateInstance() { return UAVObjCreateInstance(VTXInfoHandle(), &VTXInfoSetDefaults); }
+
+static inline void VTXInfoUpdated() { UAVObjUpdated(VTXInfoHandle()); }
+
+static inline void VTXInfoInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(VTXInfoHandle(), instId); }
+
+static inline int32_t VTXInfoGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(VTXInfoHandle(), dataOut); }
+
+static inline int32_t VTXInfoSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(VTXInfoHandle(), dataIn); }
+
+static inline int8_t VTXInfoReadOnly() { return UAVObjReadOnly(VTXInfoHandle()); }
+
+static inline uint16_t VTXInfoGetNumInstances(){ return UAVObjGetNumInstances(VTXInfoHandle()); }
+
+static inline uint32_t VTXInfoGetNumBytes(){ return UAVObjGetNumBytes(VTXInfoHandle()); }
+
+// Field information
+// Field Frequency information
+// Field Power information
+// Field Model information
+/* Enumeration options for field Model */
+typedef enum { VTXINFO_MODEL_NONE=0, VTXINFO_MODEL_TBSUNIFYPRO5G8=1, VTXINFO_MODEL_TBSUNIFYPRO5G8HV=2 }  __attribute__((packed)) VTXInfoModelOptions;
+#define VTXINFO_MODEL_GLOBAL_MAXOPTVAL 2
+#define VTXINFO_MODEL_MAXOPTVAL 2
+static inline bool VTXInfoModelIsValid( uint8_t CurrentModel ) { return CurrentModel <= VTXINFO_MODEL_MAXOPTVAL; }
+// Field State information
+/* Enumeration options for field State */
+typedef enum { VTXINFO_STATE_DISCONNECTED=0, VTXINFO_STATE_CONNECTED=1 }  __attribute__((packed)) VTXInfoStateOptions;
+#define VTXINFO_STATE_GLOBAL_MAXOPTVAL 1
+#define VTXINFO_STATE_MAXOPTVAL 1
+static inline bool VTXInfoStateIsValid( uint8_t CurrentState ) { return CurrentState <= VTXINFO_STATE_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void VTXInfoFrequencySet( uint16_t *NewFrequency );
+extern void VTXInfoFrequencyGet( uint16_t *NewFrequency );
+extern void VTXInfoPowerSet( uint16_t *NewPower );
+extern void VTXInfoPowerGet( uint16_t *NewPower );
+extern void VTXInfoModelSet( uint8_t *NewModel );
+extern void VTXInfoModelGet( uint8_t *NewModel );
+extern void VTXInfoStateSet( uint8_t *NewState );
+extern void VTXInfoStateGet( uint8_t *NewState );
+
+
+#endif // VTXINFO_H
+
+/**
+ * @}
+ * @}
+ */
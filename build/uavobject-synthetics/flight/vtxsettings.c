@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       vtxsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the VTXSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtxconfig.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "vtxsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = 0,
+	.gcsTelemetryUpdatePeriod = 0,
+	.loggingUpdatePeriod = 0,
+};
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VTXSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(VTXSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(VTXSETTINGS_OBJID,
+			VTXSETTINGS_ISSINGLEINST, VTXSETTINGS_ISSETTINGS, VTXSETTINGS_NUMBYTES,
+			NULL, &defaultMetadata);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void VTXSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	VTXSettingsData data = {};
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void VTXSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjSetMetadata(obj, &defaultMetadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VTXSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	VTXSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		VTXSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VTXSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VTXSettingsModeSet( uint8_t *NewMode )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewMode, offsetof( VTXSettingsData, Mode), sizeof(uint8_t));
+}
+void VTXSettingsModeGet( uint8_t *NewMode )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewMode, offsetof( VTXSettingsData, Mode), sizeof(uint8_t));
+}
+void VTXSettingsPowerSet( uint8_t *NewPower )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewPower, offsetof( VTXSettingsData, Power), sizeof(uint8_t));
+}
+void VTXSettingsPowerGet( uint8_t *NewPower )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewPower, offsetof( VTXSettingsData, Power), sizeof(uint8_t));
+}
+void VTXSettingsBandSet( uint8_t *NewBand )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewBand, offsetof( VTXSettingsData, Band), sizeof(uint8_t));
+}
+void VTXSettingsBandGet( uint8_t *NewBand )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewBand, offsetof( VTXSettingsData, Band), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_A_FrequencySet( uint8_t *NewBand_5G8_A_Frequency )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_A_Frequency, offsetof( VTXSettingsData, Band_5G8_A_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_A_FrequencyGet( uint8_t *NewBand_5G8_A_Frequency )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_A_Frequency, offsetof( VTXSettingsData, Band_5G8_A_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_B_FrequencySet( uint8_t *NewBand_5G8_B_Frequency )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_B_Frequency, offsetof( VTXSettingsData, Band_5G8_B_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_B_FrequencyGet( uint8_t *NewBand_5G8_B_Frequency )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_B_Frequency, offsetof( VTXSettingsData, Band_5G8_B_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_E_FrequencySet( uint8_t *NewBand_5G8_E_Frequency )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_E_Frequency, offsetof( VTXSettingsData, Band_5G8_E_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsBand_5G8_E_FrequencyGet( uint8_t *NewBand_5G8_E_Frequency )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewBand_5G8_E_Frequency, offsetof( VTXSettingsData, Band_5G8_E_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsAirwave_FrequencySet( uint8_t *NewAirwave_Frequency )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewAirwave_Frequency, offsetof( VTXSettingsData, Airwave_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsAirwave_FrequencyGet( uint8_t *NewAirwave_Frequency )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewAirwave_Frequency, offsetof( VTXSettingsData, Airwave_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsRaceband_FrequencySet( uint8_t *NewRaceband_Frequency )
+{
+	UAVObjSetDataField(VTXSettingsHandle(), (void*)NewRaceband_Frequency, offsetof( VTXSettingsData, Raceband_Frequency), sizeof(uint8_t));
+}
+void VTXSettingsRaceband_FrequencyGet( uint8_t *NewRaceband_Frequency )
+{
+	UAVObjGetDataField(VTXSettingsHandle(), (void*)NewRaceband_Frequency, offsetof( VTXSettingsData, Raceband_Frequency), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,188 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup VTXSettings VTXSettings
+ * @brief Video transmitter settings.
+ *
+ *
+ * @file       vtxsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the VTXSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtxconfig.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef VTXSETTINGS_H
+#define VTXSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define VTXSETTINGS_OBJID 0xB6443A2E
+#define VTXSETTINGS_ISSINGLEINST 1
+#define VTXSETTINGS_ISSETTINGS 1
+#define VTXSETTINGS_NUMBYTES 8
+
+// Generic interface functions
+int32_t VTXSettingsInitialize();
+UAVObjHandle VTXSettingsHandle();
+void VTXSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t Mode;
+    uint8_t Power;
+    uint8_t Band;
+    uint8_t Band_5G8_A_Frequency;
+    uint8_t Band_5G8_B_Frequency;
+    uint8_t Band_5G8_E_Frequency;
+    uint8_t Airwave_Frequency;
+    uint8_t Raceband_Frequency;
+
+} __attribute__((packed)) __attribute__((aligned(4))) VTXSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function VTXSettingsGet(dataOut)
+ * @brief Populate a VTXSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t VTXSettingsGet(VTXSettingsData *dataOut) { return UAVObjGetData(VTXSettingsHandle(), dataOut); }
+
+static inline int32_t VTXSettingsSet(const VTXSettingsData *dataIn) { return UAVObjSetData(VTXSettingsHandle(), dataIn); }
+
+static inline int32_t VTXSettingsInstGet(uint16_t instId, VTXSettingsData *dataOut) { return UAVObjGetInstanceData(VTXSettingsHandle(), instId, dataOut); }
+
+static inline int32_t VTXSettingsInstSet(uint16_t instId, const VTXSettingsData *dataIn) { return UAVObjSetInstanceData(VTXSettingsHandle(), instId, dataIn); }
+
+static inline int32_t VTXSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(VTXSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(VTXSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(VTXSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t VTXSettingsConnectCopy(volatile VTXSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	VTXSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(VTXSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t VTXSettingsCreateInstance() { return UAVObjCreateInstance(VTXSettingsHandle(), &VTXSettingsSetDefaults); }
+
+static inline void VTXSettingsUpdated() { UAVObjUpdated(VTXSettingsHandle()); }
+
+static inline void VTXSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(VTXSettingsHandle(), instId); }
+
+static inline int32_t VTXSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(VTXSettingsHandle(), dataOut); }
+
+static inline int32_t VTXSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(VTXSettingsHandle(), dataIn); }
+
+static inline int8_t VTXSettingsReadOnly() { return UAVObjReadOnly(VTXSettingsHandle()); }
+
+static inline uint16_t VTXSettingsGetNumInstances(){ return UAVObjGetNumInstances(VTXSettingsHandle()); }
+
+static inline uint32_t VTXSettingsGetNumBytes(){ return UAVObjGetNumBytes(VTXSettingsHandle()); }
+
+// Field information
+// Field Mode information
+/* Enumeration options for field Mode */
+typedef enum { VTXSETTINGS_MODE_ACTIVE=0, VTXSETTINGS_MODE_PASSIVE=1 }  __attribute__((packed)) VTXSettingsModeOptions;
+#define VTXSETTINGS_MODE_GLOBAL_MAXOPTVAL 1
+#define VTXSETTINGS_MODE_MAXOPTVAL 1
+static inline bool VTXSettingsModeIsValid( uint8_t CurrentMode ) { return CurrentMode <= VTXSETTINGS_MODE_MAXOPTVAL; }
+// Field Power information
+/* Enumeration options for field Power */
+typedef enum { VTXSETTINGS_POWER_25=0, VTXSETTINGS_POWER_200=1, VTXSETTINGS_POWER_500=2, VTXSETTINGS_POWER_800=3 }  __attribute__((packed)) VTXSettingsPowerOptions;
+#define VTXSETTINGS_POWER_GLOBAL_MAXOPTVAL 3
+#define VTXSETTINGS_POWER_MAXOPTVAL 3
+static inline bool VTXSettingsPowerIsValid( uint8_t CurrentPower ) { return CurrentPower <= VTXSETTINGS_POWER_MAXOPTVAL; }
+// Field Band information
+/* Enumeration options for field Band */
+typedef enum { VTXSETTINGS_BAND_BAND5G8A=0, VTXSETTINGS_BAND_BAND5G8B=1, VTXSETTINGS_BAND_BAND5G8E=2, VTXSETTINGS_BAND_AIRWAVE=3, VTXSETTINGS_BAND_RACEBAND=4 }  __attribute__((packed)) VTXSettingsBandOptions;
+#define VTXSETTINGS_BAND_GLOBAL_MAXOPTVAL 4
+#define VTXSETTINGS_BAND_MAXOPTVAL 4
+static inline bool VTXSettingsBandIsValid( uint8_t CurrentBand ) { return CurrentBand <= VTXSETTINGS_BAND_MAXOPTVAL; }
+// Field Band_5G8_A_Frequency information
+/* Enumeration options for field Band_5G8_A_Frequency */
+typedef enum { VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH15865=0, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH25845=1, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH35825=2, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH45805=3, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH55785=4, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH65765=5, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH75745=6, VTXSETTINGS_BAND_5G8_A_FREQUENCY_CH85725=7 }  __attribute__((packed)) VTXSettingsBand_5G8_A_FrequencyOptions;
+#define VTXSETTINGS_BAND_5G8_A_FREQUENCY_GLOBAL_MAXOPTVAL 7
+#define VTXSETTINGS_BAND_5G8_A_FREQUENCY_MAXOPTVAL 7
+static inline bool VTXSettingsBand_5G8_A_FrequencyIsValid( uint8_t CurrentBand_5G8_A_Frequency ) { return CurrentBand_5G8_A_Frequency <= VTXSETTINGS_BAND_5G8_A_FREQUENCY_MAXOPTVAL; }
+// Field Band_5G8_B_Frequency information
+/* Enumeration options for field Band_5G8_B_Frequency */
+typedef enum { VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH15733=0, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH25752=1, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH35771=2, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH45790=3, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH55809=4, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH65828=5, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH75847=6, VTXSETTINGS_BAND_5G8_B_FREQUENCY_CH85866=7 }  __attribute__((packed)) VTXSettingsBand_5G8_B_FrequencyOptions;
+#define VTXSETTINGS_BAND_5G8_B_FREQUENCY_GLOBAL_MAXOPTVAL 7
+#define VTXSETTINGS_BAND_5G8_B_FREQUENCY_MAXOPTVAL 7
+static inline bool VTXSettingsBand_5G8_B_FrequencyIsValid( uint8_t CurrentBand_5G8_B_Frequency ) { return CurrentBand_5G8_B_Frequency <= VTXSETTINGS_BAND_5G8_B_FREQUENCY_MAXOPTVAL; }
+// Field Band_5G8_E_Frequency information
+/* Enumeration options for field Band_5G8_E_Frequency */
+typedef enum { VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH15705=0, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH25685=1, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH35665=2, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH45645=3, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH55885=4, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH65905=5, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH75925=6, VTXSETTINGS_BAND_5G8_E_FREQUENCY_CH85945=7 }  __attribute__((packed)) VTXSettingsBand_5G8_E_FrequencyOptions;
+#define VTXSETTINGS_BAND_5G8_E_FREQUENCY_GLOBAL_MAXOPTVAL 7
+#define VTXSETTINGS_BAND_5G8_E_FREQUENCY_MAXOPTVAL 7
+static inline bool VTXSettingsBand_5G8_E_FrequencyIsValid( uint8_t CurrentBand_5G8_E_Frequency ) { return CurrentBand_5G8_E_Frequency <= VTXSETTINGS_BAND_5G8_E_FREQUENCY_MAXOPTVAL; }
+// Field Airwave_Frequency information
+/* Enumeration options for field Airwave_Frequency */
+typedef enum { VTXSETTINGS_AIRWAVE_FREQUENCY_CH15740=0, VTXSETTINGS_AIRWAVE_FREQUENCY_CH25760=1, VTXSETTINGS_AIRWAVE_FREQUENCY_CH35780=2, VTXSETTINGS_AIRWAVE_FREQUENCY_CH45800=3, VTXSETTINGS_AIRWAVE_FREQUENCY_CH55820=4, VTXSETTINGS_AIRWAVE_FREQUENCY_CH65840=5, VTXSETTINGS_AIRWAVE_FREQUENCY_CH75860=6, VTXSETTINGS_AIRWAVE_FREQUENCY_CH85880=7 }  __attribute__((packed)) VTXSettingsAirwave_FrequencyOptions;
+#define VTXSETTINGS_AIRWAVE_FREQUENCY_GLOBAL_MAXOPTVAL 7
+#define VTXSETTINGS_AIRWAVE_FREQUENCY_MAXOPTVAL 7
+static inline bool VTXSettingsAirwave_FrequencyIsValid( uint8_t CurrentAirwave_Frequency ) { return CurrentAirwave_Frequency <= VTXSETTINGS_AIRWAVE_FREQUENCY_MAXOPTVAL; }
+// Field Raceband_Frequency information
+/* Enumeration options for field Raceband_Frequency */
+typedef enum { VTXSETTINGS_RACEBAND_FREQUENCY_CH15658=0, VTXSETTINGS_RACEBAND_FREQUENCY_CH25696=1, VTXSETTINGS_RACEBAND_FREQUENCY_CH35732=2, VTXSETTINGS_RACEBAND_FREQUENCY_CH45769=3, VTXSETTINGS_RACEBAND_FREQUENCY_CH55806=4, VTXSETTINGS_RACEBAND_FREQUENCY_CH65843=5, VTXSETTINGS_RACEBAND_FREQUENCY_CH75880=6, VTXSETTINGS_RACEBAND_FREQUENCY_CH85917=7 }  __attribute__((packed)) VTXSettingsRaceband_FrequencyOptions;
+#define VTXSETTINGS_RACEBAND_FREQUENCY_GLOBAL_MAXOPTVAL 7
+#define VTXSETTINGS_RACEBAND_FREQUENCY_MAXOPTVAL 7
+static inline bool VTXSettingsRaceband_FrequencyIsValid( uint8_t CurrentRaceband_Frequency ) { return CurrentRaceband_Frequency <= VTXSETTINGS_RACEBAND_FREQUENCY_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void VTXSettingsModeSet( uint8_t *NewMode );
+extern void VTXSettingsModeGet( uint8_t *NewMode );
+extern void VTXSettingsPowerSet( uint8_t *NewPower );
+extern void VTXSettingsPowerGet( uint8_t *NewPower );
+extern void VTXSettingsBandSet( uint8_t *NewBand );
+extern void VTXSettingsBandGet( uint8_t *NewBand );
+extern void VTXSettingsBand_5G8_A_FrequencySet( uint8_t *NewBand_5G8_A_Frequency );
+extern void VTXSettingsBand_5G8_A_FrequencyGet( uint8_t *NewBand_5G8_A_Frequency );
+extern void VTXSettingsBand_5G8_B_FrequencySet( uint8_t *NewBand_5G8_B_Frequency );
+extern void VTXSettingsBand_5G8_B_FrequencyGet( uint8_t *NewBand_5G8_B_Frequency );
+extern void VTXSettingsBand_5G8_E_FrequencySet( uint8_t *NewBand_5G8_E_Frequency );
+extern void VTXSettingsBand_5G8_E_FrequencyGet( uint8_t *NewBand_5G8_E_Frequency );
+extern void VTXSettingsAirwave_FrequencySet( uint8_t *NewAirwave_Frequency );
+extern void VTXSettingsAirwave_FrequencyGet( uint8_t *NewAirwave_Frequency );
+extern void VTXSettingsRaceband_FrequencySet( uint8_t *NewRaceband_Frequency );
+extern void VTXSettingsRaceband_FrequencyGet( uint8_t *NewRaceband_Frequency );
+
+
+#endif // VTXSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,275 @@
+/**
+ ******************************************************************************
+ * @file       blackbox.c
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief Full rate blackbox stream of the rate loop
+ *
+ * The stabilization loop hands each sample to blackbox_record(), which
+ * encodes it and puts it in a ring preallocated at init.  The logging task
+ * pulls whole frames back out with blackbox_read() and writes them to the
+ * log.  Nothing is allocated or blocked on in the stabilization loop; if the
+ * ring is full the frame is counted as dropped and the next one is sent as a
+ * key frame so decoding can resume.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <blackbox.h>
+#include <circqueue.h>
+
+//! Quantized values are clamped well inside int32 so deltas never overflow
+#define BLACKBOX_QUANT_LIMIT 536870912.0f
+
+static const float field_scale[BLACKBOX_FIELDS / BLACKBOX_AXES] = {
+	BLACKBOX_RATE_SCALE,	// gyro
+	BLACKBOX_ACCEL_SCALE,	// accel
+	BLACKBOX_RATE_SCALE,	// setpoint
+	BLACKBOX_PID_SCALE,	// p
+	BLACKBOX_PID_SCALE,	// i
+	BLACKBOX_PID_SCALE,	// d
+	BLACKBOX_PID_SCALE,	// output
+};
+
+static circ_queue_t ring;
+static volatile uint8_t divider;
+static volatile bool restart;
+static volatile uint32_t dropped;
+
+static uint8_t put_uvarint(uint8_t *p, uint32_t v)
+{
+	uint8_t n = 0;
+
+	while (v >= 0x80) {
+		p[n++] = (v & 0x7f) | 0x80;
+		v >>= 7;
+	}
+	p[n++] = v;
+
+	return n;
+}
+
+static inline uint32_t zigzag(int32_t v)
+{
+	return ((uint32_t) v << 1) ^ (uint32_t) (v >> 31);
+}
+
+static int32_t quantize(float v, float scale)
+{
+	float q = v * scale;
+
+	if (q != q) {
+		return 0;
+	} else if (q > BLACKBOX_QUANT_LIMIT) {
+		q = BLACKBOX_QUANT_LIMIT;
+	} else if (q < -BLACKBOX_QUANT_LIMIT) {
+		q = -BLACKBOX_QUANT_LIMIT;
+	}
+
+	return (int32_t) (q + ((q >= 0) ? 0.5f : -0.5f));
+}
+
+/**
+ * Make the next frame from an encoder a key frame.
+ * @param[in] enc the encoder
+ */
+void blackbox_encoder_reset(struct blackbox_encoder *enc)
+{
+	enc->since_key = 0;
+}
+
+/**
+ * Encode one sample.
+ * @param[in] enc encoder state, updated to follow this frame
+ * @param[in] s the sample
+ * @param[out] frame at least BLACKBOX_MAX_FRAME bytes
+ * @returns the length of the frame including the length byte
+ */
+uint8_t blackbox_encode(struct blackbox_encoder *enc,
+		const struct blackbox_sample *s, uint8_t *frame)
+{
+	bool key = enc->since_key == 0;
+	const float *v = s->gyro;
+	uint8_t n = 1;
+
+	if (key) {
+		frame[n++] = BLACKBOX_FRAME_KEY;
+		n += put_uvarint(frame + n, s->time_us);
+	} else {
+		frame[n++] = BLACKBOX_FRAME_DELTA;
+		n += put_uvarint(frame + n, s->time_us - enc->last_time);
+	}
+
+	for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+		int32_t q = quantize(v[f], field_scale[f / BLACKBOX_AXES]);
+
+		n += put_uvarint(frame + n, zigzag(key ? q : q - enc->last[f]));
+		enc->last[f] = q;
+	}
+
+	enc->last_time = s->time_us;
+
+	if (++enc->since_key >= BLACKBOX_KEY_INTERVAL) {
+		enc->since_key = 0;
+	}
+
+	frame[0] = n - 1;
+
+	return n;
+}
+
+/**
+ * Allocate the frame ring.  Must be done before anything else is called.
+ * @param[in] ring_bytes size of the ring
+ * @returns 0 on success, -1 if the ring could not be allocated
+ */
+int32_t blackbox_init(uint16_t ring_bytes)
+{
+	if (ring) {
+		return 0;
+	}
+
+	ring = circ_queue_new(1, ring_bytes);
+
+	return ring ? 0 : -1;
+}
+
+/**
+ * Start recording, called from the reader.  Whatever frames remain from a
+ * previous recording are discarded and the first frame is a key frame.
+ * @param[in] rate_divider record every rate_divider'th sample, 0 to stop
+ */
+void blackbox_start(uint8_t rate_divider)
+{
+	if (!ring) {
+		return;
+	}
+
+	/* Recording is stopped, so there is no partial frame in the ring */
+	circ_queue_clear(ring);
+
+	dropped = 0;
+	restart = true;
+	divider = rate_divider;
+}
+
+/**
+ * Stop recording.  Frames already in the ring can still be read.
+ */
+void blackbox_stop(void)
+{
+	divider = 0;
+}
+
+/**
+ * Check whether the caller should fill in and record a sample this loop.
+ * @returns true if a sample should be passed to blackbox_record
+ */
+bool blackbox_sample_due(void)
+{
+	static uint8_t count;
+
+	uint8_t div = divider;
+
+	if (!div) {
+		return false;
+	}
+
+	if (++count < div) {
+		return false;
+	}
+
+	count = 0;
+
+	return true;
+}
+
+/**
+ * Encode a sample into the ring.  Only to be called from one thread.
+ * @param[in] s the sample
+ */
+void blackbox_record(const struct blackbox_sample *s)
+{
+	/* Static to keep them off the stabilization stack */
+	static struct blackbox_encoder enc;
+	static uint8_t frame[BLACKBOX_MAX_FRAME];
+	uint16_t avail;
+
+	if (restart) {
+		restart = false;
+		blackbox_encoder_reset(&enc);
+	}
+
+	uint8_t len = blackbox_encode(&enc, s, frame);
+
+	circ_queue_write_pos(ring, NULL, &avail);
+
+	if (avail < len) {
+		/* The reader can't keep up.  Drop the frame, and since the
+		 * next delta would be against it, follow with a key frame. */
+		dropped++;
+		blackbox_encoder_reset(&enc);
+		return;
+	}
+
+	circ_queue_write_data(ring, frame, len);
+}
+
+/**
+ * Take whole frames out of the ring.
+ * @param[out] buf where to put the frames
+ * @param[in] len size of buf
+ * @returns the number of bytes put in buf
+ */
+uint16_t blackbox_read(uint8_t *buf, uint16_t len)
+{
+	uint16_t total = 0;
+
+	if (!ring) {
+		return 0;
+	}
+
+	while (true) {
+		uint16_t avail;
+		uint8_t *pos = circ_queue_read_pos(ring, NULL, &avail);
+
+		if (!pos) {
+			break;
+		}
+
+		uint16_t frame_len = pos[0] + 1;
+
+		/* Partly written by a write that wrapped, or won't fit */
+		if (frame_len > avail || frame_len > len - total) {
+			break;
+		}
+
+		circ_queue_read_data(ring, buf + total, frame_len);
+		total += frame_len;
+	}
+
+	return total;
+}
+
+/**
+ * @returns the number of frames dropped since blackbox_start
+ */
+uint32_t blackbox_dropped(void)
+{
+	return dropped;
+}
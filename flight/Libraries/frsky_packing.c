@@ -569,19 +569,13 @@ bool frsky_encode_airspeed(struct frsky_settings *frsky, uint32_t *value, bool t
 }
 
 /**
- * Performs byte stuffing and checksum calculation
+ * Performs byte stuffing
  * @param[out] obuff buffer where byte stuffed data will came in
- * @param[in,out] chk checksum byte to update
  * @param[in] byte
  * @returns count of bytes inserted to obuff (1 or 2)
  */
-uint8_t frsky_insert_byte(uint8_t *obuff, uint16_t *chk, uint8_t byte)
+uint8_t frsky_insert_byte(uint8_t *obuff, uint8_t byte)
 {
-	/* checksum calculation is based on data before byte-stuffing */
-	*chk += byte;
-	*chk += (*chk) >> 8;
-	*chk &= 0x00ff;
-
 	if (byte == 0x7e || byte == 0x7d) {
 		obuff[0] = 0x7d;
 		obuff[1] = byte &= ~0x20;
@@ -604,23 +598,33 @@ int32_t frsky_send_frame(uintptr_t com, enum frsky_value_id id, uint32_t value,
 	 * and therefore the worst-case is 17 bytes total (the first byte 0x10 won't be
 	 * escaped) */
 	uint8_t tx_data[17];
-	uint16_t chk = 0;
 	uint8_t cnt = 0;
 
+	uint8_t frame[8] = {
+		0x10,
+		(uint16_t)id & 0xff,
+		((uint16_t)id >> 8) & 0xff,
+		value & 0xff,
+		(value >> 8) & 0xff,
+		(value >> 16) & 0xff,
+		(value >> 24) & 0xff,
+	};
+
+	/* checksum is the 8 bit sum with end-around carry of the data
+	 * before byte-stuffing, seven bytes need at most two folds */
+	uint32_t chk = PIOS_CRC_sumBytes(0, frame, 7);
+	chk = (chk & 0xff) + (chk >> 8);
+	chk = (chk & 0xff) + (chk >> 8);
+	frame[7] = 0xff - chk;
+
 	if (send_prelude) {
 		tx_data[0] = 0x7e;
 		tx_data[1] = 0x98;
 		cnt = 2;
 	}
 
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, 0x10);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, (uint16_t)id & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, ((uint16_t)id >> 8) & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, value & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, (value >> 8) & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, (value >> 16) & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, (value >> 24) & 0xff);
-	cnt += frsky_insert_byte(&tx_data[cnt], &chk, 0xff - chk);
+	for (unsigned i = 0; i < sizeof(frame); i++)
+		cnt += frsky_insert_byte(&tx_data[cnt], frame[i]);
 
 	PIOS_COM_SendBuffer(com, tx_data, cnt);
 
@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file       blackbox.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief Full rate blackbox stream of the rate loop
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#ifndef BLACKBOX_H
+#define BLACKBOX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Frame format.  Every frame is a length byte counting the bytes that
+ * follow it, a type byte, the time and then BLACKBOX_FIELDS values in the
+ * order of struct blackbox_sample.  Values are quantized to integers with
+ * the scales below.
+ *
+ * A key frame holds the time in microseconds as an unsigned varint and each
+ * value as a zigzag varint.  A delta frame holds the microseconds since the
+ * previous frame and the difference of each value from the previous frame,
+ * encoded the same way, so it can only be decoded following an unbroken run
+ * of frames back to a key frame.
+ *
+ * The varints are LEB128: 7 bits per byte, least significant first, with
+ * the top bit set on every byte but the last.
+ */
+#define BLACKBOX_FRAME_KEY   'K'
+#define BLACKBOX_FRAME_DELTA 'D'
+
+//! Frames between key frames when nothing is dropped
+#define BLACKBOX_KEY_INTERVAL 32
+
+//! Counts per deg/s of the gyro and setpoint
+#define BLACKBOX_RATE_SCALE   16
+//! Counts per m/s^2 of the accelerometer
+#define BLACKBOX_ACCEL_SCALE  256
+//! Counts per unit of actuator desired for the PID terms and output
+#define BLACKBOX_PID_SCALE    4096
+
+#define BLACKBOX_AXES   3
+#define BLACKBOX_FIELDS (7 * BLACKBOX_AXES)
+
+//! Longest possible frame including the length byte
+#define BLACKBOX_MAX_FRAME (2 + 5 + 5 * BLACKBOX_FIELDS)
+
+//! One iteration of the rate loop, roll/pitch/yaw for each member
+struct blackbox_sample {
+	uint32_t time_us;
+	float gyro[BLACKBOX_AXES];	// deg/s
+	float accel[BLACKBOX_AXES];	// m/s^2
+	float setpoint[BLACKBOX_AXES];	// deg/s
+	float p[BLACKBOX_AXES];		// rate PID proportional term
+	float i[BLACKBOX_AXES];		// rate PID integral term
+	float d[BLACKBOX_AXES];		// rate PID derivative term
+	float output[BLACKBOX_AXES];	// actuator desired
+};
+
+struct blackbox_encoder {
+	int32_t last[BLACKBOX_FIELDS];
+	uint32_t last_time;
+	uint8_t since_key;	// 0 forces the next frame to be a key frame
+};
+
+void blackbox_encoder_reset(struct blackbox_encoder *enc);
+uint8_t blackbox_encode(struct blackbox_encoder *enc,
+		const struct blackbox_sample *s, uint8_t *frame);
+
+int32_t blackbox_init(uint16_t ring_bytes);
+void blackbox_start(uint8_t divider);
+void blackbox_stop(void);
+bool blackbox_sample_due(void);
+void blackbox_record(const struct blackbox_sample *s);
+uint16_t blackbox_read(uint8_t *buf, uint16_t len);
+uint32_t blackbox_dropped(void);
+
+#endif /* BLACKBOX_H */
@@ -0,0 +1,471 @@
+/**
+ ******************************************************************************
+ * @file       insgps14state_kernel.h
+ * @brief      Structure specialized covariance kernels for the 14 state INS
+ *
+ * THIS FILE IS GENERATED BY python/ins/gen_kernel.py, DO NOT EDIT.
+ *
+ * Only included by insgps14state.c. P is the packed upper triangle of the
+ * covariance matrix, indexed with PIDX(i,j) for i <= j.
+ *****************************************************************************/
+
+#ifndef INSGPS14STATE_KERNEL_H
+#define INSGPS14STATE_KERNEL_H
+
+#ifndef COVARIANCE_PREDICTION_GENERAL
+void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
+			  float Q[NUMW], float dT, float P[NUMP])
+{
+	const float T = dT;
+	const float Tsq = dT * dT;
+
+	// F*T
+	const float f3_6 = F[3][6] * T;
+	const float f3_7 = F[3][7] * T;
+	const float f3_8 = F[3][8] * T;
+	const float f3_9 = F[3][9] * T;
+	const float f3_13 = F[3][13] * T;
+	const float f4_6 = F[4][6] * T;
+	const float f4_7 = F[4][7] * T;
+	const float f4_8 = F[4][8] * T;
+	const float f4_9 = F[4][9] * T;
+	const float f4_13 = F[4][13] * T;
+	const float f5_6 = F[5][6] * T;
+	const float f5_7 = F[5][7] * T;
+	const float f5_8 = F[5][8] * T;
+	const float f5_9 = F[5][9] * T;
+	const float f5_13 = F[5][13] * T;
+	const float f6_7 = F[6][7] * T;
+	const float f6_8 = F[6][8] * T;
+	const float f6_9 = F[6][9] * T;
+	const float f6_10 = F[6][10] * T;
+	const float f6_11 = F[6][11] * T;
+	const float f6_12 = F[6][12] * T;
+	const float f7_6 = F[7][6] * T;
+	const float f7_8 = F[7][8] * T;
+	const float f7_9 = F[7][9] * T;
+	const float f7_10 = F[7][10] * T;
+	const float f7_11 = F[7][11] * T;
+	const float f7_12 = F[7][12] * T;
+	const float f8_6 = F[8][6] * T;
+	const float f8_7 = F[8][7] * T;
+	const float f8_9 = F[8][9] * T;
+	const float f8_10 = F[8][10] * T;
+	const float f8_11 = F[8][11] * T;
+	const float f8_12 = F[8][12] * T;
+	const float f9_6 = F[9][6] * T;
+	const float f9_7 = F[9][7] * T;
+	const float f9_8 = F[9][8] * T;
+	const float f9_10 = F[9][10] * T;
+	const float f9_11 = F[9][11] * T;
+	const float f9_12 = F[9][12] * T;
+
+	// Q*T^2
+	const float q0 = Q[0] * Tsq;
+	const float q1 = Q[1] * Tsq;
+	const float q2 = Q[2] * Tsq;
+	const float q3 = Q[3] * Tsq;
+	const float q4 = Q[4] * Tsq;
+	const float q5 = Q[5] * Tsq;
+	const float q6 = Q[6] * Tsq;
+	const float q7 = Q[7] * Tsq;
+	const float q8 = Q[8] * Tsq;
+	const float q9 = Q[9] * Tsq;
+
+	// A = (I+F*T)*P, rows without any F terms are just P
+	const float a0_0 = P[PIDX(0,0)] + T*P[PIDX(0,3)];
+	const float a0_1 = P[PIDX(0,1)] + T*P[PIDX(1,3)];
+	const float a0_2 = P[PIDX(0,2)] + T*P[PIDX(2,3)];
+	const float a0_3 = P[PIDX(0,3)] + T*P[PIDX(3,3)];
+	const float a0_4 = P[PIDX(0,4)] + T*P[PIDX(3,4)];
+	const float a0_5 = P[PIDX(0,5)] + T*P[PIDX(3,5)];
+	const float a0_6 = P[PIDX(0,6)] + T*P[PIDX(3,6)];
+	const float a0_7 = P[PIDX(0,7)] + T*P[PIDX(3,7)];
+	const float a0_8 = P[PIDX(0,8)] + T*P[PIDX(3,8)];
+	const float a0_9 = P[PIDX(0,9)] + T*P[PIDX(3,9)];
+	const float a0_10 = P[PIDX(0,10)] + T*P[PIDX(3,10)];
+	const float a0_11 = P[PIDX(0,11)] + T*P[PIDX(3,11)];
+	const float a0_12 = P[PIDX(0,12)] + T*P[PIDX(3,12)];
+	const float a0_13 = P[PIDX(0,13)] + T*P[PIDX(3,13)];
+	const float a1_1 = P[PIDX(1,1)] + T*P[PIDX(1,4)];
+	const float a1_2 = P[PIDX(1,2)] + T*P[PIDX(2,4)];
+	const float a1_3 = P[PIDX(1,3)] + T*P[PIDX(3,4)];
+	const float a1_4 = P[PIDX(1,4)] + T*P[PIDX(4,4)];
+	const float a1_5 = P[PIDX(1,5)] + T*P[PIDX(4,5)];
+	const float a1_6 = P[PIDX(1,6)] + T*P[PIDX(4,6)];
+	const float a1_7 = P[PIDX(1,7)] + T*P[PIDX(4,7)];
+	const float a1_8 = P[PIDX(1,8)] + T*P[PIDX(4,8)];
+	const float a1_9 = P[PIDX(1,9)] + T*P[PIDX(4,9)];
+	const float a1_10 = P[PIDX(1,10)] + T*P[PIDX(4,10)];
+	const float a1_11 = P[PIDX(1,11)] + T*P[PIDX(4,11)];
+	const float a1_12 = P[PIDX(1,12)] + T*P[PIDX(4,12)];
+	const float a1_13 = P[PIDX(1,13)] + T*P[PIDX(4,13)];
+	const float a2_2 = P[PIDX(2,2)] + T*P[PIDX(2,5)];
+	const float a2_3 = P[PIDX(2,3)] + T*P[PIDX(3,5)];
+	const float a2_4 = P[PIDX(2,4)] + T*P[PIDX(4,5)];
+	const float a2_5 = P[PIDX(2,5)] + T*P[PIDX(5,5)];
+	const float a2_6 = P[PIDX(2,6)] + T*P[PIDX(5,6)];
+	const float a2_7 = P[PIDX(2,7)] + T*P[PIDX(5,7)];
+	const float a2_8 = P[PIDX(2,8)] + T*P[PIDX(5,8)];
+	const float a2_9 = P[PIDX(2,9)] + T*P[PIDX(5,9)];
+	const float a2_10 = P[PIDX(2,10)] + T*P[PIDX(5,10)];
+	const float a2_11 = P[PIDX(2,11)] + T*P[PIDX(5,11)];
+	const float a2_12 = P[PIDX(2,12)] + T*P[PIDX(5,12)];
+	const float a2_13 = P[PIDX(2,13)] + T*P[PIDX(5,13)];
+	const float a3_3 = P[PIDX(3,3)] + f3_6*P[PIDX(3,6)] + f3_7*P[PIDX(3,7)] + f3_8*P[PIDX(3,8)] + f3_9*P[PIDX(3,9)] + f3_13*P[PIDX(3,13)];
+	const float a3_4 = P[PIDX(3,4)] + f3_6*P[PIDX(4,6)] + f3_7*P[PIDX(4,7)] + f3_8*P[PIDX(4,8)] + f3_9*P[PIDX(4,9)] + f3_13*P[PIDX(4,13)];
+	const float a3_5 = P[PIDX(3,5)] + f3_6*P[PIDX(5,6)] + f3_7*P[PIDX(5,7)] + f3_8*P[PIDX(5,8)] + f3_9*P[PIDX(5,9)] + f3_13*P[PIDX(5,13)];
+	const float a3_6 = P[PIDX(3,6)] + f3_6*P[PIDX(6,6)] + f3_7*P[PIDX(6,7)] + f3_8*P[PIDX(6,8)] + f3_9*P[PIDX(6,9)] + f3_13*P[PIDX(6,13)];
+	const float a3_7 = P[PIDX(3,7)] + f3_6*P[PIDX(6,7)] + f3_7*P[PIDX(7,7)] + f3_8*P[PIDX(7,8)] + f3_9*P[PIDX(7,9)] + f3_13*P[PIDX(7,13)];
+	const float a3_8 = P[PIDX(3,8)] + f3_6*P[PIDX(6,8)] + f3_7*P[PIDX(7,8)] + f3_8*P[PIDX(8,8)] + f3_9*P[PIDX(8,9)] + f3_13*P[PIDX(8,13)];
+	const float a3_9 = P[PIDX(3,9)] + f3_6*P[PIDX(6,9)] + f3_7*P[PIDX(7,9)] + f3_8*P[PIDX(8,9)] + f3_9*P[PIDX(9,9)] + f3_13*P[PIDX(9,13)];
+	const float a3_10 = P[PIDX(3,10)] + f3_6*P[PIDX(6,10)] + f3_7*P[PIDX(7,10)] + f3_8*P[PIDX(8,10)] + f3_9*P[PIDX(9,10)] + f3_13*P[PIDX(10,13)];
+	const float a3_11 = P[PIDX(3,11)] + f3_6*P[PIDX(6,11)] + f3_7*P[PIDX(7,11)] + f3_8*P[PIDX(8,11)] + f3_9*P[PIDX(9,11)] + f3_13*P[PIDX(11,13)];
+	const float a3_12 = P[PIDX(3,12)] + f3_6*P[PIDX(6,12)] + f3_7*P[PIDX(7,12)] + f3_8*P[PIDX(8,12)] + f3_9*P[PIDX(9,12)] + f3_13*P[PIDX(12,13)];
+	const float a3_13 = P[PIDX(3,13)] + f3_6*P[PIDX(6,13)] + f3_7*P[PIDX(7,13)] + f3_8*P[PIDX(8,13)] + f3_9*P[PIDX(9,13)] + f3_13*P[PIDX(13,13)];
+	const float a4_4 = P[PIDX(4,4)] + f4_6*P[PIDX(4,6)] + f4_7*P[PIDX(4,7)] + f4_8*P[PIDX(4,8)] + f4_9*P[PIDX(4,9)] + f4_13*P[PIDX(4,13)];
+	const float a4_5 = P[PIDX(4,5)] + f4_6*P[PIDX(5,6)] + f4_7*P[PIDX(5,7)] + f4_8*P[PIDX(5,8)] + f4_9*P[PIDX(5,9)] + f4_13*P[PIDX(5,13)];
+	const float a4_6 = P[PIDX(4,6)] + f4_6*P[PIDX(6,6)] + f4_7*P[PIDX(6,7)] + f4_8*P[PIDX(6,8)] + f4_9*P[PIDX(6,9)] + f4_13*P[PIDX(6,13)];
+	const float a4_7 = P[PIDX(4,7)] + f4_6*P[PIDX(6,7)] + f4_7*P[PIDX(7,7)] + f4_8*P[PIDX(7,8)] + f4_9*P[PIDX(7,9)] + f4_13*P[PIDX(7,13)];
+	const float a4_8 = P[PIDX(4,8)] + f4_6*P[PIDX(6,8)] + f4_7*P[PIDX(7,8)] + f4_8*P[PIDX(8,8)] + f4_9*P[PIDX(8,9)] + f4_13*P[PIDX(8,13)];
+	const float a4_9 = P[PIDX(4,9)] + f4_6*P[PIDX(6,9)] + f4_7*P[PIDX(7,9)] + f4_8*P[PIDX(8,9)] + f4_9*P[PIDX(9,9)] + f4_13*P[PIDX(9,13)];
+	const float a4_10 = P[PIDX(4,10)] + f4_6*P[PIDX(6,10)] + f4_7*P[PIDX(7,10)] + f4_8*P[PIDX(8,10)] + f4_9*P[PIDX(9,10)] + f4_13*P[PIDX(10,13)];
+	const float a4_11 = P[PIDX(4,11)] + f4_6*P[PIDX(6,11)] + f4_7*P[PIDX(7,11)] + f4_8*P[PIDX(8,11)] + f4_9*P[PIDX(9,11)] + f4_13*P[PIDX(11,13)];
+	const float a4_12 = P[PIDX(4,12)] + f4_6*P[PIDX(6,12)] + f4_7*P[PIDX(7,12)] + f4_8*P[PIDX(8,12)] + f4_9*P[PIDX(9,12)] + f4_13*P[PIDX(12,13)];
+	const float a4_13 = P[PIDX(4,13)] + f4_6*P[PIDX(6,13)] + f4_7*P[PIDX(7,13)] + f4_8*P[PIDX(8,13)] + f4_9*P[PIDX(9,13)] + f4_13*P[PIDX(13,13)];
+	const float a5_5 = P[PIDX(5,5)] + f5_6*P[PIDX(5,6)] + f5_7*P[PIDX(5,7)] + f5_8*P[PIDX(5,8)] + f5_9*P[PIDX(5,9)] + f5_13*P[PIDX(5,13)];
+	const float a5_6 = P[PIDX(5,6)] + f5_6*P[PIDX(6,6)] + f5_7*P[PIDX(6,7)] + f5_8*P[PIDX(6,8)] + f5_9*P[PIDX(6,9)] + f5_13*P[PIDX(6,13)];
+	const float a5_7 = P[PIDX(5,7)] + f5_6*P[PIDX(6,7)] + f5_7*P[PIDX(7,7)] + f5_8*P[PIDX(7,8)] + f5_9*P[PIDX(7,9)] + f5_13*P[PIDX(7,13)];
+	const float a5_8 = P[PIDX(5,8)] + f5_6*P[PIDX(6,8)] + f5_7*P[PIDX(7,8)] + f5_8*P[PIDX(8,8)] + f5_9*P[PIDX(8,9)] + f5_13*P[PIDX(8,13)];
+	const float a5_9 = P[PIDX(5,9)] + f5_6*P[PIDX(6,9)] + f5_7*P[PIDX(7,9)] + f5_8*P[PIDX(8,9)] + f5_9*P[PIDX(9,9)] + f5_13*P[PIDX(9,13)];
+	const float a5_10 = P[PIDX(5,10)] + f5_6*P[PIDX(6,10)] + f5_7*P[PIDX(7,10)] + f5_8*P[PIDX(8,10)] + f5_9*P[PIDX(9,10)] + f5_13*P[PIDX(10,13)];
+	const float a5_11 = P[PIDX(5,11)] + f5_6*P[PIDX(6,11)] + f5_7*P[PIDX(7,11)] + f5_8*P[PIDX(8,11)] + f5_9*P[PIDX(9,11)] + f5_13*P[PIDX(11,13)];
+	const float a5_12 = P[PIDX(5,12)] + f5_6*P[PIDX(6,12)] + f5_7*P[PIDX(7,12)] + f5_8*P[PIDX(8,12)] + f5_9*P[PIDX(9,12)] + f5_13*P[PIDX(12,13)];
+	const float a5_13 = P[PIDX(5,13)] + f5_6*P[PIDX(6,13)] + f5_7*P[PIDX(7,13)] + f5_8*P[PIDX(8,13)] + f5_9*P[PIDX(9,13)] + f5_13*P[PIDX(13,13)];
+	const float a6_6 = P[PIDX(6,6)] + f6_7*P[PIDX(6,7)] + f6_8*P[PIDX(6,8)] + f6_9*P[PIDX(6,9)] + f6_10*P[PIDX(6,10)] + f6_11*P[PIDX(6,11)] + f6_12*P[PIDX(6,12)];
+	const float a6_7 = P[PIDX(6,7)] + f6_7*P[PIDX(7,7)] + f6_8*P[PIDX(7,8)] + f6_9*P[PIDX(7,9)] + f6_10*P[PIDX(7,10)] + f6_11*P[PIDX(7,11)] + f6_12*P[PIDX(7,12)];
+	const float a6_8 = P[PIDX(6,8)] + f6_7*P[PIDX(7,8)] + f6_8*P[PIDX(8,8)] + f6_9*P[PIDX(8,9)] + f6_10*P[PIDX(8,10)] + f6_11*P[PIDX(8,11)] + f6_12*P[PIDX(8,12)];
+	const float a6_9 = P[PIDX(6,9)] + f6_7*P[PIDX(7,9)] + f6_8*P[PIDX(8,9)] + f6_9*P[PIDX(9,9)] + f6_10*P[PIDX(9,10)] + f6_11*P[PIDX(9,11)] + f6_12*P[PIDX(9,12)];
+	const float a6_10 = P[PIDX(6,10)] + f6_7*P[PIDX(7,10)] + f6_8*P[PIDX(8,10)] + f6_9*P[PIDX(9,10)] + f6_10*P[PIDX(10,10)] + f6_11*P[PIDX(10,11)] + f6_12*P[PIDX(10,12)];
+	const float a6_11 = P[PIDX(6,11)] + f6_7*P[PIDX(7,11)] + f6_8*P[PIDX(8,11)] + f6_9*P[PIDX(9,11)] + f6_10*P[PIDX(10,11)] + f6_11*P[PIDX(11,11)] + f6_12*P[PIDX(11,12)];
+	const float a6_12 = P[PIDX(6,12)] + f6_7*P[PIDX(7,12)] + f6_8*P[PIDX(8,12)] + f6_9*P[PIDX(9,12)] + f6_10*P[PIDX(10,12)] + f6_11*P[PIDX(11,12)] + f6_12*P[PIDX(12,12)];
+	const float a6_13 = P[PIDX(6,13)] + f6_7*P[PIDX(7,13)] + f6_8*P[PIDX(8,13)] + f6_9*P[PIDX(9,13)] + f6_10*P[PIDX(10,13)] + f6_11*P[PIDX(11,13)] + f6_12*P[PIDX(12,13)];
+	const float a7_6 = P[PIDX(6,7)] + f7_6*P[PIDX(6,6)] + f7_8*P[PIDX(6,8)] + f7_9*P[PIDX(6,9)] + f7_10*P[PIDX(6,10)] + f7_11*P[PIDX(6,11)] + f7_12*P[PIDX(6,12)];
+	const float a7_7 = P[PIDX(7,7)] + f7_6*P[PIDX(6,7)] + f7_8*P[PIDX(7,8)] + f7_9*P[PIDX(7,9)] + f7_10*P[PIDX(7,10)] + f7_11*P[PIDX(7,11)] + f7_12*P[PIDX(7,12)];
+	const float a7_8 = P[PIDX(7,8)] + f7_6*P[PIDX(6,8)] + f7_8*P[PIDX(8,8)] + f7_9*P[PIDX(8,9)] + f7_10*P[PIDX(8,10)] + f7_11*P[PIDX(8,11)] + f7_12*P[PIDX(8,12)];
+	const float a7_9 = P[PIDX(7,9)] + f7_6*P[PIDX(6,9)] + f7_8*P[PIDX(8,9)] + f7_9*P[PIDX(9,9)] + f7_10*P[PIDX(9,10)] + f7_11*P[PIDX(9,11)] + f7_12*P[PIDX(9,12)];
+	const float a7_10 = P[PIDX(7,10)] + f7_6*P[PIDX(6,10)] + f7_8*P[PIDX(8,10)] + f7_9*P[PIDX(9,10)] + f7_10*P[PIDX(10,10)] + f7_11*P[PIDX(10,11)] + f7_12*P[PIDX(10,12)];
+	const float a7_11 = P[PIDX(7,11)] + f7_6*P[PIDX(6,11)] + f7_8*P[PIDX(8,11)] + f7_9*P[PIDX(9,11)] + f7_10*P[PIDX(10,11)] + f7_11*P[PIDX(11,11)] + f7_12*P[PIDX(11,12)];
+	const float a7_12 = P[PIDX(7,12)] + f7_6*P[PIDX(6,12)] + f7_8*P[PIDX(8,12)] + f7_9*P[PIDX(9,12)] + f7_10*P[PIDX(10,12)] + f7_11*P[PIDX(11,12)] + f7_12*P[PIDX(12,12)];
+	const float a7_13 = P[PIDX(7,13)] + f7_6*P[PIDX(6,13)] + f7_8*P[PIDX(8,13)] + f7_9*P[PIDX(9,13)] + f7_10*P[PIDX(10,13)] + f7_11*P[PIDX(11,13)] + f7_12*P[PIDX(12,13)];
+	const float a8_6 = P[PIDX(6,8)] + f8_6*P[PIDX(6,6)] + f8_7*P[PIDX(6,7)] + f8_9*P[PIDX(6,9)] + f8_10*P[PIDX(6,10)] + f8_11*P[PIDX(6,11)] + f8_12*P[PIDX(6,12)];
+	const float a8_7 = P[PIDX(7,8)] + f8_6*P[PIDX(6,7)] + f8_7*P[PIDX(7,7)] + f8_9*P[PIDX(7,9)] + f8_10*P[PIDX(7,10)] + f8_11*P[PIDX(7,11)] + f8_12*P[PIDX(7,12)];
+	const float a8_8 = P[PIDX(8,8)] + f8_6*P[PIDX(6,8)] + f8_7*P[PIDX(7,8)] + f8_9*P[PIDX(8,9)] + f8_10*P[PIDX(8,10)] + f8_11*P[PIDX(8,11)] + f8_12*P[PIDX(8,12)];
+	const float a8_9 = P[PIDX(8,9)] + f8_6*P[PIDX(6,9)] + f8_7*P[PIDX(7,9)] + f8_9*P[PIDX(9,9)] + f8_10*P[PIDX(9,10)] + f8_11*P[PIDX(9,11)] + f8_12*P[PIDX(9,12)];
+	const float a8_10 = P[PIDX(8,10)] + f8_6*P[PIDX(6,10)] + f8_7*P[PIDX(7,10)] + f8_9*P[PIDX(9,10)] + f8_10*P[PIDX(10,10)] + f8_11*P[PIDX(10,11)] + f8_12*P[PIDX(10,12)];
+	const float a8_11 = P[PIDX(8,11)] + f8_6*P[PIDX(6,11)] + f8_7*P[PIDX(7,11)] + f8_9*P[PIDX(9,11)] + f8_10*P[PIDX(10,11)] + f8_11*P[PIDX(11,11)] + f8_12*P[PIDX(11,12)];
+	const float a8_12 = P[PIDX(8,12)] + f8_6*P[PIDX(6,12)] + f8_7*P[PIDX(7,12)] + f8_9*P[PIDX(9,12)] + f8_10*P[PIDX(10,12)] + f8_11*P[PIDX(11,12)] + f8_12*P[PIDX(12,12)];
+	const float a8_13 = P[PIDX(8,13)] + f8_6*P[PIDX(6,13)] + f8_7*P[PIDX(7,13)] + f8_9*P[PIDX(9,13)] + f8_10*P[PIDX(10,13)] + f8_11*P[PIDX(11,13)] + f8_12*P[PIDX(12,13)];
+	const float a9_6 = P[PIDX(6,9)] + f9_6*P[PIDX(6,6)] + f9_7*P[PIDX(6,7)] + f9_8*P[PIDX(6,8)] + f9_10*P[PIDX(6,10)] + f9_11*P[PIDX(6,11)] + f9_12*P[PIDX(6,12)];
+	const float a9_7 = P[PIDX(7,9)] + f9_6*P[PIDX(6,7)] + f9_7*P[PIDX(7,7)] + f9_8*P[PIDX(7,8)] + f9_10*P[PIDX(7,10)] + f9_11*P[PIDX(7,11)] + f9_12*P[PIDX(7,12)];
+	const float a9_8 = P[PIDX(8,9)] + f9_6*P[PIDX(6,8)] + f9_7*P[PIDX(7,8)] + f9_8*P[PIDX(8,8)] + f9_10*P[PIDX(8,10)] + f9_11*P[PIDX(8,11)] + f9_12*P[PIDX(8,12)];
+	const float a9_9 = P[PIDX(9,9)] + f9_6*P[PIDX(6,9)] + f9_7*P[PIDX(7,9)] + f9_8*P[PIDX(8,9)] + f9_10*P[PIDX(9,10)] + f9_11*P[PIDX(9,11)] + f9_12*P[PIDX(9,12)];
+	const float a9_10 = P[PIDX(9,10)] + f9_6*P[PIDX(6,10)] + f9_7*P[PIDX(7,10)] + f9_8*P[PIDX(8,10)] + f9_10*P[PIDX(10,10)] + f9_11*P[PIDX(10,11)] + f9_12*P[PIDX(10,12)];
+	const float a9_11 = P[PIDX(9,11)] + f9_6*P[PIDX(6,11)] + f9_7*P[PIDX(7,11)] + f9_8*P[PIDX(8,11)] + f9_10*P[PIDX(10,11)] + f9_11*P[PIDX(11,11)] + f9_12*P[PIDX(11,12)];
+	const float a9_12 = P[PIDX(9,12)] + f9_6*P[PIDX(6,12)] + f9_7*P[PIDX(7,12)] + f9_8*P[PIDX(8,12)] + f9_10*P[PIDX(10,12)] + f9_11*P[PIDX(11,12)] + f9_12*P[PIDX(12,12)];
+	const float a9_13 = P[PIDX(9,13)] + f9_6*P[PIDX(6,13)] + f9_7*P[PIDX(7,13)] + f9_8*P[PIDX(8,13)] + f9_10*P[PIDX(10,13)] + f9_11*P[PIDX(11,13)] + f9_12*P[PIDX(12,13)];
+
+	// Pnew = A*(I+F*T)' + T^2*G*Q*G'
+	P[PIDX(0,0)] = a0_0 + T*a0_3;
+	P[PIDX(0,1)] = a0_1 + T*a0_4;
+	P[PIDX(0,2)] = a0_2 + T*a0_5;
+	P[PIDX(0,3)] = a0_3 + f3_6*a0_6 + f3_7*a0_7 + f3_8*a0_8 + f3_9*a0_9 + f3_13*a0_13;
+	P[PIDX(0,4)] = a0_4 + f4_6*a0_6 + f4_7*a0_7 + f4_8*a0_8 + f4_9*a0_9 + f4_13*a0_13;
+	P[PIDX(0,5)] = a0_5 + f5_6*a0_6 + f5_7*a0_7 + f5_8*a0_8 + f5_9*a0_9 + f5_13*a0_13;
+	P[PIDX(0,6)] = a0_6 + f6_7*a0_7 + f6_8*a0_8 + f6_9*a0_9 + f6_10*a0_10 + f6_11*a0_11 + f6_12*a0_12;
+	P[PIDX(0,7)] = a0_7 + f7_6*a0_6 + f7_8*a0_8 + f7_9*a0_9 + f7_10*a0_10 + f7_11*a0_11 + f7_12*a0_12;
+	P[PIDX(0,8)] = a0_8 + f8_6*a0_6 + f8_7*a0_7 + f8_9*a0_9 + f8_10*a0_10 + f8_11*a0_11 + f8_12*a0_12;
+	P[PIDX(0,9)] = a0_9 + f9_6*a0_6 + f9_7*a0_7 + f9_8*a0_8 + f9_10*a0_10 + f9_11*a0_11 + f9_12*a0_12;
+	P[PIDX(0,10)] = a0_10;
+	P[PIDX(0,11)] = a0_11;
+	P[PIDX(0,12)] = a0_12;
+	P[PIDX(0,13)] = a0_13;
+	P[PIDX(1,1)] = a1_1 + T*a1_4;
+	P[PIDX(1,2)] = a1_2 + T*a1_5;
+	P[PIDX(1,3)] = a1_3 + f3_6*a1_6 + f3_7*a1_7 + f3_8*a1_8 + f3_9*a1_9 + f3_13*a1_13;
+	P[PIDX(1,4)] = a1_4 + f4_6*a1_6 + f4_7*a1_7 + f4_8*a1_8 + f4_9*a1_9 + f4_13*a1_13;
+	P[PIDX(1,5)] = a1_5 + f5_6*a1_6 + f5_7*a1_7 + f5_8*a1_8 + f5_9*a1_9 + f5_13*a1_13;
+	P[PIDX(1,6)] = a1_6 + f6_7*a1_7 + f6_8*a1_8 + f6_9*a1_9 + f6_10*a1_10 + f6_11*a1_11 + f6_12*a1_12;
+	P[PIDX(1,7)] = a1_7 + f7_6*a1_6 + f7_8*a1_8 + f7_9*a1_9 + f7_10*a1_10 + f7_11*a1_11 + f7_12*a1_12;
+	P[PIDX(1,8)] = a1_8 + f8_6*a1_6 + f8_7*a1_7 + f8_9*a1_9 + f8_10*a1_10 + f8_11*a1_11 + f8_12*a1_12;
+	P[PIDX(1,9)] = a1_9 + f9_6*a1_6 + f9_7*a1_7 + f9_8*a1_8 + f9_10*a1_10 + f9_11*a1_11 + f9_12*a1_12;
+	P[PIDX(1,10)] = a1_10;
+	P[PIDX(1,11)] = a1_11;
+	P[PIDX(1,12)] = a1_12;
+	P[PIDX(1,13)] = a1_13;
+	P[PIDX(2,2)] = a2_2 + T*a2_5;
+	P[PIDX(2,3)] = a2_3 + f3_6*a2_6 + f3_7*a2_7 + f3_8*a2_8 + f3_9*a2_9 + f3_13*a2_13;
+	P[PIDX(2,4)] = a2_4 + f4_6*a2_6 + f4_7*a2_7 + f4_8*a2_8 + f4_9*a2_9 + f4_13*a2_13;
+	P[PIDX(2,5)] = a2_5 + f5_6*a2_6 + f5_7*a2_7 + f5_8*a2_8 + f5_9*a2_9 + f5_13*a2_13;
+	P[PIDX(2,6)] = a2_6 + f6_7*a2_7 + f6_8*a2_8 + f6_9*a2_9 + f6_10*a2_10 + f6_11*a2_11 + f6_12*a2_12;
+	P[PIDX(2,7)] = a2_7 + f7_6*a2_6 + f7_8*a2_8 + f7_9*a2_9 + f7_10*a2_10 + f7_11*a2_11 + f7_12*a2_12;
+	P[PIDX(2,8)] = a2_8 + f8_6*a2_6 + f8_7*a2_7 + f8_9*a2_9 + f8_10*a2_10 + f8_11*a2_11 + f8_12*a2_12;
+	P[PIDX(2,9)] = a2_9 + f9_6*a2_6 + f9_7*a2_7 + f9_8*a2_8 + f9_10*a2_10 + f9_11*a2_11 + f9_12*a2_12;
+	P[PIDX(2,10)] = a2_10;
+	P[PIDX(2,11)] = a2_11;
+	P[PIDX(2,12)] = a2_12;
+	P[PIDX(2,13)] = a2_13;
+	P[PIDX(3,3)] = a3_3 + f3_6*a3_6 + f3_7*a3_7 + f3_8*a3_8 + f3_9*a3_9 + f3_13*a3_13 + q3*G[3][3]*G[3][3] + q4*G[3][4]*G[3][4] + q5*G[3][5]*G[3][5];
+	P[PIDX(3,4)] = a3_4 + f4_6*a3_6 + f4_7*a3_7 + f4_8*a3_8 + f4_9*a3_9 + f4_13*a3_13 + q3*G[3][3]*G[4][3] + q4*G[3][4]*G[4][4] + q5*G[3][5]*G[4][5];
+	P[PIDX(3,5)] = a3_5 + f5_6*a3_6 + f5_7*a3_7 + f5_8*a3_8 + f5_9*a3_9 + f5_13*a3_13 + q3*G[3][3]*G[5][3] + q4*G[3][4]*G[5][4] + q5*G[3][5]*G[5][5];
+	P[PIDX(3,6)] = a3_6 + f6_7*a3_7 + f6_8*a3_8 + f6_9*a3_9 + f6_10*a3_10 + f6_11*a3_11 + f6_12*a3_12;
+	P[PIDX(3,7)] = a3_7 + f7_6*a3_6 + f7_8*a3_8 + f7_9*a3_9 + f7_10*a3_10 + f7_11*a3_11 + f7_12*a3_12;
+	P[PIDX(3,8)] = a3_8 + f8_6*a3_6 + f8_7*a3_7 + f8_9*a3_9 + f8_10*a3_10 + f8_11*a3_11 + f8_12*a3_12;
+	P[PIDX(3,9)] = a3_9 + f9_6*a3_6 + f9_7*a3_7 + f9_8*a3_8 + f9_10*a3_10 + f9_11*a3_11 + f9_12*a3_12;
+	P[PIDX(3,10)] = a3_10;
+	P[PIDX(3,11)] = a3_11;
+	P[PIDX(3,12)] = a3_12;
+	P[PIDX(3,13)] = a3_13;
+	P[PIDX(4,4)] = a4_4 + f4_6*a4_6 + f4_7*a4_7 + f4_8*a4_8 + f4_9*a4_9 + f4_13*a4_13 + q3*G[4][3]*G[4][3] + q4*G[4][4]*G[4][4] + q5*G[4][5]*G[4][5];
+	P[PIDX(4,5)] = a4_5 + f5_6*a4_6 + f5_7*a4_7 + f5_8*a4_8 + f5_9*a4_9 + f5_13*a4_13 + q3*G[4][3]*G[5][3] + q4*G[4][4]*G[5][4] + q5*G[4][5]*G[5][5];
+	P[PIDX(4,6)] = a4_6 + f6_7*a4_7 + f6_8*a4_8 + f6_9*a4_9 + f6_10*a4_10 + f6_11*a4_11 + f6_12*a4_12;
+	P[PIDX(4,7)] = a4_7 + f7_6*a4_6 + f7_8*a4_8 + f7_9*a4_9 + f7_10*a4_10 + f7_11*a4_11 + f7_12*a4_12;
+	P[PIDX(4,8)] = a4_8 + f8_6*a4_6 + f8_7*a4_7 + f8_9*a4_9 + f8_10*a4_10 + f8_11*a4_11 + f8_12*a4_12;
+	P[PIDX(4,9)] = a4_9 + f9_6*a4_6 + f9_7*a4_7 + f9_8*a4_8 + f9_10*a4_10 + f9_11*a4_11 + f9_12*a4_12;
+	P[PIDX(4,10)] = a4_10;
+	P[PIDX(4,11)] = a4_11;
+	P[PIDX(4,12)] = a4_12;
+	P[PIDX(4,13)] = a4_13;
+	P[PIDX(5,5)] = a5_5 + f5_6*a5_6 + f5_7*a5_7 + f5_8*a5_8 + f5_9*a5_9 + f5_13*a5_13 + q3*G[5][3]*G[5][3] + q4*G[5][4]*G[5][4] + q5*G[5][5]*G[5][5];
+	P[PIDX(5,6)] = a5_6 + f6_7*a5_7 + f6_8*a5_8 + f6_9*a5_9 + f6_10*a5_10 + f6_11*a5_11 + f6_12*a5_12;
+	P[PIDX(5,7)] = a5_7 + f7_6*a5_6 + f7_8*a5_8 + f7_9*a5_9 + f7_10*a5_10 + f7_11*a5_11 + f7_12*a5_12;
+	P[PIDX(5,8)] = a5_8 + f8_6*a5_6 + f8_7*a5_7 + f8_9*a5_9 + f8_10*a5_10 + f8_11*a5_11 + f8_12*a5_12;
+	P[PIDX(5,9)] = a5_9 + f9_6*a5_6 + f9_7*a5_7 + f9_8*a5_8 + f9_10*a5_10 + f9_11*a5_11 + f9_12*a5_12;
+	P[PIDX(5,10)] = a5_10;
+	P[PIDX(5,11)] = a5_11;
+	P[PIDX(5,12)] = a5_12;
+	P[PIDX(5,13)] = a5_13;
+	P[PIDX(6,6)] = a6_6 + f6_7*a6_7 + f6_8*a6_8 + f6_9*a6_9 + f6_10*a6_10 + f6_11*a6_11 + f6_12*a6_12 + q0*G[6][0]*G[6][0] + q1*G[6][1]*G[6][1] + q2*G[6][2]*G[6][2];
+	P[PIDX(6,7)] = a6_7 + f7_6*a6_6 + f7_8*a6_8 + f7_9*a6_9 + f7_10*a6_10 + f7_11*a6_11 + f7_12*a6_12 + q0*G[6][0]*G[7][0] + q1*G[6][1]*G[7][1] + q2*G[6][2]*G[7][2];
+	P[PIDX(6,8)] = a6_8 + f8_6*a6_6 + f8_7*a6_7 + f8_9*a6_9 + f8_10*a6_10 + f8_11*a6_11 + f8_12*a6_12 + q0*G[6][0]*G[8][0] + q1*G[6][1]*G[8][1] + q2*G[6][2]*G[8][2];
+	P[PIDX(6,9)] = a6_9 + f9_6*a6_6 + f9_7*a6_7 + f9_8*a6_8 + f9_10*a6_10 + f9_11*a6_11 + f9_12*a6_12 + q0*G[6][0]*G[9][0] + q1*G[6][1]*G[9][1] + q2*G[6][2]*G[9][2];
+	P[PIDX(6,10)] = a6_10;
+	P[PIDX(6,11)] = a6_11;
+	P[PIDX(6,12)] = a6_12;
+	P[PIDX(6,13)] = a6_13;
+	P[PIDX(7,7)] = a7_7 + f7_6*a7_6 + f7_8*a7_8 + f7_9*a7_9 + f7_10*a7_10 + f7_11*a7_11 + f7_12*a7_12 + q0*G[7][0]*G[7][0] + q1*G[7][1]*G[7][1] + q2*G[7][2]*G[7][2];
+	P[PIDX(7,8)] = a7_8 + f8_6*a7_6 + f8_7*a7_7 + f8_9*a7_9 + f8_10*a7_10 + f8_11*a7_11 + f8_12*a7_12 + q0*G[7][0]*G[8][0] + q1*G[7][1]*G[8][1] + q2*G[7][2]*G[8][2];
+	P[PIDX(7,9)] = a7_9 + f9_6*a7_6 + f9_7*a7_7 + f9_8*a7_8 + f9_10*a7_10 + f9_11*a7_11 + f9_12*a7_12 + q0*G[7][0]*G[9][0] + q1*G[7][1]*G[9][1] + q2*G[7][2]*G[9][2];
+	P[PIDX(7,10)] = a7_10;
+	P[PIDX(7,11)] = a7_11;
+	P[PIDX(7,12)] = a7_12;
+	P[PIDX(7,13)] = a7_13;
+	P[PIDX(8,8)] = a8_8 + f8_6*a8_6 + f8_7*a8_7 + f8_9*a8_9 + f8_10*a8_10 + f8_11*a8_11 + f8_12*a8_12 + q0*G[8][0]*G[8][0] + q1*G[8][1]*G[8][1] + q2*G[8][2]*G[8][2];
+	P[PIDX(8,9)] = a8_9 + f9_6*a8_6 + f9_7*a8_7 + f9_8*a8_8 + f9_10*a8_10 + f9_11*a8_11 + f9_12*a8_12 + q0*G[8][0]*G[9][0] + q1*G[8][1]*G[9][1] + q2*G[8][2]*G[9][2];
+	P[PIDX(8,10)] = a8_10;
+	P[PIDX(8,11)] = a8_11;
+	P[PIDX(8,12)] = a8_12;
+	P[PIDX(8,13)] = a8_13;
+	P[PIDX(9,9)] = a9_9 + f9_6*a9_6 + f9_7*a9_7 + f9_8*a9_8 + f9_10*a9_10 + f9_11*a9_11 + f9_12*a9_12 + q0*G[9][0]*G[9][0] + q1*G[9][1]*G[9][1] + q2*G[9][2]*G[9][2];
+	P[PIDX(9,10)] = a9_10;
+	P[PIDX(9,11)] = a9_11;
+	P[PIDX(9,12)] = a9_12;
+	P[PIDX(9,13)] = a9_13;
+	P[PIDX(10,10)] += q6;
+	P[PIDX(11,11)] += q7;
+	P[PIDX(12,12)] += q8;
+	P[PIDX(13,13)] += q9;
+}
+#endif /* COVARIANCE_PREDICTION_GENERAL */
+
+void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
+		  float Y[NUMV], float P[NUMP], float X[NUMX],
+		  uint16_t SensorsUsed)
+{
+	float HP[NUMX], K[NUMX], HPHR, Error;
+	uint8_t i, j, m;
+
+	for (m = 0; m < NUMV; m++) {
+		if (!(SensorsUsed & (0x01 << m)))
+			continue;
+
+		// Find HP = H*P and HPHR = H*P*H' + R
+		switch (m) {
+		case 0:
+			HP[0] = P[PIDX(0,0)];
+			HP[1] = P[PIDX(0,1)];
+			HP[2] = P[PIDX(0,2)];
+			HP[3] = P[PIDX(0,3)];
+			HP[4] = P[PIDX(0,4)];
+			HP[5] = P[PIDX(0,5)];
+			HP[6] = P[PIDX(0,6)];
+			HP[7] = P[PIDX(0,7)];
+			HP[8] = P[PIDX(0,8)];
+			HP[9] = P[PIDX(0,9)];
+			HP[10] = P[PIDX(0,10)];
+			HP[11] = P[PIDX(0,11)];
+			HP[12] = P[PIDX(0,12)];
+			HP[13] = P[PIDX(0,13)];
+			HPHR = R[0] + HP[0];
+			break;
+		case 1:
+			HP[0] = P[PIDX(0,1)];
+			HP[1] = P[PIDX(1,1)];
+			HP[2] = P[PIDX(1,2)];
+			HP[3] = P[PIDX(1,3)];
+			HP[4] = P[PIDX(1,4)];
+			HP[5] = P[PIDX(1,5)];
+			HP[6] = P[PIDX(1,6)];
+			HP[7] = P[PIDX(1,7)];
+			HP[8] = P[PIDX(1,8)];
+			HP[9] = P[PIDX(1,9)];
+			HP[10] = P[PIDX(1,10)];
+			HP[11] = P[PIDX(1,11)];
+			HP[12] = P[PIDX(1,12)];
+			HP[13] = P[PIDX(1,13)];
+			HPHR = R[1] + HP[1];
+			break;
+		case 2:
+			HP[0] = P[PIDX(0,2)];
+			HP[1] = P[PIDX(1,2)];
+			HP[2] = P[PIDX(2,2)];
+			HP[3] = P[PIDX(2,3)];
+			HP[4] = P[PIDX(2,4)];
+			HP[5] = P[PIDX(2,5)];
+			HP[6] = P[PIDX(2,6)];
+			HP[7] = P[PIDX(2,7)];
+			HP[8] = P[PIDX(2,8)];
+			HP[9] = P[PIDX(2,9)];
+			HP[10] = P[PIDX(2,10)];
+			HP[11] = P[PIDX(2,11)];
+			HP[12] = P[PIDX(2,12)];
+			HP[13] = P[PIDX(2,13)];
+			HPHR = R[2] + HP[2];
+			break;
+		case 3:
+			HP[0] = P[PIDX(0,3)];
+			HP[1] = P[PIDX(1,3)];
+			HP[2] = P[PIDX(2,3)];
+			HP[3] = P[PIDX(3,3)];
+			HP[4] = P[PIDX(3,4)];
+			HP[5] = P[PIDX(3,5)];
+			HP[6] = P[PIDX(3,6)];
+			HP[7] = P[PIDX(3,7)];
+			HP[8] = P[PIDX(3,8)];
+			HP[9] = P[PIDX(3,9)];
+			HP[10] = P[PIDX(3,10)];
+			HP[11] = P[PIDX(3,11)];
+			HP[12] = P[PIDX(3,12)];
+			HP[13] = P[PIDX(3,13)];
+			HPHR = R[3] + HP[3];
+			break;
+		case 4:
+			HP[0] = P[PIDX(0,4)];
+			HP[1] = P[PIDX(1,4)];
+			HP[2] = P[PIDX(2,4)];
+			HP[3] = P[PIDX(3,4)];
+			HP[4] = P[PIDX(4,4)];
+			HP[5] = P[PIDX(4,5)];
+			HP[6] = P[PIDX(4,6)];
+			HP[7] = P[PIDX(4,7)];
+			HP[8] = P[PIDX(4,8)];
+			HP[9] = P[PIDX(4,9)];
+			HP[10] = P[PIDX(4,10)];
+			HP[11] = P[PIDX(4,11)];
+			HP[12] = P[PIDX(4,12)];
+			HP[13] = P[PIDX(4,13)];
+			HPHR = R[4] + HP[4];
+			break;
+		case 5:
+			HP[0] = P[PIDX(0,5)];
+			HP[1] = P[PIDX(1,5)];
+			HP[2] = P[PIDX(2,5)];
+			HP[3] = P[PIDX(3,5)];
+			HP[4] = P[PIDX(4,5)];
+			HP[5] = P[PIDX(5,5)];
+			HP[6] = P[PIDX(5,6)];
+			HP[7] = P[PIDX(5,7)];
+			HP[8] = P[PIDX(5,8)];
+			HP[9] = P[PIDX(5,9)];
+			HP[10] = P[PIDX(5,10)];
+			HP[11] = P[PIDX(5,11)];
+			HP[12] = P[PIDX(5,12)];
+			HP[13] = P[PIDX(5,13)];
+			HPHR = R[5] + HP[5];
+			break;
+		case 6:
+			HP[0] = H[6][6]*P[PIDX(0,6)] + H[6][7]*P[PIDX(0,7)] + H[6][8]*P[PIDX(0,8)] + H[6][9]*P[PIDX(0,9)];
+			HP[1] = H[6][6]*P[PIDX(1,6)] + H[6][7]*P[PIDX(1,7)] + H[6][8]*P[PIDX(1,8)] + H[6][9]*P[PIDX(1,9)];
+			HP[2] = H[6][6]*P[PIDX(2,6)] + H[6][7]*P[PIDX(2,7)] + H[6][8]*P[PIDX(2,8)] + H[6][9]*P[PIDX(2,9)];
+			HP[3] = H[6][6]*P[PIDX(3,6)] + H[6][7]*P[PIDX(3,7)] + H[6][8]*P[PIDX(3,8)] + H[6][9]*P[PIDX(3,9)];
+			HP[4] = H[6][6]*P[PIDX(4,6)] + H[6][7]*P[PIDX(4,7)] + H[6][8]*P[PIDX(4,8)] + H[6][9]*P[PIDX(4,9)];
+			HP[5] = H[6][6]*P[PIDX(5,6)] + H[6][7]*P[PIDX(5,7)] + H[6][8]*P[PIDX(5,8)] + H[6][9]*P[PIDX(5,9)];
+			HP[6] = H[6][6]*P[PIDX(6,6)] + H[6][7]*P[PIDX(6,7)] + H[6][8]*P[PIDX(6,8)] + H[6][9]*P[PIDX(6,9)];
+			HP[7] = H[6][6]*P[PIDX(6,7)] + H[6][7]*P[PIDX(7,7)] + H[6][8]*P[PIDX(7,8)] + H[6][9]*P[PIDX(7,9)];
+			HP[8] = H[6][6]*P[PIDX(6,8)] + H[6][7]*P[PIDX(7,8)] + H[6][8]*P[PIDX(8,8)] + H[6][9]*P[PIDX(8,9)];
+			HP[9] = H[6][6]*P[PIDX(6,9)] + H[6][7]*P[PIDX(7,9)] + H[6][8]*P[PIDX(8,9)] + H[6][9]*P[PIDX(9,9)];
+			HP[10] = H[6][6]*P[PIDX(6,10)] + H[6][7]*P[PIDX(7,10)] + H[6][8]*P[PIDX(8,10)] + H[6][9]*P[PIDX(9,10)];
+			HP[11] = H[6][6]*P[PIDX(6,11)] + H[6][7]*P[PIDX(7,11)] + H[6][8]*P[PIDX(8,11)] + H[6][9]*P[PIDX(9,11)];
+			HP[12] = H[6][6]*P[PIDX(6,12)] + H[6][7]*P[PIDX(7,12)] + H[6][8]*P[PIDX(8,12)] + H[6][9]*P[PIDX(9,12)];
+			HP[13] = H[6][6]*P[PIDX(6,13)] + H[6][7]*P[PIDX(7,13)] + H[6][8]*P[PIDX(8,13)] + H[6][9]*P[PIDX(9,13)];
+			HPHR = R[6] + H[6][6]*HP[6] + H[6][7]*HP[7] + H[6][8]*HP[8] + H[6][9]*HP[9];
+			break;
+		case 7:
+			HP[0] = H[7][6]*P[PIDX(0,6)] + H[7][7]*P[PIDX(0,7)] + H[7][8]*P[PIDX(0,8)] + H[7][9]*P[PIDX(0,9)];
+			HP[1] = H[7][6]*P[PIDX(1,6)] + H[7][7]*P[PIDX(1,7)] + H[7][8]*P[PIDX(1,8)] + H[7][9]*P[PIDX(1,9)];
+			HP[2] = H[7][6]*P[PIDX(2,6)] + H[7][7]*P[PIDX(2,7)] + H[7][8]*P[PIDX(2,8)] + H[7][9]*P[PIDX(2,9)];
+			HP[3] = H[7][6]*P[PIDX(3,6)] + H[7][7]*P[PIDX(3,7)] + H[7][8]*P[PIDX(3,8)] + H[7][9]*P[PIDX(3,9)];
+			HP[4] = H[7][6]*P[PIDX(4,6)] + H[7][7]*P[PIDX(4,7)] + H[7][8]*P[PIDX(4,8)] + H[7][9]*P[PIDX(4,9)];
+			HP[5] = H[7][6]*P[PIDX(5,6)] + H[7][7]*P[PIDX(5,7)] + H[7][8]*P[PIDX(5,8)] + H[7][9]*P[PIDX(5,9)];
+			HP[6] = H[7][6]*P[PIDX(6,6)] + H[7][7]*P[PIDX(6,7)] + H[7][8]*P[PIDX(6,8)] + H[7][9]*P[PIDX(6,9)];
+			HP[7] = H[7][6]*P[PIDX(6,7)] + H[7][7]*P[PIDX(7,7)] + H[7][8]*P[PIDX(7,8)] + H[7][9]*P[PIDX(7,9)];
+			HP[8] = H[7][6]*P[PIDX(6,8)] + H[7][7]*P[PIDX(7,8)] + H[7][8]*P[PIDX(8,8)] + H[7][9]*P[PIDX(8,9)];
+			HP[9] = H[7][6]*P[PIDX(6,9)] + H[7][7]*P[PIDX(7,9)] + H[7][8]*P[PIDX(8,9)] + H[7][9]*P[PIDX(9,9)];
+			HP[10] = H[7][6]*P[PIDX(6,10)] + H[7][7]*P[PIDX(7,10)] + H[7][8]*P[PIDX(8,10)] + H[7][9]*P[PIDX(9,10)];
+			HP[11] = H[7][6]*P[PIDX(6,11)] + H[7][7]*P[PIDX(7,11)] + H[7][8]*P[PIDX(8,11)] + H[7][9]*P[PIDX(9,11)];
+			HP[12] = H[7][6]*P[PIDX(6,12)] + H[7][7]*P[PIDX(7,12)] + H[7][8]*P[PIDX(8,12)] + H[7][9]*P[PIDX(9,12)];
+			HP[13] = H[7][6]*P[PIDX(6,13)] + H[7][7]*P[PIDX(7,13)] + H[7][8]*P[PIDX(8,13)] + H[7][9]*P[PIDX(9,13)];
+			HPHR = R[7] + H[7][6]*HP[6] + H[7][7]*HP[7] + H[7][8]*HP[8] + H[7][9]*HP[9];
+			break;
+		case 8:
+			// H row is zero so K is zero and nothing changes
+			continue;
+		case 9:
+			HP[0] = -P[PIDX(0,2)];
+			HP[1] = -P[PIDX(1,2)];
+			HP[2] = -P[PIDX(2,2)];
+			HP[3] = -P[PIDX(2,3)];
+			HP[4] = -P[PIDX(2,4)];
+			HP[5] = -P[PIDX(2,5)];
+			HP[6] = -P[PIDX(2,6)];
+			HP[7] = -P[PIDX(2,7)];
+			HP[8] = -P[PIDX(2,8)];
+			HP[9] = -P[PIDX(2,9)];
+			HP[10] = -P[PIDX(2,10)];
+			HP[11] = -P[PIDX(2,11)];
+			HP[12] = -P[PIDX(2,12)];
+			HP[13] = -P[PIDX(2,13)];
+			HPHR = R[9] - HP[2];
+			break;
+		default:
+			continue;
+		}
+
+		for (i = 0; i < NUMX; i++)
+			K[i] = HP[i] / HPHR;	// find K = HP/HPHR
+
+		float *p = P;
+		for (i = 0; i < NUMX; i++) {	// Find P(m)= P(m-1) - K*HP
+			for (j = i; j < NUMX; j++)
+				*p++ -= K[i] * HP[j];
+		}
+
+		Error = Z[m] - Y[m];
+		for (i = 0; i < NUMX; i++)	// Find X(m)= X(m-1) + K*Error
+			X[i] += K[i] * Error;
+	}
+
+	INSLimitBias();
+}
+
+#endif /* INSGPS14STATE_KERNEL_H */
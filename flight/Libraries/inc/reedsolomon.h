@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file       reedsolomon.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief Reentrant Reed-Solomon codec over GF(256)
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#ifndef REEDSOLOMON_H
+#define REEDSOLOMON_H
+
+#include <stdint.h>
+
+//! Largest number of parity bytes a code can have
+#define RS_MAX_PARITY 16
+
+//! Longest codeword, data plus parity
+#define RS_MAX_CODEWORD 255
+
+/**
+ * A Reed-Solomon code with a given number of parity bytes.  It holds no
+ * state once rs_init has set it up, so one code can be shared between any
+ * number of links and used from several threads at once.
+ *
+ * Codewords are the same as those of the rscode library: generator roots
+ * alpha^1 to alpha^nparity in GF(2^8) with polynomial 0x11d, and the parity
+ * bytes appended after the data.
+ */
+struct rs_code {
+	uint8_t nparity;
+	uint8_t gen_log[RS_MAX_PARITY];	// log of the generator coefficients, lowest first
+};
+
+void rs_init(struct rs_code *rs, uint8_t nparity);
+void rs_encode(const struct rs_code *rs, const uint8_t *msg, uint16_t len, uint8_t *dst);
+int rs_decode(const struct rs_code *rs, uint8_t *codeword, uint16_t len);
+
+#endif /* REEDSOLOMON_H */
@@ -0,0 +1,372 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Filtering support libraries
+ * @{
+ *
+ * @file       dynnotch.c
+ * @author     dRonin, http://dronin.org, Copyright (C) 2017
+ * @brief      Notch filters that track the strongest peaks of the spectrum
+ *
+ * The input is decimated with a boxcar average and run through a sliding
+ * DFT, updating only the bins between the minimum and maximum frequency
+ * plus one on either side.  Each decimated sample one axis' bins are Hann
+ * windowed, their power averaged over time and searched for the strongest
+ * peaks, which are interpolated between bins and followed by the notches
+ * with a first order tracking filter.  The notches are direct form I
+ * biquads, so moving the center frequency a little at a time doesn't upset
+ * their state.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "pios.h"
+#include "misc_math.h"
+#include "dynnotch.h"
+
+// Sliding DFT length, in decimated samples
+#define SDFT_N			64
+#define SDFT_MAX_BINS		(SDFT_N / 2)
+
+// Pole radius of the sliding DFT, keeps rounding errors from accumulating
+#define SDFT_R			0.9995f
+
+// Decimated rate is at least this many times the maximum frequency
+#define DECIMATED_MARGIN	2.5f
+
+// Weight of each new spectrum in the averaged power
+#define POWER_ALPHA		0.05f
+
+// A peak must have this many times the mean power of the band
+#define PEAK_MIN_RATIO		4.0f
+
+// Fraction of the distance to the measured peak moved each update
+#define TRACKING_GAIN		0.1f
+
+struct dynnotch_biquad {
+	// b2 equals b0 and a1 equals b1 for a notch
+	float b0, b1, a2;
+	float x1, x2, y1, y2;
+};
+
+struct dynnotch_axis {
+	float window[SDFT_N];
+	float re[SDFT_MAX_BINS];
+	float im[SDFT_MAX_BINS];
+	float power[SDFT_MAX_BINS];
+	float decimated_sum;
+
+	float freq[DYNNOTCH_MAX_NOTCHES];	// 0 until locked on
+	float ratio;
+	struct dynnotch_biquad notch[DYNNOTCH_MAX_NOTCHES];
+};
+
+struct dynnotch_state {
+	float dT;
+	float q;
+	float min_hz;
+	float max_hz;
+	float bin_hz;
+	float r_n;
+
+	uint8_t notches;
+	uint8_t decimation;
+	uint8_t decimation_count;
+	uint8_t window_pos;
+	uint8_t bin_lo;		// lowest bin computed, one below the band
+	uint8_t nbins;		// bins computed, including one each side
+	uint8_t next_axis;
+
+	float tw_re[SDFT_MAX_BINS];
+	float tw_im[SDFT_MAX_BINS];
+
+	struct dynnotch_axis axis[DYNNOTCH_AXES];
+};
+
+/**
+ * Configure the filter.  Allocates it the first time it is enabled, after
+ * that the same memory is reused and tracking starts over.
+ * @param[in,out] filter_ptr the filter
+ * @param[in] min_hz lowest frequency to track
+ * @param[in] max_hz highest frequency to track
+ * @param[in] q quality factor of the notches
+ * @param[in] notches notches per axis, 0 bypasses the filter
+ * @param[in] dT sample period
+ */
+void dynnotch_create(dynnotch_state_t *filter_ptr, float min_hz, float max_hz, float q, uint8_t notches, float dT)
+{
+	PIOS_Assert(filter_ptr);
+
+	if (!notches) {
+		// Don't use any memory unless it is wanted
+		if (*filter_ptr)
+			(*filter_ptr)->notches = 0;
+		return;
+	}
+
+	if (!*filter_ptr) {
+		*filter_ptr = PIOS_malloc_no_dma(sizeof(struct dynnotch_state));
+		if (!*filter_ptr)
+			PIOS_Assert(0);
+	}
+
+	dynnotch_state_t filter = *filter_ptr;
+
+	memset(filter, 0, sizeof(struct dynnotch_state));
+
+	float fs = 1.0f / dT;
+	int decimation = (int) (fs / (DECIMATED_MARGIN * max_hz));
+	decimation = MAX(decimation, 1);
+	decimation = MIN(decimation, 255);
+
+	filter->dT = dT;
+	filter->q = MAX(q, 0.5f);
+	filter->min_hz = min_hz;
+	filter->max_hz = MIN(max_hz, 0.45f * fs);
+	filter->decimation = decimation;
+	filter->bin_hz = fs / decimation / SDFT_N;
+	filter->r_n = powf(SDFT_R, SDFT_N);
+
+	int bin_lo = MAX((int) (filter->min_hz / filter->bin_hz), 1);
+	int bin_hi = MIN((int) ceilf(filter->max_hz / filter->bin_hz), SDFT_MAX_BINS - 2);
+
+	if (bin_hi - bin_lo < 2) {
+		// Too narrow to find a peak in; leave it bypassed
+		return;
+	}
+
+	// The window needs the bins on either side of the band
+	filter->bin_lo = bin_lo - 1;
+	filter->nbins = bin_hi - bin_lo + 3;
+
+	for (int i = 0; i < filter->nbins; i++) {
+		float w = 2 * (float) M_PI * (filter->bin_lo + i) / SDFT_N;
+		filter->tw_re[i] = SDFT_R * cosf(w);
+		filter->tw_im[i] = SDFT_R * sinf(w);
+	}
+
+	filter->notches = MIN(notches, DYNNOTCH_MAX_NOTCHES);
+}
+
+static void notch_configure(struct dynnotch_biquad *b, float freq, float q, float dT)
+{
+	float w = 2 * (float) M_PI * freq * dT;
+	float alpha = sinf(w) / (2 * q);
+	float b0 = 1 / (1 + alpha);
+
+	b->b0 = b0;
+	b->b1 = -2 * cosf(w) * b0;
+	b->a2 = (1 - alpha) * b0;
+}
+
+static inline float notch_run(struct dynnotch_biquad *b, float x)
+{
+	float y = b->b0 * (x + b->x2) + b->b1 * (b->x1 - b->y1) - b->a2 * b->y2;
+
+	b->x2 = b->x1;
+	b->x1 = x;
+	b->y2 = b->y1;
+	b->y1 = y;
+
+	return y;
+}
+
+/**
+ * Interpolated frequency of the peak at bin k.  For a Hann window the offset
+ * from the bin is exactly 2 (c - a) / (a + 2 b + c) from the magnitudes.
+ */
+static float peak_frequency(dynnotch_state_t filter, const float *power, int k)
+{
+	float a = sqrtf(power[k - 1]);
+	float b = sqrtf(power[k]);
+	float c = sqrtf(power[k + 1]);
+	float offset = 2 * (c - a) / (a + 2 * b + c);
+
+	return (filter->bin_lo + k + bound_min_max(offset, -0.5f, 0.5f)) * filter->bin_hz;
+}
+
+//! Look for the peaks of one axis and move its notches toward them
+static void dynnotch_track(dynnotch_state_t filter, struct dynnotch_axis *axis)
+{
+	float *power = axis->power;
+	int last = filter->nbins - 1;
+	float total = 0;
+	float peak = 0;
+	int first = 0;
+
+	// The guard bins are left with no power so peaks can't be at the ends
+	for (int k = 1; k < last; k++) {
+		// Hann window applied in the frequency domain
+		float re = 0.5f * axis->re[k] - 0.25f * (axis->re[k - 1] + axis->re[k + 1]);
+		float im = 0.5f * axis->im[k] - 0.25f * (axis->im[k - 1] + axis->im[k + 1]);
+
+		power[k] += POWER_ALPHA * (re * re + im * im - power[k]);
+		total += power[k];
+
+		if (power[k] > peak) {
+			peak = power[k];
+			first = k;
+		}
+	}
+
+	float threshold = PEAK_MIN_RATIO * total / (last - 1);
+
+	axis->ratio = (total > 0) ? peak * (last - 1) / total : 0;
+
+	if (peak <= threshold)
+		return;
+
+	float found[DYNNOTCH_MAX_NOTCHES];
+	int nfound = 0;
+
+	found[nfound++] = peak_frequency(filter, power, first);
+
+	if (filter->notches > 1) {
+		// The next strongest local maximum clear of the first peak
+		int second = -1;
+
+		for (int k = 1; k < last; k++) {
+			if (abs(k - first) < 2)
+				continue;
+			if (power[k - 1] > power[k] || power[k + 1] > power[k])
+				continue;
+			if (second < 0 || power[k] > power[second])
+				second = k;
+		}
+
+		// Against the floor without the first peak, which would
+		// otherwise hide anything much weaker than itself
+		float rest = total - power[first - 1] - power[first] - power[first + 1];
+
+		threshold = PEAK_MIN_RATIO * rest / MAX(last - 4, 1);
+
+		if (second >= 0 && power[second] > threshold)
+			found[nfound++] = peak_frequency(filter, power, second);
+	}
+
+	// Keep each notch on the peak it was already nearest, so they
+	// don't swap places when the two peaks change order
+	if (nfound == 2 && axis->freq[0] && axis->freq[1] &&
+			fabsf(axis->freq[0] - found[1]) + fabsf(axis->freq[1] - found[0]) <
+			fabsf(axis->freq[0] - found[0]) + fabsf(axis->freq[1] - found[1])) {
+		float tmp = found[0];
+		found[0] = found[1];
+		found[1] = tmp;
+	}
+
+	for (int i = 0; i < nfound; i++) {
+		float f = bound_min_max(found[i], filter->min_hz, filter->max_hz);
+
+		if (axis->freq[i])
+			f = axis->freq[i] + TRACKING_GAIN * (f - axis->freq[i]);
+
+		axis->freq[i] = f;
+		notch_configure(&axis->notch[i], f, filter->q, filter->dT);
+	}
+}
+
+//! Feed one decimated sample per axis into the sliding DFT
+static void dynnotch_estimate(dynnotch_state_t filter)
+{
+	uint8_t pos = filter->window_pos;
+
+	for (int a = 0; a < DYNNOTCH_AXES; a++) {
+		struct dynnotch_axis *axis = &filter->axis[a];
+		float x = axis->decimated_sum;
+		float delta = x - filter->r_n * axis->window[pos];
+
+		axis->window[pos] = x;
+		axis->decimated_sum = 0;
+
+		for (int k = 0; k < filter->nbins; k++) {
+			float re = axis->re[k] + delta;
+			float im = axis->im[k];
+
+			axis->re[k] = re * filter->tw_re[k] - im * filter->tw_im[k];
+			axis->im[k] = re * filter->tw_im[k] + im * filter->tw_re[k];
+		}
+	}
+
+	filter->window_pos = (pos + 1) % SDFT_N;
+
+	// Spread the peak search over the axes
+	dynnotch_track(filter, &filter->axis[filter->next_axis]);
+	filter->next_axis = (filter->next_axis + 1) % DYNNOTCH_AXES;
+}
+
+/**
+ * Filter one sample of each axis in place.
+ * @param[in] filter the filter
+ * @param[in,out] sample DYNNOTCH_AXES values
+ */
+void dynnotch_run(dynnotch_state_t filter, float *sample)
+{
+	if (!filter || !filter->notches)
+		return;
+
+	for (int a = 0; a < DYNNOTCH_AXES; a++)
+		filter->axis[a].decimated_sum += sample[a];
+
+	if (++filter->decimation_count >= filter->decimation) {
+		filter->decimation_count = 0;
+		dynnotch_estimate(filter);
+	}
+
+	for (int a = 0; a < DYNNOTCH_AXES; a++) {
+		struct dynnotch_axis *axis = &filter->axis[a];
+
+		for (int i = 0; i < filter->notches; i++) {
+			if (axis->freq[i])
+				sample[a] = notch_run(&axis->notch[i], sample[a]);
+		}
+	}
+}
+
+/**
+ * Get the frequency a notch is at.
+ * @param[in] filter the filter
+ * @param[in] axis the axis
+ * @param[in] notch which of the notches
+ * @returns the frequency in Hz, or 0 if the notch isn't tracking anything
+ */
+float dynnotch_get_frequency(dynnotch_state_t filter, uint8_t axis, uint8_t notch)
+{
+	if (!filter || notch >= filter->notches || axis >= DYNNOTCH_AXES)
+		return 0;
+
+	return filter->axis[axis].freq[notch];
+}
+
+/**
+ * Get how far the strongest peak stands out.
+ * @param[in] filter the filter
+ * @param[in] axis the axis
+ * @returns ratio of the peak's power to the mean power across the band
+ */
+float dynnotch_get_peak_ratio(dynnotch_state_t filter, uint8_t axis)
+{
+	if (!filter || !filter->notches || axis >= DYNNOTCH_AXES)
+		return 0;
+
+	return filter->axis[axis].ratio;
+}
@@ -0,0 +1,43 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Filtering support libraries
+ * @{
+ *
+ * @file       dynnotch.h
+ * @author     dRonin, http://dronin.org, Copyright (C) 2017
+ * @brief      Notch filters that track the strongest peaks of the spectrum
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef DYNNOTCH_H
+#define DYNNOTCH_H
+
+#define DYNNOTCH_AXES 3
+#define DYNNOTCH_MAX_NOTCHES 2
+
+typedef struct dynnotch_state* dynnotch_state_t;
+
+void dynnotch_create(dynnotch_state_t *filter_ptr, float min_hz, float max_hz, float q, uint8_t notches, float dT);
+void dynnotch_run(dynnotch_state_t filter, float *sample);
+float dynnotch_get_frequency(dynnotch_state_t filter, uint8_t axis, uint8_t notch);
+float dynnotch_get_peak_ratio(dynnotch_state_t filter, uint8_t axis);
+
+#endif // DYNNOTCH_H
@@ -0,0 +1,359 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Math support libraries
+ * @{
+ *
+ * @file       geofence_eval.c
+ * @author     dRonin, http://dronin.org, Copyright (C) 2017
+ * @brief      Distance to polygon geofence zones with floors and ceilings
+ *
+ * A zone is a polygon of up to GEOFENCE_MAX_VERTICES in the north/east
+ * plane, extruded between a floor and a ceiling.  When a zone is set up
+ * its north extent is cut into GEOFENCE_BANDS bands, each with a mask of
+ * the edges reaching into it.  Inside tests cast a ray east and only look
+ * at the edges of the band the point is in.  The nearest edge is found by
+ * visiting the bands outwards from the point's until the next band is
+ * further north or south than the nearest edge so far.
+ *
+ * Allowed space is inside any inclusion zone, or anywhere when there are
+ * none, and outside every exclusion zone.  The margin is the distance to
+ * the boundary which is nearest to being crossed; where inclusion zones
+ * overlap it may come out a little short, never long.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "misc_math.h"
+#include "geofence_eval.h"
+
+static inline uint8_t next_vertex(const struct geofence_zone *zone, uint8_t i)
+{
+	return (i + 1 < zone->num_vertices) ? i + 1 : 0;
+}
+
+static int band_of(const struct geofence_zone *zone, float north)
+{
+	float band = (north - zone->min_north) / zone->band_size;
+
+	if (!(band > 0))
+		return 0;
+
+	if (band >= GEOFENCE_BANDS)
+		return GEOFENCE_BANDS - 1;
+
+	return (int) band;
+}
+
+/**
+ * Set up a zone and its band index.
+ * @param[out] zone the zone
+ * @param[in] exclusion true to keep out of the zone, false to stay in it
+ * @param[in] north the vertices, m from home
+ * @param[in] east the vertices, m from home
+ * @param[in] num_vertices number of vertices, 3 to GEOFENCE_MAX_VERTICES
+ * @param[in] floor lowest altitude of the zone, m above home
+ * @param[in] ceiling highest altitude of the zone, m above home
+ * @returns 0 on success, -1 if the zone is degenerate
+ */
+int32_t geofence_zone_init(struct geofence_zone *zone, bool exclusion,
+		const float *north, const float *east, uint8_t num_vertices,
+		float floor, float ceiling)
+{
+	if (num_vertices < 3 || num_vertices > GEOFENCE_MAX_VERTICES)
+		return -1;
+
+	if (!(floor < ceiling))
+		return -1;
+
+	memset(zone, 0, sizeof(*zone));
+
+	zone->exclusion = exclusion;
+	zone->num_vertices = num_vertices;
+	zone->floor = floor;
+	zone->ceiling = ceiling;
+
+	memcpy(zone->north, north, num_vertices * sizeof(*north));
+	memcpy(zone->east, east, num_vertices * sizeof(*east));
+
+	zone->min_north = north[0];
+	zone->max_north = north[0];
+
+	for (int i = 1; i < num_vertices; i++) {
+		if (north[i] < zone->min_north)
+			zone->min_north = north[i];
+		if (north[i] > zone->max_north)
+			zone->max_north = north[i];
+	}
+
+	zone->band_size = (zone->max_north - zone->min_north) / GEOFENCE_BANDS;
+
+	// Also rejects NaN and infinite vertices
+	if (!(zone->band_size > 0) || isinf(zone->band_size))
+		return -1;
+
+	for (uint8_t i = 0; i < num_vertices; i++) {
+		uint8_t j = next_vertex(zone, i);
+
+		int first = band_of(zone, MIN(north[i], north[j]));
+		int last = band_of(zone, MAX(north[i], north[j]));
+
+		for (int b = first; b <= last; b++)
+			zone->band_edges[b] |= 1 << i;
+	}
+
+	return 0;
+}
+
+/**
+ * Check whether a point is inside the polygon of a zone, ignoring altitude.
+ * @param[in] zone the zone
+ * @param[in] north the point, m from home
+ * @param[in] east the point, m from home
+ * @returns true if inside
+ */
+bool geofence_zone_contains(const struct geofence_zone *zone, float north, float east)
+{
+	if (!(north >= zone->min_north && north <= zone->max_north))
+		return false;
+
+	uint16_t edges = zone->band_edges[band_of(zone, north)];
+	bool inside = false;
+
+	for (uint8_t i = 0; edges; i++, edges >>= 1) {
+		if (!(edges & 1))
+			continue;
+
+		uint8_t j = next_vertex(zone, i);
+
+		if ((zone->north[i] > north) == (zone->north[j] > north))
+			continue;
+
+		float crossing = zone->east[i] + (north - zone->north[i]) *
+			(zone->east[j] - zone->east[i]) / (zone->north[j] - zone->north[i]);
+
+		if (east < crossing)
+			inside = !inside;
+	}
+
+	return inside;
+}
+
+/* Squared distance from a point to edge i, and the nearest point on it */
+static float edge_distance2(const struct geofence_zone *zone, uint8_t i,
+		float north, float east, float *near_north, float *near_east)
+{
+	uint8_t j = next_vertex(zone, i);
+
+	float dn = zone->north[j] - zone->north[i];
+	float de = zone->east[j] - zone->east[i];
+	float len2 = dn * dn + de * de;
+	float t = 0;
+
+	if (len2 > 0)
+		t = bound_min_max(((north - zone->north[i]) * dn +
+				(east - zone->east[i]) * de) / len2, 0, 1);
+
+	*near_north = zone->north[i] + t * dn;
+	*near_east = zone->east[i] + t * de;
+
+	return powf(north - *near_north, 2) + powf(east - *near_east, 2);
+}
+
+/* Distance from a point to the nearest edge of a zone */
+static float boundary_distance(const struct geofence_zone *zone,
+		float north, float east, float *near_north, float *near_east)
+{
+	int home_band = band_of(zone, north);
+	uint16_t visited = 0;
+	float best2 = INFINITY;
+
+	for (int k = 0; k < GEOFENCE_BANDS; k++) {
+		bool closer = false;
+
+		for (int b = home_band - k; b <= home_band + k; b += 2 * k) {
+			if (b >= 0 && b < GEOFENCE_BANDS) {
+				float low = zone->min_north + b * zone->band_size;
+				float gap = 0;
+
+				if (north < low)
+					gap = low - north;
+				else if (north > low + zone->band_size)
+					gap = north - low - zone->band_size;
+
+				if (gap * gap < best2) {
+					closer = true;
+
+					uint16_t edges = zone->band_edges[b] & ~visited;
+					visited |= edges;
+
+					for (uint8_t i = 0; edges; i++, edges >>= 1) {
+						if (!(edges & 1))
+							continue;
+
+						float n, e;
+						float d2 = edge_distance2(zone, i, north, east, &n, &e);
+
+						if (d2 < best2) {
+							best2 = d2;
+							*near_north = n;
+							*near_east = e;
+						}
+					}
+				}
+			}
+
+			if (k == 0)
+				break;
+		}
+
+		// Bands further out are further away still
+		if (!closer)
+			break;
+	}
+
+	return sqrtf(best2);
+}
+
+/**
+ * Signed distance from a point to the boundary of a zone.
+ * @param[in] zone the zone
+ * @param[in] ned the point, m north, east and down from home
+ * @param[out] gradient unit vector (NED) in which the distance grows fastest
+ * @returns the distance in m, positive inside the zone and negative outside
+ */
+float geofence_zone_distance(const struct geofence_zone *zone, const float *ned, float *gradient)
+{
+	float near_north = ned[0], near_east = ned[1];
+	float d = boundary_distance(zone, ned[0], ned[1], &near_north, &near_east);
+	bool inside = geofence_zone_contains(zone, ned[0], ned[1]);
+
+	// Horizontal part, and its gradient
+	float h = inside ? d : -d;
+	float h_north = 0, h_east = 0;
+
+	if (d > 0) {
+		h_north = (ned[0] - near_north) / h;
+		h_east = (ned[1] - near_east) / h;
+	}
+
+	// Vertical part to the nearer of floor and ceiling, and its gradient
+	float altitude = -ned[2];
+	float v, v_down;
+
+	if (altitude - zone->floor < zone->ceiling - altitude) {
+		v = altitude - zone->floor;
+		v_down = -1;
+	} else {
+		v = zone->ceiling - altitude;
+		v_down = 1;
+	}
+
+	if (h >= 0 && v >= 0) {
+		if (h < v) {
+			gradient[0] = h_north;
+			gradient[1] = h_east;
+			gradient[2] = 0;
+			return h;
+		}
+
+		gradient[0] = 0;
+		gradient[1] = 0;
+		gradient[2] = v_down;
+		return v;
+	}
+
+	// Outside: straight line distance to the nearest point of the zone
+	float out_h = MAX(-h, 0);
+	float out_v = MAX(-v, 0);
+	float r = sqrtf(out_h * out_h + out_v * out_v);
+
+	gradient[0] = out_h * h_north / r;
+	gradient[1] = out_h * h_east / r;
+	gradient[2] = out_v * v_down / r;
+
+	return -r;
+}
+
+/**
+ * Find how far the aircraft is from breaching the zones, and how soon it
+ * will at its current velocity.
+ * @param[in] zones the zones
+ * @param[in] num_zones number of zones
+ * @param[in] ned position, m north, east and down from home
+ * @param[in] velocity m/s north, east and down
+ * @param[out] result the margin and time to breach
+ */
+void geofence_evaluate(const struct geofence_zone *zones, uint8_t num_zones,
+		const float *ned, const float *velocity, struct geofence_result *result)
+{
+	float margin = INFINITY;
+	float gradient[3] = { 0, 0, 0 };
+	int8_t zone = -1;
+
+	float inclusion = -INFINITY;
+	float inclusion_gradient[3] = { 0, 0, 0 };
+	int8_t inclusion_zone = -1;
+
+	for (uint8_t i = 0; i < num_zones; i++) {
+		float g[3];
+		float s = geofence_zone_distance(&zones[i], ned, g);
+
+		if (zones[i].exclusion) {
+			if (-s < margin) {
+				margin = -s;
+				gradient[0] = -g[0];
+				gradient[1] = -g[1];
+				gradient[2] = -g[2];
+				zone = i;
+			}
+		} else if (s > inclusion) {
+			inclusion = s;
+			memcpy(inclusion_gradient, g, sizeof(g));
+			inclusion_zone = i;
+		}
+	}
+
+	if (inclusion_zone >= 0 && inclusion < margin) {
+		margin = inclusion;
+		memcpy(gradient, inclusion_gradient, sizeof(gradient));
+		zone = inclusion_zone;
+	}
+
+	result->margin = margin;
+	result->zone = zone;
+
+	float closing = -(gradient[0] * velocity[0] + gradient[1] * velocity[1] +
+			gradient[2] * velocity[2]);
+
+	if (margin <= 0)
+		result->time_to_breach = 0;
+	else if (closing > 0)
+		result->time_to_breach = margin / closing;
+	else
+		result->time_to_breach = INFINITY;
+}
+
+/**
+ * @}
+ * @}
+ */
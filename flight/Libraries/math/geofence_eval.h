@@ -0,0 +1,77 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Math support libraries
+ * @{
+ *
+ * @file       geofence_eval.h
+ * @author     dRonin, http://dronin.org, Copyright (C) 2017
+ * @brief      Distance to polygon geofence zones with floors and ceilings
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef GEOFENCE_EVAL_H
+#define GEOFENCE_EVAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The edges of a band are kept as a bit mask, so at most 16 vertices
+#define GEOFENCE_MAX_VERTICES 16
+#define GEOFENCE_BANDS 8
+
+//! A polygon in the north/east plane between a floor and a ceiling
+struct geofence_zone {
+	float north[GEOFENCE_MAX_VERTICES];
+	float east[GEOFENCE_MAX_VERTICES];
+	float floor;			// altitude, m
+	float ceiling;
+
+	// The polygon is cut into bands of north; bit i of a band is set if
+	// edge i (from vertex i to the next) reaches into it
+	float min_north;
+	float max_north;
+	float band_size;
+	uint16_t band_edges[GEOFENCE_BANDS];
+
+	uint8_t num_vertices;
+	bool exclusion;
+};
+
+struct geofence_result {
+	float margin;			// m to the nearest breach, negative once breached
+	float time_to_breach;		// s at the current velocity, INFINITY if not closing
+	int8_t zone;			// zone the margin is to, -1 if none
+};
+
+int32_t geofence_zone_init(struct geofence_zone *zone, bool exclusion,
+		const float *north, const float *east, uint8_t num_vertices,
+		float floor, float ceiling);
+bool geofence_zone_contains(const struct geofence_zone *zone, float north, float east);
+float geofence_zone_distance(const struct geofence_zone *zone, const float *ned, float *gradient);
+void geofence_evaluate(const struct geofence_zone *zones, uint8_t num_zones,
+		const float *ned, const float *velocity, struct geofence_result *result);
+
+#endif // GEOFENCE_EVAL_H
+
+/**
+ * @}
+ * @}
+ */
@@ -65,8 +65,11 @@ float pid_apply(struct pid *pid, const float err, float dT)
 		dterm = pid->lastDer +  dT / ( dT + deriv_tau) * ((diff * pid->d / dT) - pid->lastDer);
 		pid->lastDer = dterm;            //   ^ set constant to 1/(2*pi*f_cutoff)
 	}	                                 //   7.9577e-3  means 20 Hz f_cutoff
- 
-	return ((err * pid->p) + pid->iAccumulator + dterm);
+
+	pid->pTerm = err * pid->p;
+	pid->dTerm = dterm;
+
+	return (pid->pTerm + pid->iAccumulator + dterm);
 }
 
 /**
@@ -100,9 +103,12 @@ float pid_apply_antiwindup(struct pid *pid, const float err,
 		dterm = pid->lastDer +  dT / ( dT + deriv_tau) * ((diff * pid->d / dT) - pid->lastDer);
 		pid->lastDer = dterm;            //   ^ set constant to 1/(2*pi*f_cutoff)
 	}	                                 //   7.9577e-3  means 20 Hz f_cutoff
- 
+
+	pid->pTerm = err * pid->p;
+	pid->dTerm = dterm;
+
  	// Compute how much (if at all) the output is saturating
-	float ideal_output = ((err * pid->p) + pid->iAccumulator + dterm);
+	float ideal_output = (pid->pTerm + pid->iAccumulator + dterm);
 	float saturation = 0;
 	if (ideal_output > max_bound) {
 		saturation = max_bound - ideal_output;
@@ -160,8 +166,11 @@ float pid_apply_setpoint(struct pid *pid, struct pid_deadband *deadband, const f
 		dterm = pid->lastDer +  dT / ( dT + deriv_tau) * ((diff * pid->d / dT) - pid->lastDer);
 		pid->lastDer = dterm;            //   ^ set constant to 1/(2*pi*f_cutoff)
 	}	                                 //   7.9577e-3  means 20 Hz f_cutoff
- 
-	return ((err * pid->p) + pid->iAccumulator + dterm);
+
+	pid->pTerm = err * pid->p;
+	pid->dTerm = dterm;
+
+	return (pid->pTerm + pid->iAccumulator + dterm);
 }
 
 /**
@@ -176,6 +185,8 @@ void pid_zero(struct pid *pid)
 	pid->iAccumulator = 0;
 	pid->lastErr = 0;
 	pid->lastDer = 0;
+	pid->pTerm = 0;
+	pid->dTerm = 0;
 }
 
 /**
@@ -47,6 +47,8 @@ struct pid {
 	float iAccumulator;
 	float lastErr;
 	float lastDer;
+	float pTerm;				// P term of the last output
+	float dTerm;				// D term of the last output
 };
 
 //! Methods to use the pid structures
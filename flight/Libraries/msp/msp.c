@@ -131,12 +131,12 @@ static enum msp_state msp_parse_command(struct msp_parser *p, uint8_t b)
 
 static enum msp_state msp_parse_data(struct msp_parser *p, uint8_t b)
 {
-	p->checksum ^= b;
 	p->data_buf[p->data_rcvd++] = b;
 	if (p->data_rcvd < p->data_len)
 		return MSP_STATE_DATA;
-	else
-		return MSP_STATE_CHECKSUM;
+
+	p->checksum = PIOS_CRC_xorBytes(p->checksum, p->data_buf, p->data_len);
+	return MSP_STATE_CHECKSUM;
 }
 
 static enum msp_state msp_parse_checksum(struct msp_parser *p, uint8_t b)
@@ -222,11 +222,13 @@ int32_t msp_process_com(struct msp_parser *parser, struct pios_com_dev *com)
 		return -1;
 
 	int32_t len = 0;
-	uint8_t b;
+	uint8_t buf[16];
+	uint16_t got;
 	/* TODO: fix PIOS_COM to take a pointer */
-	while (PIOS_COM_ReceiveBuffer((uintptr_t)com, &b, 1, 0)) {
-		process_byte(parser, b);
-		len++;
+	while ((got = PIOS_COM_ReceiveBuffer((uintptr_t)com, buf, sizeof(buf), 0)) > 0) {
+		for (unsigned i = 0; i < got; i++)
+			process_byte(parser, buf[i]);
+		len += got;
 	}
 
 	return len;
@@ -244,9 +246,7 @@ int32_t msp_send_com(struct msp_parser *parser, struct pios_com_dev *com, enum m
 	int32_t written = PIOS_COM_SendBuffer((uintptr_t)com, hdr, NELEMENTS(hdr));
 	if (len)
 		written += PIOS_COM_SendBuffer((uintptr_t)com, payload, len);
-	uint8_t checksum = len ^ (uint8_t)msg_id;
-	for (unsigned i = 0; i < len; i++)
-		checksum ^= ((uint8_t *)payload)[i];
+	uint8_t checksum = PIOS_CRC_xorBytes(len ^ (uint8_t)msg_id, payload, len);
 	written += PIOS_COM_SendBuffer((uintptr_t)com, &checksum, 1);
 
 	return written;
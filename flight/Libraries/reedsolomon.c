@@ -0,0 +1,307 @@
+/**
+ ******************************************************************************
+ * @file       reedsolomon.c
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief Reentrant Reed-Solomon codec over GF(256)
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include "reedsolomon.h"
+#include "pios.h"
+
+#include <string.h>
+
+/* Powers of alpha in GF(2^8) with polynomial x^8 + x^4 + x^3 + x^2 + 1.
+ * Repeated so the sum of two logs can index it without a modulo. */
+static const uint8_t rs_exp[512] = {
+	  1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+	 76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+	157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+	 70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+	 95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+	253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+	217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+	129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+	133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+	168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+	230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+	227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+	130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+	 81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+	 18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+	 44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,
+	  2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,  76,
+	152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192, 157,
+	 39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,  70,
+	140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,  95,
+	190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240, 253,
+	231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226, 217,
+	175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206, 129,
+	 31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204, 133,
+	 23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84, 168,
+	 77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115, 230,
+	209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255, 227,
+	219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65, 130,
+	 25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,  81,
+	162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,  18,
+	 36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,  44,
+	 88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,   2,
+};
+
+/* Discrete log, rs_log[0] is not defined and must not be used */
+static const uint8_t rs_log[256] = {
+	  0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+	  4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+	  5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+	 29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+	  6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+	 54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+	 30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+	202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+	  7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+	227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+	 55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+	242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+	 31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+	108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+	203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+	 79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175,
+};
+
+static inline uint8_t rs_mul(uint8_t a, uint8_t b)
+{
+	if (a == 0 || b == 0)
+		return 0;
+
+	return rs_exp[rs_log[a] + rs_log[b]];
+}
+
+static inline uint8_t rs_div(uint8_t a, uint8_t b)
+{
+	if (a == 0)
+		return 0;
+
+	return rs_exp[rs_log[a] + 255 - rs_log[b]];
+}
+
+/**
+ * Set up a code with the given number of parity bytes, which corrects up
+ * to nparity / 2 byte errors in a codeword.
+ */
+void rs_init(struct rs_code *rs, uint8_t nparity)
+{
+	uint8_t gen[RS_MAX_PARITY + 1];
+
+	PIOS_Assert(nparity > 0 && nparity <= RS_MAX_PARITY);
+
+	// Multiply out (x + alpha^i) for i = 1 to nparity
+	memset(gen, 0, sizeof(gen));
+	gen[0] = 1;
+
+	for (int i = 1; i <= nparity; i++) {
+		for (int j = i; j > 0; j--)
+			gen[j] = gen[j - 1] ^ rs_mul(gen[j], rs_exp[i]);
+		gen[0] = rs_mul(gen[0], rs_exp[i]);
+	}
+
+	// The leading coefficient is 1 and none of the others are zero
+	// for any code up to RS_MAX_PARITY
+	rs->nparity = nparity;
+	for (int i = 0; i < nparity; i++) {
+		PIOS_Assert(gen[i]);
+		rs->gen_log[i] = rs_log[gen[i]];
+	}
+}
+
+/**
+ * Encode len bytes of msg into dst, which receives the data followed by
+ * the parity bytes.  msg and dst may be the same buffer.
+ */
+void rs_encode(const struct rs_code *rs, const uint8_t *msg, uint16_t len, uint8_t *dst)
+{
+	const uint8_t n = rs->nparity;
+	uint8_t lfsr[RS_MAX_PARITY];
+
+	PIOS_Assert(len + n <= RS_MAX_CODEWORD);
+
+	memset(lfsr, 0, n);
+
+	for (uint16_t i = 0; i < len; i++) {
+		uint8_t fb = msg[i] ^ lfsr[n - 1];
+
+		dst[i] = msg[i];
+
+		if (fb == 0) {
+			for (int j = n - 1; j > 0; j--)
+				lfsr[j] = lfsr[j - 1];
+			lfsr[0] = 0;
+			continue;
+		}
+
+		// Multiplying by the generator is an add in the log domain
+		uint16_t fb_log = rs_log[fb];
+		for (int j = n - 1; j > 0; j--)
+			lfsr[j] = lfsr[j - 1] ^ rs_exp[fb_log + rs->gen_log[j]];
+		lfsr[0] = rs_exp[fb_log + rs->gen_log[0]];
+	}
+
+	for (int i = 0; i < n; i++)
+		dst[len + i] = lfsr[n - 1 - i];
+}
+
+/**
+ * Check a codeword of len bytes, parity included, and correct it in place.
+ * The codeword is only changed when it can be corrected.
+ * \return 0 if there were no errors
+ * \return the number of bytes corrected
+ * \return -1 if there are more errors than the code can correct
+ */
+int rs_decode(const struct rs_code *rs, uint8_t *codeword, uint16_t len)
+{
+	const uint8_t n = rs->nparity;
+	uint8_t synd[RS_MAX_PARITY];
+	uint8_t nonzero = 0;
+
+	if (len <= n || len > RS_MAX_CODEWORD)
+		return -1;
+
+	// Syndromes are the codeword evaluated at the generator roots
+	memset(synd, 0, n);
+	for (uint16_t i = 0; i < len; i++) {
+		for (int j = 0; j < n; j++) {
+			uint8_t s = synd[j];
+			synd[j] = codeword[i] ^ (s ? rs_exp[rs_log[s] + j + 1] : 0);
+		}
+	}
+
+	for (int j = 0; j < n; j++)
+		nonzero |= synd[j];
+
+	// The common case, a clean packet
+	if (!nonzero)
+		return 0;
+
+	// Berlekamp-Massey for the error locator polynomial lambda
+	uint8_t lambda[RS_MAX_PARITY + 1], prev[RS_MAX_PARITY + 1], tmp[RS_MAX_PARITY + 1];
+	int L = 0, m = 1;
+	uint8_t b = 1;
+
+	memset(lambda, 0, n + 1);
+	memset(prev, 0, n + 1);
+	lambda[0] = prev[0] = 1;
+
+	for (int k = 0; k < n; k++) {
+		uint8_t d = synd[k];
+		for (int i = 1; i <= L; i++)
+			d ^= rs_mul(lambda[i], synd[k - i]);
+
+		if (d == 0) {
+			m++;
+			continue;
+		}
+
+		uint8_t scale = rs_div(d, b);
+
+		if (2 * L <= k) {
+			memcpy(tmp, lambda, n + 1);
+			for (int i = m; i <= n; i++)
+				lambda[i] ^= rs_mul(scale, prev[i - m]);
+			memcpy(prev, tmp, n + 1);
+			L = k + 1 - L;
+			b = d;
+			m = 1;
+		} else {
+			for (int i = m; i <= n; i++)
+				lambda[i] ^= rs_mul(scale, prev[i - m]);
+			m++;
+		}
+	}
+
+	if (2 * L > n)
+		return -1;
+
+	// Error evaluator omega = synd * lambda mod x^n
+	uint8_t omega[RS_MAX_PARITY];
+	for (int k = 0; k < n; k++) {
+		omega[k] = 0;
+		for (int i = 0; i <= L && i <= k; i++)
+			omega[k] ^= rs_mul(lambda[i], synd[k - i]);
+	}
+
+	// Chien search, only over the positions in this codeword.  Position k
+	// counts back from the last byte and is a root when
+	// lambda(alpha^-k) == 0.
+	uint8_t err_pos[RS_MAX_PARITY / 2], err_val[RS_MAX_PARITY / 2];
+	int nerr = 0;
+
+	for (int k = 0; k < len; k++) {
+		uint16_t xinv = (255 - k) % 255;	// log of alpha^-k
+
+		uint8_t sum = lambda[0];
+		uint8_t deriv = 0;
+		uint16_t p = 0;
+		for (int i = 1; i <= L; i++) {
+			p += xinv;
+			if (p >= 255)
+				p -= 255;
+			if (lambda[i]) {
+				uint8_t t = rs_exp[rs_log[lambda[i]] + p];
+				sum ^= t;
+				// The derivative keeps the odd terms, one power lower
+				if (i & 1)
+					deriv ^= t;
+			}
+		}
+
+		if (sum != 0)
+			continue;
+
+		if (nerr == L)
+			return -1;
+
+		// Forney, the magnitude is omega(X^-1) / lambda'(X^-1).  deriv
+		// above is X^-1 * lambda'(X^-1), so omega gets the same factor.
+		uint8_t num = 0;
+		p = xinv;
+		for (int i = 0; i < n; i++) {
+			if (omega[i])
+				num ^= rs_exp[rs_log[omega[i]] + p];
+			p += xinv;
+			if (p >= 255)
+				p -= 255;
+		}
+
+		if (deriv == 0)
+			return -1;
+
+		err_pos[nerr] = len - 1 - k;
+		err_val[nerr] = rs_div(num, deriv);
+		nerr++;
+	}
+
+	// Each root of lambda has to be a position in the codeword
+	if (nerr != L)
+		return -1;
+
+	for (int i = 0; i < nerr; i++)
+		codeword[err_pos[i]] ^= err_val[i];
+
+	return nerr;
+}
@@ -16,6 +16,14 @@
  * are combined based on the values in @ref MixerSettings and then scaled by the
  * values in @ref ActuatorSettings to create the output PWM times.
  *
+ * Normally the actuator task waits for updates of @ref ActuatorDesired.  With
+ * ActuatorSettings.DirectMixing the stabilization loop instead hands its
+ * output straight to actuator_input_ready(), which mixes and updates the
+ * outputs in the calling task.  This saves the queue hop, a task switch and
+ * re-reading the object on every loop.  The actuator task then only watches
+ * for the stabilization loop stalling and sets the failsafe outputs; a mutex
+ * keeps it from writing them in the middle of an update.
+ *
  * @see        The GNU Public License (GPL) Version 3
  *
  *****************************************************************************/
@@ -41,6 +49,8 @@
 #include <math.h>
 
 #include "openpilot.h"
+#include "actuator.h"
+#include "mixer_plan.h"
 #include "actuatorsettings.h"
 #include "systemsettings.h"
 #include "actuatordesired.h"
@@ -51,6 +61,7 @@
 #include "manualcontrolcommand.h"
 #include "pios_thread.h"
 #include "pios_queue.h"
+#include "pios_mutex.h"
 #include "misc_math.h"
 
 // Private constants
@@ -72,6 +83,8 @@
 DONT_BUILD_IF(ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM > PIOS_SERVO_MAX_BANKS, TooManyServoBanks);
 DONT_BUILD_IF(MAX_MIX_ACTUATORS > ACTUATORCOMMAND_CHANNEL_NUMELEM, TooManyMixers);
 DONT_BUILD_IF((MIXERSETTINGS_MIXER1VECTOR_NUMELEM - MIXERSETTINGS_MIXER1VECTOR_ACCESSORY0) < MANUALCONTROLCOMMAND_ACCESSORY_NUMELEM, AccessoryMismatch);
+DONT_BUILD_IF(MAX_MIX_ACTUATORS > MIXER_PLAN_MAX_CHANNELS, MixerPlanTooFewChannels);
+DONT_BUILD_IF(MIXERSETTINGS_MIXER1VECTOR_NUMELEM > MIXER_PLAN_MAX_INPUTS, MixerPlanTooFewInputs);
 
 #define MIXER_SCALE 128
 
@@ -81,6 +94,17 @@ DONT_BUILD_IF((MIXERSETTINGS_MIXER1VECTOR_NUMELEM - MIXERSETTINGS_MIXER1VECTOR_A
 static struct pios_queue *queue;
 static struct pios_thread *taskHandle;
 
+// Direct mixing is selected at boot and stays fixed until the next reboot
+static bool direct_mixing;
+// Set once the outputs have been configured by the actuator task
+static volatile bool actuator_ready;
+// Systime of the last update from the stabilization loop
+static volatile uint32_t last_direct_update;
+// Held while the outputs are written, when more than one task writes them
+static struct pios_mutex *output_lock;
+// When the input for the next queued update was sampled, for the latency
+static volatile uint32_t queued_sample_time;
+
 // used to inform the actuator thread that actuator / mixer settings are updated
 // set true to ensure they're fetched on first run
 static volatile bool flight_status_updated = true;
@@ -92,9 +116,16 @@ static MixerSettingsMixer1TypeOptions types_mixer[MAX_MIX_ACTUATORS];
 
 /* In the mixer, a row consists of values for one output actuator.
  * A column consists of values for scaling one axis's desired command.
+ * Only the used rows and columns are kept, along with the output scaling.
  */
+static struct mixer_plan mixer_plan;
 
-static float motor_mixer[MAX_MIX_ACTUATORS * MIXERSETTINGS_MIXER1VECTOR_NUMELEM];
+/* Desired axis actions, the input column of the mixer.  Not everything is
+ * updated on every loop, so this is kept between them.
+ */
+static float desired_vect[MIXERSETTINGS_MIXER1VECTOR_NUMELEM];
+static uint32_t last_systime;
+static float dT;
 
 /* These are various settings objects used throughout the actuator code */
 static ActuatorSettingsData actuatorSettings;
@@ -108,7 +139,6 @@ static MixerSettingsCurve2SourceOptions curve2_src;
 // Private functions
 static void actuator_task(void* parameters);
 
-static float scale_channel(float value, int idx);
 static void set_failsafe();
 
 static float throt_curve(const float input, const float *curve,
@@ -144,6 +174,10 @@ int32_t ActuatorInitialize()
 	}
 	ActuatorSettingsConnectCallbackCtx(UAVObjCbSetFlag, &actuator_settings_updated);
 
+	uint8_t direct;
+	ActuatorSettingsDirectMixingGet(&direct);
+	direct_mixing = direct == ACTUATORSETTINGS_DIRECTMIXING_TRUE;
+
 	// Register for notification of changes to MixerSettings
 	if (MixerSettingsInitialize()  == -1) {
 		return -1;
@@ -155,8 +189,17 @@ int32_t ActuatorInitialize()
 		return -1;
 	}
 
-	queue = PIOS_Queue_Create(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
-	ActuatorDesiredConnectQueue(queue);
+	// With direct mixing the input is handed over by the stabilization
+	// loop, the object is only kept up to date for everyone else.
+	if (direct_mixing) {
+		output_lock = PIOS_Mutex_Create();
+		if (output_lock == NULL) {
+			return -1;
+		}
+	} else {
+		queue = PIOS_Queue_Create(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
+		ActuatorDesiredConnectQueue(queue);
+	}
 
 	// Primary output of this module
 	if (ActuatorCommandInitialize() == -1) {
@@ -174,7 +217,7 @@ int32_t ActuatorInitialize()
 }
 MODULE_HIPRI_INITCALL(ActuatorInitialize, ActuatorStart);
 
-static float get_curve2_source(ActuatorDesiredData *desired, SystemSettingsAirframeTypeOptions airframe_type, MixerSettingsCurve2SourceOptions source)
+static float get_curve2_source(const ActuatorDesiredData *desired, SystemSettingsAirframeTypeOptions airframe_type, MixerSettingsCurve2SourceOptions source)
 {
 	float tmp;
 
@@ -231,7 +274,7 @@ static float get_curve2_source(ActuatorDesiredData *desired, SystemSettingsAirfr
 	return 0;
 }
 
-static void compute_one_mixer(int mixnum,
+static void compute_one_mixer(float *motor_mixer, int mixnum,
 		int16_t (*vals)[MIXERSETTINGS_MIXER1VECTOR_NUMELEM],
 		MixerSettingsMixer1TypeOptions type)
 {
@@ -253,11 +296,13 @@ static void compute_one_mixer(int mixnum,
 }
 
 /* Here be dragons */
-#define compute_one_token_paste(b) compute_one_mixer(b-1, &mixerSettings.Mixer ## b ## Vector, mixerSettings.Mixer ## b ## Type)
+#define compute_one_token_paste(b) compute_one_mixer(motor_mixer, b-1, &mixerSettings.Mixer ## b ## Vector, mixerSettings.Mixer ## b ## Type)
 
 static void compute_mixer()
 {
 	MixerSettingsData mixerSettings;
+	float motor_mixer[MAX_MIX_ACTUATORS * MIXERSETTINGS_MIXER1VECTOR_NUMELEM];
+	enum mixer_plan_row rows[MAX_MIX_ACTUATORS];
 
 	MixerSettingsGet(&mixerSettings);
 
@@ -291,10 +336,40 @@ static void compute_mixer()
 #if MAX_MIX_ACTUATORS > 9
 	compute_one_token_paste(10);
 #endif
+
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		switch (types_mixer[ct]) {
+		case MIXERSETTINGS_MIXER1TYPE_MOTOR:
+			rows[ct] = MIXER_PLAN_ROW_MOTOR;
+			break;
+		case MIXERSETTINGS_MIXER1TYPE_SERVO:
+			rows[ct] = MIXER_PLAN_ROW_SERVO;
+			break;
+		default:
+			rows[ct] = MIXER_PLAN_ROW_UNUSED;
+			break;
+		}
+	}
+
+	mixer_plan_build(&mixer_plan, motor_mixer, rows, MAX_MIX_ACTUATORS,
+			MIXERSETTINGS_MIXER1VECTOR_NUMELEM);
+}
+
+/**
+ * Set up the conversion of all channels to pulse lengths
+ */
+static void compute_channel_scale()
+{
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		mixer_plan_set_scale(&mixer_plan, ct,
+				actuatorSettings.ChannelMin[ct],
+				actuatorSettings.ChannelNeutral[ct],
+				actuatorSettings.ChannelMax[ct]);
+	}
 }
 
 static void fill_desired_vector(
-		ActuatorDesiredData *desired,
+		const ActuatorDesiredData *desired,
 		float val1, float val2,
 		float (*cmd_vector)[MIXERSETTINGS_MIXER1VECTOR_NUMELEM])
 {
@@ -310,14 +385,26 @@ static void fill_desired_vector(
 }
 
 static void post_process_scale_and_commit(float *motor_vect, float dT,
-		bool armed, bool spin_while_armed, bool stabilize_now)
+		uint32_t sample_time, bool armed, bool spin_while_armed,
+		bool stabilize_now)
 {
 	float min_chan = INFINITY;
 	float max_chan = -INFINITY;
 	float neg_clip = 0;
-	int num_motors = 0;
+	int num_motors = mixer_plan.num_motors;
 	ActuatorCommandData command;
 
+	for (int i = 0; i < num_motors; i++) {
+		int ct = mixer_plan.row_channel[mixer_plan.motor_row[i]];
+
+		min_chan = fminf(min_chan, motor_vect[ct]);
+		max_chan = fmaxf(max_chan, motor_vect[ct]);
+
+		if (motor_vect[ct] < 0.0f) {
+			neg_clip += motor_vect[ct];
+		}
+	}
+
 	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
 		switch (types_mixer[ct]) {
 			case MIXERSETTINGS_MIXER1TYPE_DISABLED:
@@ -328,17 +415,7 @@ static void post_process_scale_and_commit(float *motor_vect, float dT,
 				break;
 
 			case MIXERSETTINGS_MIXER1TYPE_SERVO:
-				break;
-
 			case MIXERSETTINGS_MIXER1TYPE_MOTOR:
-				min_chan = fminf(min_chan, motor_vect[ct]);
-				max_chan = fmaxf(max_chan, motor_vect[ct]);
-
-				if (motor_vect[ct] < 0.0f) {
-					neg_clip += motor_vect[ct];
-				}
-
-				num_motors++;
 				break;
 			case MIXERSETTINGS_MIXER1TYPE_CAMERAPITCH:
 				if (CameraDesiredHandle()) {
@@ -434,7 +511,8 @@ static void post_process_scale_and_commit(float *motor_vect, float dT,
 			}
 		}
 
-		command.Channel[ct] = scale_channel(motor_vect[ct], ct);
+		command.Channel[ct] = mixer_plan_scale_channel(&mixer_plan, ct,
+				motor_vect[ct]);
 	}
 
 	// Store update time
@@ -445,6 +523,9 @@ static void post_process_scale_and_commit(float *motor_vect, float dT,
 	if (command.UpdateTime > command.MaxUpdateTime)
 		command.MaxUpdateTime = 1000.0f*dT;
 
+	// Time from the gyro sample to the outputs
+	command.Latency = MIN(PIOS_DELAY_DiffuS(sample_time), UINT16_MAX);
+
 	// Update output object
 	if (!ActuatorCommandReadOnly()) {
 		ActuatorCommandSet(&command);
@@ -462,17 +543,15 @@ static void post_process_scale_and_commit(float *motor_vect, float dT,
 }
 
 static void normalize_input_data(uint32_t this_systime,
+		const ActuatorDesiredData *desired,
 		float (*desired_vect)[MIXERSETTINGS_MIXER1VECTOR_NUMELEM],
 		bool *armed, bool *spin_while_armed, bool *stabilize_now)
 {
 	static float manual_throt = -1;
 	float throttle_val = -1;
-	ActuatorDesiredData desired;
 
 	static FlightStatusData flightStatus;
 
-	ActuatorDesiredGet(&desired);
-
 	if (flight_status_updated) {
 		FlightStatusGet(&flightStatus);
 		flight_status_updated = false;
@@ -494,7 +573,7 @@ static void normalize_input_data(uint32_t this_systime,
 			throttle_val = manual_throt;
 		}
 	} else {
-		throttle_val = desired.Thrust;
+		throttle_val = desired->Thrust;
 	}
 
 	static uint32_t last_pos_throttle_time = 0;
@@ -526,10 +605,135 @@ static void normalize_input_data(uint32_t this_systime,
 
 	//The source for the secondary curve is selectable
 	float val2 = collective_curve(
-			get_curve2_source(&desired, airframe_type, curve2_src),
+			get_curve2_source(desired, airframe_type, curve2_src),
 			curve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM);
 
-	fill_desired_vector(&desired, val1, val2, desired_vect);
+	fill_desired_vector(desired, val1, val2, desired_vect);
+}
+
+/**
+ * Fetch settings objects that have changed since the last loop
+ */
+static void update_settings()
+{
+	if (actuator_settings_updated) {
+		actuator_settings_updated = false;
+		ActuatorSettingsGet(&actuatorSettings);
+		compute_channel_scale();
+
+		PIOS_Servo_SetMode(actuatorSettings.TimerUpdateFreq,
+				ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM,
+				actuatorSettings.ChannelMax,
+				actuatorSettings.ChannelMin);
+	}
+
+	if (mixer_settings_updated) {
+		mixer_settings_updated = false;
+		SystemSettingsAirframeTypeGet(&airframe_type);
+
+		compute_mixer();
+		// XXX compute_inverse_mixer();
+
+		MixerSettingsThrottleCurve1Get(curve1);
+		MixerSettingsThrottleCurve2Get(curve2);
+		MixerSettingsCurve2SourceGet(&curve2_src);
+	}
+}
+
+/**
+ * Mix one set of desired values and program the outputs
+ * @param[in] desired the desired axis actions
+ * @param[in] sample_time raw time at which the input was sampled
+ */
+static void actuator_update(const ActuatorDesiredData *desired,
+		uint32_t sample_time)
+{
+	uint32_t this_systime = PIOS_Thread_Systime();
+
+	/* Check how long since last update; this is stored into the
+	 * UAVO to allow analysis of actuation jitter.
+	 */
+	if (this_systime > last_systime) {
+		dT = (this_systime - last_systime) / 1000.0f;
+		/* (Otherwise, the timer has wrapped [rare] and we should
+		 * just reuse dT)
+		 */
+	}
+
+	last_systime = this_systime;
+
+	float motor_vect[MAX_MIX_ACTUATORS];
+
+	bool armed, spin_while_armed, stabilize_now;
+
+	/* Receive manual control and desired UAV objects.  Perform
+	 * arming / hangtime checks; form a vector with desired
+	 * axis actions.
+	 */
+	normalize_input_data(this_systime, desired, &desired_vect, &armed,
+			&spin_while_armed, &stabilize_now);
+
+	/* Multiply the actuators x desired matrix by the
+	 * desired x 1 column vector.  Only motor and servo channels are
+	 * set, the others are filled in by post processing. */
+	mixer_plan_eval(&mixer_plan, desired_vect, motor_vect);
+
+	/* Perform clipping adjustments on the outputs, along with
+	 * state-related corrections (spin while armed, disarmed, etc).
+	 *
+	 * Program the actual values to the timer subsystem.
+	 */
+	post_process_scale_and_commit(motor_vect, dT, sample_time, armed,
+			spin_while_armed, stabilize_now);
+
+	/* If we got this far, everything is OK. */
+	AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
+}
+
+/**
+ * @brief Hand the output of the stabilization loop to the actuators
+ *
+ * Must be called by the stabilization loop before it sets @ref ActuatorDesired.
+ * With direct mixing this mixes and updates the outputs right away, in the
+ * calling task.  Otherwise only the sample time is noted and the actuator
+ * task picks up the update from the object.
+ *
+ * @param[in] desired the desired axis actions
+ * @param[in] sample_time raw time (PIOS_DELAY_GetRaw()) at which the gyro
+ *            sample this is based on was received
+ */
+void actuator_input_ready(const ActuatorDesiredData *desired,
+		uint32_t sample_time)
+{
+	if (!direct_mixing) {
+		queued_sample_time = sample_time;
+		return;
+	}
+
+	// Outputs are not set up yet
+	if (!actuator_ready) {
+		return;
+	}
+
+	PIOS_Mutex_Lock(output_lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	update_settings();
+
+	actuator_update(desired, sample_time);
+
+	last_direct_update = PIOS_Thread_Systime();
+
+	PIOS_Mutex_Unlock(output_lock);
+}
+
+/**
+ * @brief Whether the actuator stage runs in the stabilization task
+ *
+ * Fixed from initialization until the next reboot.
+ */
+bool actuator_direct_mixing(void)
+{
+	return direct_mixing;
 }
 
 /**
@@ -543,6 +747,9 @@ static void normalize_input_data(uint32_t this_systime,
  * Note this code depends on the UAVObjects for the mixers being all being the same
  * and in sequence. If you change the object definition, make sure you check the code!
  *
+ * With direct mixing the mixing is done by actuator_input_ready() and this
+ * task only sets the failsafe outputs when no update arrives in time.
+ *
  * @return -1 if error, 0 if success
  */
 static void actuator_task(void* parameters)
@@ -554,6 +761,7 @@ static void actuator_task(void* parameters)
 	// Ensure the initial state of actuators is safe.
 	actuator_settings_updated = false;
 	ActuatorSettingsGet(&actuatorSettings);
+	compute_channel_scale();
 
 	PIOS_Servo_SetMode(actuatorSettings.TimerUpdateFreq,
 			ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM,
@@ -562,36 +770,46 @@ static void actuator_task(void* parameters)
 	set_failsafe();
 
 	/* This is out here because not everything may change each time */
-	uint32_t last_systime = PIOS_Thread_Systime();
-	float desired_vect[MIXERSETTINGS_MIXER1VECTOR_NUMELEM] = { 0 };
-	float dT = 0.0f;
+	last_systime = PIOS_Thread_Systime();
+
+	if (direct_mixing) {
+		// The mixer settings have to be in place before the first
+		// update from the stabilization loop
+		update_settings();
+		last_direct_update = PIOS_Thread_Systime();
+		actuator_ready = true;
+
+		while (1) {
+			PIOS_WDG_UpdateFlag(PIOS_WDG_ACTUATOR);
+
+			uint32_t wait_ms = FAILSAFE_TIMEOUT_MS;
+
+			PIOS_Mutex_Lock(output_lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+			// Checked under the lock, so an update can't land
+			// between deciding and setting the failsafe
+			uint32_t since_update = PIOS_Thread_Systime() -
+				last_direct_update;
+
+			if (since_update >= FAILSAFE_TIMEOUT_MS) {
+				set_failsafe();
+			} else {
+				// Sleep until this update's deadline
+				wait_ms = FAILSAFE_TIMEOUT_MS - since_update;
+			}
+
+			PIOS_Mutex_Unlock(output_lock);
+
+			PIOS_Thread_Sleep(wait_ms);
+		}
+	}
 
 	// Main task loop
 	while (1) {
 		/* If settings objects have changed, update our internal
 		 * state appropriately.
 		 */
-		if (actuator_settings_updated) {
-			actuator_settings_updated = false;
-			ActuatorSettingsGet(&actuatorSettings);
-
-			PIOS_Servo_SetMode(actuatorSettings.TimerUpdateFreq,
-					ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM,
-					actuatorSettings.ChannelMax,
-					actuatorSettings.ChannelMin);
-		}
-
-		if (mixer_settings_updated) {
-			mixer_settings_updated = false;
-			SystemSettingsAirframeTypeGet(&airframe_type);
-
-			compute_mixer();
-			// XXX compute_inverse_mixer();
-
-			MixerSettingsThrottleCurve1Get(curve1);
-			MixerSettingsThrottleCurve2Get(curve2);
-			MixerSettingsCurve2SourceGet(&curve2_src);
-		}
+		update_settings();
 
 		PIOS_WDG_UpdateFlag(PIOS_WDG_ACTUATOR);
 
@@ -605,48 +823,10 @@ static void actuator_task(void* parameters)
 			continue;
 		}
 
-		uint32_t this_systime = PIOS_Thread_Systime();
+		ActuatorDesiredData desired;
+		ActuatorDesiredGet(&desired);
 
-		/* Check how long since last update; this is stored into the
-		 * UAVO to allow analysis of actuation jitter.
-		 */
-		if (this_systime > last_systime) {
-			dT = (this_systime - last_systime) / 1000.0f;
-			/* (Otherwise, the timer has wrapped [rare] and we should
-			 * just reuse dT)
-			 */
-		}
-
-		last_systime = this_systime;
-
-		float motor_vect[MAX_MIX_ACTUATORS];
-
-		bool armed, spin_while_armed, stabilize_now;
-
-		/* Receive manual control and desired UAV objects.  Perform
-		 * arming / hangtime checks; form a vector with desired
-		 * axis actions.
-		 */
-		normalize_input_data(this_systime, &desired_vect, &armed,
-				&spin_while_armed, &stabilize_now);
-
-		/* Multiply the actuators x desired matrix by the
-		 * desired x 1 column vector. */
-		matrix_mul_check(motor_mixer, desired_vect, motor_vect,
-				MAX_MIX_ACTUATORS,
-				MIXERSETTINGS_MIXER1VECTOR_NUMELEM,
-				1);
-
-		/* Perform clipping adjustments on the outputs, along with
-		 * state-related corrections (spin while armed, disarmed, etc).
-		 *
-		 * Program the actual values to the timer subsystem.
-		 */
-		post_process_scale_and_commit(motor_vect, dT, armed,
-				spin_while_armed, stabilize_now);
-
-		/* If we got this far, everything is OK. */
-		AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
+		actuator_update(&desired, queued_sample_time);
 	}
 }
 
@@ -682,34 +862,6 @@ static float collective_curve(float const input, float const * curve, uint8_t nu
 	return linear_interpolate(input, curve, num_points, -1.0f, 1.0f);
 }
 
-/**
- * Convert channel from -1/+1 to servo pulse duration in microseconds
- */
-static float scale_channel(float value, int idx)
-{
-	float max = actuatorSettings.ChannelMax[idx];
-	float min = actuatorSettings.ChannelMin[idx];
-	float neutral = actuatorSettings.ChannelNeutral[idx];
-
-	float valueScaled;
-	// Scale
-	if (value >= 0.0f) {
-		valueScaled = value*(max-neutral) + neutral;
-	} else {
-		valueScaled = value*(neutral-min) + neutral;
-	}
-
-	if (max>min) {
-		if (valueScaled > max) valueScaled = max;
-		if (valueScaled < min) valueScaled = min;
-	} else {
-		if (valueScaled < max) valueScaled = max;
-		if (valueScaled > min) valueScaled = min;
-	}
-
-	return valueScaled;
-}
-
 static float channel_failsafe_value(int idx)
 {
 	switch (types_mixer[idx]) {
@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsModules Tau Labs Modules
+ * @{
+ * @addtogroup ActuatorModule Actuator Module
+ * @{
+ *
+ * @file       actuator.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Actuator module. Drives the actuators (servos, motors etc).
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef ACTUATOR_H
+#define ACTUATOR_H
+
+#include "actuatordesired.h"
+
+void actuator_input_ready(const ActuatorDesiredData *desired,
+		uint32_t sample_time);
+bool actuator_direct_mixing(void);
+
+#endif /* ACTUATOR_H */
+
+/**
+ * @}
+ * @}
+ */
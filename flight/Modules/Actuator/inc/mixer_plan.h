@@ -0,0 +1,117 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsModules Tau Labs Modules
+ * @{
+ * @addtogroup ActuatorModule Actuator Module
+ * @{
+ *
+ * @file       mixer_plan.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Compact form of the mixer matrix and output scaling
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef MIXER_PLAN_H
+#define MIXER_PLAN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//! Most output channels and mixer inputs a plan can hold
+#define MIXER_PLAN_MAX_CHANNELS 12
+#define MIXER_PLAN_MAX_INPUTS   8
+
+//! Rows are processed in groups of this many
+#define MIXER_PLAN_LANES        4
+
+enum mixer_plan_row {
+	MIXER_PLAN_ROW_UNUSED,
+	MIXER_PLAN_ROW_SERVO,
+	MIXER_PLAN_ROW_MOTOR,
+};
+
+//! Conversion of a channel from [-1,1] to a pulse length
+struct mixer_plan_scale {
+	float neutral;
+	float pos;        //!< max - neutral
+	float neg;        //!< neutral - min
+	float lo;         //!< smaller of min and max
+	float hi;         //!< larger of min and max
+};
+
+/**
+ * The mixer matrix reduced to the rows of servo and motor channels and the
+ * inputs that any of them uses. Coefficients are stored by input, with the
+ * rows padded to a multiple of MIXER_PLAN_LANES, so each group of rows is
+ * evaluated as fixed width multiply-accumulates over the used inputs.
+ */
+struct mixer_plan {
+	uint8_t num_channels;
+	uint8_t num_rows;
+	uint8_t num_lanes;          //!< num_rows rounded up to MIXER_PLAN_LANES
+	uint8_t num_inputs;
+	uint8_t num_motors;
+
+	uint8_t row_channel[MIXER_PLAN_MAX_CHANNELS];
+	uint8_t input[MIXER_PLAN_MAX_INPUTS];
+	uint8_t motor_row[MIXER_PLAN_MAX_CHANNELS];
+
+	float coef[MIXER_PLAN_MAX_INPUTS * MIXER_PLAN_MAX_CHANNELS] __attribute__((aligned(16)));
+
+	struct mixer_plan_scale scale[MIXER_PLAN_MAX_CHANNELS];
+};
+
+void mixer_plan_build(struct mixer_plan *plan, const float *mixer,
+		const enum mixer_plan_row *rows, int num_channels, int num_inputs);
+void mixer_plan_set_scale(struct mixer_plan *plan, int channel,
+		float min, float neutral, float max);
+void mixer_plan_eval(const struct mixer_plan *plan, const float *in,
+		float *out);
+
+/**
+ * Convert a channel value from [-1,1] to a pulse length, clipped to the
+ * channel limits
+ * @param[in] plan the mixer plan
+ * @param[in] channel output channel
+ * @param[in] value channel value
+ * @returns pulse length
+ */
+static inline float mixer_plan_scale_channel(const struct mixer_plan *plan,
+		int channel, float value)
+{
+	const struct mixer_plan_scale *s = &plan->scale[channel];
+
+	float scaled = s->neutral + value * (value >= 0.0f ? s->pos : s->neg);
+
+	if (scaled > s->hi) {
+		scaled = s->hi;
+	}
+	if (scaled < s->lo) {
+		scaled = s->lo;
+	}
+
+	return scaled;
+}
+
+#endif /* MIXER_PLAN_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,178 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsModules Tau Labs Modules
+ * @{
+ * @addtogroup ActuatorModule Actuator Module
+ * @{
+ *
+ * @file       mixer_plan.c
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Compact form of the mixer matrix and output scaling
+ *
+ * The mixer matrix has a row for every output channel and a column for every
+ * input, but most airframes only use a few of each. The plan is built when
+ * the settings change and only keeps what contributes to the outputs.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <string.h>
+
+#include "mixer_plan.h"
+
+/**
+ * Build a plan from a mixer matrix
+ * @param[out] plan the plan
+ * @param[in] mixer row major matrix, num_channels x num_inputs
+ * @param[in] rows what each channel is used for
+ * @param[in] num_channels number of output channels
+ * @param[in] num_inputs number of inputs
+ */
+void mixer_plan_build(struct mixer_plan *plan, const float *mixer,
+		const enum mixer_plan_row *rows, int num_channels, int num_inputs)
+{
+	struct mixer_plan_scale scale[MIXER_PLAN_MAX_CHANNELS];
+
+	// The scaling is set up separately and has to survive this
+	memcpy(scale, plan->scale, sizeof(scale));
+	memset(plan, 0, sizeof(*plan));
+	memcpy(plan->scale, scale, sizeof(scale));
+
+	if (num_channels > MIXER_PLAN_MAX_CHANNELS) {
+		num_channels = MIXER_PLAN_MAX_CHANNELS;
+	}
+	if (num_inputs > MIXER_PLAN_MAX_INPUTS) {
+		num_inputs = MIXER_PLAN_MAX_INPUTS;
+	}
+
+	plan->num_channels = num_channels;
+
+	for (int ch = 0; ch < num_channels; ch++) {
+		if (rows[ch] == MIXER_PLAN_ROW_UNUSED) {
+			continue;
+		}
+
+		if (rows[ch] == MIXER_PLAN_ROW_MOTOR) {
+			plan->motor_row[plan->num_motors++] = plan->num_rows;
+		}
+
+		plan->row_channel[plan->num_rows++] = ch;
+	}
+
+	plan->num_lanes = (plan->num_rows + MIXER_PLAN_LANES - 1) &
+		~(MIXER_PLAN_LANES - 1);
+
+	for (int in = 0; in < num_inputs; in++) {
+		bool used = false;
+
+		for (int r = 0; r < plan->num_rows; r++) {
+			if (mixer[plan->row_channel[r] * num_inputs + in] != 0.0f) {
+				used = true;
+				break;
+			}
+		}
+
+		if (!used) {
+			continue;
+		}
+
+		float *col = &plan->coef[plan->num_inputs * plan->num_lanes];
+
+		for (int r = 0; r < plan->num_rows; r++) {
+			col[r] = mixer[plan->row_channel[r] * num_inputs + in];
+		}
+
+		plan->input[plan->num_inputs++] = in;
+	}
+}
+
+/**
+ * Set the conversion of a channel to pulse lengths
+ * @param[in] plan the mixer plan
+ * @param[in] channel output channel
+ * @param[in] min pulse length at -1
+ * @param[in] neutral pulse length at 0
+ * @param[in] max pulse length at 1
+ */
+void mixer_plan_set_scale(struct mixer_plan *plan, int channel,
+		float min, float neutral, float max)
+{
+	struct mixer_plan_scale *s = &plan->scale[channel];
+
+	s->neutral = neutral;
+	s->pos = max - neutral;
+	s->neg = neutral - min;
+
+	// Reversed channels have min > max
+	if (max > min) {
+		s->lo = min;
+		s->hi = max;
+	} else {
+		s->lo = max;
+		s->hi = min;
+	}
+}
+
+/**
+ * Multiply the inputs by the mixer
+ * @param[in] plan the mixer plan
+ * @param[in] in all mixer inputs
+ * @param[out] out one value per channel, channels without a plan row are
+ *             left as they are
+ */
+void mixer_plan_eval(const struct mixer_plan *plan, const float *in,
+		float *out)
+{
+	for (int r = 0; r < plan->num_lanes; r += MIXER_PLAN_LANES) {
+		const float *restrict col = &plan->coef[r];
+		float acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+		// Accumulate a group of rows in registers over all inputs
+		for (int i = 0; i < plan->num_inputs; i++) {
+			const float v = in[plan->input[i]];
+
+			acc0 += v * col[0];
+			acc1 += v * col[1];
+			acc2 += v * col[2];
+			acc3 += v * col[3];
+
+			col += plan->num_lanes;
+		}
+
+		const uint8_t *ch = &plan->row_channel[r];
+
+		switch (plan->num_rows - r) {
+		default:
+			out[ch[3]] = acc3;
+			/* fall through */
+		case 3:
+			out[ch[2]] = acc2;
+			/* fall through */
+		case 2:
+			out[ch[1]] = acc1;
+			/* fall through */
+		case 1:
+			out[ch[0]] = acc0;
+		}
+	}
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -136,7 +136,6 @@ struct cfvert {
 // Private variables
 static struct pios_thread *attitudeTaskHandle;
 
-static struct pios_queue *gyroQueue;
 static struct pios_queue *accelQueue;
 static struct pios_queue *magQueue;
 static struct pios_queue *baroQueue;
@@ -158,7 +157,9 @@ static const float zeros[3] = {0.0f, 0.0f, 0.0f};
 static struct complementary_filter_state complementary_filter_state;
 static struct cfvert cfvert; //!< State information for vertical filter
 
-static float dT_expected = 0.001f;	// assume 1KHz if we don't know.
+static float dT_gyro = 0.001f;		// assume 1KHz if we don't know.
+static float dT_expected = 0.001f;
+static uint32_t wait_timeout_ms = FAILSAFE_TIMEOUT_MS;
 
 // Private functions
 static void AttitudeTask(void *parameters);
@@ -260,7 +261,6 @@ int32_t AttitudeInitialize(void)
 int32_t AttitudeStart(void)
 {
 	// Create the queues for the sensors
-	gyroQueue = PIOS_Queue_Create(1, sizeof(UAVObjEvent));
 	accelQueue = PIOS_Queue_Create(1, sizeof(UAVObjEvent));
 	magQueue = PIOS_Queue_Create(2, sizeof(UAVObjEvent));
 	baroQueue = PIOS_Queue_Create(1, sizeof(UAVObjEvent));
@@ -284,7 +284,11 @@ int32_t AttitudeStart(void)
 	gyrosBias.z = 0;
 	GyrosBiasSet(&gyrosBias);
 
-	GyrosConnectQueue(gyroQueue);
+	// Woken by the scheduler once the gyros and accels are updated; the
+	// divider is set from the settings when the task starts
+	if (PIOS_SCHED_RegisterTask(PIOS_SCHED_STAGE_ATTITUDE, 1) != 0)
+		return -1;
+
 	AccelsConnectQueue(accelQueue);
 	if (MagnetometerHandle())
 		MagnetometerConnectQueue(magQueue);
@@ -327,7 +331,7 @@ static void AttitudeTask(void *parameters)
 	uint16_t samp_rate = PIOS_SENSORS_GetSampleRate(PIOS_SENSOR_GYRO);
 
 	if (samp_rate) {
-		dT_expected = 1.0f / samp_rate;
+		dT_gyro = 1.0f / samp_rate;
 	}
 
 	// Main task loop
@@ -345,7 +349,12 @@ static void AttitudeTask(void *parameters)
 			INSSetBaroVar(insSettings.BaroVar);
 
 			AttitudeSettingsGet(&attitudeSettings);
-				
+
+			uint8_t divider = MAX(attitudeSettings.RateDivider, 1);
+			PIOS_SCHED_SetDivider(PIOS_SCHED_STAGE_ATTITUDE, divider);
+			dT_expected = dT_gyro * divider;
+			wait_timeout_ms = FAILSAFE_TIMEOUT_MS * divider;
+
 			// Calculate accel filter alpha, in the same way as for gyro data in stabilization module.
 			if(attitudeSettings.AccelTau < 0.0001f) {
 				complementary_filter_state.accel_alpha = 0;   // not trusting this to resolve to 0
@@ -494,7 +503,9 @@ static int32_t updateAttitudeComplementary(float dT, bool first_run, bool second
 	// If this is the primary estimation filter, wait until the accel and
 	// gyro objects are updated. If it timeouts then go to failsafe.
 	if (!secondary) {
-		bool gyroTimeout  = PIOS_Queue_Receive(gyroQueue, &ev, FAILSAFE_TIMEOUT_MS) != true;
+		// The scheduler wakes us on a gyro sample; the sensors update
+		// the accels before the gyros
+		bool gyroTimeout  = !PIOS_SCHED_Wait(PIOS_SCHED_STAGE_ATTITUDE, wait_timeout_ms);
 		bool accelTimeout = PIOS_Queue_Receive(accelQueue, &ev, 1) != true;
 
 		// When one of these is updated so should the other.
@@ -1093,7 +1104,7 @@ static int32_t updateAttitudeINSGPS(bool first_run, bool outdoor_mode)
 	gps_vel_updated = gps_vel_updated || (PIOS_Queue_Receive(gpsVelQueue, &ev, 0) && outdoor_mode);
 
 	// Wait until the gyro and accel object is updated, if a timeout then go to failsafe
-	if (PIOS_Queue_Receive(gyroQueue, &ev, FAILSAFE_TIMEOUT_MS) != true ||
+	if (!PIOS_SCHED_Wait(PIOS_SCHED_STAGE_ATTITUDE, wait_timeout_ms) ||
 		PIOS_Queue_Receive(accelQueue, &ev, 1) != true)
 	{
 		return -1;
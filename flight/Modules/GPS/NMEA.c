@@ -102,86 +102,106 @@ const static struct nmea_parser nmea_parsers[] = {
 	},
 };
 
-int parse_nmea_stream (uint8_t c, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
+/**
+ * Process a complete sentence in gps_rx_buffer, with the trailing \r\n
+ * already stripped.
+ */
+static int parse_nmea_sentence(char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
+{
+	// Validate the checksum over the sentence
+	if (!NMEA_checksum(&gps_rx_buffer[1]))
+	{	// Invalid checksum.  May indicate dropped characters on Rx.
+		gpsRxStats->gpsRxChkSumError++;
+		return PARSER_ERROR;
+	}
+
+	// Valid checksum, use this packet to update the GPS position
+	if (!NMEA_update_position(&gps_rx_buffer[1], GpsData))
+		gpsRxStats->gpsRxParserError++;
+	else
+		gpsRxStats->gpsRxReceived++;
+
+	return PARSER_COMPLETE;
+}
+
+/**
+ * Parse a chunk of the incoming stream for NMEA sentences.  Sentences may
+ * span chunks.  Rather than looking at every character the chunk is
+ * searched for the start of a sentence and then copied a line at a time.
+ * \return PARSER_COMPLETE if at least one sentence was completed
+ * \return PARSER_OVERRUN if a sentence overran the buffer
+ * \return PARSER_INCOMPLETE if a sentence is partially received
+ * \return PARSER_ERROR if nothing in the chunk could be used
+ */
+int parse_nmea_buffer (const uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
 {
 	static uint8_t rx_count = 0;
 	static bool start_flag = false;
-	static bool found_cr = false;
 
-	// detect start while acquiring stream
-	if (!start_flag && (c == '$')) // NMEA identifier found
-	{
-		start_flag = true;
-		found_cr = false;
-		rx_count = 0;
-	}
-	else
-	if (!start_flag)
-		return PARSER_ERROR;
+	const uint8_t *end = rx + len;
+	int ret = PARSER_ERROR;
 
-	if (rx_count >= NMEA_MAX_PACKET_LENGTH)
-	{
-		// The buffer is already full and we haven't found a valid NMEA sentence.
-		// Flush the buffer and note the overflow event.
-		gpsRxStats->gpsRxOverflow++;
-		start_flag = false;
-		found_cr = false;
-		rx_count = 0;
-		return PARSER_OVERRUN;
-	}
-	else
-	{
-		gps_rx_buffer[rx_count] = c;
-		rx_count++;
-	}
+	while (rx < end) {
+		// detect start while acquiring stream
+		if (!start_flag) {
+			const uint8_t *start = memchr(rx, '$', end - rx);
+			if (!start)
+				break;
+
+			rx = start; // NMEA identifier found
+			start_flag = true;
+			rx_count = 0;
+		}
+
+		// Copy up to and including the next '\n'
+		const uint8_t *nl = memchr(rx, '\n', end - rx);
+		uint16_t span = nl ? nl - rx + 1 : end - rx;
+
+		if (rx_count + span > NMEA_MAX_PACKET_LENGTH) {
+			// The buffer fills up before we find a valid NMEA sentence.
+			// Flush the buffer, drop the byte that didn't fit and note
+			// the overflow event.
+			rx += NMEA_MAX_PACKET_LENGTH - rx_count + 1;
+			gpsRxStats->gpsRxOverflow++;
+			start_flag = false;
+			rx_count = 0;
+			if (ret != PARSER_COMPLETE)
+				ret = PARSER_OVERRUN;
+			continue;
+		}
+
+		memcpy(&gps_rx_buffer[rx_count], rx, span);
+		rx_count += span;
+		rx += span;
+
+		if (!nl) {
+			if (ret == PARSER_ERROR)
+				ret = PARSER_INCOMPLETE;
+			break;
+		}
+
+		// The sentence ends with '\r\n'.  A '\r' directly after another
+		// '\r' doesn't count, so it takes an odd run of them.
+		uint8_t crs = 0;
+		while (crs + 2 <= rx_count && gps_rx_buffer[rx_count - 2 - crs] == '\r')
+			crs++;
+
+		if (!(crs & 1))
+			continue;
 
-	// look for ending '\r\n' sequence
-	if (!found_cr && (c == '\r') )
-		found_cr = true;
-	else
-	if (found_cr && (c != '\n') )
-		found_cr = false;  // false end flag
-	else
-	if (found_cr && (c == '\n') )
-	{
 		// The NMEA functions require a zero-terminated string
 		// As we detected \r\n, the string as for sure 2 bytes long, we will also strip the \r\n
 		gps_rx_buffer[rx_count-2] = 0;
 
 		// prepare to parse next sentence
 		start_flag = false;
-		found_cr = false;
 		rx_count = 0;
-		// Our rxBuffer must look like this now:
-		//   [0]           = '$'
-		//   ...           = zero or more bytes of sentence payload
-		//   [end_pos - 1] = '\r'
-		//   [end_pos]     = '\n'
-		//
-		// Prepare to consume the sentence from the buffer
-
-		// Validate the checksum over the sentence
-		if (!NMEA_checksum(&gps_rx_buffer[1]))
-		{	// Invalid checksum.  May indicate dropped characters on Rx.
-			//PIOS_DEBUG_PinHigh(2);
-			gpsRxStats->gpsRxChkSumError++;
-			//PIOS_DEBUG_PinLow(2);
-			return PARSER_ERROR;
-		}
-		else
-		{	// Valid checksum, use this packet to update the GPS position
-			if (!NMEA_update_position(&gps_rx_buffer[1], GpsData)) {
-				//PIOS_DEBUG_PinHigh(2);
-				gpsRxStats->gpsRxParserError++;
-				//PIOS_DEBUG_PinLow(2);
-			}
-			else
-				gpsRxStats->gpsRxReceived++;;
-
-			return PARSER_COMPLETE;
-		}
+
+		if (parse_nmea_sentence(gps_rx_buffer, GpsData, gpsRxStats) == PARSER_COMPLETE)
+			ret = PARSER_COMPLETE;
 	}
-	return PARSER_INCOMPLETE;
+
+	return ret;
 }
 
 const static struct nmea_parser *NMEA_find_parser_by_prefix(const char *prefix)
@@ -35,15 +35,23 @@
 
 #include "UBX.h"
 #include "GPS.h"
+#include "misc_math.h"
 
 static uint32_t parse_errors;
 
 static bool checksum_ubx_message(const struct UBXPacket *);
 static uint32_t parse_ubx_message(const struct UBXPacket *, GPSPositionData *);
 
-// parse incoming character stream for messages in UBX binary format
-
-int parse_ubx_stream (uint8_t c, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
+/**
+ * Parse a chunk of the incoming stream for messages in UBX binary format.
+ * Frames may span chunks.  The sync search and the payload copy work on
+ * the whole chunk at once and the checksum is only validated once the
+ * frame is complete.
+ * \return PARSER_COMPLETE if at least one message was completed
+ * \return PARSER_INCOMPLETE if a message is partially received
+ * \return PARSER_ERROR if nothing in the chunk could be used
+ */
+int parse_ubx_buffer (const uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
 {
 	enum proto_states {
 		START,
@@ -55,80 +63,88 @@ int parse_ubx_stream (uint8_t c, char *gps_rx_buffer, GPSPositionData *GpsData,
 		UBX_PAYLOAD,
 		UBX_CHK1,
 		UBX_CHK2,
-		FINISHED
 	};
 
 	static enum proto_states proto_state = START;
 	static uint16_t rx_count = 0;
 	struct UBXPacket *ubx = (struct UBXPacket *)gps_rx_buffer;
-
-	switch (proto_state) {
-		case START: // detect protocol
-			if (c ==  UBX_SYNC1) // first UBX sync char found
+	const uint8_t *end = rx + len;
+	bool complete = false;
+
+	while (rx < end) {
+		switch (proto_state) {
+			case START: // detect protocol
+			{
+				const uint8_t *sync = memchr(rx, UBX_SYNC1, end - rx);
+				if (!sync) {
+					rx = end;
+					break;
+				}
+				rx = sync + 1; // first UBX sync char found
 				proto_state = UBX_SY2;
-			break;
-		case UBX_SY2:
-			if (c == UBX_SYNC2) // second UBX sync char found
-				proto_state = UBX_CLASS;
-			else
-				proto_state = START; // reset state
-			break;
-		case UBX_CLASS:
-			ubx->header.class = c;
-			proto_state = UBX_ID;
-			break;
-		case UBX_ID:
-			ubx->header.id = c;
-			proto_state = UBX_LEN1;
-			break;
-		case UBX_LEN1:
-			ubx->header.len = c;
-			proto_state = UBX_LEN2;
-			break;
-		case UBX_LEN2:
-			ubx->header.len += (c << 8);
-			if (ubx->header.len > sizeof(UBXPayload)) {
-				gpsRxStats->gpsRxOverflow++;
-				proto_state = START;
-			} else {
-				rx_count = 0;
-				proto_state = UBX_PAYLOAD;
+				break;
 			}
-			break;
-		case UBX_PAYLOAD:
-			if (rx_count < ubx->header.len) {
-				ubx->payload.payload[rx_count] = c;
-				if (++rx_count == ubx->header.len)
+			case UBX_SY2:
+				if (*rx++ == UBX_SYNC2) // second UBX sync char found
+					proto_state = UBX_CLASS;
+				else
+					proto_state = START; // reset state
+				break;
+			case UBX_CLASS:
+				ubx->header.class = *rx++;
+				proto_state = UBX_ID;
+				break;
+			case UBX_ID:
+				ubx->header.id = *rx++;
+				proto_state = UBX_LEN1;
+				break;
+			case UBX_LEN1:
+				ubx->header.len = *rx++;
+				proto_state = UBX_LEN2;
+				break;
+			case UBX_LEN2:
+				ubx->header.len += (*rx++ << 8);
+				if (ubx->header.len > sizeof(UBXPayload)) {
+					gpsRxStats->gpsRxOverflow++;
+					proto_state = START;
+				} else {
+					rx_count = 0;
+					proto_state = ubx->header.len ? UBX_PAYLOAD : UBX_CHK1;
+				}
+				break;
+			case UBX_PAYLOAD:
+			{
+				// Take as much of the payload as this chunk holds
+				uint16_t n = MIN(end - rx, ubx->header.len - rx_count);
+				memcpy(&ubx->payload.payload[rx_count], rx, n);
+				rx += n;
+				rx_count += n;
+				if (rx_count == ubx->header.len)
 					proto_state = UBX_CHK1;
-			} else {
-				gpsRxStats->gpsRxOverflow++;
-				proto_state = START;
+				break;
 			}
-			break;
-		case UBX_CHK1:
-			ubx->header.ck_a = c;
-			proto_state = UBX_CHK2;
-			break;
-		case UBX_CHK2:
-			ubx->header.ck_b = c;
-			if (checksum_ubx_message(ubx)) { // message complete and valid
-				parse_ubx_message(ubx, GpsData);
-				proto_state = FINISHED;
-			} else {
-				gpsRxStats->gpsRxChkSumError++;
+			case UBX_CHK1:
+				ubx->header.ck_a = *rx++;
+				proto_state = UBX_CHK2;
+				break;
+			case UBX_CHK2:
+				ubx->header.ck_b = *rx++;
+				if (checksum_ubx_message(ubx)) { // message complete and valid
+					parse_ubx_message(ubx, GpsData);
+					gpsRxStats->gpsRxReceived++;
+					complete = true;
+				} else {
+					gpsRxStats->gpsRxChkSumError++;
+				}
 				proto_state = START;
-			}
-			break;
-		default: break;
+				break;
+		}
 	}
 
-	if (proto_state == START)
-		return PARSER_ERROR;	// parser couldn't use this byte
-	else if (proto_state == FINISHED) {
-		gpsRxStats->gpsRxReceived++;
-		proto_state = START;
+	if (complete)
 		return PARSER_COMPLETE;	// message complete & processed
-	}
+	else if (proto_state == START)
+		return PARSER_ERROR;	// parser couldn't use these bytes
 
 	return PARSER_INCOMPLETE; // message not (yet) complete
 }
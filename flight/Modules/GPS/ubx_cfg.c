@@ -442,13 +442,13 @@ static void ubx_cfg_pause_parse(uintptr_t gps_port, uint32_t delay_ticks)
     struct GPS_RX_STATS gpsRxStats;
     GPSPositionData     gpsPosition;
 
-    uint8_t c;
+    uint8_t rx[16];
     uint32_t enterTime = PIOS_Thread_Systime();
     while ((PIOS_Thread_Systime() - enterTime) < delay_ticks)
     {
-        int32_t received = PIOS_COM_ReceiveBuffer(gps_port, &c, 1, 1);
+        uint16_t received = PIOS_COM_ReceiveBuffer(gps_port, rx, sizeof(rx), 1);
         if (received > 0)
-            parse_ubx_stream (c, gps_rx_buffer, &gpsPosition, &gpsRxStats);
+            parse_ubx_buffer (rx, received, gps_rx_buffer, &gpsPosition, &gpsRxStats);
     }
 }
 
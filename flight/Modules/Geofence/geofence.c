@@ -10,6 +10,14 @@
  * @author     dRonin, http://dronin.org Copyright (C) 2015
  * @brief      Check the UAV is within the geofence boundaries
  *
+ * There are two kinds of boundary: a circle around home from
+ * GeoFenceSettings, and the polygon zones of the GeoFenceZone instances,
+ * which have floors and ceilings and are either to stay inside or to keep
+ * out of.  The zones are indexed when they are uploaded, so checking them
+ * costs little more than checking the circle.  Besides breaching a zone,
+ * coming within ZoneWarningDistance of doing so or being less than
+ * ZoneWarningTime from it at the current velocity raises a warning.
+ *
  * @see        The GNU Public License (GPL) Version 3
  *
  *****************************************************************************/
@@ -33,9 +41,12 @@
 #include <eventdispatcher.h>
 #include "misc_math.h"
 #include "physical_constants.h"
+#include "geofence_eval.h"
 
 #include "geofencesettings.h"
+#include "geofencezone.h"
 #include "positionactual.h"
+#include "velocityactual.h"
 #include "modulesettings.h"
 
 
@@ -43,17 +54,32 @@
 // Configuration
 //
 #define SAMPLE_PERIOD_MS     250
+#define MAX_ZONES            8
+
+DONT_BUILD_IF(GEOFENCEZONE_NORTH_NUMELEM > GEOFENCE_MAX_VERTICES, GeoFenceZoneVertices);
+DONT_BUILD_IF(GEOFENCEZONE_EAST_NUMELEM != GEOFENCEZONE_NORTH_NUMELEM, GeoFenceZoneEast);
 
 // Private types
+struct geofence_state {
+	float warning_radius2;
+	float error_radius2;
+	float zone_warning_distance;
+	float zone_warning_time;
+
+	//! Allocated with the first zone
+	struct geofence_zone *zones;
+	uint8_t num_zones;
+};
 
 // Private variables
 
 // Private functions
 static void settingsUpdated(UAVObjEvent* ev, void *ctx, void *obj, int len);
+static void zonesUpdated(UAVObjEvent* ev, void *ctx, void *obj, int len);
 static void checkPosition(UAVObjEvent* ev, void *ctx, void *obj, int len);
 
 // Private variables
-static GeoFenceSettingsData *geofenceSettings;
+static struct geofence_state *geofence;
 
 /**
  * Initialise the module, called on startup
@@ -81,16 +107,26 @@ int32_t GeofenceInitialize(void)
 	}
 
 	if (module_enabled) {
+		if (GeoFenceZoneInitialize() == -1) {
+			module_enabled = false;
+			return -1;
+		}
+
 		// allocate and initialize the static data storage only if module is enabled
-		geofenceSettings = (GeoFenceSettingsData *) PIOS_malloc(sizeof(GeoFenceSettingsData));
-		if (geofenceSettings == NULL) {
+		geofence = PIOS_malloc(sizeof(*geofence));
+		if (geofence == NULL) {
 			module_enabled = false;
 			return -1;
 		}
 
+		memset(geofence, 0, sizeof(*geofence));
+
 		GeoFenceSettingsConnectCallback(settingsUpdated);
 		settingsUpdated(NULL, NULL, NULL, 0);
 
+		GeoFenceZoneConnectCallback(zonesUpdated);
+		zonesUpdated(NULL, NULL, NULL, 0);
+
 		return 0;
 	}
 
@@ -100,7 +136,7 @@ int32_t GeofenceInitialize(void)
 /* stub: module has no module thread */
 int32_t GeofenceStart(void)
 {
-	if (geofenceSettings == NULL) {
+	if (geofence == NULL) {
 		return -1;
 	}
 
@@ -128,15 +164,44 @@ static void checkPosition(UAVObjEvent* ev, void *ctx, void *obj, int len)
 		PositionActualData positionActual;
 		PositionActualGet(&positionActual);
 
+		SystemAlarmsAlarmOptions alarm = SYSTEMALARMS_ALARM_OK;
+
 		const float distance2 = powf(positionActual.North, 2) + powf(positionActual.East, 2);
 
-		// ErrorRadius is squared when it is fetched, so this is correct
-		if (distance2 > geofenceSettings->ErrorRadius) {
-			AlarmsSet(SYSTEMALARMS_ALARM_GEOFENCE, SYSTEMALARMS_ALARM_ERROR);
-		} else if (distance2 > geofenceSettings->WarningRadius) {
-			AlarmsSet(SYSTEMALARMS_ALARM_GEOFENCE, SYSTEMALARMS_ALARM_WARNING);
-		} else {
+		if (distance2 > geofence->error_radius2) {
+			alarm = SYSTEMALARMS_ALARM_ERROR;
+		} else if (distance2 > geofence->warning_radius2) {
+			alarm = SYSTEMALARMS_ALARM_WARNING;
+		}
+
+		if (geofence->num_zones && alarm != SYSTEMALARMS_ALARM_ERROR) {
+			float ned[3] = { positionActual.North, positionActual.East, positionActual.Down };
+			float velocity[3] = { 0, 0, 0 };
+
+			if (VelocityActualHandle()) {
+				VelocityActualData velocityActual;
+				VelocityActualGet(&velocityActual);
+
+				velocity[0] = velocityActual.North;
+				velocity[1] = velocityActual.East;
+				velocity[2] = velocityActual.Down;
+			}
+
+			struct geofence_result result;
+			geofence_evaluate(geofence->zones, geofence->num_zones, ned, velocity, &result);
+
+			if (result.margin < 0) {
+				alarm = SYSTEMALARMS_ALARM_ERROR;
+			} else if (result.margin < geofence->zone_warning_distance ||
+					result.time_to_breach < geofence->zone_warning_time) {
+				alarm = SYSTEMALARMS_ALARM_WARNING;
+			}
+		}
+
+		if (alarm == SYSTEMALARMS_ALARM_OK) {
 			AlarmsClear(SYSTEMALARMS_ALARM_GEOFENCE);
+		} else {
+			AlarmsSet(SYSTEMALARMS_ALARM_GEOFENCE, alarm);
 		}
 	}
 }
@@ -147,11 +212,53 @@ static void checkPosition(UAVObjEvent* ev, void *ctx, void *obj, int len)
 static void settingsUpdated(UAVObjEvent* ev, void *ctx, void *obj, int len)
 {
 	(void) ev; (void) ctx; (void) obj; (void) len;
-	GeoFenceSettingsGet(geofenceSettings);
+	GeoFenceSettingsData settings;
+	GeoFenceSettingsGet(&settings);
 
 	// Cache squared distances to save computations
-	geofenceSettings->WarningRadius = powf(geofenceSettings->WarningRadius, 2);
-	geofenceSettings->ErrorRadius = powf(geofenceSettings->ErrorRadius, 2);
+	geofence->warning_radius2 = powf(settings.WarningRadius, 2);
+	geofence->error_radius2 = powf(settings.ErrorRadius, 2);
+
+	geofence->zone_warning_distance = settings.ZoneWarningDistance;
+	geofence->zone_warning_time = settings.ZoneWarningTime;
+}
+
+/**
+ * Index the zones again when any of them changes.  Zones which are
+ * disabled or degenerate are left out.
+ */
+static void zonesUpdated(UAVObjEvent* ev, void *ctx, void *obj, int len)
+{
+	(void) ev; (void) ctx; (void) obj; (void) len;
+	uint8_t num_zones = 0;
+
+	uint16_t instances = UAVObjGetNumInstances(GeoFenceZoneHandle());
+
+	for (uint16_t i = 0; i < instances && num_zones < MAX_ZONES; i++) {
+		GeoFenceZoneData zone;
+		GeoFenceZoneInstGet(i, &zone);
+
+		if (zone.Type == GEOFENCEZONE_TYPE_DISABLED) {
+			continue;
+		}
+
+		if (geofence->zones == NULL) {
+			geofence->zones = PIOS_malloc(MAX_ZONES * sizeof(*geofence->zones));
+			if (geofence->zones == NULL) {
+				break;
+			}
+		}
+
+		if (geofence_zone_init(&geofence->zones[num_zones],
+				zone.Type == GEOFENCEZONE_TYPE_EXCLUSION,
+				zone.North, zone.East,
+				MIN(zone.Vertices, GEOFENCEZONE_NORTH_NUMELEM),
+				zone.Floor, zone.Ceiling) == 0) {
+			num_zones++;
+		}
+	}
+
+	geofence->num_zones = num_zones;
 }
 
 /**
@@ -50,6 +50,7 @@
 #include "airspeedactual.h"
 #include "attitudeactual.h"
 #include "baroaltitude.h"
+#include "blackboxdata.h"
 #include "flightbatterystate.h"
 #include "flightstatus.h"
 #include "gpsposition.h"
@@ -73,6 +74,7 @@
 #include "pios_com_priv.h"
 
 #include <uavtalk.h>
+#include <blackbox.h>
 
 // Private constants
 #define STACK_SIZE_BYTES 1200
@@ -81,6 +83,11 @@ const char DIGITS[16] = "0123456789abcdef";
 
 #define LOGGING_PERIOD_MS 100
 
+#define BLACKBOX_RING_LEN 2048
+#define BLACKBOX_PERIOD_MS 5
+// Enough to keep up at 1kHz without overrunning the log buffer
+#define BLACKBOX_MAX_CHUNKS 2
+
 // Private types
 
 // Private variables
@@ -89,6 +96,7 @@ static struct pios_thread *loggingTaskHandle;
 static bool module_enabled;
 static volatile LoggingSettingsData settings;
 static LoggingStatsData loggingData;
+static BlackboxDataData blackboxData;
 
 // Private functions
 static void    loggingTask(void *parameters);
@@ -102,11 +110,14 @@ static void logAll(UAVObjHandle obj);
 static void logSettings(UAVObjHandle obj);
 static void writeHeader();
 static void updateSettings();
+static void sendBlackbox();
+static void blackbox_updated_callback(UAVObjEvent * ev, void* cb_ctx, void *uavo_data, int uavo_len);
 
 // Local variables
 static uintptr_t logging_com_id;
 static uint32_t written_bytes;
 static bool destination_onboard_flash;
+static bool blackbox_enabled;
 
 #ifdef PIOS_INCLUDE_LOG_TO_FLASH
 static const struct streamfs_cfg streamfs_settings = {
@@ -180,12 +191,30 @@ int32_t LoggingInitialize(void)
 		return -1;
 	}
 
+	// The blackbox ring is only allocated if it is going to be used
+	uint8_t blackbox_divider;
+	LoggingSettingsBlackboxDividerGet(&blackbox_divider);
+	if (blackbox_divider) {
+		if (BlackboxDataInitialize() == -1 ||
+				blackbox_init(BLACKBOX_RING_LEN) != 0) {
+			module_enabled = false;
+			return -1;
+		}
+
+		blackbox_enabled = true;
+	}
+
 	// Initialise UAVTalk
 	uavTalkCon = UAVTalkInitialize(&send_data_nonblock);
 	if (uavTalkCon == 0) {
 		module_enabled = false;
 		return -1;
 	}
+
+	if (blackbox_enabled) {
+		UAVObjConnectCallback(BlackboxDataHandle(),
+				blackbox_updated_callback, NULL, EV_UPDATED);
+	}
 	
 	return 0;
 }
@@ -272,6 +301,14 @@ static void loggingTask(void *parameters)
 			}
 		}
 
+		if (blackbox_enabled &&
+				loggingData.Operation != LOGGINGSTATS_OPERATION_LOGGING) {
+			// Stop recording and flush the tail before the file is
+			// closed
+			blackbox_stop();
+			sendBlackbox();
+		}
+
 		switch (loggingData.Operation) {
 		case LOGGINGSTATS_OPERATION_FORMAT:
 			// Format the file system
@@ -342,6 +379,11 @@ static void loggingTask(void *parameters)
 					break;
 			}
 
+			if (blackbox_enabled) {
+				blackboxData.Sequence = 0;
+				blackbox_start(settings.BlackboxDivider);
+			}
+
 			// Empty the queue
 			LoggingStatsBytesLoggedSet(&written_bytes);
 			loggingData.Operation = LOGGINGSTATS_OPERATION_LOGGING;
@@ -349,7 +391,15 @@ static void loggingTask(void *parameters)
 			break;
 		case LOGGINGSTATS_OPERATION_LOGGING:
 			{
-				// Sleep between updating stats.
+				// Sleep between updating stats, keeping the
+				// blackbox stream moving meanwhile.
+				if (blackbox_enabled) {
+					while (PIOS_Thread_Systime() - now < LOGGING_PERIOD_MS) {
+						PIOS_Thread_Sleep(BLACKBOX_PERIOD_MS);
+						sendBlackbox();
+					}
+				}
+
 				PIOS_Thread_Sleep_Until(&now, LOGGING_PERIOD_MS);
 
 				LoggingStatsBytesLoggedSet(&written_bytes);
@@ -445,6 +495,29 @@ static void logSettings(UAVObjHandle obj)
 }
 
 
+/**
+ * Write what is in the blackbox ring to the log.  The chunks only ever hold
+ * whole frames, so if one is lost the decoder can pick up again at the
+ * next key frame.
+ */
+static void sendBlackbox()
+{
+	for (int i = 0; i < BLACKBOX_MAX_CHUNKS; i++) {
+		uint16_t len = blackbox_read(blackboxData.Data,
+				BLACKBOXDATA_DATA_NUMELEM);
+
+		if (!len) {
+			break;
+		}
+
+		blackboxData.Length = len;
+		blackboxData.Dropped = blackbox_dropped();
+		BlackboxDataSet(&blackboxData);
+
+		blackboxData.Sequence++;
+	}
+}
+
 /**
  * Forward data from UAVTalk out the serial port
  * \param[in] data Data buffer to send
@@ -489,6 +562,22 @@ static void obj_updated_callback(UAVObjEvent * ev, void* cb_ctx, void *uavo_data
 }
 
 
+/**
+ * @brief Callback that writes each blackbox chunk to the log
+ *
+ * Sending from the update callback, rather than straight from the logging
+ * task, takes the object manager lock before the UAVTalk connection lock,
+ * the same order as every other object that is logged.  The chunks are
+ * only set while there is something to write, including the tail that is
+ * flushed as logging stops.
+ */
+static void blackbox_updated_callback(UAVObjEvent * ev, void* cb_ctx, void *uavo_data, int uavo_len)
+{
+	(void) cb_ctx; (void) uavo_data; (void) uavo_len;
+
+	UAVTalkSendObjectTimestamped(uavTalkCon, ev->obj, ev->instId);
+}
+
 /**
  * Get the minimum logging period in milliseconds
 */
@@ -549,7 +638,8 @@ static void register_object(UAVObjHandle obj)
 	uint16_t period;
 
 	if (settings.Profile == LOGGINGSETTINGS_PROFILE_FULLBORE) {
-		if (UAVObjIsSettings(obj)) {
+		// The blackbox stream is written by the logging task itself
+		if (UAVObjIsSettings(obj) || obj == BlackboxDataHandle()) {
 			return;
 		}
 
@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * @addtogroup Modules Modules
+ * @{
+ * @addtogroup OnScreenDisplay Pixel OSD
+ * @{
+ *
+ * @brief Retained-mode widget layer for the OSD
+ * @file       osd_retained.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Retained-mode widget layer for the OSD
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef OSD_RETAINED_H
+#define OSD_RETAINED_H
+
+#include "osd_utils.h"
+
+// Widget ids are kept in 32 bit masks
+#define OSD_RETAINED_MAX_WIDGETS 32
+
+// What one video buffer currently shows
+struct osd_retained_slot {
+	const void *buffer;
+	bool valid;
+	uint32_t drawn;
+	uint32_t hash[OSD_RETAINED_MAX_WIDGETS];
+	struct osd_rect bbox[OSD_RETAINED_MAX_WIDGETS];
+};
+
+struct osd_retained {
+	uint8_t num_widgets;
+	uint8_t next_slot;
+	struct osd_retained_slot slots[2];
+	struct osd_retained_slot *slot;
+
+	// State of the frame being rendered
+	const void *buffer;
+	uint32_t enabled;
+	uint32_t dirty;
+	uint32_t redraw;
+	uint32_t hash[OSD_RETAINED_MAX_WIDGETS];
+	uint8_t num_drawn;
+	struct osd_rect drawn[OSD_RETAINED_MAX_WIDGETS];
+
+	// Widgets rendered / skipped in the last frame
+	uint8_t stat_rendered;
+	uint8_t stat_skipped;
+};
+
+void osd_retained_init(struct osd_retained *ret, uint8_t num_widgets);
+void osd_retained_invalidate(struct osd_retained *ret);
+void osd_retained_begin(struct osd_retained *ret, const void *buffer);
+void osd_retained_update(struct osd_retained *ret, uint8_t id, bool enabled,
+		const void *inputs, size_t len);
+void osd_retained_prepare(struct osd_retained *ret);
+bool osd_retained_draw_begin(struct osd_retained *ret, uint8_t id);
+void osd_retained_draw_end(struct osd_retained *ret, uint8_t id);
+void osd_retained_end(struct osd_retained *ret, const void *buffer);
+
+#endif /* OSD_RETAINED_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -164,7 +164,24 @@ typedef struct {
 	int16_t y;
 } point_t;
 
+// Inclusive pixel rectangle, empty when x0 > x1
+struct osd_rect {
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+};
+
+#define OSD_RECT_EMPTY(r)            ((r)->x0 > (r)->x1 || (r)->y0 > (r)->y1)
+#define OSD_RECT_INTERSECT(a, b)     (!OSD_RECT_EMPTY(a) && !OSD_RECT_EMPTY(b) && \
+				      (a)->x0 <= (b)->x1 && (b)->x0 <= (a)->x1 && \
+				      (a)->y0 <= (b)->y1 && (b)->y0 <= (a)->y1)
+
+const void *get_draw_buffer(void);
 void clearGraphics();
+void clear_rectangle(const struct osd_rect *rect);
+void track_extent_begin(void);
+void track_extent_end(struct osd_rect *rect);
 void draw_image(uint16_t x, uint16_t y, const struct Image * image);
 void plotFourQuadrants(int32_t centerX, int32_t centerY, int32_t deltaX, int32_t deltaY);
 void ellipse(int centerX, int centerY, int horizontalRadius, int verticalRadius);
@@ -104,6 +104,7 @@
 
 #include "osd_utils.h"
 #include "osd_menu.h"
+#include "osd_retained.h"
 #include "fonts.h"
 #include "WMMInternal.h"
 #include "mgrs.h"
@@ -631,7 +632,7 @@ void simple_artificial_horizon(float roll, float pitch, int16_t x, int16_t y,
 
 }
 
-void draw_flight_mode(int x, int y, int xs, int ys, int va, int ha, int flags, int font)
+const char *flight_mode_string(void)
 {
 	uint8_t mode;
 	FlightStatusFlightModeGet(&mode);
@@ -639,88 +640,65 @@ void draw_flight_mode(int x, int y, int xs, int ys, int va, int ha, int flags, i
 	switch (mode)
 	{
 	case FLIGHTSTATUS_FLIGHTMODE_MANUAL:
-		write_string("MAN", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "MAN";
 	case FLIGHTSTATUS_FLIGHTMODE_ACRO:
-		write_string("ACRO", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ACRO";
 	case FLIGHTSTATUS_FLIGHTMODE_ACROPLUS:
-		write_string("ACROPLUS", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ACROPLUS";
 	case FLIGHTSTATUS_FLIGHTMODE_ACRODYNE:
-		write_string("ACRODYNE", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ACRODYNE";
 	case FLIGHTSTATUS_FLIGHTMODE_LEVELING:
-		write_string("LEVEL", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "LEVEL";
 	case FLIGHTSTATUS_FLIGHTMODE_HORIZON:
-		write_string("HOR", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "HOR";
 	case FLIGHTSTATUS_FLIGHTMODE_AXISLOCK:
-		write_string("ALCK", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ALCK";
 	case FLIGHTSTATUS_FLIGHTMODE_VIRTUALBAR:
-		write_string("VBAR", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "VBAR";
 	case FLIGHTSTATUS_FLIGHTMODE_STABILIZED1:
-		write_string("ST1", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ST1";
 	case FLIGHTSTATUS_FLIGHTMODE_STABILIZED2:
-		write_string("ST2", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ST2";
 	case FLIGHTSTATUS_FLIGHTMODE_STABILIZED3:
-		write_string("ST3", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "ST3";
 	case FLIGHTSTATUS_FLIGHTMODE_AUTOTUNE:
-		write_string("TUNE", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "TUNE";
 	case FLIGHTSTATUS_FLIGHTMODE_ALTITUDEHOLD:
-		write_string("AHLD", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "AHLD";
 	case FLIGHTSTATUS_FLIGHTMODE_POSITIONHOLD:
-		write_string("PHLD", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "PHLD";
 	case FLIGHTSTATUS_FLIGHTMODE_RETURNTOHOME:
-		write_string("RTH", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "RTH";
 	case FLIGHTSTATUS_FLIGHTMODE_PATHPLANNER:
-		write_string("PLAN", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "PLAN";
 	case FLIGHTSTATUS_FLIGHTMODE_FAILSAFE:
-		write_string("FAILSAFE", x, y, xs, ys, va, ha, flags, font);
-		break;
+		return "FAILSAFE";
 	case FLIGHTSTATUS_FLIGHTMODE_TABLETCONTROL:
 		TabletInfoTabletModeDesiredGet(&mode);
 		switch (mode) {
 		case TABLETINFO_TABLETMODEDESIRED_POSITIONHOLD:
-			write_string("TAB PH", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB PH";
 		case TABLETINFO_TABLETMODEDESIRED_RETURNTOHOME:
-			write_string("TAB RTH", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB RTH";
 		case TABLETINFO_TABLETMODEDESIRED_RETURNTOTABLET:
-			write_string("TAB RTT", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB RTT";
 		case TABLETINFO_TABLETMODEDESIRED_PATHPLANNER:
-			write_string("TAB Path", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB Path";
 		case TABLETINFO_TABLETMODEDESIRED_FOLLOWME:
-			write_string("TAB FollowMe", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB FollowMe";
 		case TABLETINFO_TABLETMODEDESIRED_LAND:
-			write_string("TAB Land", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB Land";
 		case TABLETINFO_TABLETMODEDESIRED_CAMERAPOI:
-			write_string("TAB POI", x, y, xs, ys, va, ha, flags, font);
-			break;
+			return "TAB POI";
 		}
 		break;
 	}
+
+	return NULL;
 }
 
-void draw_alarms(int x, int y, int xs, int ys, int va, int ha, int flags, int font)
+int format_alarms(char *buf, int size)
 {
-	char buf[100]  = { 0 };
 	SystemAlarmsData alarm;
 	int pos = 0;
 
@@ -729,8 +707,8 @@ void draw_alarms(int x, int y, int xs, int ys, int va, int ha, int flags, int fo
 	// Boot alarm for a bit.
 	if (PIOS_Thread_Systime() < BOOT_DISPLAY_TIME_MS) {
 		const char *boot_reason = AlarmBootReason(alarm.RebootCause);
-		strncpy((char*)buf, boot_reason, sizeof(buf));
-		buf[sizeof(buf) - 2] = '\0';
+		strncpy(buf, boot_reason, size);
+		buf[size - 2] = '\0';
 		pos = strlen(buf);
 		buf[pos++] = ' ';
 	}
@@ -740,17 +718,16 @@ void draw_alarms(int x, int y, int xs, int ys, int va, int ha, int flags, int fo
 	// With the above arrangement, can pass a length of 1 to this if
 	// there's an impossibly long boot reason.
 	// which then does the right thing and just fills it with a null.
-	int32_t len = AlarmString(&alarm, buf + pos, sizeof(buf) - pos,
+	int32_t len = AlarmString(&alarm, buf + pos, size - pos,
 			blink, &state);
 
 	if (len > 0) {
 		pos += len;
 	}
 
-	if (pos > 0) {
-		buf[pos] = '\0';
-		write_string(buf, x, y, xs, ys, va, ha, flags, font);
-	}
+	buf[pos] = '\0';
+
+	return pos;
 }
 
 // map with home at center
@@ -1072,9 +1049,90 @@ void showVideoType(int16_t x, int16_t y)
 	}
 }
 
-void render_user_page(OnScreenDisplayPageSettingsData * page)
+/*
+ * The user pages are drawn as a set of widgets through the retained layer
+ * (osd_retained.c), so only widgets whose inputs changed are cleared and
+ * drawn again. hud_update_widgets() works out what every widget is going to
+ * show, hud_draw_widget() draws one widget from that state alone. Widgets
+ * are drawn in the order of this enum.
+ */
+enum hud_widget {
+	HUD_WIDGET_MAP,
+	HUD_WIDGET_ALARMS,
+	HUD_WIDGET_ALTITUDE_SCALE,
+	HUD_WIDGET_ALTITUDE_NUMERIC,
+	HUD_WIDGET_ARM_STATUS,
+	HUD_WIDGET_HORIZON,
+	HUD_WIDGET_BATTERY_VOLT,
+	HUD_WIDGET_BATTERY_CURRENT,
+	HUD_WIDGET_BATTERY_CONSUMED,
+	HUD_WIDGET_BATTERY_CHARGE,
+	HUD_WIDGET_CLIMB_RATE,
+	HUD_WIDGET_COMPASS,
+	HUD_WIDGET_CUSTOM_TEXT,
+	HUD_WIDGET_HOME_ARROW,
+	HUD_WIDGET_CPU,
+	HUD_WIDGET_FLIGHT_MODE,
+	HUD_WIDGET_GFORCE,
+	HUD_WIDGET_GPS_STATUS,
+	HUD_WIDGET_GPS_LAT,
+	HUD_WIDGET_GPS_LON,
+	HUD_WIDGET_GPS_MGRS,
+	HUD_WIDGET_HOME_DISTANCE,
+	HUD_WIDGET_RSSI,
+	HUD_WIDGET_SPEED_SCALE,
+	HUD_WIDGET_SPEED_NUMERIC,
+	HUD_WIDGET_TIME,
+	HUD_WIDGET_THROTTLE,
+	HUD_WIDGET_VTX_FREQ,
+	HUD_WIDGET_VTX_POWER,
+#ifdef DEBUG_TIMING
+	HUD_WIDGET_DEBUG_TIMING,
+#endif
+	HUD_WIDGET_NUM
+};
+
+#define HUD_TEXT_LEN 32
+
+// Everything a widget's drawing depends on, apart from the page settings
+union hud_widget_state {
+	char text[HUD_TEXT_LEN];
+	const char *label;
+	int value;
+	float angle;
+	uint8_t charge;
+	struct {
+		float roll;
+		float pitch;
+	} attitude;
+	struct {
+		int heading;
+		int home_dir;
+	} compass;
+	struct {
+		int value;
+		const char *label;
+	} scale;
+};
+
+static struct osd_retained hud_retained;
+static union hud_widget_state hud_state[HUD_WIDGET_NUM];
+static char hud_alarm_text[100];
+
+static void hud_update(enum hud_widget id, bool enabled, size_t len)
 {
-	char tmp_str[100] = { 0 };
+	osd_retained_update(&hud_retained, id, enabled, &hud_state[id], len);
+}
+
+static void hud_update_text(enum hud_widget id, bool enabled)
+{
+	osd_retained_update(&hud_retained, id, enabled, hud_state[id].text,
+			enabled ? strlen(hud_state[id].text) + 1 : 0);
+}
+
+static void hud_update_widgets(const OnScreenDisplayPageSettingsData *page)
+{
+	union hud_widget_state *st;
 	float tmp, tmp1;
 	float home_dist = -1.f;
 	int home_dir = -1;
@@ -1082,9 +1140,7 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 	int16_t tmp_int16;
 	uint32_t tmp_uint32;
 	int tmp_int1, tmp_int2;
-
-	if (page == NULL)
-		return;
+	bool enabled;
 
 	// Get home distance and direction (only makes sense if GPS is enabled
 	if (has_nav && (page->HomeDistance || page->CompassHomeDir) && PositionActualHandle() ) {
@@ -1099,168 +1155,162 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 			home_dir = (int)(atan2f(tmp1, tmp) * RAD2DEG) + 180;
 	}
 
-	// Draw Map
-	if (has_nav && page->Map && PositionActualHandle() ) {
-		if (page->MapCenterMode == ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_UAV) {
-			draw_map_uav_center(page->MapWidthPixels, page->MapHeightPixels,
-					page->MapWidthMeters, page->MapHeightMeters,
-					page->MapShowWp, page->MapShowUavHome,
-					page->MapShowTablet);
-
-		} else {
-			draw_map_home_center(page->MapWidthPixels, page->MapHeightPixels,
-					page->MapWidthMeters, page->MapHeightMeters,
-					page->MapShowWp, page->MapShowUavHome,
-					page->MapShowTablet);
-		}
-	}
+	// Map; it reads a lot of objects itself, so it is drawn on every frame
+	osd_retained_update(&hud_retained, HUD_WIDGET_MAP,
+			has_nav && page->Map && PositionActualHandle(), NULL, 0);
 
 	// Alarms
-	if (page->Alarm) {
-		draw_alarms((int)page->AlarmPosX, (int)page->AlarmPosY, 0, 0, TEXT_VA_TOP, (int)page->AlarmAlign, 0,
-				page->AlarmFont);
-	}
+	enabled = page->Alarm && format_alarms(hud_alarm_text, sizeof(hud_alarm_text)) > 0;
+	osd_retained_update(&hud_retained, HUD_WIDGET_ALARMS, enabled,
+			hud_alarm_text, enabled ? strlen(hud_alarm_text) + 1 : 0);
 
 	// Altitude Scale
+	st = &hud_state[HUD_WIDGET_ALTITUDE_SCALE];
+	enabled = false;
 	if (page->AltitudeScale) {
-		bool valid_altitude = false;
 		if (page->AltitudeScaleSource == ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALESOURCE_BARO) {
 			if (has_baro){
 				BaroAltitudeAltitudeGet(&tmp);
 				tmp -= home_baro_altitude;
-				valid_altitude = true;
+				enabled = true;
 			}
 		} else if (PositionActualHandle()) {
 			PositionActualDownGet(&tmp);
 			tmp *= -1.0f;
-			valid_altitude = true;
-		}
-		if (valid_altitude) {
-			if (page->AltitudeScaleAlign == ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_LEFT)
-				hud_draw_vertical_scale(tmp * convert_distance, 100, -1, page->AltitudeScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8,
-						11, 10000, 0);
-			else
-				hud_draw_vertical_scale(tmp * convert_distance, 100, 1, page->AltitudeScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8,
-						11, 10000, 0);
+			enabled = true;
 		}
+		if (enabled)
+			st->value = tmp * convert_distance;
 	}
+	hud_update(HUD_WIDGET_ALTITUDE_SCALE, enabled, sizeof(st->value));
 
 	// Altitude Numeric
+	st = &hud_state[HUD_WIDGET_ALTITUDE_NUMERIC];
+	enabled = false;
 	if (page->AltitudeNumeric) {
-		bool valid_altitude = false;
 		if (page->AltitudeNumericSource == ONSCREENDISPLAYPAGESETTINGS_ALTITUDENUMERICSOURCE_BARO) {
 			if (has_baro) {
 				BaroAltitudeAltitudeGet(&tmp);
 				tmp -= home_baro_altitude;
-				valid_altitude = true;
+				enabled = true;
 			}
 		} else if (PositionActualHandle()) {
 			PositionActualDownGet(&tmp);
 			tmp *= -1.0f;
-			valid_altitude = true;
-		}
-		if (valid_altitude) {
-			sprintf(tmp_str, "%d", (int)(tmp * convert_distance));
-			write_string(tmp_str, page->AltitudeNumericPosX, page->AltitudeNumericPosY, 0, 0, TEXT_VA_TOP, (int)page->AltitudeNumericAlign,
-					0, page->AltitudeNumericFont);
+			enabled = true;
 		}
+		if (enabled)
+			snprintf(st->text, HUD_TEXT_LEN, "%d", (int)(tmp * convert_distance));
 	}
+	hud_update_text(HUD_WIDGET_ALTITUDE_NUMERIC, enabled);
 
 	// Arming Status
+	enabled = false;
 	if (page->ArmStatus) {
 		FlightStatusArmedGet(&tmp_uint8);
-		if (tmp_uint8 != FLIGHTSTATUS_ARMED_DISARMED)
-			write_string("ARMED", page->ArmStatusPosX, page->ArmStatusPosY, 0, 0, TEXT_VA_TOP, (int)page->ArmStatusAlign, 0,
-					page->ArmStatusFont);
+		enabled = tmp_uint8 != FLIGHTSTATUS_ARMED_DISARMED;
 	}
+	hud_update(HUD_WIDGET_ARM_STATUS, enabled, 0);
 
 	// Artificial Horizon (and centermark)
-	if (page->ArtificialHorizon || page->CenterMark) {
-		AttitudeActualRollGet(&tmp);
-		AttitudeActualPitchGet(&tmp1);
-		simple_artificial_horizon(tmp, tmp1, GRAPHICS_X_MIDDLE, GRAPHICS_Y_MIDDLE, GRAPHICS_BOTTOM * 0.8f, GRAPHICS_RIGHT * 0.8f,
-				page->ArtificialHorizonMaxPitch, page->ArtificialHorizonPitchSteps, page->ArtificialHorizon, page->CenterMark);
+	st = &hud_state[HUD_WIDGET_HORIZON];
+	enabled = page->ArtificialHorizon || page->CenterMark;
+	if (enabled) {
+		AttitudeActualRollGet(&st->attitude.roll);
+		AttitudeActualPitchGet(&st->attitude.pitch);
 	}
+	hud_update(HUD_WIDGET_HORIZON, enabled, sizeof(st->attitude));
 
 	// Battery
-	if (has_battery && FlightBatteryStateHandle()) {
-		if (page->BatteryVolt) {
-			FlightBatteryStateVoltageGet(&tmp);
-			sprintf(tmp_str, "%0.1fV", (double)tmp);
-			write_string(tmp_str, page->BatteryVoltPosX, page->BatteryVoltPosY, 0, 0, TEXT_VA_TOP, (int)page->BatteryVoltAlign, 0,
-					page->BatteryVoltFont);
-		}
-		if (page->BatteryCurrent) {
-			FlightBatteryStateCurrentGet(&tmp);
-			sprintf(tmp_str, "%0.1fA", (double)tmp);
-			write_string(tmp_str, page->BatteryCurrentPosX, page->BatteryCurrentPosY, 0, 0, TEXT_VA_TOP,
-					(int)page->BatteryCurrentAlign, 0, page->BatteryCurrentFont);
-		}
-		if (page->BatteryConsumed) {
-			FlightBatteryStateConsumedEnergyGet(&tmp);
-			sprintf(tmp_str, "%0.0fmAh", (double)tmp);
-			write_string(tmp_str, page->BatteryConsumedPosX, page->BatteryConsumedPosY, 0, 0, TEXT_VA_TOP,
-					(int)page->BatteryConsumedAlign, 0, page->BatteryConsumedFont);
-		}
+	enabled = has_battery && FlightBatteryStateHandle();
 
-		if (page->BatteryChargeState) {
-			FlightBatteryStateConsumedEnergyGet(&tmp);
-			FlightBatterySettingsCapacityGet(&tmp_uint32);
-			drawBattery(page->BatteryChargeStatePosX, page->BatteryChargeStatePosY, 100 - 100 * tmp / tmp_uint32, 24);
-		}
+	st = &hud_state[HUD_WIDGET_BATTERY_VOLT];
+	if (enabled && page->BatteryVolt) {
+		FlightBatteryStateVoltageGet(&tmp);
+		snprintf(st->text, HUD_TEXT_LEN, "%0.1fV", (double)tmp);
+	}
+	hud_update_text(HUD_WIDGET_BATTERY_VOLT, enabled && page->BatteryVolt);
+
+	st = &hud_state[HUD_WIDGET_BATTERY_CURRENT];
+	if (enabled && page->BatteryCurrent) {
+		FlightBatteryStateCurrentGet(&tmp);
+		snprintf(st->text, HUD_TEXT_LEN, "%0.1fA", (double)tmp);
+	}
+	hud_update_text(HUD_WIDGET_BATTERY_CURRENT, enabled && page->BatteryCurrent);
+
+	st = &hud_state[HUD_WIDGET_BATTERY_CONSUMED];
+	if (enabled && page->BatteryConsumed) {
+		FlightBatteryStateConsumedEnergyGet(&tmp);
+		snprintf(st->text, HUD_TEXT_LEN, "%0.0fmAh", (double)tmp);
+	}
+	hud_update_text(HUD_WIDGET_BATTERY_CONSUMED, enabled && page->BatteryConsumed);
+
+	st = &hud_state[HUD_WIDGET_BATTERY_CHARGE];
+	if (enabled && page->BatteryChargeState) {
+		FlightBatteryStateConsumedEnergyGet(&tmp);
+		FlightBatterySettingsCapacityGet(&tmp_uint32);
+		st->charge = 100 - 100 * tmp / tmp_uint32;
 	}
+	hud_update(HUD_WIDGET_BATTERY_CHARGE, enabled && page->BatteryChargeState,
+			sizeof(st->charge));
 
 	// Climb rate
-	if (page->ClimbRate && VelocityActualHandle() && has_baro) {
+	st = &hud_state[HUD_WIDGET_CLIMB_RATE];
+	enabled = page->ClimbRate && VelocityActualHandle() && has_baro;
+	if (enabled) {
 		VelocityActualDownGet(&tmp);
-		sprintf(tmp_str, "%0.1f", (double)(-1.f * convert_distance * tmp));
-		write_string(tmp_str, page->ClimbRatePosX, page->ClimbRatePosY, 0, 0, TEXT_VA_TOP, (int)page->ClimbRateAlign, 0,
-				page->ClimbRateFont);
+		snprintf(st->text, HUD_TEXT_LEN, "%0.1f", (double)(-1.f * convert_distance * tmp));
 	}
+	hud_update_text(HUD_WIDGET_CLIMB_RATE, enabled);
 
 	// Compass
-	if (page->Compass && has_mag) {
+	st = &hud_state[HUD_WIDGET_COMPASS];
+	enabled = page->Compass && has_mag;
+	if (enabled) {
 		AttitudeActualYawGet(&tmp);
 		if (tmp < 0)
 			tmp += 360;
-		if (page->CompassHomeDir) {
-			hud_draw_linear_compass(tmp, home_dir, 120, 180, GRAPHICS_X_MIDDLE, (int)page->CompassPos, 15, 30, 5, 8, 0);
-		} else {
-			hud_draw_linear_compass(tmp, -1, 120, 180, GRAPHICS_X_MIDDLE, (int)page->CompassPos, 15, 30, 5, 8, 0);
-		}
+		st->compass.heading = tmp;
+		st->compass.home_dir = page->CompassHomeDir ? home_dir : -1;
 	}
+	hud_update(HUD_WIDGET_COMPASS, enabled, sizeof(st->compass));
 
 	// Custom text
+	st = &hud_state[HUD_WIDGET_CUSTOM_TEXT];
 	if (page->CustomText) {
-		memcpy((void *)tmp_str, (void *)(osd_settings.CustomText), ONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM);
-		tmp_str[ONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM] = 0;
-		write_string(tmp_str, page->CustomTextPosX, page->CustomTextPosY, 0, 0, TEXT_VA_TOP, (int)page->CustomTextAlign, 0,
-				page->CustomTextFont);
+		memcpy((void *)st->text, (void *)(osd_settings.CustomText), ONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM);
+		st->text[ONSCREENDISPLAYSETTINGS_CUSTOMTEXT_NUMELEM] = 0;
 	}
+	hud_update_text(HUD_WIDGET_CUSTOM_TEXT, page->CustomText);
 
 	// Home arrow
-	if (has_nav && page->HomeArrow) {
-		if (!page->Compass) {
-			AttitudeActualYawGet(&tmp);
-		}
-		tmp = fmodf(home_dir -tmp, 360.f);
-		draw_polygon(page->HomeArrowPosX, page->HomeArrowPosY, tmp, HOME_ARROW, NELEMENTS(HOME_ARROW), 0, 1);
+	st = &hud_state[HUD_WIDGET_HOME_ARROW];
+	enabled = has_nav && page->HomeArrow;
+	if (enabled) {
+		AttitudeActualYawGet(&tmp);
+		st->angle = fmodf(home_dir - tmp, 360.f);
 	}
+	hud_update(HUD_WIDGET_HOME_ARROW, enabled, sizeof(st->angle));
 
 	// CPU utilization
+	st = &hud_state[HUD_WIDGET_CPU];
 	if (page->Cpu) {
 		SystemStatsCPULoadGet(&tmp_uint8);
-		sprintf(tmp_str, "CPU:%2d", tmp_uint8);
-		write_string(tmp_str, page->CpuPosX, page->CpuPosY, 0, 0, TEXT_VA_TOP, (int)page->CpuAlign, 0, page->CpuFont);
+		snprintf(st->text, HUD_TEXT_LEN, "CPU:%2d", tmp_uint8);
 	}
+	hud_update_text(HUD_WIDGET_CPU, page->Cpu);
 
 	// Flight mode
+	st = &hud_state[HUD_WIDGET_FLIGHT_MODE];
+	enabled = false;
 	if (page->FlightMode) {
-		draw_flight_mode(page->FlightModePosX, page->FlightModePosY, 0, 0, TEXT_VA_TOP, (int)page->FlightModeAlign, 0,
-				page->FlightModeFont);
+		st->label = flight_mode_string();
+		enabled = st->label != NULL;
 	}
+	hud_update(HUD_WIDGET_FLIGHT_MODE, enabled, sizeof(st->label));
 
 	// G Force
+	st = &hud_state[HUD_WIDGET_GFORCE];
 	if (page->GForce) {
 		AccelsData accelsData;
 		AccelsGet(&accelsData);
@@ -1272,102 +1322,96 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 		accelsDataAcc.z = 0.8f * accelsDataAcc.z + 0.2f * accelsData.z;
 
 		tmp = sqrtf(powf(accelsDataAcc.x, 2.f) + powf(accelsDataAcc.y, 2.f) + powf(accelsDataAcc.z, 2.f)) / 9.81f;
-		sprintf(tmp_str, "%0.1fG", (double)tmp);
-		write_string(tmp_str, page->GForcePosX, page->GForcePosY, 0, 0, TEXT_VA_TOP, (int)page->GForceAlign, 0,
-				page->GForceFont);
+		snprintf(st->text, HUD_TEXT_LEN, "%0.1fG", (double)tmp);
 	}
+	hud_update_text(HUD_WIDGET_GFORCE, page->GForce);
 
 	// GPS
-	if (has_gps && (page->GpsStatus || page->GpsLat || page->GpsLon || page->GpsMgrs)) {
+	enabled = has_gps && (page->GpsStatus || page->GpsLat || page->GpsLon || page->GpsMgrs);
+	if (enabled) {
 		GPSPositionData gps_data;
 		GPSPositionGet(&gps_data);
 
-		draw_image(page->GpsStatusPosX, page->GpsStatusPosY - image_gps.height / 2, &image_gps);
-
 		uint8_t pdop_1 = gps_data.PDOP;
 		uint8_t pdop_2 = roundf(10 * (gps_data.PDOP - pdop_1));
 
+		// The GPS icon is part of the status widget and always shown
+		st = &hud_state[HUD_WIDGET_GPS_STATUS];
+		st->text[0] = 0;
 		if (page->GpsStatus) {
 			switch (gps_data.Status)
 			{
 			case GPSPOSITION_STATUS_NOFIX:
-				sprintf(tmp_str, "NO");
+				snprintf(st->text, HUD_TEXT_LEN, "NO");
 				break;
 			case GPSPOSITION_STATUS_FIX2D:
-				sprintf(tmp_str, "2D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
+				snprintf(st->text, HUD_TEXT_LEN, "2D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
 				break;
 			case GPSPOSITION_STATUS_FIX3D:
-				sprintf(tmp_str, "3D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
+				snprintf(st->text, HUD_TEXT_LEN, "3D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
 				break;
 			case GPSPOSITION_STATUS_DIFF3D:
-				sprintf(tmp_str, "3D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
+				snprintf(st->text, HUD_TEXT_LEN, "3D %d %d.%d", (int)gps_data.Satellites, (int)pdop_1, pdop_2);
 				break;
 			default:
-				sprintf(tmp_str, "NOGPS");
+				snprintf(st->text, HUD_TEXT_LEN, "NOGPS");
 			}
-			write_string(tmp_str, page->GpsStatusPosX + image_gps.width -4, page->GpsStatusPosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT,
-					0, page->GpsStatusFont);
 		}
 
 		if (page->GpsLat) {
-			sprintf(tmp_str, "%0.5f", (double)gps_data.Latitude / 10000000.0);
-			write_string(tmp_str, page->GpsLatPosX, page->GpsLatPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsLatAlign, 0,
-					page->GpsLatFont);
+			snprintf(hud_state[HUD_WIDGET_GPS_LAT].text, HUD_TEXT_LEN, "%0.5f",
+					(double)gps_data.Latitude / 10000000.0);
 		}
 
 		if (page->GpsLon) {
-			sprintf(tmp_str, "%0.5f", (double)gps_data.Longitude / 10000000.0);
-			write_string(tmp_str, page->GpsLonPosX, page->GpsLonPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsLonAlign, 0,
-					page->GpsLonFont);
+			snprintf(hud_state[HUD_WIDGET_GPS_LON].text, HUD_TEXT_LEN, "%0.5f",
+					(double)gps_data.Longitude / 10000000.0);
 		}
 
 		// MGRS location
-		if (page->GpsMgrs) {
-			static char mgrs_str[20] = {0};
-
-			if (frame_counter % 5 == 0) {
-				// the conversion to MGRS is computationally expensive, so we update it a bit slower
-				tmp_int1 = Convert_Geodetic_To_MGRS((double)gps_data.Latitude * (double)DEG2RAD / 10000000.0,
-								(double)gps_data.Longitude * (double)DEG2RAD / 10000000.0, 5, mgrs_str);
-				if (tmp_int1 != 0)
-					sprintf(mgrs_str, "MGRS ERR: %d", tmp_int1);
-			}
-			write_string(mgrs_str, page->GpsMgrsPosX, page->GpsMgrsPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsMgrsAlign, 0,
-					page->GpsMgrsFont);
+		if (page->GpsMgrs && frame_counter % 5 == 0) {
+			char *mgrs_str = hud_state[HUD_WIDGET_GPS_MGRS].text;
+
+			// the conversion to MGRS is computationally expensive, so we update it a bit slower
+			tmp_int1 = Convert_Geodetic_To_MGRS((double)gps_data.Latitude * (double)DEG2RAD / 10000000.0,
+							(double)gps_data.Longitude * (double)DEG2RAD / 10000000.0, 5, mgrs_str);
+			if (tmp_int1 != 0)
+				snprintf(mgrs_str, HUD_TEXT_LEN, "MGRS ERR: %d", tmp_int1);
 		}
 	}
+	hud_update_text(HUD_WIDGET_GPS_STATUS, enabled);
+	hud_update_text(HUD_WIDGET_GPS_LAT, enabled && page->GpsLat);
+	hud_update_text(HUD_WIDGET_GPS_LON, enabled && page->GpsLon);
+	hud_update_text(HUD_WIDGET_GPS_MGRS, enabled && page->GpsMgrs);
 
 	// Home distance (will be -1 if enabled but GPS is not enabled)
+	st = &hud_state[HUD_WIDGET_HOME_DISTANCE];
 	if (home_dist >= 0) {
 		if (home_dist < convert_distance_divider)
-			sprintf(tmp_str, "%d%s", (int) home_dist, dist_unit_short);
+			snprintf(st->text, HUD_TEXT_LEN, "%d%s", (int) home_dist, dist_unit_short);
 		else {
-			sprintf(tmp_str, "%0.2f%s", (double)(home_dist / convert_distance_divider), dist_unit_long);
-		}
-		if (page->HomeDistanceShowIcon) {
-			draw_image(page->HomeDistancePosX, page->HomeDistancePosY - image_home.height / 2, &image_home);
+			snprintf(st->text, HUD_TEXT_LEN, "%0.2f%s", (double)(home_dist / convert_distance_divider), dist_unit_long);
 		}
-		write_string(tmp_str, page->HomeDistancePosX + image_home.width - 4, page->HomeDistancePosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT,
-				0, page->HomeDistanceFont);
 	}
+	hud_update_text(HUD_WIDGET_HOME_DISTANCE, home_dist >= 0);
 
 	// RSSI
+	st = &hud_state[HUD_WIDGET_RSSI];
+	enabled = false;
 	if (page->Rssi) {
 		ManualControlCommandRssiGet(&tmp_int16);
 		if (tmp_int16 > osd_settings.RssiWarnThreshold || blink) {
-			sprintf(tmp_str, "%3d", tmp_int16);
-			if (page->RssiShowIcon) { // XXX rename
-				draw_image(page->RssiPosX, page->RssiPosY - image_rssi.height / 2, &image_rssi);
-			}
-			write_string(tmp_str, page->RssiPosX + image_rssi.width - 4, page->RssiPosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0,
-					page->RssiFont);
+			snprintf(st->text, HUD_TEXT_LEN, "%3d", tmp_int16);
+			enabled = true;
 		}
 	}
+	hud_update_text(HUD_WIDGET_RSSI, enabled);
 
 	// Speed Scale
+	st = &hud_state[HUD_WIDGET_SPEED_SCALE];
+	enabled = false;
 	if (page->SpeedScale) {
 		tmp = 0.f;
-		bool speed_valid = false;
 		switch (page->SpeedScaleSource)
 		{
 			case ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_NAV:
@@ -1375,50 +1419,43 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 					VelocityActualNorthGet(&tmp);
 					VelocityActualEastGet(&tmp1);
 					tmp = sqrt(tmp * tmp + tmp1 * tmp1);
-					speed_valid = true;
+					enabled = true;
 				}
-				sprintf(tmp_str, "%s", "GND");
+				st->scale.label = "GND";
 				break;
 			case ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_GPS:
 				if (GPSVelocityHandle()) {
 					GPSVelocityNorthGet(&tmp);
 					GPSVelocityEastGet(&tmp1);
 					tmp = sqrt(tmp * tmp + tmp1 * tmp1);
-					speed_valid = has_gps;
+					enabled = has_gps;
 				}
-				sprintf(tmp_str, "%s", "GND");
+				st->scale.label = "GND";
 				break;
 			case ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALESOURCE_AIRSPEED:
 				if (AirspeedActualHandle()) {
 					AirspeedActualTrueAirspeedGet(&tmp);
-					speed_valid = true;
+					enabled = true;
 				}
-				sprintf(tmp_str, "%s", "AIR");
-		}
-		if (speed_valid){
-			if (page->SpeedScaleAlign == ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_LEFT) {
-				hud_draw_vertical_scale(tmp * convert_speed, 30, -1,  page->SpeedScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8, 11,
-						100, 0);
-				write_string(tmp_str, page->SpeedScalePos + 10, 200, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, FONT_OUTLINED8X8);
-			} else {
-				hud_draw_vertical_scale(tmp * convert_speed, 30, 1,  page->SpeedScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8, 11, 100,
-						0);
-				write_string(tmp_str, page->SpeedScalePos - 30, 200, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, FONT_OUTLINED8X8);
-			}
+				st->scale.label = "AIR";
 		}
+		st->scale.value = tmp * convert_speed;
 	}
+	hud_update(HUD_WIDGET_SPEED_SCALE, enabled, sizeof(st->scale));
 
 	// Speed Numeric
+	st = &hud_state[HUD_WIDGET_SPEED_NUMERIC];
+	enabled = false;
 	if (page->SpeedNumeric) {
 		tmp = 0.f;
-		bool speed_valid = false;
+		tmp1 = 0.f;
 		switch (page->SpeedNumericSource)
 		{
 			case ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_NAV:
 				if (VelocityActualHandle()) {
 					VelocityActualNorthGet(&tmp);
 					VelocityActualEastGet(&tmp1);
-					speed_valid = true;
+					enabled = true;
 				}
 				tmp = sqrt(tmp * tmp + tmp1 * tmp1);
 				break;
@@ -1427,23 +1464,23 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 					GPSVelocityNorthGet(&tmp);
 					GPSVelocityEastGet(&tmp1);
 					tmp = sqrt(tmp * tmp + tmp1 * tmp1);
-					speed_valid = has_gps;
+					enabled = has_gps;
 				}
 				break;
 			case ONSCREENDISPLAYPAGESETTINGS_SPEEDNUMERICSOURCE_AIRSPEED:
 				if (AirspeedActualHandle()) {
 					AirspeedActualTrueAirspeedGet(&tmp);
-					speed_valid = true;
+					enabled = true;
 				}
 		}
-		if (speed_valid) {
-			sprintf(tmp_str, "%d", (int)(tmp * convert_speed));
-			write_string(tmp_str, page->SpeedNumericPosX, page->SpeedNumericPosY, 0, 0, (int)page->SpeedNumericAlign, TEXT_HA_LEFT, 0,
-					page->SpeedNumericFont);
+		if (enabled) {
+			snprintf(st->text, HUD_TEXT_LEN, "%d", (int)(tmp * convert_speed));
 		}
 	}
+	hud_update_text(HUD_WIDGET_SPEED_NUMERIC, enabled);
 
 	// Time
+	st = &hud_state[HUD_WIDGET_TIME];
 	if (page->Time) {
 		uint32_t time;
 		SystemStatsFlightTimeGet(&time);
@@ -1452,57 +1489,246 @@ void render_user_page(OnScreenDisplayPageSettingsData * page)
 		if (tmp_int16 == 0) {
 			tmp_int1 = time / 60000; // minutes
 			tmp_int2 = (time / 1000) - 60 * tmp_int1; // seconds
-			sprintf(tmp_str, "%02d:%02d", (int)tmp_int1, (int)tmp_int2);
+			snprintf(st->text, HUD_TEXT_LEN, "%02d:%02d", (int)tmp_int1, (int)tmp_int2);
 		} else {
 			tmp_int1 = time / 60000 - 60 * tmp_int16; // minutes
 			tmp_int2 = (time / 1000) - 60 * tmp_int1 - 3600 * tmp_int16; // seconds
-			sprintf(tmp_str, "%02d:%02d:%02d", (int)tmp_int16, (int)tmp_int1, (int)tmp_int2);
+			snprintf(st->text, HUD_TEXT_LEN, "%02d:%02d:%02d", (int)tmp_int16, (int)tmp_int1, (int)tmp_int2);
 		}
-		write_string(tmp_str, page->TimePosX, page->TimePosY, 0, 0, TEXT_VA_TOP, (int)page->TimeAlign, 0, page->TimeFont);
 	}
+	hud_update_text(HUD_WIDGET_TIME, page->Time);
 
 	// Throttle
+	st = &hud_state[HUD_WIDGET_THROTTLE];
 	if (page->Throttle) {
 		ManualControlCommandThrottleGet(&tmp);
 		if (tmp < 0) {
 			tmp = 0;
 		}
 
-		sprintf(tmp_str, "%d", (int)(100 * tmp + 0.5f));
-
-		write_string(tmp_str, page->ThrottlePosX, page->ThrottlePosY, 0, 0, TEXT_VA_TOP, (int)page->ThrottleAlign, 0,
-				page->ThrottleFont);
+		snprintf(st->text, HUD_TEXT_LEN, "%d", (int)(100 * tmp + 0.5f));
 	}
+	hud_update_text(HUD_WIDGET_THROTTLE, page->Throttle);
 
 	// Video Transmitter Frequency
-	if (page->VTXFreq && VTXInfoHandle()) {
+	st = &hud_state[HUD_WIDGET_VTX_FREQ];
+	enabled = page->VTXFreq && VTXInfoHandle();
+	if (enabled) {
 		uint16_t freq;
 		VTXInfoFrequencyGet(&freq);
 		if (page->VTXFreqShowUnit) {
-			sprintf(tmp_str, "%dMHz", freq);
+			snprintf(st->text, HUD_TEXT_LEN, "%dMHz", freq);
 		}
 		else {
-			sprintf(tmp_str, "%d", freq);
+			snprintf(st->text, HUD_TEXT_LEN, "%d", freq);
 		}
-		write_string(tmp_str, page->VTXFreqPosX, page->VTXFreqPosY, 0, 0, TEXT_VA_TOP, (int)page->VTXFreqAlign, 0,
-				page->VTXFreqFont);
 	}
+	hud_update_text(HUD_WIDGET_VTX_FREQ, enabled);
 
 	// Video Transmitter Power
-	if (page->VTXPower && VTXInfoHandle()) {
+	st = &hud_state[HUD_WIDGET_VTX_POWER];
+	enabled = page->VTXPower && VTXInfoHandle();
+	if (enabled) {
 		uint16_t power;
 		VTXInfoPowerGet(&power);
 		if (page->VTXPowerShowUnit) {
-			sprintf(tmp_str, "%dmW", power);
+			snprintf(st->text, HUD_TEXT_LEN, "%dmW", power);
 		}
 		else {
-			sprintf(tmp_str, "%d", power);
+			snprintf(st->text, HUD_TEXT_LEN, "%d", power);
+		}
+	}
+	hud_update_text(HUD_WIDGET_VTX_POWER, enabled);
+
+#ifdef DEBUG_TIMING
+	// Timing of the previous frame and widgets drawn / skipped
+	snprintf(hud_state[HUD_WIDGET_DEBUG_TIMING].text, HUD_TEXT_LEN, "%03d %03d %d/%d",
+			(int)in_time, (int)out_time, hud_retained.stat_rendered, hud_retained.stat_skipped);
+	hud_update_text(HUD_WIDGET_DEBUG_TIMING, true);
+#endif
+}
+
+static void hud_draw_widget(const OnScreenDisplayPageSettingsData *page, enum hud_widget id)
+{
+	const union hud_widget_state *st = &hud_state[id];
+
+	switch (id) {
+	case HUD_WIDGET_MAP:
+		if (page->MapCenterMode == ONSCREENDISPLAYPAGESETTINGS_MAPCENTERMODE_UAV) {
+			draw_map_uav_center(page->MapWidthPixels, page->MapHeightPixels,
+					page->MapWidthMeters, page->MapHeightMeters,
+					page->MapShowWp, page->MapShowUavHome,
+					page->MapShowTablet);
+
+		} else {
+			draw_map_home_center(page->MapWidthPixels, page->MapHeightPixels,
+					page->MapWidthMeters, page->MapHeightMeters,
+					page->MapShowWp, page->MapShowUavHome,
+					page->MapShowTablet);
 		}
-		write_string(tmp_str, page->VTXPowerPosX, page->VTXPowerPosY, 0, 0, TEXT_VA_TOP, (int)page->VTXPowerAlign, 0,
+		break;
+	case HUD_WIDGET_ALARMS:
+		write_string(hud_alarm_text, (int)page->AlarmPosX, (int)page->AlarmPosY, 0, 0, TEXT_VA_TOP, (int)page->AlarmAlign, 0,
+				page->AlarmFont);
+		break;
+	case HUD_WIDGET_ALTITUDE_SCALE:
+		if (page->AltitudeScaleAlign == ONSCREENDISPLAYPAGESETTINGS_ALTITUDESCALEALIGN_LEFT)
+			hud_draw_vertical_scale(st->value, 100, -1, page->AltitudeScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8,
+					11, 10000, 0);
+		else
+			hud_draw_vertical_scale(st->value, 100, 1, page->AltitudeScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8,
+					11, 10000, 0);
+		break;
+	case HUD_WIDGET_ALTITUDE_NUMERIC:
+		write_string((char *)st->text, page->AltitudeNumericPosX, page->AltitudeNumericPosY, 0, 0, TEXT_VA_TOP, (int)page->AltitudeNumericAlign,
+				0, page->AltitudeNumericFont);
+		break;
+	case HUD_WIDGET_ARM_STATUS:
+		write_string("ARMED", page->ArmStatusPosX, page->ArmStatusPosY, 0, 0, TEXT_VA_TOP, (int)page->ArmStatusAlign, 0,
+				page->ArmStatusFont);
+		break;
+	case HUD_WIDGET_HORIZON:
+		simple_artificial_horizon(st->attitude.roll, st->attitude.pitch, GRAPHICS_X_MIDDLE, GRAPHICS_Y_MIDDLE, GRAPHICS_BOTTOM * 0.8f, GRAPHICS_RIGHT * 0.8f,
+				page->ArtificialHorizonMaxPitch, page->ArtificialHorizonPitchSteps, page->ArtificialHorizon, page->CenterMark);
+		break;
+	case HUD_WIDGET_BATTERY_VOLT:
+		write_string((char *)st->text, page->BatteryVoltPosX, page->BatteryVoltPosY, 0, 0, TEXT_VA_TOP, (int)page->BatteryVoltAlign, 0,
+				page->BatteryVoltFont);
+		break;
+	case HUD_WIDGET_BATTERY_CURRENT:
+		write_string((char *)st->text, page->BatteryCurrentPosX, page->BatteryCurrentPosY, 0, 0, TEXT_VA_TOP,
+				(int)page->BatteryCurrentAlign, 0, page->BatteryCurrentFont);
+		break;
+	case HUD_WIDGET_BATTERY_CONSUMED:
+		write_string((char *)st->text, page->BatteryConsumedPosX, page->BatteryConsumedPosY, 0, 0, TEXT_VA_TOP,
+				(int)page->BatteryConsumedAlign, 0, page->BatteryConsumedFont);
+		break;
+	case HUD_WIDGET_BATTERY_CHARGE:
+		drawBattery(page->BatteryChargeStatePosX, page->BatteryChargeStatePosY, st->charge, 24);
+		break;
+	case HUD_WIDGET_CLIMB_RATE:
+		write_string((char *)st->text, page->ClimbRatePosX, page->ClimbRatePosY, 0, 0, TEXT_VA_TOP, (int)page->ClimbRateAlign, 0,
+				page->ClimbRateFont);
+		break;
+	case HUD_WIDGET_COMPASS:
+		hud_draw_linear_compass(st->compass.heading, st->compass.home_dir, 120, 180, GRAPHICS_X_MIDDLE, (int)page->CompassPos, 15, 30, 5, 8, 0);
+		break;
+	case HUD_WIDGET_CUSTOM_TEXT:
+		write_string((char *)st->text, page->CustomTextPosX, page->CustomTextPosY, 0, 0, TEXT_VA_TOP, (int)page->CustomTextAlign, 0,
+				page->CustomTextFont);
+		break;
+	case HUD_WIDGET_HOME_ARROW:
+		draw_polygon(page->HomeArrowPosX, page->HomeArrowPosY, st->angle, HOME_ARROW, NELEMENTS(HOME_ARROW), 0, 1);
+		break;
+	case HUD_WIDGET_CPU:
+		write_string((char *)st->text, page->CpuPosX, page->CpuPosY, 0, 0, TEXT_VA_TOP, (int)page->CpuAlign, 0, page->CpuFont);
+		break;
+	case HUD_WIDGET_FLIGHT_MODE:
+		write_string((char *)st->label, page->FlightModePosX, page->FlightModePosY, 0, 0, TEXT_VA_TOP, (int)page->FlightModeAlign, 0,
+				page->FlightModeFont);
+		break;
+	case HUD_WIDGET_GFORCE:
+		write_string((char *)st->text, page->GForcePosX, page->GForcePosY, 0, 0, TEXT_VA_TOP, (int)page->GForceAlign, 0,
+				page->GForceFont);
+		break;
+	case HUD_WIDGET_GPS_STATUS:
+		draw_image(page->GpsStatusPosX, page->GpsStatusPosY - image_gps.height / 2, &image_gps);
+		if (page->GpsStatus) {
+			write_string((char *)st->text, page->GpsStatusPosX + image_gps.width -4, page->GpsStatusPosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT,
+					0, page->GpsStatusFont);
+		}
+		break;
+	case HUD_WIDGET_GPS_LAT:
+		write_string((char *)st->text, page->GpsLatPosX, page->GpsLatPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsLatAlign, 0,
+				page->GpsLatFont);
+		break;
+	case HUD_WIDGET_GPS_LON:
+		write_string((char *)st->text, page->GpsLonPosX, page->GpsLonPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsLonAlign, 0,
+				page->GpsLonFont);
+		break;
+	case HUD_WIDGET_GPS_MGRS:
+		write_string((char *)st->text, page->GpsMgrsPosX, page->GpsMgrsPosY, 0, 0, TEXT_VA_TOP, (int)page->GpsMgrsAlign, 0,
+				page->GpsMgrsFont);
+		break;
+	case HUD_WIDGET_HOME_DISTANCE:
+		if (page->HomeDistanceShowIcon) {
+			draw_image(page->HomeDistancePosX, page->HomeDistancePosY - image_home.height / 2, &image_home);
+		}
+		write_string((char *)st->text, page->HomeDistancePosX + image_home.width - 4, page->HomeDistancePosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT,
+				0, page->HomeDistanceFont);
+		break;
+	case HUD_WIDGET_RSSI:
+		if (page->RssiShowIcon) { // XXX rename
+			draw_image(page->RssiPosX, page->RssiPosY - image_rssi.height / 2, &image_rssi);
+		}
+		write_string((char *)st->text, page->RssiPosX + image_rssi.width - 4, page->RssiPosY, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0,
+				page->RssiFont);
+		break;
+	case HUD_WIDGET_SPEED_SCALE:
+		if (page->SpeedScaleAlign == ONSCREENDISPLAYPAGESETTINGS_SPEEDSCALEALIGN_LEFT) {
+			hud_draw_vertical_scale(st->scale.value, 30, -1,  page->SpeedScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8, 11,
+					100, 0);
+			write_string((char *)st->scale.label, page->SpeedScalePos + 10, 200, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, FONT_OUTLINED8X8);
+		} else {
+			hud_draw_vertical_scale(st->scale.value, 30, 1,  page->SpeedScalePos, GRAPHICS_Y_MIDDLE, 120, 10, 20, 5, 8, 11, 100,
+					0);
+			write_string((char *)st->scale.label, page->SpeedScalePos - 30, 200, 0, 0, TEXT_VA_MIDDLE, TEXT_HA_LEFT, 0, FONT_OUTLINED8X8);
+		}
+		break;
+	case HUD_WIDGET_SPEED_NUMERIC:
+		write_string((char *)st->text, page->SpeedNumericPosX, page->SpeedNumericPosY, 0, 0, (int)page->SpeedNumericAlign, TEXT_HA_LEFT, 0,
+				page->SpeedNumericFont);
+		break;
+	case HUD_WIDGET_TIME:
+		write_string((char *)st->text, page->TimePosX, page->TimePosY, 0, 0, TEXT_VA_TOP, (int)page->TimeAlign, 0, page->TimeFont);
+		break;
+	case HUD_WIDGET_THROTTLE:
+		write_string((char *)st->text, page->ThrottlePosX, page->ThrottlePosY, 0, 0, TEXT_VA_TOP, (int)page->ThrottleAlign, 0,
+				page->ThrottleFont);
+		break;
+	case HUD_WIDGET_VTX_FREQ:
+		write_string((char *)st->text, page->VTXFreqPosX, page->VTXFreqPosY, 0, 0, TEXT_VA_TOP, (int)page->VTXFreqAlign, 0,
+				page->VTXFreqFont);
+		break;
+	case HUD_WIDGET_VTX_POWER:
+		write_string((char *)st->text, page->VTXPowerPosX, page->VTXPowerPosY, 0, 0, TEXT_VA_TOP, (int)page->VTXPowerAlign, 0,
 				page->VTXPowerFont);
+		break;
+#ifdef DEBUG_TIMING
+	case HUD_WIDGET_DEBUG_TIMING:
+		write_string((char *)st->text, GRAPHICS_X_MIDDLE, GRAPHICS_Y_MIDDLE - 20, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT8X10);
+		break;
+#endif
+	case HUD_WIDGET_NUM:
+		break;
 	}
 }
 
+/**
+ * Render a user page. Only the widgets that changed since this draw buffer
+ * was last rendered are redrawn, so the buffer must not be touched by
+ * anything else between calls (or osd_retained_invalidate() must be used).
+ */
+void render_user_page(OnScreenDisplayPageSettingsData * page)
+{
+	if (page == NULL)
+		return;
+
+	osd_retained_begin(&hud_retained, get_draw_buffer());
+
+	hud_update_widgets(page);
+	osd_retained_prepare(&hud_retained);
+
+	for (int id = 0; id < HUD_WIDGET_NUM; id++) {
+		if (osd_retained_draw_begin(&hud_retained, id)) {
+			hud_draw_widget(page, id);
+			osd_retained_draw_end(&hud_retained, id);
+		}
+	}
+
+	osd_retained_end(&hud_retained, get_draw_buffer());
+}
+
 #define STATS_LINE_SPACING 11
 #define STATS_LINE_Y 40
 #define STATS_LINE_X (GRAPHICS_LEFT + 10)
@@ -1663,6 +1889,8 @@ int32_t OnScreenDisplayInitialize(void)
 		return -1;
 	}
 	
+	osd_retained_init(&hud_retained, HUD_WIDGET_NUM);
+
 	/* Register callbacks for modified settings */
 	OnScreenDisplaySettingsConnectCallbackCtx(UAVObjCbSetFlag, &osd_settings_updated);
 
@@ -1821,11 +2049,13 @@ static void onScreenDisplayTask(__attribute__((unused)) void *parameters)
 				}
 
 				osd_settings_updated = false;
+				osd_retained_invalidate(&hud_retained);
 			}
 
 			// update settings when video type changes
 			if (video_system_act != video_system_last) {
 				set_ntsc_pal_settings(video_system_act);
+				osd_retained_invalidate(&hud_retained);
 			}
 
 			// decide whether to show blinking elements
@@ -1856,6 +2086,7 @@ static void onScreenDisplayTask(__attribute__((unused)) void *parameters)
 					OnScreenDisplayPageSettingsGet(&osd_page_settings);
 				}
 				osd_page_updated = false;
+				osd_retained_invalidate(&hud_retained);
 			}
 
 			// Show stats when we disarm
@@ -1890,20 +2121,30 @@ static void onScreenDisplayTask(__attribute__((unused)) void *parameters)
 				}
 			}
 
-			clearGraphics();
+			// User pages only redraw what changed, everything else
+			// starts from a cleared buffer
 			switch (current_page) {
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_OFF:
+				clearGraphics();
+				osd_retained_invalidate(&hud_retained);
 				break;
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_STATISTICS:
+				clearGraphics();
+				osd_retained_invalidate(&hud_retained);
 				render_stats();
 				break;
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_MENU:
 				if ((arm_status == FLIGHTSTATUS_ARMED_DISARMED) ||
 						(osd_settings.DisableMenuWhenArmed == ONSCREENDISPLAYSETTINGS_DISABLEMENUWHENARMED_DISABLED)) {
+					clearGraphics();
+					osd_retained_invalidate(&hud_retained);
 					render_osd_menu();
 					break;
 				}
+				render_user_page(&osd_page_settings);
 				write_string("MENU DISABLED", GRAPHICS_X_MIDDLE, 50, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, 3);
+				osd_retained_invalidate(&hud_retained);
+				break;
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM1:
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM2:
 			case ONSCREENDISPLAYSETTINGS_PAGECONFIG_CUSTOM3:
@@ -1920,11 +2161,9 @@ static void onScreenDisplayTask(__attribute__((unused)) void *parameters)
 			last_arm_status = arm_status;
 			video_system_last = video_system_act;
 #ifdef DEBUG_TIMING
+			// Shown on the next frame of a user page
 			out_ticks = PIOS_Thread_Systime();
 			in_time   = out_ticks - in_ticks;
-			char tmp_str[50];
-			sprintf(tmp_str, "%03d %03d", (int)in_time, (int)out_time);
-			write_string(tmp_str, GRAPHICS_X_MIDDLE, GRAPHICS_Y_MIDDLE - 20, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT8X10);
 #endif
 		} else {
 			video_active = false;
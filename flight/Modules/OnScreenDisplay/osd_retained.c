@@ -0,0 +1,283 @@
+/**
+ ******************************************************************************
+ * @addtogroup Modules Modules
+ * @{
+ * @addtogroup OnScreenDisplay Pixel OSD
+ * @{
+ *
+ * @brief Retained-mode widget layer for the OSD
+ * @file       osd_retained.c
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Retained-mode widget layer for the OSD
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+/*
+ * Instead of clearing the whole frame and drawing every element again, the
+ * OSD keeps track of what each video buffer currently shows: for every widget
+ * a hash of the inputs it was drawn from and the area it touched. A frame is
+ * then rendered in two steps:
+ *
+ * 1. every widget reports its inputs (osd_retained_update()). Widgets whose
+ *    inputs changed, or that got disabled, have their old area cleared in
+ *    osd_retained_prepare(). Unchanged widgets that share pixels with a
+ *    cleared area are scheduled for a redraw.
+ * 2. widgets are drawn in their normal order. A widget is skipped if it is
+ *    unchanged and nothing drawn before it in this frame overlaps it, so the
+ *    stacking order of a full redraw is preserved.
+ *
+ * There are two video buffers that get swapped every frame, so this state is
+ * kept per buffer, identified by the draw buffer address.
+ */
+
+#include "osd_retained.h"
+
+static uint32_t hash_inputs(const void *inputs, size_t len)
+{
+	// 32 bit FNV-1a
+	const uint8_t *p = inputs;
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < len; i++) {
+		hash ^= p[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * Initialize the retained state
+ * @param[in] ret the state to initialize
+ * @param[in] num_widgets number of widget ids that will be used
+ */
+void osd_retained_init(struct osd_retained *ret, uint8_t num_widgets)
+{
+	PIOS_Assert(num_widgets <= OSD_RETAINED_MAX_WIDGETS);
+
+	memset(ret, 0, sizeof(*ret));
+	ret->num_widgets = num_widgets;
+}
+
+/**
+ * Forget what the buffers contain, the next frame on each buffer is
+ * cleared and fully redrawn. Call this whenever something other than the
+ * widgets has drawn into the buffers (other pages, menu) or the layout
+ * changes.
+ * @param[in] ret the retained state
+ */
+void osd_retained_invalidate(struct osd_retained *ret)
+{
+	ret->slots[0].valid = false;
+	ret->slots[1].valid = false;
+}
+
+/**
+ * Start a frame
+ * @param[in] ret the retained state
+ * @param[in] buffer address of the current draw buffer
+ */
+void osd_retained_begin(struct osd_retained *ret, const void *buffer)
+{
+	struct osd_retained_slot *slot = NULL;
+
+	for (int i = 0; i < 2; i++) {
+		if (ret->slots[i].buffer == buffer) {
+			slot = &ret->slots[i];
+			break;
+		}
+	}
+
+	if (slot == NULL) {
+		slot = &ret->slots[ret->next_slot];
+		ret->next_slot ^= 1;
+		slot->buffer = buffer;
+		slot->valid = false;
+	}
+
+	if (!slot->valid) {
+		clearGraphics();
+		slot->drawn = 0;
+		slot->valid = true;
+	}
+
+	ret->slot = slot;
+	ret->buffer = buffer;
+	ret->enabled = 0;
+	ret->dirty = 0;
+	ret->redraw = 0;
+	ret->num_drawn = 0;
+	ret->stat_rendered = 0;
+	ret->stat_skipped = 0;
+}
+
+/**
+ * Report the inputs of a widget for this frame. Must be called for every
+ * widget id before osd_retained_prepare().
+ * @param[in] ret the retained state
+ * @param[in] id widget id
+ * @param[in] enabled whether the widget is shown this frame
+ * @param[in] inputs everything the drawing of the widget depends on, or
+ *            NULL if the widget has to be redrawn on every frame
+ * @param[in] len length of inputs
+ */
+void osd_retained_update(struct osd_retained *ret, uint8_t id, bool enabled,
+		const void *inputs, size_t len)
+{
+	struct osd_retained_slot *slot = ret->slot;
+	uint32_t bit = 1u << id;
+
+	if (!enabled) {
+		if (slot->drawn & bit) {
+			ret->dirty |= bit;
+		}
+		return;
+	}
+
+	ret->enabled |= bit;
+
+	if (inputs == NULL) {
+		ret->hash[id] = 0;
+		ret->dirty |= bit;
+		return;
+	}
+
+	ret->hash[id] = hash_inputs(inputs, len);
+
+	if (!(slot->drawn & bit) || slot->hash[id] != ret->hash[id]) {
+		ret->dirty |= bit;
+	}
+}
+
+/**
+ * Clear the areas of all changed widgets and work out what has to be
+ * redrawn.
+ * @param[in] ret the retained state
+ */
+void osd_retained_prepare(struct osd_retained *ret)
+{
+	struct osd_retained_slot *slot = ret->slot;
+	uint32_t damaged = ret->dirty & slot->drawn;
+
+	ret->redraw = ret->dirty & ret->enabled;
+
+	if (!damaged) {
+		return;
+	}
+
+	for (int id = 0; id < ret->num_widgets; id++) {
+		if (damaged & (1u << id)) {
+			clear_rectangle(&slot->bbox[id]);
+		}
+	}
+
+	slot->drawn &= ~damaged;
+
+	// Unchanged widgets that lost pixels to a clear have to be put back
+	for (int id = 0; id < ret->num_widgets; id++) {
+		uint32_t bit = 1u << id;
+
+		if (!(slot->drawn & bit)) {
+			continue;
+		}
+
+		for (int d = 0; d < ret->num_widgets; d++) {
+			if ((damaged & (1u << d)) &&
+					OSD_RECT_INTERSECT(&slot->bbox[id], &slot->bbox[d])) {
+				ret->redraw |= bit;
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * Check whether a widget has to be drawn. If this returns true, the widget
+ * has to be drawn and osd_retained_draw_end() called afterwards.
+ * @param[in] ret the retained state
+ * @param[in] id widget id
+ * @returns true if the widget has to be drawn
+ */
+bool osd_retained_draw_begin(struct osd_retained *ret, uint8_t id)
+{
+	struct osd_retained_slot *slot = ret->slot;
+	uint32_t bit = 1u << id;
+
+	if (!(ret->enabled & bit)) {
+		return false;
+	}
+
+	if (!(ret->redraw & bit)) {
+		// Something drawn earlier in this frame may cover it
+		int i;
+		for (i = 0; i < ret->num_drawn; i++) {
+			if (OSD_RECT_INTERSECT(&slot->bbox[id], &ret->drawn[i])) {
+				break;
+			}
+		}
+
+		if (i == ret->num_drawn) {
+			ret->stat_skipped++;
+			return false;
+		}
+	}
+
+	track_extent_begin();
+
+	return true;
+}
+
+/**
+ * Record the area touched by a widget after drawing it
+ * @param[in] ret the retained state
+ * @param[in] id widget id
+ */
+void osd_retained_draw_end(struct osd_retained *ret, uint8_t id)
+{
+	struct osd_retained_slot *slot = ret->slot;
+
+	track_extent_end(&slot->bbox[id]);
+	slot->hash[id] = ret->hash[id];
+	slot->drawn |= 1u << id;
+
+	ret->drawn[ret->num_drawn++] = slot->bbox[id];
+	ret->stat_rendered++;
+}
+
+/**
+ * Finish a frame
+ * @param[in] ret the retained state
+ * @param[in] buffer address of the current draw buffer
+ */
+void osd_retained_end(struct osd_retained *ret, const void *buffer)
+{
+	// If the buffers got swapped while drawing, part of the frame went
+	// into the other buffer and neither matches the bookkeeping any more.
+	if (buffer != ret->buffer) {
+		osd_retained_invalidate(ret);
+	}
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -56,6 +56,68 @@ extern uint8_t *draw_buffer;
 extern uint8_t *disp_buffer;
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 
+// Bounding box of everything drawn since track_extent_begin()
+static bool extent_active;
+static struct osd_rect extent;
+
+static inline void track_extent(int x0, int y0, int x1, int y1)
+{
+	if (!extent_active)
+		return;
+
+	if (x0 < extent.x0)
+		extent.x0 = x0;
+	if (y0 < extent.y0)
+		extent.y0 = y0;
+	if (x1 > extent.x1)
+		extent.x1 = x1;
+	if (y1 > extent.y1)
+		extent.y1 = y1;
+}
+
+/**
+ * track_extent_begin: start recording the area touched by the drawing
+ * primitives. The result is conservative (it may be a bit larger than the
+ * pixels actually set) but never smaller.
+ */
+void track_extent_begin(void)
+{
+	extent.x0 = INT16_MAX;
+	extent.y0 = INT16_MAX;
+	extent.x1 = INT16_MIN;
+	extent.y1 = INT16_MIN;
+	extent_active = true;
+}
+
+/**
+ * track_extent_end: stop recording and return the touched area, clipped
+ * to the graphics area. The rectangle is empty if nothing was drawn.
+ *
+ * @param       rect    return result: touched area
+ */
+void track_extent_end(struct osd_rect *rect)
+{
+	extent_active = false;
+
+	rect->x0 = MAX(extent.x0, GRAPHICS_LEFT);
+	rect->y0 = MAX(extent.y0, GRAPHICS_TOP);
+	rect->x1 = MIN(extent.x1, GRAPHICS_RIGHT);
+	rect->y1 = MIN(extent.y1, GRAPHICS_BOTTOM);
+}
+
+/**
+ * get_draw_buffer: Get the address of the buffer currently drawn into.
+ * The draw and display buffers get swapped, so this identifies which of
+ * the two is being drawn.
+ */
+const void *get_draw_buffer(void)
+{
+#if defined(PIOS_VIDEO_SPLITBUFFER)
+	return draw_buffer_level;
+#else
+	return draw_buffer;
+#endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
+}
 
 void clearGraphics()
 {
@@ -67,8 +129,205 @@ void clearGraphics()
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 }
 
+#if defined(PIOS_VIDEO_SPLITBUFFER)
+/**
+ * fill_words: clear, set or toggle a run of whole words in one buffer.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       addr    address of the first word
+ * @param       count   number of words
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+static inline void fill_words(uint8_t *buff, int addr, int count, int mode)
+{
+	switch (mode) {
+	case 0:
+		memset(&buff[addr], 0x00, count);
+		break;
+	case 1:
+		memset(&buff[addr], 0xff, count);
+		break;
+	case 2:
+		for (int i = addr; i < addr + count; i++) {
+			buff[i] ^= 0xff;
+		}
+		break;
+	}
+}
+
+/*
+ * Clear, set and toggle all become buff = (buff & and) ^ xor, so the word
+ * writes below don't have to switch on the mode.
+ */
+#define MODE_AND(mask, mode) ((mode) == 2 ? 0xFF : (uint8_t)~(mask))
+#define MODE_XOR(mask, mode) ((mode) == 0 ? 0x00 : (mask))
+
+/**
+ * write_rows_lm: write the same run of words on consecutive lines of the
+ * mask and the level buffer. The edge masks are computed once by the caller
+ * and both planes are written in the same pass.
+ *
+ * @param       addr0   address of the first word on the first line
+ * @param       addr1   address of the last word on the first line
+ * @param       mask_l  mask of the first word (of the only word if addr0 == addr1)
+ * @param       mask_r  mask of the last word
+ * @param       rows    number of lines
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ */
+static inline void write_rows_lm(int addr0, int addr1, uint8_t mask_l, uint8_t mask_r, int rows, int mmode, int lmode)
+{
+	uint8_t m_and_l = MODE_AND(mask_l, mmode), m_xor_l = MODE_XOR(mask_l, mmode);
+	uint8_t l_and_l = MODE_AND(mask_l, lmode), l_xor_l = MODE_XOR(mask_l, lmode);
+
+	if (addr0 == addr1) {
+		for (; rows > 0; rows--) {
+			draw_buffer_mask[addr0] = (draw_buffer_mask[addr0] & m_and_l) ^ m_xor_l;
+			draw_buffer_level[addr0] = (draw_buffer_level[addr0] & l_and_l) ^ l_xor_l;
+			addr0 += BUFFER_WIDTH;
+		}
+		return;
+	}
+
+	uint8_t m_and_r = MODE_AND(mask_r, mmode), m_xor_r = MODE_XOR(mask_r, mmode);
+	uint8_t l_and_r = MODE_AND(mask_r, lmode), l_xor_r = MODE_XOR(mask_r, lmode);
+
+	for (; rows > 0; rows--) {
+		draw_buffer_mask[addr0] = (draw_buffer_mask[addr0] & m_and_l) ^ m_xor_l;
+		draw_buffer_level[addr0] = (draw_buffer_level[addr0] & l_and_l) ^ l_xor_l;
+		draw_buffer_mask[addr1] = (draw_buffer_mask[addr1] & m_and_r) ^ m_xor_r;
+		draw_buffer_level[addr1] = (draw_buffer_level[addr1] & l_and_r) ^ l_xor_r;
+		if (addr1 - addr0 > 1) {
+			fill_words(draw_buffer_mask, addr0 + 1, addr1 - addr0 - 1, mmode);
+			fill_words(draw_buffer_level, addr0 + 1, addr1 - addr0 - 1, lmode);
+		}
+		addr0 += BUFFER_WIDTH;
+		addr1 += BUFFER_WIDTH;
+	}
+}
+#else
+/**
+ * write_rows_lm: write the same run of words on consecutive lines.
+ *
+ * @param       addr0   address of the first word on the first line
+ * @param       addr1   address of the last word on the first line
+ * @param       mask_l  mask of the first word (of the only word if addr0 == addr1)
+ * @param       mask_r  mask of the last word
+ * @param       rows    number of lines
+ * @param       value   packed mask and level bits
+ */
+static inline void write_rows_lm(int addr0, int addr1, uint8_t mask_l, uint8_t mask_r, int rows, uint8_t value)
+{
+	for (; rows > 0; rows--) {
+		WRITE_WORD(draw_buffer, addr0, mask_l, value);
+		if (addr1 != addr0) {
+			WRITE_WORD(draw_buffer, addr1, mask_r, value);
+			if (addr1 - addr0 > 1) {
+				memset(&draw_buffer[addr0 + 1], value, addr1 - addr0 - 1);
+			}
+		}
+		addr0 += BUFFER_WIDTH;
+		addr1 += BUFFER_WIDTH;
+	}
+}
+#endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
+
+/**
+ * write_span_rows_lm: write the pixels x0 to x1 (inclusive) on the lines
+ * y0 to y1 (inclusive) of both planes. Coordinates must be clipped.
+ */
+static inline void write_span_rows_lm(int x0, int x1, int y0, int y1, int mmode, int lmode)
+{
+	const int bits = 8 / PIXELS_PER_BIT;
+	int addr0 = CALC_BUFF_ADDR(x0, y0);
+	int addr1 = CALC_BUFF_ADDR(x1, y0);
+	uint8_t mask_l = 0xFF >> (bits * (x0 % PIXELS_PER_BIT));
+	uint8_t mask_r = 0xFF << (8 - bits * (x1 % PIXELS_PER_BIT + 1));
+
+	if (addr0 == addr1) {
+		mask_l &= mask_r;
+	}
+
+#if defined(PIOS_VIDEO_SPLITBUFFER)
+	write_rows_lm(addr0, addr1, mask_l, mask_r, y1 - y0 + 1, mmode, lmode);
+#else
+	uint8_t value = PACK_BITS(mmode, lmode);
+	write_rows_lm(addr0, addr1, mask_l, mask_r, y1 - y0 + 1, value);
+#endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
+}
+
+/**
+ * write_hspan_lm: write a horizontal run of pixels on both planes.
+ * Unlike write_hline_lm() both ends are included and a single pixel
+ * run is allowed.
+ *
+ * @param       x0      first x coordinate
+ * @param       x1      last x coordinate, >= x0
+ * @param       y       y coordinate
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ */
+static inline void write_hspan_lm(int x0, int x1, int y, int mmode, int lmode)
+{
+	CHECK_COORD_Y(y);
+	if (x1 < GRAPHICS_LEFT || x0 > GRAPHICS_RIGHT) {
+		return;
+	}
+	CLIP_COORD_X(x0);
+	CLIP_COORD_X(x1);
+	track_extent(x0, y, x1, y);
+	write_span_rows_lm(x0, x1, y, y, mmode, lmode);
+}
+
+/**
+ * write_vspan_lm: write a vertical run of pixels on both planes.
+ * Both ends are included.
+ *
+ * @param       x       x coordinate
+ * @param       y0      first y coordinate
+ * @param       y1      last y coordinate, >= y0
+ * @param       mmode   0 = clear, 1 = set, 2 = toggle
+ * @param       lmode   0 = clear, 1 = set, 2 = toggle
+ */
+static inline void write_vspan_lm(int x, int y0, int y1, int mmode, int lmode)
+{
+	CHECK_COORD_X(x);
+	if (y1 < GRAPHICS_TOP || y0 > GRAPHICS_BOTTOM) {
+		return;
+	}
+	CLIP_COORD_Y(y0);
+	CLIP_COORD_Y(y1);
+	track_extent(x, y0, x, y1);
+	write_span_rows_lm(x, x, y0, y1, mmode, lmode);
+}
+
+/**
+ * clear_rectangle: make a rectangle transparent on the draw buffer.
+ * Unlike write_filled_rectangle_lm() this is exact to the pixel at both
+ * edges, so it can be used to erase one element without touching its
+ * neighbours.
+ *
+ * @param       rect    inclusive area to clear
+ */
+void clear_rectangle(const struct osd_rect *rect)
+{
+	int x0 = rect->x0, y0 = rect->y0, x1 = rect->x1, y1 = rect->y1;
+
+	if (OSD_RECT_EMPTY(rect)) {
+		return;
+	}
+	CLIP_COORDS(x0, y0);
+	CLIP_COORDS(x1, y1);
+	if (x0 > x1 || y0 > y1) {
+		return;
+	}
+
+	write_span_rows_lm(x0, x1, y0, y1, 0, 0);
+}
+
 void draw_image(uint16_t x, uint16_t y, const struct Image * image)
 {
+	track_extent(x, y, x + image->width - 1, y + image->height - 1);
 #if defined(PIOS_VIDEO_SPLITBUFFER)
 	CHECK_COORDS(x + image->width, y + image->height);
 	uint8_t byte_width = image->width / 8;
@@ -231,6 +490,7 @@ void drawBox(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 void write_pixel(uint8_t *buff, int x, int y, int mode)
 {
 	CHECK_COORDS(x, y);
+	track_extent(x, y, x, y);
 	// Determine the bit in the word to be set and the word
 	// index to set it in.
 	int wordnum = CALC_BUFF_ADDR(x, y);
@@ -241,6 +501,7 @@ void write_pixel(uint8_t *buff, int x, int y, int mode)
 void write_pixel(int x, int y, uint8_t value)
 {
 	CHECK_COORDS(x, y);
+	track_extent(x, y, x, y);
 	// Determine the bit in the word to be set and the word
 	// index to set it in.
 	int wordnum = CALC_BUFF_ADDR(x, y);
@@ -261,6 +522,7 @@ void write_pixel(int x, int y, uint8_t value)
 void write_pixel_lm(int x, int y, int mmode, int lmode)
 {
 	CHECK_COORDS(x, y);
+	track_extent(x, y, x, y);
 	// Determine the bit in the word to be set and the word
 	// index to set it in.
 	int addr   = CALC_BUFF_ADDR(x, y);
@@ -295,13 +557,14 @@ void write_hline(uint8_t *buff, int x0, int x1, int y, int mode)
 	if (x0 == x1) {
 		return;
 	}
+	track_extent(x0, y, x1, y);
 	/* This is an optimised algorithm for writing horizontal lines.
 	 * We begin by finding the addresses of the x0 and x1 points. */
 	int addr0     = CALC_BUFF_ADDR(x0, y);
 	int addr1     = CALC_BUFF_ADDR(x1, y);
 	int addr0_bit = CALC_BIT_IN_WORD(x0);
 	int addr1_bit = CALC_BIT_IN_WORD(x1);
-	int mask, mask_l, mask_r, i;
+	int mask, mask_l, mask_r;
 	/* If the addresses are equal, we only need to write one word
 	 * which is an island. */
 	if (addr0 == addr1) {
@@ -313,11 +576,8 @@ void write_hline(uint8_t *buff, int x0, int x1, int y, int mode)
 		mask_r = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
 		WRITE_WORD_MODE(buff, addr0, mask_l, mode);
 		WRITE_WORD_MODE(buff, addr1, mask_r, mode);
-		// Now write 0xffff words from start+1 to end-1.
-		for (i = addr0 + 1; i <= addr1 - 1; i++) {
-			uint8_t m = 0xff;
-			WRITE_WORD_MODE(buff, i, m, mode);
-		}
+		// Now write 0xff words from start+1 to end-1.
+		fill_words(buff, addr0 + 1, addr1 - addr0 - 1, mode);
 	}
 }
 #else
@@ -332,30 +592,25 @@ void write_hline(int x0, int x1, int y, uint8_t value)
 	if (x0 == x1) {
 		return;
 	}
+	track_extent(x0, y, x1, y);
 	/* This is an optimised algorithm for writing horizontal lines.
 	 * We begin by finding the addresses of the x0 and x1 points. */
 	int addr0     = CALC_BUFF_ADDR(x0, y);
 	int addr1     = CALC_BUFF_ADDR(x1, y);
 	int addr0_bit = CALC_BIT1_IN_WORD(x0);
 	int addr1_bit = CALC_BIT0_IN_WORD(x1);
-	int mask, mask_l, mask_r, i;
+	uint8_t mask_l, mask_r;
 	/* If the addresses are equal, we only need to write one word
-	 * which is an island. */
+	 * which is an island. Otherwise we need to write the edges
+	 * and then the middle. */
 	if (addr0 == addr1) {
-		mask = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
-		WRITE_WORD(draw_buffer, addr0, mask, value);
+		mask_l = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
+		mask_r = mask_l;
 	} else {
-		/* Otherwise we need to write the edges and then the middle. */
 		mask_l = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
 		mask_r = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
-		WRITE_WORD(draw_buffer, addr0, mask_l, value);
-		WRITE_WORD(draw_buffer, addr1, mask_r, value);
-		// Now write 0xffff words from start+1 to end-1.
-		for (i = addr0 + 1; i <= addr1 - 1; i++) {
-			uint8_t m = 0xff;
-			WRITE_WORD(draw_buffer, i, m, value);
-		}
 	}
+	write_rows_lm(addr0, addr1, mask_l, mask_r, 1, value);
 }
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 
@@ -372,10 +627,31 @@ void write_hline(int x0, int x1, int y, uint8_t value)
 void write_hline_lm(int x0, int x1, int y, int lmode, int mmode)
 {
 #if defined(PIOS_VIDEO_SPLITBUFFER)
-	// TODO: an optimisation would compute the masks and apply to
-	// both buffers simultaneously.
-	write_hline(draw_buffer_level, x0, x1, y, lmode);
-	write_hline(draw_buffer_mask, x0, x1, y, mmode);
+	// Same as write_hline(), but the masks are computed once and
+	// applied to both buffers in the same pass.
+	CHECK_COORD_Y(y);
+	CLIP_COORD_X(x0);
+	CLIP_COORD_X(x1);
+	if (x0 > x1) {
+		SWAP(x0, x1);
+	}
+	if (x0 == x1) {
+		return;
+	}
+	track_extent(x0, y, x1, y);
+	int addr0     = CALC_BUFF_ADDR(x0, y);
+	int addr1     = CALC_BUFF_ADDR(x1, y);
+	int addr0_bit = CALC_BIT_IN_WORD(x0);
+	int addr1_bit = CALC_BIT_IN_WORD(x1);
+	uint8_t mask_l, mask_r;
+	if (addr0 == addr1) {
+		mask_l = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
+		mask_r = mask_l;
+	} else {
+		mask_l = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
+		mask_r = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
+	}
+	write_rows_lm(addr0, addr1, mask_l, mask_r, 1, mmode, lmode);
 #else
 	uint8_t value = PACK_BITS(mmode, lmode);
 	write_hline(x0, x1, y, value);
@@ -432,6 +708,7 @@ void write_vline(uint8_t *buff, int x, int y0, int y1, int mode)
 	if (y0 == y1) {
 		return;
 	}
+	track_extent(x, y0, x, y1);
 	/* This is an optimised algorithm for writing vertical lines.
 	 * We begin by finding the addresses of the x,y0 and x,y1 points. */
 	int addr0  = CALC_BUFF_ADDR(x, y0);
@@ -456,17 +733,15 @@ void write_vline(int x, int y0, int y1, uint8_t value)
 	if (y0 == y1) {
 		return;
 	}
+	track_extent(x, y0, x, y1);
 	/* This is an optimised algorithm for writing vertical lines.
 	 * We begin by finding the addresses of the x,y0 and x,y1 points. */
 	int addr0  = CALC_BUFF_ADDR(x, y0);
 	int addr1  = CALC_BUFF_ADDR(x, y1);
 	/* Then we calculate the pixel data to be written. */
 	uint8_t mask = CALC_BIT_MASK(x);
-	/* Run from addr0 to addr1 placing pixels. Increment by the number
-	 * of words n each graphics line. */
-	for (int a = addr0; a <= addr1; a += BUFFER_WIDTH) {
-		WRITE_WORD(draw_buffer, a, mask, value);
-	}
+	/* Run from addr0 to addr1 placing pixels. */
+	write_rows_lm(addr0, addr0, mask, mask, (addr1 - addr0) / BUFFER_WIDTH + 1, value);
 }
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 
@@ -483,10 +758,19 @@ void write_vline(int x, int y0, int y1, uint8_t value)
 void write_vline_lm(int x, int y0, int y1, int lmode, int mmode)
 {
 #if defined(PIOS_VIDEO_SPLITBUFFER)
-	// TODO: an optimisation would compute the masks and apply to
-	// both buffers simultaneously.
-	write_vline(draw_buffer_level, x, y0, y1, lmode);
-	write_vline(draw_buffer_mask, x, y0, y1, mmode);
+	// Same as write_vline(), but writing both buffers in one pass.
+	CHECK_COORD_X(x);
+	CLIP_COORD_Y(y0);
+	CLIP_COORD_Y(y1);
+	if (y0 > y1) {
+		SWAP(y0, y1);
+	}
+	if (y0 == y1) {
+		return;
+	}
+	track_extent(x, y0, x, y1);
+	uint8_t mask = CALC_BIT_MASK(x);
+	write_rows_lm(CALC_BUFF_ADDR(x, y0), CALC_BUFF_ADDR(x, y0), mask, mask, y1 - y0 + 1, mmode, lmode);
 #else
 	uint8_t value = PACK_BITS(mmode, lmode);
 	write_vline(x, y0, y1, value);
@@ -522,6 +806,36 @@ void write_vline_outlined(int x, int y0, int y1, int endcap0, int endcap1, int m
 	DRAW_ENDCAP_VLINE(endcap1, x, y1, stroke, fill, mmode);
 }
 
+/**
+ * rectangle_words: calculate the words of the first line of a filled
+ * rectangle, as if it was only a horizontal line. Callers step these
+ * addresses through each row.
+ *
+ * @param       x       x coordinate (left)
+ * @param       y       y coordinate (top)
+ * @param       width   rectangle width
+ * @param       addr0   return result: address of the first word
+ * @param       addr1   return result: address of the last word
+ * @param       mask_l  return result: mask of the first (or only) word
+ * @param       mask_r  return result: mask of the last word
+ */
+static void rectangle_words(int x, int y, int width, int *addr0, int *addr1, uint8_t *mask_l, uint8_t *mask_r)
+{
+	int addr0_bit = CALC_BIT_IN_WORD(x);
+	int addr1_bit = CALC_BIT_IN_WORD(x + width);
+
+	*addr0 = CALC_BUFF_ADDR(x, y);
+	*addr1 = CALC_BUFF_ADDR(x + width, y);
+	// If the addresses are equal, we need to write one word vertically.
+	if (*addr0 == *addr1) {
+		*mask_l = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
+		*mask_r = *mask_l;
+	} else {
+		*mask_l = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
+		*mask_r = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
+	}
+}
+
 /**
  * write_filled_rectangle: draw a filled rectangle.
  *
@@ -546,13 +860,14 @@ void write_filled_rectangle(uint8_t *buff, int x, int y, int width, int height,
 	if (width <= 0 || height <= 0) {
 		return;
 	}
+	track_extent(x, y, x + width, y + height);
 	// Calculate as if the rectangle was only a horizontal line. We then
 	// step these addresses through each row until we iterate `height` times.
 	int addr0     = CALC_BUFF_ADDR(x, y);
 	int addr1     = CALC_BUFF_ADDR(x + width, y);
 	int addr0_bit = CALC_BIT_IN_WORD(x);
 	int addr1_bit = CALC_BIT_IN_WORD(x + width);
-	int mask, mask_l, mask_r, i;
+	int mask, mask_l, mask_r;
 	// If the addresses are equal, we need to write one word vertically.
 	if (addr0 == addr1) {
 		mask = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
@@ -580,10 +895,7 @@ void write_filled_rectangle(uint8_t *buff, int x, int y, int width, int height,
 		addr0 = addr0_old;
 		addr1 = addr1_old;
 		while (yy < height) {
-			for (i = addr0 + 1; i <= addr1 - 1; i++) {
-				uint8_t m = 0xff;
-				WRITE_WORD_MODE(buff, i, m, mode);
-			}
+			fill_words(buff, addr0 + 1, addr1 - addr0 - 1, mode);
 			addr0 += BUFFER_WIDTH;
 			addr1 += BUFFER_WIDTH;
 			yy++;
@@ -593,56 +905,17 @@ void write_filled_rectangle(uint8_t *buff, int x, int y, int width, int height,
 #else
 void write_filled_rectangle(int x, int y, int width, int height, uint8_t value)
 {
-	int yy, addr0_old, addr1_old;
+	int addr0, addr1;
+	uint8_t mask_l, mask_r;
 
 	CHECK_COORDS(x, y);
 	CHECK_COORDS(x + width, y + height);
 	if (width <= 0 || height <= 0) {
 		return;
 	}
-	// Calculate as if the rectangle was only a horizontal line. We then
-	// step these addresses through each row until we iterate `height` times.
-	int addr0     = CALC_BUFF_ADDR(x, y);
-	int addr1     = CALC_BUFF_ADDR(x + width, y);
-	int addr0_bit = CALC_BIT_IN_WORD(x);
-	int addr1_bit = CALC_BIT_IN_WORD(x + width);
-	int mask, mask_l, mask_r, i;
-	// If the addresses are equal, we need to write one word vertically.
-	if (addr0 == addr1) {
-		mask = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
-		while (height--) {
-			WRITE_WORD(draw_buffer, addr0, mask, value);
-			addr0 += BUFFER_WIDTH;
-		}
-	} else {
-		// Otherwise we need to write the edges and then the middle repeatedly.
-		mask_l    = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
-		mask_r    = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
-		// Write edges first.
-		yy        = 0;
-		addr0_old = addr0;
-		addr1_old = addr1;
-		while (yy < height) {
-			WRITE_WORD(draw_buffer, addr0, mask_l, value);
-			WRITE_WORD(draw_buffer, addr1, mask_r, value);
-			addr0 += BUFFER_WIDTH;
-			addr1 += BUFFER_WIDTH;
-			yy++;
-		}
-		// Now write 0xffff words from start+1 to end-1 for each row.
-		yy    = 0;
-		addr0 = addr0_old;
-		addr1 = addr1_old;
-		while (yy < height) {
-			for (i = addr0 + 1; i <= addr1 - 1; i++) {
-				uint8_t m = 0xff;
-				WRITE_WORD(draw_buffer, i, m, value);
-			}
-			addr0 += BUFFER_WIDTH;
-			addr1 += BUFFER_WIDTH;
-			yy++;
-		}
-	}
+	track_extent(x, y, x + width, y + height);
+	rectangle_words(x, y, width, &addr0, &addr1, &mask_l, &mask_r);
+	write_rows_lm(addr0, addr1, mask_l, mask_r, height, value);
 }
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 
@@ -659,8 +932,17 @@ void write_filled_rectangle(int x, int y, int width, int height, uint8_t value)
 void write_filled_rectangle_lm(int x, int y, int width, int height, int lmode, int mmode)
 {
 #if defined(PIOS_VIDEO_SPLITBUFFER)
-	write_filled_rectangle(draw_buffer_mask, x, y, width, height, mmode);
-	write_filled_rectangle(draw_buffer_level, x, y, width, height, lmode);
+	int addr0, addr1;
+	uint8_t mask_l, mask_r;
+
+	CHECK_COORDS(x, y);
+	CHECK_COORDS(x + width, y + height);
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+	track_extent(x, y, x + width, y + height);
+	rectangle_words(x, y, width, &addr0, &addr1, &mask_l, &mask_r);
+	write_rows_lm(addr0, addr1, mask_l, mask_r, height, mmode, lmode);
 #else
 	uint8_t value = PACK_BITS(mmode, lmode);
 	write_filled_rectangle(x, y, width, height, value);
@@ -715,6 +997,55 @@ void write_circle(uint8_t *buff, int cx, int cy, int r, int dashp, int mode)
 	}
 }
 
+/**
+ * write_circle_run_lm: write a run of circle points (a, b0) to (a, b1)
+ * mirrored into all eight octants, on both planes. The run is vertical in
+ * four of the octants and horizontal in the other four.
+ */
+static void write_circle_run_lm(int cx, int cy, int a, int b0, int b1, int mmode, int lmode)
+{
+	write_vspan_lm(cx + a, cy + b0, cy + b1, mmode, lmode);
+	write_vspan_lm(cx - a, cy + b0, cy + b1, mmode, lmode);
+	write_vspan_lm(cx + a, cy - b1, cy - b0, mmode, lmode);
+	write_vspan_lm(cx - a, cy - b1, cy - b0, mmode, lmode);
+	write_hspan_lm(cx + b0, cx + b1, cy + a, mmode, lmode);
+	write_hspan_lm(cx - b1, cx - b0, cy + a, mmode, lmode);
+	write_hspan_lm(cx + b0, cx + b1, cy - a, mmode, lmode);
+	write_hspan_lm(cx - b1, cx - b0, cy - a, mmode, lmode);
+}
+
+/**
+ * write_circle_lm: draw the outline of a circle on both planes, with all
+ * points offset by (dx, dy) in the first octant. Points of the midpoint
+ * circle algorithm with the same x are merged into runs.
+ */
+static void write_circle_lm(int cx, int cy, int r, int dashp, int dx, int dy, int mmode, int lmode)
+{
+	int error = -r, x = r, y = 0, run = -1;
+
+	while (x >= y) {
+		int px = x;
+		if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+			if (run < 0) {
+				run = y;
+			}
+		} else if (run >= 0) {
+			write_circle_run_lm(cx, cy, px + dx, run + dy, y - 1 + dy, mmode, lmode);
+			run = -1;
+		}
+		error += (y * 2) + 1;
+		y++;
+		if (error >= 0) {
+			--x;
+			error -= x * 2;
+		}
+		if (run >= 0 && (x != px || x < y)) {
+			write_circle_run_lm(cx, cy, px + dx, run + dy, y - 1 + dy, mmode, lmode);
+			run = -1;
+		}
+	}
+}
+
 /**
  * write_circle_outlined: draw an outlined circle on the draw buffer.
  *
@@ -733,47 +1064,17 @@ void write_circle_outlined(int cx, int cy, int r, int dashp, int bmode, int mode
 	CHECK_COORDS(cx, cy);
 	SETUP_STROKE_FILL(stroke, fill, mode);
 	// This is a two step procedure. First, we draw the outline of the
-	// circle, then we draw the inner part.
-	int error = -r, x = r, y = 0;
-	while (x >= y) {
-		if (dashp == 0 || (y % dashp) < (dashp / 2)) {
-			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y, mmode);
-			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y, stroke);
-			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y + 1, mmode);
-			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y + 1, stroke);
-			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y, mmode);
-			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y, stroke);
-			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y - 1, mmode);
-			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y - 1, stroke);
-			if (bmode == 1) {
-				CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y + 1, mmode);
-				CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y + 1, stroke);
-				CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y - 1, mmode);
-				CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y - 1, stroke);
-			}
-		}
-		error += (y * 2) + 1;
-		y++;
-		if (error >= 0) {
-			--x;
-			error -= x * 2;
-		}
-	}
-	error = -r;
-	x     = r;
-	y     = 0;
-	while (x >= y) {
-		if (dashp == 0 || (y % dashp) < (dashp / 2)) {
-			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y, mmode);
-			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y, fill);
-		}
-		error += (y * 2) + 1;
-		y++;
-		if (error >= 0) {
-			--x;
-			error -= x * 2;
-		}
+	// circle, as the circle shifted by one pixel in each direction, then
+	// we draw the inner part.
+	write_circle_lm(cx, cy, r, dashp, 1, 0, mmode, stroke);
+	write_circle_lm(cx, cy, r, dashp, 0, 1, mmode, stroke);
+	write_circle_lm(cx, cy, r, dashp, -1, 0, mmode, stroke);
+	write_circle_lm(cx, cy, r, dashp, 0, -1, mmode, stroke);
+	if (bmode == 1) {
+		write_circle_lm(cx, cy, r, dashp, 1, 1, mmode, stroke);
+		write_circle_lm(cx, cy, r, dashp, -1, -1, mmode, stroke);
 	}
+	write_circle_lm(cx, cy, r, dashp, 0, 0, mmode, fill);
 }
 
 /**
@@ -909,6 +1210,96 @@ void write_line(int x0, int y0, int x1, int y1, uint8_t value)
 }
 #endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
 
+/*
+ * Bresenham line walker, returning runs of consecutive pixels on the same
+ * line instead of single pixels. For steep lines x and y are swapped, so
+ * runs are vertical.
+ */
+struct line_walk {
+	bool steep;
+	int x, x1, y, ystep;
+	int deltax, deltay, error;
+	int dots, dot_cnt, draw;
+};
+
+static void line_walk_init(struct line_walk *lw, int x0, int y0, int x1, int y1, int dots)
+{
+	// Based on http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+	lw->steep = abs(y1 - y0) > abs(x1 - x0);
+	if (lw->steep) {
+		SWAP(x0, y0);
+		SWAP(x1, y1);
+	}
+	if (x0 > x1) {
+		SWAP(x0, x1);
+		SWAP(y0, y1);
+	}
+	lw->x       = x0;
+	lw->x1      = x1;
+	lw->y       = y0;
+	lw->ystep   = y0 < y1 ? 1 : -1;
+	lw->deltax  = x1 - x0;
+	lw->deltay  = abs(y1 - y0);
+	lw->error   = lw->deltax / 2;
+	lw->dots    = dots;
+	lw->dot_cnt = 0;
+	lw->draw    = 1;
+}
+
+/**
+ * line_walk_next: get the next run of a line
+ *
+ * @param       lw      line walker
+ * @param       xs      return result: first x of the run
+ * @param       xe      return result: last x of the run
+ * @param       y       return result: y of the run
+ * @returns true if there was another run
+ */
+static inline bool line_walk_next(struct line_walk *lw, int *xs, int *xe, int *y)
+{
+	bool in_run = false;
+
+	while (lw->x < lw->x1) {
+		if (lw->dots && !(lw->dot_cnt++ % lw->dots)) {
+			lw->draw++;
+		}
+		bool on = lw->draw % 2;
+		if (on) {
+			if (!in_run) {
+				*xs    = lw->x;
+				*y     = lw->y;
+				in_run = true;
+			}
+			*xe = lw->x;
+		}
+		bool ystep = false;
+		lw->x++;
+		lw->error -= lw->deltay;
+		if (lw->error < 0) {
+			lw->y     += lw->ystep;
+			lw->error += lw->deltax;
+			ystep      = true;
+		}
+		if (in_run && (!on || ystep)) {
+			return true;
+		}
+	}
+
+	return in_run;
+}
+
+/**
+ * write_run_lm: write a run from the line walker on both planes.
+ */
+static inline void write_run_lm(bool steep, int xs, int xe, int y, int mmode, int lmode)
+{
+	if (steep) {
+		write_vspan_lm(y, xs, xe, mmode, lmode);
+	} else {
+		write_hspan_lm(xs, xe, y, mmode, lmode);
+	}
+}
+
 /**
  * write_line_lm: Draw a line of arbitrary angle.
  *
@@ -921,13 +1312,13 @@ void write_line(int x0, int y0, int x1, int y1, uint8_t value)
  */
 void write_line_lm(int x0, int y0, int x1, int y1, int mmode, int lmode)
 {
-#if defined(PIOS_VIDEO_SPLITBUFFER)
-	write_line(draw_buffer_mask, x0, y0, x1, y1, mmode);
-	write_line(draw_buffer_level, x0, y0, x1, y1, lmode);
-#else
-	uint8_t value = PACK_BITS(mmode, lmode);
-	write_line(x0, y0, x1, y1, value);
-#endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
+	struct line_walk lw;
+	int xs = 0, xe = 0, y = 0;
+
+	line_walk_init(&lw, x0, y0, x1, y1, 0);
+	while (line_walk_next(&lw, &xs, &xe, &y)) {
+		write_run_lm(lw.steep, xs, xe, y, mmode, lmode);
+	}
 }
 
 /**
@@ -943,74 +1334,10 @@ void write_line_lm(int x0, int y0, int x1, int y1, int mmode, int lmode)
  * @param       mmode           0 = clear, 1 = set, 2 = toggle
  */
 void write_line_outlined(int x0, int y0, int x1, int y1,
-						 __attribute__((unused)) int endcap0, __attribute__((unused)) int endcap1,
+						 int endcap0, int endcap1,
 						 int mode, int mmode)
 {
-	// Based on http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
-	// This could be improved for speed.
-	int omode, imode;
-
-	if (mode == 0) {
-		omode = 0;
-		imode = 1;
-	} else {
-		omode = 1;
-		imode = 0;
-	}
-	int steep = abs(y1 - y0) > abs(x1 - x0);
-	if (steep) {
-		SWAP(x0, y0);
-		SWAP(x1, y1);
-	}
-	if (x0 > x1) {
-		SWAP(x0, x1);
-		SWAP(y0, y1);
-	}
-	int deltax     = x1 - x0;
-	int deltay = abs(y1 - y0);
-	int error      = deltax / 2;
-	int ystep;
-	int y = y0;
-	int x;
-	if (y0 < y1) {
-		ystep = 1;
-	} else {
-		ystep = -1;
-	}
-	// Draw the outline.
-	for (x = x0; x < x1; x++) {
-		if (steep) {
-			write_pixel_lm(y - 1, x, mmode, omode);
-			write_pixel_lm(y + 1, x, mmode, omode);
-			write_pixel_lm(y, x - 1, mmode, omode);
-			write_pixel_lm(y, x + 1, mmode, omode);
-		} else {
-			write_pixel_lm(x - 1, y, mmode, omode);
-			write_pixel_lm(x + 1, y, mmode, omode);
-			write_pixel_lm(x, y - 1, mmode, omode);
-			write_pixel_lm(x, y + 1, mmode, omode);
-		}
-		error -= deltay;
-		if (error < 0) {
-			y     += ystep;
-			error += deltax;
-		}
-	}
-	// Now draw the innards.
-	error = deltax / 2;
-	y     = y0;
-	for (x = x0; x < x1; x++) {
-		if (steep) {
-			write_pixel_lm(y, x, mmode, imode);
-		} else {
-			write_pixel_lm(x, y, mmode, imode);
-		}
-		error -= deltay;
-		if (error < 0) {
-			y     += ystep;
-			error += deltax;
-		}
-	}
+	write_line_outlined_dashed(x0, y0, x1, y1, endcap0, endcap1, mode, mmode, 0);
 }
 
 /**
@@ -1030,8 +1357,8 @@ void write_line_outlined_dashed(int x0, int y0, int x1, int y1,
 								__attribute__((unused)) int endcap0, __attribute__((unused)) int endcap1,
 								int mode, int mmode, int dots)
 {
-	// Based on http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
-	// This could be improved for speed.
+	struct line_walk lw;
+	int xs = 0, xe = 0, y = 0;
 	int omode, imode;
 
 	if (mode == 0) {
@@ -1041,73 +1368,18 @@ void write_line_outlined_dashed(int x0, int y0, int x1, int y1,
 		omode = 1;
 		imode = 0;
 	}
-	int steep = abs(y1 - y0) > abs(x1 - x0);
-	if (steep) {
-		SWAP(x0, y0);
-		SWAP(x1, y1);
-	}
-	if (x0 > x1) {
-		SWAP(x0, x1);
-		SWAP(y0, y1);
-	}
-	int deltax = x1 - x0;
-	int deltay = abs(y1 - y0);
-	int error  = deltax / 2;
-	int ystep;
-	int y = y0;
-	int x;
-	if (y0 < y1) {
-		ystep = 1;
-	} else {
-		ystep = -1;
-	}
-	// Draw the outline.
-	int dot_cnt = 0;
-	int draw    = 1;
-	for (x = x0; x < x1; x++) {
-		if (dots && !(dot_cnt++ % dots)) {
-			draw++;
-		}
-		if (draw % 2) {
-			if (steep) {
-				write_pixel_lm(y - 1, x, mmode, omode);
-				write_pixel_lm(y + 1, x, mmode, omode);
-				write_pixel_lm(y, x - 1, mmode, omode);
-				write_pixel_lm(y, x + 1, mmode, omode);
-			} else {
-				write_pixel_lm(x - 1, y, mmode, omode);
-				write_pixel_lm(x + 1, y, mmode, omode);
-				write_pixel_lm(x, y - 1, mmode, omode);
-				write_pixel_lm(x, y + 1, mmode, omode);
-			}
-		}
-		error -= deltay;
-		if (error < 0) {
-			y     += ystep;
-			error += deltax;
-		}
+	// Draw the outline. For a run this is the run extended by one pixel
+	// on its own line and the run itself on the two neighbouring lines.
+	line_walk_init(&lw, x0, y0, x1, y1, dots);
+	while (line_walk_next(&lw, &xs, &xe, &y)) {
+		write_run_lm(lw.steep, xs - 1, xe + 1, y, mmode, omode);
+		write_run_lm(lw.steep, xs, xe, y - 1, mmode, omode);
+		write_run_lm(lw.steep, xs, xe, y + 1, mmode, omode);
 	}
 	// Now draw the innards.
-	error = deltax / 2;
-	y     = y0;
-	dot_cnt = 0;
-	draw    = 1;
-	for (x = x0; x < x1; x++) {
-		if (dots && !(dot_cnt++ % dots)) {
-			draw++;
-		}
-		if (draw % 2) {
-			if (steep) {
-				write_pixel_lm(y, x, mmode, imode);
-			} else {
-				write_pixel_lm(x, y, mmode, imode);
-			}
-		}
-		error -= deltay;
-		if (error < 0) {
-			y     += ystep;
-			error += deltax;
-		}
+	line_walk_init(&lw, x0, y0, x1, y1, dots);
+	while (line_walk_next(&lw, &xs, &xe, &y)) {
+		write_run_lm(lw.steep, xs, xe, y, mmode, imode);
 	}
 }
 
@@ -1195,6 +1467,36 @@ void write_word_misaligned_MASKED(uint8_t *buff, uint16_t word, uint16_t mask, u
 }
 
 
+#if defined(PIOS_VIDEO_SPLITBUFFER)
+/**
+ * write_glyph_row_lm: write one row of a glyph on both planes.
+ *
+ * The row is shifted into place once and then applied to the (up to) three
+ * words it covers, setting the mask and replacing the level of the glyph
+ * pixels in the same pass.
+ *
+ * @param       addr    address of first word
+ * @param       xoff    x offset (0-7)
+ * @param       mask    glyph pixels, left aligned
+ * @param       level   glyph pixels with the level bit set, left aligned
+ */
+static inline void write_glyph_row_lm(unsigned int addr, unsigned int xoff, uint16_t mask, uint16_t level)
+{
+	uint32_t m = ((uint32_t)mask << 8) >> xoff;
+	uint32_t l = ((uint32_t)level << 8) >> xoff;
+
+	for (int i = 0; i < 3; i++) {
+		uint8_t mw = m >> 16;
+		if (mw) {
+			draw_buffer_mask[addr + i] |= mw;
+			draw_buffer_level[addr + i] = (draw_buffer_level[addr + i] & ~mw) | (uint8_t)(l >> 16);
+		}
+		m <<= 8;
+		l <<= 8;
+	}
+}
+#endif /* defined(PIOS_VIDEO_SPLITBUFFER) */
+
 /**
  * write_char: Draw a character on the current draw buffer.
  *
@@ -1224,6 +1526,9 @@ void write_char(uint8_t ch, int x, int y, const struct FontEntry *font_info)
 		return;
 	}
 
+	// Glyph rows are written as whole 8 or 16 pixel words
+	track_extent(x, y, x + (font_info->width > 8 ? 16 : 8) - 1, y + font_info->height - 1);
+
 	// Compute starting address of character
 	int addr = CALC_BUFF_ADDR(x, y);
 	int wbit = CALC_BIT_IN_WORD(x);
@@ -1237,12 +1542,7 @@ void write_char(uint8_t ch, int x, int y, const struct FontEntry *font_info)
 #if defined(PIOS_VIDEO_SPLITBUFFER)
 				mask = data & 0xFFFF;
 				levels   = (data >> 16) & 0xFFFF;
-				// mask
-				write_word_misaligned_OR(draw_buffer_mask, mask, addr, wbit);
-				// level
-				write_word_misaligned_OR(draw_buffer_level, mask, addr, wbit);
-				mask = (mask & levels);
-				write_word_misaligned_NAND(draw_buffer_level, mask, addr, wbit);
+				write_glyph_row_lm(addr, wbit, mask, mask & ~levels);
 #else
 				data16 = (data & 0xFFFF0000) >> 16;
 				mask = data16 | (data16 << 1);
@@ -1264,12 +1564,7 @@ void write_char(uint8_t ch, int x, int y, const struct FontEntry *font_info)
 #if defined(PIOS_VIDEO_SPLITBUFFER)
 				levels = data & 0xFF00;
 				mask = (data & 0x00FF) << 8;
-				// mask
-				write_word_misaligned_OR(draw_buffer_mask, mask, addr, wbit);
-				// level
-				write_word_misaligned_OR(draw_buffer_level, mask, addr, wbit);
-				mask = (mask & levels);
-				write_word_misaligned_NAND(draw_buffer_level, mask, addr, wbit);
+				write_glyph_row_lm(addr, wbit, mask, mask & ~levels);
 #else
 				mask = data | (data << 1);
 				write_word_misaligned_MASKED(draw_buffer, data, mask, addr, wbit);
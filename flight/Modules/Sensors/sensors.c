@@ -36,6 +36,7 @@
 #include "pios_queue.h"
 #include "misc_math.h"
 #include "lpfilter.h"
+#include "dynnotch.h"
 
 #if defined(PIOS_INCLUDE_PX4FLOW)
 #include "pios_px4flow_priv.h"
@@ -47,6 +48,7 @@ extern uintptr_t external_i2c_adapter_id;
 #include "attitudeactual.h"
 #include "attitudesettings.h"
 #include "baroaltitude.h"
+#include "dynamicnotch.h"
 #include "gyros.h"
 #include "gyrosbias.h"
 #include "homelocation.h"
@@ -64,6 +66,7 @@ extern uintptr_t external_i2c_adapter_id;
 #define TASK_PRIORITY PIOS_THREAD_PRIO_HIGH
 #define SENSOR_PERIOD 6		// this allows sensor data to arrive as slow as 166Hz
 #define REQUIRED_GOOD_CYCLES 50
+#define DYNAMIC_NOTCH_PERIOD_MS 100
 #define MAX_TIME_BETWEEN_VALID_BARO_DATAS_MS 100*1000  // we allow a pause time of 100 ms between two valid
                                                        // temperature/barometer dataa
 
@@ -79,6 +82,7 @@ static void settingsUpdatedCb(UAVObjEvent * objEv, void *ctx, void *obj, int len
 
 static void update_accels(struct pios_sensor_accel_data *accel);
 static void update_gyros(struct pios_sensor_gyro_data *gyro);
+void SensorsUpdateDynamicNotch(dynnotch_state_t notch);
 static void update_mags(struct pios_sensor_mag_data *mag);
 static void update_baro(struct pios_sensor_baro_data *baro);
 
@@ -125,6 +129,7 @@ static enum mag_calibration_algo mag_calibration_algo = MAG_CALIBRATION_PRELEMAR
 
 static lpfilter_state_t gyro_filter;
 static lpfilter_state_t accel_filter;
+static dynnotch_state_t gyro_notch;
 
 /**
  * API for sensor fusion algorithms:
@@ -148,7 +153,8 @@ int32_t SensorsInitialize(void)
 		|| MagBiasInitialize() == -1 \
 		|| AttitudeSettingsInitialize() == -1 \
 		|| SensorSettingsInitialize() == -1 \
-		|| INSSettingsInitialize() == -1) {
+		|| INSSettingsInitialize() == -1 \
+		|| DynamicNotchInitialize() == -1) {
 
 		return -1;
 	}
@@ -274,6 +280,9 @@ static void SensorsTask(void *parameters)
 		// the accels to be available first
 		update_gyros(&gyros);
 
+		// Start whatever runs on this gyro sample
+		PIOS_SCHED_Tick();
+
 		bool test_good_run = good_runs > REQUIRED_GOOD_CYCLES;
 
 		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_MAG);
@@ -396,7 +405,9 @@ static void update_gyros(struct pios_sensor_gyro_data *gyros)
 	    gyros->z * gyro_scale[2]
 	};
 
+	dynnotch_run(gyro_notch, gyros_out);
 	lpfilter_run(gyro_filter, gyros_out);
+	SensorsUpdateDynamicNotch(gyro_notch);
 
 	GyrosData gyrosData;
 	gyrosData.temperature = gyros->temperature;
@@ -444,6 +455,32 @@ static void update_gyros(struct pios_sensor_gyro_data *gyros)
 	GyrosSet(&gyrosData);
 }
 
+/**
+ * @brief Publish what the dynamic notches are tracking, a few times a second.
+ * The simulated sensors use this too.
+ * @param[in] notch the gyro notches
+ */
+void SensorsUpdateDynamicNotch(dynnotch_state_t notch)
+{
+	static uint32_t last_update;
+
+	if (!notch ||
+			!PIOS_Thread_Period_Elapsed(last_update, DYNAMIC_NOTCH_PERIOD_MS))
+		return;
+
+	last_update = PIOS_Thread_Systime();
+
+	DynamicNotchData dynamicNotch;
+
+	for (int i = 0; i < 3; i++) {
+		dynamicNotch.Frequency[i] = dynnotch_get_frequency(notch, i, 0);
+		dynamicNotch.Frequency2[i] = dynnotch_get_frequency(notch, i, 1);
+		dynamicNotch.PeakRatio[i] = dynnotch_get_peak_ratio(notch, i);
+	}
+
+	DynamicNotchSet(&dynamicNotch);
+}
+
 /**
  * @brief Apply calibration and rotation to the raw mag data
  * @param[in] mag The raw mag data
@@ -776,6 +813,12 @@ static void settingsUpdatedCb(UAVObjEvent * objEv, void *ctx, void *obj, int len
 
 	lpfilter_create(&gyro_filter, sensorSettings.LowpassCutoff, gyro_dT, sensorSettings.LowpassOrder, 3);
 	lpfilter_create(&accel_filter, sensorSettings.LowpassCutoff, accel_dT, sensorSettings.LowpassOrder, 3);
+
+	dynnotch_create(&gyro_notch,
+			sensorSettings.DynamicNotchRange[SENSORSETTINGS_DYNAMICNOTCHRANGE_MIN],
+			sensorSettings.DynamicNotchRange[SENSORSETTINGS_DYNAMICNOTCHRANGE_MAX],
+			sensorSettings.DynamicNotchQ, sensorSettings.DynamicNotchCount,
+			gyro_dT);
 }
 /**
   * @}
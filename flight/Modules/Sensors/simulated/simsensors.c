@@ -46,6 +46,7 @@
 #include "attitudesettings.h"
 #include "baroairspeed.h"
 #include "baroaltitude.h"
+#include "dynamicnotch.h"
 #include "gyros.h"
 #include "gyrosbias.h"
 #include "flightstatus.h"
@@ -55,19 +56,21 @@
 #include "magnetometer.h"
 #include "magbias.h"
 #include "ratedesired.h"
+#include "sensorsettings.h"
 #include "systemsettings.h"
 
 #include "coordinate_conversions.h"
+#include "dynnotch.h"
 
 // Private constants
 #define STACK_SIZE_BYTES 1540
 #define TASK_PRIORITY PIOS_THREAD_PRIO_HIGH
-#define SENSOR_PERIOD 2
 
 // Private types
 
 // Private variables
 static struct pios_thread *sensorsTaskHandle;
+static dynnotch_state_t gyro_notch;
 
 // Private functions
 static void SensorsTask(void *parameters);
@@ -78,6 +81,8 @@ static void simulateModelAirplane();
 static void simulateModelCar();
 
 static void magOffsetEstimation(MagnetometerData *mag);
+static void settingsUpdatedCb(UAVObjEvent * objEv, void *ctx, void *obj, int len);
+static void filterGyros(GyrosData *gyros);
 
 static float accel_bias[3];
 
@@ -89,6 +94,10 @@ enum sensor_sim_type {CONSTANT, MODEL_AGNOSTIC, MODEL_QUADCOPTER, MODEL_AIRPLANE
 
 extern int32_t SensorsInitialize(void);
 extern int32_t SensorsStart(void);
+extern void SensorsUpdateDynamicNotch(dynnotch_state_t notch);
+
+//! Sample rate in Hz, from the command line; a divisor of 1000
+extern uint16_t sim_imu_rate;
 
 /**
  * Initialise the module.  Called before the start function
@@ -115,10 +124,10 @@ static int32_t SimSensorsInitialize(void)
 	PIOS_SENSORS_Register(PIOS_SENSOR_MAG, (struct pios_queue*)1);
 	PIOS_SENSORS_Register(PIOS_SENSOR_BARO, (struct pios_queue*)1);
 
-	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_ACCEL, 500);
-	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_GYRO, 500);
-	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_MAG, 500);
-	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_BARO, 500);
+	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_ACCEL, sim_imu_rate);
+	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_GYRO, sim_imu_rate);
+	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_MAG, sim_imu_rate);
+	PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_BARO, sim_imu_rate);
 
 	accel_bias[0] = rand_gauss() / 10;
 	accel_bias[1] = rand_gauss() / 10;
@@ -134,6 +143,10 @@ static int32_t SimSensorsInitialize(void)
 	GPSVelocityInitialize();
 	MagnetometerInitialize();
 	MagBiasInitialize();
+	SensorSettingsInitialize();
+	DynamicNotchInitialize();
+
+	SensorSettingsConnectCallback(&settingsUpdatedCb);
 
 	return 0;
 }
@@ -171,6 +184,8 @@ static void SensorsTask(void *parameters)
 {
 	AlarmsClear(SYSTEMALARMS_ALARM_SENSORS);
 
+	settingsUpdatedCb(NULL, NULL, NULL, 0);
+
 	PIOS_SENSORS_SetMaxGyro(500);
 	// Main task loop
 	while (1) {
@@ -218,9 +233,11 @@ static void SensorsTask(void *parameters)
 				simulateModelCar();
 		}
 
+		PIOS_SCHED_Tick();
+
 		static uint32_t tm = 0;
 
-		PIOS_Thread_Sleep_Until(&tm, 2);
+		PIOS_Thread_Sleep_Until(&tm, 1000 / sim_imu_rate);
 	}
 }
 
@@ -347,8 +364,13 @@ static void simulateModelQuadcopter()
 	const float MAG_PERIOD = 1.0 / 75.0;
 	const float BARO_PERIOD = 1.0 / 20.0;
 	const float GYRO_NOISE_SCALE = 1.0f;
+	// Motor vibration; the fundamental climbs with thrust and the second
+	// harmonic folds back down past the Nyquist frequency
+	const float MOTOR_HZ_IDLE = 60.0f;
+	const float MOTOR_HZ_FULL = 200.0f;
+	const float MOTOR_VIBRATION = 20.0f;
 
-	float dT = 0.002;
+	float dT = 1.0f / sim_imu_rate;
 
 	FlightStatusData flightStatus;
 	FlightStatusGet(&flightStatus);
@@ -368,12 +390,23 @@ static void simulateModelQuadcopter()
 	rpy[1] = control_scaling * actuatorDesired.Pitch * (1 - ACTUATOR_ALPHA) + rpy[1] * ACTUATOR_ALPHA;
 	rpy[2] = control_scaling * actuatorDesired.Yaw * (1 - ACTUATOR_ALPHA) + rpy[2] * ACTUATOR_ALPHA;
 
+	static float motor_phase = 0;
+	float vibration = 0;
+	if (thrust > 0) {
+		float throttle = thrust / MAX_THRUST;
+		float motor_hz = MOTOR_HZ_IDLE + (MOTOR_HZ_FULL - MOTOR_HZ_IDLE) * throttle;
+
+		motor_phase = fmodf(motor_phase + 2 * (float) M_PI * motor_hz * dT, 2 * (float) M_PI);
+		vibration = MOTOR_VIBRATION * throttle * (sinf(motor_phase) + 0.4f * sinf(2 * motor_phase));
+	}
+
 	temperature = 20;
 	GyrosData gyrosData; // Skip get as we set all the fields
-	gyrosData.x = rpy[0] + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11; // - powf(temperature - 20,3) * 0.05;;
-	gyrosData.y = rpy[1] + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11;
-	gyrosData.z = rpy[2] + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11;
+	gyrosData.x = rpy[0] + vibration + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11; // - powf(temperature - 20,3) * 0.05;;
+	gyrosData.y = rpy[1] + 0.7f * vibration + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11;
+	gyrosData.z = rpy[2] + 0.3f * vibration + rand_gauss() * GYRO_NOISE_SCALE + (temperature - 20) * 1 + powf(temperature - 20,2) * 0.11;
 	gyrosData.temperature = temperature;
+	filterGyros(&gyrosData);
 	GyrosSet(&gyrosData);
 
 	// Predict the attitude forward in time
@@ -586,7 +619,7 @@ static void simulateModelAirplane()
 	const float ROLL_HEADING_COUPLING = 0.1; // (deg/s) heading change per deg of roll
 	const float PITCH_THRUST_COUPLING = 0.2; // (m/s^2) of forward acceleration per deg of pitch
 
-	float dT = 0.002;
+	float dT = 1.0f / sim_imu_rate;
 
 	FlightStatusData flightStatus;
 	FlightStatusGet(&flightStatus);
@@ -875,7 +908,7 @@ static void simulateModelCar()
 	const float MAG_PERIOD = 1.0 / 75.0;
 	const float BARO_PERIOD = 1.0 / 20.0;
 
-	float dT = 0.002;
+	float dT = 1.0f / sim_imu_rate;
 
 	FlightStatusData flightStatus;
 	FlightStatusGet(&flightStatus);
@@ -1177,6 +1210,35 @@ static void magOffsetEstimation(MagnetometerData *mag)
 	}
 }
 
+/**
+ * Run the simulated gyros through the dynamic notches the same way the real
+ * sensors are, and publish what they are tracking.
+ */
+static void filterGyros(GyrosData *gyros)
+{
+	float sample[3] = {gyros->x, gyros->y, gyros->z};
+
+	dynnotch_run(gyro_notch, sample);
+
+	gyros->x = sample[0];
+	gyros->y = sample[1];
+	gyros->z = sample[2];
+
+	SensorsUpdateDynamicNotch(gyro_notch);
+}
+
+static void settingsUpdatedCb(UAVObjEvent * objEv, void *ctx, void *obj, int len)
+{
+	SensorSettingsData sensorSettings;
+	SensorSettingsGet(&sensorSettings);
+
+	dynnotch_create(&gyro_notch,
+			sensorSettings.DynamicNotchRange[SENSORSETTINGS_DYNAMICNOTCHRANGE_MIN],
+			sensorSettings.DynamicNotchRange[SENSORSETTINGS_DYNAMICNOTCHRANGE_MAX],
+			sensorSettings.DynamicNotchQ, sensorSettings.DynamicNotchCount,
+			1.0f / sim_imu_rate);
+}
+
 /**
   * @}
   * @}
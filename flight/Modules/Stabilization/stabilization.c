@@ -41,8 +41,9 @@
 
 #include "openpilot.h"
 #include "stabilization.h"
+#include "actuator.h"
 #include "pios_thread.h"
-#include "pios_queue.h"
+#include "blackbox.h"
 
 #include "accels.h"
 #include "actuatordesired.h"
@@ -72,9 +73,9 @@
 
 // MAX_AXES expected to be present and equal to 3
 DONT_BUILD_IF((MAX_AXES+0 != 3), stabAxisWrongCount);
+DONT_BUILD_IF((BLACKBOX_AXES != MAX_AXES), stabBlackboxAxes);
 
 // Private constants
-#define MAX_QUEUE_SIZE 1
 
 #if defined(PIOS_STABILIZATION_STACK_SIZE)
 #define STACK_SIZE_BYTES PIOS_STABILIZATION_STACK_SIZE
@@ -82,6 +83,9 @@ DONT_BUILD_IF((MAX_AXES+0 != 3), stabAxisWrongCount);
 #define STACK_SIZE_BYTES 860
 #endif
 
+// Extra room for the actuator stage when mixing directly
+#define DIRECT_MIXING_STACK_BYTES 320
+
 #define TASK_PRIORITY PIOS_THREAD_PRIO_HIGHEST
 #define FAILSAFE_TIMEOUT_MS 30
 #define COORDINATED_FLIGHT_MIN_ROLL_THRESHOLD 3.0f
@@ -121,7 +125,6 @@ static StabilizationSettingsData settings;
 static VbarSettingsData vbar_settings;
 
 static SubTrimData subTrim;
-static struct pios_queue *queue;
 
 uint16_t ident_wiggle_points;
 
@@ -173,19 +176,20 @@ static float get_throttle(StabilizationDesiredData *stabilization_desired, Syste
  */
 int32_t StabilizationStart()
 {
-	// Initialize variables
-	// Create object queue
-	queue = PIOS_Queue_Create(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
-
-	// Listen for updates.
-	//	AttitudeActualConnectQueue(queue);
-	GyrosConnectQueue(queue);
+	// Run on every gyro sample
+	if (PIOS_SCHED_RegisterTask(PIOS_SCHED_STAGE_STABILIZATION, 1) != 0)
+		return -1;
 
 	// Watchdog must be registered before starting task
 	PIOS_WDG_RegisterFlag(PIOS_WDG_STABILIZATION);
 
 	// Start main task
-	taskHandle = PIOS_Thread_Create(stabilizationTask, "Stabilization", STACK_SIZE_BYTES, NULL, TASK_PRIORITY);
+	size_t stack_bytes = STACK_SIZE_BYTES;
+
+	if (actuator_direct_mixing())
+		stack_bytes += DIRECT_MIXING_STACK_BYTES;
+
+	taskHandle = PIOS_Thread_Create(stabilizationTask, "Stabilization", stack_bytes, NULL, TASK_PRIORITY);
 	TaskMonitorAdd(TASKINFO_RUNNING_STABILIZATION, taskHandle);
 
 	return 0;
@@ -279,8 +283,6 @@ MODULE_HIPRI_INITCALL(StabilizationInitialize, StabilizationStart);
  */
 static void stabilizationTask(void* parameters)
 {
-	UAVObjEvent ev;
-
 	uint32_t timeval = PIOS_DELAY_GetRaw();
 
 	ActuatorDesiredData actuatorDesired;
@@ -372,8 +374,8 @@ static void stabilizationTask(void* parameters)
 			settings_flag = false;
 		}
 
-		// Wait until the AttitudeRaw object is updated, if a timeout then go to failsafe
-		if (PIOS_Queue_Receive(queue, &ev, FAILSAFE_TIMEOUT_MS) != true)
+		// Wait for the next gyro sample, if a timeout then go to failsafe
+		if (!PIOS_SCHED_Wait(PIOS_SCHED_STAGE_STABILIZATION, FAILSAFE_TIMEOUT_MS))
 		{
 			AlarmsSet(SYSTEMALARMS_ALARM_STABILIZATION,SYSTEMALARMS_ALARM_WARNING);
 			continue;
@@ -1005,8 +1007,35 @@ static void stabilizationTask(void* parameters)
 		// Save dT
 		actuatorDesired.UpdateTime = dT * 1000;
 
+		// With direct mixing this updates the outputs right away
+		actuator_input_ready(&actuatorDesired, timeval);
+
 		ActuatorDesiredSet(&actuatorDesired);
 
+		// Record the rate loop to the blackbox after the outputs are out
+		if (blackbox_sample_due()) {
+			static struct blackbox_sample sample;
+			AccelsData accels;
+
+			AccelsGet(&accels);
+
+			sample.time_us = PIOS_DELAY_GetuS();
+
+			for (uint8_t i = 0; i < MAX_AXES; i++) {
+				struct pid *rate_pid = &pids[PID_GROUP_RATE + i];
+
+				sample.gyro[i] = gyro_filtered[i];
+				sample.accel[i] = (&accels.x)[i];
+				sample.setpoint[i] = rateDesiredAxis[i];
+				sample.p[i] = rate_pid->pTerm;
+				sample.i[i] = rate_pid->iAccumulator;
+				sample.d[i] = rate_pid->dTerm;
+				sample.output[i] = actuatorDesiredAxis[i];
+			}
+
+			blackbox_record(&sample);
+		}
+
 		if(flightStatus.Armed != FLIGHTSTATUS_ARMED_ARMED ||
 		   (lowThrottleZeroIntegral && get_throttle(&stabDesired, &airframe_type) < 0))
 		{
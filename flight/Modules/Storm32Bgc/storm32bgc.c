@@ -174,25 +174,6 @@ union {
 
 #define X25_INIT_CRC 0xFFFF
 
-/**
- * @brief Accumulate the X.25 CRC by adding one char at a time.
- *
- * The checksum function adds the hash of one char at a time to the
- * 16 bit checksum (uint16_t).
- *
- * @param data new char to hash
- * @param crcAccum the already accumulated checksum
- **/
-static inline void crc_accumulate(uint8_t data, uint16_t *crcAccum)
-{
-	/*Accumulate one byte of data into the CRC*/
-	uint8_t tmp;
-
-	tmp = data ^ (uint8_t)(*crcAccum &0xFF);
-	tmp ^= (tmp<<4);
-	*crcAccum = (*crcAccum>>8) ^ (tmp<<8) ^ (tmp <<3) ^ (tmp>>4);
-}
-
 /**
  * @brief Calculates the X.25 checksum on a byte buffer
  *
@@ -202,24 +183,8 @@ static inline void crc_accumulate(uint8_t data, uint16_t *crcAccum)
  **/
 static inline uint16_t crc_calculate(uint8_t* pBuffer, int length)
 {
-	// For a "message" of length bytes contained in the unsigned char array
-	// pointed to by pBuffer, calculate the CRC
-	// crcCalculate(unsigned char* pBuffer, int length, unsigned short* checkConst) < not needed
-
-	uint16_t crcTmp;
-	uint8_t* pTmp;
-	int i;
-
-	pTmp=pBuffer;
-
-	/* init crcTmp */
-	crcTmp = X25_INIT_CRC;
-
-	for (i = 0; i < length; i++){
-		crc_accumulate(*pTmp++, &crcTmp);
-	}
-
-	return(crcTmp);
+	// X.25 is the reflected CCITT polynomial, the same as PIOS_CRC16
+	return PIOS_CRC16_updateCRC(X25_INIT_CRC, pBuffer, length);
 }
 
 /**
@@ -48,6 +48,8 @@
 #include "manualcontrolsettings.h"
 #include "objectpersistence.h"
 #include "rfm22bstatus.h"
+#include "schedulerstats.h"
+#include "tasktiming.h"
 #include "stabilizationsettings.h"
 #include "stateestimation.h"
 #include "systemsettings.h"
@@ -151,6 +153,9 @@ static void configurationUpdatedCb(UAVObjEvent * ev, void *ctx, void *obj, int l
 
 static void systemTask(void *parameters);
 static inline void updateStats();
+#if defined(DIAG_TASKS) && !defined(PIPXTREME)
+static void updateSchedulerStats();
+#endif
 static inline void updateSystemAlarms();
 static inline void updateRfm22bStats();
 #if defined(WDG_STATS_DIAGNOSTICS)
@@ -203,6 +208,14 @@ int32_t SystemModInitialize(void)
 #if defined(DIAG_TASKS)
 	if (TaskInfoInitialize() == -1)
 		return -1;
+#if !defined(PIPXTREME)
+	if (SchedulerStatsInitialize() == -1)
+		return -1;
+#endif
+#if defined(SIM_POSIX)
+	if (TaskTimingInitialize() == -1)
+		return -1;
+#endif
 #endif
 #if defined(WDG_STATS_DIAGNOSTICS)
 	if (WatchdogStatusInitialize() == -1)
@@ -434,6 +447,8 @@ static void systemPeriodicCb(UAVObjEvent *ev, void *ctx, void *obj_data, int len
 #if defined(DIAG_TASKS)
 		// Update the task status object
 		TaskMonitorUpdateAll();
+
+		updateSchedulerStats();
 #endif
 
 #endif /* PIPXTREME */
@@ -647,6 +662,40 @@ static void configurationUpdatedCb(UAVObjEvent * ev, void *ctx, void *obj, int l
 }
 #endif
 
+#if defined(DIAG_TASKS) && !defined(PIPXTREME)
+DONT_BUILD_IF(SCHEDULERSTATS_RUNTIME_NUMELEM != PIOS_SCHED_STAGE_LAST,
+	schedulerStatsStages);
+
+/**
+ * Called periodically to update the timing of the gyro synchronous stages
+ */
+static void updateSchedulerStats()
+{
+	SchedulerStatsData schedulerStats;
+	struct pios_sched_tick_stats tick;
+
+	for (int i = 0; i < PIOS_SCHED_STAGE_LAST; i++) {
+		struct pios_sched_stage_stats stage;
+
+		PIOS_SCHED_GetStageStats(i, &stage);
+
+		schedulerStats.Runs[i] = stage.runs;
+		schedulerStats.Overruns[i] = stage.overruns;
+		schedulerStats.RunTime[i] = stage.run_time;
+		schedulerStats.MaxRunTime[i] = stage.max_run_time;
+		schedulerStats.MaxLatency[i] = stage.max_latency;
+		schedulerStats.Divider[i] = stage.divider;
+	}
+
+	PIOS_SCHED_GetTickStats(&tick);
+
+	schedulerStats.GyroPeriod = tick.period;
+	schedulerStats.MaxGyroJitter = tick.max_jitter;
+
+	SchedulerStatsSet(&schedulerStats);
+}
+#endif
+
 /**
  * Called periodically to update the WDG statistics
  */
@@ -846,12 +895,18 @@ static void updateSystemAlarms()
 		AlarmsClear(SYSTEMALARMS_ALARM_EVENTSYSTEM);
 	}
 
-	if (objStats.lastCallbackErrorID || objStats.lastQueueErrorID || evStats.lastErrorID) {
+	if (objStats.lastCallbackErrorID || objStats.lastQueueErrorID || evStats.lastErrorID ||
+			objStats.eventCallbackErrors || objStats.eventQueueErrors || evStats.eventErrors) {
 		SystemStatsData sysStats;
 		SystemStatsGet(&sysStats);
 		sysStats.EventSystemWarningID = evStats.lastErrorID;
 		sysStats.ObjectManagerCallbackID = objStats.lastCallbackErrorID;
 		sysStats.ObjectManagerQueueID = objStats.lastQueueErrorID;
+
+		// The counts are cleared above; keep totals since boot
+		sysStats.EventSystemErrors += evStats.eventErrors;
+		sysStats.ObjectManagerCallbackErrors += objStats.eventCallbackErrors;
+		sysStats.ObjectManagerQueueErrors += objStats.eventQueueErrors;
 		SystemStatsSet(&sysStats);
 	}
 #endif
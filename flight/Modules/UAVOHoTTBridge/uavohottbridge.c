@@ -801,10 +801,7 @@ uint8_t generate_warning() {
  * calculate checksum of data buffer
  */
 uint8_t calc_checksum(uint8_t *data, uint16_t size) {
-	uint16_t sum = 0;
-	for(int i = 0; i < size; i++)
-		sum += data[i];
-	return sum;
+	return PIOS_CRC_sumBytes(0, data, size);
 }
 
 /**
@@ -407,11 +407,7 @@ static int send_LTM_Sframe()
 static int send_LTM_Packet(uint8_t *LTPacket, uint8_t LTPacket_size)
 {
 	//calculate Checksum
-	uint8_t LTCrc = 0x00;
-	for (int i = 3; i < LTPacket_size-1; i++) {
-		LTCrc ^= LTPacket[i];
-	}
-	LTPacket[LTPacket_size-1] = LTCrc;
+	LTPacket[LTPacket_size-1] = PIOS_CRC_xorBytes(0, &LTPacket[3], LTPacket_size - 4);
 
 	int ret = PIOS_COM_SendBufferNonBlocking(lighttelemetryPort,
 			LTPacket, LTPacket_size);
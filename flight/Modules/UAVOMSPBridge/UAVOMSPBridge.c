@@ -220,12 +220,7 @@ static void msp_send(struct msp_bridge *m, uint8_t cmd, const uint8_t *data, siz
 	PIOS_COM_SendBuffer(m->com, buf, sizeof(buf));
 	PIOS_COM_SendBuffer(m->com, data, len);
 
-	for (int i = 0; i < len; i++) {
-		cs ^= data[i];
-	}
-	cs ^= 0;
-
-	buf[0] = cs;
+	buf[0] = PIOS_CRC_xorBytes(cs, data, len);
 	PIOS_COM_SendBuffer(m->com, buf, 1);
 }
 
@@ -253,8 +248,11 @@ static msp_state msp_state_cmd(struct msp_bridge *m, uint8_t b)
 static msp_state msp_state_fill_buf(struct msp_bridge *m, uint8_t b)
 {
 	m->cmd_data.data[m->cmd_i++] = b;
-	m->checksum ^= b;
-	return m->cmd_i == m->cmd_size ? MSP_CHECKSUM : MSP_FILLBUF;
+	if (m->cmd_i < m->cmd_size)
+		return MSP_FILLBUF;
+
+	m->checksum = PIOS_CRC_xorBytes(m->checksum, m->cmd_data.data, m->cmd_size);
+	return MSP_CHECKSUM;
 }
 
 static void msp_send_name(struct msp_bridge *m)
@@ -46,7 +46,6 @@ struct pios_ibus_dev {
 	int buf_pos;
 	int rx_timer;
 	int failsafe_timer;
-	uint16_t checksum;
 	uint16_t channel_data[PIOS_IBUS_CHANNELS];
 	uint8_t rx_buf[PIOS_IBUS_BUFLEN];
 };
@@ -175,9 +174,7 @@ static uint16_t PIOS_IBus_Receive(uintptr_t context, uint8_t *buf, uint16_t buf_
 			continue;
 
 		dev->rx_buf[dev->buf_pos++] = buf[i];
-		if (dev->buf_pos <= PIOS_IBUS_BUFLEN - 2)
-			dev->checksum -= buf[i];
-		else if (dev->buf_pos == PIOS_IBUS_BUFLEN)
+		if (dev->buf_pos == PIOS_IBUS_BUFLEN)
 			PIOS_IBus_UnpackFrame(dev);
 	}
 
@@ -207,7 +204,6 @@ out_fail:
 
 static void PIOS_IBus_ResetBuffer(struct pios_ibus_dev *dev)
 {
-	dev->checksum = 0xffff;
 	dev->buf_pos = 0;
 }
 
@@ -215,7 +211,9 @@ static void PIOS_IBus_UnpackFrame(struct pios_ibus_dev *dev)
 {
 	uint16_t rxsum = dev->rx_buf[PIOS_IBUS_BUFLEN - 1] << 8 |
 			dev->rx_buf[PIOS_IBUS_BUFLEN - 2];
-	if (dev->checksum != rxsum)
+	uint16_t checksum = 0xffff -
+			PIOS_CRC_sumBytes(0, dev->rx_buf, PIOS_IBUS_BUFLEN - 2);
+	if (checksum != rxsum)
 		goto out_fail;
 
 	uint16_t *chan = (uint16_t *)&dev->rx_buf[2];
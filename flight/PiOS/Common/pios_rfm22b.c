@@ -93,7 +93,6 @@
 #include <pios_spi_priv.h>
 #include <pios_rfm22b_priv.h>
 #include <pios_rfm22b_rcvr_priv.h>
-#include <ecc.h>
 
 /* Local Defines */
 #define STACK_SIZE_BYTES                 800
@@ -501,8 +500,8 @@ int32_t PIOS_RFM22B_Init(uint32_t * rfm22b_id, uint32_t spi_id,
 	PIOS_WDG_RegisterFlag(PIOS_WDG_RFM22B);
 #endif /* PIOS_WDG_RFM22B */
 
-	// Initialize the ECC library.
-	initialize_ecc();
+	// Initialize the error correcting code.
+	rs_init(&rfm22b_dev->rs, RS_ECC_NPARITY);
 
 	// Set the state to initializing.
 	rfm22b_dev->state = RADIO_STATE_UNINITIALIZED;
@@ -1878,12 +1877,8 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev
 
 		// The last byte is a CRC.
 		if (radio_dev->ppm_only_mode) {
-			uint8_t crc = 0;
-			for (uint8_t i = 0;
-			     i < RFM22B_PPM_NUM_CHANNELS + 1; ++i) {
-				crc = PIOS_CRC_updateByte(crc, p[i]);
-			}
-			p[RFM22B_PPM_NUM_CHANNELS + 1] = crc;
+			p[RFM22B_PPM_NUM_CHANNELS + 1] =
+			    PIOS_CRC_updateCRC(0, p, RFM22B_PPM_NUM_CHANNELS + 1);
 		}
 	}
 
@@ -1903,7 +1898,7 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev
 	// Add the error correcting code.
 	if (!radio_dev->ppm_only_mode) {
 		if (len != 0) {
-			encode_data((unsigned char *)p, len, (unsigned char *)p);
+			rs_encode(&radio_dev->rs, p, len, p);
 		} else {
 			for (uint32_t i = 0; i < RS_ECC_NPARITY; i++)
 				p[i] = EMPTY_PACKET + i;
@@ -1989,15 +1984,10 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev
 
 		// Attempt to correct any errors in the packet.
 		if (data_len > 0) {
-			decode_data((unsigned char *)p, rx_len);
-			good_packet = check_syndrome() == 0;
-
-			// We have an error.  Try to correct it.
-			if (!good_packet &&
-			    (correct_errors_erasures((unsigned char *)p, rx_len, 0, 0) != 0)) {
-				// We corrected it
-				corrected_packet = true;
-			}
+			int corrected = rs_decode(&radio_dev->rs, p, rx_len);
+
+			good_packet = corrected == 0;
+			corrected_packet = corrected > 0;
 		} else {
 			// Empty packets have specific code for ECC
 			empty_packet = true;
@@ -2027,10 +2017,7 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev
 
 		// Verify the CRC if this is a PPM only packet.
 		if (good_packet && radio_dev->ppm_only_mode) {
-			uint8_t crc = 0;
-			for (uint8_t i = 0; i < RFM22B_PPM_NUM_CHANNELS + 1; ++i) {
-				crc = PIOS_CRC_updateByte(crc, p[i]);
-			}
+			uint8_t crc = PIOS_CRC_updateCRC(0, p, RFM22B_PPM_NUM_CHANNELS + 1);
 			if (p[RFM22B_PPM_NUM_CHANNELS + 1] != crc) {
 				good_packet = false;
 				corrected_packet = false;
@@ -0,0 +1,308 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup PIOS_SCHED Gyro synchronous scheduler
+ * @brief Runs the flight control stages in lock step with the gyro
+ * @{
+ *
+ * @file       pios_sched.c
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Gyro synchronous scheduler
+ *
+ * Each time the sensors have published a gyro sample they call
+ * PIOS_SCHED_Tick, which marks the stages that are due on this sample.
+ * The stages run in the order of enum pios_sched_stage: a due stage has its
+ * task woken from PIOS_SCHED_Wait once every stage before it has finished,
+ * so each sees what the earlier ones produced.  A later stage may still be
+ * running when the next sample starts the earlier ones again.  A stage
+ * which is due again before it has run and finished is counted as an
+ * overrun and skipped rather than queued.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ ******************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <stdlib.h>
+
+#include "pios.h"
+#include "pios_sched.h"
+#include "pios_semaphore.h"
+#include "pios_mutex.h"
+
+struct sched_stage {
+	struct pios_semaphore *sema;
+
+	uint8_t divider;		//!< 0 when the stage isn't registered
+	uint8_t count;
+
+	bool pending;			//!< Due, waiting for the stages before it
+	bool busy;			//!< From release until the task waits again
+	bool active;			//!< The task has taken its release
+	uint32_t released;		//!< Raw time the task was woken
+	uint32_t started;		//!< Raw time the task got going
+
+	struct pios_sched_stage_stats stats;
+};
+
+static struct sched_stage stages[PIOS_SCHED_STAGE_LAST];
+
+//! Guards the stage state and stats, which the sensors and the stages all change
+static struct pios_mutex *lock;
+
+static struct pios_sched_tick_stats tick_stats;
+static uint32_t last_tick;
+static uint32_t period_avg_16;		//!< Average gyro period in 1/16 us
+
+static inline uint16_t clamp_us(uint32_t us)
+{
+	return (us > UINT16_MAX) ? UINT16_MAX : us;
+}
+
+/**
+ * @brief Account for one run of a stage.  Called with the lock held.
+ */
+static void account_run(struct sched_stage *s, uint32_t run_time)
+{
+	uint16_t t = clamp_us(run_time);
+
+	s->stats.runs++;
+	s->stats.run_time = (s->stats.run_time * 7 + t) / 8;
+
+	if (t > s->stats.max_run_time)
+		s->stats.max_run_time = t;
+}
+
+/**
+ * @brief Register a task which loops on PIOS_SCHED_Wait.
+ * Must be done during initialization, before the sensors start.
+ * @param[in] stage the stage it runs as
+ * @param[in] divider woken every divider'th gyro sample
+ * @returns 0 on success, -1 on failure
+ */
+int32_t PIOS_SCHED_RegisterTask(enum pios_sched_stage stage, uint8_t divider)
+{
+	PIOS_Assert(stage < PIOS_SCHED_STAGE_LAST);
+
+	if (stages[stage].divider)
+		return -1;
+
+	if (!lock) {
+		lock = PIOS_Mutex_Create();
+
+		if (!lock)
+			return -1;
+	}
+
+	if (!stages[stage].sema) {
+		stages[stage].sema = PIOS_Semaphore_Create();
+
+		if (!stages[stage].sema)
+			return -1;
+
+		/* Semaphores are created available; the task must wait for
+		 * its first gyro sample like any other */
+		PIOS_Semaphore_Take(stages[stage].sema, 0);
+	}
+
+	stages[stage].count = 0;
+	stages[stage].stats.divider = (divider ? divider : 1);
+	stages[stage].divider = (divider ? divider : 1);
+
+	return 0;
+}
+
+/**
+ * @brief Change how often a stage runs.  The new rate starts from the next
+ * gyro sample.
+ * @param[in] stage the stage
+ * @param[in] divider run every divider'th gyro sample
+ */
+void PIOS_SCHED_SetDivider(enum pios_sched_stage stage, uint8_t divider)
+{
+	PIOS_Assert(stage < PIOS_SCHED_STAGE_LAST);
+
+	if (!stages[stage].divider)
+		return;
+
+	PIOS_Mutex_Lock(lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	stages[stage].count = 0;
+	stages[stage].stats.divider = (divider ? divider : 1);
+	stages[stage].divider = (divider ? divider : 1);
+
+	PIOS_Mutex_Unlock(lock);
+}
+
+/**
+ * @brief Wake the pending stages that have nothing before them left to run.
+ * Called with the lock held.
+ */
+static void release_stages(void)
+{
+	for (int i = 0; i < PIOS_SCHED_STAGE_LAST; i++) {
+		struct sched_stage *s = &stages[i];
+
+		if (s->pending) {
+			s->pending = false;
+			s->busy = true;
+			s->released = PIOS_DELAY_GetRaw();
+			PIOS_Semaphore_Give(s->sema);
+		}
+
+		/* The stages after this one wait for its output */
+		if (s->busy)
+			break;
+	}
+}
+
+/**
+ * @brief Finish this run of a task stage and wait until it is due again.
+ * @param[in] stage the stage of the calling task
+ * @param[in] timeout_ms how long to wait for the gyro
+ * @returns true when woken to run, false on timeout
+ */
+bool PIOS_SCHED_Wait(enum pios_sched_stage stage, uint32_t timeout_ms)
+{
+	PIOS_Assert(stage < PIOS_SCHED_STAGE_LAST);
+
+	struct sched_stage *s = &stages[stage];
+
+	PIOS_Assert(s->sema);
+
+	if (s->active) {
+		s->active = false;
+
+		PIOS_Mutex_Lock(lock, PIOS_MUTEX_TIMEOUT_MAX);
+		account_run(s, PIOS_DELAY_DiffuS(s->started));
+		s->busy = false;
+		release_stages();
+		PIOS_Mutex_Unlock(lock);
+	}
+
+	if (!PIOS_Semaphore_Take(s->sema, timeout_ms))
+		return false;
+
+	s->active = true;
+	s->started = PIOS_DELAY_GetRaw();
+
+	PIOS_Mutex_Lock(lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	uint16_t latency = clamp_us(PIOS_DELAY_DiffuS2(s->released, s->started));
+
+	if (latency > s->stats.max_latency)
+		s->stats.max_latency = latency;
+
+	PIOS_Mutex_Unlock(lock);
+
+	return true;
+}
+
+/**
+ * @brief Start the stages that are due on this gyro sample.  Must only be
+ * called from one thread, once each gyro sample has been published.
+ */
+void PIOS_SCHED_Tick(void)
+{
+	uint32_t now = PIOS_DELAY_GetRaw();
+
+	if (tick_stats.ticks) {
+		uint16_t period = clamp_us(PIOS_DELAY_DiffuS2(last_tick, now));
+
+		if (period_avg_16) {
+			uint16_t jitter = abs((int32_t) period - tick_stats.period);
+
+			if (jitter > tick_stats.max_jitter)
+				tick_stats.max_jitter = jitter;
+
+			period_avg_16 += period - (period_avg_16 + 8) / 16;
+		} else {
+			period_avg_16 = period * 16;
+		}
+
+		tick_stats.period = (period_avg_16 + 8) / 16;
+	}
+
+	last_tick = now;
+	tick_stats.ticks++;
+
+	if (!lock)
+		return;
+
+	PIOS_Mutex_Lock(lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	for (int i = 0; i < PIOS_SCHED_STAGE_LAST; i++) {
+		struct sched_stage *s = &stages[i];
+
+		if (!s->divider || ++s->count < s->divider)
+			continue;
+
+		s->count = 0;
+
+		if (s->pending || s->busy)
+			s->stats.overruns++;
+		else
+			s->pending = true;
+	}
+
+	release_stages();
+
+	PIOS_Mutex_Unlock(lock);
+}
+
+/**
+ * @brief Get the timing of a stage.  The maximums are reset, so they cover
+ * the time since the last call.
+ * @param[in] stage the stage
+ * @param[out] stats the timing
+ */
+void PIOS_SCHED_GetStageStats(enum pios_sched_stage stage,
+		struct pios_sched_stage_stats *stats)
+{
+	PIOS_Assert(stage < PIOS_SCHED_STAGE_LAST);
+
+	if (!lock) {
+		*stats = stages[stage].stats;
+		return;
+	}
+
+	PIOS_Mutex_Lock(lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	*stats = stages[stage].stats;
+
+	stages[stage].stats.max_run_time = 0;
+	stages[stage].stats.max_latency = 0;
+
+	PIOS_Mutex_Unlock(lock);
+}
+
+/**
+ * @brief Get the timing of the gyro samples driving the scheduler.  The
+ * maximum jitter is reset, so it covers the time since the last call.
+ * @param[out] stats the timing
+ */
+void PIOS_SCHED_GetTickStats(struct pios_sched_tick_stats *stats)
+{
+	*stats = tick_stats;
+
+	tick_stats.max_jitter = 0;
+}
+
+/**
+  * @}
+  * @}
+  */
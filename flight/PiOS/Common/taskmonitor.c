@@ -28,6 +28,12 @@
 //#include "taskmonitor.h"
 #include "pios_mutex.h"
 
+#if defined(SIM_POSIX)
+#include "misc_math.h"
+#include "pios_thread_posix.h"
+#include "tasktiming.h"
+#endif
+
 // Private constants
 
 // Private types
@@ -51,6 +57,8 @@ int32_t TaskMonitorInitialize(void)
 #if defined(DIAG_TASKS)
 #if defined(PIOS_INCLUDE_CHIBIOS)
 	lastMonitorTime = halGetCounterValue();
+#elif defined(SIM_POSIX)
+	lastMonitorTime = PIOS_DELAY_GetRaw();
 #endif /* defined(PIOS_INCLUDE_CHIBIOS) */
 #endif
 	return 0;
@@ -112,6 +120,9 @@ void TaskMonitorUpdateAll(void)
 {
 #if defined(DIAG_TASKS)
 	TaskInfoData data;
+#if defined(SIM_POSIX)
+	TaskTimingData timing;
+#endif
 	int n;
 
 	// Lock
@@ -127,6 +138,9 @@ void TaskMonitorUpdateAll(void)
 	 */
 #if defined(PIOS_INCLUDE_CHIBIOS)
 	currentTime = hal_lld_get_counter_value();
+#elif defined(SIM_POSIX)
+	/* Thread run times are in CPU microseconds */
+	currentTime = PIOS_DELAY_GetRaw();
 #endif /* defined(PIOS_INCLUDE_CHIBIOS) */
 	deltaTime = ((currentTime - lastMonitorTime) / 100) ? : 1; /* avoid divide-by-zero if the interval is too small */
 	lastMonitorTime = currentTime;
@@ -139,18 +153,34 @@ void TaskMonitorUpdateAll(void)
 			data.Running[n] = TASKINFO_RUNNING_TRUE;
 			data.StackRemaining[n] = PIOS_Thread_Get_Stack_Usage(handles[n]);
 			/* Generate run time stats */
+#if defined(SIM_POSIX)
+			/* On a virtual clock CPU time can outrun the interval */
+			data.RunningTime[n] = MIN(PIOS_Thread_Get_Runtime(handles[n]) / deltaTime, 100);
+#else
 			data.RunningTime[n] = PIOS_Thread_Get_Runtime(handles[n]) / deltaTime;
+#endif
+#if defined(SIM_POSIX)
+			timing.WakeLatency[n] = MIN(PIOS_Thread_Get_Wake_Latency(handles[n]), UINT16_MAX);
+			timing.ContextSwitches[n] = MIN(PIOS_Thread_Get_Context_Switches(handles[n]), UINT16_MAX);
+#endif
 		}
 		else
 		{
 			data.Running[n] = TASKINFO_RUNNING_FALSE;
 			data.StackRemaining[n] = 0;
 			data.RunningTime[n] = 0;
+#if defined(SIM_POSIX)
+			timing.WakeLatency[n] = 0;
+			timing.ContextSwitches[n] = 0;
+#endif
 		}
 	}
 
 	// Update object
 	TaskInfoSet(&data);
+#if defined(SIM_POSIX)
+	TaskTimingSet(&timing);
+#endif
 
 	// Done
 	PIOS_Mutex_Unlock(lock);
@@ -38,3 +38,6 @@ uint16_t PIOS_CRC16_CCITT_updateCRC(uint16_t crc, const uint8_t *data, uint32_t
 
 uint32_t PIOS_CRC32_updateByte(uint32_t crc, const uint8_t data);
 uint32_t PIOS_CRC32_updateCRC(uint32_t crc, const uint8_t* data, int32_t length);
+
+uint32_t PIOS_CRC_sumBytes(uint32_t sum, const uint8_t *data, int32_t length);
+uint8_t PIOS_CRC_xorBytes(uint8_t sum, const uint8_t *data, int32_t length);
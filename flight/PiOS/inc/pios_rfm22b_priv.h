@@ -39,6 +39,7 @@
 #include "pios_rfm22b_regs.h"
 #include "pios_semaphore.h"
 #include "pios_thread.h"
+#include <reedsolomon.h>
 
 // External type definitions
 
@@ -189,6 +190,9 @@ struct pios_rfm22b_dev {
 	// The device ID
 	uint32_t deviceID;
 
+	// The error correcting code for the packet payload
+	struct rs_code rs;
+
 	// The coodinator ID (0 if this modem is a coordinator).
 	uint32_t coordinatorID;
 
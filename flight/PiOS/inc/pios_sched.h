@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup PIOS_SCHED Gyro synchronous scheduler
+ * @brief Runs the flight control stages in lock step with the gyro
+ * @{
+ *
+ * @file       pios_sched.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Gyro synchronous scheduler
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ ******************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PIOS_SCHED_H
+#define PIOS_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * The stages, in the order they are run each gyro sample; a stage isn't
+ * woken until the ones before it have finished.  The order must match the
+ * element names of the SchedulerStats object.
+ */
+enum pios_sched_stage {
+	PIOS_SCHED_STAGE_STABILIZATION,
+	PIOS_SCHED_STAGE_ATTITUDE,
+	PIOS_SCHED_STAGE_LAST
+};
+
+//! Timing of one stage, in microseconds
+struct pios_sched_stage_stats {
+	uint32_t runs;
+	uint32_t overruns;	//!< times the stage was due and hadn't finished
+	uint16_t run_time;	//!< average
+	uint16_t max_run_time;
+	uint16_t max_latency;	//!< longest from its release to the task waking
+	uint8_t divider;
+};
+
+//! Timing of the gyro samples that drive the scheduler, in microseconds
+struct pios_sched_tick_stats {
+	uint32_t ticks;
+	uint16_t period;	//!< average
+	uint16_t max_jitter;	//!< largest difference of a period from average
+};
+
+//! Wake a task waiting in PIOS_SCHED_Wait every divider'th gyro sample
+int32_t PIOS_SCHED_RegisterTask(enum pios_sched_stage stage, uint8_t divider);
+
+//! Change how often a stage runs
+void PIOS_SCHED_SetDivider(enum pios_sched_stage stage, uint8_t divider);
+
+//! Called by a task stage when it has finished, to wait until it is next due
+bool PIOS_SCHED_Wait(enum pios_sched_stage stage, uint32_t timeout_ms);
+
+//! Called by the sensors once each gyro sample has been published
+void PIOS_SCHED_Tick(void);
+
+//! Get the timing of a stage, resetting the maximums
+void PIOS_SCHED_GetStageStats(enum pios_sched_stage stage,
+		struct pios_sched_stage_stats *stats);
+
+//! Get the timing of the gyro samples, resetting the maximum jitter
+void PIOS_SCHED_GetTickStats(struct pios_sched_tick_stats *stats);
+
+#endif /* PIOS_SCHED_H */
+
+/**
+  * @}
+  * @}
+  */
@@ -103,6 +103,7 @@
 #endif
 #if defined(PIOS_INCLUDE_RTOS)
 #include <pios_sensors.h>
+#include <pios_sched.h>
 #endif
 #include <pios_wdg.h>
 
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file       pios_thread_posix.h
+ * @author     dRonin, http://dRonin.org, Copyright (C) 2017
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup PIOS_Thread Thread Abstraction
+ * @{
+ * @brief Thread accounting and tracing only available on posix
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PIOS_THREAD_POSIX_H_
+#define PIOS_THREAD_POSIX_H_
+
+#include <stdint.h>
+
+#include <pios_thread.h>
+
+//! Start writing a Chrome trace (chrome://tracing, ui.perfetto.dev) to path
+int32_t PIOS_Thread_Trace_Open(const char *path);
+
+//! Called by the PiOS primitives just before the calling thread blocks
+void PIOS_Thread_Blocking(void);
+
+//! Called by the PiOS primitives once the calling thread runs again
+void PIOS_Thread_Unblocked(void);
+
+//! Latest wakeup after a PIOS_Thread_Sleep_Until deadline, in us, since the last call
+uint32_t PIOS_Thread_Get_Wake_Latency(struct pios_thread *threadp);
+
+//! Context switches of the thread since the last call
+uint32_t PIOS_Thread_Get_Context_Switches(struct pios_thread *threadp);
+
+#endif /* PIOS_THREAD_POSIX_H_ */
+
+/**
+  * @}
+  * @}
+  */
@@ -0,0 +1,86 @@
+/**
+ ******************************************************************************
+ * @file       pios_vtime.h
+ * @author     dRonin, http://dRonin.org, Copyright (C) 2017
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup PIOS_VTIME Virtual time
+ * @{
+ * @brief Runs the posix PiOS threads one at a time against a virtual clock
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PIOS_VTIME_H_
+#define PIOS_VTIME_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+//! Deadline of a wait without a timeout
+#define PIOS_VTIME_NEVER UINT64_MAX
+
+struct pios_vtime_thread;
+
+extern bool pios_vtime_enabled;
+
+//! Whether the clock is virtual.  Fixed before the first thread starts.
+static inline bool PIOS_VTIME_Enabled(void)
+{
+	return pios_vtime_enabled;
+}
+
+//! Switch to virtual time; must be done before any thread is created
+void PIOS_VTIME_Enable(void);
+
+//! The virtual time in microseconds
+uint64_t PIOS_VTIME_Now(void);
+
+//! The virtual time a wait of timeout_ms from now ends
+uint64_t PIOS_VTIME_Deadline(uint32_t timeout_ms);
+
+//! Let virtual time pass without giving up the CPU, as a busy wait does
+void PIOS_VTIME_Advance(uint32_t us);
+
+//! Add a thread; it first runs from PIOS_VTIME_Thread_Enter
+struct pios_vtime_thread *PIOS_VTIME_Thread_Add(uint8_t prio);
+
+//! Called by a new thread before it does anything else
+void PIOS_VTIME_Thread_Enter(struct pios_vtime_thread *vt);
+
+//! Called by a thread as it exits
+void PIOS_VTIME_Thread_Exit(void);
+
+//! Like pthread_cond_timedwait, for waits on the PiOS primitives
+bool PIOS_VTIME_Cond_Wait(const void *channel, pthread_mutex_t *mutex,
+		uint64_t deadline);
+
+//! Sleep until a virtual time
+void PIOS_VTIME_Sleep_Until(uint64_t deadline);
+
+//! Make threads waiting on channel runnable
+void PIOS_VTIME_Wake(const void *channel);
+
+//! Called around system calls that may block, to let other threads run
+void PIOS_VTIME_IO_Begin(void);
+void PIOS_VTIME_IO_End(void);
+
+#endif /* PIOS_VTIME_H_ */
+
+/**
+  * @}
+  * @}
+  */
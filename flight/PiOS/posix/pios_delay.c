@@ -30,6 +30,7 @@
 
 /* Project Includes */
 #include "pios.h"
+#include "pios_vtime.h"
 #include "time.h"
 
 #include <time.h>
@@ -71,6 +72,10 @@ int clock_gettime(clockid_t clk_id, struct timespec *t)
 
 #endif /* CLOCK_MONOTONIC */
 static uint32_t get_monotonic_us_time(void) {
+	if (PIOS_VTIME_Enabled()) {
+		return PIOS_VTIME_Now();
+	}
+
 	clockid_t id = CLOCK_MONOTONIC;
 
 #ifdef CLOCK_BOOTTIME
@@ -115,6 +120,11 @@ int32_t PIOS_DELAY_Init(void)
 */
 int32_t PIOS_DELAY_WaituS(uint32_t uS)
 {
+	if (PIOS_VTIME_Enabled()) {
+		PIOS_VTIME_Advance(uS);
+		return 0;
+	}
+
 	struct timespec wait,rest;
 	wait.tv_sec=0;
 	wait.tv_nsec=1000*uS;
@@ -139,6 +149,11 @@ int32_t PIOS_DELAY_WaituS(uint32_t uS)
 */
 int32_t PIOS_DELAY_WaitmS(uint32_t mS)
 {
+	if (PIOS_VTIME_Enabled()) {
+		PIOS_VTIME_Advance(mS * 1000);
+		return 0;
+	}
+
 	struct timespec wait,rest;
 	wait.tv_sec=mS/1000;
 	wait.tv_nsec=(mS%1000)*1000000;
@@ -156,6 +171,11 @@ uint32_t PIOS_DELAY_GetRaw()
 	return raw_us;
 }
 
+uint32_t PIOS_DELAY_GetuS()
+{
+	return PIOS_DELAY_GetRaw();
+}
+
 uint32_t PIOS_DELAY_DiffuS(uint32_t ref)
 {
 	return PIOS_DELAY_DiffuS2(ref, PIOS_DELAY_GetRaw());
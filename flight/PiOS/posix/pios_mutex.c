@@ -30,6 +30,7 @@
 
 #include <pios.h>
 #include <pios_mutex.h>
+#include <pios_vtime.h>
 
 struct pios_mutex {
 	pthread_mutex_t mutex;
@@ -67,7 +68,16 @@ bool PIOS_Mutex_Lock(struct pios_mutex *mtx, uint32_t timeout_ms)
 {
 	int ret;
 
-	if (timeout_ms >= PIOS_MUTEX_TIMEOUT_MAX) {
+	if (PIOS_VTIME_Enabled()) {
+		/* The holder may be switched out, so never block on it here */
+		uint64_t deadline = PIOS_VTIME_Deadline(timeout_ms);
+
+		while ((ret = pthread_mutex_trylock(&mtx->mutex))) {
+			if (!PIOS_VTIME_Cond_Wait(mtx, NULL, deadline)) {
+				break;
+			}
+		}
+	} else if (timeout_ms >= PIOS_MUTEX_TIMEOUT_MAX) {
 		ret = pthread_mutex_lock(&mtx->mutex);
 
 		PIOS_Assert(!ret);
@@ -109,6 +119,8 @@ bool PIOS_Mutex_Unlock(struct pios_mutex *mtx)
 
 	PIOS_Assert(!ret);
 
+	PIOS_VTIME_Wake(mtx);
+
 	return true;
 }
 
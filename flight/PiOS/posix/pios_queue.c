@@ -30,6 +30,8 @@
 
 #include <pios_queue.h>
 #include <pios_thread.h>
+#include <pios_thread_posix.h>
+#include <pios_vtime.h>
 
 struct pios_queue {
 #define QUEUE_MAGIC 75657551	/* 'Queu' */
@@ -104,8 +106,11 @@ bool PIOS_Queue_Send(struct pios_queue *queuep,
 	PIOS_Assert(queuep->magic == QUEUE_MAGIC);
 
 	struct timespec abstime;
+	uint64_t deadline = 0;
 
-	if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+	if (PIOS_VTIME_Enabled()) {
+		deadline = PIOS_VTIME_Deadline(timeout_ms);
+	} else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
 		clock_gettime(CLOCK_REALTIME, &abstime);
 
 		abstime.tv_nsec += (timeout_ms % 1000) * 1000000;
@@ -120,21 +125,34 @@ bool PIOS_Queue_Send(struct pios_queue *queuep,
 	pthread_mutex_lock(&queuep->mutex);
 
 	while (!circ_queue_write_data(queuep->queue, itemp, 1)) {
-		if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
-			if (pthread_cond_timedwait(&queuep->cond,
-					&queuep->mutex, &abstime)) {
-				pthread_mutex_unlock(&queuep->mutex);
-				return false;
-			}
+		int ret = 0;
+
+		PIOS_Thread_Blocking();
+
+		if (PIOS_VTIME_Enabled()) {
+			ret = !PIOS_VTIME_Cond_Wait(queuep, &queuep->mutex,
+					deadline);
+		} else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+			ret = pthread_cond_timedwait(&queuep->cond,
+					&queuep->mutex, &abstime);
 		} else {
 			pthread_cond_wait(&queuep->cond, &queuep->mutex);
 		}
+
+		PIOS_Thread_Unblocked();
+
+		if (ret) {
+			pthread_mutex_unlock(&queuep->mutex);
+			return false;
+		}
 	}
 
 	pthread_cond_broadcast(&queuep->cond);
 
 	pthread_mutex_unlock(&queuep->mutex);
 
+	PIOS_VTIME_Wake(queuep);
+
 	return true;
 }
 
@@ -156,8 +174,11 @@ bool PIOS_Queue_Receive(struct pios_queue *queuep,
 	PIOS_Assert(queuep->magic == QUEUE_MAGIC);
 
 	struct timespec abstime;
+	uint64_t deadline = 0;
 
-	if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+	if (PIOS_VTIME_Enabled()) {
+		deadline = PIOS_VTIME_Deadline(timeout_ms);
+	} else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
 		clock_gettime(CLOCK_REALTIME, &abstime);
 
 		abstime.tv_nsec += (timeout_ms % 1000) * 1000000;
@@ -172,21 +193,34 @@ bool PIOS_Queue_Receive(struct pios_queue *queuep,
 	pthread_mutex_lock(&queuep->mutex);
 
 	while (!circ_queue_read_data(queuep->queue, itemp, 1)) {
-		if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
-			if (pthread_cond_timedwait(&queuep->cond,
-					&queuep->mutex, &abstime)) {
-				pthread_mutex_unlock(&queuep->mutex);
-				return false;
-			}
+		int ret = 0;
+
+		PIOS_Thread_Blocking();
+
+		if (PIOS_VTIME_Enabled()) {
+			ret = !PIOS_VTIME_Cond_Wait(queuep, &queuep->mutex,
+					deadline);
+		} else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+			ret = pthread_cond_timedwait(&queuep->cond,
+					&queuep->mutex, &abstime);
 		} else {
 			pthread_cond_wait(&queuep->cond, &queuep->mutex);
 		}
+
+		PIOS_Thread_Unblocked();
+
+		if (ret) {
+			pthread_mutex_unlock(&queuep->mutex);
+			return false;
+		}
 	}
 
 	pthread_cond_broadcast(&queuep->cond);
 
 	pthread_mutex_unlock(&queuep->mutex);
 
+	PIOS_VTIME_Wake(queuep);
+
 	return true;
 }
 
@@ -28,6 +28,8 @@
 
 #include <pios.h>
 #include <pios_semaphore.h>
+#include <pios_thread_posix.h>
+#include <pios_vtime.h>
 
 struct pios_semaphore {
 #define SEMAPHORE_MAGIC 0x616d6553	/* 'Sema' */
@@ -75,8 +77,11 @@ bool PIOS_Semaphore_Take(struct pios_semaphore *sema, uint32_t timeout_ms)
 	PIOS_Assert(sema->magic == SEMAPHORE_MAGIC);
 
         struct timespec abstime;
+        uint64_t deadline = 0;
 
-        if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+        if (PIOS_VTIME_Enabled()) {
+                deadline = PIOS_VTIME_Deadline(timeout_ms);
+        } else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
                 clock_gettime(CLOCK_REALTIME, &abstime);
 
                 abstime.tv_nsec += (timeout_ms % 1000) * 1000000;
@@ -91,15 +96,26 @@ bool PIOS_Semaphore_Take(struct pios_semaphore *sema, uint32_t timeout_ms)
         pthread_mutex_lock(&sema->mutex);
 
         while (!sema->given) {
-                if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
-                        if (pthread_cond_timedwait(&sema->cond,
-                                        &sema->mutex, &abstime)) {
-                                pthread_mutex_unlock(&sema->mutex);
-                                return false;
-                        }
+                int ret = 0;
+
+                PIOS_Thread_Blocking();
+
+                if (PIOS_VTIME_Enabled()) {
+                        ret = !PIOS_VTIME_Cond_Wait(sema, &sema->mutex,
+                                        deadline);
+                } else if (timeout_ms != PIOS_QUEUE_TIMEOUT_MAX) {
+                        ret = pthread_cond_timedwait(&sema->cond,
+                                        &sema->mutex, &abstime);
                 } else {
                         pthread_cond_wait(&sema->cond, &sema->mutex);
                 }
+
+                PIOS_Thread_Unblocked();
+
+                if (ret) {
+                        pthread_mutex_unlock(&sema->mutex);
+                        return false;
+                }
         }
 
 	sema->given = false;
@@ -125,6 +141,8 @@ bool PIOS_Semaphore_Give(struct pios_semaphore *sema)
 	
 	pthread_mutex_unlock(&sema->mutex);
 
+	PIOS_VTIME_Wake(sema);
+
 	return !old;
 }
 
@@ -57,6 +57,8 @@
 #include "pios_serial_priv.h"
 #include "pios_tcp_priv.h"
 #include "pios_thread.h"
+#include "pios_thread_posix.h"
+#include "pios_vtime.h"
 
 #include "pios_hal.h"
 #include "pios_adc_priv.h"
@@ -73,6 +75,9 @@ static bool debug_fpe=false;
 
 bool are_realtime = false;
 
+/* Rate the simulated sensors are sampled at, in Hz */
+uint16_t sim_imu_rate = 500;
+
 #ifdef PIOS_INCLUDE_SPI
 int num_spi = 0;
 uintptr_t spi_devs[16];
@@ -97,12 +102,15 @@ uintptr_t external_i2c_adapter_id;
 #endif
 
 static void Usage(char *cmdName) {
-	printf( "usage: %s [-f] [-r] [-m orientation] [-s spibase] [-d drvname:bus:id]\n"
-		"\t\t[-l logfile] [-I i2cdev] [-i drvname:bus]"
+	printf( "usage: %s [-f] [-r] [-V] [-m orientation] [-s spibase] [-d drvname:bus:id]\n"
+		"\t\t[-l logfile] [-t tracefile] [-G rate] [-I i2cdev] [-i drvname:bus]"
 		"\n"
 		"\t-f\tEnables floating point exception trapping mode\n"
 		"\t-r\tGoes realtime-class and pins all memory (requires root)\n"
+		"\t-V\tRuns on a virtual clock, as fast as possible and repeatably\n"
 		"\t-l log\tWrites simulation data to a log\n"
+		"\t-t trace\tWrites a Chrome trace of thread activity\n"
+		"\t-G rate\tSamples the simulated sensors at rate Hz, which must divide 1000\n"
 #ifdef PIOS_INCLUDE_SERIAL
 		"\t-S drvname:serialpath\tStarts a serial driver on serialpath\n"
 		"\t\t\tAvailable drivers: gps msp lighttelemetry telemetry\n"
@@ -421,6 +429,25 @@ static void go_realtime() {
 static int saved_argc;
 static char **saved_argv;
 
+/**
+ * Handles the options which must take effect before any thread is started.
+ * The rest are left to PIOS_SYS_Args.
+ */
+void PIOS_SYS_Early_Args(int argc, char *argv[]) {
+	int opt;
+
+	opterr = 0;
+
+	while ((opt = getopt(argc, argv, "frVl:t:G:s:d:S:I:i:")) != -1) {
+		if (opt == 'V') {
+			PIOS_VTIME_Enable();
+		}
+	}
+
+	opterr = 1;
+	optind = 1;
+}
+
 void PIOS_SYS_Args(int argc, char *argv[]) {
 	saved_argc = argc;
 	saved_argv = argv;
@@ -429,11 +456,14 @@ void PIOS_SYS_Args(int argc, char *argv[]) {
 
 	bool first_arg = true;
 
-	while ((opt = getopt(argc, argv, "frl:s:d:S:I:i:")) != -1) {
+	while ((opt = getopt(argc, argv, "frVl:t:G:s:d:S:I:i:")) != -1) {
 		switch (opt) {
 			case 'f':
 				debug_fpe = true;
 				break;
+			case 'V':
+				/* Handled by PIOS_SYS_Early_Args */
+				break;
 			case 'r':
 				if (!first_arg) {
 					printf("Realtime must be before hw\n");
@@ -463,6 +493,28 @@ void PIOS_SYS_Args(int argc, char *argv[]) {
 				first_arg = false;
 				break;
 			}
+			case 't':
+				if (PIOS_Thread_Trace_Open(optarg)) {
+					printf("Couldn't open trace %s\n",
+							optarg);
+					exit(1);
+				}
+				break;
+			case 'G':
+			{
+				char *endptr;
+
+				long rate = strtol(optarg, &endptr, 10);
+
+				if ((*endptr != '\0') || (rate <= 0) ||
+						(rate > 1000) || (1000 % rate)) {
+					printf("Invalid sensor rate %s\n", optarg);
+					exit(1);
+				}
+
+				sim_imu_rate = rate;
+				break;
+			}
 #ifdef PIOS_INCLUDE_SERIAL
 			case 'S':
 				if (handle_serial_device(optarg)) {
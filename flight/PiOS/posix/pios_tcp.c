@@ -40,6 +40,7 @@
 
 #include <pios_tcp_priv.h>
 #include "pios_thread.h"
+#include "pios_vtime.h"
 #include <unistd.h>
 #include <sys/types.h>
 #include <errno.h>
@@ -102,8 +103,10 @@ static void PIOS_TCP_RxTask(void *tcp_dev_n)
 	
 		do
 		{
+			PIOS_VTIME_IO_Begin();
 			tcp_dev->socket_connection = accept(tcp_dev->socket, NULL, NULL);
 			error = errno;
+			PIOS_VTIME_IO_End();
 
 			PIOS_Thread_Sleep(1);
 		} while (tcp_dev->socket_connection == INVALID_SOCKET && (error == EINTR || error == EAGAIN));
@@ -121,8 +124,10 @@ static void PIOS_TCP_RxTask(void *tcp_dev_n)
 		while (1) {
 			// Received is used to track the scoket whereas the dev variable is only updated when it can be
 
+			PIOS_VTIME_IO_Begin();
 			int result = recv(tcp_dev->socket_connection, (char *) incoming_buffer, INCOMING_BUFFER_SIZE, 0);
 			error = errno;
+			PIOS_VTIME_IO_End();
 
 			if (result > 0 && tcp_dev->rx_in_cb) {
 
@@ -25,21 +25,115 @@
 
 
 #include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sys/types.h>
+#endif
+
 #include <pios.h>
 #include <pios_thread.h>
+#include <pios_thread_posix.h>
+#include <pios_vtime.h>
 
 struct pios_thread
 {
 	pthread_t thread;
 
 	char *name;
+
+	void (*fp)(void *);
+	void *argp;
+
+	uint32_t trace_id;		//!< Thread id in the trace
+	struct pios_vtime_thread *vt;	//!< Set when running in virtual time
+	struct pios_thread *next;
+
+#ifdef __linux__
+	volatile pid_t tid;		//!< Kernel thread id, 0 until it runs
+	clockid_t cpu_clock;
+	uint64_t last_switches;
+#endif
+	uint64_t last_cpu_us;
+
+	volatile uint32_t wake_latency;	//!< Latest wakeup since it was read
+	int32_t trace_late;		//!< Lateness of the current run, or -1
+	uint64_t run_start;		//!< When the thread last stopped blocking
 };
 
+//! The calling thread, if it was made by PIOS_Thread_Create
+static __thread struct pios_thread *self;
+
+static pthread_mutex_t threads_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct pios_thread *threads;
+static uint32_t num_threads;
+
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE *trace_file;
+
+static uint64_t systime_base_us;
+
+static uint64_t monotonic_us(void)
+{
+	if (PIOS_VTIME_Enabled()) {
+		return PIOS_VTIME_Now();
+	}
+
+	struct timespec monotime;
+
+	clock_gettime(CLOCK_MONOTONIC, &monotime);
+
+	return (uint64_t) monotime.tv_sec * 1000000 + monotime.tv_nsec / 1000;
+}
+
+static uint32_t systime_ms(uint64_t now_us)
+{
+	if (!systime_base_us) {
+		systime_base_us = now_us;
+	}
+
+	return (now_us - systime_base_us) / 1000;
+}
+
+/* Must be called with trace_lock held */
+static void trace_thread_name(struct pios_thread *thread)
+{
+	fprintf(trace_file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+			"\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			thread->trace_id, thread->name);
+}
+
+static void *thread_main(void *arg)
+{
+	struct pios_thread *thread = arg;
+
+	self = thread;
+
+#ifdef __linux__
+	thread->tid = syscall(SYS_gettid);
+#endif
+
+	if (thread->vt) {
+		PIOS_VTIME_Thread_Enter(thread->vt);
+	}
+
+	thread->run_start = monotonic_us();
+
+	thread->fp(thread->argp);
+
+	PIOS_Thread_Blocking();
+	PIOS_VTIME_Thread_Exit();
+
+	return NULL;
+}
+
 struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep, size_t stack_bytes, void *argp, enum pios_thread_prio_e prio)
 {
-	struct pios_thread *thread = malloc(sizeof(*thread));
+	struct pios_thread *thread = calloc(1, sizeof(*thread));
 
 	pthread_attr_t attr;
 
@@ -61,10 +155,22 @@ struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep, si
 	}
 
 	thread->name = strdup(namep);
+	thread->fp = fp;
+	thread->argp = argp;
+	thread->trace_late = -1;
+
+	if (PIOS_VTIME_Enabled()) {
+		/* Added here rather than when it starts, so the order threads
+		 * first run in is always the same */
+		thread->vt = PIOS_VTIME_Thread_Add(prio);
+	}
 
-	void *(*thr_func)(void *) = (void *) fp;
+	/* Before it can run, since its first run may already be traced */
+	pthread_mutex_lock(&threads_lock);
+	thread->trace_id = ++num_threads;
+	pthread_mutex_unlock(&threads_lock);
 
-	int ret = pthread_create(&thread->thread, &attr, thr_func, argp);
+	int ret = pthread_create(&thread->thread, &attr, thread_main, thread);
 
 	if (ret) {
 		printf("Couldn't start thr (%s) ret=%d\n", namep, ret);
@@ -76,8 +182,26 @@ struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep, si
 
 #ifdef __linux__
 	pthread_setname_np(thread->thread, thread->name);
+
+	if (pthread_getcpuclockid(thread->thread, &thread->cpu_clock)) {
+		thread->cpu_clock = -1;
+	}
 #endif
 
+	pthread_mutex_lock(&threads_lock);
+
+	thread->next = threads;
+	threads = thread;
+
+	pthread_mutex_lock(&trace_lock);
+
+	if (trace_file) {
+		trace_thread_name(thread);
+	}
+
+	pthread_mutex_unlock(&trace_lock);
+	pthread_mutex_unlock(&threads_lock);
+
 	printf("Started thread (%s) p=%p\n", namep, &thread->thread);
 
 	return thread;
@@ -89,56 +213,98 @@ void PIOS_Thread_Delete(struct pios_thread *threadp)
 		abort();	// Only support this on "self"
 	}
 
-#if 0
-	/* Need to figure out our own thread structure to clean it up */
-	free(threadp->name);
-	free(threadp);
-#endif
+	/* The thread stays in the list; the task monitor may still hold it */
+	PIOS_Thread_Blocking();
+	PIOS_VTIME_Thread_Exit();
 
 	pthread_exit(0);
 }
 
 uint32_t PIOS_Thread_Systime(void)
 {
-	struct timespec monotime;
+	return systime_ms(monotonic_us());
+}
 
-	clock_gettime(CLOCK_MONOTONIC, &monotime);
+bool PIOS_Thread_Period_Elapsed(const uint32_t prev_systime, const uint32_t increment_ms)
+{
+	return PIOS_Thread_Systime() - prev_systime >= increment_ms;
+}
 
-	uint32_t t = monotime.tv_sec * 1000 + monotime.tv_nsec / 1000000;
+static void sleep_until_us(uint64_t deadline)
+{
+	if (PIOS_VTIME_Enabled()) {
+		PIOS_VTIME_Sleep_Until(deadline);
+		return;
+	}
 
-	static uint32_t base = 0;
+	uint64_t now_us = monotonic_us();
 
-	if (!base) {
-		base = t;
+	if (deadline > now_us) {
+		usleep(deadline - now_us);
 	}
-
-	return t - base;
 }
 
 void PIOS_Thread_Sleep(uint32_t time_ms)
 {
+	PIOS_Thread_Blocking();
+
 	if (time_ms == PIOS_THREAD_TIMEOUT_MAX) {
+		if (PIOS_VTIME_Enabled()) {
+			PIOS_VTIME_Sleep_Until(PIOS_VTIME_NEVER);
+		}
+
 		while (true) {
 			usleep(50000000); /* 50s */
 		}
 	}
 
-	usleep(1000 * time_ms);
+	sleep_until_us(monotonic_us() + 1000 * (uint64_t) time_ms);
+
+	PIOS_Thread_Unblocked();
+}
+
+static void note_wake_latency(uint64_t late_us)
+{
+	if (!self) {
+		return;
+	}
+
+	uint32_t late = (late_us > INT32_MAX) ? INT32_MAX : late_us;
+
+	if (late > self->wake_latency) {
+		self->wake_latency = late;
+	}
+
+	self->trace_late = late;
 }
 
 void PIOS_Thread_Sleep_Until(uint32_t *previous_ms, uint32_t increment_ms)
 {
 	*previous_ms += increment_ms;
 
-	uint32_t now = PIOS_Thread_Systime();
+	uint64_t now_us = monotonic_us();
+	uint32_t now = systime_ms(now_us);
 
 	uint32_t ms = *previous_ms - now;
 
 	if (ms > increment_ms) {
 		// Very late or wrapped.
+		note_wake_latency((uint64_t) (now - *previous_ms) * 1000);
+
 		*previous_ms = now;
-	} else if (ms > 0) {
-		PIOS_Thread_Sleep(ms);
+	} else {
+		/* Sleep to the start of the deadline's millisecond, rather
+		 * than ms from partway through this one */
+		uint64_t deadline = now_us - (now_us - systime_base_us) % 1000 +
+			(uint64_t) ms * 1000;
+
+		if (deadline > now_us) {
+			PIOS_Thread_Blocking();
+			sleep_until_us(deadline);
+			PIOS_Thread_Unblocked();
+		}
+
+		note_wake_latency(monotonic_us() - deadline);
 	}
 }
 
@@ -147,9 +313,213 @@ uint32_t PIOS_Thread_Get_Stack_Usage(struct pios_thread *threadp)
 	return 0;	/* XXX */
 }
 
+/**
+ * @brief Get the CPU time used by a thread.
+ * @param[in] threadp the thread
+ * @returns microseconds of CPU time since the last call
+ */
 uint32_t PIOS_Thread_Get_Runtime(struct pios_thread *threadp)
 {
+#ifdef __linux__
+	struct timespec cpu;
+
+	if (threadp->cpu_clock == -1 ||
+			clock_gettime(threadp->cpu_clock, &cpu)) {
+		return 0;
+	}
+
+	uint64_t cpu_us = (uint64_t) cpu.tv_sec * 1000000 + cpu.tv_nsec / 1000;
+	uint32_t result = cpu_us - threadp->last_cpu_us;
+
+	threadp->last_cpu_us = cpu_us;
+
+	return result;
+#else
+	(void) threadp;
+
 	return 0;	/* XXX */
+#endif
+}
+
+/**
+ * @brief Get how late a thread has woken from PIOS_Thread_Sleep_Until.
+ * @param[in] threadp the thread
+ * @returns the latest wakeup in microseconds since the last call
+ */
+uint32_t PIOS_Thread_Get_Wake_Latency(struct pios_thread *threadp)
+{
+	uint32_t result = threadp->wake_latency;
+
+	threadp->wake_latency = 0;
+
+	return result;
+}
+
+/**
+ * @brief Get how many times a thread has been switched out, whether it
+ * blocked or was preempted.
+ * @param[in] threadp the thread
+ * @returns the number of context switches since the last call
+ */
+uint32_t PIOS_Thread_Get_Context_Switches(struct pios_thread *threadp)
+{
+#ifdef __linux__
+	char path[64];
+
+	if (!threadp->tid) {
+		return 0;
+	}
+
+	snprintf(path, sizeof(path), "/proc/self/task/%d/status",
+			(int) threadp->tid);
+
+	FILE *status = fopen(path, "r");
+
+	if (!status) {
+		return 0;
+	}
+
+	char line[128];
+	uint64_t switches = 0;
+
+	while (fgets(line, sizeof(line), status)) {
+		unsigned long long n;
+
+		if (sscanf(line, "voluntary_ctxt_switches: %llu", &n) == 1 ||
+				sscanf(line, "nonvoluntary_ctxt_switches: %llu", &n) == 1) {
+			switches += n;
+		}
+	}
+
+	fclose(status);
+
+	uint32_t result = switches - threadp->last_switches;
+
+	threadp->last_switches = switches;
+
+	return result;
+#else
+	(void) threadp;
+
+	return 0;
+#endif
+}
+
+/**
+ * @brief Mark the end of the calling thread's run in the trace.
+ */
+void PIOS_Thread_Blocking(void)
+{
+	if (!self || !trace_file) {
+		return;
+	}
+
+	uint64_t now = monotonic_us();
+	uint64_t start = self->run_start;
+
+	if (!start || start > now) {
+		return;
+	}
+
+	/* A run that began before the trace was opened starts with it */
+	if (start < systime_base_us) {
+		start = systime_base_us;
+	}
+
+	pthread_mutex_lock(&trace_lock);
+
+	if (!trace_file) {
+		pthread_mutex_unlock(&trace_lock);
+		return;
+	}
+
+	fprintf(trace_file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,"
+			"\"tid\":%u,\"ts\":%llu,\"dur\":%llu",
+			self->name, self->trace_id,
+			(unsigned long long) (start - systime_base_us),
+			(unsigned long long) (now - start));
+
+	if (self->trace_late >= 0) {
+		fprintf(trace_file, ",\"args\":{\"late_us\":%d}",
+				(int) self->trace_late);
+	}
+
+	fputc('}', trace_file);
+
+	pthread_mutex_unlock(&trace_lock);
+
+	self->trace_late = -1;
+}
+
+/**
+ * @brief Mark the start of a run of the calling thread in the trace.
+ */
+void PIOS_Thread_Unblocked(void)
+{
+	if (self) {
+		self->run_start = monotonic_us();
+	}
+}
+
+static void trace_close(void)
+{
+	pthread_mutex_lock(&trace_lock);
+
+	if (trace_file) {
+		fputs("\n]\n", trace_file);
+		fclose(trace_file);
+		trace_file = NULL;
+	}
+
+	pthread_mutex_unlock(&trace_lock);
+}
+
+/**
+ * @brief Write a timeline of when each thread runs as a Chrome trace,
+ * which can be opened in chrome://tracing or ui.perfetto.dev.  Each run
+ * of a thread, from when it stops blocking in PiOS until it blocks
+ * again, is a slice; runs after PIOS_Thread_Sleep_Until are labelled with
+ * how late they started.  The closing bracket is only written on a clean
+ * exit, which the trace viewers don't need.
+ * @param[in] path the file to write
+ * @returns 0 on success, -1 on failure
+ */
+int32_t PIOS_Thread_Trace_Open(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f) {
+		return -1;
+	}
+
+	/* Make sure timestamps start from the systime base */
+	PIOS_Thread_Systime();
+
+	pthread_mutex_lock(&threads_lock);
+	pthread_mutex_lock(&trace_lock);
+
+	if (trace_file) {
+		pthread_mutex_unlock(&trace_lock);
+		pthread_mutex_unlock(&threads_lock);
+		fclose(f);
+		return -1;
+	}
+
+	trace_file = f;
+
+	fputs("[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+			"\"args\":{\"name\":\"dRonin\"}}", trace_file);
+
+	for (struct pios_thread *t = threads; t; t = t->next) {
+		trace_thread_name(t);
+	}
+
+	pthread_mutex_unlock(&trace_lock);
+	pthread_mutex_unlock(&threads_lock);
+
+	atexit(trace_close);
+
+	return 0;
 }
 
 /**
@@ -37,6 +37,7 @@
 #include <signal.h>
 #include <pios_udp_priv.h>
 #include "pios_thread.h"
+#include "pios_vtime.h"
 
 /* We need a list of UDP devices */
 
@@ -99,12 +100,16 @@ void PIOS_UDP_RxThread(void * udp_dev_n)
 		 */
 		int received;
 		udp_dev->clientLength=sizeof(udp_dev->client);
-		if ((received = recvfrom(udp_dev->socket,
+		PIOS_VTIME_IO_Begin();
+		received = recvfrom(udp_dev->socket,
 				&udp_dev->rx_buffer,
 				PIOS_UDP_RX_BUFFER_SIZE,
 				0,
 				(struct sockaddr *) &udp_dev->client,
-				(socklen_t*)&udp_dev->clientLength)) >= 0)
+				(socklen_t*)&udp_dev->clientLength);
+		PIOS_VTIME_IO_End();
+
+		if (received >= 0)
 		{
 
 			/* copy received data to buffer if possible */
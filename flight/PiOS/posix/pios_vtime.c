@@ -0,0 +1,445 @@
+/**
+ ******************************************************************************
+ * @file       pios_vtime.c
+ * @author     dRonin, http://dRonin.org, Copyright (C) 2017
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup PIOS_VTIME Virtual time
+ * @{
+ * @brief Runs the posix PiOS threads one at a time against a virtual clock
+ *
+ * In virtual time only one PiOS thread runs at once.  A thread keeps the
+ * CPU until it waits on a queue, semaphore or mutex, sleeps, or wakes a
+ * thread of higher priority; the next one is then picked by priority and,
+ * among equals, by the order they became runnable.  When every thread is
+ * waiting the clock jumps straight to the earliest timeout.  So the
+ * simulation runs as fast as the host allows, and since the order threads
+ * run in only depends on the order of events in virtual time, the same
+ * inputs give the same run.
+ *
+ * Threads blocked in system calls (the serial and network receive threads)
+ * are outside this while they wait; virtual time doesn't wait for them.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <pios.h>
+#include <pios_vtime.h>
+
+//! Virtual time starts at 1s so it never looks unset
+#define VTIME_START_US 1000000
+
+enum vt_state {
+	VT_RUNNABLE,
+	VT_RUNNING,
+	VT_WAITING,
+	VT_OUTSIDE,		//!< In a system call
+};
+
+struct pios_vtime_thread {
+	pthread_cond_t cond;
+
+	enum vt_state state;
+	uint8_t prio;
+	bool timed_out;
+
+	const void *channel;	//!< What it waits on, NULL if sleeping
+	uint64_t deadline;
+	uint32_t seq;		//!< When it became runnable or started waiting
+
+	struct pios_vtime_thread *next;
+};
+
+bool pios_vtime_enabled;
+
+static pthread_mutex_t vt_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct pios_vtime_thread *threads;
+static struct pios_vtime_thread *running;
+static uint64_t now = VTIME_START_US;
+static uint32_t seq;
+
+static __thread struct pios_vtime_thread *self;
+
+/**
+ * @brief Switch to virtual time.  Must be called before any thread is
+ * created.
+ */
+void PIOS_VTIME_Enable(void)
+{
+	pios_vtime_enabled = true;
+}
+
+uint64_t PIOS_VTIME_Now(void)
+{
+	return __atomic_load_n(&now, __ATOMIC_RELAXED);
+}
+
+uint64_t PIOS_VTIME_Deadline(uint32_t timeout_ms)
+{
+	if (timeout_ms == PIOS_QUEUE_TIMEOUT_MAX) {
+		return PIOS_VTIME_NEVER;
+	}
+
+	return PIOS_VTIME_Now() + (uint64_t) timeout_ms * 1000;
+}
+
+static void set_now(uint64_t t)
+{
+	__atomic_store_n(&now, t, __ATOMIC_RELAXED);
+}
+
+/* True if a should run before b */
+static bool runs_before(const struct pios_vtime_thread *a,
+		const struct pios_vtime_thread *b)
+{
+	if (a->prio != b->prio) {
+		return a->prio > b->prio;
+	}
+
+	return (int32_t) (a->seq - b->seq) < 0;
+}
+
+static void make_runnable(struct pios_vtime_thread *t, bool timed_out)
+{
+	t->state = VT_RUNNABLE;
+	t->timed_out = timed_out;
+	t->channel = NULL;
+	t->seq = ++seq;
+}
+
+static void expire_timeouts(void)
+{
+	/* Earliest deadline first, so their order is the same every run */
+	while (true) {
+		struct pios_vtime_thread *first = NULL;
+
+		for (struct pios_vtime_thread *t = threads; t; t = t->next) {
+			if (t->state != VT_WAITING || t->deadline > now) {
+				continue;
+			}
+
+			if (!first || t->deadline < first->deadline ||
+					(t->deadline == first->deadline &&
+					 (int32_t) (t->seq - first->seq) < 0)) {
+				first = t;
+			}
+		}
+
+		if (!first) {
+			return;
+		}
+
+		make_runnable(first, true);
+	}
+}
+
+static struct pios_vtime_thread *pick_runnable(void)
+{
+	struct pios_vtime_thread *best = NULL;
+
+	for (struct pios_vtime_thread *t = threads; t; t = t->next) {
+		if (t->state == VT_RUNNABLE && (!best || runs_before(t, best))) {
+			best = t;
+		}
+	}
+
+	return best;
+}
+
+/* Hand the CPU to the next thread.  Called with vt_lock held, by or on
+ * behalf of a thread which has stopped running. */
+static void dispatch(void)
+{
+	expire_timeouts();
+
+	struct pios_vtime_thread *next = pick_runnable();
+
+	if (!next) {
+		uint64_t earliest = PIOS_VTIME_NEVER;
+
+		for (struct pios_vtime_thread *t = threads; t; t = t->next) {
+			if (t->state == VT_WAITING && t->deadline < earliest) {
+				earliest = t->deadline;
+			}
+		}
+
+		if (earliest == PIOS_VTIME_NEVER) {
+			/* Everything waits on something outside */
+			running = NULL;
+			return;
+		}
+
+		set_now(earliest);
+		expire_timeouts();
+
+		next = pick_runnable();
+	}
+
+	next->state = VT_RUNNING;
+	running = next;
+
+	pthread_cond_signal(&next->cond);
+}
+
+/* Give up the CPU and wait to be dispatched again.  vt_lock held. */
+static void switch_out(void)
+{
+	dispatch();
+
+	while (running != self) {
+		pthread_cond_wait(&self->cond, &vt_lock);
+	}
+}
+
+/**
+ * @brief Add a thread.  It is runnable from now, but first runs when it
+ * calls PIOS_VTIME_Thread_Enter and is dispatched.
+ * @param[in] prio its priority
+ * @returns the thread's state, to pass to PIOS_VTIME_Thread_Enter
+ */
+struct pios_vtime_thread *PIOS_VTIME_Thread_Add(uint8_t prio)
+{
+	struct pios_vtime_thread *vt = calloc(1, sizeof(*vt));
+
+	if (!vt || pthread_cond_init(&vt->cond, NULL)) {
+		abort();
+	}
+
+	vt->prio = prio;
+
+	pthread_mutex_lock(&vt_lock);
+
+	make_runnable(vt, false);
+
+	/* Keep the list in creation order; ties are broken by it */
+	struct pios_vtime_thread **tail = &threads;
+
+	while (*tail) {
+		tail = &(*tail)->next;
+	}
+
+	*tail = vt;
+
+	if (!running) {
+		dispatch();
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+
+	return vt;
+}
+
+void PIOS_VTIME_Thread_Enter(struct pios_vtime_thread *vt)
+{
+	pthread_mutex_lock(&vt_lock);
+
+	self = vt;
+
+	while (running != self) {
+		pthread_cond_wait(&self->cond, &vt_lock);
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+}
+
+void PIOS_VTIME_Thread_Exit(void)
+{
+	if (!self) {
+		return;
+	}
+
+	pthread_mutex_lock(&vt_lock);
+
+	for (struct pios_vtime_thread **t = &threads; *t; t = &(*t)->next) {
+		if (*t == self) {
+			*t = self->next;
+			break;
+		}
+	}
+
+	if (running == self) {
+		dispatch();
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+
+	/* Nothing else can refer to it now */
+	pthread_cond_destroy(&self->cond);
+	free(self);
+	self = NULL;
+}
+
+/**
+ * @brief Atomically release mutex and wait for channel to be woken or the
+ * deadline to pass, then take mutex again.
+ * @param[in] channel what to wait on
+ * @param[in] mutex held by the caller, or NULL
+ * @param[in] deadline virtual time to give up, or PIOS_VTIME_NEVER
+ * @returns true if woken, false on timeout
+ */
+bool PIOS_VTIME_Cond_Wait(const void *channel, pthread_mutex_t *mutex,
+		uint64_t deadline)
+{
+	bool woken;
+
+	pthread_mutex_lock(&vt_lock);
+
+	if (mutex) {
+		pthread_mutex_unlock(mutex);
+	}
+
+	if (deadline <= now) {
+		woken = false;
+	} else if (!self) {
+		/* Not a PiOS thread; poll while the others get on */
+		pthread_mutex_unlock(&vt_lock);
+		usleep(1000);
+		pthread_mutex_lock(&vt_lock);
+
+		woken = deadline > now;
+	} else {
+		self->state = VT_WAITING;
+		self->channel = channel;
+		self->deadline = deadline;
+		self->seq = ++seq;
+
+		switch_out();
+
+		woken = !self->timed_out;
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+
+	if (mutex) {
+		pthread_mutex_lock(mutex);
+	}
+
+	return woken;
+}
+
+void PIOS_VTIME_Sleep_Until(uint64_t deadline)
+{
+	if (!self) {
+		uint64_t t = PIOS_VTIME_Now();
+
+		if (deadline != PIOS_VTIME_NEVER && deadline > t) {
+			usleep(deadline - t);
+		}
+
+		return;
+	}
+
+	PIOS_VTIME_Cond_Wait(NULL, NULL, deadline);
+}
+
+/**
+ * @brief Make the threads waiting on a channel runnable.  If one of them
+ * has a higher priority than the caller it runs straight away, as it would
+ * be switched to on the flight controller.
+ * @param[in] channel the channel
+ */
+void PIOS_VTIME_Wake(const void *channel)
+{
+	if (!pios_vtime_enabled) {
+		return;
+	}
+
+	bool preempt = false;
+
+	pthread_mutex_lock(&vt_lock);
+
+	for (struct pios_vtime_thread *t = threads; t; t = t->next) {
+		if (t->state == VT_WAITING && channel && t->channel == channel) {
+			make_runnable(t, false);
+
+			if (self && t->prio > self->prio) {
+				preempt = true;
+			}
+		}
+	}
+
+	if (!running) {
+		dispatch();
+	} else if (preempt && running == self) {
+		make_runnable(self, false);
+		switch_out();
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+}
+
+/**
+ * @brief Let virtual time pass while keeping the CPU.
+ * @param[in] us how long
+ */
+void PIOS_VTIME_Advance(uint32_t us)
+{
+	pthread_mutex_lock(&vt_lock);
+
+	set_now(now + us);
+
+	pthread_mutex_unlock(&vt_lock);
+}
+
+/**
+ * @brief Step outside virtual time before a system call that may block,
+ * so the other threads carry on without waiting for it.
+ */
+void PIOS_VTIME_IO_Begin(void)
+{
+	if (!pios_vtime_enabled || !self) {
+		return;
+	}
+
+	pthread_mutex_lock(&vt_lock);
+
+	self->state = VT_OUTSIDE;
+	dispatch();
+
+	pthread_mutex_unlock(&vt_lock);
+}
+
+/**
+ * @brief Come back from a system call and wait for a turn to run.
+ */
+void PIOS_VTIME_IO_End(void)
+{
+	if (!pios_vtime_enabled || !self) {
+		return;
+	}
+
+	pthread_mutex_lock(&vt_lock);
+
+	make_runnable(self, false);
+
+	if (!running) {
+		dispatch();
+	}
+
+	while (running != self) {
+		pthread_cond_wait(&self->cond, &vt_lock);
+	}
+
+	pthread_mutex_unlock(&vt_lock);
+}
+
+/**
+  * @}
+  * @}
+  */
@@ -267,7 +267,8 @@ void UAVObjClearStats()
  * Object Initialization
  ***********************/
 
-static void UAVObjInitMetaData (struct UAVOMeta * obj_meta)
+static void UAVObjInitMetaData (struct UAVOMeta * obj_meta,
+		const UAVObjMetadata * meta_defaults)
 {
 	/* Fill in the common part of the UAVO */
 	struct UAVOBase * uavo_base = &(obj_meta->base);
@@ -276,11 +277,15 @@ static void UAVObjInitMetaData (struct UAVOMeta * obj_meta)
 	uavo_base->flags.isSingle = true;
 	uavo_base->next_event     = NULL;
 
-	/* Clear the instance data carried in the UAVO */
-	memset(&(obj_meta->instance0), 0, sizeof(obj_meta->instance0));
+	/* Start the metadata from its defaults, or clear it */
+	if (meta_defaults)
+		memcpy(&(obj_meta->instance0), meta_defaults, sizeof(obj_meta->instance0));
+	else
+		memset(&(obj_meta->instance0), 0, sizeof(obj_meta->instance0));
 }
 
-static struct UAVOData * UAVObjAllocSingle(uint32_t num_bytes)
+static struct UAVOData * UAVObjAllocSingle(uint32_t num_bytes,
+		const void * defaults)
 {
 	/* Compute the complete size of the object, including the data for a single embedded instance */
 	uint32_t object_size = sizeof(struct UAVOSingle) + num_bytes;
@@ -296,14 +301,18 @@ static struct UAVOData * UAVObjAllocSingle(uint32_t num_bytes)
 	uavo_base->flags.isSingle = true;
 	uavo_base->next_event     = NULL;
 
-	/* Clear the instance data carried in the UAVO */
-	memset(&(uavo_single->instance0), 0, num_bytes);
+	/* Start the instance data carried in the UAVO from its defaults */
+	if (defaults)
+		memcpy(&(uavo_single->instance0), defaults, num_bytes);
+	else
+		memset(&(uavo_single->instance0), 0, num_bytes);
 
 	/* Give back the generic UAVO part */
 	return (&(uavo_single->uavo));
 }
 
-static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
+static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes,
+		const void * defaults)
 {
 	/* Compute the complete size of the object, including the data for a single embedded instance */
 	uint32_t object_size = sizeof(struct UAVOMulti) + num_bytes;
@@ -322,9 +331,12 @@ static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
 	/* Set up the type-specific part of the UAVO */
 	uavo_multi->num_instances = 1;
 
-	/* Clear the instance data carried in the UAVO */
+	/* Start the instance data carried in the UAVO from its defaults */
 	uavo_multi->instance0.next = NULL;
-	memset (&(uavo_multi->instance0.instance), 0, num_bytes);
+	if (defaults)
+		memcpy(&(uavo_multi->instance0.instance), defaults, num_bytes);
+	else
+		memset(&(uavo_multi->instance0.instance), 0, num_bytes);
 
 	/* Give back the generic UAVO part */
 	return (&(uavo_multi->uavo));
@@ -340,14 +352,18 @@ static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
  * \param[in] isSingleInstance Is this a single instance or multi-instance object
  * \param[in] isSettings Is this a settings object
  * \param[in] numBytes Number of bytes of object data (for one instance)
- * \param[in] initCb Default field and metadata initialization function
+ * \param[in] defaults Default field values, numBytes long, or NULL for all zero
+ * \param[in] meta_defaults Default metadata
  * \return Object handle, or NULL if failure.
+ *
+ * The defaults are copied straight into instance 0 and the metadata, so
+ * registering doesn't go through UAVObjSetInstanceData and its events.
  * \return
  */
 UAVObjHandle UAVObjRegister(uint32_t id, 
 			int32_t isSingleInstance, int32_t isSettings,
-			uint32_t num_bytes,
-			UAVObjInitializeCallback initCb)
+			uint32_t num_bytes, const void * defaults,
+			const UAVObjMetadata * meta_defaults)
 {
 	struct UAVOData * uavo_data = NULL;
 
@@ -359,9 +375,9 @@ UAVObjHandle UAVObjRegister(uint32_t id,
 
 	/* Map the various flags to one of the UAVO types we understand */
 	if (isSingleInstance) {
-		uavo_data = UAVObjAllocSingle (num_bytes);
+		uavo_data = UAVObjAllocSingle (num_bytes, defaults);
 	} else {
-		uavo_data = UAVObjAllocMulti (num_bytes);
+		uavo_data = UAVObjAllocMulti (num_bytes, defaults);
 	}
 
 	if (!uavo_data)
@@ -375,15 +391,11 @@ UAVObjHandle UAVObjRegister(uint32_t id,
 	}
 
 	/* Initialize the embedded meta UAVO */
-	UAVObjInitMetaData (&uavo_data->metaObj);
+	UAVObjInitMetaData (&uavo_data->metaObj, meta_defaults);
 
 	/* Add the newly created object to the global list of objects */
 	LL_APPEND(uavo_list, uavo_data);
 
-	/* Initialize object fields and metadata to default values */
-	if (initCb)
-		initCb((UAVObjHandle) uavo_data, 0);
-
 	/* Always try to load the meta object from flash */
 	UAVObjLoad((UAVObjHandle) &(uavo_data->metaObj), 0);
 
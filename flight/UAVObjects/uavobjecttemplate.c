@@ -45,6 +45,20 @@
 // Private variables
 static UAVObjHandle handle = NULL;
 
+$(DEFAULTFIELDS)// Default metadata, copied in on registration and by SetDefaults
+static const UAVObjMetadata defaultMetadata = {
+	.flags =
+		$(FLIGHTACCESS) << UAVOBJ_ACCESS_SHIFT |
+		$(GCSACCESS) << UAVOBJ_GCS_ACCESS_SHIFT |
+		$(FLIGHTTELEM_ACKED) << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		$(GCSTELEM_ACKED) << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		$(FLIGHTTELEM_UPDATEMODE) << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		$(GCSTELEM_UPDATEMODE) << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT,
+	.telemetryUpdatePeriod = $(FLIGHTTELEM_UPDATEPERIOD),
+	.gcsTelemetryUpdatePeriod = $(GCSTELEM_UPDATEPERIOD),
+	.loggingUpdatePeriod = $(LOGGING_UPDATEPERIOD),
+};
+
 /**
  * Initialize object.
  * \return 0 Success
@@ -58,7 +72,8 @@ int32_t $(NAME)Initialize(void)
 	
 	// Register object with the object manager
 	handle = UAVObjRegister($(NAMEUC)_OBJID,
-			$(NAMEUC)_ISSINGLEINST, $(NAMEUC)_ISSETTINGS, $(NAMEUC)_NUMBYTES, &$(NAME)SetDefaults);
+			$(NAMEUC)_ISSINGLEINST, $(NAMEUC)_ISSETTINGS, $(NAMEUC)_NUMBYTES,
+			$(DEFAULTDATA), &defaultMetadata);
 
 	// Done
 	if (handle != 0)
@@ -73,26 +88,14 @@ int32_t $(NAME)Initialize(void)
 
 static void $(NAME)SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
 	// Initialize object fields to their default values
-	$(NAME)Data data = {};
+	$(NAME)Data data = $(DEFAULTINIT);
 
-$(INITFIELDS)
 	UAVObjSetInstanceData(obj, instId, &data);
 }
 
 static void $(NAME)SetMetadataDefaults(UAVObjHandle obj) {
 	// Initialize object metadata to their default values
-	UAVObjMetadata metadata;
-	metadata.flags =
-		$(FLIGHTACCESS) << UAVOBJ_ACCESS_SHIFT |
-		$(GCSACCESS) << UAVOBJ_GCS_ACCESS_SHIFT |
-		$(FLIGHTTELEM_ACKED) << UAVOBJ_TELEMETRY_ACKED_SHIFT |
-		$(GCSTELEM_ACKED) << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
-		$(FLIGHTTELEM_UPDATEMODE) << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
-		$(GCSTELEM_UPDATEMODE) << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
-	metadata.telemetryUpdatePeriod = $(FLIGHTTELEM_UPDATEPERIOD);
-	metadata.gcsTelemetryUpdatePeriod = $(GCSTELEM_UPDATEPERIOD);
-	metadata.loggingUpdatePeriod = $(LOGGING_UPDATEPERIOD);
-	UAVObjSetMetadata(obj, &metadata);
+	UAVObjSetMetadata(obj, &defaultMetadata);
 }
 
 /**
@@ -73,6 +73,10 @@ int main(int argc, char *argv[]) {
 	g_argc = argc;
 	g_argv = argv;
 
+	/* Options like the virtual clock which must be set before any
+	 * thread starts */
+	PIOS_SYS_Early_Args(argc, argv);
+
 	/* NOTE: Do NOT modify the following start-up sequence */
 	PIOS_heap_initialize_blocks();
 
@@ -0,0 +1,14 @@
+/* Minimal pios.h for building the blackbox ring on the host */
+
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Would be from pios_debug.h but that file pulls on way too many dependencies */
+#define PIOS_Assert(x) if (!(x)) { abort(); }
+
+#define PIOS_malloc malloc
+
+#endif /* PIOS_H */
@@ -0,0 +1,466 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <math.h>		/* sinf */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "blackbox.h"
+
+}
+
+/* Decoder for the frame format, the same thing the tools do */
+
+struct decoded_frame {
+	bool key;
+	uint32_t time_us;
+	int32_t v[BLACKBOX_FIELDS];
+};
+
+class FrameDecoder {
+public:
+	FrameDecoder() : synced(false), time_us(0) {
+		memset(last, 0, sizeof(last));
+	}
+
+	/* Returns the length of the frame, with out filled in if it could be
+	 * decoded, or 0 if the frame is malformed. */
+	int decode(const uint8_t *p, int avail, bool *ok, decoded_frame *out) {
+		*ok = false;
+
+		if (avail < 2 || p[0] + 1 > avail) {
+			return 0;
+		}
+
+		int len = p[0] + 1;
+		const uint8_t *end = p + len;
+		const uint8_t *q = p + 2;
+		bool key = p[1] == BLACKBOX_FRAME_KEY;
+
+		if (!key && p[1] != BLACKBOX_FRAME_DELTA) {
+			return 0;
+		}
+
+		if (!key && !synced) {
+			/* Skip deltas until the next key frame */
+			return len;
+		}
+
+		uint32_t t = get_uvarint(&q);
+		time_us = key ? t : time_us + t;
+
+		for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+			int32_t d = unzigzag(get_uvarint(&q));
+			last[f] = key ? d : last[f] + d;
+		}
+
+		if (q != end) {
+			return 0;
+		}
+
+		synced = true;
+		*ok = true;
+		out->key = key;
+		out->time_us = time_us;
+		memcpy(out->v, last, sizeof(last));
+
+		return len;
+	}
+
+	void lost() {
+		synced = false;
+	}
+
+private:
+	static uint32_t get_uvarint(const uint8_t **p) {
+		uint32_t v = 0;
+
+		for (int shift = 0; ; shift += 7) {
+			uint8_t b = *(*p)++;
+			v |= (uint32_t) (b & 0x7f) << shift;
+			if (!(b & 0x80)) {
+				return v;
+			}
+		}
+	}
+
+	static int32_t unzigzag(uint32_t v) {
+		return (int32_t) (v >> 1) ^ -(int32_t) (v & 1);
+	}
+
+	bool synced;
+	uint32_t time_us;
+	int32_t last[BLACKBOX_FIELDS];
+};
+
+static const float scales[BLACKBOX_FIELDS / BLACKBOX_AXES] = {
+	BLACKBOX_RATE_SCALE, BLACKBOX_ACCEL_SCALE, BLACKBOX_RATE_SCALE,
+	BLACKBOX_PID_SCALE, BLACKBOX_PID_SCALE, BLACKBOX_PID_SCALE,
+	BLACKBOX_PID_SCALE,
+};
+
+/* A plausible looking flight, sample n at 1kHz: a few thousand counts of
+ * signal with a few tens of counts of noise on every field */
+static void make_sample(int n, struct blackbox_sample *s)
+{
+	float *v = s->gyro;
+
+	s->time_us = 1000000 + n * 1000 + (rand() % 7);
+
+	for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+		float t = n * 0.001f;
+		float scale = scales[f / BLACKBOX_AXES];
+
+		v[f] = 4000 / scale * sinf(t * (f + 1)) +
+			20 / scale * ((rand() % 2001) - 1000) / 1000.0f;
+	}
+}
+
+static void expect_matches(const struct blackbox_sample *s,
+		const decoded_frame *d)
+{
+	const float *v = s->gyro;
+
+	EXPECT_EQ(s->time_us, d->time_us);
+
+	for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+		float scale = scales[f / BLACKBOX_AXES];
+		EXPECT_NEAR(v[f], d->v[f] / scale, 0.5f / scale);
+	}
+}
+
+class BlackboxEncode : public testing::Test {
+};
+
+TEST_F(BlackboxEncode, RoundTrip) {
+	struct blackbox_encoder enc;
+	FrameDecoder dec;
+	uint8_t frame[BLACKBOX_MAX_FRAME];
+
+	srand(1);
+	blackbox_encoder_reset(&enc);
+
+	for (int n = 0; n < 1000; n++) {
+		struct blackbox_sample s;
+		decoded_frame d;
+		bool ok;
+
+		make_sample(n, &s);
+
+		int len = blackbox_encode(&enc, &s, frame);
+		ASSERT_LE(len, BLACKBOX_MAX_FRAME);
+		ASSERT_EQ(len, frame[0] + 1);
+
+		ASSERT_EQ(len, dec.decode(frame, len, &ok, &d));
+		ASSERT_TRUE(ok);
+		EXPECT_EQ(n % BLACKBOX_KEY_INTERVAL == 0, d.key);
+		expect_matches(&s, &d);
+	}
+}
+
+TEST_F(BlackboxEncode, Extremes) {
+	struct blackbox_encoder enc;
+	FrameDecoder dec;
+	uint8_t frame[BLACKBOX_MAX_FRAME];
+	struct blackbox_sample s;
+	decoded_frame d;
+	bool ok;
+
+	blackbox_encoder_reset(&enc);
+
+	/* Swing between the clamps, the largest deltas there can be */
+	for (int n = 0; n < 4; n++) {
+		float *v = s.gyro;
+
+		s.time_us = 0xffffff00 + n * 100;	/* wraps */
+		for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+			v[f] = ((n + f) & 1) ? 1e30f : -1e30f;
+		}
+
+		int len = blackbox_encode(&enc, &s, frame);
+		ASSERT_LE(len, BLACKBOX_MAX_FRAME);
+		ASSERT_EQ(len, dec.decode(frame, len, &ok, &d));
+		ASSERT_TRUE(ok);
+		EXPECT_EQ(s.time_us, d.time_us);
+
+		for (int f = 0; f < BLACKBOX_FIELDS; f++) {
+			EXPECT_EQ(((n + f) & 1) ? 536870912 : -536870912, d.v[f]);
+		}
+	}
+
+	/* Not a number shouldn't upset anything */
+	s.gyro[0] = nanf("");
+	int len = blackbox_encode(&enc, &s, frame);
+	ASSERT_EQ(len, dec.decode(frame, len, &ok, &d));
+	ASSERT_TRUE(ok);
+	EXPECT_EQ(0, d.v[0]);
+}
+
+TEST_F(BlackboxEncode, DeltasAreSmall) {
+	struct blackbox_encoder enc;
+	uint8_t frame[BLACKBOX_MAX_FRAME];
+	int key_bytes = 0, delta_bytes = 0, keys = 0, deltas = 0;
+
+	srand(2);
+	blackbox_encoder_reset(&enc);
+
+	for (int n = 0; n < 3200; n++) {
+		struct blackbox_sample s;
+
+		make_sample(n, &s);
+
+		int len = blackbox_encode(&enc, &s, frame);
+
+		if (frame[1] == BLACKBOX_FRAME_KEY) {
+			key_bytes += len;
+			keys++;
+		} else {
+			delta_bytes += len;
+			deltas++;
+		}
+	}
+
+	printf("key frames %d bytes, delta frames %d bytes, raw %d bytes\n",
+			key_bytes / keys, delta_bytes / deltas,
+			(int) sizeof(struct blackbox_sample));
+
+	EXPECT_LT(delta_bytes / deltas, key_bytes / keys);
+	EXPECT_LT(delta_bytes / deltas, (int) sizeof(struct blackbox_sample) / 2);
+}
+
+/* The ring can only be allocated once, so these share it */
+#define RING_LEN 1024
+
+class BlackboxRing : public testing::Test {
+protected:
+	virtual void SetUp() {
+		ASSERT_EQ(0, blackbox_init(RING_LEN));
+		srand(3);
+	}
+
+	virtual void TearDown() {
+		blackbox_stop();
+	}
+
+	/* Decode everything in buf, returning the number of frames */
+	int decode_all(FrameDecoder *dec, const uint8_t *buf, int len,
+			decoded_frame *out, int max) {
+		int n = 0;
+
+		while (len > 0) {
+			bool ok;
+			int used = dec->decode(buf, len, &ok, &out[n]);
+
+			EXPECT_GT(used, 0);
+			if (used <= 0) {
+				break;
+			}
+
+			if (ok && n < max) {
+				n++;
+			}
+
+			buf += used;
+			len -= used;
+		}
+
+		return n;
+	}
+};
+
+TEST_F(BlackboxRing, StoppedRecordsNothing) {
+	uint8_t buf[256];
+
+	EXPECT_FALSE(blackbox_sample_due());
+	EXPECT_EQ(0, blackbox_read(buf, sizeof(buf)));
+}
+
+TEST_F(BlackboxRing, Divider) {
+	int due = 0;
+
+	blackbox_start(4);
+
+	for (int n = 0; n < 400; n++) {
+		if (blackbox_sample_due()) {
+			due++;
+		}
+	}
+
+	EXPECT_EQ(100, due);
+}
+
+TEST_F(BlackboxRing, WholeFramesInChunks) {
+	static struct blackbox_sample samples[200];
+	static decoded_frame frames[200];
+	FrameDecoder dec;
+	uint8_t chunk[200];
+	int got = 0;
+
+	blackbox_start(1);
+
+	for (int n = 0; n < 200; n++) {
+		make_sample(n, &samples[n]);
+		ASSERT_TRUE(blackbox_sample_due());
+		blackbox_record(&samples[n]);
+
+		/* Drain the way the logging task does, some of the time */
+		if (n % 7 == 6) {
+			int len;
+
+			while ((len = blackbox_read(chunk, sizeof(chunk))) > 0) {
+				got += decode_all(&dec, chunk, len,
+						frames + got, 200 - got);
+			}
+		}
+	}
+
+	int len;
+	while ((len = blackbox_read(chunk, sizeof(chunk))) > 0) {
+		got += decode_all(&dec, chunk, len, frames + got, 200 - got);
+	}
+
+	EXPECT_EQ(0u, blackbox_dropped());
+	ASSERT_EQ(200, got);
+
+	for (int n = 0; n < 200; n++) {
+		expect_matches(&samples[n], &frames[n]);
+	}
+}
+
+TEST_F(BlackboxRing, ShortBuffer) {
+	struct blackbox_sample s;
+	uint8_t buf[BLACKBOX_MAX_FRAME];
+
+	blackbox_start(1);
+	make_sample(0, &s);
+	blackbox_record(&s);
+
+	/* A frame is never split */
+	EXPECT_EQ(0, blackbox_read(buf, 4));
+	EXPECT_EQ(buf[0] + 1, blackbox_read(buf, sizeof(buf)));
+}
+
+TEST_F(BlackboxRing, OverrunResyncs) {
+	static struct blackbox_sample samples[300];
+	static decoded_frame frames[300];
+	FrameDecoder dec;
+	uint8_t chunk[200];
+	int got = 0;
+
+	blackbox_start(1);
+
+	/* Far more than fits without anything reading */
+	for (int n = 0; n < 100; n++) {
+		make_sample(n, &samples[n]);
+		blackbox_record(&samples[n]);
+	}
+
+	uint32_t dropped = blackbox_dropped();
+	EXPECT_GT(dropped, 0u);
+
+	int len;
+	while ((len = blackbox_read(chunk, sizeof(chunk))) > 0) {
+		got += decode_all(&dec, chunk, len, frames + got, 300 - got);
+	}
+
+	EXPECT_EQ(100 - (int) dropped, got);
+
+	/* After the gap the first frame must be a key frame */
+	struct blackbox_sample s;
+	decoded_frame d;
+
+	make_sample(100, &s);
+	blackbox_record(&s);
+
+	len = blackbox_read(chunk, sizeof(chunk));
+	ASSERT_GT(len, 0);
+	EXPECT_EQ(BLACKBOX_FRAME_KEY, chunk[1]);
+	ASSERT_EQ(1, decode_all(&dec, chunk, len, &d, 1));
+	expect_matches(&s, &d);
+
+	EXPECT_EQ(dropped, blackbox_dropped());
+
+	/* What did get through decodes correctly */
+	for (int n = 0; n < got; n++) {
+		expect_matches(&samples[n], &frames[n]);
+	}
+}
+
+static double now_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+TEST_F(BlackboxRing, Benchmark) {
+	static struct blackbox_sample samples[1000];
+	uint8_t chunk[200];
+	const int passes = 100;
+	int bytes = 0;
+
+	for (int n = 0; n < 1000; n++) {
+		make_sample(n, &samples[n]);
+	}
+
+	blackbox_start(1);
+
+	double start = now_us();
+
+	for (int p = 0; p < passes; p++) {
+		for (int n = 0; n < 1000; n++) {
+			blackbox_record(&samples[n]);
+
+			if (n % 4 == 3) {
+				int len;
+
+				while ((len = blackbox_read(chunk, sizeof(chunk))) > 0) {
+					bytes += len;
+				}
+			}
+		}
+	}
+
+	double elapsed = now_us() - start;
+
+	printf("record: %.3f us/sample, %d bytes/sample\n",
+			elapsed / (passes * 1000), bytes / (passes * 1000));
+
+	EXPECT_EQ(0u, blackbox_dropped());
+}
@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "pios_crc.h"
+
+}
+
+/* Bit at a time reference implementations, straight from the definitions */
+
+static uint8_t ref_crc8(uint8_t poly, uint8_t crc, const uint8_t *data, int len)
+{
+	while (len--) {
+		crc ^= *data++;
+		for (int i = 0; i < 8; i++)
+			crc = (crc & 0x80) ? (crc << 1) ^ poly : crc << 1;
+	}
+	return crc;
+}
+
+static uint16_t ref_crc16_reflected(uint16_t crc, const uint8_t *data, int len)
+{
+	while (len--) {
+		crc ^= *data++;
+		for (int i = 0; i < 8; i++)
+			crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+	}
+	return crc;
+}
+
+static uint16_t ref_crc16_ccitt(uint16_t crc, const uint8_t *data, int len)
+{
+	while (len--) {
+		crc ^= *data++ << 8;
+		for (int i = 0; i < 8; i++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}
+
+static uint32_t ref_crc32(uint32_t crc, const uint8_t *data, int len)
+{
+	while (len--) {
+		crc ^= (uint32_t)*data++ << 24;
+		for (int i = 0; i < 8; i++)
+			crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+	}
+	return crc;
+}
+
+static double now_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+#define MAX_LEN 300
+#define MAX_OFFSET 8
+
+class CrcTest : public testing::Test {
+protected:
+	virtual void SetUp() {
+		srand(1);
+		for (unsigned i = 0; i < sizeof(buf); i++)
+			buf[i] = rand();
+	}
+
+	uint8_t buf[MAX_LEN + MAX_OFFSET];
+};
+
+static const uint8_t check[] = "123456789";
+
+// Catalogued check values for "123456789"
+TEST_F(CrcTest, CheckValues) {
+	EXPECT_EQ(0xf4, PIOS_CRC_updateCRC(0, check, 9));		// CRC-8
+	EXPECT_EQ(0xbc, PIOS_CRC_updateCRC_TBS(0, check, 9));		// CRC-8/DVB-S2
+	EXPECT_EQ(0x2189, PIOS_CRC16_updateCRC(0, check, 9));		// CRC-16/KERMIT
+	EXPECT_EQ(0x6f91, PIOS_CRC16_updateCRC(0xffff, check, 9));	// CRC-16/MCRF4XX
+	EXPECT_EQ(0x31c3, PIOS_CRC16_CCITT_updateCRC(0, check, 9));	// CRC-16/XMODEM
+	EXPECT_EQ(0x0376e6e7u, PIOS_CRC32_updateCRC(0xffffffff, check, 9)); // CRC-32/MPEG-2
+	EXPECT_EQ(477u, PIOS_CRC_sumBytes(0, check, 9));
+	EXPECT_EQ(0x31, PIOS_CRC_xorBytes(0, check, 9));
+}
+
+// Every length and alignment against the reference
+TEST_F(CrcTest, MatchesReference) {
+	for (int off = 0; off < MAX_OFFSET; off++) {
+		for (int len = 0; len <= MAX_LEN; len++) {
+			const uint8_t *p = buf + off;
+			uint8_t seed = buf[len];
+
+			ASSERT_EQ(ref_crc8(0x07, seed, p, len), PIOS_CRC_updateCRC(seed, p, len))
+				<< "offset " << off << " length " << len;
+			ASSERT_EQ(ref_crc8(0xd5, seed, p, len), PIOS_CRC_updateCRC_TBS(seed, p, len));
+			ASSERT_EQ(ref_crc16_reflected(seed * 257, p, len), PIOS_CRC16_updateCRC(seed * 257, p, len));
+			ASSERT_EQ(ref_crc16_ccitt(seed * 257, p, len), PIOS_CRC16_CCITT_updateCRC(seed * 257, p, len));
+			ASSERT_EQ(ref_crc32(seed * 0x01010101u, p, len), PIOS_CRC32_updateCRC(seed * 0x01010101u, p, len));
+
+			uint32_t sum = seed;
+			uint8_t x = seed;
+			for (int i = 0; i < len; i++) {
+				sum += p[i];
+				x ^= p[i];
+			}
+			ASSERT_EQ(sum, PIOS_CRC_sumBytes(seed, p, len));
+			ASSERT_EQ(x, PIOS_CRC_xorBytes(seed, p, len));
+		}
+	}
+}
+
+// The byte at a time API and any split of the buffer give the same result
+TEST_F(CrcTest, Streaming) {
+	uint8_t whole8 = PIOS_CRC_updateCRC(0, buf, MAX_LEN);
+	uint16_t whole16 = PIOS_CRC16_CCITT_updateCRC(0, buf, MAX_LEN);
+	uint32_t wholesum = PIOS_CRC_sumBytes(0, buf, MAX_LEN);
+
+	uint8_t bytewise = 0;
+	for (int i = 0; i < MAX_LEN; i++)
+		bytewise = PIOS_CRC_updateByte(bytewise, buf[i]);
+	EXPECT_EQ(whole8, bytewise);
+
+	for (int split = 0; split <= MAX_LEN; split++) {
+		uint8_t c8 = PIOS_CRC_updateCRC(0, buf, split);
+		c8 = PIOS_CRC_updateCRC(c8, buf + split, MAX_LEN - split);
+		ASSERT_EQ(whole8, c8) << "split at " << split;
+
+		uint16_t c16 = PIOS_CRC16_CCITT_updateCRC(0, buf, split);
+		c16 = PIOS_CRC16_CCITT_updateCRC(c16, buf + split, MAX_LEN - split);
+		ASSERT_EQ(whole16, c16);
+
+		uint32_t sum = PIOS_CRC_sumBytes(0, buf, split);
+		sum = PIOS_CRC_sumBytes(sum, buf + split, MAX_LEN - split);
+		ASSERT_EQ(wholesum, sum);
+	}
+}
+
+// Long runs of 0xff are the worst case for the lane folding in the sum
+TEST_F(CrcTest, SumSaturated) {
+	static uint8_t ones[4096];
+	memset(ones, 0xff, sizeof(ones));
+
+	for (int len = 4000; len <= 4096; len++)
+		ASSERT_EQ(0xffu * len + 7, PIOS_CRC_sumBytes(7, ones, len));
+}
+
+TEST_F(CrcTest, Benchmark) {
+	const int loops = 200000;
+	const int len = 256;
+	double t0, t1;
+	uint32_t sink = 0;
+
+	t0 = now_us();
+	for (int i = 0; i < loops; i++) {
+		uint8_t crc = i;
+		for (int j = 0; j < len; j++)
+			crc = PIOS_CRC_updateByte(crc, buf[j]);
+		sink += crc;
+	}
+	t1 = now_us();
+	printf("crc8 byte at a time:   %8.1f MB/s\n", (double)loops * len / (t1 - t0));
+
+	t0 = now_us();
+	for (int i = 0; i < loops; i++)
+		sink += PIOS_CRC_updateCRC(i, buf, len);
+	t1 = now_us();
+	printf("crc8 slice by 4:       %8.1f MB/s\n", (double)loops * len / (t1 - t0));
+
+	t0 = now_us();
+	for (int i = 0; i < loops / 10; i++)
+		sink += ref_crc16_ccitt(i, buf, len);
+	t1 = now_us();
+	printf("crc16-ccitt bitwise:   %8.1f MB/s\n", (double)loops / 10 * len / (t1 - t0));
+
+	t0 = now_us();
+	for (int i = 0; i < loops; i++)
+		sink += PIOS_CRC16_CCITT_updateCRC(i, buf, len);
+	t1 = now_us();
+	printf("crc16-ccitt table:     %8.1f MB/s\n", (double)loops * len / (t1 - t0));
+
+	EXPECT_NE(0u, sink);
+}
@@ -0,0 +1,257 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <stdint.h>		/* uint*_t */
+#include <math.h>		/* sinf */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "dynnotch.h"
+
+}
+
+#define GYRO_RATE 8000.0f
+
+class DynNotch : public ::testing::Test {
+protected:
+	virtual void SetUp() {
+		filter = NULL;
+		srand(1);
+	}
+
+	virtual void TearDown() {
+		free(filter);
+	}
+
+	float noise(float amplitude) {
+		return amplitude * (2.0f * rand() / RAND_MAX - 1.0f);
+	}
+
+	/* Run a tone through all three axes for a while, returning the RMS of
+	 * the input and output of the x axis */
+	void run_tones(const float *hz, const float *amplitude, int tones,
+			float seconds, float rate, float *rms_in, float *rms_out) {
+		int samples = seconds * rate;
+		double in = 0, out = 0;
+
+		for (int n = 0; n < samples; n++) {
+			float x = noise(1);
+
+			for (int t = 0; t < tones; t++) {
+				phase[t] += 2 * (float) M_PI * hz[t] / rate;
+				x += amplitude[t] * sinf(phase[t]);
+			}
+
+			float sample[3] = { x, x, -x };
+			dynnotch_run(filter, sample);
+
+			in += x * x;
+			out += sample[0] * sample[0];
+		}
+
+		if (rms_in) {
+			*rms_in = sqrt(in / samples);
+		}
+		if (rms_out) {
+			*rms_out = sqrt(out / samples);
+		}
+	}
+
+	dynnotch_state_t filter;
+	float phase[4] = { 0 };
+};
+
+TEST_F(DynNotch, DisabledIsBypassed) {
+	dynnotch_create(&filter, 80, 500, 3, 0, 1 / GYRO_RATE);
+
+	EXPECT_EQ(NULL, filter);
+
+	float sample[3] = { 1, 2, 3 };
+	dynnotch_run(filter, sample);
+
+	EXPECT_EQ(1, sample[0]);
+	EXPECT_EQ(2, sample[1]);
+	EXPECT_EQ(3, sample[2]);
+	EXPECT_EQ(0, dynnotch_get_frequency(filter, 0, 0));
+}
+
+TEST_F(DynNotch, BypassedUntilLocked) {
+	dynnotch_create(&filter, 80, 500, 3, 1, 1 / GYRO_RATE);
+
+	/* Noise alone has no peak to lock on to */
+	for (int n = 0; n < 5 * GYRO_RATE; n++) {
+		float x = noise(1);
+		float sample[3] = { x, x, x };
+
+		dynnotch_run(filter, sample);
+
+		ASSERT_EQ(x, sample[0]);
+	}
+
+	EXPECT_EQ(0, dynnotch_get_frequency(filter, 0, 0));
+}
+
+TEST_F(DynNotch, TracksTone) {
+	const float hz = 200, amplitude = 50;
+	float rms_in, rms_out;
+
+	dynnotch_create(&filter, 80, 500, 3, 1, 1 / GYRO_RATE);
+
+	run_tones(&hz, &amplitude, 1, 1, GYRO_RATE, NULL, NULL);
+
+	for (int a = 0; a < DYNNOTCH_AXES; a++) {
+		EXPECT_NEAR(hz, dynnotch_get_frequency(filter, a, 0), 5);
+		EXPECT_GT(dynnotch_get_peak_ratio(filter, a), 10);
+	}
+
+	run_tones(&hz, &amplitude, 1, 0.5f, GYRO_RATE, &rms_in, &rms_out);
+
+	/* At least 20dB, leaving not much more than the noise */
+	EXPECT_LT(rms_out, rms_in / 10);
+}
+
+TEST_F(DynNotch, FollowsSweep) {
+	float hz = 150;
+	const float amplitude = 50;
+	float rms_in, rms_out;
+
+	dynnotch_create(&filter, 80, 500, 3, 1, 1 / GYRO_RATE);
+
+	run_tones(&hz, &amplitude, 1, 1, GYRO_RATE, NULL, NULL);
+
+	/* Motors spooling up at 100Hz/s */
+	for (int step = 0; step < 200; step++) {
+		hz += 1;
+		run_tones(&hz, &amplitude, 1, 0.01f, GYRO_RATE, &rms_in, &rms_out);
+	}
+
+	EXPECT_NEAR(hz, dynnotch_get_frequency(filter, 0, 0), 15);
+	EXPECT_LT(rms_out, rms_in / 4);
+}
+
+TEST_F(DynNotch, PassbandUntouched) {
+	const float hz[2] = { 250, 10 };
+	const float amplitude[2] = { 50, 50 };
+
+	dynnotch_create(&filter, 80, 500, 3, 1, 1 / GYRO_RATE);
+
+	run_tones(hz, amplitude, 2, 1, GYRO_RATE, NULL, NULL);
+
+	EXPECT_NEAR(hz[0], dynnotch_get_frequency(filter, 0, 0), 5);
+
+	/* Measure what is left of the 10Hz tone */
+	double i = 0, q = 0;
+	int samples = GYRO_RATE / hz[1] * 10;
+
+	for (int n = 0; n < samples; n++) {
+		float t = n / GYRO_RATE;
+		float x = amplitude[1] * sinf(2 * (float) M_PI * hz[1] * t) +
+			amplitude[0] * sinf(2 * (float) M_PI * hz[0] * t);
+		float sample[3] = { x, x, x };
+
+		dynnotch_run(filter, sample);
+
+		i += sample[0] * sinf(2 * (float) M_PI * hz[1] * t);
+		q += sample[0] * cosf(2 * (float) M_PI * hz[1] * t);
+	}
+
+	float gain = 2 * sqrt(i * i + q * q) / samples / amplitude[1];
+	float delay = atan2(-q, i) / (2 * M_PI * hz[1]);
+
+	EXPECT_NEAR(1, gain, 0.02);
+	EXPECT_LT(fabsf(delay), 0.0005f);
+}
+
+TEST_F(DynNotch, TwoPeaks) {
+	const float hz[2] = { 150, 320 };
+	const float amplitude[2] = { 50, 30 };
+	float rms_in, rms_out;
+
+	dynnotch_create(&filter, 80, 500, 3, 2, 1 / GYRO_RATE);
+
+	run_tones(hz, amplitude, 2, 1.5f, GYRO_RATE, NULL, NULL);
+
+	float f0 = dynnotch_get_frequency(filter, 0, 0);
+	float f1 = dynnotch_get_frequency(filter, 0, 1);
+
+	EXPECT_NEAR(hz[0], fminf(f0, f1), 8);
+	EXPECT_NEAR(hz[1], fmaxf(f0, f1), 8);
+
+	run_tones(hz, amplitude, 2, 0.5f, GYRO_RATE, &rms_in, &rms_out);
+
+	EXPECT_LT(rms_out, rms_in / 5);
+}
+
+TEST_F(DynNotch, SimulationRate) {
+	/* The simulated sensors run at 500Hz */
+	const float rate = 500, hz = 130, amplitude = 20;
+	float rms_in, rms_out;
+
+	dynnotch_create(&filter, 80, 500, 3, 1, 1 / rate);
+
+	run_tones(&hz, &amplitude, 1, 4, rate, NULL, NULL);
+
+	EXPECT_NEAR(hz, dynnotch_get_frequency(filter, 0, 0), 5);
+
+	run_tones(&hz, &amplitude, 1, 1, rate, &rms_in, &rms_out);
+
+	EXPECT_LT(rms_out, rms_in / 4);
+}
+
+static double now_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+TEST_F(DynNotch, Benchmark) {
+	const float hz[2] = { 150, 320 };
+	const float amplitude[2] = { 50, 30 };
+	const float seconds = 10;
+
+	dynnotch_create(&filter, 80, 500, 3, 2, 1 / GYRO_RATE);
+
+	double start = now_us();
+
+	run_tones(hz, amplitude, 2, seconds, GYRO_RATE, NULL, NULL);
+
+	double elapsed = now_us() - start;
+
+	printf("run: %.3f us/sample, budget %.1f us/sample at %.0f Hz\n",
+			elapsed / (seconds * GYRO_RATE), 1e6 / GYRO_RATE, GYRO_RATE);
+}
@@ -0,0 +1,11 @@
+/* Minimal pios.h for building the Reed-Solomon codec on the host */
+
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdlib.h>
+
+/* Would be from pios_debug.h but that file pulls on way too many dependencies */
+#define PIOS_Assert(x) if (!(x)) { abort(); }
+
+#endif /* PIOS_H */
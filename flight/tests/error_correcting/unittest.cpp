@@ -36,10 +36,12 @@
 #include <stdlib.h>		/* abort */
 #include <string.h>		/* memset */
 #include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
 
 extern "C" {
 
 #include <ecc.h>
+#include "reedsolomon.h"
 
 }
 
@@ -103,3 +105,210 @@ TEST_F(EncodeDecode, Recover) {
     EXPECT_EQ(p[i], p2[i]);
 
 };
+
+// The reentrant codec, checked against rscode above
+class ReedSolomon : public testing::Test {
+protected:
+  virtual void SetUp() {
+    initialize_ecc();
+    rs_init(&rs, RS_ECC_NPARITY);
+    seed = 1;
+  }
+
+  uint32_t rnd(uint32_t n) {
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) & 0xFFFFFF) % n;
+  }
+
+  void fill(uint8_t *p, int len) {
+    for (int i = 0; i < len; i++)
+      p[i] = rnd(256);
+  }
+
+  // Flips count distinct bytes of the codeword to other values
+  void inject(uint8_t *p, int len, int count) {
+    bool hit[RS_MAX_CODEWORD] = {};
+    for (int e = 0; e < count; e++) {
+      int pos;
+      do {
+        pos = rnd(len);
+      } while (hit[pos]);
+      hit[pos] = true;
+      p[pos] ^= 1 + rnd(255);
+    }
+  }
+
+  double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+  struct rs_code rs;
+  uint32_t seed;
+};
+
+TEST_F(ReedSolomon, CorrectEncode) {
+  uint8_t p[10] = {'a', 'b', 'c', 'd', 'e', 'f'};
+  rs_encode(&rs, p, 6, p);
+  EXPECT_EQ(0x1f, p[6]);
+  EXPECT_EQ(0xa3, p[7]);
+  EXPECT_EQ(0x9a, p[8]);
+  EXPECT_EQ(0x3b, p[9]);
+  EXPECT_EQ(0, rs_decode(&rs, p, 10));
+};
+
+TEST_F(ReedSolomon, MatchesRscode) {
+  uint8_t msg[RS_MAX_CODEWORD], ref[RS_MAX_CODEWORD], out[RS_MAX_CODEWORD];
+
+  // Codewords have to stay the same on air
+  for (int len = 0; len <= RS_MAX_CODEWORD - RS_ECC_NPARITY; len++) {
+    fill(msg, len);
+    encode_data(msg, len, ref);
+    rs_encode(&rs, msg, len, out);
+    ASSERT_EQ(0, memcmp(ref, out, len + RS_ECC_NPARITY)) << "length " << len;
+  }
+};
+
+TEST_F(ReedSolomon, CorrectsEverySingleError) {
+  uint8_t p[64], q[64];
+  fill(p, 60);
+  rs_encode(&rs, p, 60, p);
+
+  for (int pos = 0; pos < 64; pos++) {
+    for (int v = 1; v < 256; v++) {
+      memcpy(q, p, sizeof(q));
+      q[pos] ^= v;
+      ASSERT_EQ(1, rs_decode(&rs, q, sizeof(q)));
+      ASSERT_EQ(0, memcmp(p, q, sizeof(q)));
+    }
+  }
+};
+
+TEST_F(ReedSolomon, ErrorInjection) {
+  uint8_t p[RS_MAX_CODEWORD], q[RS_MAX_CODEWORD];
+
+  for (int nparity = 2; nparity <= RS_MAX_PARITY; nparity += 2) {
+    struct rs_code code;
+    rs_init(&code, nparity);
+
+    for (int trial = 0; trial < 2000; trial++) {
+      int len = nparity + 1 + rnd(RS_MAX_CODEWORD - nparity);
+      fill(p, len - nparity);
+      rs_encode(&code, p, len - nparity, p);
+
+      // Up to nparity / 2 errors are always corrected
+      int count = rnd(nparity / 2 + 1);
+      memcpy(q, p, len);
+      inject(q, len, count);
+      ASSERT_EQ(count, rs_decode(&code, q, len)) << nparity << " parity, " << len << " bytes";
+      ASSERT_EQ(0, memcmp(p, q, len));
+
+      // Beyond that it is either flagged or, rarely, decodes to another
+      // valid codeword.  It never leaves a corrupt codeword behind.
+      count = nparity / 2 + 1 + rnd(nparity);
+      if (count > len)
+        continue;
+      memcpy(q, p, len);
+      inject(q, len, count);
+      uint8_t before[RS_MAX_CODEWORD];
+      memcpy(before, q, len);
+      int ret = rs_decode(&code, q, len);
+      if (ret < 0) {
+        ASSERT_EQ(0, memcmp(before, q, len));
+      } else {
+        ASSERT_GT(ret, 0);
+        ASSERT_EQ(0, rs_decode(&code, q, len));
+      }
+    }
+  }
+};
+
+TEST_F(ReedSolomon, Uncorrectable) {
+  uint8_t p[64];
+  int flagged = 0, trials = 10000;
+
+  for (int trial = 0; trial < trials; trial++) {
+    fill(p, 60);
+    rs_encode(&rs, p, 60, p);
+    inject(p, sizeof(p), 3);
+    if (rs_decode(&rs, p, sizeof(p)) < 0)
+      flagged++;
+  }
+
+  // Most triple errors in a short packet are detected as such
+  EXPECT_GT(flagged, trials * 9 / 10);
+};
+
+TEST_F(ReedSolomon, Benchmark) {
+  const int loops = 20000;
+  uint8_t p[RS_MAX_CODEWORD], q[RS_MAX_CODEWORD];
+  double t0, t1;
+  int sink = 0;
+
+  static const int lens[] = { 64, 255 };
+
+  for (int l = 0; l < 2; l++) {
+    int len = lens[l];
+    int data = len - RS_ECC_NPARITY;
+    double mb = (double)loops * data / 1e6;
+
+    fill(p, data);
+
+    t0 = now_us();
+    for (int i = 0; i < loops; i++) {
+      p[0] = i;
+      encode_data(p, data, p);
+    }
+    t1 = now_us();
+    printf("%3d byte encode, rscode:      %8.2f MB/s\n", len, mb / ((t1 - t0) / 1e6));
+
+    t0 = now_us();
+    for (int i = 0; i < loops; i++) {
+      p[0] = i;
+      rs_encode(&rs, p, data, p);
+    }
+    t1 = now_us();
+    printf("%3d byte encode, reedsolomon: %8.2f MB/s\n", len, mb / ((t1 - t0) / 1e6));
+
+    t0 = now_us();
+    for (int i = 0; i < loops; i++) {
+      decode_data(p, len);
+      sink += check_syndrome();
+    }
+    t1 = now_us();
+    printf("%3d byte clean decode, rscode:      %8.2f MB/s\n", len, mb / ((t1 - t0) / 1e6));
+
+    t0 = now_us();
+    for (int i = 0; i < loops; i++)
+      sink += rs_decode(&rs, p, len);
+    t1 = now_us();
+    printf("%3d byte clean decode, reedsolomon: %8.2f MB/s\n", len, mb / ((t1 - t0) / 1e6));
+
+    for (int errors = 1; errors <= RS_ECC_NPARITY / 2; errors++) {
+      const int rounds = loops / 10;
+
+      t0 = now_us();
+      for (int i = 0; i < rounds; i++) {
+        memcpy(q, p, len);
+        inject(q, len, errors);
+        decode_data(q, len);
+        if (check_syndrome())
+          sink += correct_errors_erasures(q, len, 0, 0);
+      }
+      t1 = now_us();
+      printf("%3d byte decode, %d errors, rscode:      %8.2f us\n", len, errors, (t1 - t0) / rounds);
+
+      t0 = now_us();
+      for (int i = 0; i < rounds; i++) {
+        memcpy(q, p, len);
+        inject(q, len, errors);
+        sink += rs_decode(&rs, q, len);
+      }
+      t1 = now_us();
+      printf("%3d byte decode, %d errors, reedsolomon: %8.2f us\n", len, errors, (t1 - t0) / rounds);
+    }
+  }
+
+  EXPECT_NE(0, sink);
+};
@@ -0,0 +1,298 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <stdint.h>		/* uint*_t */
+#include <math.h>		/* sinf */
+
+extern "C" {
+
+#include "geofence_eval.h"
+
+}
+
+#define EPS 0.001f
+
+class Geofence : public ::testing::Test {
+protected:
+	virtual void SetUp() {
+		srand(1);
+	}
+
+	virtual void TearDown() {
+	}
+
+	float random(float min, float max) {
+		return min + (max - min) * rand() / (float) RAND_MAX;
+	}
+
+	// A 100m square from home to the north east
+	void square(struct geofence_zone *zone, bool exclusion, float floor, float ceiling) {
+		const float north[] = { 0, 100, 100, 0 };
+		const float east[] = { 0, 0, 100, 100 };
+
+		ASSERT_EQ(0, geofence_zone_init(zone, exclusion, north, east, 4, floor, ceiling));
+	}
+
+	// A star, concave between each point
+	void star(struct geofence_zone *zone, uint8_t points, float radius) {
+		float north[GEOFENCE_MAX_VERTICES], east[GEOFENCE_MAX_VERTICES];
+
+		for (int i = 0; i < 2 * points; i++) {
+			float r = (i % 2) ? radius / 3 : radius;
+			float a = i * (float) M_PI / points;
+
+			north[i] = r * cosf(a);
+			east[i] = r * sinf(a);
+		}
+
+		ASSERT_EQ(0, geofence_zone_init(zone, false, north, east, 2 * points, -1000, 1000));
+	}
+
+	// Checks every edge, without the band index
+	bool slow_contains(const struct geofence_zone *zone, float north, float east) {
+		bool inside = false;
+
+		for (int i = 0; i < zone->num_vertices; i++) {
+			int j = (i + 1) % zone->num_vertices;
+
+			if ((zone->north[i] > north) != (zone->north[j] > north) &&
+					east < zone->east[i] + (north - zone->north[i]) *
+					(zone->east[j] - zone->east[i]) / (zone->north[j] - zone->north[i]))
+				inside = !inside;
+		}
+
+		return inside;
+	}
+
+	float slow_distance(const struct geofence_zone *zone, float north, float east) {
+		float best = INFINITY;
+
+		for (int i = 0; i < zone->num_vertices; i++) {
+			int j = (i + 1) % zone->num_vertices;
+
+			float dn = zone->north[j] - zone->north[i];
+			float de = zone->east[j] - zone->east[i];
+			float t = ((north - zone->north[i]) * dn + (east - zone->east[i]) * de) /
+				(dn * dn + de * de);
+
+			t = fminf(fmaxf(t, 0), 1);
+
+			float d = hypotf(north - zone->north[i] - t * dn, east - zone->east[i] - t * de);
+
+			if (d < best)
+				best = d;
+		}
+
+		return best;
+	}
+};
+
+TEST_F(Geofence, RejectsDegenerateZones) {
+	struct geofence_zone zone;
+	const float north[] = { 0, 100, 100, 0 };
+	const float east[] = { 0, 0, 100, 100 };
+	const float flat[] = { 0, 0, 0, 0 };
+
+	EXPECT_EQ(-1, geofence_zone_init(&zone, false, north, east, 2, 0, 100));
+	EXPECT_EQ(-1, geofence_zone_init(&zone, false, north, east, GEOFENCE_MAX_VERTICES + 1, 0, 100));
+	EXPECT_EQ(-1, geofence_zone_init(&zone, false, north, east, 4, 100, 100));
+	EXPECT_EQ(-1, geofence_zone_init(&zone, false, flat, east, 4, 0, 100));
+	EXPECT_EQ(0, geofence_zone_init(&zone, false, north, east, 4, 0, 100));
+}
+
+TEST_F(Geofence, ContainsSquare) {
+	struct geofence_zone zone;
+	square(&zone, false, 0, 100);
+
+	EXPECT_TRUE(geofence_zone_contains(&zone, 50, 50));
+	EXPECT_TRUE(geofence_zone_contains(&zone, 1, 99));
+	EXPECT_FALSE(geofence_zone_contains(&zone, -1, 50));
+	EXPECT_FALSE(geofence_zone_contains(&zone, 101, 50));
+	EXPECT_FALSE(geofence_zone_contains(&zone, 50, -1));
+	EXPECT_FALSE(geofence_zone_contains(&zone, 50, 101));
+}
+
+TEST_F(Geofence, MatchesEveryEdgeCheck) {
+	struct geofence_zone zone;
+	star(&zone, GEOFENCE_MAX_VERTICES / 2, 500);
+
+	for (int i = 0; i < 10000; i++) {
+		float north = random(-700, 700);
+		float east = random(-700, 700);
+		float ned[3] = { north, east, 0 };
+		float gradient[3];
+
+		bool inside = slow_contains(&zone, north, east);
+		float distance = slow_distance(&zone, north, east);
+
+		ASSERT_EQ(inside, geofence_zone_contains(&zone, north, east))
+			<< "at " << north << ", " << east;
+		ASSERT_NEAR(inside ? distance : -distance,
+				geofence_zone_distance(&zone, ned, gradient), EPS)
+			<< "at " << north << ", " << east;
+	}
+}
+
+TEST_F(Geofence, DistanceGradient) {
+	struct geofence_zone zone;
+	square(&zone, false, 0, 100);
+	float gradient[3];
+
+	// Nearest the south edge, so going north gets further in
+	float inside[3] = { 10, 50, -50 };
+	EXPECT_NEAR(10, geofence_zone_distance(&zone, inside, gradient), EPS);
+	EXPECT_NEAR(1, gradient[0], EPS);
+	EXPECT_NEAR(0, gradient[1], EPS);
+	EXPECT_NEAR(0, gradient[2], EPS);
+
+	// Outside to the west, going east comes back
+	float outside[3] = { 50, -20, -50 };
+	EXPECT_NEAR(-20, geofence_zone_distance(&zone, outside, gradient), EPS);
+	EXPECT_NEAR(0, gradient[0], EPS);
+	EXPECT_NEAR(1, gradient[1], EPS);
+
+	// Outside the corner, straight back towards it
+	float corner[3] = { -30, -40, -50 };
+	EXPECT_NEAR(-50, geofence_zone_distance(&zone, corner, gradient), EPS);
+	EXPECT_NEAR(0.6f, gradient[0], EPS);
+	EXPECT_NEAR(0.8f, gradient[1], EPS);
+}
+
+TEST_F(Geofence, FloorAndCeiling) {
+	struct geofence_zone zone;
+	square(&zone, false, 10, 120);
+	float gradient[3];
+
+	// 15m up, nearer the floor than any edge
+	float low[3] = { 50, 50, -15 };
+	EXPECT_NEAR(5, geofence_zone_distance(&zone, low, gradient), EPS);
+	EXPECT_NEAR(-1, gradient[2], EPS);
+
+	// 10m over the ceiling
+	float high[3] = { 50, 50, -130 };
+	EXPECT_NEAR(-10, geofence_zone_distance(&zone, high, gradient), EPS);
+	EXPECT_NEAR(1, gradient[2], EPS);
+
+	// 30m outside to the south and 40m over the ceiling
+	float over[3] = { -30, 50, -160 };
+	EXPECT_NEAR(-50, geofence_zone_distance(&zone, over, gradient), EPS);
+	EXPECT_NEAR(0.6f, gradient[0], EPS);
+	EXPECT_NEAR(0.8f, gradient[2], EPS);
+}
+
+TEST_F(Geofence, InclusionAndExclusion) {
+	struct geofence_zone zones[2];
+	struct geofence_result result;
+	const float still[3] = { 0, 0, 0 };
+
+	square(&zones[0], false, 0, 100);
+
+	// A 20m square to keep out of in the middle
+	const float north[] = { 40, 60, 60, 40 };
+	const float east[] = { 40, 40, 60, 60 };
+	ASSERT_EQ(0, geofence_zone_init(&zones[1], true, north, east, 4, -1000, 1000));
+
+	// No zones, nothing to breach
+	float ned[3] = { 30, 50, -50 };
+	geofence_evaluate(zones, 0, ned, still, &result);
+	EXPECT_EQ(-1, result.zone);
+	EXPECT_TRUE(isinf(result.margin));
+
+	// Nearer the exclusion zone than the outside
+	geofence_evaluate(zones, 2, ned, still, &result);
+	EXPECT_EQ(1, result.zone);
+	EXPECT_NEAR(10, result.margin, EPS);
+	EXPECT_TRUE(isinf(result.time_to_breach));
+
+	// Nearer the outside
+	float edge[3] = { 5, 50, -50 };
+	geofence_evaluate(zones, 2, edge, still, &result);
+	EXPECT_EQ(0, result.zone);
+	EXPECT_NEAR(5, result.margin, EPS);
+
+	// Inside the exclusion zone
+	float in_exclusion[3] = { 45, 50, -50 };
+	geofence_evaluate(zones, 2, in_exclusion, still, &result);
+	EXPECT_EQ(1, result.zone);
+	EXPECT_NEAR(-5, result.margin, EPS);
+	EXPECT_EQ(0, result.time_to_breach);
+
+	// Either of two inclusion zones will do
+	const float north2[] = { 0, 100, 100, 0 };
+	const float east2[] = { 100, 100, 200, 200 };
+	ASSERT_EQ(0, geofence_zone_init(&zones[1], false, north2, east2, 4, 0, 100));
+
+	float second[3] = { 50, 180, -50 };
+	geofence_evaluate(zones, 2, second, still, &result);
+	EXPECT_EQ(1, result.zone);
+	EXPECT_NEAR(20, result.margin, EPS);
+}
+
+TEST_F(Geofence, TimeToBreach) {
+	struct geofence_zone zone;
+	struct geofence_result result;
+	square(&zone, false, 0, 100);
+
+	float ned[3] = { 50, 80, -50 };
+
+	// 20m from the east edge at 4m/s
+	const float east[3] = { 0, 4, 0 };
+	geofence_evaluate(&zone, 1, ned, east, &result);
+	EXPECT_NEAR(20, result.margin, EPS);
+	EXPECT_NEAR(5, result.time_to_breach, EPS);
+
+	// Going along it
+	const float north[3] = { 3, 0, 0 };
+	geofence_evaluate(&zone, 1, ned, north, &result);
+	EXPECT_TRUE(isinf(result.time_to_breach));
+
+	// Going away
+	const float west[3] = { 0, -4, 0 };
+	geofence_evaluate(&zone, 1, ned, west, &result);
+	EXPECT_TRUE(isinf(result.time_to_breach));
+
+	// Climbing towards the ceiling, which is nearer
+	float high[3] = { 50, 50, -90 };
+	const float climb[3] = { 0, 0, -2 };
+	geofence_evaluate(&zone, 1, high, climb, &result);
+	EXPECT_NEAR(10, result.margin, EPS);
+	EXPECT_NEAR(5, result.time_to_breach, EPS);
+}
+
+/**
+ * @}
+ * @}
+ */
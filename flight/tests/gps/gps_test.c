@@ -0,0 +1,547 @@
+/* Host side helpers for the GPS parser unit test */
+
+/* The parsers keep their state in statics, pull them in whole so the
+ * reference framers below can share the message handlers and the test
+ * can reset the state between replays. */
+#include "UBX.c"
+#include "NMEA.c"
+
+#include "gps_test.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+
+#define POSITION_LOG_LEN 4096
+
+static GPSPositionData position_log[POSITION_LOG_LEN];
+static GPSTimeData gps_time;
+static struct gps_test_result *current;
+
+int32_t GPSPositionSet(GPSPositionData *dataIn)
+{
+	if (current->positions < POSITION_LOG_LEN)
+		position_log[current->positions] = *dataIn;
+	current->positions++;
+	return 0;
+}
+
+int32_t GPSVelocitySet(GPSVelocityData *dataIn)
+{
+	current->velocities++;
+	return 0;
+}
+
+int32_t GPSSatellitesSet(GPSSatellitesData *dataIn)
+{
+	current->satellites++;
+	return 0;
+}
+
+int32_t GPSTimeGet(GPSTimeData *dataOut)
+{
+	*dataOut = gps_time;
+	return 0;
+}
+
+int32_t GPSTimeSet(GPSTimeData *dataIn)
+{
+	gps_time = *dataIn;
+	current->times++;
+	return 0;
+}
+
+int32_t UBloxInfoGet(UBloxInfoData *dataOut)
+{
+	memset(dataOut, 0, sizeof(*dataOut));
+	return 0;
+}
+
+int32_t UBloxInfoSet(UBloxInfoData *dataIn)
+{
+	return 0;
+}
+
+int32_t UBloxInfoParseErrorsSet(uint32_t *newValue)
+{
+	current->ubx_parse_errors = *newValue;
+	return 0;
+}
+
+/* The byte at a time framers as they were before parsing moved to chunks */
+
+static int ref_parse_ubx_stream (uint8_t c, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
+{
+	enum proto_states {
+		START,
+		UBX_SY2,
+		UBX_CLASS,
+		UBX_ID,
+		UBX_LEN1,
+		UBX_LEN2,
+		UBX_PAYLOAD,
+		UBX_CHK1,
+		UBX_CHK2,
+		FINISHED
+	};
+
+	static enum proto_states proto_state = START;
+	static uint16_t rx_count = 0;
+	struct UBXPacket *ubx = (struct UBXPacket *)gps_rx_buffer;
+
+	switch (proto_state) {
+		case START: // detect protocol
+			if (c ==  UBX_SYNC1) // first UBX sync char found
+				proto_state = UBX_SY2;
+			break;
+		case UBX_SY2:
+			if (c == UBX_SYNC2) // second UBX sync char found
+				proto_state = UBX_CLASS;
+			else
+				proto_state = START; // reset state
+			break;
+		case UBX_CLASS:
+			ubx->header.class = c;
+			proto_state = UBX_ID;
+			break;
+		case UBX_ID:
+			ubx->header.id = c;
+			proto_state = UBX_LEN1;
+			break;
+		case UBX_LEN1:
+			ubx->header.len = c;
+			proto_state = UBX_LEN2;
+			break;
+		case UBX_LEN2:
+			ubx->header.len += (c << 8);
+			if (ubx->header.len > sizeof(UBXPayload)) {
+				gpsRxStats->gpsRxOverflow++;
+				proto_state = START;
+			} else {
+				rx_count = 0;
+				proto_state = UBX_PAYLOAD;
+			}
+			break;
+		case UBX_PAYLOAD:
+			if (rx_count < ubx->header.len) {
+				ubx->payload.payload[rx_count] = c;
+				if (++rx_count == ubx->header.len)
+					proto_state = UBX_CHK1;
+			} else {
+				gpsRxStats->gpsRxOverflow++;
+				proto_state = START;
+			}
+			break;
+		case UBX_CHK1:
+			ubx->header.ck_a = c;
+			proto_state = UBX_CHK2;
+			break;
+		case UBX_CHK2:
+			ubx->header.ck_b = c;
+			if (checksum_ubx_message(ubx)) { // message complete and valid
+				parse_ubx_message(ubx, GpsData);
+				proto_state = FINISHED;
+			} else {
+				gpsRxStats->gpsRxChkSumError++;
+				proto_state = START;
+			}
+			break;
+		default: break;
+	}
+
+	if (proto_state == START)
+		return PARSER_ERROR;	// parser couldn't use this byte
+	else if (proto_state == FINISHED) {
+		gpsRxStats->gpsRxReceived++;
+		proto_state = START;
+		return PARSER_COMPLETE;	// message complete & processed
+	}
+
+	return PARSER_INCOMPLETE; // message not (yet) complete
+}
+
+static int ref_parse_nmea_stream (uint8_t c, char *gps_rx_buffer, GPSPositionData *GpsData, struct GPS_RX_STATS *gpsRxStats)
+{
+	static uint8_t rx_count = 0;
+	static bool start_flag = false;
+	static bool found_cr = false;
+
+	// detect start while acquiring stream
+	if (!start_flag && (c == '$')) // NMEA identifier found
+	{
+		start_flag = true;
+		found_cr = false;
+		rx_count = 0;
+	}
+	else
+	if (!start_flag)
+		return PARSER_ERROR;
+
+	if (rx_count >= NMEA_MAX_PACKET_LENGTH)
+	{
+		// The buffer is already full and we haven't found a valid NMEA sentence.
+		// Flush the buffer and note the overflow event.
+		gpsRxStats->gpsRxOverflow++;
+		start_flag = false;
+		found_cr = false;
+		rx_count = 0;
+		return PARSER_OVERRUN;
+	}
+	else
+	{
+		gps_rx_buffer[rx_count] = c;
+		rx_count++;
+	}
+
+	// look for ending '\r\n' sequence
+	if (!found_cr && (c == '\r') )
+		found_cr = true;
+	else
+	if (found_cr && (c != '\n') )
+		found_cr = false;  // false end flag
+	else
+	if (found_cr && (c == '\n') )
+	{
+		// The NMEA functions require a zero-terminated string
+		// As we detected \r\n, the string as for sure 2 bytes long, we will also strip the \r\n
+		gps_rx_buffer[rx_count-2] = 0;
+
+		// prepare to parse next sentence
+		start_flag = false;
+		found_cr = false;
+		rx_count = 0;
+
+		// Validate the checksum over the sentence
+		if (!NMEA_checksum(&gps_rx_buffer[1]))
+		{	// Invalid checksum.  May indicate dropped characters on Rx.
+			gpsRxStats->gpsRxChkSumError++;
+			return PARSER_ERROR;
+		}
+		else
+		{	// Valid checksum, use this packet to update the GPS position
+			if (!NMEA_update_position(&gps_rx_buffer[1], GpsData)) {
+				gpsRxStats->gpsRxParserError++;
+			}
+			else
+				gpsRxStats->gpsRxReceived++;;
+
+			return PARSER_COMPLETE;
+		}
+	}
+	return PARSER_INCOMPLETE;
+}
+
+void gps_test_replay(enum gps_test_protocol proto, const uint8_t *buf, size_t len,
+		size_t chunk, struct gps_test_result *result)
+{
+	static char rx_buffer[sizeof(struct UBXPacket)];
+	struct GPS_RX_STATS stats;
+	GPSPositionData position;
+
+	memset(result, 0, sizeof(*result));
+	memset(&stats, 0, sizeof(stats));
+	memset(&position, 0, sizeof(position));
+	memset(&gps_time, 0, sizeof(gps_time));
+	current = result;
+
+	// Start each replay from the state at boot
+	memset(&msgtracker, 0, sizeof(msgtracker));
+	parse_errors = 0;
+	memset(&gsv_partial, 0, sizeof(gsv_partial));
+	gsv_expected_mask = gsv_processed_mask = 0;
+	gsv_incomplete_error = gsv_duplicate_error = 0;
+
+	for (size_t i = 0; i < len; ) {
+		size_t n = chunk ? chunk : 1;
+		if (n > len - i)
+			n = len - i;
+
+		int res;
+		if (proto == GPS_TEST_UBX) {
+			res = chunk ? parse_ubx_buffer(&buf[i], n, rx_buffer, &position, &stats)
+				: ref_parse_ubx_stream(buf[i], rx_buffer, &position, &stats);
+		} else {
+			res = chunk ? parse_nmea_buffer(&buf[i], n, rx_buffer, &position, &stats)
+				: ref_parse_nmea_stream(buf[i], rx_buffer, &position, &stats);
+		}
+
+		if (res == PARSER_COMPLETE)
+			result->completed++;
+		result->calls++;
+		i += n;
+	}
+
+	result->received = stats.gpsRxReceived;
+	result->chksum_errors = stats.gpsRxChkSumError;
+	result->overflows = stats.gpsRxOverflow;
+	result->parser_errors = stats.gpsRxParserError;
+	current = NULL;
+}
+
+size_t gps_test_position_log(const GPSPositionData **log)
+{
+	*log = position_log;
+	return POSITION_LOG_LEN;
+}
+
+/* Stream generation */
+
+static uint32_t rnd_state;
+
+static uint32_t rnd(uint32_t n)
+{
+	rnd_state = rnd_state * 1103515245 + 12345;
+	return ((rnd_state >> 8) & 0xFFFF) % n;
+}
+
+struct stream {
+	uint8_t *buf;
+	size_t len;
+	size_t max;
+};
+
+static void put(struct stream *s, const void *data, size_t len)
+{
+	PIOS_Assert(s->len + len <= s->max);
+	memcpy(&s->buf[s->len], data, len);
+	s->len += len;
+}
+
+static void put_garbage(struct stream *s, uint8_t avoid)
+{
+	int n = rnd(8);
+	for (int i = 0; i < n; i++) {
+		uint8_t c = rnd(256);
+		if (c != avoid)
+			put(s, &c, 1);
+	}
+}
+
+static void put_ubx(struct stream *s, uint8_t class, uint8_t id, const void *payload, uint16_t len, bool noise)
+{
+	uint8_t frame[8 + sizeof(UBXPayload)];
+	uint8_t ck_a = 0, ck_b = 0;
+
+	frame[0] = UBX_SYNC1;
+	frame[1] = UBX_SYNC2;
+	frame[2] = class;
+	frame[3] = id;
+	frame[4] = len & 0xff;
+	frame[5] = len >> 8;
+	memcpy(&frame[6], payload, len);
+
+	for (int i = 2; i < 6 + len; i++) {
+		ck_a += frame[i];
+		ck_b += ck_a;
+	}
+	frame[6 + len] = ck_a;
+	frame[7 + len] = ck_b;
+
+	if (noise) {
+		put_garbage(s, UBX_SYNC1);
+		// Corrupt some frames, as dropped bytes on a serial link would
+		if (!rnd(16))
+			frame[6 + rnd(len)] ^= 0x10;
+		// and every so often a false sync with a nonsense length
+		if (!rnd(32)) {
+			const uint8_t bogus[] = { UBX_SYNC1, UBX_SYNC2, class, id, 0xff, 0xff };
+			put(s, bogus, sizeof(bogus));
+		}
+	}
+
+	put(s, frame, 8 + len);
+}
+
+size_t gps_test_ubx_stream(uint8_t *buf, size_t max, int epochs, uint32_t seed, bool noise)
+{
+	struct stream s = { .buf = buf, .len = 0, .max = max };
+	rnd_state = seed;
+
+	struct UBX_MON_VER ver;
+	memset(&ver, 0, sizeof(ver));
+	memcpy(ver.swVersion, "7.03 (45969)", 12);
+	memcpy(ver.hwVersion, "00070000", 8);
+	put_ubx(&s, UBX_CLASS_MON, UBX_ID_MONVER, &ver, 40, false);
+
+	int32_t lat = 480000000, lon = 113000000, alt = 545400;
+
+	for (int e = 0; e < epochs; e++) {
+		uint32_t tow = 100000000 + e * 200;
+
+		lat += rnd(200) - 100;
+		lon += rnd(200) - 100;
+		alt += rnd(100) - 50;
+
+		struct UBX_NAV_SOL sol = {
+			.iTOW = tow,
+			.gpsFix = (e % 50) < 3 ? STATUS_GPSFIX_2DFIX : STATUS_GPSFIX_3DFIX,
+			.flags = STATUS_FLAGS_GPSFIX_OK | ((e / 100) & 1 ? STATUS_FLAGS_DIFFSOLN : 0),
+			.pAcc = 150 + rnd(100),
+			.numSV = 6 + rnd(8),
+		};
+		put_ubx(&s, UBX_CLASS_NAV, UBX_ID_SOL, &sol, 52, noise);
+
+		struct UBX_NAV_POSLLH posllh = {
+			.iTOW = tow,
+			.lon = lon,
+			.lat = lat,
+			.height = alt + 46900,
+			.hMSL = alt,
+			.hAcc = 1500,
+			.vAcc = 2500,
+		};
+		put_ubx(&s, UBX_CLASS_NAV, UBX_ID_POSLLH, &posllh, 28, noise);
+
+		struct UBX_NAV_VELNED velned = {
+			.iTOW = tow,
+			.velN = rnd(2000) - 1000,
+			.velE = rnd(2000) - 1000,
+			.velD = rnd(200) - 100,
+			.gSpeed = rnd(1500),
+			.heading = rnd(36000000),
+			.sAcc = 50,
+		};
+		put_ubx(&s, UBX_CLASS_NAV, UBX_ID_VELNED, &velned, 36, noise);
+
+		struct UBX_NAV_DOP dop = {
+			.iTOW = tow,
+			.pDOP = 100 + rnd(300),
+			.vDOP = 100 + rnd(200),
+			.hDOP = 80 + rnd(150),
+		};
+		put_ubx(&s, UBX_CLASS_NAV, UBX_ID_DOP, &dop, 18, noise);
+
+		struct UBX_NAV_TIMEUTC timeutc = {
+			.iTOW = tow,
+			.year = 2017,
+			.month = 3,
+			.day = 14,
+			.hour = (e / 18000) % 24,
+			.min = (e / 300) % 60,
+			.sec = (e / 5) % 60,
+			.valid = TIMEUTC_VALIDTOW | TIMEUTC_VALIDWKN | TIMEUTC_VALIDUTC,
+		};
+		put_ubx(&s, UBX_CLASS_NAV, UBX_ID_TIMEUTC, &timeutc, 20, noise);
+
+		// Satellite info only comes once a second
+		if (e % 5 == 0) {
+			struct UBX_NAV_SVINFO svinfo = {
+				.iTOW = tow,
+				.numCh = 16,
+			};
+			for (int i = 0; i < svinfo.numCh; i++) {
+				svinfo.sv[i].chn = i;
+				svinfo.sv[i].svid = 1 + i * 2;
+				svinfo.sv[i].cno = i < 12 ? 20 + rnd(30) : 0;
+				svinfo.sv[i].elev = rnd(90);
+				svinfo.sv[i].azim = rnd(360);
+			}
+			put_ubx(&s, UBX_CLASS_NAV, UBX_ID_SVINFO, &svinfo, 8 + 12 * svinfo.numCh, noise);
+		}
+	}
+
+	return s.len;
+}
+
+static void put_nmea(struct stream *s, bool noise, const char *fmt, ...)
+{
+	char body[200];
+	char sentence[220];
+	uint8_t checksum = 0;
+	va_list args;
+
+	va_start(args, fmt);
+	vsnprintf(body, sizeof(body), fmt, args);
+	va_end(args);
+
+	for (const char *c = body; *c; c++)
+		checksum ^= *c;
+
+	const char *end = "\r\n";
+	if (noise) {
+		put_garbage(s, '$');
+		if (!rnd(16))
+			checksum ^= 0x20;
+		// Odd line endings, which the framers have to agree on
+		switch (rnd(32)) {
+		case 0: end = "\r\r\n"; break;
+		case 1: end = "\r\r\r\n"; break;
+		case 2: end = "\n\r\n"; break;
+		}
+	}
+
+	int n = snprintf(sentence, sizeof(sentence), "$%s*%02X%s", body, checksum, end);
+	put(s, sentence, n);
+}
+
+static void nmea_latlon(char *out, size_t len, int32_t latlon, bool lat)
+{
+	uint32_t a = abs(latlon);
+	uint32_t deg = a / 10000000;
+	double min = (a % 10000000) * 60.0 / 10000000;
+
+	snprintf(out, len, lat ? "%02u%07.4f,%c" : "%03u%07.4f,%c", deg, min,
+			lat ? (latlon < 0 ? 'S' : 'N') : (latlon < 0 ? 'W' : 'E'));
+}
+
+size_t gps_test_nmea_stream(uint8_t *buf, size_t max, int epochs, uint32_t seed, bool noise)
+{
+	struct stream s = { .buf = buf, .len = 0, .max = max };
+	rnd_state = seed;
+
+	int32_t lat = 480000000, lon = -1130000000;
+	float alt = 545.4f;
+
+	for (int e = 0; e < epochs; e++) {
+		char slat[20], slon[20], utc[12];
+		int sec = e / 5;
+
+		lat += rnd(200) - 100;
+		lon += rnd(200) - 100;
+		alt += (rnd(100) - 50) * 0.01f;
+
+		nmea_latlon(slat, sizeof(slat), lat, true);
+		nmea_latlon(slon, sizeof(slon), lon, false);
+		snprintf(utc, sizeof(utc), "%02d%02d%02d.%02d", (sec / 3600) % 24, (sec / 60) % 60, sec % 60, (e % 5) * 20);
+
+		int fix = (e % 50) < 3 ? 0 : 1 + (e / 100) % 2;
+		float knots = rnd(3000) * 0.01f;
+		float course = rnd(36000) * 0.01f;
+
+		put_nmea(&s, noise, "GPRMC,%s,%c,%s,%s,%.2f,%.2f,140317,,,A", utc, fix ? 'A' : 'V', slat, slon, knots, course);
+		put_nmea(&s, noise, "GPVTG,%.2f,T,,M,%.2f,N,%.2f,K,A", course, knots, knots * 1.852f);
+		put_nmea(&s, noise, "GPGSA,A,%d,01,03,05,07,09,11,13,15,17,,,,%.2f,%.2f,%.2f",
+				fix ? 3 : 1, 1 + rnd(300) * 0.01f, 0.8f + rnd(150) * 0.01f, 1 + rnd(200) * 0.01f);
+
+		// Satellite info only comes once a second
+		if (e % 5 == 0) {
+			for (int m = 1; m <= 3; m++) {
+				char sats[80] = "";
+				for (int i = 0; i < 4 && (m - 1) * 4 + i < 11; i++) {
+					size_t l = strlen(sats);
+					snprintf(&sats[l], sizeof(sats) - l, ",%02d,%02d,%03d,%02d",
+							1 + ((m - 1) * 4 + i) * 2, rnd(90), rnd(360), 20 + rnd(30));
+				}
+				put_nmea(&s, noise, "GPGSV,3,%d,11%s", m, sats);
+			}
+			put_nmea(&s, noise, "GPZDA,%s,14,03,2017,00,00", utc);
+		}
+
+		// GGA last, it is what updates GPSPosition
+		put_nmea(&s, noise, "GPGGA,%s,%s,%s,%d,%02d,%.1f,%.1f,M,46.9,M,,",
+				utc, slat, slon, fix, 6 + rnd(8), 0.8f + rnd(150) * 0.01f, alt);
+
+		if (noise && !rnd(64)) {
+			// A sentence that overruns the buffer
+			char txt[160];
+			memset(txt, 'x', sizeof(txt));
+			memcpy(txt, "GPTXT,", 6);
+			txt[sizeof(txt) - 1] = 0;
+			put_nmea(&s, false, "%s", txt);
+		}
+	}
+
+	// Make sure the stream ends with the framer idle
+	put_nmea(&s, false, "GPZDA,000000.00,14,03,2017,00,00");
+
+	return s.len;
+}
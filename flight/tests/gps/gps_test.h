@@ -0,0 +1,43 @@
+/* Host side helpers for the GPS parser unit test, callable from C++ */
+
+#ifndef GPS_TEST_H
+#define GPS_TEST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gpsposition.h"
+
+enum gps_test_protocol {
+	GPS_TEST_UBX,
+	GPS_TEST_NMEA,
+};
+
+struct gps_test_result {
+	uint32_t completed;		/* PARSER_COMPLETE results */
+	uint32_t calls;			/* calls into the parser */
+	uint32_t positions;		/* GPSPosition updates */
+	uint32_t velocities;		/* GPSVelocity updates */
+	uint32_t satellites;		/* GPSSatellites updates */
+	uint32_t times;			/* GPSTime updates */
+	uint16_t received;		/* struct GPS_RX_STATS */
+	uint16_t chksum_errors;
+	uint16_t overflows;
+	uint16_t parser_errors;
+	uint32_t ubx_parse_errors;	/* UBloxInfo.ParseErrors */
+};
+
+/* Synthetic receiver output, one solution per epoch at 5Hz */
+size_t gps_test_ubx_stream(uint8_t *buf, size_t max, int epochs, uint32_t seed, bool noise);
+size_t gps_test_nmea_stream(uint8_t *buf, size_t max, int epochs, uint32_t seed, bool noise);
+
+/* Replays a stream in chunks of the given size.  A chunk of 0 feeds it
+ * through the old byte at a time parsers instead. */
+void gps_test_replay(enum gps_test_protocol proto, const uint8_t *buf, size_t len,
+		size_t chunk, struct gps_test_result *result);
+
+/* GPSPosition updates from the last replay, as many as were kept */
+size_t gps_test_position_log(const GPSPositionData **log);
+
+#endif /* GPS_TEST_H */
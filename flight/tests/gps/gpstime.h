@@ -0,0 +1,18 @@
+/* Just enough of the generated UAVObject header for the GPS parsers */
+
+#ifndef GPSTIME_H
+#define GPSTIME_H
+
+typedef struct {
+	int16_t Year;
+	int8_t Month;
+	int8_t Day;
+	int8_t Hour;
+	int8_t Minute;
+	int8_t Second;
+} GPSTimeData;
+
+int32_t GPSTimeGet(GPSTimeData *dataOut);
+int32_t GPSTimeSet(GPSTimeData *dataIn);
+
+#endif /* GPSTIME_H */
@@ -0,0 +1,15 @@
+/* Just enough of the generated UAVObject header for the GPS parsers */
+
+#ifndef GPSVELOCITY_H
+#define GPSVELOCITY_H
+
+typedef struct {
+	float North;
+	float East;
+	float Down;
+	float Accuracy;
+} GPSVelocityData;
+
+int32_t GPSVelocitySet(GPSVelocityData *dataIn);
+
+#endif /* GPSVELOCITY_H */
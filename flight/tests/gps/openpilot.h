@@ -0,0 +1,22 @@
+/* Minimal openpilot.h for building the GPS parsers on the host */
+
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PIOS_INCLUDE_GPS_NMEA_PARSER
+#define PIOS_INCLUDE_GPS_UBX_PARSER
+
+/* Would be from pios_debug.h but that file pulls on way too many dependencies */
+#define PIOS_Assert(x) if (!(x)) { abort(); }
+#define PIOS_DEBUG_Assert(x) PIOS_Assert(x)
+
+#define NELEMENTS(x) (sizeof(x) / sizeof(*(x)))
+
+#endif /* OPENPILOT_H */
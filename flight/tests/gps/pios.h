@@ -0,0 +1 @@
+/* Everything the GPS parsers need is in the host openpilot.h */
@@ -0,0 +1,16 @@
+/* Just enough of the generated UAVObject header for the GPS parsers */
+
+#ifndef UBLOXINFO_H
+#define UBLOXINFO_H
+
+typedef struct {
+	uint32_t swVersion;
+	uint32_t ParseErrors;
+	uint16_t hwVersion;
+} UBloxInfoData;
+
+int32_t UBloxInfoGet(UBloxInfoData *dataOut);
+int32_t UBloxInfoSet(UBloxInfoData *dataIn);
+int32_t UBloxInfoParseErrorsSet(uint32_t *newValue);
+
+#endif /* UBLOXINFO_H */
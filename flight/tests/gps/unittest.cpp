@@ -0,0 +1,208 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+#define restrict		/* neuter restrict keyword since it's not in C++ */
+
+#include "gps_test.h"
+
+}
+
+#define STREAM_LEN (1024 * 1024)
+
+// To use a test fixture, derive a class from testing::Test.
+class GpsParserTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    stream = new uint8_t[STREAM_LEN];
+    ref_log = new GPSPositionData[4096];
+  }
+
+  virtual void TearDown() {
+    delete[] stream;
+    delete[] ref_log;
+  }
+
+  // Replays the stream byte at a time through the old framers and then
+  // in chunks through the new ones, expecting exactly the same updates
+  void compare(enum gps_test_protocol proto, size_t len, size_t chunk) {
+    struct gps_test_result ref, res;
+    const GPSPositionData *log;
+    size_t log_len = gps_test_position_log(&log);
+
+    gps_test_replay(proto, stream, len, 0, &ref);
+    memcpy(ref_log, log, sizeof(GPSPositionData) * log_len);
+
+    gps_test_replay(proto, stream, len, chunk, &res);
+
+    SCOPED_TRACE(chunk);
+    EXPECT_EQ(ref.positions, res.positions);
+    EXPECT_EQ(ref.velocities, res.velocities);
+    EXPECT_EQ(ref.satellites, res.satellites);
+    EXPECT_EQ(ref.times, res.times);
+    EXPECT_EQ(ref.received, res.received);
+    EXPECT_EQ(ref.chksum_errors, res.chksum_errors);
+    EXPECT_EQ(ref.overflows, res.overflows);
+    EXPECT_EQ(ref.parser_errors, res.parser_errors);
+    EXPECT_EQ(ref.ubx_parse_errors, res.ubx_parse_errors);
+
+    size_t n = ref.positions < log_len ? ref.positions : log_len;
+    for (size_t i = 0; i < n; i++) {
+      if (memcmp(&ref_log[i], &log[i], sizeof(GPSPositionData))) {
+        ADD_FAILURE() << "GPSPosition update " << i << " differs";
+        break;
+      }
+    }
+  }
+
+  double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+  uint8_t *stream;
+  GPSPositionData *ref_log;
+};
+
+static const size_t chunks[] = { 1, 2, 7, 32, 64, 255, 4096 };
+
+TEST_F(GpsParserTest, UbxClean) {
+  struct gps_test_result res;
+  size_t len = gps_test_ubx_stream(stream, STREAM_LEN, 500, 1, false);
+
+  gps_test_replay(GPS_TEST_UBX, stream, len, 32, &res);
+
+  // One position per epoch, every frame received
+  EXPECT_EQ(500u, res.positions);
+  EXPECT_EQ(500u, res.velocities);
+  EXPECT_EQ(100u, res.satellites);
+  EXPECT_EQ(1 + 500 * 5 + 100u, res.received);
+  EXPECT_EQ(0, res.chksum_errors);
+  EXPECT_EQ(0, res.overflows);
+
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+    compare(GPS_TEST_UBX, len, chunks[i]);
+  }
+}
+
+TEST_F(GpsParserTest, UbxNoisy) {
+  struct gps_test_result res;
+  size_t len = gps_test_ubx_stream(stream, STREAM_LEN, 2000, 2, true);
+
+  gps_test_replay(GPS_TEST_UBX, stream, len, 32, &res);
+
+  // Make sure the stream actually exercises the error paths
+  EXPECT_GT(res.chksum_errors, 0);
+  EXPECT_GT(res.overflows, 0);
+  EXPECT_GT(res.positions, 1000u);
+
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+    compare(GPS_TEST_UBX, len, chunks[i]);
+  }
+}
+
+TEST_F(GpsParserTest, NmeaClean) {
+  struct gps_test_result res;
+  size_t len = gps_test_nmea_stream(stream, STREAM_LEN, 500, 3, false);
+
+  gps_test_replay(GPS_TEST_NMEA, stream, len, 32, &res);
+
+  // GGA updates the position every epoch
+  EXPECT_EQ(500u, res.positions);
+  EXPECT_EQ(100u, res.satellites);
+  EXPECT_EQ(0, res.chksum_errors);
+  EXPECT_EQ(0, res.overflows);
+  // Void RMC sentences while there is no fix, 3 epochs out of every 50
+  EXPECT_EQ(30, res.parser_errors);
+
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+    compare(GPS_TEST_NMEA, len, chunks[i]);
+  }
+}
+
+TEST_F(GpsParserTest, NmeaNoisy) {
+  struct gps_test_result res;
+  size_t len = gps_test_nmea_stream(stream, STREAM_LEN, 2000, 4, true);
+
+  gps_test_replay(GPS_TEST_NMEA, stream, len, 32, &res);
+
+  EXPECT_GT(res.chksum_errors, 0);
+  EXPECT_GT(res.overflows, 0);
+  EXPECT_GT(res.positions, 1000u);
+
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+    compare(GPS_TEST_NMEA, len, chunks[i]);
+  }
+}
+
+TEST_F(GpsParserTest, Benchmark) {
+  const int loops = 20;
+  struct gps_test_result res;
+  double t0, t1;
+
+  size_t len = gps_test_ubx_stream(stream, STREAM_LEN, 2000, 5, false);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++)
+    gps_test_replay(GPS_TEST_UBX, stream, len, 0, &res);
+  t1 = now_us();
+  printf("ubx, byte at a time:  %7.2f us/fix %7d calls/fix\n", (t1 - t0) / loops / res.positions, res.calls / res.positions);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++)
+    gps_test_replay(GPS_TEST_UBX, stream, len, 32, &res);
+  t1 = now_us();
+  printf("ubx, 32 byte chunks:  %7.2f us/fix %7d calls/fix\n", (t1 - t0) / loops / res.positions, res.calls / res.positions);
+
+  len = gps_test_nmea_stream(stream, STREAM_LEN, 2000, 6, false);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++)
+    gps_test_replay(GPS_TEST_NMEA, stream, len, 0, &res);
+  t1 = now_us();
+  printf("nmea, byte at a time: %7.2f us/fix %7d calls/fix\n", (t1 - t0) / loops / res.positions, res.calls / res.positions);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++)
+    gps_test_replay(GPS_TEST_NMEA, stream, len, 32, &res);
+  t1 = now_us();
+  printf("nmea, 32 byte chunks: %7.2f us/fix %7d calls/fix\n", (t1 - t0) / loops / res.positions, res.calls / res.positions);
+}
@@ -0,0 +1,48 @@
+/**
+ ******************************************************************************
+ * @file       insgps_ref.h
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Dense covariance kernels the packed INSGPS kernels are checked against
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef INSGPS_REF_H
+#define INSGPS_REF_H
+
+#include <stdint.h>
+
+#define INSGPS_REF_NUMX 14
+#define INSGPS_REF_NUMW 10
+#define INSGPS_REF_NUMV 10
+
+void ref_covariance_prediction(float F[INSGPS_REF_NUMX][INSGPS_REF_NUMX],
+		float G[INSGPS_REF_NUMX][INSGPS_REF_NUMW], float Q[INSGPS_REF_NUMW],
+		float dT, float P[INSGPS_REF_NUMX][INSGPS_REF_NUMX]);
+void ref_serial_update(float H[INSGPS_REF_NUMV][INSGPS_REF_NUMX],
+		float R[INSGPS_REF_NUMV], float Z[INSGPS_REF_NUMV],
+		float Y[INSGPS_REF_NUMV], float P[INSGPS_REF_NUMX][INSGPS_REF_NUMX],
+		float X[INSGPS_REF_NUMX], uint16_t SensorsUsed);
+
+#endif /* INSGPS_REF_H */
+
+/**
+ * @}
+ * @}
+ */
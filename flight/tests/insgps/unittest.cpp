@@ -0,0 +1,300 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <math.h>		/* fabsf */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+#define restrict		/* neuter restrict keyword since it's not in C++ */
+
+#include "insgps.h"
+#include "insgps_ref.h"
+
+#define NUMX INSGPS_REF_NUMX
+#define NUMW INSGPS_REF_NUMW
+#define NUMV INSGPS_REF_NUMV
+#define NUMP (NUMX * (NUMX + 1) / 2)
+
+/* Filter internals, these are not static in insgps14state.c */
+extern float F[NUMX][NUMX], G[NUMX][NUMW], H[NUMV][NUMX];
+extern float P[NUMP], X[NUMX], Q[NUMW], R[NUMV], Be[3];
+
+void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
+			  float Q[NUMW], float dT, float P[NUMP]);
+void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
+		  float Y[NUMV], float P[NUMP], float X[NUMX],
+		  uint16_t SensorsUsed);
+void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX]);
+void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV]);
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class InsgpsTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    INSGPSInit();
+
+    const float mag[3] = { 0.4f, 0.1f, 0.9f };
+    INSSetMagNorth(mag);
+
+    seed = 1;
+    t = 0;
+  }
+
+  virtual void TearDown() {
+  }
+
+  // Deterministic noise in [-1, 1)
+  float noise() {
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) & 0xffff) / 32768.0f - 1.0f;
+  }
+
+  // Advance the state with a gently rotating, accelerating airframe so every
+  // structurally nonzero term of F and G is exercised
+  void predict_state() {
+    const float gyro[3] = {
+      0.3f * sinf(t * 1.3f) + 0.01f * noise(),
+      0.2f * cosf(t * 0.7f) + 0.01f * noise(),
+      0.5f + 0.01f * noise(),
+    };
+    const float accel[3] = {
+      0.5f * sinf(t) + 0.05f * noise(),
+      0.3f * cosf(t * 0.5f) + 0.05f * noise(),
+      -9.81f + 0.05f * noise(),
+    };
+
+    INSStatePrediction(gyro, accel, dt);
+    t += dt;
+  }
+
+  void pack(float Pd[NUMX][NUMX], float *Pp) {
+    for (int i = 0; i < NUMX; i++)
+      for (int j = i; j < NUMX; j++)
+        *Pp++ = Pd[i][j];
+  }
+
+  void unpack(const float *Pp, float Pd[NUMX][NUMX]) {
+    for (int i = 0; i < NUMX; i++)
+      for (int j = i; j < NUMX; j++)
+        Pd[i][j] = Pd[j][i] = *Pp++;
+  }
+
+  // Largest difference relative to the matching diagonal scale
+  float max_rel_error(float Pd[NUMX][NUMX], const float *Pp) {
+    float err = 0;
+    for (int i = 0; i < NUMX; i++)
+      for (int j = i; j < NUMX; j++) {
+        float scale = sqrtf(Pd[i][i] * Pd[j][j]);
+        float e = fabsf(Pd[i][j] - *Pp++) / scale;
+        if (e > err)
+          err = e;
+      }
+    return err;
+  }
+
+  void measurements(float Z[NUMV], float Y[NUMV]) {
+    LinearizeH(X, Be, H);
+    MeasurementEq(X, Be, Y);
+    for (int m = 0; m < NUMV; m++)
+      Z[m] = Y[m] + 0.1f * noise();
+  }
+
+  static double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+  static constexpr float dt = 1.0f / 1000.0f;
+  uint32_t seed;
+  float t;
+};
+
+TEST_F(InsgpsTest, PackedLayout) {
+  float Pd[NUMX][NUMX];
+  unpack(P, Pd);
+
+  // INSGPSInit only sets the diagonal
+  float var[NUMX];
+  INSGetVariance(var);
+  for (int i = 0; i < NUMX; i++) {
+    EXPECT_EQ(Pd[i][i], var[i]);
+    for (int j = 0; j < NUMX; j++) {
+      if (i != j) {
+        EXPECT_EQ(0.0f, Pd[i][j]);
+      }
+    }
+  }
+
+  // Resetting keeps the matrix diagonal
+  float diag[NUMX];
+  for (int i = 0; i < NUMX; i++)
+    diag[i] = i + 1;
+  P[5] = 3.0f;
+  INSResetP(diag);
+  INSGetVariance(var);
+  for (int i = 0; i < NUMX; i++)
+    EXPECT_EQ(diag[i], var[i]);
+  EXPECT_EQ(0.0f, P[5]);
+}
+
+TEST_F(InsgpsTest, PredictionMatchesDense) {
+  float Pd[NUMX][NUMX];
+
+  for (int k = 0; k < 2000; k++) {
+    predict_state();
+
+    unpack(P, Pd);
+    ref_covariance_prediction(F, G, Q, dt, Pd);
+    CovariancePrediction(F, G, Q, dt, P);
+
+    ASSERT_LT(max_rel_error(Pd, P), 1e-5f) << "step " << k;
+  }
+}
+
+TEST_F(InsgpsTest, UpdateMatchesDense) {
+  float Pd[NUMX][NUMX], Xd[NUMX], Z[NUMV], Y[NUMV];
+
+  for (int k = 0; k < 2000; k++) {
+    predict_state();
+    CovariancePrediction(F, G, Q, dt, P);
+
+    // Cycle through the sensor combinations the attitude module uses
+    uint16_t sensors = BARO_SENSOR;
+    if (k % 3 == 0)
+      sensors |= MAG_SENSORS;
+    if (k % 5 == 0)
+      sensors |= POS_SENSORS | HORIZ_VEL_SENSORS | VERT_VEL_SENSORS;
+
+    measurements(Z, Y);
+    unpack(P, Pd);
+    memcpy(Xd, X, sizeof(Xd));
+
+    ref_serial_update(H, R, Z, Y, Pd, Xd, sensors);
+    SerialUpdate(H, R, Z, Y, P, X, sensors);
+
+    ASSERT_LT(max_rel_error(Pd, P), 1e-4f) << "step " << k;
+    for (int i = 0; i < NUMX; i++)
+      ASSERT_NEAR(Xd[i], X[i], 1e-5f * (1 + fabsf(Xd[i]))) << "step " << k;
+  }
+}
+
+TEST_F(InsgpsTest, LongRunMatchesDense) {
+  float Pd[NUMX][NUMX], Xd[NUMX], Z[NUMV], Y[NUMV];
+
+  // Propagate a dense copy alongside the packed one for a minute of
+  // flight, without resynchronizing, to catch accumulated error
+  unpack(P, Pd);
+  for (int k = 0; k < 60000; k++) {
+    predict_state();
+    ref_covariance_prediction(F, G, Q, dt, Pd);
+    CovariancePrediction(F, G, Q, dt, P);
+
+    if (k % 20 == 0) {
+      uint16_t sensors = BARO_SENSOR | MAG_SENSORS;
+      if (k % 200 == 0)
+        sensors |= POS_SENSORS | HORIZ_VEL_SENSORS | VERT_VEL_SENSORS;
+
+      measurements(Z, Y);
+      memcpy(Xd, X, sizeof(Xd));
+      ref_serial_update(H, R, Z, Y, Pd, Xd, sensors);
+      SerialUpdate(H, R, Z, Y, P, X, sensors);
+    }
+  }
+
+  // The old general and hand expanded kernels drift apart by about 2e-3
+  // over the same run, this is just float rounding being propagated
+  EXPECT_LT(max_rel_error(Pd, P), 5e-3f);
+
+  for (int i = 0; i < NUMX; i++)
+    EXPECT_GT(Pd[i][i], 0.0f);
+}
+
+TEST_F(InsgpsTest, Benchmark) {
+  const int loops = 100000;
+  float Pd[NUMX][NUMX], Pp[NUMP], Z[NUMV], Y[NUMV];
+  float sink = 0;
+  double t0, t1;
+
+  for (int k = 0; k < 100; k++)
+    predict_state();
+  measurements(Z, Y);
+
+  unpack(P, Pd);
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    ref_covariance_prediction(F, G, Q, dt, Pd);
+    sink += Pd[3][3];
+  }
+  t1 = now_us();
+  printf("covariance prediction, dense:  %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  memcpy(Pp, P, sizeof(Pp));
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    CovariancePrediction(F, G, Q, dt, Pp);
+    sink += Pp[3];
+  }
+  t1 = now_us();
+  printf("covariance prediction, packed: %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  float Xd[NUMX];
+  memcpy(Xd, X, sizeof(Xd));
+  unpack(P, Pd);
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    ref_serial_update(H, R, Z, Y, Pd, Xd, FULL_SENSORS);
+    sink += Xd[0];
+  }
+  t1 = now_us();
+  printf("serial update, dense:          %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  memcpy(Pp, P, sizeof(Pp));
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    SerialUpdate(H, R, Z, Y, Pp, X, FULL_SENSORS);
+    sink += X[0];
+  }
+  t1 = now_us();
+  printf("serial update, packed:         %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  // Keep the loops from being optimized out
+  EXPECT_TRUE(sink == sink);
+}
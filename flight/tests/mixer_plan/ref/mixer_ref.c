@@ -0,0 +1,34 @@
+/* Dense mixer and channel scaling, as done before the mixer plan */
+
+#include "misc_math.h"
+#include "mixer_ref.h"
+
+void mixer_ref_eval(const float *mixer, const float *in, float *out)
+{
+	const float (*m)[MIXER_REF_CHANNELS * MIXER_REF_INPUTS] = (const void *)mixer;
+	const float (*v)[MIXER_REF_INPUTS] = (const void *)in;
+	float (*o)[MIXER_REF_CHANNELS] = (void *)out;
+
+	matrix_mul_check(*m, *v, *o, MIXER_REF_CHANNELS, MIXER_REF_INPUTS, 1);
+}
+
+float mixer_ref_scale(float value, float min, float neutral, float max)
+{
+	float valueScaled;
+	// Scale
+	if (value >= 0.0f) {
+		valueScaled = value*(max-neutral) + neutral;
+	} else {
+		valueScaled = value*(neutral-min) + neutral;
+	}
+
+	if (max>min) {
+		if (valueScaled > max) valueScaled = max;
+		if (valueScaled < min) valueScaled = min;
+	} else {
+		if (valueScaled < max) valueScaled = max;
+		if (valueScaled > min) valueScaled = min;
+	}
+
+	return valueScaled;
+}
@@ -0,0 +1,12 @@
+/* Dense mixer and channel scaling, as done before the mixer plan */
+
+#ifndef MIXER_REF_H
+#define MIXER_REF_H
+
+#define MIXER_REF_CHANNELS 10
+#define MIXER_REF_INPUTS   8
+
+void mixer_ref_eval(const float *mixer, const float *in, float *out);
+float mixer_ref_scale(float value, float min, float neutral, float max);
+
+#endif /* MIXER_REF_H */
@@ -0,0 +1,258 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+#define restrict		/* neuter restrict keyword since it's not in C++ */
+
+#include "mixer_plan.h"
+#include "mixer_ref.h"
+
+}
+
+#define CHANNELS MIXER_REF_CHANNELS
+#define INPUTS   MIXER_REF_INPUTS
+
+// To use a test fixture, derive a class from testing::Test.
+class MixerPlanTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    memset(&plan, 0, sizeof(plan));
+    memset(mixer, 0, sizeof(mixer));
+    for (int ch = 0; ch < CHANNELS; ch++) {
+      rows[ch] = MIXER_PLAN_ROW_UNUSED;
+    }
+    seed = 1;
+  }
+
+  float rnd(float lo, float hi) {
+    seed = seed * 1103515245 + 12345;
+    return lo + (hi - lo) * ((seed >> 8) & 0xFFFF) / 65535.0f;
+  }
+
+  // Quad X on channels 0-3, values as set up by the GCS in Q7
+  void quad_x() {
+    static const float q[4][5] = {
+      { 1, 0,  1,  1, -1 },
+      { 1, 0, -1,  1,  1 },
+      { 1, 0, -1, -1, -1 },
+      { 1, 0,  1, -1,  1 },
+    };
+    for (int ch = 0; ch < 4; ch++) {
+      for (int i = 0; i < 5; i++) {
+        mixer[ch][i] = q[ch][i];
+      }
+      rows[ch] = MIXER_PLAN_ROW_MOTOR;
+    }
+  }
+
+  void random_mixer(float density) {
+    for (int ch = 0; ch < CHANNELS; ch++) {
+      float r = rnd(0, 1);
+      rows[ch] = r < 0.3f ? MIXER_PLAN_ROW_UNUSED :
+        r < 0.5f ? MIXER_PLAN_ROW_SERVO : MIXER_PLAN_ROW_MOTOR;
+      for (int i = 0; i < INPUTS; i++) {
+        // Unused channels have zero filled rows, as in actuator.c
+        if (rows[ch] != MIXER_PLAN_ROW_UNUSED && rnd(0, 1) < density) {
+          mixer[ch][i] = (int)rnd(-128, 128) / 128.0f;
+        } else {
+          mixer[ch][i] = 0;
+        }
+      }
+    }
+  }
+
+  void random_input(float *in) {
+    for (int i = 0; i < INPUTS; i++) {
+      in[i] = rnd(-1, 1);
+    }
+  }
+
+  // Channels without a row are left alone, the dense mixer has zeros there
+  void eval_plan(const float *in, float *out) {
+    for (int ch = 0; ch < CHANNELS; ch++) {
+      out[ch] = 0;
+    }
+    mixer_plan_eval(&plan, in, out);
+  }
+
+  static double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+  struct mixer_plan plan;
+  float mixer[CHANNELS][INPUTS];
+  enum mixer_plan_row rows[CHANNELS];
+  uint32_t seed;
+};
+
+TEST_F(MixerPlanTest, Empty) {
+  mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+
+  EXPECT_EQ(0, plan.num_rows);
+  EXPECT_EQ(0, plan.num_lanes);
+  EXPECT_EQ(0, plan.num_inputs);
+  EXPECT_EQ(0, plan.num_motors);
+
+  float in[INPUTS], out[CHANNELS];
+  random_input(in);
+  eval_plan(in, out);
+  for (int ch = 0; ch < CHANNELS; ch++) {
+    EXPECT_EQ(0.0f, out[ch]);
+  }
+}
+
+TEST_F(MixerPlanTest, QuadXLayout) {
+  quad_x();
+  mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+
+  // Only the motors and throttle, roll, pitch, yaw are kept
+  EXPECT_EQ(4, plan.num_rows);
+  EXPECT_EQ(4, plan.num_lanes);
+  EXPECT_EQ(4, plan.num_motors);
+  ASSERT_EQ(4, plan.num_inputs);
+  EXPECT_EQ(0, plan.input[0]);
+  EXPECT_EQ(2, plan.input[1]);
+  EXPECT_EQ(3, plan.input[2]);
+  EXPECT_EQ(4, plan.input[3]);
+
+  for (int r = 0; r < 4; r++) {
+    EXPECT_EQ(r, plan.row_channel[r]);
+    EXPECT_EQ(r, plan.motor_row[r]);
+  }
+}
+
+TEST_F(MixerPlanTest, RowsArePadded) {
+  rows[1] = MIXER_PLAN_ROW_SERVO;
+  rows[7] = MIXER_PLAN_ROW_MOTOR;
+  mixer[1][2] = 0.5f;
+  mixer[7][0] = 1.0f;
+  mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+
+  EXPECT_EQ(2, plan.num_rows);
+  EXPECT_EQ(MIXER_PLAN_LANES, plan.num_lanes);
+  EXPECT_EQ(1, plan.num_motors);
+  EXPECT_EQ(1, plan.row_channel[plan.motor_row[0]] == 7);
+
+  // Padding lanes are zero, so they never pick up a value
+  for (int i = 0; i < plan.num_inputs; i++) {
+    for (int r = plan.num_rows; r < plan.num_lanes; r++) {
+      EXPECT_EQ(0.0f, plan.coef[i * plan.num_lanes + r]);
+    }
+  }
+}
+
+TEST_F(MixerPlanTest, MatchesDenseMixer) {
+  for (int n = 0; n < 2000; n++) {
+    random_mixer(rnd(0, 1));
+    mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+
+    for (int k = 0; k < 10; k++) {
+      float in[INPUTS], out_ref[CHANNELS], out_plan[CHANNELS];
+
+      random_input(in);
+      mixer_ref_eval(&mixer[0][0], in, out_ref);
+      eval_plan(in, out_plan);
+
+      for (int ch = 0; ch < CHANNELS; ch++) {
+        // Terms are summed in a different order
+        ASSERT_NEAR(out_ref[ch], out_plan[ch], 1e-5f) << "case " << n << " channel " << ch;
+      }
+    }
+  }
+}
+
+TEST_F(MixerPlanTest, ScaleMatchesReference) {
+  for (int n = 0; n < 20000; n++) {
+    float min = (int)rnd(900, 2100);
+    float max = (int)rnd(900, 2100);
+    float neutral = (int)rnd(900, 2100);
+    float value = rnd(-1.5f, 1.5f);
+
+    mixer_plan_set_scale(&plan, 3, min, neutral, max);
+
+    EXPECT_FLOAT_EQ(mixer_ref_scale(value, min, neutral, max),
+        mixer_plan_scale_channel(&plan, 3, value)) << "case " << n;
+  }
+}
+
+TEST_F(MixerPlanTest, BuildKeepsScale) {
+  mixer_plan_set_scale(&plan, 2, 1000, 1100, 2000);
+  quad_x();
+  mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+
+  EXPECT_FLOAT_EQ(1100, mixer_plan_scale_channel(&plan, 2, 0));
+  EXPECT_FLOAT_EQ(2000, mixer_plan_scale_channel(&plan, 2, 1));
+  EXPECT_FLOAT_EQ(1000, mixer_plan_scale_channel(&plan, 2, -1));
+}
+
+// Not a pass / fail test, reports timings against the dense mixer
+TEST_F(MixerPlanTest, Benchmark) {
+  const int loops = 1000000;
+  float in[INPUTS], out[CHANNELS] = { 0 };
+  float sink = 0;
+  double t0, t1;
+
+  quad_x();
+  mixer_plan_build(&plan, &mixer[0][0], rows, CHANNELS, INPUTS);
+  random_input(in);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    in[2] = out[0] * 1e-3f;
+    mixer_ref_eval(&mixer[0][0], in, out);
+    sink += out[1];
+  }
+  t1 = now_us();
+  printf("quad x, dense mixer:   %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  t0 = now_us();
+  for (int i = 0; i < loops; i++) {
+    in[2] = out[0] * 1e-3f;
+    mixer_plan_eval(&plan, in, out);
+    sink += out[1];
+  }
+  t1 = now_us();
+  printf("quad x, mixer plan:    %7.2f ns\n", (t1 - t0) * 1000 / loops);
+
+  // Keep the loops from being optimized out
+  EXPECT_TRUE(sink == sink);
+}
@@ -0,0 +1,12 @@
+/* Just enough of the generated UAVObject header for osd_utils.c */
+
+#ifndef GPSPOSITION_H
+#define GPSPOSITION_H
+
+typedef struct {
+	float GeoidSeparation;
+} GPSPositionData;
+
+static inline int32_t GPSPositionGet(GPSPositionData *dataOut) { memset(dataOut, 0, sizeof(*dataOut)); return 0; }
+
+#endif /* GPSPOSITION_H */
@@ -0,0 +1,14 @@
+/* Just enough of the generated UAVObject header for osd_utils.c */
+
+#ifndef HOMELOCATION_H
+#define HOMELOCATION_H
+
+typedef struct {
+	int32_t Latitude;
+	int32_t Longitude;
+	float Altitude;
+} HomeLocationData;
+
+static inline int32_t HomeLocationGet(HomeLocationData *dataOut) { memset(dataOut, 0, sizeof(*dataOut)); return 0; }
+
+#endif /* HOMELOCATION_H */
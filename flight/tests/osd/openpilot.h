@@ -0,0 +1,16 @@
+/* Minimal openpilot.h for building the OSD drawing code on the host */
+
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Would be from pios_debug.h but that file pulls on way too many dependencies */
+#define PIOS_Assert(x) if (!(x)) { abort(); }
+
+#endif /* OPENPILOT_H */
@@ -0,0 +1,538 @@
+/* Host side helpers for the OSD unit test */
+
+#include "osd_utils.h"
+#include "osd_retained.h"
+#include "fonts.h"
+#include "osd_test.h"
+
+#include <stdio.h>
+
+// Not exported through osd_utils.h
+void write_pixel(uint8_t *buff, int x, int y, int mode);
+void write_hline(uint8_t *buff, int x0, int x1, int y, int mode);
+void write_vline(uint8_t *buff, int x, int y0, int y1, int mode);
+void write_filled_rectangle(uint8_t *buff, int x, int y, int width, int height, int mode);
+void write_line(uint8_t *buff, int x0, int y0, int x1, int y1, int mode);
+void write_char(uint8_t ch, int x, int y, const struct FontEntry *font_info);
+void write_word_misaligned_NAND(uint8_t *buff, uint16_t word, unsigned int addr, unsigned int xoff);
+void write_word_misaligned_OR(uint8_t *buff, uint16_t word, unsigned int addr, unsigned int xoff);
+
+static const struct pios_video_type_boundary boundary_pal = {
+	.graphics_right  = 359,
+	.graphics_bottom = 265,
+};
+
+const struct pios_video_type_boundary *pios_video_type_boundary_act = &boundary_pal;
+
+static uint8_t buffer0_level[BUFFER_HEIGHT * BUFFER_WIDTH];
+static uint8_t buffer0_mask[BUFFER_HEIGHT * BUFFER_WIDTH];
+static uint8_t buffer1_level[BUFFER_HEIGHT * BUFFER_WIDTH];
+static uint8_t buffer1_mask[BUFFER_HEIGHT * BUFFER_WIDTH];
+
+uint8_t *draw_buffer_level = buffer0_level;
+uint8_t *draw_buffer_mask = buffer0_mask;
+uint8_t *disp_buffer_level = buffer1_level;
+uint8_t *disp_buffer_mask = buffer1_mask;
+
+size_t osd_test_buffer_size(void)
+{
+	return BUFFER_HEIGHT * BUFFER_WIDTH;
+}
+
+void osd_test_fill(uint32_t seed)
+{
+	// Background with some pixels set, so clearing shows up as well
+	for (int i = 0; i < BUFFER_HEIGHT * BUFFER_WIDTH; i++) {
+		seed = seed * 1103515245 + 12345;
+		draw_buffer_mask[i] = seed >> 16;
+		draw_buffer_level[i] = seed >> 24;
+	}
+}
+
+void osd_test_snapshot(uint8_t *mask, uint8_t *level)
+{
+	memcpy(mask, draw_buffer_mask, BUFFER_HEIGHT * BUFFER_WIDTH);
+	memcpy(level, draw_buffer_level, BUFFER_HEIGHT * BUFFER_WIDTH);
+}
+
+void osd_test_restore(const uint8_t *mask, const uint8_t *level)
+{
+	memcpy(draw_buffer_mask, mask, BUFFER_HEIGHT * BUFFER_WIDTH);
+	memcpy(draw_buffer_level, level, BUFFER_HEIGHT * BUFFER_WIDTH);
+}
+
+void osd_test_swap_buffers(void)
+{
+	uint8_t *tmp;
+
+	SWAP_BUFFS(tmp, disp_buffer_mask, draw_buffer_mask);
+	SWAP_BUFFS(tmp, disp_buffer_level, draw_buffer_level);
+}
+
+void osd_test_line(int x0, int y0, int x1, int y1, int mmode, int lmode)
+{
+	write_line_lm(x0, y0, x1, y1, mmode, lmode);
+}
+
+void osd_test_line_outlined(int x0, int y0, int x1, int y1, int mode, int dots)
+{
+	write_line_outlined_dashed(x0, y0, x1, y1, 2, 2, mode, 1, dots);
+}
+
+void osd_test_circle_outlined(int cx, int cy, int r, int dashp, int bmode, int mode)
+{
+	write_circle_outlined(cx, cy, r, dashp, bmode, mode, 1);
+}
+
+void osd_test_hline(int x0, int x1, int y, int lmode, int mmode)
+{
+	write_hline_lm(x0, x1, y, lmode, mmode);
+}
+
+void osd_test_vline(int x, int y0, int y1, int lmode, int mmode)
+{
+	write_vline_lm(x, y0, y1, lmode, mmode);
+}
+
+void osd_test_rectangle(int x, int y, int width, int height, int lmode, int mmode)
+{
+	write_filled_rectangle_lm(x, y, width, height, lmode, mmode);
+}
+
+void osd_test_char(uint8_t ch, int x, int y, int font)
+{
+	write_char(ch, x, y, get_font_info(font));
+}
+
+void osd_ref_line(int x0, int y0, int x1, int y1, int mmode, int lmode)
+{
+	write_line(draw_buffer_mask, x0, y0, x1, y1, mmode);
+	write_line(draw_buffer_level, x0, y0, x1, y1, lmode);
+}
+
+void osd_ref_line_outlined(int x0, int y0, int x1, int y1, int mode, int dots)
+{
+	const int mmode = 1;
+	int omode = mode == 0 ? 0 : 1;
+	int imode = mode == 0 ? 1 : 0;
+
+	int steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep) {
+		SWAP(x0, y0);
+		SWAP(x1, y1);
+	}
+	if (x0 > x1) {
+		SWAP(x0, x1);
+		SWAP(y0, y1);
+	}
+	int deltax = x1 - x0;
+	int deltay = abs(y1 - y0);
+	int ystep = y0 < y1 ? 1 : -1;
+	int error, y, x, dot_cnt, draw;
+
+	error = deltax / 2;
+	y = y0;
+	dot_cnt = 0;
+	draw = 1;
+	for (x = x0; x < x1; x++) {
+		if (dots && !(dot_cnt++ % dots)) {
+			draw++;
+		}
+		if (draw % 2) {
+			if (steep) {
+				write_pixel_lm(y - 1, x, mmode, omode);
+				write_pixel_lm(y + 1, x, mmode, omode);
+				write_pixel_lm(y, x - 1, mmode, omode);
+				write_pixel_lm(y, x + 1, mmode, omode);
+			} else {
+				write_pixel_lm(x - 1, y, mmode, omode);
+				write_pixel_lm(x + 1, y, mmode, omode);
+				write_pixel_lm(x, y - 1, mmode, omode);
+				write_pixel_lm(x, y + 1, mmode, omode);
+			}
+		}
+		error -= deltay;
+		if (error < 0) {
+			y += ystep;
+			error += deltax;
+		}
+	}
+
+	error = deltax / 2;
+	y = y0;
+	dot_cnt = 0;
+	draw = 1;
+	for (x = x0; x < x1; x++) {
+		if (dots && !(dot_cnt++ % dots)) {
+			draw++;
+		}
+		if (draw % 2) {
+			if (steep) {
+				write_pixel_lm(y, x, mmode, imode);
+			} else {
+				write_pixel_lm(x, y, mmode, imode);
+			}
+		}
+		error -= deltay;
+		if (error < 0) {
+			y += ystep;
+			error += deltax;
+		}
+	}
+}
+
+void osd_ref_circle_outlined(int cx, int cy, int r, int dashp, int bmode, int mode)
+{
+	const int mmode = 1;
+	int stroke, fill;
+
+	CHECK_COORDS(cx, cy);
+	SETUP_STROKE_FILL(stroke, fill, mode);
+	int error = -r, x = r, y = 0;
+	while (x >= y) {
+		if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y, mmode);
+			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y, stroke);
+			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y + 1, mmode);
+			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y + 1, stroke);
+			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y, mmode);
+			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y, stroke);
+			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y - 1, mmode);
+			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y - 1, stroke);
+			if (bmode == 1) {
+				CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x + 1, y + 1, mmode);
+				CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x + 1, y + 1, stroke);
+				CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x - 1, y - 1, mmode);
+				CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x - 1, y - 1, stroke);
+			}
+		}
+		error += (y * 2) + 1;
+		y++;
+		if (error >= 0) {
+			--x;
+			error -= x * 2;
+		}
+	}
+	error = -r;
+	x = r;
+	y = 0;
+	while (x >= y) {
+		if (dashp == 0 || (y % dashp) < (dashp / 2)) {
+			CIRCLE_PLOT_8(draw_buffer_mask, cx, cy, x, y, mmode);
+			CIRCLE_PLOT_8(draw_buffer_level, cx, cy, x, y, fill);
+		}
+		error += (y * 2) + 1;
+		y++;
+		if (error >= 0) {
+			--x;
+			error -= x * 2;
+		}
+	}
+}
+
+void osd_ref_hline(int x0, int x1, int y, int lmode, int mmode)
+{
+	write_hline(draw_buffer_level, x0, x1, y, lmode);
+	write_hline(draw_buffer_mask, x0, x1, y, mmode);
+}
+
+void osd_ref_vline(int x, int y0, int y1, int lmode, int mmode)
+{
+	write_vline(draw_buffer_level, x, y0, y1, lmode);
+	write_vline(draw_buffer_mask, x, y0, y1, mmode);
+}
+
+void osd_ref_rectangle(int x, int y, int width, int height, int lmode, int mmode)
+{
+	write_filled_rectangle(draw_buffer_mask, x, y, width, height, mmode);
+	write_filled_rectangle(draw_buffer_level, x, y, width, height, lmode);
+}
+
+void osd_ref_char(uint8_t ch, int x, int y, int font)
+{
+	const struct FontEntry *font_info = get_font_info(font);
+	uint16_t mask, levels;
+
+	ch = font_info->lookup[ch];
+	if (ch == 255) {
+		return;
+	}
+
+	uint8_t partly_out = (x < GRAPHICS_LEFT) || (x + font_info->width > GRAPHICS_RIGHT) || (y < GRAPHICS_TOP) || (y + font_info->height > GRAPHICS_BOTTOM);
+	if (partly_out && ((x + font_info->width < GRAPHICS_LEFT) || (x > GRAPHICS_RIGHT) || (y + font_info->height < GRAPHICS_TOP) || (y > GRAPHICS_BOTTOM))) {
+		return;
+	}
+
+	int addr = CALC_BUFF_ADDR(x, y);
+	int wbit = CALC_BIT_IN_WORD(x);
+	int row = ch * font_info->height;
+
+	for (int yy = y; yy < y + font_info->height; yy++) {
+		if (!partly_out || ((x >= GRAPHICS_LEFT) && (x + font_info->width <= GRAPHICS_RIGHT) && (yy >= GRAPHICS_TOP) && (yy <= GRAPHICS_BOTTOM))) {
+			if (font_info->width > 8) {
+				uint32_t data = ((uint32_t*)font_info->data)[row];
+				mask = data & 0xFFFF;
+				levels = (data >> 16) & 0xFFFF;
+			} else {
+				uint16_t data = font_info->data[row];
+				levels = data & 0xFF00;
+				mask = (data & 0x00FF) << 8;
+			}
+			write_word_misaligned_OR(draw_buffer_mask, mask, addr, wbit);
+			write_word_misaligned_OR(draw_buffer_level, mask, addr, wbit);
+			write_word_misaligned_NAND(draw_buffer_level, mask & levels, addr, wbit);
+		}
+		addr += BUFFER_WIDTH;
+		row++;
+	}
+}
+
+/*
+ * A user page with the usual elements: artificial horizon, compass tape,
+ * speed and altitude scales, home arrow and a set of text fields. The
+ * attitude changes every frame, altitude and heading every other frame and
+ * the remaining values only now and then, roughly like in flight.
+ */
+
+enum page_widget {
+	PAGE_HORIZON,
+	PAGE_CENTER,
+	PAGE_COMPASS,
+	PAGE_SPEED,
+	PAGE_ALTITUDE,
+	PAGE_HOME_ARROW,
+	PAGE_FLIGHT_MODE,
+	PAGE_BATTERY,
+	PAGE_CURRENT,
+	PAGE_CONSUMED,
+	PAGE_GPS,
+	PAGE_HOME_DISTANCE,
+	PAGE_FLIGHT_TIME,
+	PAGE_RSSI,
+	PAGE_ALARMS,
+	PAGE_NUM
+};
+
+struct page_data {
+	float roll, pitch;
+	int heading, speed, altitude;
+	int home_dir;
+	int voltage, current, consumed;
+	int sats, home_distance, flight_time, rssi;
+};
+
+static struct osd_retained page_retained;
+static bool page_retained_init;
+
+static void page_data_for_frame(uint32_t frame, struct page_data *data)
+{
+	memset(data, 0, sizeof(*data));
+	data->roll = 20.0f * sinf(frame * 0.05f);
+	data->pitch = 10.0f * cosf(frame * 0.03f);
+	data->heading = (frame / 2) % 360;
+	data->altitude = 100 + (frame / 2) % 50;
+	data->speed = 12 + (frame / 16) % 5;
+	data->home_dir = (frame / 8) % 360;
+	data->voltage = 1680 - (frame / 64);
+	data->current = 1200 + (frame / 32) % 30;
+	data->consumed = frame / 10;
+	data->sats = 11;
+	data->home_distance = 250 + frame / 8;
+	data->flight_time = frame / 50;
+	data->rssi = 80 - (frame / 100) % 10;
+}
+
+static void draw_vertical_scale(int value, int x, int y, int left)
+{
+	char tmp[16];
+	int dir = left ? -1 : 1;
+
+	write_vline_outlined(x, y - 60, y + 60, 2, 2, 0, 1);
+	for (int i = -60; i <= 60; i += 5) {
+		int len = ((value + i) % 10 == 0) ? 6 : 3;
+		write_hline_outlined(x, x + dir * len, y + i - (value % 5), 2, 2, 0, 1);
+	}
+	snprintf(tmp, sizeof(tmp), "%d", value);
+	write_filled_rectangle_lm(left ? x - 40 : x + 6, y - 6, 34, 12, 0, 1);
+	write_string(tmp, left ? x - 8 : x + 8, y, 0, 0, TEXT_VA_MIDDLE,
+			left ? TEXT_HA_RIGHT : TEXT_HA_LEFT, 0, FONT8X10);
+}
+
+static void draw_widget(int id, const struct page_data *data)
+{
+	char tmp[32];
+	int cx = GRAPHICS_X_MIDDLE, cy = GRAPHICS_Y_MIDDLE;
+
+	switch (id) {
+	case PAGE_HORIZON:
+	{
+		float s = sinf(data->roll * (float)(M_PI / 180));
+		float c = cosf(data->roll * (float)(M_PI / 180));
+		for (int i = -2; i <= 2; i++) {
+			int off = (int)((data->pitch + i * 10) * 3);
+			int len = i == 0 ? 120 : 40;
+			int x0 = cx - c * len - s * off, y0 = cy - s * len + c * off;
+			int x1 = cx + c * len - s * off, y1 = cy + s * len + c * off;
+			if (i == 0) {
+				write_line_outlined(x0, y0, x1, y1, 2, 2, 0, 1);
+			} else {
+				write_line_outlined_dashed(x0, y0, x1, y1, 2, 2, 0, 1, 5);
+			}
+		}
+		break;
+	}
+	case PAGE_CENTER:
+		write_line_outlined(cx - 20, cy, cx - 5, cy, 2, 2, 0, 1);
+		write_line_outlined(cx + 5, cy, cx + 20, cy, 2, 2, 0, 1);
+		write_line_outlined(cx, cy - 8, cx, cy - 3, 2, 2, 0, 1);
+		break;
+	case PAGE_COMPASS:
+		write_hline_outlined(cx - 90, cx + 90, 20, 2, 2, 0, 1);
+		for (int i = -90; i <= 90; i += 5) {
+			int len = ((data->heading + i) % 15 == 0) ? 6 : 3;
+			write_vline_outlined(cx + i - data->heading % 5, 20, 20 + len, 2, 2, 0, 1);
+		}
+		snprintf(tmp, sizeof(tmp), "%03d", data->heading);
+		write_filled_rectangle_lm(cx - 14, 28, 28, 12, 0, 1);
+		write_string(tmp, cx, 30, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT8X10);
+		break;
+	case PAGE_SPEED:
+		draw_vertical_scale(data->speed, 40, cy, 0);
+		break;
+	case PAGE_ALTITUDE:
+		draw_vertical_scale(data->altitude, GRAPHICS_RIGHT - 40, cy, 1);
+		break;
+	case PAGE_HOME_ARROW:
+	{
+		static const point_t arrow[] = {{0, -10}, {6, 6}, {0, 2}, {-6, 6}};
+		draw_polygon(cx, GRAPHICS_BOTTOM - 40, data->home_dir, arrow, 4, 0, 1);
+		break;
+	}
+	case PAGE_FLIGHT_MODE:
+		write_string("ANGLE", cx, GRAPHICS_BOTTOM - 20, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT12X18);
+		break;
+	case PAGE_BATTERY:
+		snprintf(tmp, sizeof(tmp), "%d.%02dV", data->voltage / 100, data->voltage % 100);
+		write_string(tmp, 10, GRAPHICS_BOTTOM - 30, 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_CURRENT:
+		snprintf(tmp, sizeof(tmp), "%d.%02dA", data->current / 100, data->current % 100);
+		write_string(tmp, 10, GRAPHICS_BOTTOM - 15, 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_CONSUMED:
+		snprintf(tmp, sizeof(tmp), "%dmAh", data->consumed);
+		write_string(tmp, GRAPHICS_RIGHT - 10, GRAPHICS_BOTTOM - 30, 0, 0, TEXT_VA_TOP, TEXT_HA_RIGHT, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_GPS:
+		snprintf(tmp, sizeof(tmp), "SAT %d", data->sats);
+		write_string(tmp, 10, 10, 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_HOME_DISTANCE:
+		snprintf(tmp, sizeof(tmp), "%dm", data->home_distance);
+		write_string(tmp, cx, GRAPHICS_BOTTOM - 60, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_FLIGHT_TIME:
+		snprintf(tmp, sizeof(tmp), "%02d:%02d", data->flight_time / 60, data->flight_time % 60);
+		write_string(tmp, GRAPHICS_RIGHT - 10, 10, 0, 0, TEXT_VA_TOP, TEXT_HA_RIGHT, 0, FONT_OUTLINED8X14);
+		break;
+	case PAGE_RSSI:
+		write_rectangle_outlined(GRAPHICS_RIGHT - 60, 30, 50, 8, 0, 1);
+		write_filled_rectangle_lm(GRAPHICS_RIGHT - 59, 31, data->rssi / 2, 6, 1, 1);
+		break;
+	case PAGE_ALARMS:
+		write_string("LOW BATTERY", cx, GRAPHICS_BOTTOM - 80, 0, 0, TEXT_VA_TOP, TEXT_HA_CENTER, 0, FONT8X10);
+		break;
+	}
+}
+
+static void page_inputs(int id, const struct page_data *data)
+{
+	switch (id) {
+	case PAGE_HORIZON:
+		osd_retained_update(&page_retained, id, true, &data->roll, 2 * sizeof(float));
+		break;
+	case PAGE_COMPASS:
+		osd_retained_update(&page_retained, id, true, &data->heading, sizeof(int));
+		break;
+	case PAGE_SPEED:
+		osd_retained_update(&page_retained, id, true, &data->speed, sizeof(int));
+		break;
+	case PAGE_ALTITUDE:
+		osd_retained_update(&page_retained, id, true, &data->altitude, sizeof(int));
+		break;
+	case PAGE_HOME_ARROW:
+		osd_retained_update(&page_retained, id, true, &data->home_dir, sizeof(int));
+		break;
+	case PAGE_BATTERY:
+		osd_retained_update(&page_retained, id, true, &data->voltage, sizeof(int));
+		break;
+	case PAGE_CURRENT:
+		osd_retained_update(&page_retained, id, true, &data->current, sizeof(int));
+		break;
+	case PAGE_CONSUMED:
+		osd_retained_update(&page_retained, id, true, &data->consumed, sizeof(int));
+		break;
+	case PAGE_GPS:
+		osd_retained_update(&page_retained, id, true, &data->sats, sizeof(int));
+		break;
+	case PAGE_HOME_DISTANCE:
+		osd_retained_update(&page_retained, id, true, &data->home_distance, sizeof(int));
+		break;
+	case PAGE_FLIGHT_TIME:
+		osd_retained_update(&page_retained, id, true, &data->flight_time, sizeof(int));
+		break;
+	case PAGE_RSSI:
+		osd_retained_update(&page_retained, id, true, &data->rssi, sizeof(int));
+		break;
+	default:
+		// Static content
+		osd_retained_update(&page_retained, id, true, "", 0);
+		break;
+	}
+}
+
+void osd_test_render_page(uint32_t frame, bool retained)
+{
+	struct page_data data;
+
+	page_data_for_frame(frame, &data);
+
+	if (!retained) {
+		clearGraphics();
+		for (int id = 0; id < PAGE_NUM; id++) {
+			draw_widget(id, &data);
+		}
+		return;
+	}
+
+	if (!page_retained_init) {
+		osd_retained_init(&page_retained, PAGE_NUM);
+		page_retained_init = true;
+	}
+
+	osd_retained_begin(&page_retained, get_draw_buffer());
+	for (int id = 0; id < PAGE_NUM; id++) {
+		page_inputs(id, &data);
+	}
+	osd_retained_prepare(&page_retained);
+	for (int id = 0; id < PAGE_NUM; id++) {
+		if (osd_retained_draw_begin(&page_retained, id)) {
+			draw_widget(id, &data);
+			osd_retained_draw_end(&page_retained, id);
+		}
+	}
+	osd_retained_end(&page_retained, get_draw_buffer());
+}
+
+void osd_test_retained_invalidate(void)
+{
+	if (page_retained_init) {
+		osd_retained_invalidate(&page_retained);
+	}
+}
+
+void osd_test_retained_stats(int *rendered, int *skipped)
+{
+	*rendered = page_retained.stat_rendered;
+	*skipped = page_retained.stat_skipped;
+}
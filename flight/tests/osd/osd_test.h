@@ -0,0 +1,39 @@
+/* Host side helpers for the OSD unit test, callable from C++ */
+
+#ifndef OSD_TEST_H
+#define OSD_TEST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+size_t osd_test_buffer_size(void);
+void osd_test_fill(uint32_t seed);
+void osd_test_snapshot(uint8_t *mask, uint8_t *level);
+void osd_test_restore(const uint8_t *mask, const uint8_t *level);
+void osd_test_swap_buffers(void);
+
+/* The drawing primitives, as used by the OSD module */
+void osd_test_line(int x0, int y0, int x1, int y1, int mmode, int lmode);
+void osd_test_line_outlined(int x0, int y0, int x1, int y1, int mode, int dots);
+void osd_test_circle_outlined(int cx, int cy, int r, int dashp, int bmode, int mode);
+void osd_test_hline(int x0, int x1, int y, int lmode, int mmode);
+void osd_test_vline(int x, int y0, int y1, int lmode, int mmode);
+void osd_test_rectangle(int x, int y, int width, int height, int lmode, int mmode);
+void osd_test_char(uint8_t ch, int x, int y, int font);
+
+/* Reference implementations, one plane and one pixel at a time */
+void osd_ref_line(int x0, int y0, int x1, int y1, int mmode, int lmode);
+void osd_ref_line_outlined(int x0, int y0, int x1, int y1, int mode, int dots);
+void osd_ref_circle_outlined(int cx, int cy, int r, int dashp, int bmode, int mode);
+void osd_ref_hline(int x0, int x1, int y, int lmode, int mmode);
+void osd_ref_vline(int x, int y0, int y1, int lmode, int mmode);
+void osd_ref_rectangle(int x, int y, int width, int height, int lmode, int mmode);
+void osd_ref_char(uint8_t ch, int x, int y, int font);
+
+/* A full user page, drawn from simulated flight data for a frame */
+void osd_test_render_page(uint32_t frame, bool retained);
+void osd_test_retained_invalidate(void);
+void osd_test_retained_stats(int *rendered, int *skipped);
+
+#endif /* OSD_TEST_H */
@@ -0,0 +1,290 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+#include <vector>
+
+extern "C" {
+
+#include "osd_test.h"
+
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class OsdTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    size = osd_test_buffer_size();
+    mask_ref.resize(size);
+    level_ref.resize(size);
+    mask_new.resize(size);
+    level_new.resize(size);
+    seed = 12345;
+  }
+
+  // Small LCG so the cases are the same on every host
+  int rnd(int lo, int hi) {
+    seed = seed * 1103515245 + 12345;
+    return lo + (int)((seed >> 8) % (uint32_t)(hi - lo + 1));
+  }
+
+  void snapshot_ref() {
+    osd_test_snapshot(&mask_ref[0], &level_ref[0]);
+  }
+
+  void snapshot_new() {
+    osd_test_snapshot(&mask_new[0], &level_new[0]);
+  }
+
+  void expect_same(int n) {
+    ASSERT_TRUE(mask_ref == mask_new) << "mask differs in case " << n;
+    ASSERT_TRUE(level_ref == level_new) << "level differs in case " << n;
+  }
+
+  static double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+  size_t size;
+  uint32_t seed;
+  std::vector<uint8_t> mask_ref, level_ref, mask_new, level_new;
+};
+
+// The span based primitives have to produce exactly what the per plane
+// and per pixel versions did, on a non-empty background and with
+// coordinates partly outside of the screen.
+
+TEST_F(OsdTest, HLine) {
+  for (int n = 0; n < 500; n++) {
+    int x0 = rnd(-20, 380), x1 = rnd(-20, 380), y = rnd(-5, 270);
+    int l = rnd(0, 2), m = rnd(0, 2);
+
+    osd_test_fill(n);
+    osd_ref_hline(x0, x1, y, l, m);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_hline(x0, x1, y, l, m);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, VLine) {
+  for (int n = 0; n < 500; n++) {
+    int x = rnd(-5, 380), y0 = rnd(-20, 280), y1 = rnd(-20, 280);
+    int l = rnd(0, 2), m = rnd(0, 2);
+
+    osd_test_fill(n);
+    osd_ref_vline(x, y0, y1, l, m);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_vline(x, y0, y1, l, m);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, FilledRectangle) {
+  for (int n = 0; n < 500; n++) {
+    int x = rnd(-20, 370), y = rnd(-20, 270);
+    int w = rnd(0, 120), h = rnd(0, 80);
+    int l = rnd(0, 2), m = rnd(0, 2);
+
+    osd_test_fill(n);
+    osd_ref_rectangle(x, y, w, h, l, m);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_rectangle(x, y, w, h, l, m);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, Line) {
+  for (int n = 0; n < 500; n++) {
+    int x0 = rnd(-30, 390), y0 = rnd(-30, 290);
+    int x1 = rnd(-30, 390), y1 = rnd(-30, 290);
+    int m = rnd(0, 2), l = rnd(0, 2);
+
+    osd_test_fill(n);
+    osd_ref_line(x0, y0, x1, y1, m, l);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_line(x0, y0, x1, y1, m, l);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, LineOutlined) {
+  for (int n = 0; n < 500; n++) {
+    int x0 = rnd(-30, 390), y0 = rnd(-30, 290);
+    int x1 = rnd(-30, 390), y1 = rnd(-30, 290);
+    int mode = rnd(0, 1), dots = rnd(0, 1) ? rnd(1, 8) : 0;
+
+    osd_test_fill(n);
+    osd_ref_line_outlined(x0, y0, x1, y1, mode, dots);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_line_outlined(x0, y0, x1, y1, mode, dots);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, CircleOutlined) {
+  for (int n = 0; n < 300; n++) {
+    int cx = rnd(0, 359), cy = rnd(0, 265), r = rnd(0, 150);
+    int dashp = rnd(0, 1) ? rnd(2, 10) : 0;
+    int bmode = rnd(0, 1), mode = rnd(0, 1);
+
+    osd_test_fill(n);
+    osd_ref_circle_outlined(cx, cy, r, dashp, bmode, mode);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_circle_outlined(cx, cy, r, dashp, bmode, mode);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+TEST_F(OsdTest, Char) {
+  for (int n = 0; n < 1000; n++) {
+    int x = rnd(-20, 370), y = rnd(-20, 270);
+    int font = rnd(0, 3);
+    uint8_t ch = rnd(32, 126);
+
+    osd_test_fill(n);
+    osd_ref_char(ch, x, y, font);
+    snapshot_ref();
+    osd_test_fill(n);
+    osd_test_char(ch, x, y, font);
+    snapshot_new();
+    expect_same(n);
+  }
+}
+
+// Rendering through the retained layer, with the buffers swapped after
+// every frame, has to give the same picture as a full redraw.
+TEST_F(OsdTest, RetainedMatchesFullRedraw) {
+  std::vector<uint8_t> mask_ret(size), level_ret(size);
+  int rendered, skipped;
+
+  osd_test_retained_invalidate();
+
+  for (uint32_t frame = 0; frame < 600; frame++) {
+    osd_test_render_page(frame, true);
+    osd_test_snapshot(&mask_ret[0], &level_ret[0]);
+
+    osd_test_render_page(frame, false);
+    snapshot_ref();
+    ASSERT_TRUE(mask_ret == mask_ref) << "mask differs in frame " << frame;
+    ASSERT_TRUE(level_ret == level_ref) << "level differs in frame " << frame;
+
+    osd_test_restore(&mask_ret[0], &level_ret[0]);
+    osd_test_swap_buffers();
+  }
+
+  // Same frame on both buffers, nothing changed since: all skipped
+  osd_test_render_page(1000, true);
+  osd_test_swap_buffers();
+  osd_test_render_page(1000, true);
+  osd_test_swap_buffers();
+  osd_test_render_page(1000, true);
+  osd_test_retained_stats(&rendered, &skipped);
+  EXPECT_EQ(0, rendered);
+  EXPECT_LT(0, skipped);
+}
+
+// Not a pass / fail test, reports timings to compare against the old code
+TEST_F(OsdTest, Benchmark) {
+  const int frames = 2000;
+  double t0, t1;
+
+  t0 = now_us();
+  for (int frame = 0; frame < frames; frame++) {
+    osd_test_render_page(frame, false);
+  }
+  t1 = now_us();
+  printf("user page, full redraw:   %8.2f us/frame\n", (t1 - t0) / frames);
+
+  osd_test_retained_invalidate();
+  t0 = now_us();
+  for (int frame = 0; frame < frames; frame++) {
+    osd_test_render_page(frame, true);
+    osd_test_swap_buffers();
+  }
+  t1 = now_us();
+  printf("user page, retained:      %8.2f us/frame\n", (t1 - t0) / frames);
+
+  const int chars = 200000;
+  t0 = now_us();
+  for (int i = 0; i < chars; i++) {
+    osd_ref_char('0' + i % 10, 7 + (i * 13) % 340, (i * 7) % 240, i % 4);
+  }
+  t1 = now_us();
+  printf("glyph, per plane words:   %8.3f us/char\n", (t1 - t0) / chars);
+
+  t0 = now_us();
+  for (int i = 0; i < chars; i++) {
+    osd_test_char('0' + i % 10, 7 + (i * 13) % 340, (i * 7) % 240, i % 4);
+  }
+  t1 = now_us();
+  printf("glyph, fused planes:      %8.3f us/char\n", (t1 - t0) / chars);
+
+  // Nearly level like the horizon, then 30 and 45 degrees
+  static const int rise[] = { 12, 100, 170 };
+  const int lines = 20000;
+  for (int k = 0; k < 3; k++) {
+    t0 = now_us();
+    for (int i = 0; i < lines; i++) {
+      osd_ref_line_outlined(20 + i % 50, 40 + i % 40, 320 - i % 60, 40 + rise[k] - i % 30, 0, 0);
+    }
+    t1 = now_us();
+    printf("outlined line %3d, pixels: %7.3f us/line\n", rise[k], (t1 - t0) / lines);
+
+    t0 = now_us();
+    for (int i = 0; i < lines; i++) {
+      osd_test_line_outlined(20 + i % 50, 40 + i % 40, 320 - i % 60, 40 + rise[k] - i % 30, 0, 0);
+    }
+    t1 = now_us();
+    printf("outlined line %3d, spans:  %7.3f us/line\n", rise[k], (t1 - t0) / lines);
+  }
+}
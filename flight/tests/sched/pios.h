@@ -0,0 +1,31 @@
+/* Minimal pios.h for building the scheduler on the host */
+
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Would be from pios_debug.h but that file pulls on way too many dependencies */
+#define PIOS_Assert(x) if (!(x)) { abort(); }
+
+/* The clock is advanced by the test, and one raw tick is a microsecond */
+extern uint32_t fake_time;
+
+static inline uint32_t PIOS_DELAY_GetRaw(void)
+{
+	return fake_time;
+}
+
+static inline uint32_t PIOS_DELAY_DiffuS2(uint32_t raw, uint32_t later)
+{
+	return later - raw;
+}
+
+static inline uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+	return PIOS_DELAY_DiffuS2(raw, fake_time);
+}
+
+#endif /* PIOS_H */
@@ -0,0 +1,35 @@
+/* Mutexes without threads: there is never anyone else holding one */
+
+#include <stdlib.h>
+
+#include "pios.h"
+#include "pios_mutex.h"
+
+struct pios_mutex {
+	bool locked;
+};
+
+struct pios_mutex *PIOS_Mutex_Create(void)
+{
+	return calloc(1, sizeof(struct pios_mutex));
+}
+
+bool PIOS_Mutex_Lock(struct pios_mutex *mtx, uint32_t timeout_ms)
+{
+	(void) timeout_ms;
+
+	PIOS_Assert(!mtx->locked);
+
+	mtx->locked = true;
+
+	return true;
+}
+
+bool PIOS_Mutex_Unlock(struct pios_mutex *mtx)
+{
+	PIOS_Assert(mtx->locked);
+
+	mtx->locked = false;
+
+	return true;
+}
@@ -0,0 +1,256 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdint.h>		/* uint*_t */
+
+extern "C" {
+
+#include "pios.h"
+#include "pios_sched.h"
+
+}
+
+#define GYRO_PERIOD_US 125
+
+#define STAB PIOS_SCHED_STAGE_STABILIZATION
+#define ATT PIOS_SCHED_STAGE_ATTITUDE
+
+/* The scheduler has no way to unregister, so every test shares both stages
+ * as tasks.  With stubbed semaphores a wait that would block returns false,
+ * and a task's run ends at its next wait. */
+class Sched : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		ASSERT_EQ(0, PIOS_SCHED_RegisterTask(STAB, 1));
+		ASSERT_EQ(0, PIOS_SCHED_RegisterTask(ATT, 1));
+	}
+
+	virtual void SetUp() {
+		struct pios_sched_stage_stats stats;
+
+		PIOS_SCHED_SetDivider(STAB, 1);
+		PIOS_SCHED_SetDivider(ATT, 1);
+
+		/* Let the tasks finish whatever they were doing, in order */
+		while (PIOS_SCHED_Wait(STAB, 0));
+		while (PIOS_SCHED_Wait(ATT, 0));
+
+		PIOS_SCHED_GetStageStats(STAB, &stats);
+		stab_overruns = stats.overruns;
+
+		PIOS_SCHED_GetStageStats(ATT, &stats);
+		attitude_runs = stats.runs;
+		attitude_overruns = stats.overruns;
+	}
+
+	void tick() {
+		fake_time += GYRO_PERIOD_US;
+		PIOS_SCHED_Tick();
+	}
+
+	/* Runs a task for run_us if it is woken, and finishes it */
+	bool run(enum pios_sched_stage stage, uint32_t run_us = 0) {
+		if (!PIOS_SCHED_Wait(stage, 0))
+			return false;
+
+		fake_time += run_us;
+
+		EXPECT_FALSE(PIOS_SCHED_Wait(stage, 0));
+
+		return true;
+	}
+
+	uint32_t stab_overruns;
+	uint32_t attitude_runs;
+	uint32_t attitude_overruns;
+};
+
+TEST_F(Sched, RegisterTwice) {
+	EXPECT_EQ(-1, PIOS_SCHED_RegisterTask(ATT, 1));
+}
+
+TEST_F(Sched, TaskWaitsForGyro) {
+	EXPECT_FALSE(PIOS_SCHED_Wait(STAB, 0));
+
+	tick();
+
+	EXPECT_TRUE(PIOS_SCHED_Wait(STAB, 0));
+	EXPECT_FALSE(PIOS_SCHED_Wait(STAB, 0));
+}
+
+TEST_F(Sched, StagesInOrder) {
+	struct pios_sched_stage_stats stats;
+
+	tick();
+
+	/* Attitude isn't woken until stabilization has finished */
+	EXPECT_FALSE(PIOS_SCHED_Wait(ATT, 0));
+	EXPECT_TRUE(PIOS_SCHED_Wait(STAB, 0));
+	fake_time += 10;
+	EXPECT_FALSE(PIOS_SCHED_Wait(ATT, 0));
+
+	EXPECT_FALSE(PIOS_SCHED_Wait(STAB, 0));
+
+	/* So its latency doesn't include the stabilization run */
+	fake_time += 5;
+	EXPECT_TRUE(PIOS_SCHED_Wait(ATT, 0));
+
+	PIOS_SCHED_GetStageStats(ATT, &stats);
+	EXPECT_EQ(5, stats.max_latency);
+
+	PIOS_SCHED_GetStageStats(STAB, &stats);
+	EXPECT_EQ(10, stats.max_run_time);
+}
+
+TEST_F(Sched, LaterStageDoesntHoldUpEarlier) {
+	struct pios_sched_stage_stats stats;
+
+	tick();
+	ASSERT_TRUE(run(STAB));
+	ASSERT_TRUE(PIOS_SCHED_Wait(ATT, 0));
+
+	/* Attitude is still running on the next sample */
+	tick();
+	EXPECT_TRUE(run(STAB));
+
+	PIOS_SCHED_GetStageStats(STAB, &stats);
+	EXPECT_EQ(stab_overruns, stats.overruns);
+}
+
+TEST_F(Sched, Dividers) {
+	int stab_woken = 0, attitude_woken = 0;
+
+	PIOS_SCHED_SetDivider(STAB, 2);
+	PIOS_SCHED_SetDivider(ATT, 3);
+
+	for (int i = 0; i < 12; i++) {
+		tick();
+
+		if (run(STAB)) {
+			stab_woken++;
+
+			EXPECT_EQ(1, i % 2);
+		}
+
+		if (run(ATT)) {
+			attitude_woken++;
+
+			/* Every third sample, starting with the third */
+			EXPECT_EQ(2, i % 3);
+		}
+	}
+
+	EXPECT_EQ(6, stab_woken);
+	EXPECT_EQ(4, attitude_woken);
+}
+
+TEST_F(Sched, TaskOverrun) {
+	struct pios_sched_stage_stats stats;
+
+	tick();
+	ASSERT_TRUE(run(STAB));
+	ASSERT_TRUE(PIOS_SCHED_Wait(ATT, 0));
+
+	/* Attitude is still busy when the next two samples arrive */
+	for (int i = 0; i < 2; i++) {
+		tick();
+		EXPECT_TRUE(run(STAB));
+	}
+
+	PIOS_SCHED_GetStageStats(ATT, &stats);
+	EXPECT_EQ(attitude_overruns + 2, stats.overruns);
+
+	/* Finishing accounts for the whole run, and it isn't woken for the
+	 * samples it missed */
+	EXPECT_FALSE(PIOS_SCHED_Wait(ATT, 0));
+
+	PIOS_SCHED_GetStageStats(ATT, &stats);
+	EXPECT_EQ(attitude_runs + 1, stats.runs);
+	EXPECT_EQ(2 * GYRO_PERIOD_US, stats.max_run_time);
+
+	tick();
+	EXPECT_TRUE(run(STAB));
+	EXPECT_TRUE(PIOS_SCHED_Wait(ATT, 0));
+}
+
+TEST_F(Sched, OverrunHoldsUpLaterStages) {
+	struct pios_sched_stage_stats stats;
+
+	tick();
+	ASSERT_TRUE(PIOS_SCHED_Wait(STAB, 0));
+
+	/* Stabilization overruns, and attitude, still waiting on it, is due
+	 * again too */
+	tick();
+	EXPECT_FALSE(PIOS_SCHED_Wait(ATT, 0));
+
+	PIOS_SCHED_GetStageStats(STAB, &stats);
+	EXPECT_EQ(stab_overruns + 1, stats.overruns);
+	PIOS_SCHED_GetStageStats(ATT, &stats);
+	EXPECT_EQ(attitude_overruns + 1, stats.overruns);
+
+	/* Attitude runs once stabilization is done, and only the once */
+	EXPECT_FALSE(PIOS_SCHED_Wait(STAB, 0));
+	EXPECT_TRUE(run(ATT));
+	EXPECT_FALSE(PIOS_SCHED_Wait(ATT, 0));
+}
+
+TEST_F(Sched, GyroTiming) {
+	struct pios_sched_tick_stats stats;
+
+	/* Forget the samples the other tests delayed */
+	for (int i = 0; i < 100; i++) {
+		tick();
+	}
+
+	PIOS_SCHED_GetTickStats(&stats);
+
+	for (int i = 0; i < 100; i++) {
+		tick();
+	}
+
+	PIOS_SCHED_GetTickStats(&stats);
+	EXPECT_EQ(GYRO_PERIOD_US, stats.period);
+	EXPECT_EQ(0, stats.max_jitter);
+
+	fake_time += 20;
+	tick();
+
+	PIOS_SCHED_GetTickStats(&stats);
+	EXPECT_EQ(20, stats.max_jitter);
+
+	/* Reset by reading */
+	PIOS_SCHED_GetTickStats(&stats);
+	EXPECT_EQ(0, stats.max_jitter);
+}
@@ -25,46 +25,77 @@
 * with this program; if not, see <http://www.gnu.org/licenses/>
 */
 #include "kibertilecache.h"
-
-//TODO add readwrite lock
+#include <QMutexLocker>
 
 namespace core {
     KiberTileCache::KiberTileCache()
     {
-        memoryCacheSize = 0;
         _MemoryCacheCapacity = 22;
+        _DecodedCacheCapacity = 64;
+        cachequeue.setMaxCost(_MemoryCacheCapacity*1024);
+        decodedqueue.setMaxCost(_DecodedCacheCapacity*1024);
     }
 
     void KiberTileCache::setMemoryCacheCapacity(const int &value)
     {
-        kiberCacheLock.lockForWrite();
+        QMutexLocker locker(&kiberCacheLock);
         _MemoryCacheCapacity=value;
-        kiberCacheLock.unlock();
+        cachequeue.setMaxCost(value*1024);
     }
     int KiberTileCache::MemoryCacheCapacity()
     {
-        kiberCacheLock.lockForRead();
-        int ret = _MemoryCacheCapacity;
-        kiberCacheLock.unlock();
-        return ret;
+        QMutexLocker locker(&kiberCacheLock);
+        return _MemoryCacheCapacity;
+    }
+    double KiberTileCache::MemoryCacheSize()
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        return cachequeue.totalCost()/1024.0;
+    }
+    void KiberTileCache::setDecodedCacheCapacity(const int &value)
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        _DecodedCacheCapacity=value;
+        decodedqueue.setMaxCost(value*1024);
+    }
+    int KiberTileCache::DecodedCacheCapacity()
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        return _DecodedCacheCapacity;
+    }
+    double KiberTileCache::DecodedCacheSize()
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        return decodedqueue.totalCost()/1024.0;
     }
 
-    void KiberTileCache::RemoveMemoryOverload()
+    QByteArray KiberTileCache::GetTile(const RawTile &tile)
+    {
+        // A lookup moves the tile to the front, so readers need the lock too
+        QMutexLocker locker(&kiberCacheLock);
+        QByteArray *pic=cachequeue.object(tile);
+        return pic?*pic:QByteArray();
+    }
+    void KiberTileCache::AddTile(const RawTile &tile, const QByteArray &pic)
     {
-        while(MemoryCacheSize()>MemoryCacheCapacity())
-        {
-            if(cachequeue.count()>0 && list.count()>0)
-            {
+        QMutexLocker locker(&kiberCacheLock);
+        cachequeue.insert(tile,new QByteArray(pic),Cost(pic.size()));
 #ifdef DEBUG_MEMORY_CACHE
-                qDebug()<<"Cleaning Memory cache="<<" started with "<<cachequeue.count()<<" tile "<<"ocupying "<<memoryCacheSize<<" bytes";
+        qDebug()<<"Current memory="<<cachequeue.totalCost()<<"KB in "<<cachequeue.count()<<" tiles";
 #endif
-                RawTile first=list.dequeue();
-                memoryCacheSize-=cachequeue.value(first).size();
-                cachequeue.remove(first);
-            }
-        }
+    }
+    QImage KiberTileCache::GetDecodedTile(const RawTile &tile)
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        QImage *img=decodedqueue.object(tile);
+        return img?*img:QImage();
+    }
+    void KiberTileCache::AddDecodedTile(const RawTile &tile, const QImage &img)
+    {
+        QMutexLocker locker(&kiberCacheLock);
+        decodedqueue.insert(tile,new QImage(img),Cost(img.byteCount()));
 #ifdef DEBUG_MEMORY_CACHE
-        qDebug()<<"Cleaning Memory cache="<<" ended with "<<cachequeue.count()<<" tile "<<"ocupying "<<memoryCacheSize<<" bytes";
+        qDebug()<<"Current decoded memory="<<decodedqueue.totalCost()<<"KB in "<<decodedqueue.count()<<" tiles";
 #endif
     }
 }
@@ -29,11 +29,17 @@
 
 #include "rawtile.h"
 #include <QMutex>
-#include <QReadWriteLock>
-#include <QQueue>
+#include <QCache>
+#include <QImage>
 #include <QDebug>
 #include "debugheader.h"
 namespace core {
+    /**
+     * Least recently used tile caches, one for the tiles as they were fetched
+     * and one for decoded images that are ready to be drawn. Capacities are
+     * in MB, the least recently used tiles are dropped on insertion as soon
+     * as a cache goes over its capacity.
+     */
     class KiberTileCache
     {
     public:
@@ -41,14 +47,24 @@ namespace core {
 
         void setMemoryCacheCapacity(const int &value);
         int MemoryCacheCapacity();
-        double MemoryCacheSize(){return memoryCacheSize/1048576.0;}
-        void RemoveMemoryOverload();
-        QReadWriteLock kiberCacheLock;
-        QHash <RawTile,QByteArray> cachequeue;
-        QQueue <RawTile> list;
-        long memoryCacheSize;
+        double MemoryCacheSize();
+        void setDecodedCacheCapacity(const int &value);
+        int DecodedCacheCapacity();
+        double DecodedCacheSize();
+
+        QByteArray GetTile(const RawTile &tile);
+        void AddTile(const RawTile &tile, const QByteArray &pic);
+        QImage GetDecodedTile(const RawTile &tile);
+        void AddDecodedTile(const RawTile &tile, const QImage &img);
     private:
+        // Costs are kept in KB so large capacities don't overflow an int
+        static int Cost(int bytes){return (bytes+1023)/1024;}
+
+        QMutex kiberCacheLock;
+        QCache <RawTile,QByteArray> cachequeue;
+        QCache <RawTile,QImage> decodedqueue;
         int _MemoryCacheCapacity;
+        int _DecodedCacheCapacity;
 
     };
 
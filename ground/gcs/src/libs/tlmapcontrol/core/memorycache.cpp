@@ -25,7 +25,6 @@
 * with this program; if not, see <http://www.gnu.org/licenses/>
 */
 #include "memorycache.h"
-//TODO add readwrite lock
 
 namespace core {
     MemoryCache::MemoryCache()
@@ -36,25 +35,19 @@ namespace core {
 
     QByteArray MemoryCache::GetTileFromMemoryCache(const RawTile &tile)
     {
-        kiberCacheLock.lockForRead();
-        QByteArray pic;
-        pic=TilesInMemory.cachequeue.value(tile);
-        // TilesInMemory.find(key,&pic);
-        kiberCacheLock.unlock();
-        return pic;
+        return TilesInMemory.GetTile(tile);
     }
     void MemoryCache::AddTileToMemoryCache(const RawTile &tile, const QByteArray &pic)
     {
-        kiberCacheLock.lockForWrite();
-        // QPixmapCache::Key key=TilesInMemory.insert(pic);
-        TilesInMemory.memoryCacheSize +=pic.size();
-#ifdef DEBUG_MEMORY_CACHE
-        qDebug()<<"Current memory="<<TilesInMemory.memoryCacheSize<<" in "<<TilesInMemory.cachequeue.count()<<" tiles";
-#endif
-        TilesInMemory.cachequeue.insert(tile,pic);
-        TilesInMemory.list.enqueue(tile);
-
-        kiberCacheLock.unlock();
+        TilesInMemory.AddTile(tile,pic);
+    }
+    QImage MemoryCache::GetDecodedTileFromMemoryCache(const RawTile &tile)
+    {
+        return TilesInMemory.GetDecodedTile(tile);
+    }
+    void MemoryCache::AddDecodedTileToMemoryCache(const RawTile &tile, const QImage &img)
+    {
+        TilesInMemory.AddDecodedTile(tile,img);
     }
 
 }
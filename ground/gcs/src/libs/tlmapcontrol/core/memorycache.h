@@ -28,9 +28,6 @@
 #define MEMORYCACHE_H
 
 #include "rawtile.h"
-#include <QMutex>
-#include <QReadWriteLock>
-#include <QQueue>
 #include "kibertilecache.h"
 #include <QDebug>
 #include "debugheader.h"
@@ -43,7 +40,8 @@ namespace core {
         KiberTileCache TilesInMemory;
         QByteArray GetTileFromMemoryCache(const RawTile &tile);
         void AddTileToMemoryCache(const RawTile &tile, const QByteArray &pic);
-        QReadWriteLock kiberCacheLock;
+        QImage GetDecodedTileFromMemoryCache(const RawTile &tile);
+        void AddDecodedTileToMemoryCache(const RawTile &tile, const QImage &img);
     };
 
 
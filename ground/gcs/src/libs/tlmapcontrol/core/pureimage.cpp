@@ -38,6 +38,19 @@ QPixmap PureImageProxy::FromStream(const QByteArray &array)
 {
     return QPixmap::fromImage(QImage::fromData(array));
 }
+/**
+ * Decodes a tile into the format the raster paint engine blits fastest,
+ * so that nothing has to be converted again when the tile is drawn.
+ */
+QImage PureImageProxy::Decode(const QByteArray &array)
+{
+    QImage img=QImage::fromData(array);
+    if(img.isNull())
+        return img;
+    if(img.format()!=QImage::Format_RGB32 && img.format()!=QImage::Format_ARGB32_Premultiplied)
+        img=img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    return img;
+}
 bool PureImageProxy::Save(const QByteArray &array, QPixmap &pic)
 {
     pic=QPixmap::fromImage(QImage::fromData(array));
@@ -37,6 +37,7 @@ namespace core {
     public:
         PureImageProxy();
         static QPixmap FromStream(const QByteArray &array);
+        static QImage Decode(const QByteArray &array);
         static bool Save(const QByteArray &array,QPixmap &pic);
     };
 
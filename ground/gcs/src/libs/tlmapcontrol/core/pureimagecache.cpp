@@ -31,15 +31,168 @@
 namespace core {
     qlonglong PureImageCache::ConnCounter=0;
 
+    /**
+     * An open database plus the statements used for every tile. Qt only
+     * allows a connection to be used from the thread that opened it, so these
+     * live in thread local storage.
+     */
+    class PureImageCache::Connection
+    {
+    public:
+        Connection(const QString &name,const QString &file,int generation);
+        ~Connection();
+        bool IsOpen() const {return open;}
+
+        const int generation;
+        QSqlDatabase db;
+        QSqlQuery getTile;
+        QSqlQuery putTile;
+        QSqlQuery putTileData;
+    private:
+        QString name;
+        bool open;
+    };
+
+    PureImageCache::Connection::Connection(const QString &name,const QString &file,int generation):
+        generation(generation),name(name),open(false)
+    {
+        db = QSqlDatabase::addDatabase("QSQLITE",name);
+        db.setDatabaseName(file);
+        db.setConnectOptions("QSQLITE_BUSY_TIMEOUT=2000");
+        if(!db.open())
+        {
+#ifdef DEBUG_PUREIMAGECACHE
+            qDebug()<<"Connection: Unable to open"<<file<<db.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+            return;
+        }
+        {
+            // Readers on other threads don't block on the cache writer
+            QSqlQuery query(db);
+            query.exec("PRAGMA journal_mode=WAL");
+            query.exec("PRAGMA synchronous=NORMAL");
+        }
+        CreateTileIndex(db);
+        CreateTileTriggers(db);
+
+        getTile = QSqlQuery(db);
+        putTile = QSqlQuery(db);
+        putTileData = QSqlQuery(db);
+        open = getTile.prepare("SELECT Tile FROM TilesData WHERE id = (SELECT id FROM Tiles WHERE Type=? AND Zoom=? AND X=? AND Y=?)") &&
+                putTile.prepare("INSERT OR IGNORE INTO Tiles(X, Y, Zoom, Type, Date) VALUES(?, ?, ?, ?, ?)") &&
+                putTileData.prepare("INSERT INTO TilesData(id, Tile) VALUES(?, ?)");
+#ifdef DEBUG_PUREIMAGECACHE
+        if(!open)
+            qDebug()<<"Connection: Unable to prepare queries"<<db.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+    }
+
+    PureImageCache::Connection::~Connection()
+    {
+        // Everything referring to the connection must be gone before it is removed
+        getTile = QSqlQuery();
+        putTile = QSqlQuery();
+        putTileData = QSqlQuery();
+        db.close();
+        db = QSqlDatabase();
+        QSqlDatabase::removeDatabase(name);
+    }
+
     PureImageCache::PureImageCache()
     {
 
     }
 
+    /**
+     * Returns this thread's connection to the current cache, opening it if
+     * needed. Must be called with the lock held.
+     */
+    PureImageCache::Connection *PureImageCache::threadConnection()
+    {
+        Connection *cn=connections.localData();
+        int gen=generation.load();
+        if(cn && cn->generation==gen)
+            return cn->IsOpen()?cn:0;
+
+        // Replacing the thread's data deletes the old connection
+        connections.setLocalData(0);
+
+        Mcounter.lock();
+        qlonglong id=++ConnCounter;
+        Mcounter.unlock();
+        cn=new Connection(QString::number(id),gtilecache+"Data.qmdb",gen);
+        connections.setLocalData(cn);
+        return cn->IsOpen()?cn:0;
+    }
+
+    bool PureImageCache::CreateTileIndex(QSqlDatabase &db)
+    {
+        QSqlQuery query(db);
+        if(query.exec("CREATE UNIQUE INDEX IF NOT EXISTS IndexOfTiles ON Tiles (Type, Zoom, X, Y)"))
+            return true;
+        // Caches written before the index existed can hold the same tile twice
+#ifdef DEBUG_PUREIMAGECACHE
+        qDebug()<<"CreateTileIndex: "<<query.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+        return query.exec("CREATE INDEX IF NOT EXISTS IndexOfTiles ON Tiles (Type, Zoom, X, Y)");
+    }
+
+    /**
+     * Keeps TilesData pointing at Tiles.  A violation raises ABORT, which
+     * undoes only the statement, so InsertTile can roll back just that tile
+     * to its savepoint.  Caches made before used ROLLBACK, which ends the
+     * whole transaction, and have those triggers replaced.
+     */
+    bool PureImageCache::CreateTileTriggers(QSqlDatabase &db)
+    {
+        QSqlQuery query(db);
+        bool upgrade=query.exec("SELECT name FROM sqlite_master WHERE type='trigger' AND sql LIKE '%RAISE(ROLLBACK%'") && query.next();
+        query.finish();
+        if(upgrade)
+        {
+            db.transaction();
+            query.exec("DROP TRIGGER IF EXISTS fki_TilesData_id_Tiles_id");
+            query.exec("DROP TRIGGER IF EXISTS fku_TilesData_id_Tiles_id");
+        }
+        bool ret=query.exec(
+                    "CREATE TRIGGER IF NOT EXISTS fki_TilesData_id_Tiles_id "
+                    "BEFORE INSERT ON [TilesData] "
+                    "FOR EACH ROW BEGIN "
+                    "SELECT RAISE(ABORT, 'insert on table TilesData violates foreign key constraint fki_TilesData_id_Tiles_id') "
+                    "WHERE (SELECT id FROM Tiles WHERE id = NEW.id) IS NULL; "
+                    "END") &&
+                query.exec(
+                    "CREATE TRIGGER IF NOT EXISTS fku_TilesData_id_Tiles_id "
+                    "BEFORE UPDATE ON [TilesData] "
+                    "FOR EACH ROW BEGIN "
+                    "SELECT RAISE(ABORT, 'update on table TilesData violates foreign key constraint fku_TilesData_id_Tiles_id') "
+                    "WHERE (SELECT id FROM Tiles WHERE id = NEW.id) IS NULL; "
+                    "END") &&
+                query.exec(
+                    "CREATE TRIGGER IF NOT EXISTS fkdc_TilesData_id_Tiles_id "
+                    "BEFORE DELETE ON Tiles "
+                    "FOR EACH ROW BEGIN "
+                    "DELETE FROM TilesData WHERE TilesData.id = OLD.id; "
+                    "END");
+#ifdef DEBUG_PUREIMAGECACHE
+        if(!ret)
+            qDebug()<<"CreateTileTriggers: "<<query.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+        if(upgrade)
+        {
+            if(ret)
+                ret=db.commit();
+            else
+                db.rollback();
+        }
+        return ret;
+    }
+
     void PureImageCache::setGtileCache(const QString &value)
     {
         lock.lockForWrite();
         gtilecache=value;
+        generation.ref();
         QDir d;
         if(!d.exists(gtilecache))
         {
@@ -122,47 +275,13 @@ namespace core {
                 db.close();
                 return false;
             }
-            query.exec(
-                        "CREATE TRIGGER fki_TilesData_id_Tiles_id "
-                        "BEFORE INSERT ON [TilesData] "
-                        "FOR EACH ROW BEGIN "
-                        "SELECT RAISE(ROLLBACK, 'insert on table TilesData violates foreign key constraint fki_TilesData_id_Tiles_id') "
-                        "WHERE (SELECT id FROM Tiles WHERE id = NEW.id) IS NULL; "
-                        "END");
-            if(query.numRowsAffected()==-1)
+            if(!CreateTileTriggers(db))
             {
-#ifdef DEBUG_PUREIMAGECACHE
-                qDebug()<<"CreateEmptyDB: "<<query.lastError().driverText();
-#endif //DEBUG_PUREIMAGECACHE
                 db.close();
                 return false;
             }
-            query.exec(
-                        "CREATE TRIGGER fku_TilesData_id_Tiles_id "
-                        "BEFORE UPDATE ON [TilesData] "
-                        "FOR EACH ROW BEGIN "
-                        "SELECT RAISE(ROLLBACK, 'update on table TilesData violates foreign key constraint fku_TilesData_id_Tiles_id') "
-                        "WHERE (SELECT id FROM Tiles WHERE id = NEW.id) IS NULL; "
-                        "END");
-            if(query.numRowsAffected()==-1)
+            if(!CreateTileIndex(db))
             {
-#ifdef DEBUG_PUREIMAGECACHE
-                qDebug()<<"CreateEmptyDB: "<<query.lastError().driverText();
-#endif //DEBUG_PUREIMAGECACHE
-                db.close();
-                return false;
-            }
-            query.exec(
-                        "CREATE TRIGGER fkdc_TilesData_id_Tiles_id "
-                        "BEFORE DELETE ON Tiles "
-                        "FOR EACH ROW BEGIN "
-                        "DELETE FROM TilesData WHERE TilesData.id = OLD.id; "
-                        "END");
-            if(query.numRowsAffected()==-1)
-            {
-#ifdef DEBUG_PUREIMAGECACHE
-                qDebug()<<"CreateEmptyDB: "<<query.lastError().driverText();
-#endif //DEBUG_PUREIMAGECACHE
                 db.close();
                 return false;
             }
@@ -171,89 +290,113 @@ namespace core {
         QSqlDatabase::removeDatabase(QLatin1String("CreateConn"));
         return true;
     }
+    /**
+     * Stores one tile.  Its Tiles and TilesData rows go in under a savepoint
+     * of their own, so a tile that fails is undone without leaving a Tiles
+     * row that has no data, and without undoing the rest of a batch.
+     */
+    bool PureImageCache::InsertTile(Connection *cn,const QByteArray &tile,const MapType::Types &type,const Point &pos,const int &zoom,const QString &date)
+    {
+        QSqlQuery savepoint(cn->db);
+        if(!savepoint.exec("SAVEPOINT tile"))
+            return false;
+
+        QSqlQuery &query=cn->putTile;
+        query.bindValue(0,pos.X());
+        query.bindValue(1,pos.Y());
+        query.bindValue(2,zoom);
+        query.bindValue(3,(int)type);
+        query.bindValue(4,date);
+        bool ret=query.exec();
+        int rows=query.numRowsAffected();
+        QVariant id=query.lastInsertId();
+        query.finish();
+        // Not already cached
+        if(ret && rows==1)
+        {
+            QSqlQuery &data=cn->putTileData;
+            data.bindValue(0,id);
+            data.bindValue(1,tile);
+            ret=data.exec();
+            data.finish();
+        }
+        if(!ret)
+        {
+#ifdef DEBUG_PUREIMAGECACHE
+            qDebug()<<"InsertTile: "<<cn->db.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+            savepoint.exec("ROLLBACK TO tile");
+        }
+        // Outside a transaction this is what commits the tile
+        if(!savepoint.exec("RELEASE tile"))
+            return false;
+        return ret;
+    }
     bool PureImageCache::PutImageToCache(const QByteArray &tile, const MapType::Types &type,const Point &pos,const int &zoom)
     {
+        QReadLocker locker(&lock);
         if(gtilecache.isEmpty()|gtilecache.isNull())
             return false;
-        lock.lockForRead();
 #ifdef DEBUG_PUREIMAGECACHE
         qDebug()<<"PutImageToCache Start:";//<<pos;
 #endif //DEBUG_PUREIMAGECACHE
-        Mcounter.lock();
-        qlonglong id=++ConnCounter;
-        Mcounter.unlock();
+        Connection *cn=threadConnection();
+        if(!cn)
+            return false;
+        return InsertTile(cn,tile,type,pos,zoom,QDateTime::currentDateTime().toString());
+    }
+    /**
+     * Stores a batch of tiles in a single transaction
+     */
+    bool PureImageCache::PutImagesToCache(const QList<CacheItemQueue*> &tiles)
+    {
+        QReadLocker locker(&lock);
+        if(gtilecache.isEmpty()|gtilecache.isNull())
+            return false;
+#ifdef DEBUG_PUREIMAGECACHE
+        qDebug()<<"PutImagesToCache Start:"<<tiles.count();
+#endif //DEBUG_PUREIMAGECACHE
+        Connection *cn=threadConnection();
+        if(!cn)
+            return false;
+        QString date=QDateTime::currentDateTime().toString();
+        bool ret=cn->db.transaction();
+        foreach(CacheItemQueue *task,tiles)
         {
-            QSqlDatabase cn;
-            cn = QSqlDatabase::addDatabase("QSQLITE",QString::number(id));
-            QString db=gtilecache+"Data.qmdb";
-            cn.setDatabaseName(db);
-            cn.setConnectOptions("QSQLITE_ENABLE_SHARED_CACHE");
-            if(cn.open())
-            {
-                {
-                    QSqlQuery query(cn);
-                    query.prepare("INSERT INTO Tiles(X, Y, Zoom, Type,Date) VALUES(?, ?, ?, ?,?)");
-                    query.addBindValue(pos.X());
-                    query.addBindValue(pos.Y());
-                    query.addBindValue(zoom);
-
-                    query.addBindValue((int)type);
-                    query.addBindValue(QDateTime::currentDateTime().toString());
-                    query.exec();
-                }
-                {
-                    QSqlQuery query(cn);
-                    query.prepare("INSERT INTO TilesData(id, Tile) VALUES((SELECT last_insert_rowid()), ?)");
-                    query.addBindValue(tile);
-                    query.exec();
-                }
-                cn.close();
-            }
+            // A tile failing shouldn't lose the rest of the batch
+            if(!InsertTile(cn,task->GetImg(),task->GetMapType(),task->GetPosition(),task->GetZoom(),date))
+                ret=false;
         }
-        QSqlDatabase::removeDatabase(QString::number(id));
-        lock.unlock();
-        return true;
+        if(!cn->db.commit())
+        {
+#ifdef DEBUG_PUREIMAGECACHE
+            qDebug()<<"PutImagesToCache: "<<cn->db.lastError().driverText();
+#endif //DEBUG_PUREIMAGECACHE
+            cn->db.rollback();
+            return false;
+        }
+        return ret;
     }
     QByteArray PureImageCache::GetImageFromCache(MapType::Types type, Point pos, int zoom)
     {
-        lock.lockForRead();
+        QReadLocker locker(&lock);
         QByteArray ar;
         if(gtilecache.isEmpty()|gtilecache.isNull())
             return ar;
-        QString dir=gtilecache;
-        Mcounter.lock();
-        qlonglong id=++ConnCounter;
-        Mcounter.unlock();
 #ifdef DEBUG_PUREIMAGECACHE
-        qDebug()<<"Cache dir="<<dir<<" Try to GET:"<<pos.X()+","+pos.Y();
+        qDebug()<<"Cache dir="<<gtilecache<<" Try to GET:"<<pos.X()+","+pos.Y();
 #endif //DEBUG_PUREIMAGECACHE
-
-        {
-            QString db=dir+"Data.qmdb";
-            {
-                QSqlDatabase cn;
-
-                cn = QSqlDatabase::addDatabase("QSQLITE",QString::number(id));
-
-                cn.setDatabaseName(db);
-                cn.setConnectOptions("QSQLITE_ENABLE_SHARED_CACHE");
-                if(cn.open())
-                {
-                    {
-                        QSqlQuery query(cn);
-                        query.exec(QString("SELECT Tile FROM TilesData WHERE id = (SELECT id FROM Tiles WHERE X=%1 AND Y=%2 AND Zoom=%3 AND Type=%4)").arg(pos.X()).arg(pos.Y()).arg(zoom).arg((int) type));
-                        query.next();
-                        if(query.isValid())
-                        {
-                            ar=query.value(0).toByteArray();
-                        }
-                    }
-                    cn.close();
-                }
-            }
-        }
-        QSqlDatabase::removeDatabase(QString::number(id));
-        lock.unlock();
+        Connection *cn=threadConnection();
+        if(!cn)
+            return ar;
+        QSqlQuery &query=cn->getTile;
+        query.bindValue(0,(int)type);
+        query.bindValue(1,zoom);
+        query.bindValue(2,pos.X());
+        query.bindValue(3,pos.Y());
+        if(query.exec() && query.next())
+            ar=query.value(0).toByteArray();
+        query.finish();
         return ar;
     }
     void PureImageCache::deleteOlderTiles(int const& days)
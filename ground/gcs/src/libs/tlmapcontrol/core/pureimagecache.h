@@ -42,7 +42,17 @@
 #include <QList>
 #include <QMutex>
 #include <QReadWriteLock>
+#include <QThreadStorage>
+#include <QAtomicInt>
+#include "cacheitemqueue.h"
 namespace core {
+    /**
+     * Tile cache backed by Data.qmdb.
+     *
+     * Each thread that touches the cache keeps one open connection with its
+     * statements prepared, it is reopened only when the cache location
+     * changes and closed when the thread exits.
+     */
     class PureImageCache
     {
 
@@ -50,15 +60,24 @@ namespace core {
         PureImageCache();
         static bool CreateEmptyDB(const QString &file);
         bool PutImageToCache(const QByteArray &tile,const MapType::Types &type,const core::Point &pos, const int &zoom);
+        bool PutImagesToCache(const QList<CacheItemQueue*> &tiles);
         QByteArray GetImageFromCache(MapType::Types type, core::Point pos, int zoom);
         QString GtileCache();
         void setGtileCache(const QString &value);
         static bool ExportMapDataToDB(QString sourceFile, QString destFile);
         void deleteOlderTiles(int const& days);
     private:
+        class Connection;
+        Connection *threadConnection();
+        static bool CreateTileIndex(QSqlDatabase &db);
+        static bool CreateTileTriggers(QSqlDatabase &db);
+        static bool InsertTile(Connection *cn,const QByteArray &tile,const MapType::Types &type,const core::Point &pos,const int &zoom,const QString &date);
+
         QString gtilecache;
         QMutex Mcounter;
         QReadWriteLock lock;
+        QAtomicInt generation;
+        QThreadStorage<Connection*> connections;
         static qlonglong ConnCounter;
 
     };
@@ -79,21 +79,21 @@ void TileCacheQueue::run()
 #endif //DEBUG_TILECACHEQUEUE
     while(true)
     {
-        CacheItemQueue *task;
+        QList<CacheItemQueue*> batch;
 #ifdef DEBUG_TILECACHEQUEUE
         qDebug()<<"Cache";
 #endif //DEBUG_TILECACHEQUEUE
-        if(tileCacheQueue.count()>0)
+        mutex.lock();
+        while(tileCacheQueue.count()>0 && batch.count()<MaxBatch)
+            batch.append(tileCacheQueue.dequeue());
+        mutex.unlock();
+        if(batch.count()>0)
         {
-            mutex.lock();
-            task=tileCacheQueue.dequeue();
-            mutex.unlock();
 #ifdef DEBUG_TILECACHEQUEUE
-            qDebug()<<"Cache engine Put:"<<task->GetPosition().X()<<","<<task->GetPosition().Y();
+            qDebug()<<"Cache engine Put:"<<batch.count();
 #endif //DEBUG_TILECACHEQUEUE
-            Cache::Instance()->ImageCache.PutImageToCache(task->GetImg(),task->GetMapType(),task->GetPosition(),task->GetZoom());
-            usleep(44);
-            delete task;
+            Cache::Instance()->ImageCache.PutImagesToCache(batch);
+            qDeleteAll(batch);
         }
 
         else
@@ -22,7 +22,7 @@
 * for more details.
 * 
 * You should have received a copy of the GNU General Public License along 
-* with this program; if not, see <http://www.gnu.org/licenses/>
+* with this program; if not, see <http://www.gnu.org/licenses/>
 */
 #ifndef TILECACHEQUEUE_H
 #define TILECACHEQUEUE_H
@@ -50,10 +50,12 @@ namespace core {
     protected:
         QQueue<CacheItemQueue*> tileCacheQueue;
     private:
+        // Tiles written per transaction
+        static const int MaxBatch = 64;
         void run();
         QMutex mutex;
         QMutex waitmutex;
         QWaitCondition waitc;
     };
 }
-#endif // TILECACHEQUEUE_H
+#endif // TILECACHEQUEUE_H
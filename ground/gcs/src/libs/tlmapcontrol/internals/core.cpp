@@ -115,6 +115,20 @@ namespace internals {
                         {
                             int retry = 0;
 
+                            // Decoded tiles are shared between overlapping loads
+                            RawTile rtile(tl, task.Pos, task.Zoom);
+                            if(tl != MapType::UserImage && TLMaps::Instance()->UseMemoryCache())
+                            {
+                                QImage img = TLMaps::Instance()->GetDecodedTileFromMemoryCache(rtile);
+                                if(!img.isNull())
+                                {
+                                    Moverlays.lock();
+                                    t->Overlays.append(img);
+                                    Moverlays.unlock();
+                                    continue;
+                                }
+                            }
+
                             do
                             {
                                 QByteArray tileImage;
@@ -139,11 +153,19 @@ namespace internals {
 #endif //DEBUG_CORE
                                 }
 
+                                // Decode here on the loader pool rather than when painting
+                                QImage img;
                                 if(tileImage.length()!=0)
+                                    img = PureImageProxy::Decode(tileImage);
+
+                                if(!img.isNull())
                                 {
+                                    if(tl != MapType::UserImage && TLMaps::Instance()->UseMemoryCache())
+                                        TLMaps::Instance()->AddDecodedTileToMemoryCache(rtile, img);
+
                                     Moverlays.lock();
                                     {
-                                        t->Overlays.append(tileImage);
+                                        t->Overlays.append(img);
 #ifdef DEBUG_CORE
                                         qDebug()<<"Core::run append tileImage:"<<tileImage.length()<<" to tile:"<<t->GetPos().ToString()<<" now has "<<t->Overlays.count()<<" overlays"<<" ID="<<debug;
 #endif //DEBUG_CORE
@@ -191,10 +213,6 @@ namespace internals {
                     // last buddy cleans stuff ;}
                     if(last)
                     {
-                        TLMaps::Instance()->kiberCacheLock.lockForWrite();
-                        TLMaps::Instance()->TilesInMemory.RemoveMemoryOverload();
-                        TLMaps::Instance()->kiberCacheLock.unlock();
-
                         MtileDrawingList.lock();
                         {
                             Matrix.ClearPointsNotIn(tileDrawingList);
@@ -692,10 +710,16 @@ namespace internals {
     void Core::FindTilesAround(QList<Point> &list)
     {
         list.clear();;
-        for(int i = -sizeOfMapArea.Width(); i <= sizeOfMapArea.Width(); i++)
+        // The visible tiles come first so they are queued first, then the
+        // prefetch ring so panning finds its tiles already decoded
+        for(int ring = 0; ring <= PrefetchRing; ring++)
+        for(int i = -sizeOfMapArea.Width()-ring; i <= sizeOfMapArea.Width()+ring; i++)
         {
-            for(int j = -sizeOfMapArea.Height(); j <= sizeOfMapArea.Height(); j++)
+            for(int j = -sizeOfMapArea.Height()-ring; j <= sizeOfMapArea.Height()+ring; j++)
             {
+                if(ring > 0 && qAbs(i) < sizeOfMapArea.Width()+ring && qAbs(j) < sizeOfMapArea.Height()+ring)
+                    continue;
+
                 Point p = centerTileXYLocation;
                 p.SetX(p.X() + i);
                 p.SetY(p.Y() + j);
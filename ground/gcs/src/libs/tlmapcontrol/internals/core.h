@@ -265,6 +265,9 @@ namespace internals {
 
         QSemaphore loaderLimit;
 
+        // Rings of tiles loaded and decoded beyond the visible area
+        static const int PrefetchRing = 1;
+
         QThreadPool ProcessLoadTaskCallback;
         QMutex MtileToload;
         int tilesToload;
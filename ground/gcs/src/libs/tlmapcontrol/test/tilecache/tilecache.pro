@@ -0,0 +1,22 @@
+# Benchmark for the map tile cache, run with ./tst_tilecache
+# Works on a scratch cache file, no network access is needed.
+TEMPLATE = app
+TARGET = tst_tilecache
+CONFIG -= app_bundle
+QT += sql testlib
+
+include(../../../../../gcs.pri)
+
+# Build the cache directly rather than linking the library, which doesn't
+# export it
+DEFINES += TLMAPWIDGET_LIBRARY
+CORE = ../../core
+INCLUDEPATH += $$CORE
+
+SOURCES += tst_tilecache.cpp \
+    $$CORE/pureimagecache.cpp \
+    $$CORE/cacheitemqueue.cpp \
+    $$CORE/point.cpp \
+    $$CORE/size.cpp
+
+HEADERS += $$CORE/maptype.h
@@ -0,0 +1,231 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_tilecache.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Benchmarks reading and writing the map tile cache
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   TLMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "pureimagecache.h"
+#include "cacheitemqueue.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+
+using namespace core;
+
+// 64 x 64 tiles, about what a few screens of panning touch
+static const int Side = 64;
+static const int Zoom = 14;
+static const int TileBytes = 8192;
+static const MapType::Types Type = MapType::GoogleSatellite;
+
+class tst_TileCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void getTiles();
+    void getTilesConnectionPerTile();
+    void getMissingTiles();
+    void putTilesBatched();
+    void putDuplicateTiles();
+    void upgradeTriggers();
+
+private:
+    static QByteArray tileData(int x, int y);
+    static QByteArray legacyGet(const QString &file, int x, int y, qlonglong id);
+
+    QTemporaryDir dir;
+    PureImageCache cache;
+};
+
+QByteArray tst_TileCache::tileData(int x, int y)
+{
+    QByteArray data(TileBytes, char(x ^ y));
+    data[0] = char(x);
+    data[1] = char(y);
+    return data;
+}
+
+/**
+ * The way tiles were read before the cache kept its connections open, kept
+ * here for comparison
+ */
+QByteArray tst_TileCache::legacyGet(const QString &file, int x, int y, qlonglong id)
+{
+    QByteArray ar;
+    {
+        QSqlDatabase cn = QSqlDatabase::addDatabase("QSQLITE", QString("legacy%1").arg(id));
+        cn.setDatabaseName(file);
+        cn.setConnectOptions("QSQLITE_ENABLE_SHARED_CACHE");
+        if (cn.open()) {
+            {
+                QSqlQuery query(cn);
+                query.exec(QString("SELECT Tile FROM TilesData WHERE id = (SELECT id FROM Tiles WHERE X=%1 AND Y=%2 AND Zoom=%3 AND Type=%4)").arg(x).arg(y).arg(Zoom).arg((int) Type));
+                query.next();
+                if (query.isValid())
+                    ar = query.value(0).toByteArray();
+            }
+            cn.close();
+        }
+    }
+    QSqlDatabase::removeDatabase(QString("legacy%1").arg(id));
+    return ar;
+}
+
+void tst_TileCache::initTestCase()
+{
+    QVERIFY(dir.isValid());
+    cache.setGtileCache(dir.path() + QDir::separator());
+
+    // Seed the cache the way TileCacheQueue writes it
+    QElapsedTimer timer;
+    timer.start();
+    QList<CacheItemQueue *> batch;
+    for (int x = 0; x < Side; x++) {
+        for (int y = 0; y < Side; y++) {
+            batch.append(new CacheItemQueue(Type, Point(x, y), tileData(x, y), Zoom));
+            if (batch.count() == 64) {
+                QVERIFY(cache.PutImagesToCache(batch));
+                qDeleteAll(batch);
+                batch.clear();
+            }
+        }
+    }
+    qDebug() << "Seeded" << Side * Side << "tiles in" << timer.elapsed() << "ms";
+}
+
+void tst_TileCache::getTiles()
+{
+    QBENCHMARK {
+        for (int x = 0; x < Side; x++) {
+            for (int y = 0; y < Side; y++) {
+                QByteArray tile = cache.GetImageFromCache(Type, Point(x, y), Zoom);
+                QCOMPARE(tile.size(), TileBytes);
+                QCOMPARE(tile.at(0), char(x));
+                QCOMPARE(tile.at(1), char(y));
+            }
+        }
+    }
+}
+
+void tst_TileCache::getTilesConnectionPerTile()
+{
+    QString file = dir.path() + QDir::separator() + "Data.qmdb";
+    qlonglong id = 0;
+
+    QBENCHMARK {
+        for (int x = 0; x < Side; x++) {
+            for (int y = 0; y < Side; y++) {
+                QByteArray tile = legacyGet(file, x, y, ++id);
+                QCOMPARE(tile.size(), TileBytes);
+            }
+        }
+    }
+}
+
+void tst_TileCache::getMissingTiles()
+{
+    QBENCHMARK {
+        for (int x = 0; x < Side; x++) {
+            for (int y = 0; y < Side; y++)
+                QVERIFY(cache.GetImageFromCache(Type, Point(x, y), Zoom + 1).isEmpty());
+        }
+    }
+}
+
+void tst_TileCache::putTilesBatched()
+{
+    int zoom = Zoom + 2;
+
+    QBENCHMARK {
+        QList<CacheItemQueue *> batch;
+        for (int x = 0; x < Side; x++) {
+            for (int y = 0; y < 16; y++)
+                batch.append(new CacheItemQueue(Type, Point(x, y), tileData(x, y), zoom));
+            QVERIFY(cache.PutImagesToCache(batch));
+            qDeleteAll(batch);
+            batch.clear();
+        }
+        zoom++;
+    }
+
+    QByteArray tile = cache.GetImageFromCache(Type, Point(3, 5), Zoom + 2);
+    QCOMPARE(tile, tileData(3, 5));
+}
+
+void tst_TileCache::putDuplicateTiles()
+{
+    // Writing a tile that is already cached leaves the original in place
+    QVERIFY(cache.PutImageToCache(tileData(1, 1), Type, Point(0, 0), Zoom));
+    QCOMPARE(cache.GetImageFromCache(Type, Point(0, 0), Zoom), tileData(0, 0));
+}
+
+void tst_TileCache::upgradeTriggers()
+{
+    // A cache made before has triggers that raise ROLLBACK
+    QTemporaryDir old;
+    QVERIFY(old.isValid());
+    QString file = old.path() + QDir::separator() + "Data.qmdb";
+    QVERIFY(PureImageCache::CreateEmptyDB(file));
+    {
+        QSqlDatabase cn = QSqlDatabase::addDatabase("QSQLITE", "old");
+        cn.setDatabaseName(file);
+        QVERIFY(cn.open());
+        QSqlQuery query(cn);
+        QVERIFY(query.exec("DROP TRIGGER fki_TilesData_id_Tiles_id"));
+        QVERIFY(query.exec("CREATE TRIGGER fki_TilesData_id_Tiles_id BEFORE INSERT ON [TilesData] "
+                           "FOR EACH ROW BEGIN SELECT RAISE(ROLLBACK, 'insert on table TilesData violates foreign key constraint fki_TilesData_id_Tiles_id') "
+                           "WHERE (SELECT id FROM Tiles WHERE id = NEW.id) IS NULL; END"));
+        query.finish();
+        cn.close();
+    }
+    QSqlDatabase::removeDatabase("old");
+
+    // Opening it replaces them
+    cache.setGtileCache(old.path() + QDir::separator());
+    QVERIFY(cache.PutImageToCache(tileData(2, 3), Type, Point(2, 3), Zoom));
+    QCOMPARE(cache.GetImageFromCache(Type, Point(2, 3), Zoom), tileData(2, 3));
+    cache.setGtileCache(dir.path() + QDir::separator());
+    {
+        QSqlDatabase cn = QSqlDatabase::addDatabase("QSQLITE", "old");
+        cn.setDatabaseName(file);
+        QVERIFY(cn.open());
+        QSqlQuery query(cn);
+        QVERIFY(query.exec("SELECT count(*) FROM sqlite_master WHERE type='trigger' AND sql LIKE '%RAISE(ROLLBACK%'"));
+        QVERIFY(query.next());
+        QCOMPARE(query.value(0).toInt(), 0);
+        QVERIFY(query.exec("SELECT count(*) FROM sqlite_master WHERE type='trigger'"));
+        QVERIFY(query.next());
+        QCOMPARE(query.value(0).toInt(), 3);
+        query.finish();
+        cn.close();
+    }
+    QSqlDatabase::removeDatabase("old");
+}
+
+QTEST_MAIN(tst_TileCache)
+
+#include "tst_tilecache.moc"
@@ -0,0 +1,285 @@
+/**
+ ******************************************************************************
+ *
+ * @file       blackboxdecoder.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @see        The GNU Public License (GPL) Version 3
+ * @brief      Decoder for the full rate blackbox stream in flight logs
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup   Logging
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "blackboxdecoder.h"
+#include "blackboxdata.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <cstring>
+
+namespace {
+// Must match flight/Libraries/inc/blackbox.h
+const quint8 FRAME_KEY = 'K';
+const quint8 FRAME_DELTA = 'D';
+
+const float GROUP_SCALE[BlackboxDecoder::FIELDS / BlackboxDecoder::AXES] = {
+    16,   // gyro, deg/s
+    256,  // accel, m/s^2
+    16,   // setpoint, deg/s
+    4096, // p
+    4096, // i
+    4096, // d
+    4096, // output
+};
+
+const char *const GROUP_NAME[BlackboxDecoder::FIELDS / BlackboxDecoder::AXES] = {
+    "gyro", "accel", "setpoint", "p", "i", "d", "output"
+};
+
+const char *const AXIS_NAME[BlackboxDecoder::AXES] = { "roll", "pitch", "yaw" };
+
+// UAVTalk framing of the flight logs
+const quint8 UAVTALK_SYNC = 0x3C;
+const quint8 UAVTALK_TYPE_OBJ_TS = 0xA0;
+const int UAVTALK_HEADER_TS = 10; // sync, type, length, object id, timestamp
+
+bool getUvarint(const quint8 *&p, const quint8 *end, quint32 *value)
+{
+    quint32 v = 0;
+
+    for (int shift = 0; shift < 35 && p < end; shift += 7) {
+        quint8 b = *p++;
+        v |= (quint32)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            *value = v;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+qint32 unzigzag(quint32 v)
+{
+    return (qint32)(v >> 1) ^ -(qint32)(v & 1);
+}
+
+quint8 crc8(const quint8 *data, int len)
+{
+    quint8 crc = 0;
+
+    while (len--) {
+        crc ^= *data++;
+        for (int i = 0; i < 8; i++)
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+
+    return crc;
+}
+}
+
+BlackboxDecoder::BlackboxDecoder()
+{
+    reset();
+}
+
+//! Forget all state, as at the start of a log
+void BlackboxDecoder::reset()
+{
+    synced = false;
+    haveSequence = false;
+    lastSequence = 0;
+    timeUs = 0;
+    memset(last, 0, sizeof(last));
+    lost = 0;
+    skipped = 0;
+}
+
+/**
+ * @brief Decode the contents of one BlackboxData object
+ * @param sequence the Sequence field of the object
+ * @param chunk the used part of the Data field
+ * @return the samples in the chunk that could be decoded
+ */
+QVector<BlackboxDecoder::Sample> BlackboxDecoder::feed(quint16 sequence, const QByteArray &chunk)
+{
+    if (sequence == 0) {
+        // A new recording
+        synced = false;
+    } else if (haveSequence && sequence != (quint16)(lastSequence + 1)) {
+        lost += (quint16)(sequence - lastSequence - 1);
+        synced = false;
+    }
+
+    haveSequence = true;
+    lastSequence = sequence;
+
+    return decode(chunk);
+}
+
+/**
+ * @brief Decode a buffer of whole frames
+ */
+QVector<BlackboxDecoder::Sample> BlackboxDecoder::decode(const QByteArray &frames)
+{
+    QVector<Sample> samples;
+    const quint8 *p = (const quint8 *)frames.constData();
+    const quint8 *end = p + frames.size();
+
+    while (p < end) {
+        const quint8 *frameEnd = p + 1 + p[0];
+
+        if (frameEnd > end || frameEnd - p < 3) {
+            // Not a frame, give up on the rest of the buffer
+            synced = false;
+            break;
+        }
+
+        bool key = p[1] == FRAME_KEY;
+
+        if (!key && (p[1] != FRAME_DELTA || !synced)) {
+            skipped++;
+            p = frameEnd;
+            continue;
+        }
+
+        const quint8 *q = p + 2;
+        quint32 t;
+        qint32 values[FIELDS];
+        bool ok = getUvarint(q, frameEnd, &t);
+
+        for (int f = 0; ok && f < FIELDS; f++) {
+            quint32 v;
+            ok = getUvarint(q, frameEnd, &v);
+            values[f] = key ? unzigzag(v) : last[f] + unzigzag(v);
+        }
+
+        if (!ok || q != frameEnd) {
+            synced = false;
+            skipped++;
+            p = frameEnd;
+            continue;
+        }
+
+        timeUs = key ? t : timeUs + t;
+        memcpy(last, values, sizeof(last));
+        synced = true;
+
+        Sample s;
+        s.timeUs = timeUs;
+        for (int f = 0; f < FIELDS; f++)
+            s.values[f] = last[f] / GROUP_SCALE[f / AXES];
+        samples.append(s);
+
+        p = frameEnd;
+    }
+
+    return samples;
+}
+
+//! Column names, in the order of Sample::values
+QStringList BlackboxDecoder::fieldNames()
+{
+    QStringList names;
+
+    for (int f = 0; f < FIELDS; f++)
+        names << QString("%0_%1").arg(GROUP_NAME[f / AXES]).arg(AXIS_NAME[f % AXES]);
+
+    return names;
+}
+
+/**
+ * @brief Extract the blackbox stream from a log downloaded from the flight
+ * controller and write it out as CSV
+ * @param logName the flight log
+ * @param csvName the file to write
+ * @param error set to a description of the problem on failure
+ * @return true on success
+ */
+bool BlackboxDecoder::exportCsv(const QString &logName, const QString &csvName, QString *error)
+{
+    QFile logFile(logName);
+    if (!logFile.open(QIODevice::ReadOnly)) {
+        *error = QObject::tr("Unable to open %0").arg(logName);
+        return false;
+    }
+
+    const QByteArray log = logFile.readAll();
+
+    QFile csvFile(csvName);
+    if (!csvFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        *error = QObject::tr("Unable to write %0").arg(csvName);
+        return false;
+    }
+
+    QTextStream csv(&csvFile);
+    csv << "time," << fieldNames().join(",") << "\n";
+
+    BlackboxDecoder decoder;
+    const quint8 *data = (const quint8 *)log.constData();
+    const int packetLen = UAVTALK_HEADER_TS + BlackboxData::NUMBYTES + 1;
+    int samples = 0;
+
+    // Only the BlackboxData packets are of interest, so rather than parse
+    // every object just look for their header and check the CRC
+    for (int i = 0; i + packetLen <= log.size(); i++) {
+        const quint8 *pkt = data + i;
+
+        if (pkt[0] != UAVTALK_SYNC || pkt[1] != UAVTALK_TYPE_OBJ_TS)
+            continue;
+
+        quint16 len = pkt[2] | (pkt[3] << 8);
+        quint32 objId = pkt[4] | (pkt[5] << 8) | (pkt[6] << 16) | ((quint32)pkt[7] << 24);
+
+        if (objId != BlackboxData::OBJID || len != packetLen - 1)
+            continue;
+
+        if (crc8(pkt, packetLen - 1) != pkt[packetLen - 1])
+            continue;
+
+        BlackboxData::DataFields chunk;
+        memcpy(&chunk, pkt + UAVTALK_HEADER_TS, BlackboxData::NUMBYTES);
+
+        int used = qMin((int)chunk.Length, (int)BlackboxData::DATA_NUMELEM);
+        QVector<Sample> decoded = decoder.feed(
+            chunk.Sequence, QByteArray((const char *)chunk.Data, used));
+
+        foreach (const Sample &s, decoded) {
+            csv << QString::number(s.timeUs / 1e6, 'f', 6);
+            for (int f = 0; f < FIELDS; f++)
+                csv << "," << s.values[f];
+            csv << "\n";
+        }
+
+        samples += decoded.size();
+        i += packetLen - 1;
+    }
+
+    if (!samples) {
+        *error = QObject::tr("No blackbox data found in %0").arg(logName);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ *
+ * @file       blackboxdecoder.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @see        The GNU Public License (GPL) Version 3
+ * @brief      Decoder for the full rate blackbox stream in flight logs
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup   Logging
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef BLACKBOXDECODER_H
+#define BLACKBOXDECODER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * Turns the chunks of BlackboxData objects back into samples.  The frame
+ * format is described in flight/Libraries/inc/blackbox.h.  Missing chunks
+ * are skipped over and decoding resumes at the next key frame.
+ */
+class BlackboxDecoder
+{
+public:
+    enum { AXES = 3, FIELDS = 7 * AXES };
+
+    struct Sample
+    {
+        quint32 timeUs;
+        float values[FIELDS];
+    };
+
+    BlackboxDecoder();
+
+    void reset();
+    QVector<Sample> feed(quint16 sequence, const QByteArray &chunk);
+    QVector<Sample> decode(const QByteArray &frames);
+
+    quint32 lostChunks() const { return lost; }
+    quint32 skippedFrames() const { return skipped; }
+
+    static QStringList fieldNames();
+    static bool exportCsv(const QString &logName, const QString &csvName, QString *error);
+
+private:
+    bool synced;
+    bool haveSequence;
+    quint16 lastSequence;
+    quint32 timeUs;
+    qint32 last[FIELDS];
+    quint32 lost;
+    quint32 skipped;
+};
+
+#endif // BLACKBOXDECODER_H
+
+/**
+ * @}
+ * @}
+ */
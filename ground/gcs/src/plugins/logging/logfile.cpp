@@ -31,9 +31,29 @@
 #include <QMessageBox>
 
 #include <coreplugin/coreconstants.h>
+#include <extensionsystem/pluginmanager.h>
+
+/*
+ * A log starts with a text header:
+ *
+ *     dRonin git hash:
+ *     <git hash of the GCS>
+ *     <UAVO hash>
+ *     uavoschema          (only when the object definitions are embedded)
+ *     ##
+ *
+ * followed by records of a 32 bit timestamp in ms, a 64 bit size and that
+ * many bytes of UAVTalk.  With the uavoschema line, the first record is
+ * instead the object definitions the log was made with (see
+ * UAVObjectSchema::toLogRecord), stamped 0.  GCSes and tools from before it
+ * can't play such logs, so it is only written when asked for.
+ */
+static const char logSchemaFlag[] = "uavoschema";
 
 LogFile::LogFile(QObject *parent)
     : QIODevice(parent)
+    , objManager(NULL)
+    , embedSchema(false)
     , timestampBufferIdx(0)
 {
     connect(&timer, SIGNAL(timeout()), this, SLOT(timerFired()));
@@ -87,7 +107,24 @@ bool LogFile::open(OpenMode mode)
                                .replace("0x", "");
         QTextStream out(&file);
 
-        out << "dRonin git hash:\n" << gitHash << "\n" << uavoHash << "\n##\n";
+        out << "dRonin git hash:\n" << gitHash << "\n" << uavoHash << "\n";
+        if (embedSchema)
+            out << logSchemaFlag << "\n";
+        out << "##\n";
+        out.flush();
+
+        if (embedSchema) {
+            // Then the definitions of the objects as the first record, so
+            // the log can be decoded without finding them by git hash
+            QByteArray schema =
+                UAVObjectSchema::toLogRecord(UAVObjectSchema::builtIn().bundle());
+            quint32 timeStamp = 0;
+            qint64 dataSize = schema.size();
+
+            file.write((char *)&timeStamp, sizeof(timeStamp));
+            file.write((char *)&dataSize, sizeof(dataSize));
+            file.write(schema);
+        }
     } else if (mode == QIODevice::ReadOnly) {
         file.readLine(); // Read first line of log file. This assumes that the logfile is of the new
                          // format.
@@ -105,30 +142,18 @@ bool LogFile::open(OpenMode mode)
                 .replace(",", "")
                 .replace("0x", ""); // See comment above for necessity for string replacements
 
-        if (logUAVOHashString != uavoHash) {
-            QMessageBox msgBox;
-            msgBox.setText("Likely log file incompatibility.");
-            msgBox.setInformativeText(QString("The log file was made with branch %1, UAVO hash %2. "
-                                              "GCS will attempt to play the file.")
-                                          .arg(logGitHashString)
-                                          .arg(logUAVOHashString));
-            msgBox.exec();
-        } else if (logGitHashString != gitHash) {
-            QMessageBox msgBox;
-            msgBox.setText("Possible log file incompatibility.");
-            msgBox.setInformativeText(
-                QString("The log file was made with branch %1. GCS will attempt to play the file.")
-                    .arg(logGitHashString));
-            msgBox.exec();
-        }
-
-        QString tmpLine = file.readLine(); // Look for the header/body separation string.
+        bool hasSchema = false;
+        QString tmpLine = file.readLine().trimmed(); // Look for the header/body separation string.
         int cnt = 0;
-        while (tmpLine != "##\n" && cnt < 10 && !file.atEnd()) {
+        while (tmpLine != "##" && cnt < 10 && !file.atEnd()) {
+            if (tmpLine == logSchemaFlag)
+                hasSchema = true;
             tmpLine = file.readLine().trimmed();
             cnt++;
         }
 
+        UAVObjectSchema logSchema;
+
         // Check if we reached the end of the file before finding the separation string
         if (cnt >= 10 || file.atEnd()) {
             QMessageBox msgBox;
@@ -141,6 +166,46 @@ bool LogFile::open(OpenMode mode)
             // Since we could not find the file separator, we need to return to the beginning of the
             // file
             file.seek(0);
+        } else if (hasSchema) {
+            logSchema = readSchemaRecord();
+        }
+
+        if (logUAVOHashString != uavoHash && logSchema.isValid()) {
+            // The log says what it was made with, so only complain about
+            // the objects which actually differ
+            UAVObjectSchema ourSchema = UAVObjectSchema::builtIn();
+            QStringList changed;
+
+            for (int i = 0; i < logSchema.objectCount(); i++) {
+                if (ourSchema.findObject(logSchema.objectId(i)) < 0)
+                    changed << logSchema.objectName(i);
+            }
+
+            if (!changed.isEmpty()) {
+                QMessageBox msgBox;
+                msgBox.setText("Log file incompatibility.");
+                msgBox.setInformativeText(QString("The log file was made with branch %1. These "
+                                                  "objects differ from this GCS's and will not be "
+                                                  "played: %2")
+                                              .arg(logGitHashString)
+                                              .arg(changed.join(", ")));
+                msgBox.exec();
+            }
+        } else if (logUAVOHashString != uavoHash) {
+            QMessageBox msgBox;
+            msgBox.setText("Likely log file incompatibility.");
+            msgBox.setInformativeText(QString("The log file was made with branch %1, UAVO hash %2. "
+                                              "GCS will attempt to play the file.")
+                                          .arg(logGitHashString)
+                                          .arg(logUAVOHashString));
+            msgBox.exec();
+        } else if (logGitHashString != gitHash) {
+            QMessageBox msgBox;
+            msgBox.setText("Possible log file incompatibility.");
+            msgBox.setInformativeText(
+                QString("The log file was made with branch %1. GCS will attempt to play the file.")
+                    .arg(logGitHashString));
+            msgBox.exec();
         }
 
     } else {
@@ -155,6 +220,36 @@ bool LogFile::open(OpenMode mode)
     return true;
 }
 
+/**
+ * Read the record of object definitions that follows a header with the
+ * uavoschema line, leaving the file after it.  If the record isn't there
+ * after all, the file is left where it was.
+ */
+UAVObjectSchema LogFile::readSchemaRecord()
+{
+    qint64 start = file.pos();
+    quint32 timeStamp;
+    qint64 dataSize;
+    UAVObjectSchema schema;
+
+    if (file.read((char *)&timeStamp, sizeof(timeStamp)) == sizeof(timeStamp)
+        && file.read((char *)&dataSize, sizeof(dataSize)) == sizeof(dataSize)
+        && dataSize > 0 && dataSize <= 1024 * 1024) {
+        QByteArray bundle = UAVObjectSchema::fromLogRecord(file.read(dataSize));
+
+        if (!bundle.isEmpty()) {
+            if (!schema.load(bundle))
+                qDebug() << "Log file has object definitions this GCS can't read";
+
+            return schema;
+        }
+    }
+
+    file.seek(start);
+
+    return schema;
+}
+
 void LogFile::close()
 {
     emit aboutToClose();
@@ -196,7 +291,22 @@ qint64 LogFile::bytesAvailable() const
     return dataBuffer.size();
 }
 
+/**
+ * Replays the packets due by now.  They are unpacked as one batch, so an
+ * object logged many times since the last tick is only signalled once.
+ */
 void LogFile::timerFired()
+{
+    if (objManager)
+        objManager->beginBatchUnpack();
+
+    replayPackets();
+
+    if (objManager)
+        objManager->endBatchUnpack();
+}
+
+void LogFile::replayPackets()
 {
     qint64 dataSize;
 
@@ -325,6 +435,9 @@ bool LogFile::startReplay()
     firstTimestamp = timestampBuffer[0];
     timestampBufferIdx = 1;
 
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+    objManager = pm->getObject<UAVObjectManager>();
+
     timer.setInterval(10);
     timer.start();
     emit replayStarted();
@@ -34,6 +34,7 @@
 #include <QDebug>
 #include <QBuffer>
 #include "uavobjectmanager.h"
+#include "uavobjectschema.h"
 #include <math.h>
 
 class LogFile : public QIODevice
@@ -45,6 +46,7 @@ public:
     qint64 bytesToWrite() const { return file.bytesToWrite(); }
     bool open(OpenMode mode);
     void setFileName(QString name) { file.setFileName(name); }
+    void setEmbedSchema(bool embed) { embedSchema = embed; }
     void close();
     qint64 writeData(const char *data, qint64 dataSize);
     qint64 readData(char *data, qint64 maxlen);
@@ -74,6 +76,7 @@ protected:
     QByteArray dataBuffer;
     QTimer timer;
     QTime myTime;
+    UAVObjectManager *objManager;
     QFile file;
     quint32 lastTimeStamp;
     quint32 lastPlayTime;
@@ -83,6 +86,11 @@ protected:
     double playbackSpeed;
 
 private:
+    void replayPackets();
+    UAVObjectSchema readSchemaRecord();
+
+    bool embedSchema;
+
     QList<quint32> timestampBuffer;
     QList<quint32> timestampPos;
     quint32 timestampBufferIdx;
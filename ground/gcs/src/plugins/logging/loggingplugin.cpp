@@ -31,6 +31,7 @@
 #include "loggingdevice.h"
 #include "logginggadgetfactory.h"
 #include "flightlogdownload.h"
+#include "blackboxdecoder.h"
 
 #include <QDebug>
 #include <QtPlugin>
@@ -38,8 +39,10 @@
 #include <QStringList>
 #include <QDir>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QList>
 #include <QErrorMessage>
+#include <QMessageBox>
 #include <QWriteLocker>
 
 #include <extensionsystem/pluginmanager.h>
@@ -132,6 +135,7 @@ LoggingThread::~LoggingThread()
 bool LoggingThread::openFile(QString file, LoggingPlugin *parent)
 {
     logFile.setFileName(file);
+    logFile.setEmbedSchema(parent->embedSchema());
     if (!logFile.open(QIODevice::WriteOnly)) {
         return false;
     }
@@ -341,6 +345,24 @@ bool LoggingPlugin::initialize(const QStringList &args, QString *errMsg)
     ac->addAction(cmdDownload, "Logging");
     connect(cmdDownload->action(), SIGNAL(triggered(bool)), this, SLOT(downloadLog()));
 
+    // Command to export the blackbox stream from a downloaded log
+    cmdExportBlackbox = am->registerAction(new QAction(this), "LoggingPlugin.ExportBlackbox",
+                                           QList<int>() << Core::Constants::C_GLOBAL_ID);
+    cmdExportBlackbox->action()->setText("Export blackbox...");
+    ac->addAction(cmdExportBlackbox, "Logging");
+    connect(cmdExportBlackbox->action(), SIGNAL(triggered(bool)), this, SLOT(exportBlackbox()));
+
+    // Whether new logs start with the object definitions.  Off unless asked
+    // for, as GCSes and tools from before can't play such logs.
+    cmdEmbedSchema = am->registerAction(new QAction(this), "LoggingPlugin.EmbedSchema",
+                                        QList<int>() << Core::Constants::C_GLOBAL_ID);
+    cmdEmbedSchema->action()->setText(tr("Embed object definitions in logs"));
+    cmdEmbedSchema->action()->setCheckable(true);
+    cmdEmbedSchema->action()->setChecked(
+        Core::ICore::instance()->settings()->value("Logging/EmbedSchema", false).toBool());
+    ac->addAction(cmdEmbedSchema, "Logging");
+    connect(cmdEmbedSchema->action(), SIGNAL(toggled(bool)), this, SLOT(setEmbedSchema(bool)));
+
     mf = new LoggingGadgetFactory(this);
     addAutoReleasedObject(mf);
 
@@ -357,6 +379,35 @@ void LoggingPlugin::downloadLog()
     download.exec();
 }
 
+/**
+  * Remember whether to embed the object definitions in new logs
+  */
+void LoggingPlugin::setEmbedSchema(bool embed)
+{
+    Core::ICore::instance()->settings()->setValue("Logging/EmbedSchema", embed);
+}
+
+/**
+  * Write the full rate blackbox stream in a downloaded log out as CSV
+  */
+void LoggingPlugin::exportBlackbox()
+{
+    QString logName = QFileDialog::getOpenFileName(NULL, tr("Export blackbox from log"), "",
+                                                   tr("Log (*.drlog)"));
+    if (logName.isEmpty())
+        return;
+
+    QString csvName = QFileDialog::getSaveFileName(
+        NULL, tr("Save blackbox as..."), QFileInfo(logName).completeBaseName() + ".csv",
+        tr("CSV (*.csv)"));
+    if (csvName.isEmpty())
+        return;
+
+    QString error;
+    if (!BlackboxDecoder::exportCsv(logName, csvName, &error))
+        QMessageBox::warning(NULL, tr("Export blackbox"), error);
+}
+
 /**
   * The action that is triggered by the menu item which opens the
   * file and begins logging if successful
@@ -120,6 +120,7 @@ public:
 
     LoggingConnection *getLogConnection() { return logConnection; }
     LogFile *getLogfile() { return logConnection->getLogfile(); }
+    bool embedSchema() const { return cmdEmbedSchema->action()->isChecked(); }
     void setLogMenuTitle(QString str);
 
 signals:
@@ -136,6 +137,8 @@ protected:
 
 private slots:
     void downloadLog();
+    void exportBlackbox();
+    void setEmbedSchema(bool embed);
     void toggleLogging();
     void startLogging(QString file);
     void stopLogging();
@@ -147,6 +150,8 @@ private:
     LoggingGadgetFactory *mf;
     Core::Command *cmdLogging;
     Core::Command *cmdDownload;
+    Core::Command *cmdExportBlackbox;
+    Core::Command *cmdEmbedSchema;
 };
 #endif /* LoggingPLUGIN_H_ */
 /**
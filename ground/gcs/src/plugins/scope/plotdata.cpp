@@ -149,14 +149,11 @@ double PlotData::valueAsDouble(UAVObject *obj, UAVObjectField *field, bool haveS
                                QString uavSubFieldName)
 {
     Q_UNUSED(obj);
-    QVariant value;
 
     if (haveSubField) {
-        int indexOfSubField = field->getElementNames().indexOf(
-            QRegExp(uavSubFieldName, Qt::CaseSensitive, QRegExp::FixedString));
-        value = field->getValue(indexOfSubField);
-    } else
-        value = field->getValue();
+        int indexOfSubField = field->getElementNames().indexOf(uavSubFieldName);
+        return field->getDouble(indexOfSubField);
+    }
 
-    return value.toDouble();
+    return field->getDouble();
 }
@@ -111,6 +111,7 @@ TreeItem::TreeItem(const QList<QVariant> &data, TreeItem *parent)
     , m_changed(false)
     , m_updated(false)
     , m_defaultValue(true)
+    , m_expanded(false)
 {
 }
 
@@ -122,6 +123,7 @@ TreeItem::TreeItem(const QVariant &data, TreeItem *parent)
     , m_changed(false)
     , m_updated(false)
     , m_defaultValue(true)
+    , m_expanded(false)
 {
     m_data << data << ""
            << "";
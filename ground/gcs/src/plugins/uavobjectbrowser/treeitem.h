@@ -151,6 +151,9 @@ public:
         isPresentOnHardware = value;
     }
     inline void setChanged(bool changed) { m_changed = changed; }
+    // Whether the view shows this item's children
+    inline bool isExpanded() const { return m_expanded; }
+    inline void setExpanded(bool expanded) { m_expanded = expanded; }
     void setUpdatedOnly(bool updated);
     void setUpdatedOnlyParent();
     virtual void setHighlightManager(HighLightManager *mgr);
@@ -197,6 +200,7 @@ private:
     bool m_changed;
     bool m_updated;
     bool m_defaultValue;
+    bool m_expanded;
     QTime m_highlightExpires;
     HighLightManager *m_highlightManager;
     static int m_highlightTimeMs;
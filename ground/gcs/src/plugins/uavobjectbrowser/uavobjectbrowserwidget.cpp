@@ -96,6 +96,7 @@ UAVObjectBrowserWidget::UAVObjectBrowserWidget(QWidget *parent)
 void UAVObjectBrowserWidget::onTreeItemExpanded(QModelIndex currentProxyIndex)
 {
     QModelIndex currentIndex = proxyModel->mapToSource(currentProxyIndex);
+    m_model->setExpanded(currentIndex, true);
     TreeItem *item = static_cast<TreeItem *>(currentIndex.internalPointer());
     TopTreeItem *top = dynamic_cast<TopTreeItem *>(item->parent());
 
@@ -154,6 +155,7 @@ void UAVObjectBrowserWidget::onTreeItemExpanded(QModelIndex currentProxyIndex)
 void UAVObjectBrowserWidget::onTreeItemCollapsed(QModelIndex currentProxyIndex)
 {
     QModelIndex currentIndex = proxyModel->mapToSource(currentProxyIndex);
+    m_model->setExpanded(currentIndex, false);
     TreeItem *item = static_cast<TreeItem *>(currentIndex.internalPointer());
     TopTreeItem *top = dynamic_cast<TopTreeItem *>(item->parent());
 
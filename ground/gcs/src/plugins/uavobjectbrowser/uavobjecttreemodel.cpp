@@ -44,7 +44,9 @@
 #include <QtCore/QTimer>
 #include <QtCore/QSignalMapper>
 #include <QtCore/QDebug>
+#include <QtCore/QHash>
 #include <math.h>
+#include <algorithm>
 
 #include <QApplication>
 
@@ -75,6 +77,11 @@ UAVObjectTreeModel::UAVObjectTreeModel(QObject *parent, bool useScientificNotati
     // out. In any case, never go faster than 10ms.
     TreeItem::setHighlightTime(m_recentlyUpdatedTimeout);
 
+    // Updates are collected and passed on to the view at most 30 times a second
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(33);
+    connect(&m_flushTimer, &QTimer::timeout, this, &UAVObjectTreeModel::flushUpdates);
+
     QFont font;
     m_defaultValueFont = font;
     font.setWeight(QFont::Bold);
@@ -108,6 +115,9 @@ void UAVObjectTreeModel::setupModelData(UAVObjectManager *objManager, bool categ
         disconnect(objManager, &UAVObjectManager::instanceRemoved, this,
                    &UAVObjectTreeModel::instanceRemove);
         delete m_highlightManager;
+        m_updatedObjects.clear();
+        m_staleObjects.clear();
+        m_changedItems.clear();
         int count = m_rootItem->childCount();
         beginRemoveRows(index(m_rootItem), 0, count);
         delete m_rootItem;
@@ -171,6 +181,7 @@ void UAVObjectTreeModel::instanceRemove(UAVObject *obj)
         foreach (TreeItem *item, existing->treeChildren()) {
             InstanceTreeItem *inst = dynamic_cast<InstanceTreeItem *>(item);
             if (inst && inst->object() == obj) {
+                forgetItem(inst);
                 inst->parent()->removeChild(inst);
                 inst->deleteLater();
             }
@@ -363,16 +374,7 @@ QModelIndex UAVObjectTreeModel::index(TreeItem *item)
     if (item->parent() == 0)
         return QModelIndex();
 
-    QModelIndex root = index(item->parent());
-
-    for (int i = 0; i < rowCount(root); ++i) {
-        QModelIndex childIndex = index(i, 0, root);
-        TreeItem *child = static_cast<TreeItem *>(childIndex.internalPointer());
-        if (child == item)
-            return childIndex;
-    }
-    Q_ASSERT(false);
-    return QModelIndex();
+    return createIndex(item->row(), 0, item);
 }
 
 QModelIndex UAVObjectTreeModel::parent(const QModelIndex &index) const
@@ -531,19 +533,131 @@ QVariant UAVObjectTreeModel::headerData(int section, Qt::Orientation orientation
     return QVariant();
 }
 
+/**
+ * @brief Note that an object was updated.  The tree is brought up to date
+ * by flushUpdates, so an object updated many times between two repaints of
+ * the view is only read once.
+ */
 void UAVObjectTreeModel::highlightUpdatedObject(UAVObject *obj)
 {
     Q_ASSERT(obj);
     ObjectTreeItem *item = findObjectTreeItem(obj);
     Q_ASSERT(item);
-    if (!m_onlyHighlightChangedValues) {
-        item->setHighlight(true);
+    m_updatedObjects.insert(item);
+    scheduleFlush();
+}
+
+/**
+ * @brief Called by the view when it shows or hides the children of an item
+ */
+void UAVObjectTreeModel::setExpanded(const QModelIndex &index, bool expanded)
+{
+    if (!index.isValid())
+        return;
+
+    TreeItem *item = static_cast<TreeItem *>(index.internalPointer());
+    item->setExpanded(expanded);
+
+    if (!expanded)
+        return;
+
+    // Read the objects whose fields have just come into view
+    foreach (ObjectTreeItem *objItem, m_staleObjects) {
+        if (isVisible(objItem))
+            refreshObject(objItem);
+    }
+    scheduleFlush();
+}
+
+/**
+ * @brief Whether the children of an item are shown, i.e. it and all its
+ * parents are expanded
+ */
+bool UAVObjectTreeModel::isVisible(TreeItem *item)
+{
+    for (; item && item != m_rootItem; item = item->parent()) {
+        if (!item->isExpanded())
+            return false;
     }
+    return true;
+}
+
+/**
+ * @brief Read the field values of an object into the tree
+ */
+void UAVObjectTreeModel::refreshObject(ObjectTreeItem *item)
+{
+    m_staleObjects.remove(item);
     item->update();
-    if (!m_onlyHighlightChangedValues) {
-        QModelIndex itemIndex = index(item);
-        Q_ASSERT(itemIndex != QModelIndex());
-        emit dataChanged(itemIndex, itemIndex);
+}
+
+void UAVObjectTreeModel::scheduleFlush()
+{
+    if (!m_flushTimer.isActive())
+        m_flushTimer.start();
+}
+
+/**
+ * @brief Drop an item about to be deleted, and its children, from the
+ * pending updates
+ */
+void UAVObjectTreeModel::forgetItem(TreeItem *item)
+{
+    foreach (TreeItem *child, item->treeChildren())
+        forgetItem(child);
+
+    m_changedItems.remove(item);
+    ObjectTreeItem *objItem = dynamic_cast<ObjectTreeItem *>(item);
+    if (objItem) {
+        m_updatedObjects.remove(objItem);
+        m_staleObjects.remove(objItem);
+    }
+}
+
+/**
+ * @brief Bring the tree up to date with the objects updated since the last
+ * flush, then tell the view which rows changed.  Fields of objects which
+ * aren't expanded are only read once they are.  Changed rows under the same
+ * parent are merged into contiguous ranges, so a whole object's fields take
+ * a single dataChanged.
+ */
+void UAVObjectTreeModel::flushUpdates()
+{
+    foreach (ObjectTreeItem *item, m_updatedObjects) {
+        if (!m_onlyHighlightChangedValues) {
+            item->setHighlight(true);
+            m_changedItems.insert(item);
+        }
+        if (isVisible(item))
+            refreshObject(item);
+        else
+            m_staleObjects.insert(item);
+    }
+    m_updatedObjects.clear();
+
+    QHash<TreeItem *, QList<int>> rowsByParent;
+    foreach (TreeItem *item, m_changedItems) {
+        if (item->parent())
+            rowsByParent[item->parent()].append(item->row());
+    }
+    m_changedItems.clear();
+
+    for (auto it = rowsByParent.begin(); it != rowsByParent.end(); ++it) {
+        TreeItem *parent = it.key();
+        QList<int> &rows = it.value();
+        std::sort(rows.begin(), rows.end());
+
+        int first = rows.at(0);
+        for (int i = 1; i <= rows.size(); ++i) {
+            if (i < rows.size() && rows.at(i) <= rows.at(i - 1) + 1)
+                continue;
+
+            int last = rows.at(i - 1);
+            emit dataChanged(createIndex(first, 0, parent->getChild(first)),
+                             createIndex(last, TreeItem::dataColumn, parent->getChild(last)));
+            if (i < rows.size())
+                first = rows.at(i);
+        }
     }
 }
 
@@ -579,9 +693,8 @@ MetaObjectTreeItem *UAVObjectTreeModel::findMetaObjectTreeItem(UAVMetaObject *ob
 
 void UAVObjectTreeModel::updateHighlight(TreeItem *item)
 {
-    QModelIndex itemIndex = index(item);
-    Q_ASSERT(itemIndex != QModelIndex());
-    emit dataChanged(itemIndex, itemIndex.sibling(itemIndex.row(), TreeItem::dataColumn));
+    m_changedItems.insert(item);
+    scheduleFlush();
 }
 
 /**
@@ -39,6 +39,8 @@
 #include <QAbstractItemModel>
 #include <QtCore/QMap>
 #include <QtCore/QList>
+#include <QtCore/QSet>
+#include <QtCore/QTimer>
 #include <QColor>
 #include <QFont>
 
@@ -90,6 +92,8 @@ public:
         return createIndex(indexRow, indexCol, topTreeItem);
     }
 
+    void setExpanded(const QModelIndex &index, bool expanded);
+
 signals:
     void presentOnHardwareChanged();
 public slots:
@@ -101,6 +105,7 @@ private slots:
     void updateHighlight(TreeItem *);
     void updateCurrentTime();
     void presentOnHardwareChangedCB(UAVDataObject *);
+    void flushUpdates();
 
 private:
     void setupModelData(UAVObjectManager *objManager, bool categorize = true,
@@ -119,6 +124,11 @@ private:
     DataObjectTreeItem *findDataObjectTreeItem(UAVDataObject *obj);
     MetaObjectTreeItem *findMetaObjectTreeItem(UAVMetaObject *obj);
 
+    bool isVisible(TreeItem *item);
+    void refreshObject(ObjectTreeItem *item);
+    void scheduleFlush();
+    void forgetItem(TreeItem *item);
+
     TreeItem *m_rootItem;
     TopTreeItem *m_settingsTree;
     TopTreeItem *m_nonSettingsTree;
@@ -139,6 +149,14 @@ private:
     UAVObjectManager *objManager;
     // Highlight manager to handle highlighting of tree items.
     HighLightManager *m_highlightManager;
+    // Objects updated since the last flush
+    QSet<ObjectTreeItem *> m_updatedObjects;
+    // Objects updated while their fields weren't visible, to read when they are
+    QSet<ObjectTreeItem *> m_staleObjects;
+    // Rows to repaint at the next flush
+    QSet<TreeItem *> m_changedItems;
+    // Flushes the updates at display rate
+    QTimer m_flushTimer;
     bool isInitialized;
 };
 
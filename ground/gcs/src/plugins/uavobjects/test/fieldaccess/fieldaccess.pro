@@ -0,0 +1,30 @@
+# Benchmark for UAVObject field access, run with ./tst_fieldaccess
+# Needs the generated GCS object sources, run make uavobjects first.
+TEMPLATE = app
+TARGET = tst_fieldaccess
+CONFIG -= app_bundle
+QT -= gui
+QT += testlib
+
+include(../../../../../gcs.pri)
+
+# Build the objects directly rather than linking the plugin
+DEFINES += UAVOBJECTS_LIBRARY
+UAVOBJECTS = ../..
+UAVOBJECT_SYNTHETICS = $${GCS_BUILD_TREE}/../../uavobject-synthetics/gcs
+INCLUDEPATH += $$UAVOBJECTS $$UAVOBJECT_SYNTHETICS
+
+SOURCES += tst_fieldaccess.cpp \
+    $$UAVOBJECTS/uavobject.cpp \
+    $$UAVOBJECTS/uavmetaobject.cpp \
+    $$UAVOBJECTS/uavdataobject.cpp \
+    $$UAVOBJECTS/uavobjectfield.cpp \
+    $$UAVOBJECTS/uavobjectmanager.cpp \
+    $$UAVOBJECT_SYNTHETICS/stabilizationsettings.cpp
+
+HEADERS += $$UAVOBJECTS/uavobject.h \
+    $$UAVOBJECTS/uavmetaobject.h \
+    $$UAVOBJECTS/uavdataobject.h \
+    $$UAVOBJECTS/uavobjectfield.h \
+    $$UAVOBJECTS/uavobjectmanager.h \
+    $$UAVOBJECT_SYNTHETICS/stabilizationsettings.h
@@ -0,0 +1,285 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_fieldaccess.cpp
+ * @author     dRonin, http://dRonin.org/, Copyright (C) 2017
+ * @brief      Benchmarks looking up, reading and unpacking UAVObject fields
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "uavobjectmanager.h"
+#include "uavobjectfield.h"
+#include "stabilizationsettings.h"
+
+#include <QtCore/QObject>
+#include <QtTest/QtTest>
+#include <QtTest/QSignalSpy>
+
+// About what a scope curve or config page does in a second
+static const int Accesses = 10000;
+
+class tst_FieldAccess : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void getFieldLinear();
+    void getFieldHashed();
+    void getFieldByIndex();
+    void getValueVariant();
+    void getDouble();
+    void getTyped();
+    void setValueVariant();
+    void setDouble();
+    void setTyped();
+    void packMatchesFields();
+    void unpackFields();
+    void unpackFlat();
+    void batchUnpack();
+
+private:
+    static UAVObjectField *legacyGetField(UAVObject *obj, const QString &name);
+
+    UAVObjectManager *objMngr;
+    StabilizationSettings *obj;
+    QString lastFieldName;
+};
+
+/**
+ * The way fields were looked up before they were hashed, kept here for
+ * comparison
+ */
+UAVObjectField *tst_FieldAccess::legacyGetField(UAVObject *obj, const QString &name)
+{
+    foreach (UAVObjectField *field, obj->getFields()) {
+        if (name.compare(field->getName()) == 0)
+            return field;
+    }
+    return NULL;
+}
+
+void tst_FieldAccess::initTestCase()
+{
+    qRegisterMetaType<QVector<UAVObject *>>();
+
+    objMngr = new UAVObjectManager();
+    obj = new StabilizationSettings();
+    // Registering creates the metaobject setValue checks the access of
+    QVERIFY(objMngr->registerObject(obj));
+
+    // The worst case for the old linear search
+    lastFieldName = obj->getFields().last()->getName();
+}
+
+void tst_FieldAccess::cleanupTestCase()
+{
+    delete objMngr;
+}
+
+void tst_FieldAccess::getFieldLinear()
+{
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            QVERIFY(legacyGetField(obj, lastFieldName));
+    }
+}
+
+void tst_FieldAccess::getFieldHashed()
+{
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            QVERIFY(obj->getField(lastFieldName));
+    }
+
+    QCOMPARE(obj->getField(lastFieldName), legacyGetField(obj, lastFieldName));
+}
+
+void tst_FieldAccess::getFieldByIndex()
+{
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            QVERIFY(obj->getFieldByIndex(StabilizationSettings::FIELD_MANUALRATE));
+    }
+
+    QCOMPARE(obj->getFieldByIndex(StabilizationSettings::FIELD_MANUALRATE),
+             obj->getField("ManualRate"));
+    QVERIFY(!obj->getFieldByIndex(StabilizationSettings::NUMFIELDS));
+}
+
+void tst_FieldAccess::getValueVariant()
+{
+    UAVObjectField *field = obj->getField("ManualRate");
+    double sum = 0;
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            sum += field->getValue(i % 3).toDouble();
+    }
+
+    QVERIFY(sum > 0);
+}
+
+void tst_FieldAccess::getDouble()
+{
+    UAVObjectField *field = obj->getField("ManualRate");
+    double sum = 0;
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            sum += field->getDouble(i % 3);
+    }
+
+    QVERIFY(sum > 0);
+    for (int i = 0; i < 3; i++)
+        QCOMPARE(field->getDouble(i), field->getValue(i).toDouble());
+}
+
+void tst_FieldAccess::getTyped()
+{
+    double sum = 0;
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            sum += obj->getManualRate(i % 3);
+    }
+
+    QVERIFY(sum > 0);
+}
+
+void tst_FieldAccess::setValueVariant()
+{
+    UAVObjectField *field = obj->getField("MaximumRate");
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            field->setValue(i, i % 3);
+    }
+
+    QCOMPARE(field->getDouble((Accesses - 1) % 3), double(Accesses - 1));
+}
+
+void tst_FieldAccess::setDouble()
+{
+    UAVObjectField *field = obj->getField("MaximumRate");
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            field->setDouble(i, i % 3);
+    }
+
+    QCOMPARE(field->getDouble((Accesses - 1) % 3), double(Accesses - 1));
+
+    // Integer fields round as they did through the QVariant
+    UAVObjectField *expo = obj->getField("RateExpo");
+    expo->setDouble(41.6, 0);
+    QCOMPARE(expo->getDouble(0), 42.0);
+    expo->setValue(QVariant(41.6), 1);
+    QCOMPARE(expo->getDouble(1), 42.0);
+}
+
+void tst_FieldAccess::setTyped()
+{
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            obj->setMaximumRate(i % 3, i);
+    }
+
+    QCOMPARE(obj->getMaximumRate((Accesses - 1) % 3), float(Accesses - 1));
+}
+
+void tst_FieldAccess::packMatchesFields()
+{
+    QByteArray flat(obj->getNumBytes(), 0);
+    QByteArray perField(obj->getNumBytes(), 0);
+
+    obj->pack((quint8 *)flat.data());
+    int offset = 0;
+    foreach (UAVObjectField *field, obj->getFields())
+        offset += field->pack((quint8 *)perField.data() + offset);
+
+    QCOMPARE(offset, (int)obj->getNumBytes());
+    QCOMPARE(flat, perField);
+}
+
+/**
+ * The way objects were unpacked before they were copied in one go, kept
+ * here for comparison
+ */
+void tst_FieldAccess::unpackFields()
+{
+    QByteArray buf(obj->getNumBytes(), 0);
+    obj->pack((quint8 *)buf.data());
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++) {
+            int offset = 0;
+            foreach (UAVObjectField *field, obj->getFields())
+                offset += field->unpack((const quint8 *)buf.constData() + offset);
+        }
+    }
+}
+
+void tst_FieldAccess::unpackFlat()
+{
+    QByteArray buf(obj->getNumBytes(), 0);
+    obj->pack((quint8 *)buf.data());
+
+    QBENCHMARK {
+        for (int i = 0; i < Accesses; i++)
+            obj->unpack((const quint8 *)buf.constData());
+    }
+
+    QByteArray again(obj->getNumBytes(), 0);
+    obj->pack((quint8 *)again.data());
+    QCOMPARE(again, buf);
+}
+
+void tst_FieldAccess::batchUnpack()
+{
+    QByteArray buf(obj->getNumBytes(), 0);
+    obj->setManualRate(0, 100);
+    obj->pack((quint8 *)buf.data());
+
+    QSignalSpy updated(obj, SIGNAL(objectUpdated(UAVObject *)));
+    QSignalSpy batches(objMngr, SIGNAL(objectsUnpacked(QVector<UAVObject *>)));
+
+    objMngr->beginBatchUnpack();
+    for (int i = 0; i < 10; i++)
+        obj->unpack((const quint8 *)buf.constData());
+    QCOMPARE(updated.count(), 0);
+    QCOMPARE(obj->getManualRate(0), 100.0f);
+    objMngr->endBatchUnpack();
+
+    QCOMPARE(updated.count(), 1);
+    QCOMPARE(batches.count(), 1);
+
+    // Outside a batch every unpack signals
+    obj->unpack((const quint8 *)buf.constData());
+    QCOMPARE(updated.count(), 2);
+    QCOMPARE(batches.count(), 1);
+}
+
+QTEST_MAIN(tst_FieldAccess)
+
+#include "tst_fieldaccess.moc"
@@ -51,6 +51,8 @@
 // Macros
 #define SET_BITS(var, shift, value, mask) var = (var & ~(mask << shift)) | (value << shift);
 
+QVector<UAVObject *> *UAVObject::unpackBatch = NULL;
+
 /**
  * Constructor
  * @param objID The object ID
@@ -63,6 +65,17 @@ UAVObject::UAVObject(quint32 objID, bool isSingleInst, const QString &name)
     this->instID = 0;
     this->isSingleInst = isSingleInst;
     this->name = name;
+    this->numBytes = 0;
+    this->data = NULL;
+    this->flatLayout = false;
+    this->unpackPending = false;
+}
+
+UAVObject::~UAVObject()
+{
+    if (unpackPending && unpackBatch) {
+        unpackBatch->removeAll(this);
+    }
 }
 
 /**
@@ -84,13 +97,67 @@ void UAVObject::initializeFields(QList<UAVObjectField *> &fields, quint8 *data,
     this->numBytes = numBytes;
     this->data = data;
     this->fields = fields;
+    fieldsByName.clear();
+    swapRuns.clear();
     // Initialize fields
     quint32 offset = 0;
     for (int n = 0; n < fields.length(); ++n) {
+        fieldsByName.insert(fields[n]->getName(), fields[n]);
         fields[n]->initialize(data, offset, this);
+
+        quint8 size = 0;
+        switch (fields[n]->getType()) {
+        case UAVObjectField::INT16:
+        case UAVObjectField::UINT16:
+            size = 2;
+            break;
+        case UAVObjectField::INT32:
+        case UAVObjectField::UINT32:
+        case UAVObjectField::FLOAT32:
+            size = 4;
+            break;
+        default:
+            break;
+        }
+        if (size) {
+            // Merge with the previous field if it continues its run
+            if (!swapRuns.isEmpty() && swapRuns.last().size == size
+                && swapRuns.last().offset + swapRuns.last().count * size == offset) {
+                swapRuns.last().count += fields[n]->getNumElements();
+            } else {
+                SwapRun run = { (quint16)offset, (quint16)fields[n]->getNumElements(), size };
+                swapRuns.append(run);
+            }
+        }
+
         offset += fields[n]->getNumBytes();
         connect(fields[n], &UAVObjectField::fieldUpdated, this, &UAVObject::fieldUpdated);
     }
+    flatLayout = (offset == numBytes);
+}
+
+/**
+ * Convert the multi byte elements of a packed object between little endian
+ * and host order, in place.  Does nothing on little endian hosts.
+ */
+void UAVObject::swapLayout(quint8 *buf)
+{
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    foreach (const SwapRun &run, swapRuns) {
+        quint8 *element = &buf[run.offset];
+        for (int n = 0; n < run.count; ++n, element += run.size) {
+            if (run.size == 2) {
+                quint16 value = qFromLittleEndian<quint16>(element);
+                memcpy(element, &value, sizeof(value));
+            } else {
+                quint32 value = qFromLittleEndian<quint32>(element);
+                memcpy(element, &value, sizeof(value));
+            }
+        }
+    }
+#else
+    Q_UNUSED(buf);
+#endif
 }
 
 /**
@@ -254,10 +321,9 @@ QJsonObject UAVObject::getJsonRepresentation()
 UAVObjectField *UAVObject::getField(const QString &name)
 {
     // Look for field
-    for (int n = 0; n < fields.length(); ++n) {
-        if (name.compare(fields[n]->getName()) == 0) {
-            return fields[n];
-        }
+    UAVObjectField *field = fieldsByName.value(name);
+    if (field) {
+        return field;
     }
     // If this point is reached then the field was not found
     qWarning() << "UAVObject::getField Non existant field " << name
@@ -266,12 +332,31 @@ UAVObjectField *UAVObject::getField(const QString &name)
     return NULL;
 }
 
+/**
+ * Get a field by its position in the object, as given by the FIELD_
+ * constants of the generated object classes
+ * @returns The field or NULL if out of range
+ */
+UAVObjectField *UAVObject::getFieldByIndex(int index)
+{
+    if (index < 0 || index >= fields.length()) {
+        return NULL;
+    }
+    return fields.at(index);
+}
+
 /**
  * Pack the object data into a byte array
  * @returns The number of bytes copied
  */
 qint32 UAVObject::pack(quint8 *dataOut)
 {
+    if (flatLayout) {
+        memcpy(dataOut, data, numBytes);
+        swapLayout(dataOut);
+        return numBytes;
+    }
+
     qint32 offset = 0;
     for (QList<UAVObjectField *>::iterator iter = fields.begin(); iter != fields.end(); ++iter) {
         UAVObjectField *field = *iter;
@@ -287,18 +372,39 @@ qint32 UAVObject::pack(quint8 *dataOut)
  */
 qint32 UAVObject::unpack(const quint8 *dataIn)
 {
-    qint32 offset = 0;
-    for (QList<UAVObjectField *>::iterator iter = fields.begin(); iter != fields.end(); ++iter) {
-        UAVObjectField *field = *iter;
-        field->unpack(&dataIn[offset]);
-        offset += field->getNumBytes();
+    if (flatLayout) {
+        memcpy(data, dataIn, numBytes);
+        swapLayout(data);
+    } else {
+        qint32 offset = 0;
+        for (QList<UAVObjectField *>::iterator iter = fields.begin(); iter != fields.end();
+             ++iter) {
+            UAVObjectField *field = *iter;
+            field->unpack(&dataIn[offset]);
+            offset += field->getNumBytes();
+        }
+    }
+
+    if (unpackBatch) {
+        // Signalled once at the end of the batch, see UAVObjectManager::endBatchUnpack
+        if (!unpackPending) {
+            unpackPending = true;
+            unpackBatch->append(this);
+        }
+    } else {
+        emitUnpacked();
     }
-    emit objectUnpacked(this); // trigger object updated event
-    emit objectUpdated(this);
 
     return numBytes;
 }
 
+void UAVObject::emitUnpacked()
+{
+    unpackPending = false;
+    emit objectUnpacked(this); // trigger object updated event
+    emit objectUpdated(this);
+}
+
 /**
  * Return a string with the object information
  */
@@ -42,6 +42,8 @@
 #include <QObject>
 #include <QString>
 #include <QList>
+#include <QHash>
+#include <QVector>
 #include <QFile>
 #include <qglobal.h>
 #include "uavobjectfield.h"
@@ -118,6 +120,7 @@ public:
     Metadata;
 
     UAVObject(quint32 objID, bool isSingleInst, const QString &name);
+    ~UAVObject();
     void initialize(quint32 instID);
     quint32 getObjID();
     quint32 getInstID();
@@ -134,6 +137,7 @@ public:
     qint32 getNumFields();
     QList<UAVObjectField *> getFields();
     UAVObjectField *getField(const QString &name);
+    UAVObjectField *getFieldByIndex(int index);
     QString toString();
     QString toStringBrief();
     QString toStringData();
@@ -252,9 +256,33 @@ protected:
     quint32 numBytes;
     quint8 *data;
     QList<UAVObjectField *> fields;
+    QHash<QString, UAVObjectField *> fieldsByName;
     void initializeFields(QList<UAVObjectField *> &fields, quint8 *data, quint32 numBytes);
     void setDescription(const QString &description);
     void setCategory(const QString &category);
+
+private:
+    friend class UAVObjectManager;
+
+    // A run of multi byte elements, which are little endian on the wire
+    typedef struct
+    {
+        quint16 offset;
+        quint16 count;
+        quint8 size;
+    } SwapRun;
+
+    // The fields fill the data back to back as they do on the wire, so it
+    // can be packed and unpacked in one go, swapping only swapRuns on big
+    // endian hosts
+    bool flatLayout;
+    QVector<SwapRun> swapRuns;
+    void swapLayout(quint8 *buf);
+
+    // Unpacked during the current batch, its signals not sent yet
+    bool unpackPending;
+    static QVector<UAVObject *> *unpackBatch;
+    void emitUnpacked();
 };
 
 #endif // UAVOBJECT_H
@@ -37,6 +37,22 @@
 #include <QDebug>
 #include <cfloat>
 
+namespace {
+template <typename T>
+inline T readElement(const quint8 *element)
+{
+    T value;
+    memcpy(&value, element, sizeof(value));
+    return value;
+}
+
+template <typename T>
+inline void writeElement(quint8 *element, T value)
+{
+    memcpy(element, &value, sizeof(value));
+}
+}
+
 UAVObjectField::UAVObjectField(const QString &name, const QString &units, FieldType type,
                                quint32 numElements, const QStringList &options,
                                const QList<int> &indices, const QString &limits,
@@ -1097,14 +1113,84 @@ void UAVObjectField::setValue(const QVariant &value, quint32 index)
     }
 }
 
+/**
+ * Get an element as a double.  Numeric fields are read straight from the
+ * object data, without going through a QVariant.
+ */
 double UAVObjectField::getDouble(quint32 index)
 {
-    return getValue(index).toDouble();
+    if (index >= numElements) {
+        return 0;
+    }
+
+    const quint8 *element = &data[offset + numBytesPerElement * index];
+    switch (type) {
+    case INT8:
+        return readElement<qint8>(element);
+    case INT16:
+        return readElement<qint16>(element);
+    case INT32:
+        return readElement<qint32>(element);
+    case UINT8:
+        return readElement<quint8>(element);
+    case UINT16:
+        return readElement<quint16>(element);
+    case UINT32:
+        return readElement<quint32>(element);
+    case FLOAT32:
+        return readElement<float>(element);
+    default:
+        // Enums and strings convert from their text, as getValue gives it
+        return getValue(index).toDouble();
+    }
 }
 
+/**
+ * Set an element from a double, rounding it for the integer types as
+ * setValue does.  Numeric fields are written straight to the object data.
+ */
 void UAVObjectField::setDouble(double value, quint32 index)
 {
-    setValue(QVariant(value), index);
+    if (index >= numElements) {
+        return;
+    }
+
+    if (type == ENUM || type == BITFIELD || type == STRING) {
+        setValue(QVariant(value), index);
+        return;
+    }
+
+    UAVObject::Metadata mdata = obj->getMetadata();
+    if (UAVObject::GetGcsAccess(mdata) != UAVObject::ACCESS_READWRITE) {
+        return;
+    }
+
+    quint8 *element = &data[offset + numBytesPerElement * index];
+    switch (type) {
+    case INT8:
+        writeElement<qint8>(element, qRound64(value));
+        break;
+    case INT16:
+        writeElement<qint16>(element, qRound64(value));
+        break;
+    case INT32:
+        writeElement<qint32>(element, qRound64(value));
+        break;
+    case UINT8:
+        writeElement<quint8>(element, qRound64(value));
+        break;
+    case UINT16:
+        writeElement<quint16>(element, qRound64(value));
+        break;
+    case UINT32:
+        writeElement<quint32>(element, qRound64(value));
+        break;
+    case FLOAT32:
+        writeElement<float>(element, value);
+        break;
+    default:
+        break;
+    }
 }
 
 QString UAVObjectField::getDescription()
@@ -38,6 +38,7 @@
  * Constructor
  */
 UAVObjectManager::UAVObjectManager()
+    : unpackBatchDepth(0)
 {
 }
 
@@ -135,6 +136,43 @@ bool UAVObjectManager::unRegisterObject(UAVDataObject *obj)
     return true;
 }
 
+/**
+ * @brief Start a batch of unpacks, e.g. all the packets of one log replay
+ * tick.  Until endBatchUnpack objects are unpacked without sending any
+ * signals.  Batches may be nested; only the outermost one counts.
+ */
+void UAVObjectManager::beginBatchUnpack()
+{
+    if (unpackBatchDepth++ == 0) {
+        UAVObject::unpackBatch = &unpackBatch;
+    }
+}
+
+/**
+ * @brief End a batch of unpacks.  Each object unpacked during it sends its
+ * objectUnpacked and objectUpdated signals once, with the last data it was
+ * given, then objectsUnpacked is sent with all of them.
+ */
+void UAVObjectManager::endBatchUnpack()
+{
+    Q_ASSERT(unpackBatchDepth > 0);
+    if (--unpackBatchDepth > 0) {
+        return;
+    }
+
+    UAVObject::unpackBatch = NULL;
+
+    QVector<UAVObject *> unpacked;
+    unpacked.swap(unpackBatch);
+    foreach (UAVObject *obj, unpacked) {
+        obj->emitUnpacked();
+    }
+
+    if (!unpacked.isEmpty()) {
+        emit objectsUnpacked(unpacked);
+    }
+}
+
 void UAVObjectManager::addObject(UAVObject *obj)
 {
     // Add to list
@@ -72,15 +72,25 @@ public:
     qint32 getNumInstances(const QString &name);
     qint32 getNumInstances(quint32 objId);
     bool unRegisterObject(UAVDataObject *obj);
+    void beginBatchUnpack();
+    void endBatchUnpack();
 signals:
     void newObject(UAVObject *obj);
     void newInstance(UAVObject *obj);
     void instanceRemoved(UAVObject *obj);
+    /**
+     * @brief objectsUnpacked Sent at the end of a batch with all the objects
+     * unpacked during it, after each has sent its own signals
+     * @param objects The objects, in the order they were first unpacked
+     */
+    void objectsUnpacked(QVector<UAVObject *> objects);
 
 private:
     static const quint32 MAX_INSTANCES = 1000;
     QHash<quint32, QMap<quint32, UAVObject *>> objects;
     QHash<QString, QMap<quint32, UAVObject *>> objectsByName;
+    QVector<UAVObject *> unpackBatch;
+    int unpackBatchDepth;
 
     void addObject(UAVObject *obj);
     UAVObject *getObject(const QString &name, quint32 objId, quint32 instId);
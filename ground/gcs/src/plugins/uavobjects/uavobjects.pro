@@ -11,6 +11,7 @@ HEADERS += uavobjects_global.h \
     uavobjectmanager.h \
     uavdataobject.h \
     uavobjectfield.h \
+    uavobjectschema.h \
     uavobjectsinit.h \
     uavobjectsplugin.h
 
@@ -19,6 +20,7 @@ SOURCES += uavobject.cpp \
     uavobjectmanager.cpp \
     uavdataobject.cpp \
     uavobjectfield.cpp \
+    uavobjectschema.cpp \
     uavobjectsplugin.cpp
 
 OTHER_FILES += UAVObjects.pluginspec \
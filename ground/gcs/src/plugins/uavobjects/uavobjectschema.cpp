@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectschema.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Binary schema bundles describing a set of UAVObjects
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+#include "uavobjectschema.h"
+#include <QtEndian>
+
+#define SCHEMA_MAGIC "UAVS"
+#define SCHEMA_VERSION 1
+#define SCHEMA_HEADER_SIZE 32
+#define SCHEMA_OBJECT_SIZE 16
+
+//! Prefix of the log record carrying a bundle; the rest is qCompress'ed
+static const char logRecordMagic[] = "uavoschema";
+
+UAVObjectSchema::UAVObjectSchema()
+    : numObjects(0)
+    , objectsOffset(0)
+    , stringsOffset(0)
+{
+}
+
+UAVObjectSchema UAVObjectSchema::builtIn()
+{
+    UAVObjectSchema schema;
+
+    // The data is static, so this refers to it rather than copying it
+    schema.load(QByteArray::fromRawData(reinterpret_cast<const char *>(builtInData), builtInSize));
+
+    return schema;
+}
+
+/**
+ * Use a bundle, after checking it is one this can read and its tables are
+ * within it.
+ * @return true if it was loaded
+ */
+bool UAVObjectSchema::load(const QByteArray &bundle)
+{
+    data.clear();
+    numObjects = 0;
+
+    if (bundle.size() < SCHEMA_HEADER_SIZE || !bundle.startsWith(SCHEMA_MAGIC))
+        return false;
+
+    const uchar *header = reinterpret_cast<const uchar *>(bundle.constData());
+
+    if (qFromLittleEndian<quint16>(header + 4) != SCHEMA_VERSION)
+        return false;
+
+    int count = qFromLittleEndian<quint16>(header + 6);
+    quint32 objects = qFromLittleEndian<quint32>(header + 16);
+    quint32 strings = qFromLittleEndian<quint32>(header + 28);
+
+    if (objects + (quint64)count * SCHEMA_OBJECT_SIZE > (quint64)bundle.size()
+        || strings >= (quint32)bundle.size())
+        return false;
+
+    data = bundle;
+    numObjects = count;
+    objectsOffset = objects;
+    stringsOffset = strings;
+
+    return true;
+}
+
+quint32 UAVObjectSchema::read32(int offset) const
+{
+    return qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data.constData()) + offset);
+}
+
+quint64 UAVObjectSchema::uavoHash() const
+{
+    if (!isValid())
+        return 0;
+
+    return qFromLittleEndian<quint64>(reinterpret_cast<const uchar *>(data.constData()) + 8);
+}
+
+quint32 UAVObjectSchema::objectId(int index) const
+{
+    return read32(objectsOffset + index * SCHEMA_OBJECT_SIZE);
+}
+
+QString UAVObjectSchema::objectName(int index) const
+{
+    quint32 offset = stringsOffset + read32(objectsOffset + index * SCHEMA_OBJECT_SIZE + 4);
+
+    if (offset >= (quint32)data.size())
+        return QString();
+
+    const char *str = data.constData() + offset;
+
+    return QString::fromLatin1(str, qstrnlen(str, data.size() - offset));
+}
+
+/**
+ * Find an object by id.  The objects are in order of id, so this is a
+ * binary search.
+ * @return its index, or -1 if there is none
+ */
+int UAVObjectSchema::findObject(quint32 id) const
+{
+    int low = 0;
+    int high = numObjects - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        quint32 midId = objectId(mid);
+
+        if (midId == id)
+            return mid;
+        else if (midId < id)
+            low = mid + 1;
+        else
+            high = mid - 1;
+    }
+
+    return -1;
+}
+
+/**
+ * Find an object by name.
+ * @return its index, or -1 if there is none
+ */
+int UAVObjectSchema::findObject(const QString &name) const
+{
+    for (int i = 0; i < numObjects; i++) {
+        if (objectName(i) == name)
+            return i;
+    }
+
+    return -1;
+}
+
+QByteArray UAVObjectSchema::toLogRecord(const QByteArray &bundle)
+{
+    return QByteArray(logRecordMagic) + qCompress(bundle);
+}
+
+/**
+ * @return the bundle in a log record, or an empty array if it is some
+ * other record
+ */
+QByteArray UAVObjectSchema::fromLogRecord(const QByteArray &payload)
+{
+    if (!payload.startsWith(logRecordMagic))
+        return QByteArray();
+
+    return qUncompress(payload.mid(sizeof(logRecordMagic) - 1));
+}
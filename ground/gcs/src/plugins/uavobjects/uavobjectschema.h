@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectschema.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Binary schema bundles describing a set of UAVObjects
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef UAVOBJECTSCHEMA_H
+#define UAVOBJECTSCHEMA_H
+
+#include "uavobjects_global.h"
+#include <QByteArray>
+#include <QString>
+
+/**
+ * A schema bundle, as written by uavobjgenerator: the objects, fields and
+ * enums of a set of UAVObjects in one flat blob (the layout is documented
+ * in python/dronin/uavo_schema.py).  It is read in place, without copying
+ * or parsing it first.
+ */
+class UAVOBJECTS_EXPORT UAVObjectSchema
+{
+public:
+    UAVObjectSchema();
+
+    //! The bundle of the objects this GCS is built with
+    static UAVObjectSchema builtIn();
+
+    bool load(const QByteArray &bundle);
+    bool isValid() const { return !data.isEmpty(); }
+    const QByteArray &bundle() const { return data; }
+
+    quint64 uavoHash() const;
+    int objectCount() const { return numObjects; }
+    quint32 objectId(int index) const;
+    QString objectName(int index) const;
+
+    int findObject(quint32 id) const;
+    int findObject(const QString &name) const;
+
+    //! The log record carrying a bundle, and the bundle in such a record
+    static QByteArray toLogRecord(const QByteArray &bundle);
+    static QByteArray fromLogRecord(const QByteArray &payload);
+
+private:
+    quint32 read32(int offset) const;
+
+    static const unsigned char builtInData[];
+    static const int builtInSize;
+
+    QByteArray data;
+    int numObjects;
+    quint32 objectsOffset;
+    quint32 stringsOffset;
+};
+
+#endif // UAVOBJECTSCHEMA_H
@@ -0,0 +1,37 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectschemadata.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ *
+ * @note       This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @brief      The schema bundle of the objects the GCS is built with
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+#include "uavobjectschema.h"
+
+const unsigned char UAVObjectSchema::builtInData[] = {
+$(SCHEMADATA)
+};
+
+const int UAVObjectSchema::builtInSize = sizeof(UAVObjectSchema::builtInData);
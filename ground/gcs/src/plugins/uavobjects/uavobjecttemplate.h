@@ -61,6 +61,8 @@ $(DATAFIELDS)
 #endif
     // Field information
 $(DATAFIELDINFO)
+    // Field indices, for getFieldByIndex()
+$(FIELDINDICES)
   
     // Constants
     static const quint32 OBJID = $(OBJIDHEX);
@@ -263,77 +263,70 @@ bool UAVObjectGeneratorFlight::process_object(ObjectInfo* info)
     }
     outInclude.replace(QString("$(DATAFIELDINFO)"), enums);
 
-    // Replace the $(INITFIELDS) tag
-    QString initfields;
+    // Replace the $(DEFAULTFIELDS), $(DEFAULTDATA) and $(DEFAULTINIT) tags.
+    // The defaults are a const struct which the object manager copies in
+    // with memcpy; objects whose defaults are all zero have none, since
+    // their instance data is cleared when it is allocated.
+    QString defaultfields;
+    bool nonzero = false;
     for (int n = 0; n < info->fields.length(); ++n)
     {
-        if (!info->fields[n]->defaultValues.isEmpty() )
+        FieldInfo *field = info->fields[n];
+
+        if (field->defaultValues.isEmpty())
+            continue;
+
+        QStringList values;
+        for (int idx = 0; idx < field->numElements; ++idx)
         {
-            // For non-array fields
-            if ( info->fields[n]->numElements == 1)
+            QString value;
+
+            if ( field->type == FIELDTYPE_ENUM )
             {
-                if ( info->fields[n]->type == FIELDTYPE_ENUM )
-                {
-                    int defaultVal;
-                    if (info->fields[n]->parent != NULL)
-                        defaultVal = info->fields[n]->parent->options.indexOf( info->fields[n]->defaultValues[0] );
-                    else
-                        defaultVal = info->fields[n]->options.indexOf( info->fields[n]->defaultValues[0] );
-
-                    initfields.append( QString("\tdata.%1 = %2;\r\n")
-                                .arg( info->fields[n]->name )
-                                .arg( defaultVal ) );
-                }
-                else if ( info->fields[n]->type == FIELDTYPE_FLOAT32 )
-                {
-                    initfields.append( QString("\tdata.%1 = %2;\r\n")
-                                .arg( info->fields[n]->name )
-                                .arg( info->fields[n]->defaultValues[0].toFloat() ) );
-                }
+                int defaultVal;
+                if (field->parent != NULL)
+                    defaultVal = field->parent->options.indexOf( field->defaultValues[idx] );
                 else
-                {
-                    initfields.append( QString("\tdata.%1 = %2;\r\n")
-                                .arg( info->fields[n]->name )
-                                .arg( info->fields[n]->defaultValues[0].toInt() ) );
-                }
+                    defaultVal = field->options.indexOf( field->defaultValues[idx] );
+
+                value = QString::number(defaultVal);
+            }
+            else if ( field->type == FIELDTYPE_FLOAT32 )
+            {
+                value = QString("%1").arg( field->defaultValues[idx].toFloat() );
             }
             else
             {
-                // Initialize all fields in the array
-                for (int idx = 0; idx < info->fields[n]->numElements; ++idx)
-                {
-                    if ( info->fields[n]->type == FIELDTYPE_ENUM )
-                    {
-                        int defaultVal;
-                        if (info->fields[n]->parent != NULL)
-                            defaultVal = info->fields[n]->parent->options.indexOf( info->fields[n]->defaultValues[idx] );
-                        else
-                            defaultVal = info->fields[n]->options.indexOf( info->fields[n]->defaultValues[idx] );
-                        
-                        initfields.append( QString("\tdata.%1[%2] = %3;\r\n")
-                                    .arg( info->fields[n]->name )
-                                    .arg( idx )
-                                    .arg( defaultVal ) );
-                    }
-                    else if ( info->fields[n]->type == FIELDTYPE_FLOAT32 )
-                    {
-                        initfields.append( QString("\tdata.%1[%2] = %3;\r\n")
-                                    .arg( info->fields[n]->name )
-                                    .arg( idx )
-                                    .arg( info->fields[n]->defaultValues[idx].toFloat() ) );
-                    }
-                    else
-                    {
-                        initfields.append( QString("\tdata.%1[%2] = %3;\r\n")
-                                    .arg( info->fields[n]->name )
-                                    .arg( idx )
-                                    .arg( info->fields[n]->defaultValues[idx].toInt() ) );
-                    }
-                }
+                value = QString::number( field->defaultValues[idx].toInt() );
             }
+
+            if (value != "0")
+                nonzero = true;
+
+            values.append(value);
         }
+
+        if ( field->numElements == 1 )
+            defaultfields.append( QString("\t.%1 = %2,\r\n").arg(field->name).arg(values[0]) );
+        else
+            defaultfields.append( QString("\t.%1 = { %2 },\r\n").arg(field->name).arg(values.join(", ")) );
+    }
+
+    if (nonzero)
+    {
+        outCode.replace(QString("$(DEFAULTFIELDS)"),
+                QString("// Default field values, copied in on registration and by SetDefaults\r\n"
+                        "static const %1Data defaultData = {\r\n%2};\r\n\r\n")
+                .arg(info->name).arg(defaultfields));
+        outCode.replace(QString("$(DEFAULTDATA)"), QString("&defaultData"));
+        outCode.replace(QString("$(DEFAULTINIT)"), QString("defaultData"));
+    }
+    else
+    {
+        outCode.replace(QString("$(DEFAULTFIELDS)"), QString());
+        outCode.replace(QString("$(DEFAULTDATA)"), QString("NULL"));
+        outCode.replace(QString("$(DEFAULTINIT)"), QString("{}"));
     }
-    outCode.replace(QString("$(INITFIELDS)"), initfields);
 
     // Replace the $(SETGETFIELDS) tag
     QString setgetfields;
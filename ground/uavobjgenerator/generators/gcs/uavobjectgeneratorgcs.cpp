@@ -31,6 +31,7 @@
  */
 
 #include "uavobjectgeneratorgcs.h"
+#include "../schema/uavobjectgeneratorschema.h"
 using namespace std;
 
 bool UAVObjectGeneratorGCS::generate(UAVObjectParser* parser,QString templatepath,QString outputpath) {
@@ -49,8 +50,9 @@ bool UAVObjectGeneratorGCS::generate(UAVObjectParser* parser,QString templatepat
     gcsIncludeTemplate = readFile( gcsCodePath.absoluteFilePath("uavobjecttemplate.h") );
     QString gcsInitTemplate = readFile( gcsCodePath.absoluteFilePath("uavobjectsinittemplate.cpp") );
     QString gcsVersionTemplate = readFile( gcsCodePath.absoluteFilePath("uavogcsversiontemplate.h") );
+    QString gcsSchemaTemplate = readFile( gcsCodePath.absoluteFilePath("uavobjectschematemplate.cpp") );
 
-    if (gcsCodeTemplate.isEmpty() || gcsIncludeTemplate.isEmpty() || gcsInitTemplate.isEmpty() || gcsVersionTemplate.isEmpty()) {
+    if (gcsCodeTemplate.isEmpty() || gcsIncludeTemplate.isEmpty() || gcsInitTemplate.isEmpty() || gcsVersionTemplate.isEmpty() || gcsSchemaTemplate.isEmpty()) {
         std::cerr << "Problem reading gcs code templates" << endl;
         return false;
     }
@@ -84,6 +86,21 @@ bool UAVObjectGeneratorGCS::generate(UAVObjectParser* parser,QString templatepat
         return false;
     }
 
+    // Embed the schema bundle, so logs can carry it
+    QByteArray schema = UAVObjectGeneratorSchema::bundle(parser);
+    QString schemaData;
+    for (int n = 0; n < schema.size(); ++n) {
+        schemaData.append(QString("0x%1,").arg((quint8) schema[n], 2, 16, QChar('0')));
+        schemaData.append((n % 16 == 15) ? "\n" : " ");
+    }
+
+    gcsSchemaTemplate.replace( QString("$(SCHEMADATA)"), schemaData);
+    res = writeFileIfDiffrent( gcsOutputPath.absolutePath() + "/uavobjectschemadata.cpp", gcsSchemaTemplate );
+    if (!res) {
+        cout << "Error: Could not write output files" << endl;
+        return false;
+    }
+
     return true; // if we come here everything should be fine
 }
 
@@ -427,6 +444,18 @@ bool UAVObjectGeneratorGCS::process_object(ObjectInfo* info)
         }
     }
     outInclude.replace(QString("$(DATAFIELDINFO)"), enums);
+
+    // Replace the $(FIELDINDICES) tag, the fields' positions in getFields()
+    QString fieldIndices = "    typedef enum { ";
+    for (int n = 0; n < info->fields.length(); ++n) {
+        QString s = (n != (info->fields.length()-1)) ? "FIELD_%1=%2, " : "FIELD_%1=%2";
+        fieldIndices.append( s.arg( info->fields[n]->name.toUpper() )
+                             .arg(n) );
+    }
+    fieldIndices.append(" } FieldIndex;\n");
+    fieldIndices.append( QString("    static const quint32 NUMFIELDS = %1;\n")
+                         .arg(info->fields.length()) );
+    outInclude.replace(QString("$(FIELDINDICES)"), fieldIndices);
     outInclude.replace(QString("$(ENUMS)"),q_enums);
     // Replace the $(INITFIELDS) tag
     QString initfields;
@@ -76,3 +76,22 @@ bool writeFileIfDiffrent(QString name, QString& str)
         return true;
     return writeFile(name,str);
 }
+
+/**
+ * Write binary contents to file if the content changes
+ */
+bool writeFileIfDiffrent(QString name, const QByteArray& data)
+{
+    QFile file(name);
+    if (file.open(QFile::ReadOnly)) {
+        if (file.readAll() == data)
+            return true;
+        file.close();
+    }
+
+    if (!file.open(QFile::WriteOnly))
+        return false;
+    bool res = (file.write(data) == data.size());
+    file.close();
+    return res;
+}
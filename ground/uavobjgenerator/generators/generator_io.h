@@ -37,5 +37,6 @@ QString readFile(QString name);
 QString readFile(QString name);
 bool writeFile(QString name, QString& str);
 bool writeFileIfDiffrent(QString name, QString& str);
+bool writeFileIfDiffrent(QString name, const QByteArray& data);
 
 #endif
@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectgeneratorschema.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @brief      produce a binary schema bundle describing the uavobjects
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "uavobjectgeneratorschema.h"
+
+#include <QDataStream>
+#include <QHash>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+#define SCHEMA_VERSION 1
+#define SCHEMA_HEADER_SIZE 32
+#define SCHEMA_OBJECT_SIZE 16
+#define SCHEMA_FIELD_SIZE 24
+
+#define SCHEMA_OBJ_SINGLE_INST 1
+#define SCHEMA_OBJ_SETTINGS 2
+
+#define SCHEMA_NO_LIST 0xFFFFFFFF
+
+namespace {
+
+/* Strings, each kept once, in the order they are first used */
+class StringTable
+{
+public:
+    StringTable() : data(1, '\0') { }
+
+    quint32 add(const QString& str) {
+        QByteArray bytes = str.toLatin1();
+
+        if (bytes.isEmpty())
+            return 0;
+
+        QHash<QByteArray, quint32>::const_iterator it = offsets.constFind(bytes);
+        if (it != offsets.constEnd())
+            return it.value();
+
+        quint32 offset = data.size();
+        offsets.insert(bytes, offset);
+        data.append(bytes).append('\0');
+
+        return offset;
+    }
+
+    QByteArray data;
+
+private:
+    QHash<QByteArray, quint32> offsets;
+};
+
+/* The default of each element, as the raw 32 bits of its value */
+quint32 defaultValue(UAVObjectParser* parser, FieldInfo* field, int element)
+{
+    if (element >= field->defaultValues.length())
+        return 0;
+
+    const QString& str = field->defaultValues[element];
+
+    switch (field->type) {
+    case FIELDTYPE_FLOAT32: {
+        float value = str.toFloat();
+        quint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+    case FIELDTYPE_ENUM:
+        return parser->findOptionIndex(field, field->options.indexOf(str));
+    case FIELDTYPE_INT8:
+    case FIELDTYPE_INT16:
+    case FIELDTYPE_INT32:
+        return (quint32) str.toInt();
+    default:
+        return str.toUInt();
+    }
+}
+
+}
+
+bool UAVObjectGeneratorSchema::generate(UAVObjectParser* parser,QString templatepath,QString outputpath) {
+    Q_UNUSED(templatepath);
+
+    QDir schemaOutputPath = QDir( outputpath + QString("schema") );
+    schemaOutputPath.mkpath(schemaOutputPath.absolutePath());
+
+    bool res = writeFileIfDiffrent( schemaOutputPath.absolutePath() + "/uavos.bin", bundle(parser) );
+    if (!res) {
+        cout << "Error: Could not write output files" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Lay out the bundle.  The objects go in order of id, so a reader can
+ * search for one; each object's fields follow on from the last's.
+ */
+QByteArray UAVObjectGeneratorSchema::bundle(UAVObjectParser* parser)
+{
+    QList<ObjectInfo*> objects = parser->getObjectInfo();
+    std::sort(objects.begin(), objects.end(), [](ObjectInfo *o1, ObjectInfo *o2) {
+            return o1->id < o2->id;
+            });
+
+    StringTable strings;
+    QList<quint32> lists;
+
+    QByteArray objectTable, fieldTable;
+    QDataStream objectOut(&objectTable, QIODevice::WriteOnly);
+    QDataStream fieldOut(&fieldTable, QIODevice::WriteOnly);
+    objectOut.setByteOrder(QDataStream::LittleEndian);
+    fieldOut.setByteOrder(QDataStream::LittleEndian);
+
+    int numFields = 0;
+
+    foreach (ObjectInfo *info, objects) {
+        quint8 flags = 0;
+        if (info->isSingleInst)
+            flags |= SCHEMA_OBJ_SINGLE_INST;
+        if (info->isSettings)
+            flags |= SCHEMA_OBJ_SETTINGS;
+
+        objectOut << (quint32) info->id << strings.add(info->name)
+                  << (quint16) numFields << (quint16) info->fields.length()
+                  << (quint16) info->numBytes << flags << (quint8) 0;
+
+        foreach (FieldInfo *field, info->fields) {
+            quint32 name = strings.add(field->name);
+            quint32 units = strings.add(field->units);
+
+            quint32 elementNames = SCHEMA_NO_LIST;
+            if (!field->defaultElementNames) {
+                elementNames = lists.length();
+                foreach (const QString& elementName, field->elementNames)
+                    lists << strings.add(elementName);
+            }
+
+            quint32 options = SCHEMA_NO_LIST;
+            quint8 numOptions = 0;
+            if (field->type == FIELDTYPE_ENUM) {
+                options = lists.length();
+                numOptions = field->options.length();
+                for (int n = 0; n < field->options.length(); ++n)
+                    lists << strings.add(field->options[n])
+                          << (quint32) parser->findOptionIndex(field, n);
+            }
+
+            quint32 defaults = lists.length();
+            for (int n = 0; n < field->numElements; ++n)
+                lists << defaultValue(parser, field, n);
+
+            fieldOut << name << units << (quint8) field->type << numOptions
+                     << (quint16) field->numElements << elementNames
+                     << options << defaults;
+        }
+
+        numFields += info->fields.length();
+    }
+
+    quint32 objectsOffset = SCHEMA_HEADER_SIZE;
+    quint32 fieldsOffset = objectsOffset + SCHEMA_OBJECT_SIZE * objects.length();
+    quint32 listsOffset = fieldsOffset + SCHEMA_FIELD_SIZE * numFields;
+    quint32 stringsOffset = listsOffset + 4 * lists.length();
+
+    QByteArray out;
+    QDataStream stream(&out, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream.writeRawData("UAVS", 4);
+    stream << (quint16) SCHEMA_VERSION << (quint16) objects.length()
+           << (quint64) parser->getUavoHash()
+           << objectsOffset << fieldsOffset << listsOffset << stringsOffset;
+
+    stream.writeRawData(objectTable.constData(), objectTable.size());
+    stream.writeRawData(fieldTable.constData(), fieldTable.size());
+
+    foreach (quint32 entry, lists)
+        stream << entry;
+
+    stream.writeRawData(strings.data.constData(), strings.data.size());
+
+    while (out.size() % 4)
+        stream << (quint8) 0;
+
+    return out;
+}
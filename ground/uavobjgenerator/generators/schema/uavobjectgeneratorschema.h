@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectgeneratorschema.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2017
+ * @brief      produce a binary schema bundle describing the uavobjects
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef UAVOBJECTGENERATORSCHEMA_H
+#define UAVOBJECTGENERATORSCHEMA_H
+
+#include "../generator_common.h"
+
+/**
+ * Writes schema/uavos.bin, a flat description of all the objects which
+ * tools can use without the XML.  The layout is documented in
+ * python/dronin/uavo_schema.py, which reads and writes the same bytes.
+ */
+class UAVObjectGeneratorSchema
+{
+public:
+    bool generate(UAVObjectParser* parser,QString templatepath,QString outputpath);
+
+    static QByteArray bundle(UAVObjectParser* parser);
+};
+
+#endif
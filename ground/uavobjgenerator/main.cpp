@@ -34,6 +34,7 @@
 #include "generators/gcs/uavobjectgeneratorgcs.h"
 #include "generators/matlab/uavobjectgeneratormatlab.h"
 #include "generators/wireshark/uavobjectgeneratorwireshark.h"
+#include "generators/schema/uavobjectgeneratorschema.h"
 
 #define RETURN_ERR_USAGE 1
 #define RETURN_ERR_XML 2
@@ -46,13 +47,14 @@ using namespace std;
  * print usage info
  */
 void usage() {
-    cout << "Usage: uavobjectgenerator [-gcs] [-flight] [-java] [-matlab] [-wireshark] [-none] [-v] xml_path template_base [UAVObj1] ... [UAVObjN]" << endl;
+    cout << "Usage: uavobjectgenerator [-gcs] [-flight] [-java] [-matlab] [-wireshark] [-schema] [-none] [-v] xml_path template_base [UAVObj1] ... [UAVObjN]" << endl;
     cout << "Languages: "<< endl;
     cout << "\t-gcs           build groundstation code" << endl;
     cout << "\t-flight        build flight code" << endl;
     cout << "\t-java          build java code" << endl;
     cout << "\t-matlab        build matlab code" << endl;
     cout << "\t-wireshark     build wireshark plugin" << endl;
+    cout << "\t-schema        build binary schema bundle" << endl;
     cout << "\tIf no language is specified ( and not -none ) -> all are built." << endl;
     cout << "Misc: "<< endl;
     cout << "\t-none          build no language - just parse xml's" << endl;
@@ -103,9 +105,10 @@ int main(int argc, char *argv[])
     bool do_java=(arguments_stringlist.removeAll("-java")>0);
     bool do_matlab=(arguments_stringlist.removeAll("-matlab")>0);
     bool do_wireshark=(arguments_stringlist.removeAll("-wireshark")>0);
+    bool do_schema=(arguments_stringlist.removeAll("-schema")>0);
     bool do_none=(arguments_stringlist.removeAll("-none")>0); //
 
-    bool do_all=((do_gcs||do_flight||do_java||do_matlab)==false);
+    bool do_all=((do_gcs||do_flight||do_java||do_matlab||do_schema)==false);
     bool do_allObjects=true;
 
     if (arguments_stringlist.length() >= 2) {
@@ -258,6 +261,13 @@ int main(int argc, char *argv[])
         wiresharkgen.generate(parser,templatepath,outputpath);
     }
 
+    // generate schema bundle if wanted
+    if (do_schema|do_all) {
+        cout << "generating schema bundle" << endl ;
+        UAVObjectGeneratorSchema schemagen;
+        schemagen.generate(parser,templatepath,outputpath);
+    }
+
     bool changed = false;
 
     /* Symlink each of these to the current dir */
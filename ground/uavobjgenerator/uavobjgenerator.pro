@@ -29,6 +29,7 @@ SOURCES += main.cpp \
     generators/gcs/uavobjectgeneratorgcs.cpp \
     generators/matlab/uavobjectgeneratormatlab.cpp \
     generators/wireshark/uavobjectgeneratorwireshark.cpp \
+    generators/schema/uavobjectgeneratorschema.cpp \
     generators/generator_common.cpp
 HEADERS += uavobjectparser.h \
     generators/generator_io.h \
@@ -36,4 +37,5 @@ HEADERS += uavobjectparser.h \
     generators/gcs/uavobjectgeneratorgcs.h \
     generators/matlab/uavobjectgeneratormatlab.h \
     generators/wireshark/uavobjectgeneratorwireshark.h \
+    generators/schema/uavobjectgeneratorschema.h \
     generators/generator_common.h
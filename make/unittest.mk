@@ -76,17 +76,27 @@ $(eval $(call LINK_CXX_TEMPLATE,$(OUTDIR)/$(TARGET).elf,$(ALLOBJ) $(OUTDIR)/gtes
 .PHONY: elf
 elf: $(OUTDIR)/$(TARGET).elf
 
+# Tests named Benchmark only report timings; they are left out of the normal
+# runs and run on their own by bench
+UT_TEST_FILTER := --gtest_filter=-*.Benchmark
+UT_BENCH_FILTER := --gtest_filter=*.Benchmark
+
 .PHONY: xml
 xml: $(OUTDIR)/$(TARGET).xml
 
 $(OUTDIR)/$(TARGET).xml: $(OUTDIR)/$(TARGET).elf
 	$(V0) @echo " TEST XML  $(MSG_EXTRA)  $(call toprel, $@)"
-	$(V1) $< --gtest_output=xml:$(OUTDIR)/$(TARGET).xml > /dev/null
+	$(V1) $< $(UT_TEST_FILTER) --gtest_output=xml:$(OUTDIR)/$(TARGET).xml > /dev/null
 
 .PHONY: run
 run: $(OUTDIR)/$(TARGET).elf
 	$(V0) @echo " TEST RUN  $(MSG_EXTRA)  $(call toprel, $<)"
-	$(V1) $<
+	$(V1) $< $(UT_TEST_FILTER)
+
+.PHONY: bench
+bench: $(OUTDIR)/$(TARGET).elf
+	$(V0) @echo " TEST BENCH $(MSG_EXTRA)  $(call toprel, $<)"
+	$(V1) $< $(UT_BENCH_FILTER)
 
 GCOV_INPUT_FILES := $(notdir $(SRC))
 $(foreach src,$(GCOV_INPUT_FILES),$(eval $(call GCOV_TEMPLATE,$(src))))
@@ -7,4 +7,5 @@ from . import logfs
 from . import telemetry
 from . import uavo
 from . import uavo_collection
+from . import uavo_schema
 from . import uavtalk
@@ -0,0 +1,584 @@
+/**
+ ******************************************************************************
+ * @file       _uavtalkmodule.c
+ * @author     dRonin, http://dronin.org, Copyright (C) 2017
+ * @brief      Bulk UAVTalk log parsing into numpy arrays
+ *
+ * Parses a whole log of UAVTalk packets in two passes: one counts the
+ * packets of each object, and once arrays of the right size exist the
+ * other copies each packet's time, instance, sequence number and data
+ * into them.  The packets are accepted and rejected as process_stream in
+ * uavtalk.py does, and times are worked out the same way.
+ *
+ * A log can also be taken a piece at a time: scan only counts, and both
+ * take and give back the timestamp state, so a piece can be parsed as if
+ * what came before it had been.
+ *
+ * Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+ *****************************************************************************/
+
+#include <Python.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include "numpy/arrayobject.h"
+
+#define SYNC_VAL 0x3C
+#define TYPE_MASK 0x78
+#define TYPE_VER 0x20
+
+#define TYPE_OBJ_REQ 0x01
+#define TYPE_ACK 0x03
+#define TYPE_NACK 0x04
+#define TYPE_OBJ_TS 0x80
+#define TYPE_OBJ_ACK_TS 0x82
+
+#define HEADER_LENGTH 8
+#define MAX_HEADER_LENGTH 12
+#define MAX_PAYLOAD_LENGTH (256 - MAX_HEADER_LENGTH)
+
+//! Size of the [u32 time][u64 size] frame the GCS puts round each packet
+#define GCS_RECORD_HEADER 12
+
+//! Records any bigger than this are taken as being out of sync, as the GCS does
+#define GCS_RECORD_MAX 0xFFFF
+
+struct object {
+	uint32_t id;
+	uint16_t size;
+	bool single;
+	bool wanted;
+
+	npy_intp count;
+	double first_time;
+	double last_time;
+
+	/* Filled in on the second pass */
+	npy_intp filled;
+	PyArrayObject *times;
+	PyArrayObject *inst;
+	PyArrayObject *seq;
+	PyArrayObject *data;
+};
+
+struct parser {
+	const uint8_t *buf;
+	Py_ssize_t len;
+	bool gcs_timestamps;
+
+	struct object *objects;
+	int num_objects;
+
+	uint32_t last_timestamp;
+	uint32_t timestamp_base;
+	npy_int64 received;
+
+	/* As they were before the start of buf */
+	uint32_t start_timestamp;
+	uint32_t start_base;
+};
+
+enum packet_result {
+	PACKET_OK,
+	PACKET_BAD,
+	PACKET_SHORT,
+};
+
+static uint8_t crc_table[256];
+
+static void crc_init(void)
+{
+	for (int i = 0; i < 256; i++) {
+		uint8_t crc = i;
+
+		for (int j = 0; j < 8; j++)
+			crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+
+		crc_table[i] = crc;
+	}
+}
+
+static uint8_t crc_update(const uint8_t *data, Py_ssize_t len)
+{
+	uint8_t crc = 0;
+
+	while (len--)
+		crc = crc_table[crc ^ *data++];
+
+	return crc;
+}
+
+static inline uint16_t rd16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t rd32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static inline uint64_t rd64(const uint8_t *p)
+{
+	return rd32(p) | ((uint64_t) rd32(p + 4) << 32);
+}
+
+static struct object *find_object(struct parser *ps, uint32_t id)
+{
+	int low = 0, high = ps->num_objects - 1;
+
+	while (low <= high) {
+		int mid = (low + high) / 2;
+
+		if (ps->objects[mid].id == id)
+			return &ps->objects[mid];
+		else if (ps->objects[mid].id < id)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+
+	return NULL;
+}
+
+/**
+ * Check a packet and, if it is an object's data, count it or store it.
+ * @param[in] p the packet, starting with its sync byte
+ * @param[in] avail bytes available from p
+ * @param[in] gcs_time the time the GCS logged it at
+ * @param[in] fill false to count, true to store
+ * @param[out] consumed the packet's length, if it was good
+ */
+static enum packet_result parse_packet(struct parser *ps, const uint8_t *p,
+		Py_ssize_t avail, uint32_t gcs_time, bool fill, Py_ssize_t *consumed)
+{
+	if (avail < HEADER_LENGTH)
+		return PACKET_SHORT;
+
+	if (p[0] != SYNC_VAL)
+		return PACKET_BAD;
+
+	uint8_t type = p[1];
+	uint16_t length = rd16(p + 2);
+	uint32_t id = rd32(p + 4);
+
+	if ((type & TYPE_MASK) != TYPE_VER)
+		return PACKET_BAD;
+
+	type &= ~TYPE_MASK;
+
+	if (length < HEADER_LENGTH || length > MAX_HEADER_LENGTH + MAX_PAYLOAD_LENGTH)
+		return PACKET_BAD;
+
+	struct object *obj = find_object(ps, id);
+	int timestamp_len, obj_len;
+
+	if (type == TYPE_OBJ_REQ || type == TYPE_ACK || type == TYPE_NACK) {
+		timestamp_len = 0;
+		obj_len = 0;
+	} else if (obj) {
+		timestamp_len = (type == TYPE_OBJ_TS || type == TYPE_OBJ_ACK_TS) ? 2 : 0;
+		obj_len = obj->size;
+	} else {
+		/* Unknown; skip it whole */
+		timestamp_len = 0;
+		obj_len = length - HEADER_LENGTH;
+	}
+
+	int instance_len = (obj && !obj->single) ? 2 : 0;
+
+	if (obj_len >= MAX_PAYLOAD_LENGTH)
+		return PACKET_BAD;
+
+	int calc_size = HEADER_LENGTH + instance_len + timestamp_len + obj_len;
+
+	if (calc_size != length)
+		return PACKET_BAD;
+
+	if (avail < calc_size + 1)
+		return PACKET_SHORT;
+
+	if (crc_update(p, calc_size) != p[calc_size])
+		return PACKET_BAD;
+
+	*consumed = calc_size + 1;
+
+	/* Times go as in process_stream: an untimestamped packet gets the
+	 * last timestamp as sent */
+	uint32_t timestamp = ps->last_timestamp;
+
+	if (timestamp_len) {
+		uint16_t sent = rd16(p + HEADER_LENGTH + instance_len);
+
+		if (sent < ps->last_timestamp)
+			ps->timestamp_base += 65536;
+
+		ps->last_timestamp = sent;
+		timestamp = sent + ps->timestamp_base;
+	}
+
+	if (ps->gcs_timestamps)
+		timestamp = gcs_time;
+
+	if (!obj || !obj_len || !obj->wanted)
+		return PACKET_OK;
+
+	if (fill) {
+		npy_intp i = obj->filled++;
+
+		*(double *) PyArray_GETPTR1(obj->times, i) = timestamp;
+		*(npy_int64 *) PyArray_GETPTR1(obj->seq, i) = ps->received;
+		*(uint16_t *) PyArray_GETPTR1(obj->inst, i) =
+			instance_len ? rd16(p + HEADER_LENGTH) : 0;
+
+		memcpy(PyArray_GETPTR2(obj->data, i, 0),
+				p + HEADER_LENGTH + instance_len + timestamp_len, obj_len);
+	} else {
+		if (!obj->count || timestamp < obj->first_time)
+			obj->first_time = timestamp;
+		if (!obj->count || timestamp > obj->last_time)
+			obj->last_time = timestamp;
+
+		obj->count++;
+	}
+
+	ps->received++;
+
+	return PACKET_OK;
+}
+
+/**
+ * Walk the log.
+ * @return how much of it was parsed; the rest is an incomplete packet
+ */
+static Py_ssize_t walk(struct parser *ps, bool fill)
+{
+	Py_ssize_t pos = 0;
+
+	ps->last_timestamp = ps->start_timestamp;
+	ps->timestamp_base = ps->start_base;
+	ps->received = 0;
+
+	while (pos < ps->len) {
+		Py_ssize_t consumed;
+
+		if (ps->gcs_timestamps) {
+			if (ps->len - pos < GCS_RECORD_HEADER)
+				break;
+
+			uint32_t gcs_time = rd32(ps->buf + pos);
+			uint64_t record_len = rd64(ps->buf + pos + 4);
+
+			if (record_len > GCS_RECORD_MAX) {
+				pos++;
+				continue;
+			}
+
+			if ((uint64_t) (ps->len - pos - GCS_RECORD_HEADER) < record_len)
+				break;
+
+			/* Each record holds a packet; anything else in one, such
+			 * as the UAVO schema record, is skipped */
+			parse_packet(ps, ps->buf + pos + GCS_RECORD_HEADER,
+					record_len, gcs_time, fill, &consumed);
+
+			pos += GCS_RECORD_HEADER + record_len;
+		} else {
+			enum packet_result res = parse_packet(ps, ps->buf + pos,
+					ps->len - pos, 0, fill, &consumed);
+
+			if (res == PACKET_SHORT)
+				break;
+
+			pos += (res == PACKET_OK) ? consumed : 1;
+		}
+	}
+
+	return pos;
+}
+
+static void free_arrays(struct parser *ps)
+{
+	for (int i = 0; i < ps->num_objects; i++) {
+		Py_XDECREF(ps->objects[i].times);
+		Py_XDECREF(ps->objects[i].inst);
+		Py_XDECREF(ps->objects[i].seq);
+		Py_XDECREF(ps->objects[i].data);
+	}
+}
+
+static int compare_objects(const void *a, const void *b)
+{
+	uint32_t id_a = ((const struct object *) a)->id;
+	uint32_t id_b = ((const struct object *) b)->id;
+
+	return (id_a > id_b) - (id_a < id_b);
+}
+
+static PyObject *build_result(struct parser *ps)
+{
+	PyObject *result = PyDict_New();
+
+	if (!result)
+		return NULL;
+
+	for (int i = 0; i < ps->num_objects; i++) {
+		struct object *obj = &ps->objects[i];
+
+		if (!obj->count)
+			continue;
+
+		PyObject *key = PyLong_FromUnsignedLong(obj->id);
+		PyObject *value = Py_BuildValue("(OOOO)", obj->times, obj->inst,
+				obj->seq, obj->data);
+
+		if (!key || !value || PyDict_SetItem(result, key, value)) {
+			Py_XDECREF(key);
+			Py_XDECREF(value);
+			Py_DECREF(result);
+			return NULL;
+		}
+
+		Py_DECREF(key);
+		Py_DECREF(value);
+	}
+
+	return result;
+}
+
+/**
+ * Set a parser up from the arguments scan and parse take: the log, the
+ * objects as (id, size, single instance[, wanted]), whether the log has
+ * GCS timestamps and optionally the timestamp state to start with.
+ * @return false, with an exception set, if they are bad
+ */
+static bool init_parser(struct parser *ps, PyObject *args, Py_buffer *buf)
+{
+	PyObject *objects, *state = Py_None;
+	int gcs_timestamps;
+
+	memset(ps, 0, sizeof(*ps));
+
+	if (!PyArg_ParseTuple(args, "s*Oi|O", buf, &objects, &gcs_timestamps, &state))
+		return false;
+
+	if (state != Py_None && !PyArg_ParseTuple(state, "II",
+				&ps->start_timestamp, &ps->start_base)) {
+		PyBuffer_Release(buf);
+		return false;
+	}
+
+	PyObject *seq = PySequence_Fast(objects, "objects must be a sequence");
+
+	if (!seq) {
+		PyBuffer_Release(buf);
+		return false;
+	}
+
+	ps->buf = buf->buf;
+	ps->len = buf->len;
+	ps->gcs_timestamps = gcs_timestamps;
+	ps->num_objects = PySequence_Fast_GET_SIZE(seq);
+	ps->objects = calloc(ps->num_objects ? ps->num_objects : 1, sizeof(*ps->objects));
+
+	if (!ps->objects) {
+		PyErr_NoMemory();
+		goto fail;
+	}
+
+	for (int i = 0; i < ps->num_objects; i++) {
+		unsigned long id;
+		unsigned int size;
+		int single, wanted = 1;
+
+		if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i), "kIi|i",
+					&id, &size, &single, &wanted))
+			goto fail;
+
+		if (size >= MAX_PAYLOAD_LENGTH) {
+			PyErr_Format(PyExc_ValueError, "object %08lx is too big", id);
+			goto fail;
+		}
+
+		ps->objects[i].id = id;
+		ps->objects[i].size = size;
+		ps->objects[i].single = single;
+		ps->objects[i].wanted = wanted;
+	}
+
+	qsort(ps->objects, ps->num_objects, sizeof(*ps->objects), compare_objects);
+
+	Py_DECREF(seq);
+
+	return true;
+
+fail:
+	free(ps->objects);
+	ps->objects = NULL;
+
+	Py_DECREF(seq);
+	PyBuffer_Release(buf);
+
+	return false;
+}
+
+static void release_parser(struct parser *ps, Py_buffer *buf)
+{
+	free_arrays(ps);
+	free(ps->objects);
+
+	PyBuffer_Release(buf);
+}
+
+static PyObject *scan(PyObject *self, PyObject *args)
+{
+	struct parser ps;
+	Py_buffer buf;
+
+	(void) self;
+
+	if (!init_parser(&ps, args, &buf))
+		return NULL;
+
+	Py_ssize_t parsed;
+
+	Py_BEGIN_ALLOW_THREADS
+	parsed = walk(&ps, false);
+	Py_END_ALLOW_THREADS
+
+	PyObject *counts = PyDict_New();
+	PyObject *result = NULL;
+
+	if (!counts)
+		goto out;
+
+	for (int i = 0; i < ps.num_objects; i++) {
+		struct object *obj = &ps.objects[i];
+
+		if (!obj->count)
+			continue;
+
+		PyObject *key = PyLong_FromUnsignedLong(obj->id);
+		PyObject *value = Py_BuildValue("(ndd)", (Py_ssize_t) obj->count,
+				obj->first_time, obj->last_time);
+
+		if (!key || !value || PyDict_SetItem(counts, key, value)) {
+			Py_XDECREF(key);
+			Py_XDECREF(value);
+			Py_DECREF(counts);
+			goto out;
+		}
+
+		Py_DECREF(key);
+		Py_DECREF(value);
+	}
+
+	result = Py_BuildValue("(Nn(II))", counts, parsed,
+			ps.last_timestamp, ps.timestamp_base);
+
+out:
+	release_parser(&ps, &buf);
+
+	return result;
+}
+
+static PyObject *parse(PyObject *self, PyObject *args)
+{
+	struct parser ps;
+	Py_buffer buf;
+
+	(void) self;
+
+	if (!init_parser(&ps, args, &buf))
+		return NULL;
+
+	PyObject *result = NULL;
+	Py_ssize_t parsed;
+
+	Py_BEGIN_ALLOW_THREADS
+	walk(&ps, false);
+	Py_END_ALLOW_THREADS
+
+	for (int i = 0; i < ps.num_objects; i++) {
+		struct object *obj = &ps.objects[i];
+
+		if (!obj->count)
+			continue;
+
+		npy_intp dims[2] = { obj->count, obj->size };
+
+		obj->times = (PyArrayObject *) PyArray_SimpleNew(1, dims, NPY_DOUBLE);
+		obj->inst = (PyArrayObject *) PyArray_SimpleNew(1, dims, NPY_UINT16);
+		obj->seq = (PyArrayObject *) PyArray_SimpleNew(1, dims, NPY_INT64);
+		obj->data = (PyArrayObject *) PyArray_SimpleNew(2, dims, NPY_UINT8);
+
+		if (!obj->times || !obj->inst || !obj->seq || !obj->data)
+			goto out;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	parsed = walk(&ps, true);
+	Py_END_ALLOW_THREADS
+
+	PyObject *arrays = build_result(&ps);
+
+	if (arrays) {
+		result = Py_BuildValue("(Nn)", arrays, parsed);
+	}
+
+out:
+	release_parser(&ps, &buf);
+
+	return result;
+}
+
+static PyMethodDef UAVTalkMethods[] =
+{
+	{"parse", parse, METH_VARARGS,
+		"parse(data, objects, gcs_timestamps[, state]) -> ({id: (times, inst, seq, data)}, parsed)\n\n"
+		"Parse a log of UAVTalk packets.  objects is a sequence of (id, size,\n"
+		"single instance[, wanted]) of the objects in it; only those wanted,\n"
+		"as all are by default, are kept.  For each object seen, times holds\n"
+		"the time of each packet in ms, inst its instance, seq its place among\n"
+		"all the packets kept and data its data as sent.  parsed is how many\n"
+		"bytes were parsed; any after are an incomplete packet.  state is the\n"
+		"timestamp state scan gave for the log before data."},
+	{"scan", scan, METH_VARARGS,
+		"scan(data, objects, gcs_timestamps[, state]) -> ({id: (count, first, last)}, parsed, state)\n\n"
+		"Count the packets of each object in a log, as parse would keep them,\n"
+		"without copying them.  first and last are the earliest and latest of\n"
+		"their times.  state is the timestamp state at the end of what was\n"
+		"parsed, to pass on when parsing or scanning what follows."},
+	{NULL, NULL, 0, NULL}
+};
+
+#if PY_MAJOR_VERSION >= 3
+static struct PyModuleDef uavtalkmodule = {
+	PyModuleDef_HEAD_INIT,
+	"_uavtalk",
+	"Bulk UAVTalk log parsing",
+	-1,
+	UAVTalkMethods,
+	NULL, NULL, NULL, NULL
+};
+
+PyMODINIT_FUNC
+PyInit__uavtalk(void)
+{
+	import_array();
+	crc_init();
+
+	return PyModule_Create(&uavtalkmodule);
+}
+#else
+PyMODINIT_FUNC
+init_uavtalk(void)
+{
+	(void) Py_InitModule("_uavtalk", UAVTalkMethods);
+	import_array();
+	crc_init();
+}
+#endif
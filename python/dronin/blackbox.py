@@ -0,0 +1,144 @@
+"""
+Decoder for the full rate blackbox stream carried in BlackboxData objects.
+
+The frame format is described in flight/Libraries/inc/blackbox.h.
+
+Copyright (C) 2017 dRonin, http://dronin.org
+Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+"""
+
+from collections import namedtuple
+
+FRAME_KEY = ord('K')
+FRAME_DELTA = ord('D')
+
+RATE_SCALE = 16.0
+ACCEL_SCALE = 256.0
+PID_SCALE = 4096.0
+
+AXES = ('roll', 'pitch', 'yaw')
+
+GROUPS = (
+    ('gyro', RATE_SCALE),
+    ('accel', ACCEL_SCALE),
+    ('setpoint', RATE_SCALE),
+    ('p', PID_SCALE),
+    ('i', PID_SCALE),
+    ('d', PID_SCALE),
+    ('output', PID_SCALE),
+)
+
+FIELDS = tuple('%s_%s' % (g, a) for (g, _) in GROUPS for a in AXES)
+
+SCALES = tuple(s for (_, s) in GROUPS for a in AXES)
+
+BlackboxSample = namedtuple('BlackboxSample', ('time',) + FIELDS)
+
+def _uvarint(data, pos):
+    value = 0
+    shift = 0
+
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7f) << shift
+        shift += 7
+
+        if not (b & 0x80):
+            return value, pos
+
+def _unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+class BlackboxDecoder(object):
+    """ Turns a sequence of BlackboxData objects back into samples.
+
+    Missing chunks, whether dropped on the flight side or lost from the log,
+    are skipped over: decoding resumes at the next key frame. """
+
+    def __init__(self):
+        self.synced = False
+        self.sequence = None
+        self.time_us = 0
+        self.last = [0] * len(FIELDS)
+        self.lost_chunks = 0
+        self.skipped_frames = 0
+
+    def _lost(self):
+        self.synced = False
+
+    def feed(self, obj):
+        """ Decode one BlackboxData object, returning a list of samples """
+        seq = obj.Sequence
+
+        if seq == 0:
+            # A new recording
+            self._lost()
+        elif self.sequence is not None and seq != ((self.sequence + 1) & 0xffff):
+            self.lost_chunks += (seq - self.sequence - 1) & 0xffff
+            self._lost()
+
+        self.sequence = seq
+
+        return self.decode(bytearray(obj.Data[:obj.Length]))
+
+    def decode(self, data):
+        """ Decode a buffer of whole frames, returning a list of samples """
+        samples = []
+        pos = 0
+
+        while pos < len(data):
+            end = pos + 1 + data[pos]
+
+            if end > len(data) or end - pos < 3:
+                # Not a frame, give up on the rest of this buffer
+                self._lost()
+                break
+
+            kind = data[pos + 1]
+            key = kind == FRAME_KEY
+
+            if not key and (kind != FRAME_DELTA or not self.synced):
+                self.skipped_frames += 1
+                pos = end
+                continue
+
+            try:
+                t, p = _uvarint(data, pos + 2)
+                values = []
+
+                for last in self.last:
+                    d, p = _uvarint(data, p)
+                    d = _unzigzag(d)
+                    values.append(d if key else last + d)
+            except IndexError:
+                p = -1
+
+            if p != end:
+                self._lost()
+                self.skipped_frames += 1
+                pos = end
+                continue
+
+            self.time_us = t if key else (self.time_us + t) & 0xffffffff
+            self.last = values
+            self.synced = True
+
+            samples.append(BlackboxSample(self.time_us / 1e6,
+                *[v / s for (v, s) in zip(values, SCALES)]))
+
+            pos = end
+
+        return samples
+
+def decode_objects(uavo_list):
+    """ Generates the blackbox samples from a sequence of UAVOs, such as a
+    flight log read with telemetry.FileTelemetry """
+    dec = BlackboxDecoder()
+
+    for obj in uavo_list:
+        if obj.name != 'UAVO_BlackboxData':
+            continue
+
+        for s in dec.feed(obj):
+            yield s
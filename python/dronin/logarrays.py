@@ -0,0 +1,206 @@
+"""
+Whole logs parsed straight into numpy arrays.
+
+The C extension dronin._uavtalk walks the log once to count each object's
+packets and again to copy them into arrays, so no Python object is made per
+packet.  Each object's structured array, in the layout of its _dtype, is
+only put together when asked for, and UAVO instances only when iterated.
+
+Copyright (C) 2017 dRonin, http://dronin.org
+
+Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+"""
+
+from . import uavtalk, uavo_schema
+
+try:
+    from . import _uavtalk
+except ImportError:
+    _uavtalk = None
+
+# numpy types of the fields as they are sent
+wire_type_map = {
+    'int8'    : '<i1',
+    'int16'   : '<i2',
+    'int32'   : '<i4',
+    'uint8'   : '<u1',
+    'uint16'  : '<u2',
+    'uint32'  : '<u4',
+    'float'   : '<f4',
+    'enum'    : '<u1',
+    }
+
+def available():
+    """ Whether the C extension is built. """
+    return _uavtalk is not None
+
+def detect_gcs_timestamps(data):
+    """ Guesses whether a log has the GCS's [time][size] frame round each
+    packet, in the way process_stream does. """
+    hdr_size = uavtalk.logheader_fmt.size
+
+    if len(data) < hdr_size + len(uavo_schema.LOG_RECORD_MAGIC):
+        return False
+
+    if data[hdr_size:hdr_size + len(uavo_schema.LOG_RECORD_MAGIC)] == \
+            uavo_schema.LOG_RECORD_MAGIC:
+        return True
+
+    timestamp, size = uavtalk.logheader_fmt.unpack_from(data, 0)
+
+    return size <= 1000 and timestamp <= 100000000 and \
+            bytearray(data[hdr_size:hdr_size + 1])[0] == uavtalk.SYNC_VAL
+
+def wire_dtype(uavo_class):
+    """ The numpy type of an object's data as it is sent. """
+    import numpy as np
+
+    fields = []
+
+    for f in uavo_class._fieldinfo:
+        if f['elements'] != 1:
+            fields.append((f['name'], wire_type_map[f['type']], (f['elements'],)))
+        else:
+            fields.append((f['name'], wire_type_map[f['type']]))
+
+    return np.dtype(fields)
+
+def parser_objects(uavo_defs, wanted=None):
+    """ The objects as _uavtalk takes them: all the objects of uavo_defs
+    must be given for times to come out right, but only those in wanted,
+    if given, are kept. """
+    return [(u._id, u.get_size_of_data(), u._single,
+            wanted is None or u in wanted) for u in uavo_defs.values()]
+
+def raw_to_array(uavo_class, raw):
+    """ Makes an array of an object's _dtype from what _uavtalk.parse gave
+    for it. """
+    import numpy as np
+
+    times, inst, seq, data = raw
+
+    wire = data.view(wire_dtype(uavo_class)).reshape(len(times))
+
+    arr = np.empty(len(times), dtype=uavo_class._dtype)
+    arr['name'] = uavo_class._name
+    arr['time'] = times / 1000.0
+    arr['uavo_id'] = uavo_class._id
+
+    if not uavo_class._single:
+        arr['inst_id'] = inst
+
+    for name in wire.dtype.names:
+        arr[name] = wire[name]
+
+    return arr
+
+class LogArrays(object):
+    """ The objects in a log, parsed into arrays. """
+
+    def __init__(self, data, uavo_defs, gcs_timestamps=None):
+        """ Parses a log.
+
+         - data: the log, after any header; bytes or a mapped file
+         - uavo_defs: the UAVOCollection to decode it with
+         - gcs_timestamps: whether the log has the GCS's timestamps, or None
+           to guess
+        """
+        if _uavtalk is None:
+            raise ImportError("dronin._uavtalk is not built")
+
+        if gcs_timestamps is None:
+            gcs_timestamps = detect_gcs_timestamps(data)
+
+        self.uavo_defs = uavo_defs
+
+        self._raw, self.parsed = _uavtalk.parse(data,
+                parser_objects(uavo_defs), gcs_timestamps)
+        self._arrays = {}
+
+        self._classes = dict((u._id, u) for u in uavo_defs.values()
+                if u._id in self._raw)
+
+    def classes(self):
+        """ The classes of the objects in the log. """
+        return list(self._classes.values())
+
+    def __contains__(self, uavo_class):
+        return uavo_class._id in self._raw
+
+    def __len__(self):
+        return sum(len(raw[0]) for raw in self._raw.values())
+
+    def count(self, uavo_class):
+        raw = self._raw.get(uavo_class._id)
+
+        return 0 if raw is None else len(raw[0])
+
+    def times(self, uavo_class):
+        """ The time of each instance of an object, in seconds. """
+        import numpy as np
+
+        raw = self._raw.get(uavo_class._id)
+
+        if raw is None:
+            return np.array([])
+
+        return raw[0] / 1000.0
+
+    def as_numpy_array(self, uavo_class):
+        """ All instances of an object, as an array of its _dtype, as
+        TelemetryBase.as_numpy_array makes. """
+        import numpy as np
+
+        arr = self._arrays.get(uavo_class._id)
+
+        if arr is not None:
+            return arr
+
+        raw = self._raw.get(uavo_class._id)
+
+        if raw is None:
+            return np.array([])
+
+        arr = raw_to_array(uavo_class, raw)
+
+        self._arrays[uavo_class._id] = arr
+
+        return arr
+
+    def objects(self, uavo_class):
+        """ Makes the instances of an object, one by one. """
+        raw = self._raw.get(uavo_class._id)
+
+        if raw is None:
+            return
+
+        times, inst, seq, data = raw
+        single = uavo_class._single
+
+        for i in range(len(times)):
+            yield uavo_class.from_bytes(data[i].tobytes(), times[i],
+                    None if single else int(inst[i]))
+
+    def __iter__(self):
+        """ Makes the instances of all objects, in the order they were
+        logged. """
+        import numpy as np
+
+        if not self._raw:
+            return
+
+        ids = sorted(self._raw.keys())
+
+        seqs = np.concatenate([self._raw[i][2] for i in ids])
+        which = np.concatenate([np.full(len(self._raw[i][2]), n, dtype=np.int32)
+                for n, i in enumerate(ids)])
+        index = np.concatenate([np.arange(len(self._raw[i][2])) for i in ids])
+
+        order = np.argsort(seqs, kind='stable')
+
+        for n, i in zip(which[order], index[order]):
+            uavo_class = self._classes[ids[n]]
+            times, inst, seq, data = self._raw[ids[n]]
+
+            yield uavo_class.from_bytes(data[i].tobytes(), times[i],
+                    None if uavo_class._single else int(inst[i]))
@@ -0,0 +1,386 @@
+"""
+An index of where in a log each object is, so that a big log can be looked
+at without reading all of it.
+
+The log is cut into chunks of about CHUNK_SIZE bytes, ending on packet
+boundaries.  One pass over it, counting with dronin._uavtalk, notes for
+each chunk how many of each object it holds and over what span of time, and
+the timestamp state at its start.  To read an object over a span of time,
+only the chunks holding it then are parsed.
+
+The index is kept next to the log, as <log>.index.npz, and used again as
+long as the log, going by its size and time, and the objects it was made
+with have not changed.
+
+Copyright (C) 2017 dRonin, http://dronin.org
+
+Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+"""
+
+import os
+import tempfile
+
+import numpy as np
+
+from . import logarrays, uavo_schema
+
+CHUNK_SIZE = 1048576
+
+# Chunks next to each other are read together, up to this much at a time
+MAX_READ = 16 * CHUNK_SIZE
+
+INDEX_VERSION = 1
+
+def index_path(log_path):
+    return log_path + '.index.npz'
+
+def minmax_decimate(times, values, max_points):
+    """ Thins a series to at most max_points, keeping its shape: it is cut
+    into max_points / 2 runs, and the least and greatest value of each kept
+    in the order they came. """
+    count = len(values)
+
+    if count <= max_points or max_points < 2:
+        return times, values
+
+    bins = max_points // 2
+    per_bin = -(-count // bins)
+
+    padded = np.pad(values, (0, bins * per_bin - count), mode='edge')
+    padded = padded.reshape(bins, per_bin)
+
+    offsets = np.arange(bins) * per_bin
+
+    lows = np.minimum(offsets + padded.argmin(axis=1), count - 1)
+    highs = np.minimum(offsets + padded.argmax(axis=1), count - 1)
+
+    idx = np.sort(np.stack([lows, highs], axis=1), axis=1).ravel()
+
+    return times[idx], values[idx]
+
+def field_values(arr, field):
+    """ A field of an array of objects as floats; field is a name, or
+    name:element for one element of a field with several. """
+    parts = field.split(':')
+
+    values = arr[parts[0]]
+
+    if len(parts) > 1:
+        values = values[:, int(parts[1])]
+
+    return values.astype(float)
+
+class LogIndex(object):
+    """ The index of a log, and the reading of objects by it. """
+
+    def __init__(self, f, uavo_defs, body_start=0, gcs_timestamps=None,
+            path=None, progress_callback=None):
+        """ Loads or makes the index of a log.
+
+         - f: the log, opened for reading in binary
+         - uavo_defs: the UAVOCollection to decode it with
+         - body_start: where the objects start, after any header
+         - gcs_timestamps: whether the log has the GCS's timestamps, or None
+           to guess
+         - path: the log's path, to keep the index beside; if not given,
+           it is not kept
+         - progress_callback: called as it is made with the number of
+           objects and bytes read so far
+        """
+        if not logarrays.available():
+            raise ImportError("dronin._uavtalk is not built")
+
+        self.f = f
+        self.uavo_defs = uavo_defs
+        self.body_start = body_start
+
+        self.f.seek(0, os.SEEK_END)
+        self.log_size = self.f.tell()
+
+        if gcs_timestamps is None:
+            self.f.seek(body_start)
+            gcs_timestamps = logarrays.detect_gcs_timestamps(self.f.read(64))
+
+        self.gcs_timestamps = gcs_timestamps
+
+        self.all_objects = logarrays.parser_objects(uavo_defs)
+        self.uavo_hash = uavo_schema.uavo_hash(u._id for u in uavo_defs.values())
+
+        self.log_mtime = 0 if path is None else int(os.stat(path).st_mtime)
+
+        if path is None or not self.__load(index_path(path)):
+            self.__build(progress_callback)
+
+            if path is not None:
+                self.__save(index_path(path))
+
+        self.__make_lookup()
+
+    def __build(self, progress_callback):
+        """ Scans the log a chunk at a time. """
+        starts, lengths, states = [], [], []
+        entries = []
+
+        state = (0, 0)
+        offset = self.body_start
+        received = 0
+
+        self.f.seek(offset)
+        data = b''
+
+        while True:
+            more = self.f.read(CHUNK_SIZE)
+
+            data += more
+
+            if not data:
+                break
+
+            counts, parsed, next_state = logarrays._uavtalk.scan(data,
+                    self.all_objects, self.gcs_timestamps, state)
+
+            # Nothing more can be parsed, without more to parse it with
+            if parsed == 0 and more:
+                continue
+
+            if parsed == 0:
+                break
+
+            chunk = len(starts)
+
+            starts.append(offset)
+            lengths.append(parsed)
+            states.append(state)
+
+            for uavo_id, (count, first, last) in counts.items():
+                entries.append((uavo_id, chunk, count, first, last))
+                received += count
+
+            offset += parsed
+            state = next_state
+            data = data[parsed:]
+
+            if progress_callback is not None:
+                progress_callback(received, offset)
+
+        self.chunk_start = np.array(starts, dtype=np.uint64)
+        self.chunk_length = np.array(lengths, dtype=np.uint32)
+        self.chunk_state = np.array(states, dtype=np.uint32).reshape(-1, 2)
+
+        entries.sort()
+
+        entries = np.array(entries, dtype=float).reshape(-1, 5)
+
+        self.entry_id = entries[:, 0].astype(np.uint32)
+        self.entry_chunk = entries[:, 1].astype(np.uint32)
+        self.entry_count = entries[:, 2].astype(np.uint32)
+        self.entry_first = entries[:, 3]
+        self.entry_last = entries[:, 4]
+
+    def __identity(self):
+        """ What the index depends on: the log, and the objects it was
+        decoded with. """
+        return np.array([INDEX_VERSION, self.log_size, self.log_mtime,
+            self.body_start, self.gcs_timestamps, self.uavo_hash],
+            dtype=np.uint64)
+
+    def __save(self, name):
+        """ Keeps the index next to the log.  It is written to a temporary
+        file which then replaces the old one, so that it is never seen half
+        written. """
+        try:
+            fd, tmp = tempfile.mkstemp(dir=os.path.dirname(name) or '.',
+                    prefix=os.path.basename(name), suffix='.tmp')
+        except (IOError, OSError):
+            # Somewhere read only, perhaps; it will just be made again
+            return
+
+        try:
+            with os.fdopen(fd, 'wb') as f:
+                np.savez(f, identity=self.__identity(),
+                        chunk_start=self.chunk_start,
+                        chunk_length=self.chunk_length,
+                        chunk_state=self.chunk_state,
+                        entry_id=self.entry_id,
+                        entry_chunk=self.entry_chunk,
+                        entry_count=self.entry_count,
+                        entry_first=self.entry_first,
+                        entry_last=self.entry_last)
+
+            os.replace(tmp, name)
+        except (IOError, OSError):
+            try:
+                os.unlink(tmp)
+            except OSError:
+                pass
+
+    def __load(self, name):
+        """ Loads a kept index, if there is one for this log as it is now.
+        Anything wrong with it, such as being cut short, just means it is
+        made again.
+        @return whether it was loaded """
+        if not os.path.exists(name):
+            return False
+
+        try:
+            with np.load(name) as saved:
+                if not np.array_equal(saved['identity'], self.__identity()):
+                    return False
+
+                for key in ('chunk_start', 'chunk_length', 'chunk_state',
+                        'entry_id', 'entry_chunk', 'entry_count',
+                        'entry_first', 'entry_last'):
+                    setattr(self, key, saved[key])
+        except Exception:
+            return False
+
+        return True
+
+    def __make_lookup(self):
+        """ Where each object's entries are; they are in order of id. """
+        ids, firsts, counts = np.unique(self.entry_id, return_index=True,
+                return_counts=True)
+
+        self.entry_range = dict((int(i), (int(s), int(s + n)))
+                for i, s, n in zip(ids, firsts, counts))
+
+        self.classes_by_id = dict((u._id, u) for u in self.uavo_defs.values()
+                if u._id in self.entry_range)
+
+    def classes(self):
+        """ The classes of the objects in the log. """
+        return list(self.classes_by_id.values())
+
+    def count(self, uavo_class):
+        start, end = self.entry_range.get(uavo_class._id, (0, 0))
+
+        return int(self.entry_count[start:end].sum())
+
+    def time_span(self, uavo_class=None):
+        """ The first and last times, in seconds, of an object or of the
+        whole log. """
+        if uavo_class is None:
+            first, last = self.entry_first, self.entry_last
+        else:
+            start, end = self.entry_range.get(uavo_class._id, (0, 0))
+            first = self.entry_first[start:end]
+            last = self.entry_last[start:end]
+
+        if not len(first):
+            return None
+
+        return first.min() / 1000.0, last.max() / 1000.0
+
+    def __chunk_runs(self, uavo_class, t0, t1):
+        """ The stretches of the log to read for an object between two times
+        in seconds, either of which may be None, as lists of chunks. """
+        start, end = self.entry_range.get(uavo_class._id, (0, 0))
+
+        chunks = self.entry_chunk[start:end]
+        keep = np.ones(len(chunks), dtype=bool)
+
+        if t0 is not None:
+            keep &= self.entry_last[start:end] >= t0 * 1000.0
+        if t1 is not None:
+            keep &= self.entry_first[start:end] <= t1 * 1000.0
+
+        runs = []
+
+        for chunk in chunks[keep]:
+            if runs and runs[-1][-1] == chunk - 1 and \
+                    sum(self.chunk_length[c] for c in runs[-1]) < MAX_READ:
+                runs[-1].append(chunk)
+            else:
+                runs.append([chunk])
+
+        return runs
+
+    def __read_raw(self, uavo_class, t0, t1):
+        """ Parses the stretches of the log holding an object between two
+        times, giving what _uavtalk.parse does for it in each, less any
+        instances outside the times. """
+        wanted = logarrays.parser_objects(self.uavo_defs, [uavo_class])
+
+        for run in self.__chunk_runs(uavo_class, t0, t1):
+            first = run[0]
+            length = sum(int(self.chunk_length[c]) for c in run)
+
+            self.f.seek(int(self.chunk_start[first]))
+            data = self.f.read(length)
+
+            state = tuple(int(s) for s in self.chunk_state[first])
+
+            raw, parsed = logarrays._uavtalk.parse(data, wanted,
+                    self.gcs_timestamps, state)
+
+            if uavo_class._id not in raw:
+                continue
+
+            raw = raw[uavo_class._id]
+            times = raw[0]
+
+            keep = np.ones(len(times), dtype=bool)
+
+            if t0 is not None:
+                keep &= times >= t0 * 1000.0
+            if t1 is not None:
+                keep &= times <= t1 * 1000.0
+
+            if keep.any():
+                yield tuple(a[keep] for a in raw)
+
+    def read_runs(self, uavo_class, t0=None, t1=None):
+        """ Reads an object between two times in seconds, either of which
+        may be None, making an array of its _dtype for each stretch of the
+        log read. """
+        for raw in self.__read_raw(uavo_class, t0, t1):
+            yield logarrays.raw_to_array(uavo_class, raw)
+
+    def as_numpy_array(self, uavo_class, t0=None, t1=None):
+        """ All instances of an object, or those between two times in
+        seconds, as an array of its _dtype. """
+        arrays = list(self.read_runs(uavo_class, t0, t1))
+
+        if not arrays:
+            return np.array([])
+
+        return np.concatenate(arrays)
+
+    def objects(self, uavo_class, t0=None, t1=None):
+        """ Makes the instances of an object, one by one. """
+        single = uavo_class._single
+
+        for times, inst, seq, data in self.__read_raw(uavo_class, t0, t1):
+            for i in range(len(times)):
+                yield uavo_class.from_bytes(data[i].tobytes(), times[i],
+                        None if single else int(inst[i]))
+
+    def series(self, uavo_class, field, t0=None, t1=None, max_points=None):
+        """ A field of an object against time between two times in seconds,
+        thinned to at most max_points; see field_values for field.  Each
+        stretch of the log is thinned as it is read, so no more than one is
+        held in full at once.
+        @return times, values """
+        times, values = [], []
+
+        for arr in self.read_runs(uavo_class, t0, t1):
+            run_times = arr['time']
+            run_values = field_values(arr, field)
+
+            if max_points is not None:
+                run_times, run_values = minmax_decimate(run_times, run_values,
+                        max_points)
+
+            times.append(run_times)
+            values.append(run_values)
+
+        if not times:
+            return np.array([]), np.array([])
+
+        times = np.concatenate(times)
+        values = np.concatenate(values)
+
+        if max_points is not None:
+            times, values = minmax_decimate(times, values, max_points)
+
+        return times, values
@@ -5,46 +5,87 @@ from dronin_pyqtgraph.Qt import QtCore, QtGui
 import numpy as np
 
 from dronin.logviewer.plotdockarea import PlotDockArea
+from dronin import logindex
 
 from dronin_pyqtgraph.dockarea import *
 
 import six
 
-def get_data_series(obj_name, fields):
+def get_time_series(obj_name, field, t0=None, t1=None, max_points=None):
+    """ A field of an object against time, between two times in seconds,
+    min/max thinned to at most max_points.  With an index, only the part of
+    the log holding them is read. """
+    typ = objtyps[obj_name]
+
+    if index is not None:
+        return index.series(typ, field, t0, t1, max_points)
+
     data = get_series(obj_name)
 
     if (len(data) < 1):
-        return []
+        return np.array([]), np.array([])
 
-    base_fields = [ f.split(':')[0] for f in fields ]
-    peeled = data[base_fields]
+    times = data['time']
+    keep = np.ones(len(times), dtype=bool)
 
-    if ':' not in ''.join(fields):
-        try:
-            return peeled.view(dtype='float').reshape(-1, 2)
-        except Exception:
-            pass
+    if t0 is not None:
+        keep &= times >= t0
+    if t1 is not None:
+        keep &= times <= t1
 
-    rows = peeled.shape[0]
-    cols = len(fields)
-    outp = np.empty((peeled.shape[0], len(fields)))
+    values = logindex.field_values(data[keep], field)
 
-    for j in range(cols):
-        field_info = fields[j].split(':')
+    if max_points is None:
+        return times[keep], values
 
-        if len(field_info) > 1:
-            subs = int(field_info[1])
-            for i in range(rows):
-                val = peeled[i][j][subs]
+    return logindex.minmax_decimate(times[keep], values, max_points)
 
-                outp[i,j] = float(val)
-        else:
-            for i in range(rows):
-                val = peeled[i][j]
+class SeriesLoader(object):
+    """ Keeps a plot's curves filled with the part of the log in view,
+    thinned to about two points a pixel, as it is panned and zoomed. """
+
+    def __init__(self, pw, curves):
+        self.pw = pw
+        self.curves = curves
+        self.window = None
+
+        self.load(None, None)
+
+        self.proxy = pg.SignalProxy(pw.sigXRangeChanged, rateLimit=10,
+                slot=self.view_changed)
+
+    def max_points(self):
+        return max(2 * self.pw.width(), 1000)
+
+    def load(self, t0, t1):
+        self.window = None if t0 is None else (t0, t1)
 
-                outp[i,j] = float(val)
+        for curve, obj_name, field in self.curves:
+            times, values = get_time_series(obj_name, field, t0, t1,
+                    self.max_points())
+            curve.setData(x=times, y=values)
 
-    return outp
+    def view_changed(self, *args):
+        if self.pw.getViewBox().autoRangeEnabled()[0]:
+            # All of it is in view again
+            if self.window is not None:
+                self.load(None, None)
+
+            return
+
+        t0, t1 = self.pw.viewRange()[0]
+        span = t1 - t0
+
+        # Still within what is loaded, and not so zoomed that it is too
+        # thin to see by
+        if self.window is not None and self.window[0] <= t0 and \
+                t1 <= self.window[1] and \
+                span * 4 > self.window[1] - self.window[0]:
+            return
+
+        # Load some either side, so it can be panned a little without
+        # loading again
+        self.load(t0 - span / 2, t1 + span / 2)
 
 def add_plot_area(data_series, dock_name, axis_label, legend=False, **kwargs):
     dock = Dock(dock_name, size=(800, 300))
@@ -57,10 +98,15 @@ def add_plot_area(data_series, dock_name, axis_label, legend=False, **kwargs):
     colors = [ 'w', 'm', 'y', 'c' ]
     idx = 0
 
-    for plot_name, data in data_series.items():
-        pw.plot(data, antialias=True, name='&nbsp;'+plot_name, pen=pg.mkPen(colors[idx]), **kwargs)
+    curves = []
+
+    for plot_name, (obj_name, field) in data_series.items():
+        curve = pw.plot(antialias=True, name='&nbsp;'+plot_name, pen=pg.mkPen(colors[idx]), **kwargs)
+        curves.append((curve, obj_name, field))
         idx += 1
 
+    pw.series_loader = SeriesLoader(pw, curves)
+
     # pen=None, symbol='o', symbolSize=2.5
 
     pw.setLabel('left', axis_label)
@@ -93,7 +139,7 @@ def plot_vs_time(obj_name, fields):
 
     data_series = {}
     for f in fields:
-        data_series[obj_name + '.' + f] = get_data_series(obj_name, ['time', f])
+        data_series[obj_name + '.' + f] = (obj_name, f)
 
     global win_num
 
@@ -155,7 +201,7 @@ def scan_for_events(uv):
     return events
 
 def handle_open(ignored=False, fname=None):
-    from dronin import telemetry, uavo
+    from dronin import telemetry, uavo, logarrays
 
     if fname is None:
         fname = QtGui.QFileDialog.getOpenFileName(win, 'Open file', filter="Log files (*.drlog *.txt)")
@@ -192,6 +238,15 @@ def handle_open(ignored=False, fname=None):
         t = telemetry.FileTelemetry(f, parse_header=True, service_in_iter=True,
                     gcs_timestamps=None, name=fname, progress_callback=cb)
 
+        # Index it, or load the index made before, rather than reading it
+        # all; then only what is plotted is read.
+        global index
+        index = None
+
+        if logarrays.available():
+            index = logindex.LogIndex(f, t.uavo_defs, body_start=t.body_start,
+                    gcs_timestamps=None, path=fname, progress_callback=cb)
+
         global series, objtyps
         series = {}
         objtyps = {}
@@ -200,7 +255,10 @@ def handle_open(ignored=False, fname=None):
             short_name = typ._name[5:]
             objtyps[short_name] = typ
 
-        event_series = scan_for_events(t)
+        if index is not None:
+            event_series = scan_for_events(index.objects(objtyps['FlightStatus']))
+        else:
+            event_series = scan_for_events(t)
 
         global last_plot
         last_plot = None
@@ -219,7 +277,12 @@ def handle_open(ignored=False, fname=None):
         plot_vs_time('Gyros', ['x', 'y', 'z'])
         plot_vs_time('ActuatorCommand', ['Channel:0', 'Channel:1', 'Channel:2', 'Channel:3'])
 
-        objtyps = { k:v for k,v in objtyps.items() if v in t.last_values }
+        if index is not None:
+            present = set(index.classes())
+        else:
+            present = t.last_values
+
+        objtyps = { k:v for k,v in objtyps.items() if v in present }
 
         #add all non-settings objects, and autotune, to the keys.
         objSel.clear()
@@ -277,6 +340,7 @@ menubar = win.menuBar()
 
 win_num = 0
 menus_enabled = False
+index = None
 
 openAction = QtGui.QAction("&Open", win)
 openAction.setShortcut(QtGui.QKeySequence.Open)
@@ -9,9 +9,9 @@ Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER
 import socket
 import time
 import errno
-from threading import Condition
+from threading import Condition, Lock
 
-from . import uavtalk, uavo_collection, uavo
+from . import uavtalk, uavo_collection, uavo, uavo_schema, logarrays
 
 import os
 
@@ -19,6 +19,37 @@ from abc import ABCMeta, abstractmethod
 
 from six import with_metaclass
 
+class Transaction(object):
+    """
+    An object sent wanting an ack, or asked for.  It is done when the flight
+    controller acks it, or sends the object asked for, or when it has been
+    sent as many times as it may be without that happening.
+    """
+
+    def __init__(self, telemetry, uavo_class, packet, wants_ack, retries,
+            timeout):
+        self.telemetry = telemetry
+        self.uavo_class = uavo_class
+        self.packet = packet
+        self.wants_ack = wants_ack
+        self.retries = retries
+        self.timeout = timeout
+
+        self.tries = 0
+        self.deadline = None
+
+        self.done = False
+        self.succeeded = False
+        self.nacked = False
+
+        # The object received, for a request
+        self.result = None
+
+    def wait(self, timeout=None):
+        """ Waits for it to be done, or for timeout seconds if given.
+        Returns whether it succeeded. """
+        return self.telemetry._wait_transaction(self, timeout)
+
 class TelemetryBase(with_metaclass(ABCMeta)):
     """
     Basic (abstract) implementation of telemetry used by all stream types.
@@ -26,7 +57,8 @@ class TelemetryBase(with_metaclass(ABCMeta)):
 
     def __init__(self, githash=None, service_in_iter=True,
             iter_blocks=True, use_walltime=True, do_handshaking=False,
-            gcs_timestamps=False, name=None, progress_callback=None):
+            gcs_timestamps=False, name=None, progress_callback=None,
+            uavo_defs=None):
 
         """Instantiates a telemetry instance.  Called only by derived classes.
          - githash: revision control id of the UAVO's used to communicate.
@@ -46,16 +78,19 @@ class TelemetryBase(with_metaclass(ABCMeta)):
          - name: a filename to store into .filename for legacy purposes
          - progress_callback: a function to call periodically with progress
              information
+         - uavo_defs: the UAVO definitions to use, if already loaded.  If
+             given, githash is not used to find them.
         """
 
-        uavo_defs = uavo_collection.UAVOCollection()
+        if uavo_defs is None:
+            uavo_defs = uavo_collection.UAVOCollection()
 
-        if githash:
-            uavo_defs.from_git_hash(githash)
-        else:
-            xml_path = os.path.join(os.path.dirname(__file__), "..", "..",
-                                    "shared", "uavobjectdefinition")
-            uavo_defs.from_uavo_xml_path(xml_path)
+            if githash:
+                uavo_defs.from_git_hash(githash)
+            else:
+                xml_path = os.path.join(os.path.dirname(__file__), "..", "..",
+                                        "shared", "uavobjectdefinition")
+                uavo_defs.from_uavo_xml_path(xml_path)
 
         self.githash = githash
 
@@ -88,6 +123,16 @@ class TelemetryBase(with_metaclass(ABCMeta)):
         self.acks = set()
         self.nacks = set()
 
+        # Transactions sent and not yet done, by class, and those waiting
+        # to be sent.  Acks and nacks only say which class they are for, so
+        # only one transaction of a class can be out at once.  The bytes out
+        # are kept below the smallest telemetry receive buffer on the flight
+        # side (384 on the simulator), which drops what doesn't fit.
+        self.in_flight = {}
+        self.queued = []
+        self.max_in_flight = 8
+        self.max_bytes_in_flight = 256
+
         self.eof = False
 
         self.first_handshake_needed = self.do_handshaking
@@ -103,13 +148,137 @@ class TelemetryBase(with_metaclass(ABCMeta)):
     def gotack_callback(self, obj):
         with self.ack_cond:
             self.acks.add(obj)
+
+            tx = self.in_flight.get(obj)
+
+            if tx is not None and tx.wants_ack:
+                self.__finish(tx, True)
+
             self.ack_cond.notifyAll()
 
     def gotnack_callback(self, obj):
         with self.ack_cond:
             self.nacks.add(obj)
+
+            tx = self.in_flight.get(obj)
+
+            if tx is not None:
+                tx.nacked = True
+                self.__finish(tx, False)
+
             self.ack_cond.notifyAll()
 
+    def __transmit(self, tx):
+        """ Sends, or sends again, a transaction.  ack_cond must be held. """
+        tx.tries += 1
+        tx.deadline = time.time() + tx.timeout
+
+        self._send(tx.packet)
+
+    def __start_queued(self):
+        """ Sends what transactions can be sent now, in the order they were
+        made.  ack_cond must be held. """
+        i = 0
+        out_bytes = sum(len(tx.packet) for tx in self.in_flight.values())
+
+        while i < len(self.queued) and len(self.in_flight) < self.max_in_flight:
+            tx = self.queued[i]
+
+            if tx.uavo_class in self.in_flight:
+                i += 1
+                continue
+
+            # One is always let out, however big
+            if self.in_flight and \
+                    out_bytes + len(tx.packet) > self.max_bytes_in_flight:
+                break
+
+            del self.queued[i]
+            out_bytes += len(tx.packet)
+
+            self.in_flight[tx.uavo_class] = tx
+            self.__transmit(tx)
+
+    def __finish(self, tx, succeeded, result=None):
+        """ Marks a transaction done, and sends any waiting on it.  ack_cond
+        must be held. """
+        if self.in_flight.get(tx.uavo_class) is tx:
+            del self.in_flight[tx.uavo_class]
+        elif tx in self.queued:
+            self.queued.remove(tx)
+
+        tx.done = True
+        tx.succeeded = succeeded
+        tx.result = result
+
+        self.__start_queued()
+
+        self.ack_cond.notifyAll()
+
+    def __begin(self, tx):
+        with self.ack_cond:
+            self.queued.append(tx)
+            self.__start_queued()
+
+        return tx
+
+    def __expire_transactions(self):
+        """ Sends again the transactions that have gone unanswered too long,
+        or gives up on them.
+        @return when the next one would be due, or None if none are out """
+        with self.ack_cond:
+            now = time.time()
+
+            for tx in list(self.in_flight.values()):
+                if self.eof:
+                    self.__finish(tx, False)
+                elif tx.deadline <= now:
+                    if tx.tries < tx.retries:
+                        self.__transmit(tx)
+                    else:
+                        self.__finish(tx, False)
+
+            if self.eof:
+                for tx in self.queued[:]:
+                    self.__finish(tx, False)
+
+            if not self.in_flight:
+                return None
+
+            return min(tx.deadline for tx in self.in_flight.values())
+
+    def _wait_transaction(self, tx, timeout):
+        if timeout is not None:
+            expiry = time.time() + timeout
+        else:
+            expiry = None
+
+        while True:
+            with self.ack_cond:
+                if tx.done:
+                    return tx.succeeded
+
+                if expiry is not None:
+                    remaining = expiry - time.time()
+
+                    if remaining <= 0:
+                        return False
+                else:
+                    remaining = None
+
+                if not self.service_in_iter:
+                    if self.eof:
+                        return False
+
+                    self.ack_cond.wait(remaining)
+                    continue
+
+            # Nothing else is servicing the connection, so do it here
+            if self._done():
+                self.__expire_transactions()
+            else:
+                self.service_connection(remaining)
+
     def as_numpy_array(self, match_class, filter_cond=None):
         """ Transforms all received instances of a given object to a numpy array.
 
@@ -165,27 +334,36 @@ class TelemetryBase(with_metaclass(ABCMeta)):
         return self.GCSTelemetryStats._make_to_send(
                 Status=self.GCSTelemetryStats.ENUM_Status[handshake])
 
-    def __remove_from_ack_set(self, obj):
-        with self.ack_cond:
-            self.acks.discard(obj)
-
     def send_object(self, send_obj, req_ack=False, *args, **kwargs):
+        """ Sends an object.  If req_ack, waits for the flight controller to
+        ack it and returns whether it did. """
         if not self.do_handshaking:
             raise ValueError("Can only send on handshaking/bidir sessions")
 
         if req_ack:
-            self.__remove_from_ack_set(send_obj.__class__)
+            return self.send_object_async(send_obj, *args, **kwargs).wait()
 
-            for i in range(8):
-                self._send(uavtalk.send_object(send_obj, req_ack=req_ack, *args, **kwargs))
-                if self.__wait_ack(send_obj.__class__, 0.26):
-                    return True
+        self._send(uavtalk.send_object(send_obj, req_ack=req_ack, *args, **kwargs))
+        return True
 
-            return False
+    def send_object_async(self, send_obj, retries=8, timeout=0.26):
+        """ Sends an object wanting an ack, without waiting for it.  Objects
+        of other classes may be sent before it is acked.
 
-        else:
-            self._send(uavtalk.send_object(send_obj, req_ack=req_ack, *args, **kwargs))
-            return True
+         - retries: how many times to send it before giving up
+         - timeout: how long to wait for an ack each time, in seconds
+
+        Returns a Transaction to wait on.
+        """
+        if not self.do_handshaking:
+            raise ValueError("Can only send on handshaking/bidir sessions")
+
+        with self.ack_cond:
+            self.acks.discard(send_obj.__class__)
+
+        return self.__begin(Transaction(self, send_obj.__class__,
+            uavtalk.send_object(send_obj, req_ack=True), True, retries,
+            timeout))
 
     def __handle_handshake(self, obj):
         if obj.name == "UAVO_FlightTelemetryStats":
@@ -211,24 +389,14 @@ class TelemetryBase(with_metaclass(ABCMeta)):
 
         self._send(uavtalk.request_object(obj))
 
-    def __wait_ack(self, obj, timeout):
-        expiry = time.time() + timeout
-
-        # properly sleep, etc.
-        with self.ack_cond:
-            while True:
-                if obj in self.acks:
-                    return True
-
-                if self.eof:
-                    return False
-
-                diff = expiry - time.time();
-
-                if (diff <= 0):
-                    return False
+    def request_object_async(self, obj, retries=3, timeout=0.26):
+        """ Asks for an object, without waiting for it, as send_object_async.
+        The Transaction's result is the object received. """
+        if not self.do_handshaking:
+            raise ValueError("Can only request on handshaking/bidir sessions")
 
-                self.ack_cond.wait(diff + 0.001)
+        return self.__begin(Transaction(self, obj, uavtalk.request_object(obj),
+            False, retries, timeout))
 
     def get_nacks(self):
         with self.ack_cond:
@@ -254,6 +422,14 @@ class TelemetryBase(with_metaclass(ABCMeta)):
 
                 obj = self.uavtalk_generator.send(b'')
 
+        # Objects asked for are answered by the object itself
+        with self.ack_cond:
+            for obj in objs:
+                tx = self.in_flight.get(obj.__class__)
+
+                if tx is not None and not tx.wants_ack:
+                    self.__finish(tx, True, obj)
+
         # Only traverse the lock when we've processed everything in this
         # batch.
         with self.cond:
@@ -307,6 +483,8 @@ class TelemetryBase(with_metaclass(ABCMeta)):
                         self.eof = True
                         self._close()
 
+                self.__expire_transactions()
+
         t = Thread(target=run, name="telemetry svc thread")
 
         t.daemon=True
@@ -329,8 +507,20 @@ class TelemetryBase(with_metaclass(ABCMeta)):
             self.send_object(send_obj)
 
             self.first_handshake_needed = False
+
+        # Wake in time to send again or give up on what is unanswered
+        due = self.__expire_transactions()
+
+        if due is not None and (finish_time is None or due < finish_time):
+            finish_time = due
+
         data = self._receive(finish_time)
-        self.__handle_frames(data)
+
+        # Nothing came in time
+        if data is not None:
+            self.__handle_frames(data)
+
+        self.__expire_transactions()
 
     @abstractmethod
     def _receive(self, finish_time):
@@ -365,6 +555,9 @@ class BidirTelemetry(TelemetryBase):
         self.recv_buf = b''
         self.send_buf = b''
 
+        # Set by _do_io when the other end closes the stream
+        self.recv_eof = False
+
         self.send_lock = Condition()
 
     def _receive(self, finish_time):
@@ -377,7 +570,8 @@ class BidirTelemetry(TelemetryBase):
             pass
 
         if len(self.recv_buf) < 1:
-            return None
+            # An empty read is how the end of the stream is passed on
+            return b'' if self.recv_eof else None
 
         ret = self.recv_buf
         self.recv_buf = b''
@@ -392,11 +586,18 @@ class BidirTelemetry(TelemetryBase):
 
         if self.service_in_iter:
             self._do_io(0)
+        else:
+            self._wake()
 
     @abstractmethod
     def _do_io(self, finish_time):
         return
 
+    # Interrupts a _do_io waiting in another thread, so it sends what has
+    # just been queued.  Those that poll need not.
+    def _wake(self):
+        return
+
 
 class FDTelemetry(BidirTelemetry):
     """
@@ -416,21 +617,45 @@ class FDTelemetry(BidirTelemetry):
         service_in_iter, iter_blocks, use_walltime
         """
 
+        import fcntl
+
+        # Written to when there is something to send, so that a select
+        # waiting only to read returns to write it
+        self.wake_rd, self.wake_wr = os.pipe()
+
+        for wake_fd in (self.wake_rd, self.wake_wr):
+            fcntl.fcntl(wake_fd, fcntl.F_SETFL,
+                    fcntl.fcntl(wake_fd, fcntl.F_GETFL) | os.O_NONBLOCK)
+
+        # Held to write to or close the pipe, as any thread sending may wake
+        # the service thread while it is closing down
+        self.wake_lock = Lock()
+
         BidirTelemetry.__init__(self, *args, **kwargs)
 
         self.fd = fd
 
+    def _wake(self):
+        with self.wake_lock:
+            if self.wake_wr is None:
+                return
+
+            try:
+                os.write(self.wake_wr, b'w')
+            except OSError as err:
+                # Full already, so it will wake anyway
+                if err.errno != errno.EAGAIN:
+                    raise
+
     # Call select and do one set of IO operations.
     def _do_io(self, finish_time):
         import select
 
-        rdSet = []
+        rdSet = [self.fd, self.wake_rd]
         wrSet = []
 
         did_stuff = False
-
-        if len(self.recv_buf) < 1024:
-            rdSet.append(self.fd)
+        woken = False
 
         if len(self.send_buf) > 0:
             wrSet.append(self.fd)
@@ -444,14 +669,24 @@ class FDTelemetry(BidirTelemetry):
 
             r,w,e = select.select(rdSet, wrSet, [], tm)
 
-        if r:
+        if self.wake_rd in r:
+            try:
+                os.read(self.wake_rd, 4096)
+            except OSError as err:
+                if err.errno != errno.EAGAIN:
+                    raise
+
+            woken = True
+
+        if self.fd in r:
             # Shouldn't throw an exception-- they just told us
             # it was ready for read.
             # TODO: Figure out why read sometimes fails when using sockets
             try:
-                chunk = os.read(self.fd, 1024)
-                if chunk == '':
-                    raise RuntimeError("stream closed")
+                chunk = os.read(self.fd, 65536)
+                if not chunk:
+                    self.recv_eof = True
+                    return False
 
                 self.recv_buf = self.recv_buf + chunk
 
@@ -471,8 +706,18 @@ class FDTelemetry(BidirTelemetry):
 
                 did_stuff = True
 
-        return did_stuff
-    
+        # Woken, so let the caller look at what is due before waiting again
+        return did_stuff and not woken
+
+    def _close(self):
+        # Only the thread doing the IO closes, so _do_io needs no lock
+        with self.wake_lock:
+            if self.wake_rd is not None:
+                os.close(self.wake_rd)
+                os.close(self.wake_wr)
+
+                self.wake_rd = self.wake_wr = None
+
 class NetworkTelemetry(FDTelemetry):
     """ TCP telemetry interface. """
     def __init__(self, host="127.0.0.1", port=9000, *args, **kwargs):
@@ -495,6 +740,7 @@ class NetworkTelemetry(FDTelemetry):
         FDTelemetry.__init__(self, fd=s.fileno(), *args, **kwargs)
 
     def _close(self):
+        FDTelemetry._close(self)
         self.sock.close()
 
 # TODO XXX : Plumb appropriate cleanup / file close for these classes
@@ -720,7 +966,9 @@ class FileTelemetry(TelemetryBase):
             #    First line is "dRonin git hash:" or "Tau Labs git hash:"
             #    Second line is the actual git hash
             #    Third line is the UAVO hash
-            #    Fourth line is "##" (only from GCS)
+            #    Then "uavoschema", if the GCS was asked to embed the UAVO
+            #    definitions (only from GCS)
+            #    Then "##" (only from GCS)
 
             # Scan up to 100 "lines" looking for the signature, in case
             # there's garbage at the beginning of the log
@@ -748,9 +996,14 @@ class FileTelemetry(TelemetryBase):
             print("Log file is based on git hash: %s" % githash)
 
             uavohash = self.f.readline()
-            # divider only occurs on GCS-type streams.  This causes us to
-            # miss first objects in telemetry-type streams
-            # divider = self.f.readline()
+            # divider only occurs on GCS-type streams.  GCS logs flagged
+            # with uavoschema follow it with the definitions of the UAVOs
+            # they were made with, so git need not be asked for them.
+            uavo_defs = self.__read_schema()
+
+            if uavo_defs is not None:
+                print("Log file carries its UAVO definitions")
+                kwargs['uavo_defs'] = uavo_defs
 
             TelemetryBase.__init__(self, iter_blocks=True,
                 do_handshaking=False, githash=githash, use_walltime=False,
@@ -761,6 +1014,70 @@ class FileTelemetry(TelemetryBase):
 
         self.done=False
 
+        # Where the objects start, so the whole log can be parsed again in
+        # one go by as_numpy_array.
+        self.gcs_timestamps = kwargs.get('gcs_timestamps', False)
+        self.log_arrays = None
+
+        try:
+            self.body_start = self.f.tell()
+        except (AttributeError, IOError):
+            self.body_start = None
+
+    def as_numpy_array(self, match_class, filter_cond=None):
+        """ Transforms all instances of a given object in the log to a numpy
+        array.
+
+        The first call parses the whole log with the dronin._uavtalk
+        extension, if it is built, rather than making every object in it.
+        Otherwise, or with a filter_cond, this is TelemetryBase's.
+        """
+        if filter_cond is None and self.body_start is not None and \
+                logarrays.available():
+            if self.log_arrays is None:
+                pos = self.f.tell()
+                self.f.seek(self.body_start)
+                data = self.f.read()
+                self.f.seek(pos)
+
+                self.log_arrays = logarrays.LogArrays(data, self.uavo_defs,
+                        gcs_timestamps=self.gcs_timestamps)
+
+            return self.log_arrays.as_numpy_array(match_class)
+
+        return TelemetryBase.as_numpy_array(self, match_class, filter_cond)
+
+    def __read_schema(self):
+        """ Loads the UAVO schema record following the header divider, if
+        the header is flagged as having one.  Otherwise leaves the file where
+        it was, as a flight log has no divider and its first objects start
+        here. """
+        pos = self.f.tell()
+
+        if self.f.readline() == b'uavoschema\n' and \
+                self.f.readline() == b'##\n':
+            record = self.f.read(uavtalk.logheader_fmt.size +
+                    len(uavo_schema.LOG_RECORD_MAGIC))
+
+            if len(record) == uavtalk.logheader_fmt.size + \
+                    len(uavo_schema.LOG_RECORD_MAGIC):
+                timestamp, size = uavtalk.logheader_fmt.unpack_from(record)
+
+                payload = record[uavtalk.logheader_fmt.size:] + \
+                        self.f.read(size - len(uavo_schema.LOG_RECORD_MAGIC))
+
+                bundle = uavo_schema.unpack_log_record(payload)
+
+                if bundle is not None:
+                    uavo_defs = uavo_collection.UAVOCollection()
+                    uavo_defs.from_schema_bytes(bundle)
+
+                    return uavo_defs
+
+        self.f.seek(pos)
+
+        return None
+
     def _receive(self, finish_time):
         """ Fetch available data from file """
 
@@ -188,9 +188,13 @@ struct_element_map = {
     'enum'    : 'B',
     }
 
-# This is a very long, scary method.  It parses an XML file describing
-# a UAVO and builds an implementation class.
-def make_class(collection, xml_file, update_globals=True):
+def parse_xml(collection, xml_file):
+    """ Parses an XML file describing a UAVO into a description: a dict of
+    its name, id, flags and fields, in the form build_class takes.
+
+    Enums which take their options from a parent in another object need the
+    parent to be in the collection already.
+    """
     fields = []
 
     ##### PARSE THE XML FILE INTO INTERNAL REPRESENTATIONS #####
@@ -300,7 +304,7 @@ def make_class(collection, xml_file, update_globals=True):
                         values = (0,)
                 else:  # float or int
                     values = tuple(float(v) for v in info['defaultvalue'].split(','))
-                    if info['type'] != float:
+                    if info['type'] != 'float':
                         values = tuple(int(v) for v in values)
 
                 if len(values) == 1:
@@ -340,7 +344,22 @@ def make_class(collection, xml_file, update_globals=True):
                 hash_calc.update_hash_string(option)
                 next_idx = idx + 1
 
-    uavo_id = hash_calc.get_hash()
+    return {
+        'name'           : name,
+        'id'             : hash_calc.get_hash(),
+        'is_single_inst' : is_single_inst,
+        'is_settings'    : is_settings,
+        'description'    : description,
+        'fields'         : fields,
+        }
+
+def build_class(desc, update_globals=True):
+    """ Builds the implementation class of a UAVO from its description. """
+    name = desc['name']
+    uavo_id = desc['id']
+    is_single_inst = desc['is_single_inst']
+    is_settings = desc['is_settings']
+    fields = desc['fields']
 
     ##### FORM A STRUCT TO PACK/UNPACK THIS UAVO'S CONTENT #####
     formats = []
@@ -390,6 +409,7 @@ def make_class(collection, xml_file, update_globals=True):
         _dtype = dtype
         _is_settings = is_settings
         _units = {f['name'] : f['units'] for f in fields}
+        _fieldinfo = fields
 
     # This is magic for two reasons.  First, we create the class to have
     # the proper dynamic name.  Second, we override __slots__, so that
@@ -416,6 +436,10 @@ def make_class(collection, xml_file, update_globals=True):
 
     return tuple_class
 
+def make_class(collection, xml_file, update_globals=True):
+    """ Parses an XML file describing a UAVO and builds its class. """
+    return build_class(parse_xml(collection, xml_file), update_globals)
+
 
 class UAVOHash():
     def __init__(self):
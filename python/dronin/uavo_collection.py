@@ -7,7 +7,7 @@ Copyright (C) 2015 dRonin, http://dronin.org
 Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
 """
 
-from . import uavo
+from . import uavo, uavo_schema
 
 import operator
 import os.path as op
@@ -139,7 +139,36 @@ class UAVOCollection(dict):
         content_list = []
 
         for file_name in glob.glob(os.path.join(path, '*.xml')):
-            with open(file_name, 'rU') as f:
+            with open(file_name, 'r') as f:
                 content_list.append(f.read())
 
         self.from_file_contents(content_list)
+
+    def from_schema_bytes(self, data):
+        """ Loads the UAVOs in a binary schema bundle.  Returns the UAVO hash
+        of the bundle. """
+        descs, uavohash = uavo_schema.unpack(data)
+
+        for desc in descs:
+            u = uavo.build_class(desc)
+
+            self.update([('{0:08x}'.format(u._id), u)])
+
+        return uavohash
+
+    def from_schema_file(self, path):
+        """ Loads the UAVOs in a binary schema bundle file, such as the
+        schema/uavos.bin uavobjgenerator writes. """
+        import mmap
+
+        with open(path, 'rb') as f:
+            data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+            try:
+                return self.from_schema_bytes(data)
+            finally:
+                data.close()
+
+    def to_schema_bytes(self):
+        """ Packs this collection into a binary schema bundle. """
+        return uavo_schema.pack(self)
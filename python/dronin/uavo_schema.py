@@ -0,0 +1,286 @@
+"""
+Binary UAVO schema bundles.
+
+A bundle describes a whole set of UAVOs -- objects, fields, enums, units and
+the UAVO hash -- in one flat little endian blob which can be used straight
+from a mapped file.  uavobjgenerator writes one to schema/uavos.bin, and the
+GCS can put one at the head of the logs it writes, so tools can decode a log
+without the XML definitions it was made with.
+
+    Header, 32 bytes:
+        0   char[4]  magic, "UAVS"
+        4   u16      version
+        6   u16      number of objects
+        8   u64      UAVO hash
+        16  u32      offset of the object table
+        20  u32      offset of the field table
+        24  u32      offset of the list table
+        28  u32      offset of the string table
+
+    Object, 16 bytes, in order of id:
+        0   u32      id
+        4   u32      name
+        8   u16      first field
+        10  u16      number of fields
+        12  u16      size of the data, bytes
+        14  u8       flags, OBJ_SINGLE_INST | OBJ_SETTINGS
+        15  u8       reserved
+
+    Field, 24 bytes, in the order they are packed:
+        0   u32      name
+        4   u32      units
+        8   u8       type, as uavo.type_enum_map
+        9   u8       number of enum options
+        10  u16      number of elements
+        12  u32      element names, or NO_LIST if they are just numbered
+        16  u32      enum options, (name, value) pairs
+        20  u32      default value of each element, as its raw 32 bits
+
+Strings are offsets into the string table, where they are NUL terminated.
+Lists are indices of u32 entries in the list table.
+
+GCS logs start with a text header -- "dRonin git hash:", the git hash, the
+UAVO hash and "##", a line each -- then records of a u32 timestamp in ms and
+a u64 size, little endian, followed by that many bytes of UAVTalk.  When
+"Embed object definitions in logs" is checked in the GCS, a "uavoschema"
+line comes before the "##" and the first record, stamped 0, is instead
+LOG_RECORD_MAGIC, the size of the bundle as a big endian u32 and the bundle
+compressed with zlib.  Readers from before the flag can't play such logs, so
+the GCS leaves it off unless asked.
+
+Copyright (C) 2017 dRonin, http://dronin.org
+
+Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+"""
+
+from collections import OrderedDict
+import struct
+
+from . import uavo
+
+MAGIC = b'UAVS'
+VERSION = 1
+
+# Prefix of the bundle record the GCS writes at the start of a log.  The
+# rest of the record is the bundle compressed as by qCompress.
+LOG_RECORD_MAGIC = b'uavoschema'
+
+OBJ_SINGLE_INST = 1
+OBJ_SETTINGS = 2
+
+NO_LIST = 0xFFFFFFFF
+
+header_fmt = struct.Struct('<4sHHQIIII')
+object_fmt = struct.Struct('<IIHHHBx')
+field_fmt = struct.Struct('<IIBBHIII')
+
+type_names = dict((v, k) for k, v in uavo.type_enum_map.items())
+
+# How a default value is kept in its 32 bits, by type
+value_codes = {
+    'int8'    : 'i',
+    'int16'   : 'i',
+    'int32'   : 'i',
+    'uint8'   : 'I',
+    'uint16'  : 'I',
+    'uint32'  : 'I',
+    'float'   : 'f',
+    'enum'    : 'I',
+    }
+
+def uavo_hash(ids):
+    """ The 64 bit hash of a set of UAVOs, as uavobjgenerator makes it. """
+    h = 0
+
+    for uavo_id in sorted(ids, reverse=True):
+        h = (h ^ ((h << 7) + (h >> 2) + uavo_id)) & 0xFFFFFFFFFFFFFFFF
+
+    return h
+
+def pack(collection):
+    """ Makes a bundle of the UAVOs in a collection. """
+    objs = sorted(collection.values(), key=lambda u: u._id)
+
+    strings = OrderedDict([(b'', 0)])
+    strings_size = [1]
+
+    def string(s):
+        s = (s or '').encode('latin-1')
+
+        if s not in strings:
+            strings[s] = strings_size[0]
+            strings_size[0] += len(s) + 1
+
+        return strings[s]
+
+    objects = []
+    fields = []
+    lists = []
+
+    for u in objs:
+        flags = 0
+        if u._single:
+            flags |= OBJ_SINGLE_INST
+        if u._is_settings:
+            flags |= OBJ_SETTINGS
+
+        objects.append(object_fmt.pack(u._id, string(u._name[5:]),
+            len(fields), len(u._fieldinfo), u._packstruct.size, flags))
+
+        for f in u._fieldinfo:
+            name = string(f['name'])
+            units = string(f['units'])
+
+            element_names = NO_LIST
+            if f['elementnames']:
+                element_names = len(lists)
+                lists.extend(string(n) for n in f['elementnames'])
+
+            options = NO_LIST
+            num_options = 0
+            if f['type'] == 'enum':
+                options = len(lists)
+                num_options = len(f['options'])
+                for option, value in f['options'].items():
+                    lists.extend((string(option), value))
+
+            defaults = f['defaultvalue']
+            if not isinstance(defaults, tuple):
+                defaults = (defaults,) * f['elements']
+
+            code = value_codes[f['type']]
+            default_list = len(lists)
+            lists.extend(struct.unpack('<I', struct.pack('<' + code, v))[0]
+                    for v in defaults)
+
+            fields.append(field_fmt.pack(name, units, f['type_val'],
+                num_options, f['elements'], element_names, options,
+                default_list))
+
+    objects_offset = header_fmt.size
+    fields_offset = objects_offset + object_fmt.size * len(objects)
+    lists_offset = fields_offset + field_fmt.size * len(fields)
+    strings_offset = lists_offset + 4 * len(lists)
+
+    string_table = b''.join(s + b'\0' for s in strings)
+    string_table += b'\0' * (-len(string_table) % 4)
+
+    header = header_fmt.pack(MAGIC, VERSION, len(objects),
+            uavo_hash(u._id for u in objs), objects_offset, fields_offset,
+            lists_offset, strings_offset)
+
+    return b''.join([header] + objects + fields +
+            [struct.pack('<%dI' % len(lists), *lists), string_table])
+
+def check_header(data):
+    """ Checks a bundle is one this can read, and returns its header. """
+    if len(data) < header_fmt.size:
+        raise ValueError("UAVO schema bundle is truncated")
+
+    header = header_fmt.unpack_from(data, 0)
+
+    if header[0] != MAGIC:
+        raise ValueError("Not a UAVO schema bundle")
+
+    if header[1] != VERSION:
+        raise ValueError("UAVO schema bundle version %d is not supported" %
+                (header[1]))
+
+    return header
+
+def unpack(data):
+    """ Returns the descriptions of the UAVOs in a bundle, in the form
+    uavo.build_class takes, and the UAVO hash.
+
+    data may be anything supporting the buffer protocol, such as a mapped
+    file. """
+    (magic, version, num_objects, uavohash, objects_offset, fields_offset,
+            lists_offset, strings_offset) = check_header(data)
+
+    string_table = bytes(memoryview(data)[strings_offset:])
+    string_cache = {}
+
+    def string(offs):
+        s = string_cache.get(offs)
+
+        if s is None:
+            s = string_table[offs:string_table.index(b'\0', offs)]
+            s = s.decode('latin-1')
+            string_cache[offs] = s
+
+        return s
+
+    def entries(index, count):
+        return struct.unpack_from('<%dI' % count, data,
+                lists_offset + 4 * index)
+
+    objects = [object_fmt.unpack_from(data, objects_offset + object_fmt.size * i)
+            for i in range(num_objects)]
+
+    total_fields = sum(o[3] for o in objects)
+    field_table = [field_fmt.unpack_from(data, fields_offset + field_fmt.size * j)
+            for j in range(total_fields)]
+
+    descs = []
+
+    for (uavo_id, name, first_field, num_fields, size, flags) in objects:
+        fields = []
+
+        for (fname, units, type_val, num_options, elements, element_names,
+                options, defaults) in field_table[first_field:first_field + num_fields]:
+
+            ftype = type_names[type_val]
+
+            info = {
+                'name'         : string(fname),
+                'units'        : string(units),
+                'type'         : ftype,
+                'type_val'     : type_val,
+                'elements'     : elements,
+                'elementnames' : [],
+                'parent'       : None,
+                }
+
+            if element_names != NO_LIST:
+                info['elementnames'] = [string(n) for n in
+                        entries(element_names, elements)]
+
+            if ftype == 'enum':
+                pairs = entries(options, 2 * num_options)
+                info['options'] = OrderedDict((string(pairs[k]), pairs[k + 1])
+                        for k in range(0, len(pairs), 2))
+
+            values = struct.unpack_from('<%d%s' % (elements,
+                value_codes[ftype]), data, lists_offset + 4 * defaults)
+
+            info['defaultvalue'] = values[0] if elements == 1 else values
+
+            fields.append(info)
+
+        descs.append({
+            'name'           : string(name),
+            'id'             : uavo_id,
+            'is_single_inst' : int(bool(flags & OBJ_SINGLE_INST)),
+            'is_settings'    : int(bool(flags & OBJ_SETTINGS)),
+            'description'    : None,
+            'fields'         : fields,
+            })
+
+    return descs, uavohash
+
+def pack_log_record(bundle):
+    """ Makes the payload of the log record carrying a bundle. """
+    import zlib
+
+    return LOG_RECORD_MAGIC + struct.pack('>I', len(bundle)) + \
+            zlib.compress(bundle)
+
+def unpack_log_record(payload):
+    """ Returns the bundle in a log record payload, or None if it is some
+    other kind of record. """
+    import zlib
+
+    if bytes(payload[:len(LOG_RECORD_MAGIC)]) != LOG_RECORD_MAGIC:
+        return None
+
+    return zlib.decompress(bytes(payload[len(LOG_RECORD_MAGIC) + 4:]))
@@ -21,6 +21,8 @@ __all__ = [ "send_object", "process_stream" ]
 
 from six import int2byte, indexbytes, byte2int, iterbytes
 
+from .uavo_schema import LOG_RECORD_MAGIC as SCHEMA_MAGIC
+
 # Constants used for UAVTalk parsing
 (MIN_HEADER_LENGTH, MAX_HEADER_LENGTH, MAX_PAYLOAD_LENGTH) = (8, 12, (256-12))
 (SYNC_VAL) = (0x3C)
@@ -108,6 +110,22 @@ def process_stream(uavo_defs, use_walltime=False, gcs_timestamps=None,
 
             overrideTimestamp, logHdrLen = logheader_fmt.unpack_from(buf,buf_offset)
 
+            # The GCS may start a log with a record of the UAVO schema;
+            # it's no UAVTalk, so skip it.
+            magic_offset = buf_offset + logheader_fmt.size
+            if buf[magic_offset:magic_offset + len(SCHEMA_MAGIC)] == SCHEMA_MAGIC:
+                while len(buf) < magic_offset + logHdrLen:
+                    rx = yield None
+
+                    if rx is None:
+                        return
+
+                    buf = buf + rx
+
+                gcs_timestamps = True
+                buf_offset = magic_offset + logHdrLen
+                continue
+
             if gcs_timestamps is None:
                 if ((logHdrLen > 1000) or ( overrideTimestamp > 100000000)):
                     if indexbytes(buf, buf_offset) == SYNC_VAL:
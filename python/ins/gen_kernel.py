@@ -0,0 +1,248 @@
+#!/usr/bin/env python
+"""
+Generates the covariance kernels used by flight/Libraries/insgps14state.c
+
+The 14 state filter only ever fills in a fixed set of entries of F, G and
+H (see LinearizeFG and LinearizeH). This script expands
+
+  Pnew = (I+F*T)*P*(I+F*T)' + T^2*G*Q*G'
+
+and the serial measurement update for exactly that structure, operating on
+the packed upper triangle of P, so that no multiplies by known zeros are
+performed and nothing below the diagonal is stored.
+
+If the structure of LinearizeFG or LinearizeH changes the tables below must
+be updated to match and the kernel regenerated with
+
+  python gen_kernel.py > ../../flight/Libraries/inc/insgps14state_kernel.h
+"""
+
+from __future__ import print_function
+
+import sys
+
+NUMX = 14
+NUMW = 10
+NUMV = 10
+
+# A coefficient is either the name of a runtime matrix entry or a constant
+ONE = 1.0
+
+
+def f_structure():
+    """ nonzero entries of each row of F, as {row: [(col, coef)]} """
+    F = {}
+    # Pdot = V
+    for i in range(3):
+        F[i] = [(3 + i, ONE)]
+    # dVdot/dq and dVdot/dabias
+    for i in range(3, 6):
+        F[i] = [(k, 'F[%d][%d]' % (i, k)) for k in (6, 7, 8, 9, 13)]
+    # dqdot/dq (zero diagonal) and dqdot/dwbias
+    for i in range(6, 10):
+        F[i] = [(k, 'F[%d][%d]' % (i, k)) for k in range(6, 13) if k != i]
+    return F
+
+
+def g_structure():
+    """ nonzero entries of each row of G, as {row: [(noise, coef)]} """
+    G = {}
+    # dVdot/dna
+    for i in range(3, 6):
+        G[i] = [(w, 'G[%d][%d]' % (i, w)) for w in (3, 4, 5)]
+    # dqdot/dnw
+    for i in range(6, 10):
+        G[i] = [(w, 'G[%d][%d]' % (i, w)) for w in (0, 1, 2)]
+    # biases are driven directly by their random walk
+    for i in range(10, 14):
+        G[i] = [(i - 4, ONE)]
+    return G
+
+
+def h_structure():
+    """ nonzero entries of each row of H, as {row: [(col, coef)]} """
+    H = {}
+    # dP/dP = I and dV/dV = I
+    for m in range(6):
+        H[m] = [(m, ONE)]
+    # dBb/dq, the vertical component is not used
+    for m in (6, 7):
+        H[m] = [(k, 'H[%d][%d]' % (m, k)) for k in range(6, 10)]
+    H[8] = []
+    # dAlt/dPz
+    H[9] = [(2, -ONE)]
+    return H
+
+
+def p(i, j):
+    if i > j:
+        i, j = j, i
+    return 'P[PIDX(%d,%d)]' % (i, j)
+
+
+def a(i, j):
+    return 'a%d_%d' % (i, j)
+
+
+def f(i, k):
+    return 'f%d_%d' % (i, k)
+
+
+def term(coef, operand):
+    """ coef * operand, folding the unit constants """
+    if coef == ONE:
+        return '+ ' + operand
+    if coef == -ONE:
+        return '- ' + operand
+    return '+ %s*%s' % (coef, operand)
+
+
+def join(terms):
+    s = ' '.join(terms)
+    if s.startswith('+ '):
+        s = s[2:]
+    elif s.startswith('- '):
+        s = '-' + s[2:]
+    return s
+
+
+def covariance_prediction(out):
+    F = f_structure()
+    G = g_structure()
+
+    w = out.write
+    w('#ifndef COVARIANCE_PREDICTION_GENERAL\n')
+    w('void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],\n')
+    w('\t\t\t  float Q[NUMW], float dT, float P[NUMP])\n')
+    w('{\n')
+    w('\tconst float T = dT;\n')
+    w('\tconst float Tsq = dT * dT;\n\n')
+
+    # F*T, the unit entries of F are just T
+    w('\t// F*T\n')
+    scaled = {}
+    for i in range(NUMX):
+        for (k, coef) in F.get(i, []):
+            if coef == ONE:
+                scaled[(i, k)] = 'T'
+            else:
+                w('\tconst float %s = %s * T;\n' % (f(i, k), coef))
+                scaled[(i, k)] = f(i, k)
+    w('\n')
+
+    # Q*T^2 for the noise inputs that are used
+    used_w = sorted(set(n for row in G.values() for (n, _) in row))
+    w('\t// Q*T^2\n')
+    for n in used_w:
+        w('\tconst float q%d = Q[%d] * Tsq;\n' % (n, n))
+    w('\n')
+
+    # A = (I+F*T)*P, only the entries read by the second product
+    needed = set()
+    for i in range(NUMX):
+        if not F.get(i):
+            continue
+        for j in range(i, NUMX):
+            needed.add((i, j))
+            for (k, _) in F.get(j, []):
+                needed.add((i, k))
+
+    w('\t// A = (I+F*T)*P, rows without any F terms are just P\n')
+    for (i, c) in sorted(needed):
+        terms = [term(ONE, p(i, c))]
+        terms += ['+ %s*%s' % (scaled[(i, k)], p(k, c)) for (k, _) in F[i]]
+        w('\tconst float %s = %s;\n' % (a(i, c), join(terms)))
+    w('\n')
+
+    def A(i, c):
+        return a(i, c) if F.get(i) else p(i, c)
+
+    # Pnew = A*(I+F*T)' + T^2*G*Q*G', upper triangle only
+    w('\t// Pnew = A*(I+F*T)\' + T^2*G*Q*G\'\n')
+    for i in range(NUMX):
+        for j in range(i, NUMX):
+            terms = [term(ONE, A(i, j))]
+            terms += ['+ %s*%s' % (scaled[(j, k)], A(i, k)) for (k, _) in F.get(j, [])]
+            gi = dict(G.get(i, []))
+            for (n, gjn) in G.get(j, []):
+                if n not in gi:
+                    continue
+                factors = ['q%d' % n] + [g for g in (gi[n], gjn) if g != ONE]
+                terms.append('+ ' + '*'.join(factors))
+            lhs = p(i, j)
+            rhs = join(terms)
+            if rhs == lhs:
+                continue
+            if rhs.startswith(lhs + ' + '):
+                w('\t%s += %s;\n' % (lhs, rhs[len(lhs) + 3:]))
+            else:
+                w('\t%s = %s;\n' % (lhs, rhs))
+    w('}\n')
+    w('#endif /* COVARIANCE_PREDICTION_GENERAL */\n')
+
+
+def serial_update(out):
+    H = h_structure()
+
+    w = out.write
+    w('void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],\n')
+    w('\t\t  float Y[NUMV], float P[NUMP], float X[NUMX],\n')
+    w('\t\t  uint16_t SensorsUsed)\n')
+    w('{\n')
+    w('\tfloat HP[NUMX], K[NUMX], HPHR, Error;\n')
+    w('\tuint8_t i, j, m;\n\n')
+    w('\tfor (m = 0; m < NUMV; m++) {\n')
+    w('\t\tif (!(SensorsUsed & (0x01 << m)))\n')
+    w('\t\t\tcontinue;\n\n')
+    w('\t\t// Find HP = H*P and HPHR = H*P*H\' + R\n')
+    w('\t\tswitch (m) {\n')
+    for m in range(NUMV):
+        w('\t\tcase %d:\n' % m)
+        if not H[m]:
+            w('\t\t\t// H row is zero so K is zero and nothing changes\n')
+            w('\t\t\tcontinue;\n')
+            continue
+        for j in range(NUMX):
+            w('\t\t\tHP[%d] = %s;\n' % (j, join([term(c, p(k, j)) for (k, c) in H[m]])))
+        w('\t\t\tHPHR = R[%d] %s;\n' % (m, ' '.join(term(c, 'HP[%d]' % k) for (k, c) in H[m])))
+        w('\t\t\tbreak;\n')
+    w('\t\tdefault:\n')
+    w('\t\t\tcontinue;\n')
+    w('\t\t}\n\n')
+    w('\t\tfor (i = 0; i < NUMX; i++)\n')
+    w('\t\t\tK[i] = HP[i] / HPHR;\t// find K = HP/HPHR\n\n')
+    w('\t\tfloat *p = P;\n')
+    w('\t\tfor (i = 0; i < NUMX; i++) {\t// Find P(m)= P(m-1) - K*HP\n')
+    w('\t\t\tfor (j = i; j < NUMX; j++)\n')
+    w('\t\t\t\t*p++ -= K[i] * HP[j];\n')
+    w('\t\t}\n\n')
+    w('\t\tError = Z[m] - Y[m];\n')
+    w('\t\tfor (i = 0; i < NUMX; i++)\t// Find X(m)= X(m-1) + K*Error\n')
+    w('\t\t\tX[i] += K[i] * Error;\n')
+    w('\t}\n\n')
+    w('\tINSLimitBias();\n')
+    w('}\n')
+
+
+def main(out):
+    w = out.write
+    w('/**\n')
+    w(' ******************************************************************************\n')
+    w(' * @file       insgps14state_kernel.h\n')
+    w(' * @brief      Structure specialized covariance kernels for the 14 state INS\n')
+    w(' *\n')
+    w(' * THIS FILE IS GENERATED BY python/ins/gen_kernel.py, DO NOT EDIT.\n')
+    w(' *\n')
+    w(' * Only included by insgps14state.c. P is the packed upper triangle of the\n')
+    w(' * covariance matrix, indexed with PIDX(i,j) for i <= j.\n')
+    w(' *****************************************************************************/\n\n')
+    w('#ifndef INSGPS14STATE_KERNEL_H\n')
+    w('#define INSGPS14STATE_KERNEL_H\n\n')
+    covariance_prediction(out)
+    w('\n')
+    serial_update(out)
+    w('\n#endif /* INSGPS14STATE_KERNEL_H */\n')
+
+
+if __name__ == '__main__':
+    main(sys.stdout)
@@ -6,6 +6,27 @@
 #include "numpy/ndarraytypes.h"
 
 #include <insgps.h>
+#include <string.h>
+#include <time.h>
+
+#include "insgps_ref.h"
+
+#define NUMX INSGPS_REF_NUMX
+#define NUMW INSGPS_REF_NUMW
+#define NUMV INSGPS_REF_NUMV
+#define NUMP (NUMX * (NUMX + 1) / 2)
+
+/* Filter internals, these are not static in insgps14state.c */
+extern float F[NUMX][NUMX], G[NUMX][NUMW], H[NUMV][NUMX];
+extern float P[NUMP], X[NUMX], Q[NUMW], R[NUMV], Be[3];
+
+void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
+			  float Q[NUMW], float dT, float P[NUMP]);
+void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
+		  float Y[NUMV], float P[NUMP], float X[NUMX],
+		  uint16_t SensorsUsed);
+void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX]);
+void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV]);
 
 int not_doublevector(PyArrayObject *vec)
 {
@@ -294,6 +315,206 @@ set_state(PyObject* self, PyObject* args, PyObject *kwarg)
 }
 
 
+/**
+ * parseCovariance(mat_in, P)
+ *
+ * @param[in] mat_in the python array to extract elements from
+ * @param[out] P dense float covariance
+ * @return true if successful, false if not
+ */
+static bool parseCovariance(PyArrayObject *mat_in, float P[NUMX][NUMX])
+{
+	if (PyArray_TYPE(mat_in) != NPY_DOUBLE || PyArray_NDIM(mat_in) != 2 ||
+	    PyArray_DIM(mat_in, 0) != NUMX || PyArray_DIM(mat_in, 1) != NUMX) {
+		PyErr_Format(PyExc_ValueError,
+              "Covariance is not a %dx%d double matrix.", NUMX, NUMX);
+		return false;
+	}
+
+	for (int i = 0; i < NUMX; i++)
+		for (int j = 0; j < NUMX; j++)
+			P[i][j] = *(double *) PyArray_GETPTR2(mat_in, i, j);
+
+	return true;
+}
+
+/**
+ * pack_covariance put a dense covariance into an array
+ */
+static PyObject*
+pack_covariance(float P[NUMX][NUMX])
+{
+	npy_intp dims[2] = { NUMX, NUMX };
+
+	PyArrayObject *mat;
+	mat = (PyArrayObject*) PyArray_SimpleNew(2, dims, NPY_DOUBLE);
+	double *m = (double *) PyArray_DATA(mat);
+
+	for (int i = 0; i < NUMX; i++)
+		for (int j = 0; j < NUMX; j++)
+			*m++ = P[i][j];
+
+	return (PyObject *) mat;
+}
+
+/**
+ * unpack_covariance expand the filter's upper triangle to a dense matrix
+ */
+static void unpack_covariance(const float *Pp, float Pd[NUMX][NUMX])
+{
+	for (int i = 0; i < NUMX; i++)
+		for (int j = i; j < NUMX; j++)
+			Pd[i][j] = Pd[j][i] = *Pp++;
+}
+
+/**
+ * covariance - get the covariance of the EKF
+ * @return dense covariance matrix
+ */
+static PyObject*
+covariance(PyObject* self, PyObject* args)
+{
+	float Pd[NUMX][NUMX];
+
+	unpack_covariance(P, Pd);
+
+	return pack_covariance(Pd);
+}
+
+/**
+ * dense_prediction - covariance prediction by the dense code the packed
+ * kernels replaced, with the F and G of the last state prediction
+ * @params[in] self
+ * @params[in] args
+ *  - P - dense covariance before the prediction
+ *  - dT
+ * @return dense covariance after it
+ */
+static PyObject*
+dense_prediction(PyObject* self, PyObject* args)
+{
+	PyArrayObject *mat_p;
+	float Pd[NUMX][NUMX];
+	float dT;
+
+	if (!PyArg_ParseTuple(args, "O!f", &PyArray_Type, &mat_p, &dT))
+		return NULL;
+
+	if (!parseCovariance(mat_p, Pd))
+		return NULL;
+
+	ref_covariance_prediction(F, G, Q, dT, Pd);
+
+	return pack_covariance(Pd);
+}
+
+/**
+ * dense_correction - covariance update by the dense code the packed
+ * kernels replaced.  Call it before correction, as it linearizes at the
+ * current state.  The covariance doesn't depend on the measurements, only
+ * on which sensors are used.
+ * @params[in] self
+ * @params[in] args
+ *  - P - dense covariance before the correction
+ *  - sensors - binary flags for which sensors should be used
+ * @return dense covariance after it
+ */
+static PyObject*
+dense_correction(PyObject* self, PyObject* args)
+{
+	PyArrayObject *mat_p;
+	float Pd[NUMX][NUMX], Xd[NUMX], Y[NUMV];
+	int sensors;
+
+	if (!PyArg_ParseTuple(args, "O!i", &PyArray_Type, &mat_p, &sensors))
+		return NULL;
+
+	if (!parseCovariance(mat_p, Pd))
+		return NULL;
+
+	memcpy(Xd, X, sizeof(Xd));
+	LinearizeH(Xd, Be, H);
+	MeasurementEq(Xd, Be, Y);
+	ref_serial_update(H, R, Y, Y, Pd, Xd, sensors);
+
+	return pack_covariance(Pd);
+}
+
+static double now_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/**
+ * time_covariance - time the dense and packed covariance code on copies
+ * of the current filter
+ * @params[in] self
+ * @params[in] args
+ *  - loops - number of times to run each
+ * @return ns per dense prediction, packed prediction, dense update and
+ * packed update, using all sensors.  The updates include copying in the
+ * starting covariance.
+ */
+static PyObject*
+time_covariance(PyObject* self, PyObject* args)
+{
+	float Pd[NUMX][NUMX], Pp[NUMP], Xd[NUMX], Y[NUMV];
+	float sink = 0;
+	double t[5];
+	int loops;
+
+	if (!PyArg_ParseTuple(args, "i", &loops))
+		return NULL;
+
+	LinearizeH(X, Be, H);
+	MeasurementEq(X, Be, Y);
+
+	unpack_covariance(P, Pd);
+	t[0] = now_us();
+	for (int i = 0; i < loops; i++) {
+		ref_covariance_prediction(F, G, Q, 0.001f, Pd);
+		sink += Pd[3][3];
+	}
+
+	memcpy(Pp, P, sizeof(Pp));
+	t[1] = now_us();
+	for (int i = 0; i < loops; i++) {
+		CovariancePrediction(F, G, Q, 0.001f, Pp);
+		sink += Pp[3];
+	}
+
+	// Each update starts from the same covariance, as repeating them
+	// shrinks it into denormals and times those instead
+	float P0[NUMX][NUMX];
+	unpack_covariance(P, P0);
+	t[2] = now_us();
+	for (int i = 0; i < loops; i++) {
+		memcpy(Pd, P0, sizeof(Pd));
+		memcpy(Xd, X, sizeof(Xd));
+		ref_serial_update(H, R, Y, Y, Pd, Xd, FULL_SENSORS);
+		sink += Pd[3][3];
+	}
+
+	t[3] = now_us();
+	for (int i = 0; i < loops; i++) {
+		memcpy(Pp, P, sizeof(Pp));
+		memcpy(Xd, X, sizeof(Xd));
+		SerialUpdate(H, R, Y, Y, Pp, Xd, FULL_SENSORS);
+		sink += Pp[3];
+	}
+	t[4] = now_us();
+
+	// Keep the loops from being optimized out
+	if (sink != sink)
+		fprintf(stderr, "Covariance diverged\r\n");
+
+	return Py_BuildValue("dddd", (t[1] - t[0]) * 1000 / loops,
+		(t[2] - t[1]) * 1000 / loops, (t[3] - t[2]) * 1000 / loops,
+		(t[4] - t[3]) * 1000 / loops);
+}
+
 static PyObject*
 init(PyObject* self, PyObject* args)
 {
@@ -312,6 +533,10 @@ static PyMethodDef InsMethods[] =
 	{"correction", correction, METH_VARARGS, "Apply state correction based on measured sensors."},
 	{"configure", (PyCFunction)configure, METH_VARARGS|METH_KEYWORDS, "Configure EKF parameters."},
 	{"set_state", (PyCFunction)set_state, METH_VARARGS|METH_KEYWORDS, "Set the EKF state."},
+	{"covariance", covariance, METH_VARARGS, "Get the EKF covariance."},
+	{"dense_prediction", dense_prediction, METH_VARARGS, "Covariance prediction by the dense reference."},
+	{"dense_correction", dense_correction, METH_VARARGS, "Covariance update by the dense reference."},
+	{"time_covariance", time_covariance, METH_VARARGS, "Time the dense and packed covariance code."},
 	{NULL, NULL, 0, NULL}
 };
  
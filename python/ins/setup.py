@@ -2,8 +2,10 @@ from distutils.core import setup, Extension, Command
 import numpy
 
 module1 = Extension('ins',
-	sources = ['insmodule.c', '../../flight/Libraries/insgps14state.c'],
-	            include_dirs=['../../flight/Libraries/inc','../../shared/api',numpy.get_include()],
+	sources = ['insmodule.c', '../../flight/Libraries/insgps14state.c',
+	           '../../flight/tests/insgps/ref/insgps_ref.c'],
+	            include_dirs=['../../flight/Libraries/inc','../../shared/api',
+	                          '../../flight/tests/insgps/ref',numpy.get_include()],
                     extra_compile_args=['-std=gnu99'],)
  
 setup (name = 'PackageName',
@@ -865,6 +865,83 @@ class SimulatedFlightTests(unittest.TestCase):
 
         return sim.state, history, times
 
+class CovarianceTests(unittest.TestCase):
+    """ Check the packed covariance kernels against the dense code they
+    replaced, run on the same filter state
+    """
+
+    def setUp(self):
+        self.sim = CINS()
+        self.sim.prepare()
+
+        import simulation
+        self.model = simulation.Simulation()
+
+    def assertCovariance(self, dense, tol):
+        """ check the filter covariance against a dense one, relative to
+        the matching diagonal terms
+        """
+
+        packed = ins.covariance()
+        scale = numpy.sqrt(numpy.outer(numpy.diag(dense), numpy.diag(dense)))
+        self.assertLess(numpy.max(numpy.abs(packed - dense) / scale), tol)
+
+    def test_circle_matches_dense(self, STEPS=10000):
+        """ test that the packed covariance follows the dense one step by
+        step through a simulated flight of circles
+        """
+
+        sim = self.sim
+        model = self.model
+
+        dT = 1.0 / 666.0
+
+        numpy.random.seed(1)
+
+        for k in range(STEPS):
+
+            model.fly_circle(dT=dT)
+
+            gyro = model.get_gyro() / 180.0 * math.pi + numpy.random.randn(3,) * 1e-3
+            accel = model.get_accel() + numpy.random.randn(3,) * 1e-3
+
+            P = ins.covariance()
+            sim.predict(gyro, accel, dT=dT)
+            self.assertCovariance(ins.dense_prediction(P, dT), 1e-5)
+
+            # the masks must match the ones cins.py sets
+            if k % 60 == 59:
+                P = ins.dense_correction(ins.covariance(), 0x0003 | 0x0038)
+                sim.correction(pos=model.get_pos(), vel=model.get_vel())
+                self.assertCovariance(P, 1e-4)
+
+            if k % 20 == 8:
+                P = ins.dense_correction(ins.covariance(), 0x0200)
+                sim.correction(baro=-model.get_pos()[2])
+                self.assertCovariance(P, 1e-4)
+
+            if k % 20 == 15:
+                P = ins.dense_correction(ins.covariance(), 0x01C0)
+                sim.correction(mag=model.get_mag())
+                self.assertCovariance(P, 1e-4)
+
+    def test_timing(self):
+        """ report how long the dense and packed covariance code take
+        """
+
+        sim = self.sim
+
+        for k in range(100):
+            sim.predict(numpy.array([0.1,0.2,0.3]), numpy.array([0.0,0.0,-CINS.GRAV]))
+
+        times = ins.time_covariance(100000)
+
+        print('')
+        print('covariance prediction, dense:  %7.2f ns' % times[0])
+        print('covariance prediction, packed: %7.2f ns' % times[1])
+        print('serial update, dense:          %7.2f ns' % times[2])
+        print('serial update, packed:         %7.2f ns' % times[3])
+
 if __name__ == '__main__':
     selected_test = None
 
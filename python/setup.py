@@ -5,12 +5,26 @@ https://github.com/pypa/sampleproject
 """
 
 # Always prefer setuptools over distutils
-from setuptools import setup, find_packages
+from setuptools import setup, find_packages, Extension
 # To use a consistent encoding
 from codecs import open
 from os import path
 
 here = path.abspath(path.dirname(__file__))
+
+# The log parsing extension is optional: without numpy to build against, or a
+# compiler, logs are parsed in pure Python.
+ext_modules = []
+
+try:
+    import numpy
+
+    ext_modules.append(Extension('dronin._uavtalk',
+        sources=['dronin/_uavtalkmodule.c'],
+        include_dirs=[numpy.get_include()],
+        optional=True))
+except ImportError:
+    pass
 with open(path.join(here, 'README.rst'), encoding='utf-8') as f:
     long_description = f.read()
 
@@ -77,6 +91,8 @@ setup(
     # simple. Or you can use find_packages().
     packages = ['dronin', 'dronin.logviewer'],
 
+    ext_modules = ext_modules,
+
     # Just requires the base python system to run
     install_requires=['six'],
 
@@ -88,7 +104,7 @@ setup(
 
     scripts = [ 'dronin-dumplog', 'dronin-halt',
         'dronin-getconfig', 'dronin-logfsimport',
-        'dronin-shell' ],
+        'dronin-shell', 'dronin-blackbox' ],
 #    package_data={
 #        'sample': ['package_data.dat'],
 #    },